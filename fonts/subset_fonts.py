@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+# Glyph subset font generator for esp32-weather-epd.
+# Copyright (C) 2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Builds a subset of a font family that only contains the glyphs the firmware
+# can actually draw at each font size. The character set of a size is the
+# union of the sources listed for it in SIZE_SOURCES:
+#
+#   numeric  digits, signs and separators of formatted numbers
+#   locale   every string of the selected locale_<LOCALE>.inc (labels, units,
+#            day and month names, AM/PM, format strings)
+#   source   the string literals of the sources that draw (status and error
+#            messages, CITY_STRING, ...), except those holding UTF-8 text,
+#            which is only ever logged
+#   full     all of ISO-8859-1, for sizes that draw text received from the
+#            API (alerts)
+#
+# Subset fonts keep the Adafruit GFX layout, but their glyph table is dense:
+# the n-th glyph present is stored under the code 0x20 + n (space is always
+# first) and a 224 byte remap table translates 0x20..0xFF to those codes, 0
+# meaning the glyph was dropped. '?' is always kept, the renderer draws it in
+# place of dropped characters. The renderer text helpers apply the remap
+# before measuring or printing (see FONT_SUBSET in renderer.cpp). Sizes with
+# the full character set are included from the original family unchanged.
+#
+# The subset has to be generated again when the locale, CITY_STRING or the
+# strings in the source change:
+#
+#   python3 fonts/subset_fonts.py --family FreeSans
+#
+# then set FONT_HEADER in config.h to "fonts/FreeSans_subset.h".
+#
+# Usage:
+#   python3 subset_fonts.py [--family FAMILY] [--locale LOCALE] [--check]
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, '..')
+SRC = os.path.join(ROOT, 'src')
+FONTS = os.path.join(ROOT, 'lib', 'esp32-weather-epd-assets', 'fonts')
+sys.path.insert(0, os.path.join(ROOT, 'tools'))
+import pack_assets  # noqa: E402
+
+REMAP_FIRST = 0x20
+REMAP_LAST = 0xFF
+FALLBACK = ord('?')  # drawn in place of dropped characters
+
+# Character sources of each FONT_ size, see renderer.cpp for what is drawn
+# with which font. Sizes that are not listed keep the full character set.
+SIZE_SOURCES = {
+    'FONT_4pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_5pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_6pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_7pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_8pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_9pt8b':  ('numeric', 'locale', 'source'),
+    'FONT_10pt8b': ('numeric', 'locale', 'source'),
+    'FONT_11pt8b': ('numeric', 'locale', 'source'),
+    # 12pt and 14pt draw alert titles and descriptions
+    'FONT_16pt8b': ('numeric', 'locale', 'source'),
+    'FONT_18pt8b': ('numeric', 'locale', 'source'),
+    'FONT_20pt8b': ('numeric', 'locale', 'source'),
+    'FONT_22pt8b': ('numeric', 'locale', 'source'),
+    'FONT_24pt8b': ('numeric', 'locale', 'source'),
+    'FONT_26pt8b': ('numeric', 'locale', 'source'),
+    'FONT_48pt8b_temperature': ('numeric',),
+}
+
+NUMERIC = b' 0123456789+-.,:%/()|\xb0'
+
+# sources whose string literals can end up on the display
+DRAWING_SOURCES = ('config.cpp', 'display_utils.cpp', 'main.cpp',
+                   'renderer.cpp')
+
+ESCAPES = {'n': 10, 't': 9, 'r': 13, '0': 0, '\\': 92, '"': 34, "'": 39,
+           'a': 7, 'b': 8, 'f': 12, 'v': 11, '?': 63}
+
+
+def strip_comments(text):
+    """Removes C and C++ comments, leaving string literals intact."""
+    return re.sub(r'//[^\n]*|/\*.*?\*/|("(?:\\.|[^"\\\n])*")',
+                  lambda m: m.group(1) or ' ', text, flags=re.S)
+
+
+def c_string_bytes(body):
+    """Returns the bytes of a C string literal body, escapes resolved."""
+    out = bytearray()
+    raw = body.encode('utf-8')
+    i = 0
+    while i < len(raw):
+        c = raw[i]
+        if c != 0x5c or i + 1 == len(raw):
+            out.append(c)
+            i += 1
+            continue
+        m = re.match(rb'[0-7]{1,3}', raw[i + 1:])
+        if m:
+            out.append(int(m.group(0), 8) & 0xff)
+            i += 1 + len(m.group(0))
+            continue
+        m = re.match(rb'x([0-9a-fA-F]+)', raw[i + 1:])
+        if m:
+            out.append(int(m.group(1), 16) & 0xff)
+            i += 1 + len(m.group(0))
+            continue
+        out.append(ESCAPES.get(chr(raw[i + 1]), raw[i + 1]))
+        i += 2
+    return bytes(out)
+
+
+def is_utf8_text(s):
+    try:
+        return not s.decode('utf-8').isascii()
+    except UnicodeDecodeError:
+        return False
+
+
+def string_literals(path, skip_utf8=False):
+    """Returns the set of bytes used in the string literals of a source file.
+    """
+    with open(path, 'r', encoding='utf-8', errors='replace') as f:
+        text = strip_comments(f.read())
+    chars = set()
+    for body in re.findall(r'"((?:\\.|[^"\\\n])*)"', text):
+        s = c_string_bytes(body)
+        if not (skip_utf8 and is_utf8_text(s)):
+            chars.update(s)
+    return chars
+
+
+def read_locale():
+    with open(os.path.join(SRC, 'include', 'config.h'), 'r') as f:
+        m = re.search(r'^#define LOCALE (\w+)', f.read(), re.M)
+    if m is None:
+        raise SystemExit('config.h: LOCALE not found')
+    return m.group(1)
+
+
+def char_sources(locale):
+    path = os.path.join(SRC, 'include', 'locales', f'locale_{locale}.inc')
+    if not os.path.exists(path):
+        raise SystemExit(f'{path}: no such locale')
+    source = set()
+    for name in DRAWING_SOURCES:
+        source |= string_literals(os.path.join(SRC, name), skip_utf8=True)
+    return {
+        'numeric': set(NUMERIC),
+        'locale': string_literals(path),
+        'source': source,
+    }
+
+
+def subset_font(font, chars):
+    """Returns (glyphs, bitmap, remap) of the subset of a parsed font."""
+    first, last, y_advance, glyphs, bitmap = font
+    codes = sorted(set(c for c in chars if first <= c <= last and c >= 0x20)
+                   | {0x20, FALLBACK})
+    remap = [0] * (REMAP_LAST - REMAP_FIRST + 1)
+    out_glyphs = []
+    out_bitmap = bytearray()
+    for n, c in enumerate(codes):
+        offset, w, h, x_advance, x_offset, y_offset = glyphs[c - first]
+        length = (w * h + 7) // 8
+        out_glyphs.append((len(out_bitmap), w, h, x_advance, x_offset,
+                           y_offset, c))
+        out_bitmap += bitmap[offset:offset + length]
+        remap[c - REMAP_FIRST] = REMAP_FIRST + n
+    return out_glyphs, bytes(out_bitmap), remap
+
+
+def glyph_comment(c):
+    ch = bytes([c]).decode('latin-1')
+    return f"0x{c:02X} '{ch}'" if ch.isprintable() else f'0x{c:02X}'
+
+
+def write_font(path, name, y_advance, glyphs, bitmap, remap):
+    lines = [f'const uint8_t {name}Bitmaps[] PROGMEM = {{']
+    for i in range(0, len(bitmap), 12):
+        row = ', '.join(f'0x{b:02X}' for b in bitmap[i:i + 12])
+        lines.append(f'  {row}{"," if i + 12 < len(bitmap) else " };"}')
+    lines.append('')
+    lines.append(f'const GFXglyph {name}Glyphs[] PROGMEM = {{')
+    for i, (off, w, h, xa, xo, yo, c) in enumerate(glyphs):
+        end = ',  ' if i + 1 < len(glyphs) else ' };'
+        lines.append(f'  {{ {off:5d}, {w:3d}, {h:3d}, {xa:3d}, {xo:4d}, '
+                     f'{yo:4d} }}{end} // {glyph_comment(c)}')
+    lines.append('')
+    lines.append(f'const uint8_t {name}Remap[] PROGMEM = {{')
+    for i in range(0, len(remap), 12):
+        row = ', '.join(f'0x{b:02X}' for b in remap[i:i + 12])
+        lines.append(f'  {row}{"," if i + 12 < len(remap) else " };"}')
+    lines.append('')
+    last = REMAP_FIRST + len(glyphs) - 1
+    lines.append(f'const GFXfont {name} PROGMEM = {{')
+    lines.append(f'  (uint8_t  *){name}Bitmaps,')
+    lines.append(f'  (GFXglyph *){name}Glyphs,')
+    lines.append(f'  0x{REMAP_FIRST:02X}, 0x{last:02X}, {y_advance} }};')
+    lines.append('')
+    size = len(bitmap) + 7 * len(glyphs) + 7 + len(remap)
+    lines.append(f'// Approx. {size} bytes')
+    with open(path, 'w', encoding='latin-1') as f:
+        f.write('\n'.join(lines) + '\n')
+    return size
+
+
+def font_size(font):
+    first, last, _, glyphs, bitmap = font
+    return len(bitmap) + 7 * len(glyphs) + 7
+
+
+def write_family(path, family, subset, includes, macros, subsets):
+    guard = f'__FONTS_{subset.upper()}_H__'
+    lines = [
+        f'// Glyph subset of {family} generated by fonts/subset_fonts.py,',
+        '// do not edit.',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '#include "font_subset.h"',
+    ]
+    lines += [f'#include "{i}"' for i in includes]
+    lines.append('')
+    lines += [f'#define {m} {n}' for m, n in macros]
+    lines.append('')
+    lines.append('#define FONT_SUBSET')
+    lines.append('static const font_subset_t FONT_SUBSETS[] = {')
+    for i, name in enumerate(subsets):
+        end = ',' if i + 1 < len(subsets) else ''
+        lines.append(f'  {{&{name}, {name}Remap}}{end}')
+    lines.append('};')
+    lines.append('#endif')
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def check_subset(font, glyphs, bitmap, remap):
+    """Verifies every kept glyph against the original font."""
+    first, _, _, full_glyphs, full_bitmap = font
+    for c in range(REMAP_FIRST, REMAP_LAST + 1):
+        code = remap[c - REMAP_FIRST]
+        if code == 0:
+            continue
+        off, w, h, xa, xo, yo, orig = glyphs[code - REMAP_FIRST]
+        f_off, f_w, f_h, f_xa, f_xo, f_yo = full_glyphs[c - first]
+        length = (w * h + 7) // 8
+        if (orig != c or (w, h, xa, xo, yo) != (f_w, f_h, f_xa, f_xo, f_yo)
+                or bitmap[off:off + length]
+                != full_bitmap[f_off:f_off + length]):
+            raise SystemExit(f'glyph 0x{c:02X} differs from the original')
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--family', default='FreeSans',
+                        help='font family in lib/esp32-weather-epd-assets/'
+                             'fonts')
+    parser.add_argument('--locale', default=None,
+                        help='locale code, LOCALE in config.h by default')
+    parser.add_argument('--check', action='store_true',
+                        help='compare every kept glyph with the original')
+    args = parser.parse_args()
+
+    locale = args.locale or read_locale()
+    sources = char_sources(locale)
+    fonts = pack_assets.read_font_family(f'fonts/{args.family}.h')
+    subset = f'{args.family}_subset'
+    os.makedirs(os.path.join(FONTS, subset), exist_ok=True)
+
+    includes, macros, subsets = [], [], []
+    total_full = total_subset = 0
+    print(f'{subset} ({locale}):')
+    for macro, path in sorted(fonts.items()):
+        name = os.path.splitext(os.path.basename(path))[0]
+        font = pack_assets.parse_font(path)
+        full = font_size(font)
+        total_full += full
+        if macro not in SIZE_SOURCES:
+            includes.append(f'{args.family}/{name}.h')
+            macros.append((macro, name))
+            total_subset += full
+            print(f'  {macro:24s} {full:7d}  (full)')
+            continue
+        chars = set()
+        for source in SIZE_SOURCES[macro]:
+            chars |= sources[source]
+        glyphs, bitmap, remap = subset_font(font, chars)
+        if args.check:
+            check_subset(font, glyphs, bitmap, remap)
+        sub_name = name.replace(args.family, subset, 1)
+        size = write_font(os.path.join(FONTS, subset, f'{sub_name}.h'),
+                          sub_name, font[2], glyphs, bitmap, remap)
+        includes.append(f'{subset}/{sub_name}.h')
+        macros.append((macro, sub_name))
+        subsets.append(sub_name)
+        total_subset += size
+        print(f'  {macro:24s} {full:7d} -> {size:6d}  '
+              f'{len(glyphs)} glyphs')
+    write_family(os.path.join(FONTS, f'{subset}.h'), args.family, subset,
+                 includes, macros, subsets)
+    print(f'  {"total":24s} {total_full:7d} -> {total_subset:6d}')
+
+
+if __name__ == '__main__':
+    main()
@@ -64,6 +64,13 @@ def generate_icons_h(directory):
     icons_h_content.append('} icon_name_t;')
     icons_h_content.append('')
 
+    # when built with -DICON_ATLAS the bitmaps are decoded from the compressed
+    # atlas generated by pack_icon_atlas.py instead
+    icons_h_content.append('#ifdef ICON_ATLAS')
+    icons_h_content.append('// Returns the bitmap decoded from the icon atlas (see icon_atlas.cpp).')
+    icons_h_content.append('const unsigned char* getBitmap(icon_name_t icon, size_t size);')
+    icons_h_content.append('#else')
+
     # define the constexpr function
     icons_h_content.append('constexpr const unsigned char* getBitmap(icon_name_t icon, size_t size)')
     icons_h_content.append('{')
@@ -82,6 +89,7 @@ def generate_icons_h(directory):
     icons_h_content.append('    return nullptr;')
     icons_h_content.append('  }')
     icons_h_content.append('}')
+    icons_h_content.append('#endif // ICON_ATLAS')
     icons_h_content.append('')
     icons_h_content.append('#endif')
     
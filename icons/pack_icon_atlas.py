@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+# Script to pack icons into a compressed atlas for esp32-weather-epd.
+# Copyright (C) 2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Packs the icons that the sources refer to by icon_name_t, and so may look up
+# with getBitmap(icon, size), into a single run-length compressed atlas
+# (icons_atlas.h), used when the firmware is built with -DICON_ATLAS.
+#
+# Atlas format:
+#   Each icon is stored as the run lengths of its pixels in row-major order,
+#   without row padding, alternating between white and ink runs and starting
+#   with a white run (which may be 0). Run lengths are LEB128 varints (7 bits
+#   per byte, least significant group first, high bit set on all but the last
+#   byte). ICON_ATLAS_SLOT[icon] is the row of the icon in ICON_ATLAS_OFFSET,
+#   or ICON_ATLAS_NONE if the icon is not packed. ICON_ATLAS_OFFSET[slot][size]
+#   holds the offset of the icon's runs in ICON_ATLAS_DATA.
+#
+# Usage:
+#   python3 pack_icon_atlas.py [--icons DIR] [--src DIR] [--sizes 32 64 196]
+#                              [--out FILE] [--benchmark]
+
+import argparse
+import os
+import re
+import time
+
+ICON_ATLAS_VERSION = 1
+
+
+def read_icon_names(icons_h):
+    with open(icons_h, 'r') as f:
+        text = f.read()
+    body = text[text.index('typedef enum icon_name {'):
+                text.index('} icon_name_t;')]
+    return re.findall(r'^\s+(\w+),$', body, re.MULTILINE)
+
+
+def strip_comments_and_strings(code):
+    return re.sub(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'',
+                  ' ', code, flags=re.DOTALL)
+
+
+def find_used_icons(src_dir, icon_names):
+    """Returns the icon_name_t values referenced in the sources."""
+    names = set(icon_names)
+    used = set()
+    for root, _, files in os.walk(src_dir):
+        for name in files:
+            if not name.endswith(('.cpp', '.h')):
+                continue
+            with open(os.path.join(root, name), 'r', errors='replace') as f:
+                code = strip_comments_and_strings(f.read())
+            used.update(w for w in re.findall(r'\b\w+\b', code)
+                        if w in names)
+    return used
+
+
+def read_bitmap(icons_dir, name, size):
+    path = os.path.join(icons_dir, f'{size}x{size}', f'{name}_{size}x{size}.h')
+    with open(path, 'r') as f:
+        text = f.read()
+    data = text[text.index('{') + 1:text.rindex('}')]
+    return bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]{2}', data))
+
+
+def encode_varint(n, out):
+    while n >= 0x80:
+        out.append((n & 0x7f) | 0x80)
+        n >>= 7
+    out.append(n)
+
+
+def compress(bitmap, size):
+    """Returns the run-length encoding of an inverted 1bpp bitmap."""
+    stride = (size + 7) // 8
+    out = bytearray()
+    ink = False  # runs start white
+    run = 0
+    for y in range(size):
+        row = bitmap[y * stride:(y + 1) * stride]
+        for x in range(size):
+            pixel_ink = not (row[x >> 3] & (0x80 >> (x & 7)))
+            if pixel_ink != ink:
+                encode_varint(run, out)
+                ink = pixel_ink
+                run = 0
+            run += 1
+    encode_varint(run, out)
+    return bytes(out)
+
+
+def mask_padding(bitmap, size):
+    """Sets the unused bits at the end of each row, which are never drawn."""
+    stride = (size + 7) // 8
+    pad = (0xff >> (size & 7)) if size & 7 else 0
+    out = bytearray(bitmap)
+    for y in range(size):
+        out[y * stride + stride - 1] |= pad
+    return bytes(out)
+
+
+def decompress(runs, size):
+    """Reference decoder, mirrors drawAtlasIcon() in icon_atlas.cpp."""
+    stride = (size + 7) // 8
+    bitmap = bytearray(b'\xff' * (stride * size))
+    pos = 0
+    i = 0
+    ink = False
+    total = size * size
+    while pos < total:
+        n = 0
+        shift = 0
+        while True:
+            b = runs[i]
+            i += 1
+            n |= (b & 0x7f) << shift
+            shift += 7
+            if not b & 0x80:
+                break
+        if ink:
+            for p in range(pos, pos + n):
+                y, x = divmod(p, size)
+                bitmap[y * stride + (x >> 3)] &= ~(0x80 >> (x & 7)) & 0xff
+        pos += n
+        ink = not ink
+    return bytes(bitmap)
+
+
+def build_atlas(icons_dir, src_dir, sizes):
+    """Packs the icons referenced by getBitmap() calls in src_dir."""
+    icon_names = read_icon_names(os.path.join(icons_dir, 'icons.h'))
+    used = find_used_icons(src_dir, icon_names)
+    sizes = sorted(sizes)
+    if len(used) >= 0xff:
+        raise SystemExit('too many icons for an 8-bit slot index')
+
+    data = bytearray()
+    slots = []
+    offsets = []
+    raw_total = 0
+    packed = []
+    for name in icon_names:
+        if name not in used:
+            slots.append(None)
+            continue
+        slots.append(len(offsets))
+        row = []
+        for size in sizes:
+            bitmap = read_bitmap(icons_dir, name, size)
+            runs = compress(bitmap, size)
+            row.append(len(data))
+            data += runs
+            raw_total += len(bitmap)
+            packed.append((name, size, bitmap, runs))
+        offsets.append((name, row))
+    return {'icon_names': icon_names, 'sizes': sizes, 'slots': slots,
+            'offsets': offsets, 'data': bytes(data), 'packed': packed,
+            'raw_total': raw_total}
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--icons', default=os.path.join(
+        here, '..', 'lib', 'esp32-weather-epd-assets', 'icons'),
+        help='directory containing icons.h and the SIZExSIZE directories')
+    parser.add_argument('--src', default=os.path.join(here, '..', 'src'),
+                        help='source directory scanned for icon_name_t values')
+    parser.add_argument('--sizes', type=int, nargs='+', default=[32, 64, 196],
+                        help='sizes getBitmap() is called with')
+    parser.add_argument('--out', help='output file (default: ICONS/icons_atlas.h)')
+    parser.add_argument('--benchmark', action='store_true',
+                        help='verify and time decoding of every packed icon')
+    args = parser.parse_args()
+
+    atlas = build_atlas(args.icons, args.src, args.sizes)
+    sizes, slots, offsets = atlas['sizes'], atlas['slots'], atlas['offsets']
+    data, packed, raw_total = atlas['data'], atlas['packed'], atlas['raw_total']
+    icon_names = atlas['icon_names']
+
+    out = args.out or os.path.join(args.icons, 'icons_atlas.h')
+    lines = []
+    lines.append('// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 pack_icon_atlas.py`')
+    lines.append('')
+    lines.append('#ifndef __ICONS_ATLAS_H__')
+    lines.append('#define __ICONS_ATLAS_H__')
+    lines.append('')
+    lines.append('#include <cstdint>')
+    lines.append('#include <pgmspace.h>')
+    lines.append('')
+    lines.append(f'#define ICON_ATLAS_VERSION {ICON_ATLAS_VERSION}')
+    lines.append(f'#define ICON_ATLAS_NUM_SIZES {len(sizes)}')
+    lines.append('#define ICON_ATLAS_NONE 0xff')
+    lines.append('')
+    lines.append(f'// {len(packed)} bitmaps, {raw_total} bytes uncompressed, '
+                 f'{len(data)} bytes compressed')
+    lines.append('const uint16_t ICON_ATLAS_SIZES[ICON_ATLAS_NUM_SIZES] = {'
+                 + ', '.join(str(s) for s in sizes) + '};')
+    lines.append('')
+    lines.append('// indexed by icon_name_t')
+    lines.append(f'const uint8_t ICON_ATLAS_SLOT[{len(icon_names)}] PROGMEM = {{')
+    cells = ['ICON_ATLAS_NONE' if slot is None else str(slot) for slot in slots]
+    line = ' '
+    for cell in cells:
+        if len(line) + len(cell) + 2 > 80:
+            lines.append(line)
+            line = ' '
+        line += f' {cell},'
+    lines.append(line)
+    lines.append('};')
+    lines.append('')
+    lines.append('// indexed by [slot][size index]')
+    lines.append(f'const uint32_t ICON_ATLAS_OFFSET[{len(offsets)}]'
+                 '[ICON_ATLAS_NUM_SIZES] PROGMEM = {')
+    for name, row in offsets:
+        lines.append(f'  {{{", ".join(str(o) for o in row)}}}, // {name}')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'const uint8_t ICON_ATLAS_DATA[{len(data)}] PROGMEM = {{')
+    for i in range(0, len(data), 12):
+        lines.append('  ' + ', '.join(f'0x{b:02x}' for b in data[i:i + 12])
+                     + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif')
+    with open(out, 'w') as f:
+        f.write('\n'.join(lines))
+    print(f'{out}: {len(packed)} bitmaps, {raw_total} -> {len(data)} bytes '
+          f'({100.0 * len(data) / raw_total:.1f}%)')
+
+    if args.benchmark:
+        for size in sizes:
+            icons = [p for p in packed if p[1] == size]
+            raw = sum(len(p[2]) for p in icons)
+            comp = sum(len(p[3]) for p in icons)
+            runs = 0
+            start = time.perf_counter()
+            for name, _, bitmap, encoded in icons:
+                if decompress(encoded, size) != mask_padding(bitmap, size):
+                    raise SystemExit(f'{name} {size}x{size} does not round-trip')
+            elapsed = time.perf_counter() - start
+            for _, _, _, encoded in icons:
+                runs += sum(1 for b in encoded if not b & 0x80)
+            print(f'  {size:3d}x{size:<3d} {len(icons):3d} icons '
+                  f'{raw:7d} -> {comp:6d} bytes ({100.0 * comp / raw:5.1f}%), '
+                  f'{runs / len(icons):6.0f} runs/icon, '
+                  f'python decode {1e3 * elapsed / len(icons):.2f} ms/icon')
+
+
+if __name__ == '__main__':
+    main()
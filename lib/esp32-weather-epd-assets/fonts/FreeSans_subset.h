@@ -0,0 +1,60 @@
+// Glyph subset of FreeSans generated by fonts/subset_fonts.py,
+// do not edit.
+#ifndef __FONTS_FREESANS_SUBSET_H__
+#define __FONTS_FREESANS_SUBSET_H__
+#include "font_subset.h"
+#include "FreeSans_subset/FreeSans_subset_10pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_11pt8b.h"
+#include "FreeSans/FreeSans_12pt8b.h"
+#include "FreeSans/FreeSans_14pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_16pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_18pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_20pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_22pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_24pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_26pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_48pt8b_temperature.h"
+#include "FreeSans_subset/FreeSans_subset_4pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_5pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_6pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_7pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_8pt8b.h"
+#include "FreeSans_subset/FreeSans_subset_9pt8b.h"
+
+#define FONT_10pt8b FreeSans_subset_10pt8b
+#define FONT_11pt8b FreeSans_subset_11pt8b
+#define FONT_12pt8b FreeSans_12pt8b
+#define FONT_14pt8b FreeSans_14pt8b
+#define FONT_16pt8b FreeSans_subset_16pt8b
+#define FONT_18pt8b FreeSans_subset_18pt8b
+#define FONT_20pt8b FreeSans_subset_20pt8b
+#define FONT_22pt8b FreeSans_subset_22pt8b
+#define FONT_24pt8b FreeSans_subset_24pt8b
+#define FONT_26pt8b FreeSans_subset_26pt8b
+#define FONT_48pt8b_temperature FreeSans_subset_48pt8b_temperature
+#define FONT_4pt8b FreeSans_subset_4pt8b
+#define FONT_5pt8b FreeSans_subset_5pt8b
+#define FONT_6pt8b FreeSans_subset_6pt8b
+#define FONT_7pt8b FreeSans_subset_7pt8b
+#define FONT_8pt8b FreeSans_subset_8pt8b
+#define FONT_9pt8b FreeSans_subset_9pt8b
+
+#define FONT_SUBSET
+static const font_subset_t FONT_SUBSETS[] = {
+  {&FreeSans_subset_10pt8b, FreeSans_subset_10pt8bRemap},
+  {&FreeSans_subset_11pt8b, FreeSans_subset_11pt8bRemap},
+  {&FreeSans_subset_16pt8b, FreeSans_subset_16pt8bRemap},
+  {&FreeSans_subset_18pt8b, FreeSans_subset_18pt8bRemap},
+  {&FreeSans_subset_20pt8b, FreeSans_subset_20pt8bRemap},
+  {&FreeSans_subset_22pt8b, FreeSans_subset_22pt8bRemap},
+  {&FreeSans_subset_24pt8b, FreeSans_subset_24pt8bRemap},
+  {&FreeSans_subset_26pt8b, FreeSans_subset_26pt8bRemap},
+  {&FreeSans_subset_48pt8b_temperature, FreeSans_subset_48pt8b_temperatureRemap},
+  {&FreeSans_subset_4pt8b, FreeSans_subset_4pt8bRemap},
+  {&FreeSans_subset_5pt8b, FreeSans_subset_5pt8bRemap},
+  {&FreeSans_subset_6pt8b, FreeSans_subset_6pt8bRemap},
+  {&FreeSans_subset_7pt8b, FreeSans_subset_7pt8bRemap},
+  {&FreeSans_subset_8pt8b, FreeSans_subset_8pt8bRemap},
+  {&FreeSans_subset_9pt8b, FreeSans_subset_9pt8bRemap}
+};
+#endif
@@ -0,0 +1,208 @@
+const uint8_t FreeSans_subset_10pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0x55, 0x3C, 0x00, 0x10, 0x78, 0x20, 0xCC, 0x20, 0x84,
+  0x40, 0x84, 0xC0, 0xCC, 0x80, 0x79, 0x80, 0x01, 0x00, 0x03, 0x3E, 0x02,
+  0x62, 0x04, 0x63, 0x04, 0x63, 0x08, 0x36, 0x18, 0x1C, 0xFF, 0x00, 0x10,
+  0x88, 0x46, 0x21, 0x08, 0xC6, 0x30, 0x84, 0x31, 0x84, 0x30, 0x80, 0x84,
+  0x46, 0x22, 0x33, 0x33, 0x33, 0x32, 0x26, 0x48, 0x08, 0x04, 0x02, 0x01,
+  0x0F, 0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0xF5, 0x80, 0xF8, 0xF0, 0x08,
+  0x20, 0x84, 0x10, 0x43, 0x08, 0x20, 0x84, 0x10, 0x42, 0x08, 0x00, 0x3C,
+  0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x68,
+  0x67, 0x71, 0xE0, 0x08, 0xCF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C,
+  0x3E, 0x3F, 0xB0, 0x78, 0x3C, 0x18, 0x0C, 0x0C, 0x1C, 0x1C, 0x38, 0x18,
+  0x18, 0x0F, 0xFF, 0xFC, 0x3E, 0x3F, 0xB0, 0xD8, 0x20, 0x10, 0x18, 0x78,
+  0x0E, 0x01, 0x80, 0xE0, 0x78, 0x37, 0xF1, 0xF0, 0x06, 0x03, 0x03, 0x83,
+  0xC1, 0x61, 0xB1, 0x99, 0x8C, 0x86, 0x7F, 0xFF, 0xE0, 0xC0, 0x60, 0x30,
+  0x7F, 0x3F, 0x90, 0x08, 0x04, 0x87, 0xFB, 0x8C, 0x03, 0x01, 0x80, 0xF0,
+  0x78, 0x27, 0xF1, 0xF0, 0x1E, 0x3F, 0x98, 0xD8, 0x3C, 0x06, 0xF3, 0xFD,
+  0x83, 0xC1, 0xE0, 0xF0, 0x68, 0x37, 0xF1, 0xF0, 0xFF, 0xFF, 0xC0, 0x40,
+  0x60, 0x20, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x80,
+  0x3E, 0x3F, 0xB0, 0xD8, 0x3C, 0x13, 0xB8, 0xF9, 0xC6, 0xC1, 0xC0, 0xF0,
+  0x78, 0x37, 0xF1, 0xF0, 0x3C, 0x3F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x0E,
+  0xFF, 0x3D, 0x80, 0xC0, 0x58, 0x67, 0xE1, 0xE0, 0xF0, 0x00, 0x3C, 0xC0,
+  0x1E, 0x01, 0xE0, 0x0E, 0x01, 0xC1, 0xC3, 0xC3, 0xC0, 0x80, 0x00, 0x3E,
+  0x3F, 0x98, 0x68, 0x34, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x02, 0x00,
+  0x00, 0x00, 0x40, 0x20, 0x07, 0x00, 0x38, 0x01, 0x60, 0x1B, 0x00, 0xD8,
+  0x04, 0x60, 0x63, 0x03, 0x18, 0x30, 0x61, 0xFF, 0x0F, 0xF8, 0xC0, 0x66,
+  0x03, 0x30, 0x1B, 0x00, 0x60, 0xFF, 0x3F, 0xE8, 0x1A, 0x03, 0x80, 0xE0,
+  0x6F, 0xF3, 0xFE, 0x81, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xEF, 0xF0,
+  0x0F, 0x83, 0xFC, 0x60, 0x66, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00,
+  0xC0, 0x0C, 0x03, 0xC0, 0x36, 0x03, 0x70, 0x63, 0xFC, 0x0F, 0x80, 0xFE,
+  0x1F, 0xF2, 0x07, 0x40, 0x68, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x68, 0x1D, 0xFF, 0x3F, 0x80, 0xFF, 0xBF, 0xE8, 0x02,
+  0x00, 0x80, 0x20, 0x0F, 0xFB, 0xFE, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80,
+  0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x10, 0x08, 0x04, 0x03, 0xFD, 0xFE,
+  0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x0F, 0x81, 0xFF, 0x1C,
+  0x1C, 0xC0, 0x6C, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x3F, 0xC1, 0xFE, 0x00,
+  0xF0, 0x06, 0xC0, 0x77, 0x03, 0x9F, 0xFC, 0x3E, 0x20, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01,
+  0xC0, 0x38, 0x07, 0x00, 0xE0, 0x18, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0xC6, 0xFE,
+  0x7C, 0x80, 0xD0, 0x32, 0x0C, 0x43, 0x88, 0xE1, 0x38, 0x2E, 0x07, 0xE0,
+  0xEE, 0x18, 0xC2, 0x0C, 0x41, 0xC8, 0x19, 0x01, 0xA0, 0x38, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+  0xFF, 0xC0, 0x3F, 0x01, 0xF8, 0x0F, 0x40, 0xFB, 0x07, 0xD8, 0x2E, 0x43,
+  0x73, 0x1B, 0x98, 0x9C, 0x4C, 0xE2, 0x67, 0x1A, 0x38, 0x71, 0xC3, 0x8E,
+  0x18, 0x60, 0xC0, 0x78, 0x0F, 0x81, 0xD8, 0x3B, 0x07, 0x30, 0xE6, 0x1C,
+  0x63, 0x86, 0x70, 0xCE, 0x0D, 0xC0, 0xF8, 0x1F, 0x01, 0xE0, 0x38, 0x0F,
+  0x80, 0xFF, 0x87, 0x03, 0x18, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x2C, 0x01, 0x98, 0x06, 0x70, 0x30, 0xFF, 0x80,
+  0xF8, 0x00, 0xFF, 0x3F, 0xE8, 0x1E, 0x03, 0x80, 0xE0, 0x38, 0x1B, 0xFE,
+  0xFE, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x00, 0x0F, 0x80, 0xFF,
+  0x87, 0x03, 0x18, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x6C, 0x01, 0x98, 0x36, 0x70, 0x70, 0xFF, 0xC0, 0xF9, 0x80,
+  0x02, 0xFF, 0x9F, 0xFA, 0x03, 0x40, 0x28, 0x05, 0x01, 0xA0, 0x37, 0xFC,
+  0xFF, 0x90, 0x1A, 0x03, 0x40, 0x68, 0x0D, 0x01, 0xA0, 0x18, 0x1F, 0x0F,
+  0xF9, 0x83, 0x60, 0x3C, 0x00, 0xC0, 0x1F, 0x00, 0xFC, 0x01, 0xC0, 0x0F,
+  0x01, 0xE0, 0x3E, 0x06, 0xFF, 0x87, 0xC0, 0xFF, 0xFF, 0xFC, 0x30, 0x06,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x6C, 0x0C, 0xFF, 0x0F,
+  0xC0, 0xC0, 0x36, 0x03, 0x60, 0x36, 0x06, 0x30, 0x63, 0x06, 0x10, 0xC1,
+  0x8C, 0x18, 0xC0, 0x98, 0x0D, 0x80, 0xD8, 0x05, 0x00, 0x70, 0x07, 0x00,
+  0xC0, 0xC0, 0xD8, 0x38, 0x36, 0x0E, 0x19, 0x87, 0x86, 0x61, 0xA1, 0x8C,
+  0x4C, 0x63, 0x33, 0x10, 0xCC, 0xCC, 0x33, 0x13, 0x04, 0x86, 0xC1, 0xE1,
+  0xB0, 0x78, 0x68, 0x1E, 0x0E, 0x03, 0x03, 0x80, 0xC0, 0xE0, 0x60, 0x1B,
+  0x01, 0x8C, 0x1C, 0x70, 0xC1, 0x8C, 0x06, 0x60, 0x36, 0x00, 0xF0, 0x07,
+  0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0xFF,
+  0xFF, 0xF0, 0x0C, 0x06, 0x03, 0x01, 0xC0, 0x60, 0x30, 0x18, 0x0E, 0x03,
+  0x01, 0x80, 0xE0, 0x3F, 0xFF, 0xFC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xF0, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0xF0, 0xFF, 0xE0, 0x3E, 0x3F, 0xB0, 0xC0, 0x60, 0x73, 0xFB, 0x0D,
+  0x06, 0x83, 0x77, 0x9E, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x0D, 0xE7, 0xFB,
+  0x87, 0x83, 0xC0, 0xE0, 0x70, 0x38, 0x3E, 0x1F, 0xFB, 0x78, 0x3C, 0x7E,
+  0xC3, 0xC1, 0x80, 0x80, 0x80, 0xC1, 0xC3, 0x7E, 0x3C, 0x01, 0x80, 0xC0,
+  0x60, 0x33, 0xDB, 0xFF, 0x0F, 0x83, 0x81, 0xC0, 0xE0, 0x78, 0x3C, 0x3B,
+  0xFC, 0xFE, 0x3E, 0x3F, 0xB0, 0xD8, 0x38, 0x1F, 0xFE, 0x01, 0x83, 0xC3,
+  0x3F, 0x8F, 0x00, 0x19, 0x88, 0x4F, 0x90, 0x84, 0x21, 0x08, 0x42, 0x10,
+  0x80, 0x3D, 0xBF, 0xF0, 0xF8, 0x38, 0x1C, 0x0E, 0x07, 0x83, 0xC3, 0xBF,
+  0xCF, 0x60, 0x2C, 0x37, 0x38, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xF7,
+  0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xF0, 0xFF, 0xFF,
+  0xFC, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x36, 0x33, 0x31, 0xB0, 0xF8, 0x76,
+  0x33, 0x18, 0xCC, 0x66, 0x1B, 0x06, 0xFF, 0xFF, 0xFF, 0xFC, 0xDE, 0x7B,
+  0xDF, 0x6C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3,
+  0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0xDE, 0xF7, 0xE3, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x3C, 0x3F, 0xB0, 0xD8, 0x38, 0x1C, 0x0E,
+  0x07, 0x83, 0xC3, 0x3F, 0x8F, 0x00, 0xDE, 0x7F, 0xB8, 0x78, 0x3C, 0x0E,
+  0x07, 0x03, 0x83, 0xE1, 0xFF, 0xB7, 0x98, 0x0C, 0x06, 0x03, 0x00, 0x3D,
+  0xBF, 0xF0, 0xF8, 0x38, 0x1C, 0x0E, 0x07, 0x83, 0xC3, 0xBF, 0xCF, 0x60,
+  0x30, 0x18, 0x0C, 0x06, 0xDF, 0xF9, 0x8C, 0x63, 0x18, 0xC6, 0x30, 0x3C,
+  0xFE, 0xC3, 0xC0, 0xE0, 0x7E, 0x07, 0x83, 0xC3, 0xFE, 0x7C, 0x21, 0x09,
+  0xF2, 0x10, 0x84, 0x21, 0x08, 0x43, 0x1C, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC3, 0xC3, 0xE7, 0x7D, 0xC0, 0x90, 0x66, 0x19, 0x84, 0x23,
+  0x0C, 0xC3, 0x20, 0x58, 0x1C, 0x07, 0x00, 0xC0, 0xC3, 0x0D, 0x0C, 0x36,
+  0x78, 0x99, 0xE6, 0x65, 0x98, 0x92, 0x43, 0x4D, 0x0F, 0x3C, 0x3C, 0xF0,
+  0x61, 0x81, 0x86, 0x00, 0x61, 0xB1, 0x8C, 0x82, 0xC1, 0xC0, 0x60, 0x70,
+  0x6C, 0x33, 0x31, 0x90, 0x60, 0xC1, 0xA0, 0xD8, 0x4C, 0x62, 0x31, 0x90,
+  0xD8, 0x28, 0x1C, 0x0E, 0x02, 0x03, 0x01, 0x83, 0x81, 0x80, 0xFF, 0x03,
+  0x06, 0x0C, 0x18, 0x18, 0x30, 0x60, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x7B, 0x38, 0x73, 0x78, 0x39, 0x14, 0x41, 0x19, 0x84, 0x3F };
+
+const GFXglyph FreeSans_subset_10pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   2,  15,   7,    2,  -14 },   // 0x21 '!'
+  {     5,  16,  14,  17,    1,  -13 },   // 0x25 '%'
+  {    33,   2,   5,   4,    1,  -13 },   // 0x27 '''
+  {    35,   5,  18,   7,    1,  -14 },   // 0x28 '('
+  {    47,   4,  18,   7,    1,  -14 },   // 0x29 ')'
+  {    56,   9,   9,  11,    1,   -8 },   // 0x2B '+'
+  {    67,   2,   5,   5,    2,   -1 },   // 0x2C ','
+  {    69,   5,   1,   7,    1,   -5 },   // 0x2D '-'
+  {    70,   2,   2,   5,    2,   -1 },   // 0x2E '.'
+  {    71,   6,  15,   5,    0,  -14 },   // 0x2F '/'
+  {    83,   9,  14,  11,    1,  -13 },   // 0x30 '0'
+  {    99,   5,  14,  11,    2,  -13 },   // 0x31 '1'
+  {   108,   9,  14,  11,    1,  -13 },   // 0x32 '2'
+  {   124,   9,  14,  11,    1,  -13 },   // 0x33 '3'
+  {   140,   9,  14,  11,    1,  -13 },   // 0x34 '4'
+  {   156,   9,  14,  11,    1,  -13 },   // 0x35 '5'
+  {   172,   9,  14,  11,    1,  -13 },   // 0x36 '6'
+  {   188,   9,  14,  11,    1,  -13 },   // 0x37 '7'
+  {   204,   9,  14,  11,    1,  -13 },   // 0x38 '8'
+  {   220,   9,  14,  11,    1,  -13 },   // 0x39 '9'
+  {   236,   2,  11,   5,    2,  -10 },   // 0x3A ':'
+  {   239,  10,   9,  11,    1,   -8 },   // 0x3E '>'
+  {   251,   9,  15,  11,    1,  -14 },   // 0x3F '?'
+  {   268,  13,  15,  13,    0,  -14 },   // 0x41 'A'
+  {   293,  10,  15,  13,    2,  -14 },   // 0x42 'B'
+  {   312,  12,  15,  14,    1,  -14 },   // 0x43 'C'
+  {   335,  11,  15,  14,    2,  -14 },   // 0x44 'D'
+  {   356,  10,  15,  12,    2,  -14 },   // 0x45 'E'
+  {   375,   9,  15,  12,    2,  -14 },   // 0x46 'F'
+  {   392,  13,  15,  15,    1,  -14 },   // 0x47 'G'
+  {   417,  11,  15,  14,    2,  -14 },   // 0x48 'H'
+  {   438,   2,  15,   5,    2,  -14 },   // 0x49 'I'
+  {   442,   8,  15,  10,    1,  -14 },   // 0x4A 'J'
+  {   457,  11,  15,  13,    2,  -14 },   // 0x4B 'K'
+  {   478,   8,  15,  11,    2,  -14 },   // 0x4C 'L'
+  {   493,  13,  15,  17,    2,  -14 },   // 0x4D 'M'
+  {   518,  11,  15,  14,    2,  -14 },   // 0x4E 'N'
+  {   539,  14,  15,  15,    1,  -14 },   // 0x4F 'O'
+  {   566,  10,  15,  13,    2,  -14 },   // 0x50 'P'
+  {   585,  14,  16,  15,    1,  -14 },   // 0x51 'Q'
+  {   613,  11,  15,  14,    2,  -14 },   // 0x52 'R'
+  {   634,  11,  15,  13,    1,  -14 },   // 0x53 'S'
+  {   655,  11,  15,  12,    1,  -14 },   // 0x54 'T'
+  {   676,  11,  15,  14,    2,  -14 },   // 0x55 'U'
+  {   697,  12,  15,  13,    0,  -14 },   // 0x56 'V'
+  {   720,  18,  15,  18,    0,  -14 },   // 0x57 'W'
+  {   754,  13,  15,  13,    0,  -14 },   // 0x59 'Y'
+  {   779,  10,  15,  12,    1,  -14 },   // 0x5A 'Z'
+  {   798,   4,  19,   5,    1,  -14 },   // 0x5B '['
+  {   808,   4,  19,   5,    0,  -14 },   // 0x5D ']'
+  {   818,  11,   1,  11,    0,    3 },   // 0x5F '_'
+  {   820,   9,  11,  11,    1,  -10 },   // 0x61 'a'
+  {   833,   9,  15,  11,    1,  -14 },   // 0x62 'b'
+  {   850,   8,  11,  10,    1,  -10 },   // 0x63 'c'
+  {   861,   9,  15,  11,    1,  -14 },   // 0x64 'd'
+  {   878,   9,  11,  10,    1,  -10 },   // 0x65 'e'
+  {   891,   5,  15,   5,    0,  -14 },   // 0x66 'f'
+  {   901,   9,  15,  11,    1,  -10 },   // 0x67 'g'
+  {   918,   8,  15,  11,    1,  -14 },   // 0x68 'h'
+  {   933,   2,  15,   4,    1,  -14 },   // 0x69 'i'
+  {   937,   9,  15,  10,    1,  -14 },   // 0x6B 'k'
+  {   954,   2,  15,   4,    1,  -14 },   // 0x6C 'l'
+  {   958,  14,  11,  16,    1,  -10 },   // 0x6D 'm'
+  {   978,   8,  11,  11,    1,  -10 },   // 0x6E 'n'
+  {   989,   9,  11,  10,    1,  -10 },   // 0x6F 'o'
+  {  1002,   9,  15,  11,    1,  -10 },   // 0x70 'p'
+  {  1019,   9,  15,  11,    1,  -10 },   // 0x71 'q'
+  {  1036,   5,  11,   7,    1,  -10 },   // 0x72 'r'
+  {  1043,   8,  11,  10,    1,  -10 },   // 0x73 's'
+  {  1054,   5,  14,   5,    0,  -13 },   // 0x74 't'
+  {  1063,   8,  11,  11,    1,  -10 },   // 0x75 'u'
+  {  1074,  10,  11,  10,    0,  -10 },   // 0x76 'v'
+  {  1088,  14,  11,  14,    0,  -10 },   // 0x77 'w'
+  {  1108,   9,  11,   9,    0,  -10 },   // 0x78 'x'
+  {  1121,   9,  15,   9,    0,  -10 },   // 0x79 'y'
+  {  1138,   8,  11,  10,    1,  -10 },   // 0x7A 'z'
+  {  1149,   1,  18,   5,    2,  -14 },   // 0x7C '|'
+  {  1152,   6,   5,  12,    3,  -12 },   // 0xB0 ''
+  {  1156,   6,   8,   7,    0,  -15 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_10pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_10pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_10pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_10pt8bGlyphs,
+  0x20, 0x6F, 24 };
+
+// Approx. 1953 bytes
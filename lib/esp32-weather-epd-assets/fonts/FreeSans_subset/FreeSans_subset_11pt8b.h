@@ -0,0 +1,225 @@
+const uint8_t FreeSans_subset_11pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xF3, 0x00, 0x08, 0x1F, 0x06, 0x0C, 0x61, 0x02, 0x18, 0xC0,
+  0x86, 0x20, 0x31, 0x90, 0x07, 0xCC, 0x00, 0x42, 0x00, 0x01, 0x8F, 0x00,
+  0x47, 0xE0, 0x33, 0x08, 0x08, 0xC2, 0x04, 0x30, 0x83, 0x07, 0xE0, 0x80,
+  0xF0, 0xFF, 0x40, 0x12, 0x26, 0x4C, 0xCC, 0x88, 0x88, 0x8C, 0xC4, 0x46,
+  0x21, 0x82, 0x18, 0x42, 0x18, 0xC2, 0x10, 0x86, 0x21, 0x18, 0xC6, 0x23,
+  0x11, 0x80, 0x04, 0x00, 0x80, 0x10, 0x02, 0x0F, 0xFF, 0xFF, 0xC1, 0x00,
+  0x20, 0x04, 0x00, 0x80, 0xF5, 0x80, 0xFF, 0xC0, 0xF0, 0x04, 0x30, 0x82,
+  0x18, 0x41, 0x04, 0x20, 0x82, 0x10, 0x41, 0x08, 0x20, 0x1E, 0x0F, 0xC6,
+  0x1B, 0x06, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x06,
+  0x61, 0x8F, 0xC1, 0xE0, 0x08, 0x47, 0xF0, 0x84, 0x21, 0x08, 0x42, 0x10,
+  0x84, 0x20, 0x1F, 0x1F, 0xE6, 0x1F, 0x03, 0xC0, 0xC0, 0x30, 0x18, 0x0E,
+  0x0E, 0x0F, 0x07, 0x01, 0x80, 0xC0, 0x3F, 0xFF, 0xFC, 0x3E, 0x1F, 0xEE,
+  0x1B, 0x06, 0xC1, 0x80, 0x60, 0xF0, 0x3C, 0x01, 0x80, 0x3C, 0x0F, 0x03,
+  0xC1, 0x9F, 0xE3, 0xE0, 0x03, 0x01, 0xC0, 0x70, 0x3C, 0x1B, 0x04, 0xC3,
+  0x31, 0x8C, 0xC3, 0x30, 0xCF, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x30, 0x7F,
+  0x9F, 0xE6, 0x01, 0x80, 0x40, 0x17, 0x8F, 0xFB, 0x07, 0x00, 0xC0, 0x30,
+  0x0F, 0x03, 0xC1, 0x9F, 0xE3, 0xE0, 0x1F, 0x0F, 0xE6, 0x19, 0x83, 0xC0,
+  0x33, 0x8F, 0xFB, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1,
+  0xE0, 0xFF, 0xFF, 0xF0, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x10, 0x0C,
+  0x03, 0x01, 0x80, 0x60, 0x18, 0x0C, 0x03, 0x00, 0x1E, 0x1F, 0xE6, 0x1B,
+  0x02, 0xC1, 0x98, 0x63, 0xF1, 0xFE, 0xE1, 0xF0, 0x3C, 0x0F, 0x03, 0xE1,
+  0xDF, 0xE3, 0xE0, 0x1E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x87, 0x7F, 0xC7, 0x30, 0x0F, 0x06, 0xE1, 0x9F, 0xC3, 0xE0, 0xF0, 0x00,
+  0x0F, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x0E, 0x03, 0xC1, 0xC1, 0xE0,
+  0xF0, 0x10, 0x00, 0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x06, 0x03, 0x00, 0x00, 0x00, 0x60, 0x30, 0x03, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xB0, 0x0C, 0xC0, 0x33, 0x00, 0xC6, 0x06, 0x18, 0x18,
+  0x60, 0x7F, 0xC3, 0xFF, 0x0C, 0x0C, 0x30, 0x19, 0x80, 0x66, 0x01, 0xB8,
+  0x03, 0xFF, 0x9F, 0xFB, 0x03, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x37, 0xFC,
+  0xFF, 0xD8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xF7, 0xFC, 0x0F,
+  0xC1, 0xFF, 0x0C, 0x0C, 0xC0, 0x7E, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x00,
+  0xC0, 0x06, 0x00, 0x30, 0x07, 0xC0, 0x36, 0x03, 0xB8, 0x18, 0xFF, 0x81,
+  0xF8, 0xFF, 0x0F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0E, 0xFF, 0xCF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFE,
+  0xFF, 0xD8, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE, 0xFF, 0xB0, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x0F, 0xC0, 0x7F, 0xC3, 0x83,
+  0x98, 0x07, 0xE0, 0x0F, 0x00, 0x0C, 0x00, 0x30, 0x3F, 0xC0, 0xFF, 0x00,
+  0x3C, 0x00, 0xD8, 0x03, 0x60, 0x1C, 0xE0, 0xF1, 0xFF, 0x43, 0xF1, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0xFF,
+  0xFC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xC0, 0x78, 0x3C, 0x36, 0x19, 0xFC, 0x78, 0xC0, 0x7C, 0x0E,
+  0xC1, 0xCC, 0x38, 0xC7, 0x0C, 0xE0, 0xDC, 0x0F, 0xC0, 0xF6, 0x0E, 0x70,
+  0xC3, 0x0C, 0x18, 0xC1, 0xCC, 0x0C, 0xC0, 0x6C, 0x07, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0xBF, 0x03,
+  0x7A, 0x06, 0xF6, 0x09, 0xEC, 0x33, 0xC8, 0x67, 0x98, 0x8F, 0x33, 0x1E,
+  0x26, 0x3C, 0x68, 0x78, 0xF0, 0xF0, 0xE1, 0xE1, 0x83, 0xC0, 0x3E, 0x03,
+  0xE0, 0x3F, 0x03, 0xD8, 0x3D, 0x83, 0xCC, 0x3C, 0xE3, 0xC6, 0x3C, 0x33,
+  0xC3, 0x3C, 0x1B, 0xC0, 0xFC, 0x0F, 0xC0, 0x7C, 0x07, 0x07, 0xC0, 0x3F,
+  0xE0, 0xE0, 0xE3, 0x00, 0xE6, 0x00, 0xD8, 0x00, 0xF0, 0x01, 0xE0, 0x03,
+  0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1B, 0x00, 0x66, 0x00, 0xC7, 0x07, 0x07,
+  0xFC, 0x03, 0xE0, 0xFF, 0x9F, 0xFB, 0x03, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x3F, 0xFE, 0xFF, 0x98, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xE0, 0xE3, 0x00, 0xE6, 0x00, 0xD8, 0x00,
+  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1B, 0x02, 0x66,
+  0x06, 0xC7, 0x07, 0x07, 0xFF, 0x03, 0xE7, 0x00, 0x04, 0xFF, 0xCF, 0xFE,
+  0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6F, 0xFC, 0xFF, 0xCC, 0x06,
+  0xC0, 0x6C, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0x3C, 0x03, 0x1F, 0x83, 0xFE,
+  0x60, 0x66, 0x03, 0xE0, 0x36, 0x00, 0x78, 0x03, 0xF8, 0x07, 0xE0, 0x07,
+  0x00, 0x3C, 0x03, 0xC0, 0x36, 0x07, 0x3F, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x7E, 0x0E, 0x7F, 0xC1, 0xF8, 0xE0, 0x19, 0x80,
+  0x66, 0x01, 0x8C, 0x0C, 0x30, 0x30, 0xC0, 0xC1, 0x86, 0x06, 0x18, 0x18,
+  0x60, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00,
+  0xC0, 0xE0, 0x60, 0x76, 0x07, 0x06, 0x60, 0xF0, 0x66, 0x0F, 0x06, 0x70,
+  0xF0, 0x63, 0x09, 0x8C, 0x31, 0x98, 0xC3, 0x19, 0x8C, 0x31, 0x88, 0xC1,
+  0xB0, 0xC8, 0x1B, 0x0D, 0x81, 0xB0, 0xD8, 0x1A, 0x07, 0x80, 0xE0, 0x70,
+  0x0E, 0x07, 0x00, 0xE0, 0x30, 0x60, 0x0D, 0xC0, 0x63, 0x03, 0x8E, 0x0C,
+  0x18, 0x70, 0x31, 0x80, 0xEC, 0x01, 0xB0, 0x03, 0x80, 0x0E, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+  0x00, 0x60, 0x0C, 0x01, 0xC0, 0x38, 0x03, 0x00, 0x60, 0x0C, 0x01, 0xC0,
+  0x38, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xF0, 0xFF, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, 0xF0, 0xFF, 0xF0, 0x3E, 0x1F, 0xCC,
+  0x1B, 0x06, 0x01, 0x8F, 0xEF, 0x9B, 0x06, 0xC1, 0xB0, 0xEF, 0xFD, 0xF3,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDF, 0x3F, 0xEE, 0x1F, 0x83, 0xC0, 0xF0,
+  0x3C, 0x07, 0x03, 0xE0, 0xF8, 0x7F, 0xFB, 0x7C, 0x3E, 0x3F, 0xB8, 0x78,
+  0x3C, 0x06, 0x03, 0x01, 0x80, 0xC1, 0xF0, 0xDF, 0xC7, 0xC0, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x3E, 0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC1, 0xF8, 0x77, 0xFC, 0xFB, 0x00, 0x00, 0x1E, 0x1F, 0xCE, 0x1B,
+  0x02, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0x1C,
+  0xF3, 0x0C, 0xFC, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3C,
+  0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF8, 0x77,
+  0xEC, 0xF2, 0x00, 0xB0, 0x67, 0xF0, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0xF7, 0xFF, 0x87, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0xB1,
+  0xCC, 0x63, 0x30, 0xD8, 0x3F, 0x0E, 0xE3, 0x18, 0xC3, 0x30, 0xCC, 0x1B,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x3D, 0xFE, 0xFF, 0x86, 0x1E, 0x0C,
+  0x3C, 0x18, 0x78, 0x30, 0xF0, 0x61, 0xE0, 0xC3, 0xC1, 0x87, 0x83, 0x0F,
+  0x06, 0x1E, 0x0C, 0x30, 0xDF, 0x7F, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x30, 0x3E, 0x1F, 0xCE, 0x1B, 0x02, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x67, 0xF0, 0xF8, 0xDF, 0x3F, 0xEE,
+  0x1F, 0x83, 0xC0, 0xF0, 0x3C, 0x07, 0x03, 0xE0, 0xF8, 0x7F, 0xFB, 0x7C,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0x3E, 0xDF, 0xFE, 0x1F, 0x07, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC1, 0xF8, 0x77, 0xFC, 0xFB, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0xCF, 0x7E, 0x38, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x3E, 0x3F,
+  0xB0, 0xD8, 0x0E, 0x03, 0xE0, 0x7C, 0x07, 0xC1, 0xE0, 0xFF, 0xC7, 0xC0,
+  0x30, 0xC3, 0x3F, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xF3, 0xC0,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xDF,
+  0xE7, 0xD0, 0x00, 0xC0, 0xD8, 0x36, 0x0D, 0x86, 0x31, 0x8C, 0x43, 0x30,
+  0x6C, 0x1A, 0x07, 0x80, 0xE0, 0x30, 0xC1, 0x86, 0xC7, 0x0D, 0x8E, 0x1B,
+  0x16, 0x66, 0x2C, 0xC6, 0xD9, 0x8D, 0x93, 0x1B, 0x34, 0x14, 0x78, 0x38,
+  0xF0, 0x70, 0xC0, 0xE1, 0x80, 0x60, 0xD8, 0x63, 0x30, 0x6C, 0x1E, 0x03,
+  0x00, 0xE0, 0x78, 0x33, 0x0C, 0xC6, 0x19, 0x83, 0xC0, 0xD8, 0x36, 0x19,
+  0x86, 0x31, 0x8C, 0xC3, 0x30, 0x48, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C,
+  0x06, 0x01, 0x81, 0xE0, 0x60, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xE0, 0x60, 0x60, 0x60, 0x70, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x38,
+  0xDB, 0x1C, 0x1C, 0x6D, 0x8E, 0x00, 0x3C, 0x8D, 0x08, 0x31, 0xC6, 0x10,
+  0x7F };
+
+const GFXglyph FreeSans_subset_11pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0 },   // 0x20 ' '
+  {     1,   1,  16,   7,    3,  -15 },   // 0x21 '!'
+  {     3,  18,  15,  19,    1,  -14 },   // 0x25 '%'
+  {    37,   2,   5,   4,    1,  -14 },   // 0x27 '''
+  {    39,   4,  20,   7,    2,  -15 },   // 0x28 '('
+  {    49,   5,  20,   7,    1,  -15 },   // 0x29 ')'
+  {    62,  11,  10,  13,    1,   -9 },   // 0x2B '+'
+  {    76,   2,   5,   6,    2,   -1 },   // 0x2C ','
+  {    78,   5,   2,   7,    1,   -6 },   // 0x2D '-'
+  {    80,   2,   2,   5,    2,   -1 },   // 0x2E '.'
+  {    81,   6,  16,   6,    0,  -15 },   // 0x2F '/'
+  {    93,  10,  15,  12,    1,  -14 },   // 0x30 '0'
+  {   112,   5,  15,  12,    2,  -14 },   // 0x31 '1'
+  {   122,  10,  15,  12,    1,  -14 },   // 0x32 '2'
+  {   141,  10,  15,  12,    1,  -14 },   // 0x33 '3'
+  {   160,  10,  15,  12,    1,  -14 },   // 0x34 '4'
+  {   179,  10,  15,  12,    1,  -14 },   // 0x35 '5'
+  {   198,  10,  15,  12,    1,  -14 },   // 0x36 '6'
+  {   217,  10,  15,  12,    1,  -14 },   // 0x37 '7'
+  {   236,  10,  15,  12,    1,  -14 },   // 0x38 '8'
+  {   255,  10,  15,  12,    1,  -14 },   // 0x39 '9'
+  {   274,   2,  12,   5,    2,  -11 },   // 0x3A ':'
+  {   277,  11,  10,  13,    1,   -9 },   // 0x3E '>'
+  {   291,   9,  16,  12,    2,  -15 },   // 0x3F '?'
+  {   309,  14,  16,  14,    0,  -15 },   // 0x41 'A'
+  {   337,  11,  16,  14,    2,  -15 },   // 0x42 'B'
+  {   359,  13,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   385,  12,  16,  15,    2,  -15 },   // 0x44 'D'
+  {   409,  11,  16,  14,    2,  -15 },   // 0x45 'E'
+  {   431,  10,  16,  13,    2,  -15 },   // 0x46 'F'
+  {   451,  14,  16,  16,    1,  -15 },   // 0x47 'G'
+  {   479,  12,  16,  16,    2,  -15 },   // 0x48 'H'
+  {   503,   2,  16,   6,    2,  -15 },   // 0x49 'I'
+  {   507,   9,  16,  11,    1,  -15 },   // 0x4A 'J'
+  {   525,  12,  16,  15,    2,  -15 },   // 0x4B 'K'
+  {   549,   9,  16,  12,    2,  -15 },   // 0x4C 'L'
+  {   567,  15,  16,  18,    2,  -15 },   // 0x4D 'M'
+  {   597,  12,  16,  16,    2,  -15 },   // 0x4E 'N'
+  {   621,  15,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {   651,  11,  16,  14,    2,  -15 },   // 0x50 'P'
+  {   673,  15,  17,  17,    1,  -15 },   // 0x51 'Q'
+  {   705,  12,  16,  15,    2,  -15 },   // 0x52 'R'
+  {   729,  12,  16,  14,    1,  -15 },   // 0x53 'S'
+  {   753,  12,  16,  14,    1,  -15 },   // 0x54 'T'
+  {   777,  12,  16,  16,    2,  -15 },   // 0x55 'U'
+  {   801,  14,  16,  14,    0,  -15 },   // 0x56 'V'
+  {   829,  20,  16,  20,    0,  -15 },   // 0x57 'W'
+  {   869,  14,  16,  15,    0,  -15 },   // 0x59 'Y'
+  {   897,  12,  16,  13,    1,  -15 },   // 0x5A 'Z'
+  {   921,   4,  21,   6,    1,  -15 },   // 0x5B '['
+  {   932,   4,  21,   6,    0,  -15 },   // 0x5D ']'
+  {   943,  12,   1,  12,    0,    4 },   // 0x5F '_'
+  {   945,  10,  12,  12,    1,  -11 },   // 0x61 'a'
+  {   960,  10,  16,  12,    1,  -15 },   // 0x62 'b'
+  {   980,   9,  12,  11,    1,  -11 },   // 0x63 'c'
+  {   994,  10,  17,  12,    1,  -15 },   // 0x64 'd'
+  {  1016,  10,  12,  11,    1,  -11 },   // 0x65 'e'
+  {  1031,   6,  16,   6,    0,  -15 },   // 0x66 'f'
+  {  1043,  10,  16,  12,    1,  -11 },   // 0x67 'g'
+  {  1063,   9,  16,  12,    1,  -15 },   // 0x68 'h'
+  {  1081,   2,  16,   5,    1,  -15 },   // 0x69 'i'
+  {  1085,  10,  16,  11,    1,  -15 },   // 0x6B 'k'
+  {  1105,   2,  16,   5,    1,  -15 },   // 0x6C 'l'
+  {  1109,  15,  12,  18,    1,  -11 },   // 0x6D 'm'
+  {  1132,   9,  12,  12,    1,  -11 },   // 0x6E 'n'
+  {  1146,  10,  12,  12,    1,  -11 },   // 0x6F 'o'
+  {  1161,  10,  16,  12,    1,  -11 },   // 0x70 'p'
+  {  1181,  10,  16,  12,    1,  -11 },   // 0x71 'q'
+  {  1201,   6,  12,   7,    1,  -11 },   // 0x72 'r'
+  {  1210,   9,  12,  11,    1,  -11 },   // 0x73 's'
+  {  1224,   6,  15,   6,    0,  -14 },   // 0x74 't'
+  {  1236,   9,  13,  12,    1,  -11 },   // 0x75 'u'
+  {  1251,  10,  12,  11,    0,  -11 },   // 0x76 'v'
+  {  1266,  15,  12,  16,    0,  -11 },   // 0x77 'w'
+  {  1289,  10,  12,  10,    0,  -11 },   // 0x78 'x'
+  {  1304,  10,  17,  10,    0,  -11 },   // 0x79 'y'
+  {  1326,   9,  12,  10,    1,  -11 },   // 0x7A 'z'
+  {  1340,   1,  20,   5,    2,  -15 },   // 0x7C '|'
+  {  1343,   7,   7,  13,    3,  -14 },   // 0xB0 ''
+  {  1350,   7,   8,   8,    0,  -16 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_11pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_11pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_11pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_11pt8bGlyphs,
+  0x20, 0x6F, 26 };
+
+// Approx. 2148 bytes
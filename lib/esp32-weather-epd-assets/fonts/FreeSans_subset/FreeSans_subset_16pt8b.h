@@ -0,0 +1,355 @@
+const uint8_t FreeSans_subset_16pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xB6, 0xC8, 0x0F, 0xF8, 0x00, 0x00,
+  0x30, 0x07, 0xC0, 0x18, 0x07, 0xF8, 0x06, 0x01, 0x87, 0x03, 0x00, 0xC0,
+  0xC0, 0xC0, 0x30, 0x38, 0x60, 0x0C, 0x0E, 0x30, 0x03, 0x83, 0x0C, 0x00,
+  0x71, 0xC6, 0x00, 0x0F, 0xE1, 0x80, 0x01, 0xE0, 0xC0, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x18, 0x3E, 0x00, 0x0E, 0x1F, 0xC0, 0x03, 0x0E, 0x38, 0x01,
+  0x87, 0x07, 0x00, 0x61, 0x80, 0xC0, 0x30, 0x60, 0x30, 0x0C, 0x1C, 0x1C,
+  0x06, 0x03, 0x8E, 0x01, 0x80, 0x7F, 0x00, 0xC0, 0x0F, 0x80, 0xFF, 0xFD,
+  0xB6, 0x06, 0x18, 0x30, 0xC1, 0x86, 0x0C, 0x38, 0x70, 0xC1, 0x83, 0x0E,
+  0x1C, 0x38, 0x70, 0xE1, 0xC1, 0x83, 0x06, 0x0E, 0x0C, 0x18, 0x38, 0x30,
+  0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC1, 0x83, 0x83, 0x06, 0x0E, 0x0C, 0x18,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x60, 0xC1, 0x87, 0x0C,
+  0x18, 0x60, 0xC3, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18,
+  0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x06, 0x00,
+  0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xFF, 0xB6,
+  0xD6, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x80, 0x80, 0xC0, 0x60, 0x20, 0x30,
+  0x18, 0x08, 0x0C, 0x06, 0x02, 0x03, 0x01, 0x80, 0xC0, 0xC0, 0x60, 0x30,
+  0x10, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xFB,
+  0xE1, 0xC1, 0xC7, 0x01, 0xCE, 0x03, 0x9C, 0x03, 0x30, 0x07, 0xE0, 0x0F,
+  0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xD8, 0x03, 0xB8,
+  0x06, 0x70, 0x1C, 0xE0, 0x38, 0xE0, 0xE1, 0xE3, 0xC1, 0xFF, 0x00, 0xF8,
+  0x00, 0x03, 0x07, 0x07, 0x1F, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0xE0, 0x3F, 0xF0, 0xFB, 0xF3, 0xC0, 0xE7, 0x00, 0xEE, 0x01, 0xD8, 0x03,
+  0xB0, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xF0, 0x07, 0xC0, 0x3E, 0x00,
+  0xF8, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x80, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x3F, 0xE0, 0xFB, 0xE3, 0x81,
+  0xE7, 0x01, 0xCC, 0x03, 0xB8, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x07, 0xE0,
+  0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xF0, 0x07, 0xE0,
+  0x0F, 0xC0, 0x39, 0xC0, 0x73, 0xF7, 0xC3, 0xFF, 0x01, 0xFC, 0x00, 0x00,
+  0x30, 0x00, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x7E, 0x01, 0xDC,
+  0x07, 0x38, 0x0C, 0x70, 0x38, 0xE0, 0xE1, 0xC3, 0x83, 0x86, 0x07, 0x1C,
+  0x0E, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0x80, 0x07, 0x00, 0x0E, 0x00, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 0xF1, 0xC0,
+  0x03, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x3B, 0xF0, 0x7F, 0xF0, 0xFD, 0xF9,
+  0xC0, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0xE0,
+  0x0F, 0xC0, 0x39, 0xC0, 0x71, 0xF7, 0xC3, 0xFF, 0x01, 0xF8, 0x00, 0x03,
+  0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xC0, 0xE3, 0x81, 0xCE, 0x01, 0xDC, 0x00,
+  0x30, 0x00, 0x63, 0xE1, 0xDF, 0xF3, 0xFF, 0xF7, 0xC0, 0xEF, 0x00, 0xFC,
+  0x01, 0xF8, 0x03, 0xB0, 0x07, 0x70, 0x0E, 0xE0, 0x1C, 0xE0, 0x71, 0xFF,
+  0xC1, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x60, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x60, 0x01, 0xC0,
+  0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x07,
+  0xC0, 0x3F, 0xE0, 0xFB, 0xE3, 0xC0, 0xE7, 0x01, 0xCE, 0x03, 0x9C, 0x07,
+  0x38, 0x0E, 0x38, 0x38, 0x3F, 0xE0, 0x7F, 0xC1, 0xF3, 0xC7, 0x01, 0xDC,
+  0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1D, 0xC0, 0x71, 0xF7,
+  0xE1, 0xFF, 0x80, 0xFC, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xFB, 0xE3, 0x81,
+  0xE7, 0x01, 0xDC, 0x01, 0xB8, 0x03, 0xF0, 0x07, 0xE0, 0x0E, 0xE0, 0x3D,
+  0xC0, 0xF9, 0xF7, 0xF1, 0xFE, 0xE1, 0xF9, 0xC0, 0x03, 0x80, 0x06, 0x60,
+  0x1C, 0xE0, 0x39, 0xC0, 0xE1, 0xF7, 0x81, 0xFE, 0x01, 0xF8, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x80, 0x01, 0xC0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0x00,
+  0x7E, 0x03, 0xF0, 0x1F, 0x01, 0xF8, 0x0F, 0xC0, 0x1C, 0x00, 0x20, 0x00,
+  0x00, 0x0F, 0xC0, 0xFF, 0xC3, 0xFF, 0x9C, 0x0E, 0x60, 0x1D, 0x80, 0x7E,
+  0x01, 0xC0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+  0x0E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00,
+  0xF8, 0x00, 0x1D, 0xC0, 0x01, 0xDC, 0x00, 0x1D, 0xC0, 0x03, 0x8E, 0x00,
+  0x38, 0xE0, 0x03, 0x8E, 0x00, 0x70, 0x70, 0x07, 0x07, 0x00, 0x60, 0x70,
+  0x0E, 0x03, 0x80, 0xE0, 0x38, 0x1F, 0xFF, 0x81, 0xFF, 0xFC, 0x1C, 0x01,
+  0xC3, 0x80, 0x1C, 0x38, 0x00, 0xE3, 0x80, 0x0E, 0x70, 0x00, 0xF7, 0x00,
+  0x07, 0x70, 0x00, 0x70, 0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0x80,
+  0x3C, 0xE0, 0x07, 0x38, 0x00, 0xEE, 0x00, 0x33, 0x80, 0x1C, 0xE0, 0x07,
+  0x38, 0x03, 0x8F, 0xFF, 0xC3, 0xFF, 0xF8, 0xFF, 0xFF, 0x38, 0x01, 0xEE,
+  0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x01, 0xF8, 0x00, 0x6E, 0x00, 0x3B, 0x80,
+  0x1E, 0xFF, 0xFF, 0x3F, 0xFF, 0x8F, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x7F,
+  0xF0, 0x0F, 0xFF, 0x81, 0xE0, 0x3C, 0x3C, 0x01, 0xE3, 0x80, 0x0E, 0x70,
+  0x00, 0xE7, 0x00, 0x00, 0x60, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E,
+  0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0x77, 0x00, 0x07,
+  0x70, 0x00, 0xF7, 0x80, 0x0E, 0x3C, 0x01, 0xE1, 0xE0, 0x3C, 0x0F, 0xFF,
+  0x80, 0x7F, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xFF,
+  0xFC, 0x70, 0x07, 0x8E, 0x00, 0x39, 0xC0, 0x07, 0xB8, 0x00, 0x77, 0x00,
+  0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00,
+  0x0F, 0xC0, 0x01, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00,
+  0x7B, 0x80, 0x0E, 0x70, 0x07, 0x8F, 0xFF, 0xF1, 0xFF, 0xF8, 0x3F, 0xFE,
+  0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xBF, 0xFF, 0xDC, 0x00, 0x0E, 0x00, 0x07,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x3F, 0xFF,
+  0xDF, 0xFF, 0xEF, 0xFF, 0xF7, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFC,
+  0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x3C, 0x03, 0xC3, 0xC0,
+  0x0F, 0x1C, 0x00, 0x39, 0xC0, 0x00, 0xEE, 0x00, 0x00, 0x60, 0x00, 0x07,
+  0x00, 0x00, 0x38, 0x03, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x00,
+  0x0D, 0xC0, 0x00, 0xEE, 0x00, 0x07, 0x70, 0x00, 0x39, 0xC0, 0x03, 0xCF,
+  0x00, 0x3E, 0x3C, 0x03, 0xF0, 0xFF, 0xFD, 0x83, 0xFF, 0xCC, 0x07, 0xF8,
+  0x60, 0x00, 0x00, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x00,
+  0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+  0x03, 0x80, 0x1C, 0x00, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0E, 0xE0,
+  0xE7, 0xDF, 0x1F, 0xF0, 0x7E, 0x00, 0xE0, 0x03, 0xDC, 0x00, 0xF3, 0x80,
+  0x3C, 0x70, 0x0F, 0x0E, 0x03, 0xC1, 0xC0, 0xF0, 0x38, 0x3C, 0x07, 0x0F,
+  0x00, 0xE3, 0xC0, 0x1C, 0x70, 0x03, 0xBF, 0x00, 0x77, 0xF0, 0x0F, 0xCE,
+  0x01, 0xF0, 0xE0, 0x3C, 0x1E, 0x07, 0x01, 0xC0, 0xE0, 0x1C, 0x1C, 0x03,
+  0xC3, 0x80, 0x3C, 0x70, 0x03, 0x8E, 0x00, 0x79, 0xC0, 0x07, 0xB8, 0x00,
+  0x70, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
+  0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x3F,
+  0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xB0,
+  0x03, 0xFE, 0xE0, 0x0D, 0xFB, 0x80, 0x77, 0xE6, 0x01, 0xDF, 0x9C, 0x06,
+  0x7E, 0x30, 0x39, 0xF8, 0xC0, 0xE7, 0xE3, 0x83, 0x1F, 0x86, 0x1C, 0x7E,
+  0x18, 0x71, 0xF8, 0x71, 0x87, 0xE0, 0xCE, 0x1F, 0x83, 0x38, 0x7E, 0x0E,
+  0xC1, 0xF8, 0x1F, 0x07, 0xE0, 0x7C, 0x1F, 0x81, 0xE0, 0x7E, 0x03, 0x81,
+  0xC0, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00,
+  0xFB, 0x80, 0x3E, 0x70, 0x0F, 0x9C, 0x03, 0xE3, 0x80, 0xF8, 0xF0, 0x3E,
+  0x1C, 0x0F, 0x83, 0x83, 0xE0, 0xF0, 0xF8, 0x1C, 0x3E, 0x03, 0x8F, 0x80,
+  0xF3, 0xE0, 0x1C, 0xF8, 0x03, 0xBE, 0x00, 0xEF, 0x80, 0x1F, 0xE0, 0x07,
+  0xF8, 0x00, 0xFE, 0x00, 0x1C, 0x00, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF,
+  0xFC, 0x07, 0x80, 0x7C, 0x3C, 0x00, 0x70, 0xE0, 0x00, 0xE7, 0x00, 0x03,
+  0x9C, 0x00, 0x07, 0x70, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8,
+  0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x77, 0x00, 0x01, 0xDC, 0x00,
+  0x07, 0x70, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0xC0, 0x07, 0x07, 0x80, 0x7C,
+  0x0F, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xF8, 0x7F,
+  0xFF, 0x3F, 0xFF, 0xDC, 0x00, 0xEE, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x07, 0xE0, 0x07, 0xF0, 0x03, 0xBF, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF,
+  0x87, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0xFE,
+  0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFE, 0x07, 0x80, 0x7C, 0x3C, 0x00, 0x70,
+  0xE0, 0x01, 0xE7, 0x00, 0x03, 0x9C, 0x00, 0x07, 0x70, 0x00, 0x1F, 0x80,
+  0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00,
+  0x77, 0x00, 0x01, 0xDC, 0x00, 0x07, 0x70, 0x02, 0x38, 0xE0, 0x1C, 0xE3,
+  0xC0, 0x3F, 0x07, 0x80, 0x78, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F,
+  0xE1, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x70,
+  0x01, 0xEE, 0x00, 0x1D, 0xC0, 0x03, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0xE0,
+  0x01, 0xDC, 0x00, 0x73, 0xFF, 0xFC, 0x7F, 0xFF, 0x0F, 0xFF, 0xF1, 0xC0,
+  0x0F, 0x38, 0x00, 0xE7, 0x00, 0x1C, 0xE0, 0x01, 0xDC, 0x00, 0x3B, 0x80,
+  0x06, 0x70, 0x00, 0xEE, 0x00, 0x1D, 0xC0, 0x03, 0xB8, 0x00, 0x78, 0x03,
+  0xF8, 0x03, 0xFF, 0x81, 0xFB, 0xF0, 0xE0, 0x1E, 0x78, 0x03, 0x9C, 0x00,
+  0x77, 0x00, 0x1D, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x00, 0x7F, 0x80, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0x60,
+  0x00, 0xDC, 0x00, 0x77, 0x00, 0x1C, 0xE0, 0x0F, 0x3F, 0xFF, 0x83, 0xFF,
+  0xC0, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C,
+  0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0xE0, 0x01, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
+  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01,
+  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0x60, 0x01, 0xDC, 0x00, 0x77,
+  0x00, 0x38, 0xE0, 0x1E, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x3F, 0x80, 0x70,
+  0x00, 0xF7, 0x00, 0x0E, 0x70, 0x00, 0xE3, 0x80, 0x1E, 0x38, 0x01, 0xC3,
+  0xC0, 0x1C, 0x1C, 0x01, 0x81, 0xC0, 0x38, 0x1E, 0x03, 0x80, 0xE0, 0x30,
+  0x0E, 0x07, 0x00, 0x70, 0x70, 0x07, 0x06, 0x00, 0x70, 0xE0, 0x03, 0x8E,
+  0x00, 0x38, 0xC0, 0x03, 0x9C, 0x00, 0x1D, 0xC0, 0x01, 0xD8, 0x00, 0x1F,
+  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x70, 0x07, 0x00,
+  0x7B, 0x80, 0x3C, 0x03, 0xDC, 0x03, 0xE0, 0x1C, 0xF0, 0x1F, 0x00, 0xE3,
+  0x80, 0xF8, 0x07, 0x1C, 0x06, 0xE0, 0x70, 0xE0, 0x77, 0x03, 0x87, 0x03,
+  0x98, 0x1C, 0x1C, 0x18, 0xE0, 0xE0, 0xE0, 0xC7, 0x0E, 0x07, 0x0E, 0x38,
+  0x70, 0x38, 0x70, 0xC3, 0x80, 0xE3, 0x07, 0x1C, 0x07, 0x38, 0x38, 0xC0,
+  0x39, 0xC0, 0xCE, 0x01, 0xCE, 0x07, 0x70, 0x07, 0x60, 0x3B, 0x80, 0x3F,
+  0x01, 0xD8, 0x01, 0xF8, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x3C, 0x01,
+  0xF0, 0x01, 0xE0, 0x0F, 0x00, 0x0F, 0x00, 0x38, 0x00, 0x70, 0x00, 0x73,
+  0xC0, 0x07, 0x8F, 0x00, 0x38, 0x38, 0x03, 0xC1, 0xE0, 0x1C, 0x07, 0x01,
+  0xC0, 0x1C, 0x1E, 0x00, 0xF0, 0xE0, 0x03, 0x8F, 0x00, 0x1E, 0x70, 0x00,
+  0x77, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x38, 0x00, 0x01, 0xC0,
+  0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00,
+  0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x7F, 0xFF,
+  0xBF, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x3C, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+  0x1E, 0x00, 0x0E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+  0xFE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3,
+  0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xFF, 0xF0, 0xFF, 0xF1,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x81, 0xC6, 0x01, 0x80,
+  0x03, 0x00, 0x0E, 0x03, 0xFC, 0x3F, 0xF8, 0xF8, 0x33, 0x80, 0x67, 0x00,
+  0xCE, 0x03, 0x9C, 0x07, 0x3C, 0x7F, 0x3F, 0xEF, 0x1F, 0x0E, 0xC0, 0x01,
+  0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x31, 0xF0, 0x6F,
+  0xF8, 0xDF, 0xF9, 0xE0, 0x73, 0x80, 0x77, 0x00, 0xEE, 0x00, 0xDC, 0x01,
+  0xF0, 0x03, 0xF0, 0x06, 0xE0, 0x0D, 0xC0, 0x3B, 0x80, 0x77, 0x81, 0xCF,
+  0xFF, 0x9B, 0xFE, 0x31, 0xF0, 0x00, 0x07, 0xC0, 0x7F, 0xC3, 0xEF, 0x9C,
+  0x0E, 0x70, 0x1F, 0x80, 0x7E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E,
+  0x00, 0x38, 0x07, 0x70, 0x1D, 0xC0, 0xE3, 0xEF, 0x87, 0xFC, 0x07, 0xC0,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC3,
+  0xF3, 0x8F, 0xF7, 0x3E, 0xFE, 0xF0, 0x7D, 0xC0, 0x7F, 0x00, 0x7E, 0x00,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1D, 0xC0, 0x7B,
+  0xC1, 0xF3, 0xEF, 0xE3, 0xFF, 0xC3, 0xFB, 0x80, 0x00, 0x07, 0xC0, 0x3F,
+  0xE0, 0xFB, 0xE3, 0x81, 0xE7, 0x01, 0xDC, 0x01, 0xB8, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x67, 0x01, 0xCE, 0x07, 0x8F,
+  0xBE, 0x0F, 0xF8, 0x07, 0xC0, 0x1E, 0x7C, 0xE1, 0x83, 0x06, 0x3F, 0xFF,
+  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
+  0x0C, 0x00, 0x0F, 0x8C, 0x7F, 0xB3, 0xEF, 0xDC, 0x0F, 0x70, 0x1F, 0x80,
+  0x7E, 0x01, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x01, 0xF8, 0x07, 0x70,
+  0x1D, 0xC0, 0xF3, 0xEE, 0xC7, 0xF3, 0x0F, 0x8C, 0x00, 0x7E, 0x01, 0xDC,
+  0x07, 0x78, 0x38, 0xFF, 0xC1, 0xFE, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01,
+  0x80, 0x0C, 0x00, 0x60, 0x03, 0x1F, 0x19, 0xFE, 0xDC, 0xF7, 0x81, 0xF8,
+  0x0F, 0xC0, 0x7E, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xE0, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+  0x00, 0xC0, 0x03, 0x00, 0x0C, 0x07, 0x30, 0x38, 0xC1, 0xC3, 0x0E, 0x0C,
+  0x70, 0x33, 0x80, 0xDE, 0x03, 0xFC, 0x0F, 0x78, 0x38, 0xE0, 0xC1, 0xC3,
+  0x07, 0x0C, 0x0E, 0x30, 0x3C, 0xC0, 0x73, 0x00, 0xEC, 0x03, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xCF, 0xC3, 0xE3, 0x7F,
+  0x9F, 0xEF, 0x8F, 0xE7, 0xBC, 0x1E, 0x0E, 0xE0, 0x78, 0x1F, 0x81, 0xC0,
+  0x7E, 0x07, 0x01, 0xF8, 0x1C, 0x07, 0xE0, 0x70, 0x1F, 0x81, 0xC0, 0x7E,
+  0x07, 0x01, 0xF8, 0x1C, 0x07, 0xE0, 0x70, 0x1F, 0x81, 0xC0, 0x7E, 0x07,
+  0x01, 0xF8, 0x1C, 0x07, 0xE0, 0x70, 0x1C, 0xCF, 0xC6, 0xFF, 0xBF, 0x3D,
+  0xE0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8,
+  0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x38, 0x0F,
+  0xC0, 0x3F, 0xE0, 0xFB, 0xE3, 0x81, 0xE7, 0x01, 0xDC, 0x01, 0xB8, 0x03,
+  0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x67, 0x01, 0xCE,
+  0x07, 0x8F, 0xBE, 0x0F, 0xF8, 0x07, 0xC0, 0xCF, 0xC1, 0xBF, 0xE3, 0xFF,
+  0xE7, 0x81, 0xCE, 0x01, 0xDC, 0x03, 0xB8, 0x03, 0x70, 0x07, 0xE0, 0x0F,
+  0xC0, 0x1F, 0x80, 0x37, 0x00, 0xEE, 0x01, 0xDE, 0x07, 0x3F, 0xFE, 0x7F,
+  0xF8, 0xE7, 0xC1, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
+  0x38, 0x00, 0x00, 0x0F, 0xCE, 0x3F, 0xFC, 0xFB, 0xFB, 0xC1, 0xF7, 0x01,
+  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F,
+  0x00, 0x77, 0x01, 0xEF, 0x07, 0xCF, 0xBF, 0x9F, 0xF7, 0x0F, 0xCE, 0x00,
+  0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xC7,
+  0xCF, 0xDF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0x0F, 0xC1, 0xFF, 0x1F, 0x7C, 0xE0, 0xFE, 0x03,
+  0xF0, 0x01, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x1F, 0xC0, 0x0E, 0x00, 0x3E,
+  0x01, 0xF8, 0x1D, 0xF3, 0xE7, 0xFE, 0x1F, 0xC0, 0x30, 0x60, 0xC1, 0x83,
+  0x1F, 0xFF, 0x98, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xE1, 0xC3, 0xE3, 0xC0, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03,
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7E,
+  0x03, 0xF0, 0x3F, 0xC7, 0xEF, 0xFB, 0x3F, 0x98, 0x00, 0x00, 0xE0, 0x0E,
+  0xE0, 0x1D, 0xC0, 0x73, 0x80, 0xE3, 0x81, 0xC7, 0x07, 0x0E, 0x0E, 0x0E,
+  0x18, 0x1C, 0x70, 0x18, 0xE0, 0x39, 0x80, 0x77, 0x00, 0x6E, 0x00, 0xF8,
+  0x01, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0xE0, 0x38, 0x1D, 0xC1, 0xE0, 0x77,
+  0x07, 0x81, 0xDC, 0x1F, 0x0E, 0x30, 0x7C, 0x38, 0xE3, 0xB0, 0xE3, 0x8E,
+  0xC3, 0x0E, 0x33, 0x8C, 0x18, 0xCE, 0x70, 0x77, 0x19, 0xC1, 0xDC, 0x66,
+  0x03, 0x61, 0xD8, 0x0D, 0x87, 0xE0, 0x3E, 0x0F, 0x00, 0xF8, 0x3C, 0x01,
+  0xC0, 0xF0, 0x07, 0x03, 0xC0, 0x70, 0x1C, 0x70, 0x30, 0xE0, 0xE0, 0xE3,
+  0x80, 0xC6, 0x01, 0xDC, 0x01, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0x0F, 0x80,
+  0x1F, 0x00, 0x77, 0x01, 0xC7, 0x03, 0x8E, 0x0E, 0x0E, 0x38, 0x0E, 0x70,
+  0x1C, 0xE0, 0x0C, 0xE0, 0x39, 0xC0, 0x73, 0x80, 0xC3, 0x83, 0x87, 0x07,
+  0x0E, 0x0C, 0x0C, 0x38, 0x1C, 0x70, 0x38, 0xC0, 0x33, 0x80, 0x77, 0x00,
+  0xEC, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x1C,
+  0x00, 0x38, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0x7F, 0xFB,
+  0xFF, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0x70, 0x07,
+  0x00, 0x70, 0x07, 0x00, 0x78, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1F, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1C, 0x3F,
+  0xB8, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F, 0x1F, 0x00, 0x1C, 0x3F,
+  0xB8, 0xF8, 0x3C, 0x18, 0x0C, 0x0E, 0x1E, 0x1C, 0x38, 0x38, 0x18, 0x0F,
+  0xFF, 0xFC };
+
+const GFXglyph FreeSans_subset_16pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   3,  23,  10,    4,  -22 },   // 0x21 '!'
+  {    10,  26,  22,  28,    1,  -21 },   // 0x25 '%'
+  {    82,   3,   8,   6,    2,  -21 },   // 0x27 '''
+  {    85,   7,  29,  10,    2,  -22 },   // 0x28 '('
+  {   111,   7,  29,  10,    1,  -22 },   // 0x29 ')'
+  {   137,  15,  15,  18,    2,  -14 },   // 0x2B '+'
+  {   166,   3,   8,   9,    3,   -2 },   // 0x2C ','
+  {   169,   8,   2,  10,    1,   -9 },   // 0x2D '-'
+  {   171,   4,   3,   8,    2,   -2 },   // 0x2E '.'
+  {   173,   9,  23,   9,    0,  -22 },   // 0x2F '/'
+  {   199,  15,  22,  17,    1,  -21 },   // 0x30 '0'
+  {   241,   8,  22,  17,    3,  -21 },   // 0x31 '1'
+  {   263,  15,  22,  17,    1,  -21 },   // 0x32 '2'
+  {   305,  15,  22,  17,    1,  -21 },   // 0x33 '3'
+  {   347,  15,  22,  17,    1,  -21 },   // 0x34 '4'
+  {   389,  15,  22,  17,    1,  -21 },   // 0x35 '5'
+  {   431,  15,  22,  17,    1,  -21 },   // 0x36 '6'
+  {   473,  15,  22,  17,    1,  -21 },   // 0x37 '7'
+  {   515,  15,  22,  17,    1,  -21 },   // 0x38 '8'
+  {   557,  15,  22,  17,    1,  -21 },   // 0x39 '9'
+  {   599,   4,  17,   8,    2,  -16 },   // 0x3A ':'
+  {   608,  15,  15,  18,    2,  -14 },   // 0x3E '>'
+  {   637,  14,  23,  17,    2,  -22 },   // 0x3F '?'
+  {   678,  20,  23,  21,    0,  -22 },   // 0x41 'A'
+  {   736,  18,  23,  21,    2,  -22 },   // 0x42 'B'
+  {   788,  20,  23,  22,    1,  -22 },   // 0x43 'C'
+  {   846,  19,  23,  22,    2,  -22 },   // 0x44 'D'
+  {   901,  17,  23,  20,    2,  -22 },   // 0x45 'E'
+  {   950,  16,  23,  19,    2,  -22 },   // 0x46 'F'
+  {   996,  21,  24,  24,    1,  -22 },   // 0x47 'G'
+  {  1059,  18,  23,  23,    2,  -22 },   // 0x48 'H'
+  {  1111,   3,  23,   9,    3,  -22 },   // 0x49 'I'
+  {  1120,  13,  23,  17,    1,  -22 },   // 0x4A 'J'
+  {  1158,  19,  23,  21,    2,  -22 },   // 0x4B 'K'
+  {  1213,  15,  23,  18,    2,  -22 },   // 0x4C 'L'
+  {  1257,  22,  23,  27,    2,  -22 },   // 0x4D 'M'
+  {  1321,  18,  23,  23,    2,  -22 },   // 0x4E 'N'
+  {  1373,  22,  23,  25,    1,  -22 },   // 0x4F 'O'
+  {  1437,  17,  23,  21,    2,  -22 },   // 0x50 'P'
+  {  1486,  22,  24,  25,    1,  -22 },   // 0x51 'Q'
+  {  1552,  19,  23,  22,    2,  -22 },   // 0x52 'R'
+  {  1607,  18,  23,  21,    1,  -22 },   // 0x53 'S'
+  {  1659,  18,  23,  20,    1,  -22 },   // 0x54 'T'
+  {  1711,  18,  23,  23,    2,  -22 },   // 0x55 'U'
+  {  1763,  20,  23,  20,    0,  -22 },   // 0x56 'V'
+  {  1821,  29,  23,  29,    0,  -22 },   // 0x57 'W'
+  {  1905,  21,  23,  21,    0,  -22 },   // 0x59 'Y'
+  {  1966,  17,  23,  19,    1,  -22 },   // 0x5A 'Z'
+  {  2015,   6,  30,   9,    2,  -22 },   // 0x5B '['
+  {  2038,   6,  30,   9,    1,  -22 },   // 0x5D ']'
+  {  2061,  19,   2,  17,   -1,    5 },   // 0x5F '_'
+  {  2066,  15,  17,  17,    1,  -16 },   // 0x61 'a'
+  {  2098,  15,  23,  18,    2,  -22 },   // 0x62 'b'
+  {  2142,  14,  17,  16,    1,  -16 },   // 0x63 'c'
+  {  2172,  15,  24,  18,    1,  -22 },   // 0x64 'd'
+  {  2217,  15,  17,  17,    1,  -16 },   // 0x65 'e'
+  {  2249,   7,  23,   9,    1,  -22 },   // 0x66 'f'
+  {  2270,  14,  23,  17,    1,  -16 },   // 0x67 'g'
+  {  2311,  13,  23,  17,    2,  -22 },   // 0x68 'h'
+  {  2349,   3,  23,   7,    2,  -22 },   // 0x69 'i'
+  {  2358,  14,  23,  16,    2,  -22 },   // 0x6B 'k'
+  {  2399,   3,  23,   7,    2,  -22 },   // 0x6C 'l'
+  {  2408,  22,  17,  25,    2,  -16 },   // 0x6D 'm'
+  {  2455,  13,  17,  17,    2,  -16 },   // 0x6E 'n'
+  {  2483,  15,  17,  17,    1,  -16 },   // 0x6F 'o'
+  {  2515,  15,  23,  18,    2,  -16 },   // 0x70 'p'
+  {  2559,  15,  23,  18,    1,  -16 },   // 0x71 'q'
+  {  2603,   8,  17,  10,    2,  -16 },   // 0x72 'r'
+  {  2620,  13,  17,  15,    1,  -16 },   // 0x73 's'
+  {  2648,   7,  22,   9,    1,  -21 },   // 0x74 't'
+  {  2668,  13,  18,  17,    2,  -16 },   // 0x75 'u'
+  {  2698,  15,  17,  16,    0,  -16 },   // 0x76 'v'
+  {  2730,  22,  17,  23,    0,  -16 },   // 0x77 'w'
+  {  2777,  15,  17,  15,    0,  -16 },   // 0x78 'x'
+  {  2809,  15,  24,  15,    0,  -16 },   // 0x79 'y'
+  {  2854,  13,  17,  15,    1,  -16 },   // 0x7A 'z'
+  {  2882,   2,  29,   8,    3,  -22 },   // 0x7C '|'
+  {  2890,   9,  10,  19,    5,  -21 },   // 0xB0 ''
+  {  2902,   9,  14,  11,    1,  -25 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_16pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_16pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_16pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_16pt8bGlyphs,
+  0x20, 0x6F, 38 };
+
+// Approx. 3709 bytes
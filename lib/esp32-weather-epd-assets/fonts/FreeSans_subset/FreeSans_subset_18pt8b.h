@@ -0,0 +1,414 @@
+const uint8_t FreeSans_subset_18pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0x6D, 0xB0, 0x3F, 0xFC, 0x00,
+  0x00, 0x0C, 0x00, 0x78, 0x00, 0x60, 0x0F, 0xF0, 0x06, 0x00, 0xFF, 0xC0,
+  0x30, 0x06, 0x07, 0x03, 0x00, 0x70, 0x38, 0x38, 0x03, 0x00, 0xC1, 0x80,
+  0x1C, 0x06, 0x1C, 0x00, 0xE0, 0x70, 0xC0, 0x03, 0x87, 0x0E, 0x00, 0x0F,
+  0xF8, 0x60, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03,
+  0x03, 0xC0, 0x00, 0x38, 0x7F, 0x80, 0x01, 0x83, 0xFE, 0x00, 0x1C, 0x38,
+  0x38, 0x00, 0xC1, 0x81, 0xC0, 0x0E, 0x1C, 0x06, 0x00, 0x60, 0xE0, 0x30,
+  0x06, 0x07, 0x01, 0x80, 0x70, 0x1C, 0x1C, 0x03, 0x00, 0xFB, 0xC0, 0x38,
+  0x03, 0xFC, 0x01, 0x80, 0x07, 0xC0, 0xFF, 0xFF, 0xFA, 0x40, 0x06, 0x18,
+  0x30, 0xC1, 0x87, 0x0C, 0x38, 0x70, 0xC3, 0x87, 0x0E, 0x1C, 0x30, 0x60,
+  0xC1, 0x83, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x60, 0xE0, 0xC1, 0x83, 0x83,
+  0x07, 0x06, 0x06, 0x60, 0x60, 0x30, 0x38, 0x18, 0x18, 0x1C, 0x0C, 0x0E,
+  0x0E, 0x0E, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x06, 0x06, 0x0E, 0x0E, 0x0C, 0x1C, 0x1C, 0x18, 0x38, 0x30, 0x60, 0x60,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x70, 0x00,
+  0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xFF, 0xFF, 0x33, 0x36, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0xC0, 0x30, 0x18, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x0C, 0x06, 0x01, 0x80,
+  0x60, 0x30, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x18, 0x0C, 0x03, 0x00, 0xC0,
+  0x60, 0x18, 0x06, 0x01, 0x00, 0xC0, 0x30, 0x00, 0x07, 0xE0, 0x1F, 0xF0,
+  0x3F, 0xF8, 0x78, 0x3C, 0x70, 0x1C, 0xF0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E,
+  0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x0E, 0xE0, 0x0E, 0xF0, 0x0E,
+  0x70, 0x1C, 0x78, 0x3C, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x03, 0x03,
+  0x07, 0x07, 0x3F, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0x81, 0xE7, 0x80, 0x73, 0x80, 0x3D,
+  0xC0, 0x0E, 0xE0, 0x07, 0x70, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01,
+  0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F,
+  0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x87,
+  0x83, 0xC7, 0x80, 0xF3, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0E, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x00, 0xF8, 0x00,
+  0x1C, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0xF7,
+  0x00, 0x73, 0xC0, 0x78, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x00,
+  0x1C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x0E, 0xE0,
+  0x07, 0x70, 0x07, 0x38, 0x07, 0x1C, 0x07, 0x8E, 0x03, 0x87, 0x03, 0x83,
+  0x83, 0x81, 0xC1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x38, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
+  0x00, 0x38, 0x00, 0x1C, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0x87, 0xFF, 0xC7,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x39, 0xE0,
+  0x1B, 0xFE, 0x1F, 0xFF, 0x8F, 0x83, 0xE7, 0x80, 0xF0, 0x00, 0x3C, 0x00,
+  0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0xF7,
+  0x00, 0x73, 0xC0, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xE0, 0x00, 0x07,
+  0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3C, 0x1E, 0x78, 0x0E, 0x70, 0x0E, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0xC0, 0xEF, 0xF8, 0xFF, 0xFC, 0xFC,
+  0x3E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+  0x07, 0xE0, 0x0F, 0x70, 0x0E, 0x78, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x0E, 0x00,
+  0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00,
+  0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1C,
+  0x00, 0x1C, 0x00, 0x03, 0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0x83, 0xC7,
+  0x80, 0xF3, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0E, 0x78, 0x07, 0x1E, 0x07,
+  0x07, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC1, 0xE0, 0xF1, 0xE0, 0x1C, 0xE0,
+  0x0F, 0xF0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0xEE, 0x00, 0x77, 0x00, 0x73,
+  0xE0, 0x78, 0xFF, 0xF8, 0x3F, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x07,
+  0xFC, 0x0F, 0xFF, 0x07, 0x83, 0xC7, 0x80, 0xF3, 0x80, 0x3B, 0xC0, 0x1D,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xDC, 0x01, 0xEF, 0x01, 0xF3, 0xC1,
+  0xF9, 0xFF, 0xDC, 0x3F, 0xCE, 0x07, 0x87, 0x00, 0x07, 0x80, 0x03, 0x80,
+  0x01, 0xCE, 0x01, 0xE7, 0x80, 0xE1, 0xE0, 0xF0, 0xFF, 0xF0, 0x3F, 0xF0,
+  0x07, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x80,
+  0x00, 0x70, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
+  0x01, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0x80, 0x0F, 0xC0, 0x1F, 0x80, 0x7F,
+  0x00, 0xFC, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0xC0, 0x00, 0x80, 0x00, 0x00,
+  0x0F, 0xE0, 0x7F, 0xE1, 0xFF, 0xF3, 0x81, 0xEE, 0x01, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x01, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00,
+  0x01, 0xDC, 0x00, 0x07, 0x78, 0x00, 0x3C, 0xE0, 0x00, 0xE3, 0xC0, 0x03,
+  0x8F, 0x00, 0x1E, 0x1C, 0x00, 0x70, 0x78, 0x01, 0xC1, 0xE0, 0x0F, 0x03,
+  0x80, 0x38, 0x0F, 0x00, 0xE0, 0x3C, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0,
+  0x7F, 0xFF, 0x83, 0xC0, 0x0E, 0x0E, 0x00, 0x3C, 0x78, 0x00, 0xF1, 0xE0,
+  0x01, 0xC7, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x3B, 0x80, 0x00,
+  0xF0, 0xFF, 0xF8, 0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x70, 0x03, 0xCE, 0x00,
+  0x3D, 0xC0, 0x07, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0xE0, 0x03, 0xDC, 0x00,
+  0x73, 0x80, 0x1E, 0x7F, 0xFF, 0x0F, 0xFF, 0xE1, 0xFF, 0xFF, 0x38, 0x01,
+  0xF7, 0x00, 0x0E, 0xE0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
+  0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xB8, 0x00, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF,
+  0x1F, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x80,
+  0x7C, 0x0F, 0x81, 0xE0, 0x07, 0x87, 0x80, 0x07, 0x0E, 0x00, 0x0F, 0x3C,
+  0x00, 0x0E, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x80,
+  0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x70, 0x00, 0x1E, 0xE0, 0x00, 0x39, 0xE0, 0x00, 0x71, 0xC0, 0x01,
+  0xE3, 0xC0, 0x03, 0x83, 0xC0, 0x0F, 0x03, 0xE0, 0x7C, 0x03, 0xFF, 0xF0,
+  0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0xFF,
+  0xFF, 0x0E, 0x00, 0xF8, 0xE0, 0x03, 0xCE, 0x00, 0x1E, 0xE0, 0x00, 0xEE,
+  0x00, 0x0E, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
+  0x7E, 0x00, 0x0F, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x01, 0xEE, 0x00,
+  0x3C, 0xE0, 0x0F, 0x8F, 0xFF, 0xF0, 0xFF, 0xFE, 0x0F, 0xFF, 0x80, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEE, 0x00, 0x03, 0x80, 0x00, 0xE0,
+  0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x0E, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xCF,
+  0xFF, 0xE7, 0xFF, 0xF3, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xE0,
+  0x07, 0xFF, 0xF0, 0x0F, 0x80, 0xF8, 0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x1E,
+  0x38, 0x00, 0x0E, 0x78, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x07, 0xFF, 0xF0, 0x07, 0xFF,
+  0xF0, 0x07, 0xFF, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07,
+  0x78, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x1E, 0x00, 0x3F,
+  0x0F, 0x80, 0xFF, 0x07, 0xFF, 0xF7, 0x03, 0xFF, 0xE7, 0x00, 0x7F, 0x83,
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
+  0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
+  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xDE, 0x03, 0x9E,
+  0x0F, 0x1F, 0xFC, 0x1F, 0xF0, 0x1F, 0x80, 0xE0, 0x01, 0xFE, 0x00, 0x3E,
+  0xE0, 0x07, 0xCE, 0x00, 0xF8, 0xE0, 0x0F, 0x0E, 0x01, 0xE0, 0xE0, 0x3C,
+  0x0E, 0x07, 0x80, 0xE0, 0xF0, 0x0E, 0x1E, 0x00, 0xE3, 0xC0, 0x0E, 0x7C,
+  0x00, 0xEF, 0xE0, 0x0F, 0xCF, 0x00, 0xFC, 0x70, 0x0F, 0x87, 0x80, 0xF0,
+  0x3C, 0x0E, 0x01, 0xC0, 0xE0, 0x1E, 0x0E, 0x00, 0xF0, 0xE0, 0x07, 0x0E,
+  0x00, 0x78, 0xE0, 0x03, 0xCE, 0x00, 0x1E, 0xE0, 0x01, 0xEE, 0x00, 0x0F,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x37, 0xEE, 0x00,
+  0x77, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x67, 0xE7, 0x00, 0xE7, 0xE7, 0x00,
+  0xE7, 0xE7, 0x00, 0xC7, 0xE3, 0x81, 0xC7, 0xE3, 0x81, 0xC7, 0xE3, 0x81,
+  0x87, 0xE1, 0xC3, 0x87, 0xE1, 0xC3, 0x87, 0xE1, 0xC3, 0x07, 0xE0, 0xE7,
+  0x07, 0xE0, 0xE7, 0x07, 0xE0, 0xE7, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x3C, 0x07, 0xE0, 0x3C, 0x07, 0xF0, 0x00,
+  0x7F, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE0,
+  0x07, 0xEE, 0x00, 0x7E, 0x70, 0x07, 0xE7, 0x80, 0x7E, 0x38, 0x07, 0xE3,
+  0xC0, 0x7E, 0x1E, 0x07, 0xE0, 0xE0, 0x7E, 0x0F, 0x07, 0xE0, 0x78, 0x7E,
+  0x03, 0x87, 0xE0, 0x3C, 0x7E, 0x01, 0xC7, 0xE0, 0x1E, 0x7E, 0x00, 0xF7,
+  0xE0, 0x07, 0x7E, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0x1F, 0xE0, 0x01,
+  0xFE, 0x00, 0x0F, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFE,
+  0x01, 0xF0, 0x1F, 0x81, 0xF0, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00,
+  0x3C, 0xF0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0xB8, 0x00, 0x03, 0xDC, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0,
+  0x00, 0x0E, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x07, 0xBC, 0x00, 0x03, 0xDE,
+  0x00, 0x01, 0xC7, 0x80, 0x01, 0xE3, 0xC0, 0x01, 0xE0, 0xF0, 0x01, 0xF0,
+  0x3E, 0x03, 0xF0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xCF, 0xFF, 0xFB, 0x80, 0x1E, 0xE0, 0x03,
+  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E,
+  0x00, 0x3F, 0x80, 0x3E, 0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFF, 0xC3, 0x80,
+  0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
+  0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x1F,
+  0x81, 0xF0, 0x03, 0xE1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
+  0x0E, 0x70, 0x00, 0x07, 0xB8, 0x00, 0x03, 0xDC, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0E, 0xE0,
+  0x00, 0x07, 0x70, 0x00, 0x07, 0xB8, 0x00, 0x03, 0xDE, 0x00, 0x01, 0xC7,
+  0x00, 0x39, 0xE3, 0xC0, 0x1F, 0xE0, 0xF0, 0x07, 0xE0, 0x3E, 0x03, 0xF0,
+  0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00,
+  0xC0, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCE, 0x00, 0x3E, 0xE0,
+  0x01, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE,
+  0x00, 0x0E, 0xE0, 0x01, 0xEE, 0x00, 0x3C, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0x8E, 0x00, 0x3C, 0xE0, 0x01, 0xEE, 0x00, 0x0E, 0xE0, 0x00,
+  0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00,
+  0x0E, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x3F,
+  0xFF, 0x83, 0xC0, 0x7C, 0x78, 0x01, 0xC7, 0x00, 0x1E, 0xF0, 0x00, 0xEF,
+  0x00, 0x0E, 0x70, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00,
+  0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0xF7, 0x80,
+  0x1E, 0x7C, 0x03, 0xE3, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x00, 0x00, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
+  0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07,
+  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00,
+  0x70, 0x00, 0x07, 0x00, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0E, 0xF0, 0x01, 0xE7, 0x80, 0x1E, 0x7C,
+  0x07, 0xC3, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0xE0, 0x00, 0x3F,
+  0x80, 0x03, 0xFC, 0x00, 0x1C, 0xE0, 0x00, 0xE7, 0x80, 0x0F, 0x3C, 0x00,
+  0x70, 0xE0, 0x03, 0x87, 0x80, 0x3C, 0x1C, 0x01, 0xC0, 0xE0, 0x0E, 0x07,
+  0x80, 0xF0, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x83, 0xC0, 0x1C, 0x1C,
+  0x00, 0xE0, 0xE0, 0x07, 0x8F, 0x00, 0x1C, 0x70, 0x00, 0xE3, 0x80, 0x07,
+  0xBC, 0x00, 0x1D, 0xC0, 0x00, 0xEE, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x00,
+  0x00, 0xF8, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0xE0, 0x0F,
+  0x80, 0x3F, 0xC0, 0x1F, 0x00, 0x7F, 0x80, 0x3E, 0x00, 0xF7, 0x00, 0xFE,
+  0x01, 0xCE, 0x01, 0xDC, 0x03, 0x9E, 0x03, 0xB8, 0x0F, 0x3C, 0x07, 0x70,
+  0x1E, 0x38, 0x1C, 0x70, 0x38, 0x70, 0x38, 0xE0, 0x70, 0xF0, 0x71, 0xC1,
+  0xE1, 0xE0, 0xE3, 0x83, 0xC1, 0xC3, 0x83, 0x87, 0x03, 0x87, 0x07, 0x0E,
+  0x07, 0x8E, 0x0E, 0x1C, 0x0F, 0x1C, 0x1E, 0x78, 0x0E, 0x70, 0x1C, 0xE0,
+  0x1C, 0xE0, 0x39, 0xC0, 0x39, 0xC0, 0x73, 0x80, 0x7F, 0x00, 0x7F, 0x00,
+  0x7E, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x03,
+  0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xE7, 0x80, 0x07, 0x8F, 0x00, 0x3C, 0x3C, 0x00,
+  0xF0, 0x78, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0xC0, 0xF0, 0x07, 0x83, 0x80,
+  0x1E, 0x1E, 0x00, 0x3C, 0xF0, 0x00, 0x73, 0x80, 0x01, 0xFE, 0x00, 0x03,
+  0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0,
+  0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x7F,
+  0xFF, 0xF7, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+  0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF,
+  0x8F, 0x03, 0xC7, 0x00, 0xE3, 0x80, 0x70, 0x00, 0x38, 0x00, 0x3C, 0x07,
+  0xFE, 0x1F, 0xFF, 0x1F, 0x83, 0x9E, 0x01, 0xCE, 0x00, 0xE7, 0x00, 0x73,
+  0x80, 0x79, 0xE0, 0x7C, 0x7F, 0xFF, 0x9F, 0xF3, 0xC7, 0xE0, 0xE0, 0xE0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC7, 0xE0, 0xEF, 0xF8, 0x7F, 0xFE, 0x3F, 0x07, 0x9F, 0x01,
+  0xEF, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0,
+  0x01, 0xF8, 0x01, 0xDC, 0x00, 0xEF, 0x00, 0x77, 0xC0, 0x7B, 0xF0, 0x79,
+  0xFF, 0xF8, 0xEF, 0xF8, 0x71, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F,
+  0xFC, 0x3C, 0x1E, 0x78, 0x0E, 0x70, 0x0E, 0xF0, 0x07, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x07, 0x70, 0x0F, 0x70,
+  0x0E, 0x3C, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
+  0x0F, 0xC7, 0x1F, 0xF3, 0x9F, 0xFD, 0xCF, 0x07, 0xEF, 0x01, 0xF7, 0x00,
+  0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x01, 0xFE, 0x00, 0xF7, 0x00, 0x7B, 0xC0, 0x7C, 0xF0, 0x7E, 0x7F, 0xFF,
+  0x1F, 0xFB, 0x83, 0xF9, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xFC, 0x0F,
+  0xFF, 0x07, 0x83, 0xC7, 0x80, 0xF3, 0x80, 0x3B, 0x80, 0x1D, 0xC0, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80,
+  0x39, 0xC0, 0x3C, 0x78, 0x3C, 0x3F, 0xFE, 0x0F, 0xFE, 0x01, 0xFC, 0x00,
+  0x0F, 0x1F, 0x3F, 0x38, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x07, 0xE7, 0x1F, 0xF7, 0x3F, 0xFB, 0x3C, 0x1F, 0x78, 0x0F,
+  0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xF0, 0x07, 0x70, 0x0F, 0x78, 0x0F, 0x3C, 0x1F, 0x3F, 0xFF,
+  0x1F, 0xF7, 0x07, 0xC7, 0x00, 0x07, 0x70, 0x07, 0x70, 0x0E, 0x78, 0x0E,
+  0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xF0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
+  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x71, 0xF8, 0xEF, 0xF9, 0xFF,
+  0xFB, 0xE0, 0x7F, 0x80, 0xFF, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8,
+  0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1C, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x3C, 0xE0, 0x78, 0xE0,
+  0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEF, 0x80, 0xFF,
+  0x80, 0xFB, 0xC0, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0,
+  0x78, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x73, 0xF0,
+  0x7E, 0x3B, 0xFE, 0x7F, 0x9F, 0xFF, 0x7F, 0xEF, 0x83, 0xF0, 0x77, 0x81,
+  0xF0, 0x3B, 0x80, 0x70, 0x1F, 0xC0, 0x38, 0x07, 0xE0, 0x1C, 0x03, 0xF0,
+  0x0E, 0x01, 0xF8, 0x07, 0x00, 0xFC, 0x03, 0x80, 0x7E, 0x01, 0xC0, 0x3F,
+  0x00, 0xE0, 0x1F, 0x80, 0x70, 0x0F, 0xC0, 0x38, 0x07, 0xE0, 0x1C, 0x03,
+  0xF0, 0x0E, 0x01, 0xF8, 0x07, 0x00, 0xFC, 0x03, 0x80, 0x70, 0x00, 0x01,
+  0xCF, 0xE3, 0xBF, 0xE7, 0xFF, 0xEF, 0x81, 0xFE, 0x03, 0xFC, 0x03, 0xF0,
+  0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01,
+  0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x70,
+  0x07, 0xE0, 0x0F, 0xFC, 0x0F, 0xFF, 0x07, 0x83, 0xC7, 0x80, 0xF3, 0x80,
+  0x3B, 0xC0, 0x1D, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
+  0x00, 0xFF, 0x00, 0x73, 0x80, 0x39, 0xE0, 0x3C, 0x78, 0x3C, 0x3F, 0xFE,
+  0x0F, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x73, 0xF0, 0x3B, 0xFE, 0x1F,
+  0xFF, 0x8F, 0xC1, 0xE7, 0xC0, 0x7B, 0xC0, 0x1D, 0xC0, 0x0E, 0xE0, 0x07,
+  0x70, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x3B, 0xC0,
+  0x1D, 0xF0, 0x1E, 0xFC, 0x1E, 0x7F, 0xFE, 0x3B, 0xFE, 0x1C, 0x7E, 0x0E,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+  0x38, 0x00, 0x00, 0x07, 0xE3, 0x8F, 0xFD, 0xCF, 0xFF, 0xE7, 0x83, 0xF7,
+  0x80, 0xFB, 0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x7B, 0x80, 0x3D, 0xE0, 0x3E, 0xF8,
+  0x3F, 0x3F, 0xFB, 0x8F, 0xF9, 0xC1, 0xF8, 0xE0, 0x00, 0x70, 0x00, 0x38,
+  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0xE3,
+  0xF3, 0xFB, 0xFF, 0x8F, 0x87, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x00, 0x07, 0xE0, 0x3F,
+  0xF0, 0xFF, 0xF3, 0xC1, 0xE7, 0x01, 0xCE, 0x03, 0x9C, 0x00, 0x3E, 0x00,
+  0x3F, 0xC0, 0x3F, 0xF0, 0x0F, 0xF0, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xFC,
+  0x03, 0xBC, 0x0F, 0x7F, 0xFC, 0x7F, 0xF0, 0x3F, 0x80, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3F, 0x1F, 0x1F, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xF8,
+  0x07, 0xF8, 0x1F, 0x7F, 0xFE, 0x7F, 0xDC, 0x7F, 0x38, 0x00, 0x00, 0x70,
+  0x03, 0xB8, 0x03, 0xDC, 0x01, 0xC7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0x70,
+  0x70, 0x38, 0x38, 0x38, 0x1C, 0x1C, 0x07, 0x0E, 0x03, 0x8E, 0x01, 0xC7,
+  0x00, 0x73, 0x00, 0x3B, 0x80, 0x1D, 0xC0, 0x07, 0xC0, 0x03, 0xE0, 0x01,
+  0xF0, 0x00, 0x70, 0x00, 0xF0, 0x1E, 0x03, 0xB8, 0x0F, 0x03, 0xDC, 0x0F,
+  0x81, 0xCE, 0x07, 0xC0, 0xE3, 0x83, 0x70, 0x71, 0xC1, 0xB8, 0x78, 0xE1,
+  0xDC, 0x38, 0x78, 0xEE, 0x1C, 0x1C, 0x73, 0x8E, 0x0E, 0x31, 0xCE, 0x07,
+  0x38, 0xE7, 0x01, 0xDC, 0x73, 0x80, 0xEE, 0x1D, 0xC0, 0x76, 0x0F, 0xC0,
+  0x3F, 0x07, 0xE0, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0xF0, 0x03, 0xC0, 0x78,
+  0x00, 0xE0, 0x3C, 0x00, 0x70, 0x07, 0x38, 0x0E, 0x3C, 0x1E, 0x1C, 0x1C,
+  0x0E, 0x38, 0x0F, 0x78, 0x07, 0x70, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xC0,
+  0x03, 0xE0, 0x07, 0xF0, 0x07, 0x70, 0x0E, 0x78, 0x1E, 0x3C, 0x1C, 0x1C,
+  0x38, 0x1E, 0x78, 0x0E, 0x70, 0x07, 0xF0, 0x07, 0x70, 0x07, 0x70, 0x0F,
+  0x78, 0x0E, 0x38, 0x0E, 0x38, 0x1E, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38,
+  0x1E, 0x38, 0x0E, 0x38, 0x0E, 0x70, 0x0E, 0x70, 0x07, 0x70, 0x07, 0xE0,
+  0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x80,
+  0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x38, 0x00,
+  0x7F, 0xFE, 0xFF, 0xFD, 0xFF, 0xF8, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0,
+  0x07, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x07, 0xF1,
+  0xC7, 0x30, 0x3C, 0x07, 0x80, 0xD8, 0x1B, 0x8E, 0x3F, 0x83, 0xE0, 0x1E,
+  0x1F, 0xE6, 0x1F, 0x83, 0xC0, 0xC0, 0x30, 0x1C, 0x0E, 0x0F, 0x0F, 0x07,
+  0x03, 0x80, 0xC0, 0x3F, 0xFF, 0xFC };
+
+const GFXglyph FreeSans_subset_18pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
+  {     1,   3,  26,  12,    4,  -25 },   // 0x21 '!'
+  {    11,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   102,   3,   9,   7,    2,  -24 },   // 0x27 '''
+  {   106,   7,  33,  12,    3,  -25 },   // 0x28 '('
+  {   135,   8,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   168,  17,  17,  21,    2,  -16 },   // 0x2B '+'
+  {   205,   4,   9,  10,    3,   -3 },   // 0x2C ','
+  {   210,   8,   3,  12,    2,  -10 },   // 0x2D '-'
+  {   213,   3,   4,   9,    3,   -3 },   // 0x2E '.'
+  {   215,  10,  26,  10,    0,  -25 },   // 0x2F '/'
+  {   248,  16,  25,  20,    2,  -24 },   // 0x30 '0'
+  {   298,   8,  25,  20,    4,  -24 },   // 0x31 '1'
+  {   323,  17,  25,  20,    1,  -24 },   // 0x32 '2'
+  {   377,  17,  25,  20,    1,  -24 },   // 0x33 '3'
+  {   431,  17,  25,  20,    1,  -24 },   // 0x34 '4'
+  {   485,  17,  25,  20,    1,  -24 },   // 0x35 '5'
+  {   539,  16,  25,  20,    2,  -24 },   // 0x36 '6'
+  {   589,  16,  25,  20,    2,  -24 },   // 0x37 '7'
+  {   639,  17,  25,  20,    1,  -24 },   // 0x38 '8'
+  {   693,  17,  25,  20,    1,  -24 },   // 0x39 '9'
+  {   747,   3,  19,   9,    3,  -18 },   // 0x3A ':'
+  {   755,  17,  17,  21,    2,  -16 },   // 0x3E '>'
+  {   792,  15,  26,  20,    3,  -25 },   // 0x3F '?'
+  {   841,  22,  26,  23,    1,  -25 },   // 0x41 'A'
+  {   913,  19,  26,  23,    3,  -25 },   // 0x42 'B'
+  {   975,  23,  26,  25,    1,  -25 },   // 0x43 'C'
+  {  1050,  20,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  1115,  18,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  1174,  17,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  1230,  24,  27,  27,    1,  -25 },   // 0x47 'G'
+  {  1311,  20,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  1376,   3,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  1386,  15,  26,  19,    1,  -25 },   // 0x4A 'J'
+  {  1435,  20,  26,  24,    3,  -25 },   // 0x4B 'K'
+  {  1500,  16,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  1552,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  1630,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  1695,  25,  26,  28,    1,  -25 },   // 0x4F 'O'
+  {  1777,  18,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  1836,  25,  27,  28,    1,  -25 },   // 0x51 'Q'
+  {  1921,  20,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1986,  20,  26,  24,    2,  -25 },   // 0x53 'S'
+  {  2051,  20,  26,  22,    1,  -25 },   // 0x54 'T'
+  {  2116,  20,  26,  25,    3,  -25 },   // 0x55 'U'
+  {  2181,  21,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  2250,  31,  26,  33,    1,  -25 },   // 0x57 'W'
+  {  2351,  22,  26,  24,    1,  -25 },   // 0x59 'Y'
+  {  2423,  20,  26,  22,    1,  -25 },   // 0x5A 'Z'
+  {  2488,   7,  34,  10,    2,  -25 },   // 0x5B '['
+  {  2518,   6,  34,  10,    1,  -25 },   // 0x5D ']'
+  {  2544,  21,   2,  20,   -1,    5 },   // 0x5F '_'
+  {  2550,  17,  19,  19,    1,  -18 },   // 0x61 'a'
+  {  2591,  17,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  2647,  16,  19,  18,    1,  -18 },   // 0x63 'c'
+  {  2685,  17,  27,  20,    1,  -25 },   // 0x64 'd'
+  {  2743,  17,  19,  19,    1,  -18 },   // 0x65 'e'
+  {  2784,   8,  26,  10,    1,  -25 },   // 0x66 'f'
+  {  2810,  16,  26,  19,    1,  -18 },   // 0x67 'g'
+  {  2862,  15,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  2911,   3,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  2921,  16,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  2973,   3,  26,   8,    2,  -25 },   // 0x6C 'l'
+  {  2983,  25,  20,  29,    2,  -19 },   // 0x6D 'm'
+  {  3046,  15,  20,  19,    2,  -19 },   // 0x6E 'n'
+  {  3084,  17,  19,  19,    1,  -18 },   // 0x6F 'o'
+  {  3125,  17,  27,  20,    2,  -19 },   // 0x70 'p'
+  {  3183,  17,  26,  20,    1,  -18 },   // 0x71 'q'
+  {  3239,   9,  19,  12,    2,  -18 },   // 0x72 'r'
+  {  3261,  15,  19,  17,    1,  -18 },   // 0x73 's'
+  {  3297,   8,  24,  10,    1,  -23 },   // 0x74 't'
+  {  3321,  15,  20,  19,    2,  -18 },   // 0x75 'u'
+  {  3359,  17,  19,  17,    0,  -18 },   // 0x76 'v'
+  {  3400,  25,  19,  25,    0,  -18 },   // 0x77 'w'
+  {  3460,  16,  19,  17,    0,  -18 },   // 0x78 'x'
+  {  3498,  16,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  3552,  15,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  3588,   2,  33,   9,    3,  -25 },   // 0x7C '|'
+  {  3597,  11,  10,  21,    5,  -23 },   // 0xB0 ''
+  {  3611,  10,  15,  12,    1,  -28 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_18pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_18pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_18pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_18pt8bGlyphs,
+  0x20, 0x6F, 42 };
+
+// Approx. 4421 bytes
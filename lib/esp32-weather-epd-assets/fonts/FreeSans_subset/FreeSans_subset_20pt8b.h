@@ -0,0 +1,487 @@
+const uint8_t FreeSans_subset_20pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x80, 0x1F, 0xFE,
+  0x00, 0x00, 0x01, 0x80, 0x07, 0xC0, 0x01, 0xC0, 0x07, 0xF8, 0x01, 0xC0,
+  0x07, 0xFE, 0x00, 0xC0, 0x07, 0x07, 0x80, 0xE0, 0x07, 0x01, 0xC0, 0x60,
+  0x03, 0x80, 0x60, 0x70, 0x01, 0xC0, 0x30, 0x30, 0x00, 0xE0, 0x18, 0x38,
+  0x00, 0x78, 0x1C, 0x38, 0x00, 0x1E, 0x1E, 0x18, 0x00, 0x07, 0xFE, 0x1C,
+  0x00, 0x01, 0xFE, 0x0C, 0x00, 0x00, 0x3C, 0x0E, 0x00, 0x00, 0x00, 0x06,
+  0x03, 0xC0, 0x00, 0x07, 0x07, 0xF8, 0x00, 0x07, 0x07, 0xFE, 0x00, 0x03,
+  0x07, 0x87, 0x80, 0x03, 0x83, 0x81, 0xC0, 0x01, 0x83, 0x80, 0x70, 0x01,
+  0xC1, 0xC0, 0x38, 0x00, 0xC0, 0xE0, 0x1C, 0x00, 0xE0, 0x38, 0x1C, 0x00,
+  0xE0, 0x1E, 0x1E, 0x00, 0x60, 0x07, 0xFE, 0x00, 0x70, 0x01, 0xFE, 0x00,
+  0x30, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xE6, 0x66, 0x03, 0x06, 0x0E,
+  0x0C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x70,
+  0x70, 0x38, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x06, 0x07, 0x03, 0x60, 0x38,
+  0x0C, 0x07, 0x01, 0x80, 0xE0, 0x30, 0x1C, 0x0E, 0x03, 0x01, 0xC0, 0xE0,
+  0x70, 0x3C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x18, 0x1C,
+  0x0C, 0x0E, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00,
+  0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x00, 0x0E, 0x00, 0x01,
+  0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03,
+  0x80, 0x00, 0xFF, 0xFF, 0xF3, 0x98, 0xC6, 0xF6, 0x00, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0x00, 0x60, 0x1C, 0x03, 0x00, 0x60, 0x0C, 0x03, 0x00,
+  0x60, 0x0C, 0x03, 0x00, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x0C, 0x03, 0x00,
+  0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x03, 0x80,
+  0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01,
+  0xFF, 0xE0, 0xF8, 0x7C, 0x78, 0x0F, 0x1E, 0x01, 0xE7, 0x00, 0x7B, 0xC0,
+  0x0E, 0xF0, 0x03, 0xB8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
+  0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFF,
+  0x00, 0x3B, 0xC0, 0x0E, 0x70, 0x07, 0x9E, 0x01, 0xE7, 0x80, 0xF0, 0xF0,
+  0x7C, 0x1F, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x01, 0xC0, 0x70, 0x3C,
+  0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xF8, 0x01, 0xFF, 0xE0, 0x7F,
+  0xFE, 0x1F, 0x87, 0xE3, 0xC0, 0x3C, 0x70, 0x03, 0xDE, 0x00, 0x7B, 0xC0,
+  0x0F, 0x70, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
+  0x7C, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0xF8,
+  0x00, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x1C, 0x00,
+  0x03, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
+  0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC3, 0x80, 0x7C, 0xF0,
+  0x07, 0x9E, 0x00, 0xF3, 0x80, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00,
+  0x3E, 0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x01, 0xFE, 0x00, 0x01, 0xF0, 0x00,
+  0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xF7, 0x00,
+  0x1E, 0xF0, 0x03, 0x9E, 0x00, 0xF1, 0xF0, 0x7C, 0x3F, 0xFF, 0x01, 0xFF,
+  0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00,
+  0x1F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3B, 0x80, 0x0F, 0x70, 0x01,
+  0xCE, 0x00, 0x71, 0xC0, 0x1C, 0x38, 0x07, 0x87, 0x00, 0xE0, 0xE0, 0x38,
+  0x1C, 0x0F, 0x03, 0x83, 0xC0, 0x70, 0x70, 0x0E, 0x1C, 0x01, 0xC3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00,
+  0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xC3,
+  0xFF, 0xF8, 0x7F, 0xFF, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x0F,
+  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x3F, 0x00, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xC7, 0xE0, 0xFC, 0xF0, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x00,
+  0x01, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0xF7, 0x00, 0x1E, 0xF0,
+  0x03, 0x9E, 0x00, 0xF1, 0xF0, 0x7C, 0x1F, 0xFF, 0x01, 0xFF, 0xC0, 0x0F,
+  0xE0, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xF8, 0x7C, 0x3C,
+  0x07, 0x9E, 0x01, 0xE7, 0x00, 0x3B, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00,
+  0x0E, 0x3F, 0x83, 0x9F, 0xF8, 0xEF, 0xFF, 0x3F, 0x83, 0xEF, 0x80, 0x7B,
+  0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x0F, 0xF0,
+  0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF8, 0x7C, 0x1F, 0xFE, 0x03, 0xFF,
+  0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0E,
+  0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x0E, 0x00,
+  0x07, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0x80, 0x00, 0xE0, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F,
+  0x07, 0xC3, 0xC0, 0x3C, 0x70, 0x07, 0x9E, 0x00, 0x73, 0xC0, 0x0E, 0x38,
+  0x03, 0xC7, 0x80, 0x78, 0x78, 0x3E, 0x07, 0xFF, 0x80, 0x7F, 0xE0, 0x3F,
+  0xFE, 0x0F, 0x81, 0xE3, 0xC0, 0x1E, 0x78, 0x01, 0xEE, 0x00, 0x3F, 0xC0,
+  0x03, 0xF8, 0x00, 0x77, 0x00, 0x1E, 0xF0, 0x03, 0xDF, 0x00, 0xF1, 0xF0,
+  0x7E, 0x1F, 0xFF, 0x81, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x01,
+  0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC3, 0xC0, 0x78, 0xF0, 0x07, 0x9C,
+  0x00, 0x73, 0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3D, 0xC0, 0x07, 0xBC,
+  0x01, 0xF7, 0x80, 0x3E, 0x7C, 0x1F, 0xC7, 0xFF, 0xF8, 0x7F, 0xEF, 0x03,
+  0xF1, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x00, 0xE7, 0x80, 0x3C, 0xF0,
+  0x07, 0x0F, 0x01, 0xE1, 0xF0, 0xF8, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x0F,
+  0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xF0, 0x80, 0x00, 0x1C, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00,
+  0x3C, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xF8,
+  0x03, 0xF8, 0x00, 0xFC, 0x00, 0x1E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07,
+  0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0x83, 0xE7, 0x80, 0xF7, 0x80, 0x3F,
+  0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x01,
+  0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x00,
+  0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xF7, 0x00, 0x01, 0xE7, 0x80, 0x01, 0xE7,
+  0x80, 0x01, 0xC3, 0x80, 0x03, 0xC3, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0x81,
+  0xC0, 0x07, 0x81, 0xE0, 0x07, 0x81, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xF8, 0x1C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x38, 0x00,
+  0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1,
+  0xE0, 0x0F, 0xCF, 0x00, 0x1F, 0x78, 0x00, 0x7B, 0xC0, 0x03, 0xDE, 0x00,
+  0x1E, 0xF0, 0x00, 0xF7, 0x80, 0x07, 0xBC, 0x00, 0x3D, 0xE0, 0x03, 0xCF,
+  0x00, 0x7C, 0x7F, 0xFF, 0xC3, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0xF0, 0x01,
+  0xF7, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x0F,
+  0xBF, 0xFF, 0xF9, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80,
+  0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x1F, 0xC1, 0xF8, 0x1F, 0x00, 0x7C,
+  0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0E,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x3E, 0x1F, 0x00, 0x7C,
+  0x1F, 0xC1, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x00,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0x80, 0x3F, 0x0F,
+  0x00, 0x1F, 0x1E, 0x00, 0x1F, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0xF0,
+  0x00, 0x3D, 0xE0, 0x00, 0x3B, 0xC0, 0x00, 0x77, 0x80, 0x00, 0xFF, 0x00,
+  0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
+  0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x77, 0x80, 0x00, 0xEF, 0x00, 0x03,
+  0xDE, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0x78, 0x00, 0x7C, 0xF0, 0x01, 0xF1,
+  0xE0, 0x0F, 0xC3, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xE0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xFF,
+  0xF3, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01,
+  0xFF, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0xFC, 0xF0, 0x00, 0x1E, 0x00, 0x03,
+  0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07,
+  0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x80,
+  0x3F, 0x87, 0xF8, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x03, 0xC3, 0xC0, 0x00,
+  0xF1, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E,
+  0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xDE, 0x00,
+  0x01, 0xF7, 0xC0, 0x00, 0x7C, 0xF8, 0x00, 0x3F, 0x1F, 0x00, 0x3F, 0xC3,
+  0xF8, 0x3F, 0xF0, 0x7F, 0xFF, 0x9C, 0x0F, 0xFF, 0xC7, 0x00, 0x7F, 0xC1,
+  0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
+  0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0,
+  0x0F, 0x70, 0x0F, 0x78, 0x0F, 0x7C, 0x3E, 0x3F, 0xFE, 0x1F, 0xF8, 0x07,
+  0xE0, 0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xF3, 0xC0, 0x03, 0xC7, 0x80, 0x0F,
+  0x0F, 0x00, 0x3C, 0x1E, 0x00, 0xF0, 0x3C, 0x03, 0xC0, 0x78, 0x0F, 0x00,
+  0xF0, 0x3C, 0x01, 0xE0, 0xF0, 0x03, 0xC3, 0xC0, 0x07, 0x8F, 0x00, 0x0F,
+  0x3F, 0x00, 0x1E, 0xFE, 0x00, 0x3F, 0xDE, 0x00, 0x7F, 0x3E, 0x00, 0xFC,
+  0x3C, 0x01, 0xF0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x0F, 0x00,
+  0x78, 0x1E, 0x00, 0xF8, 0x3C, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0xF0, 0x01,
+  0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x01, 0xE7, 0x80, 0x03, 0xEF, 0x00, 0x03,
+  0xC0, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF,
+  0xFC, 0x00, 0x1D, 0xFF, 0x80, 0x03, 0xBF, 0xF8, 0x00, 0xF7, 0xF7, 0x00,
+  0x1C, 0xFE, 0xE0, 0x03, 0x9F, 0xDE, 0x00, 0xF3, 0xF9, 0xC0, 0x1C, 0x7F,
+  0x38, 0x03, 0x8F, 0xE7, 0x80, 0xF1, 0xFC, 0x70, 0x1C, 0x3F, 0x8E, 0x03,
+  0x87, 0xF1, 0xE0, 0x70, 0xFE, 0x1C, 0x1C, 0x1F, 0xC3, 0x83, 0x83, 0xF8,
+  0x38, 0x70, 0x7F, 0x07, 0x1C, 0x0F, 0xE0, 0xE3, 0x81, 0xFC, 0x0E, 0x70,
+  0x3F, 0x81, 0xDC, 0x07, 0xF0, 0x3B, 0x80, 0xFE, 0x03, 0xF0, 0x1F, 0xC0,
+  0x7C, 0x03, 0xF8, 0x0F, 0x80, 0x7F, 0x00, 0xF0, 0x0E, 0xF0, 0x00, 0x1F,
+  0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC,
+  0x00, 0x7F, 0xF0, 0x01, 0xFD, 0xE0, 0x07, 0xF7, 0x80, 0x1F, 0xCF, 0x00,
+  0x7F, 0x1E, 0x01, 0xFC, 0x78, 0x07, 0xF0, 0xF0, 0x1F, 0xC1, 0xE0, 0x7F,
+  0x07, 0x81, 0xFC, 0x0F, 0x07, 0xF0, 0x3C, 0x1F, 0xC0, 0x78, 0x7F, 0x00,
+  0xF1, 0xFC, 0x03, 0xC7, 0xF0, 0x07, 0x9F, 0xC0, 0x0F, 0x7F, 0x00, 0x3D,
+  0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFC,
+  0x00, 0x1F, 0xF0, 0x00, 0x3C, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xFE, 0x00,
+  0x1F, 0xFF, 0xF0, 0x07, 0xF0, 0x7F, 0x01, 0xF0, 0x03, 0xF0, 0x7C, 0x00,
+  0x1E, 0x1F, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x1E, 0x78, 0x00, 0x03, 0xDE,
+  0x00, 0x00, 0x3B, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0,
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00,
+  0xE7, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x07, 0x8F, 0x00, 0x01, 0xE1, 0xF0,
+  0x00, 0x7C, 0x1F, 0x00, 0x3F, 0x01, 0xFC, 0x1F, 0xC0, 0x1F, 0xFF, 0xF0,
+  0x00, 0xFF, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xF9, 0xE0, 0x0F, 0xCF, 0x00, 0x1F, 0x78, 0x00, 0x7B, 0xC0,
+  0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
+  0xE0, 0x01, 0xEF, 0x00, 0x1F, 0x78, 0x03, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xF0,
+  0x7F, 0x01, 0xF0, 0x03, 0xF0, 0x7C, 0x00, 0x1F, 0x1F, 0x00, 0x01, 0xE3,
+  0xC0, 0x00, 0x1E, 0x78, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x3B, 0xC0, 0x00,
+  0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x3C, 0xF0,
+  0x01, 0x87, 0x8F, 0x00, 0x7D, 0xE1, 0xF0, 0x07, 0xF8, 0x1F, 0x00, 0x3F,
+  0x01, 0xFC, 0x1F, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0xFB, 0xE0, 0x07,
+  0xF8, 0x1C, 0x00, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC3,
+  0xFF, 0xFF, 0xC7, 0x80, 0x0F, 0xCF, 0x00, 0x07, 0x9E, 0x00, 0x07, 0xBC,
+  0x00, 0x0F, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xC0,
+  0x00, 0xF7, 0x80, 0x03, 0xCF, 0x00, 0x0F, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
+  0xF0, 0x7F, 0xFF, 0xF0, 0xF0, 0x01, 0xF1, 0xE0, 0x00, 0xF3, 0xC0, 0x01,
+  0xE7, 0x80, 0x01, 0xCF, 0x00, 0x03, 0x9E, 0x00, 0x07, 0x3C, 0x00, 0x0E,
+  0x78, 0x00, 0x1C, 0xF0, 0x00, 0x39, 0xE0, 0x00, 0x7B, 0xC0, 0x00, 0xF7,
+  0x80, 0x01, 0xEF, 0x00, 0x03, 0xE0, 0x01, 0xFE, 0x00, 0x3F, 0xFE, 0x01,
+  0xFF, 0xFE, 0x0F, 0xC0, 0xFC, 0x3C, 0x00, 0xF1, 0xE0, 0x01, 0xE7, 0x80,
+  0x07, 0x9C, 0x00, 0x0E, 0x70, 0x00, 0x39, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+  0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFE, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x03, 0xDE, 0x00, 0x0F,
+  0x7C, 0x00, 0x78, 0xFE, 0x0F, 0xE1, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x01,
+  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
+  0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0,
+  0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00,
+  0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03,
+  0x80, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+  0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xDE, 0x00, 0x1E, 0x7C, 0x00, 0xF8, 0xFE,
+  0x1F, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0x78, 0x00, 0x1C, 0x78, 0x00,
+  0x3C, 0x38, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x3C, 0x00, 0x78, 0x1C, 0x00,
+  0x78, 0x1E, 0x00, 0x70, 0x1E, 0x00, 0xF0, 0x0E, 0x00, 0xF0, 0x0F, 0x00,
+  0xE0, 0x0F, 0x01, 0xE0, 0x07, 0x01, 0xE0, 0x07, 0x81, 0xC0, 0x07, 0x83,
+  0xC0, 0x03, 0x83, 0xC0, 0x03, 0xC3, 0x80, 0x03, 0xC7, 0x80, 0x01, 0xE7,
+  0x80, 0x01, 0xE7, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C,
+  0x00, 0xF0, 0x01, 0xE0, 0x01, 0xFE, 0x00, 0x3E, 0x00, 0x3F, 0xC0, 0x07,
+  0xC0, 0x0F, 0x78, 0x01, 0xF8, 0x01, 0xE7, 0x80, 0x3F, 0x80, 0x3C, 0xF0,
+  0x07, 0xF0, 0x07, 0x9E, 0x00, 0xEE, 0x00, 0xE3, 0xC0, 0x3D, 0xC0, 0x3C,
+  0x3C, 0x07, 0x3C, 0x07, 0x87, 0x80, 0xE7, 0x80, 0xF0, 0xF0, 0x1C, 0x70,
+  0x1C, 0x1E, 0x07, 0x8E, 0x07, 0x81, 0xE0, 0xE1, 0xE0, 0xF0, 0x3C, 0x1C,
+  0x1C, 0x1E, 0x07, 0x87, 0x83, 0x83, 0x80, 0xF0, 0xF0, 0x78, 0x70, 0x0E,
+  0x1C, 0x0F, 0x1E, 0x01, 0xE3, 0x80, 0xE3, 0xC0, 0x3C, 0xF0, 0x1C, 0x70,
+  0x07, 0x9C, 0x03, 0xCE, 0x00, 0x73, 0x80, 0x3B, 0xC0, 0x0F, 0x70, 0x07,
+  0x78, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x03, 0xF0,
+  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00,
+  0xF0, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0xBC,
+  0x00, 0x07, 0x9F, 0x00, 0x07, 0x87, 0x80, 0x03, 0xC3, 0xE0, 0x03, 0xC0,
+  0xF0, 0x03, 0xE0, 0x3C, 0x01, 0xE0, 0x1F, 0x01, 0xE0, 0x07, 0x80, 0xF0,
+  0x01, 0xE0, 0xF0, 0x00, 0xF0, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x1F, 0x78,
+  0x00, 0x07, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x01, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xC0,
+  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+  0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x03, 0xF8, 0x03, 0xFF, 0xC0, 0xFF, 0xFC, 0x1E, 0x07,
+  0xC7, 0x80, 0x78, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x0F,
+  0x80, 0x7F, 0xF0, 0x7F, 0xFE, 0x3F, 0xC1, 0xC7, 0x80, 0x39, 0xE0, 0x07,
+  0x3C, 0x00, 0xE7, 0x80, 0x3C, 0xF0, 0x0F, 0x8F, 0x03, 0xF1, 0xFF, 0xEF,
+  0x9F, 0xF9, 0xF0, 0xFC, 0x1E, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00,
+  0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF1, 0xF8, 0x1E, 0xFF, 0xC3, 0xFF, 0xFC, 0x7F, 0x0F, 0xCF, 0xC0, 0x79,
+  0xF0, 0x07, 0xBC, 0x00, 0xF7, 0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xBC, 0x00, 0xF7,
+  0xC0, 0x1E, 0xFC, 0x07, 0x9F, 0xC3, 0xF3, 0xFF, 0xFC, 0x73, 0xFF, 0x0E,
+  0x1F, 0x80, 0x03, 0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0xF8, 0x3C, 0x3C,
+  0x07, 0x9E, 0x00, 0xE7, 0x00, 0x3B, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF7, 0x00, 0x39,
+  0xE0, 0x0E, 0x78, 0x07, 0x8F, 0x83, 0xC1, 0xFF, 0xF0, 0x3F, 0xF0, 0x03,
+  0xF8, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
+  0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x03, 0xF1, 0xE1,
+  0xFF, 0xBC, 0x7F, 0xFF, 0x9F, 0x07, 0xF7, 0xC0, 0x7E, 0xF0, 0x07, 0xDC,
+  0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
+  0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xDC, 0x00, 0x7B, 0xC0, 0x1F, 0x7C,
+  0x07, 0xE7, 0xC1, 0xFC, 0x7F, 0xFF, 0x87, 0xFF, 0x70, 0x3F, 0xCE, 0x00,
+  0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC3,
+  0xC0, 0x78, 0xF0, 0x07, 0x9C, 0x00, 0x73, 0x80, 0x0E, 0xF0, 0x01, 0xDF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE0, 0x00, 0x1C,
+  0x00, 0x73, 0xC0, 0x1E, 0x78, 0x03, 0xC7, 0xC1, 0xF0, 0x7F, 0xFC, 0x07,
+  0xFF, 0x00, 0x3F, 0x80, 0x07, 0x8F, 0xC7, 0xE3, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0xFF, 0xFF, 0xFF, 0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
+  0xC0, 0x03, 0xF1, 0xC3, 0xFF, 0x71, 0xFF, 0xFC, 0xF8, 0x7F, 0x3C, 0x07,
+  0xDE, 0x00, 0xF7, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
+  0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x77, 0x00, 0x3D, 0xE0,
+  0x0F, 0x7C, 0x07, 0xCF, 0x83, 0xF1, 0xFF, 0xDC, 0x3F, 0xE7, 0x03, 0xE1,
+  0xC0, 0x00, 0x77, 0x00, 0x3D, 0xC0, 0x0E, 0x78, 0x07, 0x8F, 0x03, 0xC1,
+  0xFF, 0xF0, 0x3F, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+  0xF1, 0xF8, 0x7B, 0xFF, 0x3F, 0xFF, 0xDF, 0xC1, 0xEF, 0x80, 0x7F, 0xC0,
+  0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE,
+  0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07,
+  0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x78, 0xFF, 0xF0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x0F, 0x3C, 0x07, 0x8F, 0x03, 0xC3, 0xC1, 0xE0, 0xF0,
+  0xF0, 0x3C, 0x78, 0x0F, 0x3C, 0x03, 0xDE, 0x00, 0xFF, 0xC0, 0x3F, 0xF8,
+  0x0F, 0xDE, 0x03, 0xE3, 0xC0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x03, 0xC3,
+  0xC0, 0xF0, 0xF0, 0x1E, 0x3C, 0x03, 0xCF, 0x00, 0xF3, 0xC0, 0x1E, 0xF0,
+  0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1C, 0x7E, 0x07, 0xE3,
+  0x9F, 0xF1, 0xFF, 0x77, 0xFF, 0x7F, 0xFF, 0xC1, 0xFC, 0x1F, 0xF0, 0x1F,
+  0x01, 0xFC, 0x03, 0xC0, 0x3F, 0x80, 0x78, 0x07, 0xF0, 0x0F, 0x00, 0xFE,
+  0x01, 0xE0, 0x1F, 0xC0, 0x3C, 0x03, 0xF8, 0x07, 0x80, 0x7F, 0x00, 0xF0,
+  0x0F, 0xE0, 0x1E, 0x01, 0xFC, 0x03, 0xC0, 0x3F, 0x80, 0x78, 0x07, 0xF0,
+  0x0F, 0x00, 0xFE, 0x01, 0xE0, 0x1F, 0xC0, 0x3C, 0x03, 0xF8, 0x07, 0x80,
+  0x7F, 0x00, 0xF0, 0x0F, 0xE0, 0x1E, 0x01, 0xC0, 0x00, 0x00, 0x71, 0xFC,
+  0x39, 0xFF, 0x9D, 0xFF, 0xEF, 0xE0, 0xF7, 0xC0, 0x3F, 0xE0, 0x1F, 0xE0,
+  0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
+  0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01,
+  0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3C, 0x03, 0xF8, 0x01, 0xFF, 0xC0,
+  0x7F, 0xFC, 0x1F, 0x07, 0xC7, 0xC0, 0x78, 0xF0, 0x07, 0x9C, 0x00, 0x77,
+  0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xE0, 0x03, 0x9C, 0x00, 0x73, 0xC0, 0x1E, 0x7C, 0x07, 0x87,
+  0xC1, 0xF0, 0x7F, 0xFC, 0x07, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1C,
+  0x7F, 0x03, 0x9F, 0xF8, 0x77, 0xFF, 0x8F, 0xE1, 0xF9, 0xF8, 0x0F, 0x3E,
+  0x00, 0xF7, 0x80, 0x1E, 0xF0, 0x01, 0xDE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
+  0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x77, 0x80, 0x1E, 0xF8,
+  0x03, 0xDF, 0x80, 0xF3, 0xF8, 0x3E, 0x7F, 0xFF, 0x8F, 0x7F, 0xE1, 0xE3,
+  0xF0, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xE1,
+  0xFF, 0x9C, 0x7F, 0xFB, 0x9F, 0x07, 0xF3, 0xC0, 0x7E, 0xF0, 0x07, 0xDC,
+  0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
+  0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xDC, 0x00, 0x7B, 0xC0, 0x1F, 0x7C,
+  0x07, 0xE7, 0xC1, 0xFC, 0x7F, 0xFF, 0x87, 0xFE, 0xF0, 0x3F, 0x1E, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0xE1, 0xF9, 0xFE, 0x7F, 0xBF, 0xFC,
+  0x3E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x07, 0xF0, 0x0F,
+  0xFE, 0x0F, 0xFF, 0x8F, 0x83, 0xE7, 0x80, 0xF3, 0x80, 0x39, 0xC0, 0x00,
+  0xF0, 0x00, 0x7E, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x01,
+  0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x0F, 0x78, 0x07, 0xBE, 0x0F, 0x8F,
+  0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0x00, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE3, 0xFF, 0xFF, 0xFF, 0x8E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1F, 0x8F, 0xC3,
+  0xE0, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
+  0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01,
+  0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x1F, 0xF0,
+  0x0F, 0xBC, 0x1F, 0xDF, 0xFE, 0xE7, 0xFF, 0x70, 0xFE, 0x38, 0x00, 0x00,
+  0x70, 0x01, 0xEF, 0x00, 0x39, 0xE0, 0x0F, 0x1C, 0x01, 0xE3, 0xC0, 0x38,
+  0x78, 0x0F, 0x07, 0x01, 0xE0, 0xE0, 0x38, 0x1E, 0x0F, 0x01, 0xC1, 0xC0,
+  0x38, 0x38, 0x07, 0x8F, 0x00, 0x71, 0xC0, 0x0E, 0x38, 0x01, 0xEF, 0x00,
+  0x1D, 0xC0, 0x03, 0xB8, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+  0x1E, 0x00, 0x70, 0x0F, 0x00, 0xF7, 0x00, 0xF0, 0x0E, 0x78, 0x1F, 0x80,
+  0xE7, 0x81, 0xF8, 0x1E, 0x38, 0x1F, 0x81, 0xE3, 0x81, 0xF8, 0x1C, 0x3C,
+  0x1F, 0xC1, 0xC1, 0xC3, 0x9C, 0x3C, 0x1C, 0x39, 0xC3, 0x81, 0xC3, 0x9C,
+  0x38, 0x1E, 0x39, 0xE3, 0x80, 0xE7, 0x0E, 0x78, 0x0E, 0x70, 0xE7, 0x00,
+  0xE7, 0x0E, 0x70, 0x0F, 0x70, 0xF7, 0x00, 0x7E, 0x07, 0xE0, 0x07, 0xE0,
+  0x7E, 0x00, 0x7E, 0x07, 0xE0, 0x03, 0xE0, 0x7E, 0x00, 0x3C, 0x03, 0xC0,
+  0x03, 0xC0, 0x3C, 0x00, 0x78, 0x03, 0xCE, 0x01, 0xE3, 0xC0, 0x70, 0x78,
+  0x3C, 0x0E, 0x1E, 0x03, 0xC7, 0x00, 0x7B, 0xC0, 0x0E, 0xE0, 0x03, 0xF0,
+  0x00, 0x7C, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x03, 0xF8, 0x01, 0xEE, 0x00,
+  0x73, 0xC0, 0x3C, 0x78, 0x1E, 0x0E, 0x07, 0x03, 0xC3, 0xC0, 0x79, 0xE0,
+  0x1E, 0x70, 0x03, 0xC0, 0x70, 0x01, 0xDC, 0x00, 0xF7, 0x80, 0x38, 0xE0,
+  0x0E, 0x38, 0x07, 0x8F, 0x01, 0xC1, 0xC0, 0xF0, 0x70, 0x3C, 0x1E, 0x0E,
+  0x03, 0x87, 0x80, 0xE1, 0xC0, 0x3C, 0x70, 0x07, 0x3C, 0x01, 0xCE, 0x00,
+  0x7B, 0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x03, 0x80,
+  0x01, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0xFF,
+  0x3F, 0xFF, 0x9F, 0xFF, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01,
+  0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x03, 0xFC, 0x79, 0xEE, 0x06, 0xC0,
+  0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xE0, 0x67, 0x1E, 0x3F, 0xC1, 0xF0, 0x1F,
+  0x83, 0xFC, 0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0x00, 0x70, 0x0E, 0x01,
+  0xC0, 0x78, 0x1E, 0x03, 0xC0, 0x70, 0x0E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF,
+  0xF0 };
+
+const GFXglyph FreeSans_subset_20pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
+  {     1,   3,  29,  13,    5,  -28 },   // 0x21 '!'
+  {    12,  33,  27,  35,    1,  -26 },   // 0x25 '%'
+  {   124,   4,  10,   8,    2,  -26 },   // 0x27 '''
+  {   129,   8,  37,  13,    3,  -28 },   // 0x28 '('
+  {   166,   9,  37,  13,    1,  -28 },   // 0x29 ')'
+  {   208,  19,  19,  23,    2,  -18 },   // 0x2B '+'
+  {   254,   5,  10,  11,    3,   -3 },   // 0x2C ','
+  {   261,   9,   3,  13,    2,  -11 },   // 0x2D '-'
+  {   265,   4,   4,  10,    3,   -3 },   // 0x2E '.'
+  {   267,  11,  29,  11,    0,  -28 },   // 0x2F '/'
+  {   307,  18,  27,  22,    2,  -26 },   // 0x30 '0'
+  {   368,  10,  27,  22,    4,  -26 },   // 0x31 '1'
+  {   402,  19,  27,  22,    1,  -26 },   // 0x32 '2'
+  {   467,  19,  27,  22,    1,  -26 },   // 0x33 '3'
+  {   532,  19,  27,  22,    1,  -26 },   // 0x34 '4'
+  {   597,  19,  27,  22,    1,  -26 },   // 0x35 '5'
+  {   662,  18,  27,  22,    2,  -26 },   // 0x36 '6'
+  {   723,  18,  27,  22,    2,  -26 },   // 0x37 '7'
+  {   784,  19,  27,  22,    1,  -26 },   // 0x38 '8'
+  {   849,  19,  27,  22,    1,  -26 },   // 0x39 '9'
+  {   914,   4,  21,  10,    3,  -20 },   // 0x3A ':'
+  {   925,  19,  19,  23,    2,  -18 },   // 0x3E '>'
+  {   971,  17,  29,  22,    3,  -28 },   // 0x3F '?'
+  {  1033,  24,  29,  26,    1,  -28 },   // 0x41 'A'
+  {  1120,  21,  29,  26,    3,  -28 },   // 0x42 'B'
+  {  1197,  24,  29,  28,    2,  -28 },   // 0x43 'C'
+  {  1284,  23,  29,  27,    3,  -28 },   // 0x44 'D'
+  {  1368,  21,  29,  25,    3,  -28 },   // 0x45 'E'
+  {  1445,  19,  29,  23,    3,  -28 },   // 0x46 'F'
+  {  1514,  26,  30,  30,    2,  -28 },   // 0x47 'G'
+  {  1612,  22,  29,  28,    3,  -28 },   // 0x48 'H'
+  {  1692,   4,  29,  11,    4,  -28 },   // 0x49 'I'
+  {  1707,  16,  29,  21,    1,  -28 },   // 0x4A 'J'
+  {  1765,  23,  29,  26,    3,  -28 },   // 0x4B 'K'
+  {  1849,  18,  29,  22,    3,  -28 },   // 0x4C 'L'
+  {  1915,  27,  29,  33,    3,  -28 },   // 0x4D 'M'
+  {  2013,  22,  29,  29,    3,  -28 },   // 0x4E 'N'
+  {  2093,  27,  29,  31,    2,  -28 },   // 0x4F 'O'
+  {  2191,  21,  29,  26,    3,  -28 },   // 0x50 'P'
+  {  2268,  27,  30,  31,    2,  -28 },   // 0x51 'Q'
+  {  2370,  23,  29,  28,    3,  -28 },   // 0x52 'R'
+  {  2454,  22,  29,  26,    2,  -28 },   // 0x53 'S'
+  {  2534,  23,  29,  25,    1,  -28 },   // 0x54 'T'
+  {  2618,  22,  29,  28,    3,  -28 },   // 0x55 'U'
+  {  2698,  24,  29,  25,    1,  -28 },   // 0x56 'V'
+  {  2785,  35,  29,  37,    1,  -28 },   // 0x57 'W'
+  {  2912,  25,  29,  27,    1,  -28 },   // 0x59 'Y'
+  {  3003,  22,  29,  24,    1,  -28 },   // 0x5A 'Z'
+  {  3083,   8,  37,  11,    2,  -28 },   // 0x5B '['
+  {  3120,   7,  37,  11,    1,  -28 },   // 0x5D ']'
+  {  3153,  24,   2,  22,   -1,    6 },   // 0x5F '_'
+  {  3159,  19,  21,  21,    1,  -20 },   // 0x61 'a'
+  {  3209,  19,  29,  22,    2,  -28 },   // 0x62 'b'
+  {  3278,  18,  21,  20,    1,  -20 },   // 0x63 'c'
+  {  3326,  19,  30,  22,    1,  -28 },   // 0x64 'd'
+  {  3398,  19,  21,  21,    1,  -20 },   // 0x65 'e'
+  {  3448,   9,  29,  11,    1,  -28 },   // 0x66 'f'
+  {  3481,  18,  29,  22,    1,  -20 },   // 0x67 'g'
+  {  3547,  17,  29,  21,    2,  -28 },   // 0x68 'h'
+  {  3609,   3,  29,   9,    3,  -28 },   // 0x69 'i'
+  {  3620,  18,  29,  20,    2,  -28 },   // 0x6B 'k'
+  {  3686,   4,  29,   8,    2,  -28 },   // 0x6C 'l'
+  {  3701,  27,  22,  32,    2,  -21 },   // 0x6D 'm'
+  {  3776,  17,  22,  21,    2,  -21 },   // 0x6E 'n'
+  {  3823,  19,  21,  21,    1,  -20 },   // 0x6F 'o'
+  {  3873,  19,  30,  22,    2,  -21 },   // 0x70 'p'
+  {  3945,  19,  29,  22,    1,  -20 },   // 0x71 'q'
+  {  4014,  10,  21,  13,    2,  -20 },   // 0x72 'r'
+  {  4041,  17,  21,  19,    1,  -20 },   // 0x73 's'
+  {  4086,   9,  27,  11,    1,  -26 },   // 0x74 't'
+  {  4117,  17,  22,  21,    2,  -20 },   // 0x75 'u'
+  {  4164,  19,  21,  19,    0,  -20 },   // 0x76 'v'
+  {  4214,  28,  21,  28,    0,  -20 },   // 0x77 'w'
+  {  4288,  18,  21,  19,    0,  -20 },   // 0x78 'x'
+  {  4336,  18,  29,  19,    0,  -20 },   // 0x79 'y'
+  {  4402,  17,  21,  19,    1,  -20 },   // 0x7A 'z'
+  {  4447,   2,  37,  10,    4,  -28 },   // 0x7C '|'
+  {  4457,  12,  12,  24,    6,  -26 },   // 0xB0 ''
+  {  4475,  12,  17,  14,    1,  -31 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_20pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_20pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_20pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_20pt8bGlyphs,
+  0x20, 0x6F, 47 };
+
+// Approx. 5292 bytes
@@ -0,0 +1,568 @@
+const uint8_t FreeSans_subset_22pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x76, 0x66,
+  0x66, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x00,
+  0x0E, 0x00, 0x1F, 0xF0, 0x00, 0xE0, 0x03, 0xFF, 0x80, 0x1C, 0x00, 0x7C,
+  0x7C, 0x01, 0xC0, 0x07, 0x01, 0xC0, 0x38, 0x00, 0xF0, 0x1E, 0x03, 0x80,
+  0x0E, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x0E, 0x07, 0x00, 0x0E, 0x00, 0xE0,
+  0xE0, 0x00, 0xF0, 0x1E, 0x0C, 0x00, 0x07, 0x01, 0xC1, 0xC0, 0x00, 0x7C,
+  0x3C, 0x18, 0x00, 0x03, 0xFF, 0x83, 0x80, 0x00, 0x1F, 0xF0, 0x30, 0x00,
+  0x00, 0x7C, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E,
+  0x03, 0xE0, 0x00, 0x01, 0xC0, 0xFF, 0x80, 0x00, 0x1C, 0x1F, 0xFC, 0x00,
+  0x03, 0x83, 0xE1, 0xE0, 0x00, 0x38, 0x38, 0x0E, 0x00, 0x07, 0x03, 0x80,
+  0x70, 0x00, 0x70, 0x70, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x70, 0x00, 0xE0,
+  0x70, 0x07, 0x00, 0x1C, 0x03, 0x80, 0x70, 0x01, 0x80, 0x38, 0x0E, 0x00,
+  0x38, 0x03, 0xE1, 0xE0, 0x03, 0x00, 0x1F, 0xFC, 0x00, 0x70, 0x00, 0xFF,
+  0x80, 0x0E, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x77, 0x76, 0x60, 0x01,
+  0x80, 0xE0, 0x70, 0x1C, 0x0E, 0x03, 0x81, 0xC0, 0x70, 0x3C, 0x0E, 0x03,
+  0x81, 0xE0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x1C, 0x07, 0x01, 0xC0, 0x78, 0x0E,
+  0x03, 0x80, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x38, 0x06, 0x01, 0xC0, 0x30,
+  0x0E, 0x01, 0xC0, 0xC0, 0x70, 0x1C, 0x06, 0x03, 0x81, 0xC0, 0x70, 0x38,
+  0x0E, 0x07, 0x03, 0x81, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0x07, 0x83, 0xC1,
+  0xE0, 0xF0, 0x38, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xC0, 0xE0, 0x70,
+  0x78, 0x38, 0x1C, 0x1C, 0x0E, 0x07, 0x07, 0x03, 0x83, 0x81, 0x81, 0xC0,
+  0xC0, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x00,
+  0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03,
+  0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFF,
+  0x33, 0x33, 0x7E, 0x80, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x00,
+  0x30, 0x07, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x1C, 0x01,
+  0xC0, 0x18, 0x01, 0x80, 0x38, 0x03, 0x00, 0x30, 0x07, 0x00, 0x60, 0x06,
+  0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x18, 0x03, 0x80, 0x30,
+  0x03, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x0C, 0x00, 0x01,
+  0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x01, 0xF9, 0xF8, 0x3E, 0x07, 0xC3,
+  0xC0, 0x3C, 0x78, 0x03, 0xC7, 0x80, 0x1E, 0x78, 0x01, 0xEF, 0x00, 0x1E,
+  0xF0, 0x00, 0xEF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0xF0, 0x01, 0xE7, 0x80, 0x1E, 0x78,
+  0x01, 0xE7, 0x80, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x7C, 0x1F, 0x0F, 0x80,
+  0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0xE0, 0x1C, 0x03, 0x80,
+  0xF0, 0x3E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x3F, 0x9F,
+  0xC1, 0xE0, 0x1F, 0x1E, 0x00, 0x78, 0xF0, 0x03, 0xEF, 0x00, 0x0F, 0x78,
+  0x00, 0x7B, 0xC0, 0x03, 0xDE, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
+  0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x00,
+  0x7C, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xF0, 0x3F, 0x1F, 0x83, 0xE0,
+  0x3E, 0x1E, 0x00, 0xF1, 0xE0, 0x03, 0xCF, 0x00, 0x1E, 0x78, 0x00, 0xF3,
+  0xC0, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x07,
+  0xE0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0x00,
+  0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3F, 0xC0, 0x01,
+  0xFE, 0x00, 0x0F, 0x78, 0x00, 0x7B, 0xC0, 0x07, 0x9E, 0x00, 0x3C, 0x78,
+  0x03, 0xE3, 0xFD, 0xFE, 0x0F, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x3F, 0x80,
+  0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x01,
+  0xF8, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x0E, 0xF0, 0x00, 0xF7, 0x80,
+  0x0F, 0x3C, 0x00, 0x71, 0xE0, 0x07, 0x8F, 0x00, 0x78, 0x78, 0x07, 0x83,
+  0xC0, 0x38, 0x1E, 0x03, 0xC0, 0xF0, 0x3C, 0x07, 0x81, 0xC0, 0x3C, 0x1E,
+  0x01, 0xE1, 0xE0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00,
+  0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x0F, 0xFF,
+  0xF0, 0x7F, 0xFF, 0x87, 0xFF, 0xFC, 0x3F, 0xFF, 0xE1, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x01, 0xE0, 0x00,
+  0x0F, 0x00, 0x00, 0x7B, 0xFE, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0xFC,
+  0x1F, 0x87, 0x80, 0x3E, 0x38, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E,
+  0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xFE, 0x00,
+  0x0F, 0x78, 0x00, 0x7B, 0xC0, 0x07, 0x9F, 0x00, 0x3C, 0x7C, 0x07, 0xC3,
+  0xFC, 0xFE, 0x0F, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFC,
+  0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x81, 0xFD, 0xFC, 0x3E, 0x03, 0xC3, 0xC0,
+  0x1E, 0x78, 0x01, 0xE7, 0x80, 0x0E, 0x78, 0x00, 0x07, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF1, 0xFE, 0x0F, 0x7F, 0xF0, 0xFF, 0xFF, 0xCF,
+  0xF0, 0x7C, 0xFC, 0x03, 0xEF, 0x80, 0x1E, 0xF8, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x70, 0x00,
+  0xF7, 0x80, 0x1E, 0x7C, 0x01, 0xE3, 0xE0, 0x3C, 0x1F, 0x9F, 0xC1, 0xFF,
+  0xF8, 0x07, 0xFF, 0x00, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0,
+  0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x01, 0xE0,
+  0x00, 0x1C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x70,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1C,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0x83, 0xF9, 0xFC, 0x7C, 0x07,
+  0xC7, 0x80, 0x3E, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x78, 0x01, 0xE7, 0x80,
+  0x1E, 0x78, 0x01, 0xE7, 0xC0, 0x3C, 0x3E, 0x0F, 0x81, 0xFF, 0xF0, 0x07,
+  0xFE, 0x01, 0xFF, 0xF8, 0x3F, 0x0F, 0xC7, 0xC0, 0x3E, 0xF8, 0x01, 0xEF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF8, 0x01, 0xE7, 0xC0, 0x3E, 0x3F, 0x9F,
+  0xC1, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0xFF,
+  0xE0, 0x1F, 0xFF, 0x03, 0xF1, 0xF8, 0x7C, 0x07, 0xC7, 0x80, 0x3C, 0xF0,
+  0x01, 0xEF, 0x00, 0x1E, 0xF0, 0x00, 0xEF, 0x00, 0x0E, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x01, 0xF7, 0x80, 0x3F,
+  0x7E, 0x0F, 0xF3, 0xFF, 0xFF, 0x1F, 0xFC, 0xF0, 0x7F, 0x8F, 0x00, 0x00,
+  0xF0, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0xF0, 0x01, 0xE7, 0x80,
+  0x3C, 0x78, 0x03, 0xC7, 0xC0, 0x78, 0x3F, 0x3F, 0x81, 0xFF, 0xF0, 0x0F,
+  0xFC, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x07, 0x00, 0x00,
+  0x3F, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
+  0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1E,
+  0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x01, 0xE0, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFE, 0x1F, 0x9F,
+  0xE7, 0xC0, 0x7C, 0xF0, 0x07, 0x9C, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x1F,
+  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x03, 0xC0,
+  0x00, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07,
+  0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0xF7, 0x80, 0x00, 0x3E, 0xF0, 0x00, 0x07, 0x9F, 0x00, 0x00, 0xF1,
+  0xE0, 0x00, 0x3E, 0x3C, 0x00, 0x07, 0x87, 0xC0, 0x00, 0xF0, 0x78, 0x00,
+  0x3C, 0x0F, 0x00, 0x07, 0x81, 0xF0, 0x00, 0xF0, 0x1E, 0x00, 0x3C, 0x03,
+  0xE0, 0x07, 0x80, 0x7C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF8, 0x07,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x07, 0x80, 0x07,
+  0xC1, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x0F, 0x87, 0x80, 0x00, 0xF1, 0xF0,
+  0x00, 0x1E, 0x3C, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x3D, 0xE0, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
+  0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
+  0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00,
+  0x3E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1E, 0xF0, 0x00,
+  0x3E, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFF, 0x00, 0xF8, 0x03, 0xF0, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x01,
+  0xE1, 0xE0, 0x00, 0x3C, 0x78, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x79, 0xE0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
+  0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1E, 0x78, 0x00,
+  0x03, 0xC7, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x3E, 0x0F, 0x80, 0x07, 0xC1,
+  0xFC, 0x03, 0xF0, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0xC7, 0x80, 0x01, 0xF3,
+  0xC0, 0x00, 0x79, 0xE0, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x07,
+  0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x7F, 0xC0, 0x00, 0x3D, 0xE0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0x78,
+  0x00, 0x1F, 0x3C, 0x00, 0x3F, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0x03, 0xC0, 0x00,
+  0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0xF8, 0x0F, 0xC0, 0x1F, 0x81, 0xF0, 0x00, 0x7C, 0x3E,
+  0x00, 0x03, 0xE3, 0xC0, 0x00, 0x1E, 0x7C, 0x00, 0x01, 0xF7, 0x80, 0x00,
+  0x0F, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07,
+  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xF7, 0x80,
+  0x00, 0x0F, 0x7C, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1F, 0x3E, 0x00, 0x03,
+  0xF1, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x1F, 0x70, 0x7F, 0xFF, 0xE7, 0x03,
+  0xFF, 0xFC, 0x70, 0x0F, 0xFF, 0x03, 0x00, 0x3F, 0xC0, 0x00, 0xF0, 0x00,
+  0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+  0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1E, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0x78, 0x03, 0xDE,
+  0x00, 0xF7, 0x80, 0x7D, 0xF0, 0x1E, 0x3F, 0x9F, 0x87, 0xFF, 0xC0, 0xFF,
+  0xE0, 0x0F, 0xE0, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xBC, 0x00, 0x0F,
+  0x9E, 0x00, 0x0F, 0x8F, 0x00, 0x0F, 0x87, 0x80, 0x0F, 0x83, 0xC0, 0x0F,
+  0x81, 0xE0, 0x0F, 0x80, 0xF0, 0x0F, 0x80, 0x78, 0x0F, 0x80, 0x3C, 0x0F,
+  0x80, 0x1E, 0x0F, 0x80, 0x0F, 0x0F, 0x80, 0x07, 0x8F, 0xC0, 0x03, 0xCF,
+  0xF0, 0x01, 0xEF, 0x78, 0x00, 0xFF, 0x1E, 0x00, 0x7F, 0x0F, 0x80, 0x3F,
+  0x03, 0xE0, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0x7C, 0x07, 0x80, 0x1F, 0x03,
+  0xC0, 0x07, 0x81, 0xE0, 0x03, 0xE0, 0xF0, 0x00, 0xF8, 0x78, 0x00, 0x3E,
+  0x3C, 0x00, 0x1F, 0x1E, 0x00, 0x07, 0xCF, 0x00, 0x01, 0xF7, 0x80, 0x00,
+  0x7B, 0xC0, 0x00, 0x3E, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00,
+  0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+  0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x3F,
+  0xFD, 0xE0, 0x00, 0xEF, 0xF7, 0x80, 0x03, 0xBF, 0xCE, 0x00, 0x1E, 0xFF,
+  0x3C, 0x00, 0x73, 0xFC, 0xF0, 0x01, 0xCF, 0xF1, 0xC0, 0x0F, 0x3F, 0xC7,
+  0x80, 0x38, 0xFF, 0x1E, 0x00, 0xE3, 0xFC, 0x38, 0x07, 0x8F, 0xF0, 0xF0,
+  0x1C, 0x3F, 0xC3, 0xC0, 0x70, 0xFF, 0x07, 0x03, 0xC3, 0xFC, 0x1E, 0x0E,
+  0x0F, 0xF0, 0x38, 0x78, 0x3F, 0xC0, 0xE1, 0xE0, 0xFF, 0x03, 0xC7, 0x03,
+  0xFC, 0x07, 0x3C, 0x0F, 0xF0, 0x1C, 0xF0, 0x3F, 0xC0, 0x7B, 0x80, 0xFF,
+  0x00, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xC0, 0x3F, 0xC0,
+  0x1F, 0x00, 0xFF, 0x00, 0x7C, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xFE, 0x00,
+  0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0x3F, 0xDE, 0x00, 0x1F, 0xEF, 0x80, 0x0F, 0xF3, 0xC0, 0x07, 0xF8,
+  0xF0, 0x03, 0xFC, 0x7C, 0x01, 0xFE, 0x1E, 0x00, 0xFF, 0x07, 0x80, 0x7F,
+  0x83, 0xE0, 0x3F, 0xC0, 0xF0, 0x1F, 0xE0, 0x7C, 0x0F, 0xF0, 0x1E, 0x07,
+  0xF8, 0x07, 0x83, 0xFC, 0x03, 0xE1, 0xFE, 0x00, 0xF0, 0xFF, 0x00, 0x3C,
+  0x7F, 0x80, 0x1F, 0x3F, 0xC0, 0x07, 0x9F, 0xE0, 0x01, 0xEF, 0xF0, 0x00,
+  0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x00,
+  0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xC0, 0x1F, 0xC0, 0x7E, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x00,
+  0x00, 0x7C, 0x7C, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x03, 0xE7, 0x80, 0x00,
+  0x07, 0xBC, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x07, 0x9E, 0x00,
+  0x00, 0x1E, 0x7C, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0xC3, 0xE0, 0x00,
+  0x3E, 0x07, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x1F, 0xC0, 0x1F, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF,
+  0x00, 0x07, 0xDE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0,
+  0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00,
+  0x03, 0xFE, 0x00, 0x0F, 0xBF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xF1, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF,
+  0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0x1F,
+  0xC0, 0x7E, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C,
+  0x7C, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x07, 0xBC,
+  0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x01, 0xE7, 0x80, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x3E,
+  0x7C, 0x00, 0x30, 0xF0, 0xF0, 0x01, 0xF7, 0xC3, 0xE0, 0x03, 0xFE, 0x07,
+  0xC0, 0x07, 0xF8, 0x0F, 0xC0, 0x1F, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x3E, 0x00, 0x1F, 0xE0, 0x78, 0x00, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x3F, 0x3C, 0x00,
+  0x07, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x3C, 0xF0, 0x00, 0x0F, 0x3C,
+  0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x3C, 0xF0, 0x00, 0x1E,
+  0x3C, 0x00, 0x1F, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x78, 0xF0,
+  0x00, 0x0F, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x3C,
+  0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x00,
+  0x3C, 0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x7C, 0x00,
+  0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x03, 0xFC, 0xFF, 0x83,
+  0xE0, 0x07, 0xC1, 0xE0, 0x01, 0xF1, 0xF0, 0x00, 0x78, 0xF0, 0x00, 0x3C,
+  0x78, 0x00, 0x0F, 0x3C, 0x00, 0x07, 0x9E, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x03, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF,
+  0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x0F, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xE0,
+  0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0x9E, 0x00, 0x03, 0xCF,
+  0x80, 0x03, 0xE3, 0xF0, 0x03, 0xE0, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x07, 0xF8,
+  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07,
+  0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
+  0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0x78,
+  0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x9F, 0x00, 0x07, 0x87, 0xE0, 0x0F, 0xC1,
+  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0x00,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x79, 0xE0, 0x00,
+  0x1E, 0x7C, 0x00, 0x0F, 0x8F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF0, 0xF8,
+  0x00, 0x78, 0x1E, 0x00, 0x1E, 0x07, 0x80, 0x07, 0x81, 0xF0, 0x03, 0xC0,
+  0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x1E, 0x00, 0x78, 0x07,
+  0x80, 0x1E, 0x01, 0xE0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3C,
+  0x0F, 0x00, 0x07, 0x87, 0x80, 0x01, 0xE1, 0xE0, 0x00, 0x7C, 0x78, 0x00,
+  0x0F, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x1F, 0xE0,
+  0x00, 0x07, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3F, 0xE0, 0x00,
+  0xF8, 0x00, 0x7B, 0xE0, 0x03, 0xF0, 0x00, 0xF3, 0xC0, 0x07, 0xE0, 0x03,
+  0xE7, 0x80, 0x0F, 0xE0, 0x07, 0xCF, 0x00, 0x3F, 0xC0, 0x0F, 0x1F, 0x00,
+  0x7F, 0x80, 0x1E, 0x1E, 0x00, 0xF7, 0x00, 0x3C, 0x3C, 0x01, 0xCF, 0x00,
+  0xF8, 0x78, 0x07, 0x9E, 0x01, 0xE0, 0xF8, 0x0F, 0x1C, 0x03, 0xC0, 0xF0,
+  0x1C, 0x3C, 0x07, 0x81, 0xE0, 0x38, 0x78, 0x1E, 0x03, 0xC0, 0xF0, 0xF0,
+  0x3C, 0x07, 0xC1, 0xE0, 0xE0, 0x78, 0x07, 0x83, 0x81, 0xE0, 0xF0, 0x0F,
+  0x0F, 0x03, 0xC3, 0xC0, 0x1E, 0x1E, 0x07, 0x87, 0x80, 0x3C, 0x3C, 0x07,
+  0x8F, 0x00, 0x3C, 0x70, 0x0F, 0x1E, 0x00, 0x79, 0xE0, 0x1E, 0x38, 0x00,
+  0xF3, 0xC0, 0x1C, 0xF0, 0x01, 0xE7, 0x00, 0x3D, 0xE0, 0x01, 0xFE, 0x00,
+  0x7B, 0xC0, 0x03, 0xFC, 0x00, 0xF7, 0x00, 0x07, 0xF8, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x1F, 0x80,
+  0x03, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0x80,
+  0x00, 0xF8, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x3E, 0x7C, 0x00, 0x07, 0xC3,
+  0xE0, 0x00, 0x78, 0x1E, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0xF0, 0x0F, 0x80,
+  0x1E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x3C, 0x00, 0x3C, 0x07, 0xC0,
+  0x03, 0xE0, 0x78, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x0F,
+  0x9E, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+  0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x01,
+  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F, 0xE3,
+  0xF0, 0x3C, 0x03, 0xE0, 0xE0, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x01, 0xFE, 0x01, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xE0, 0xFF, 0x87, 0x87, 0xE0, 0x1E, 0x1E, 0x00, 0x78, 0xF0, 0x01,
+  0xE3, 0xC0, 0x07, 0x8F, 0x00, 0x1E, 0x3C, 0x00, 0xF8, 0x78, 0x07, 0xE1,
+  0xF0, 0x7F, 0x83, 0xFF, 0xDF, 0xC7, 0xFE, 0x3F, 0x07, 0xE0, 0x7C, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E,
+  0x00, 0x00, 0xE0, 0x00, 0x0E, 0x1F, 0x80, 0xE7, 0xFE, 0x0E, 0xFF, 0xF0,
+  0xFF, 0x1F, 0x8F, 0xC0, 0x7C, 0xF8, 0x03, 0xCF, 0x00, 0x1E, 0xF0, 0x01,
+  0xEF, 0x00, 0x1E, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x1E, 0xF0,
+  0x01, 0xEF, 0x00, 0x1E, 0xF8, 0x03, 0xCF, 0xC0, 0x7C, 0xFF, 0x1F, 0x8E,
+  0xFF, 0xF0, 0xE7, 0xFE, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x7F, 0xF0,
+  0x0F, 0xFF, 0x81, 0xF9, 0xFC, 0x3E, 0x03, 0xC3, 0xC0, 0x1E, 0x78, 0x01,
+  0xE7, 0x80, 0x1E, 0x78, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70,
+  0x00, 0xE7, 0x80, 0x0E, 0x78, 0x01, 0xE3, 0xC0, 0x1E, 0x3E, 0x03, 0xC1,
+  0xF9, 0xFC, 0x0F, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x70, 0x1F, 0x87, 0x07, 0xFE, 0x70, 0xFF, 0xF7, 0x1F,
+  0xCF, 0xF3, 0xE0, 0x3F, 0x3C, 0x01, 0xF7, 0x80, 0x0F, 0x78, 0x00, 0xF7,
+  0x80, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07,
+  0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x77, 0x80, 0x0F, 0x78, 0x00,
+  0xF7, 0x80, 0x0F, 0x3C, 0x01, 0xF3, 0xE0, 0x3F, 0x1F, 0x8F, 0xF0, 0xFF,
+  0xF7, 0x07, 0xFE, 0x70, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03,
+  0xFF, 0xE0, 0x3F, 0x1F, 0x83, 0xE0, 0x3E, 0x1E, 0x00, 0xF1, 0xE0, 0x03,
+  0xCF, 0x00, 0x1E, 0x78, 0x00, 0xF3, 0x80, 0x03, 0xBC, 0x00, 0x1D, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0xC0, 0x07, 0x9E, 0x00, 0x3C, 0x78, 0x03, 0xC3, 0xE0,
+  0x3E, 0x0F, 0xC7, 0xE0, 0x3F, 0xFE, 0x00, 0xFF, 0xE0, 0x01, 0xFC, 0x00,
+  0x03, 0xC3, 0xF1, 0xFC, 0x7C, 0x1E, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x3F,
+  0xFF, 0xFF, 0xFF, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0,
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0x01, 0xF8, 0x00, 0x7F, 0xCF, 0x0F, 0xFE, 0x71,
+  0xF8, 0xF7, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0x78, 0x01, 0xF7, 0x80, 0x0F,
+  0x78, 0x00, 0xF7, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x70, 0x00, 0xF7, 0x80,
+  0x0F, 0x78, 0x01, 0xF3, 0xC0, 0x1F, 0x3E, 0x03, 0xF1, 0xF8, 0xFF, 0x0F,
+  0xFE, 0xF0, 0x7F, 0xCF, 0x01, 0xF0, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0xF7,
+  0x80, 0x1E, 0x7C, 0x01, 0xE3, 0xE0, 0x7C, 0x1F, 0xFF, 0x80, 0xFF, 0xF0,
+  0x03, 0xFC, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
+  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x87, 0xF0, 0xE7, 0xFE, 0x3B,
+  0xFF, 0xCF, 0xE1, 0xFB, 0xF0, 0x1E, 0xF8, 0x07, 0xBC, 0x00, 0xFF, 0x00,
+  0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
+  0x3C, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x0F, 0x9C, 0x03,
+  0xE3, 0x80, 0xF8, 0x70, 0x3E, 0x0E, 0x0F, 0x81, 0xC3, 0xE0, 0x38, 0xF8,
+  0x07, 0x3E, 0x00, 0xEF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x7E, 0xF8,
+  0x0F, 0x8F, 0x01, 0xE1, 0xF0, 0x38, 0x1F, 0x07, 0x01, 0xE0, 0xE0, 0x3E,
+  0x1C, 0x03, 0xC3, 0x80, 0x7C, 0x70, 0x07, 0xCE, 0x00, 0x79, 0xC0, 0x0F,
+  0xB8, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x0F, 0xC7, 0x3F, 0xE1, 0xFF, 0xBB, 0xFF,
+  0x9F, 0xFD, 0xFC, 0x7F, 0xE3, 0xFF, 0x80, 0xFC, 0x07, 0xF8, 0x07, 0xC0,
+  0x3F, 0xC0, 0x1E, 0x00, 0xFC, 0x00, 0xF0, 0x07, 0xE0, 0x07, 0x00, 0x3F,
+  0x00, 0x38, 0x01, 0xF8, 0x01, 0xC0, 0x0F, 0xC0, 0x0E, 0x00, 0x7E, 0x00,
+  0x70, 0x03, 0xF0, 0x03, 0x80, 0x1F, 0x80, 0x1C, 0x00, 0xFC, 0x00, 0xE0,
+  0x07, 0xE0, 0x07, 0x00, 0x3F, 0x00, 0x38, 0x01, 0xF8, 0x01, 0xC0, 0x0F,
+  0xC0, 0x0E, 0x00, 0x7E, 0x00, 0x70, 0x03, 0xF0, 0x03, 0x80, 0x1F, 0x80,
+  0x1C, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0xF8, 0x38, 0xFF, 0x8E, 0x7F,
+  0xF3, 0xB8, 0x7E, 0xFC, 0x07, 0xBE, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
+  0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0x1F, 0x83, 0xE0,
+  0x3E, 0x1E, 0x00, 0xF1, 0xE0, 0x03, 0xCF, 0x00, 0x1E, 0x78, 0x00, 0xF7,
+  0x80, 0x03, 0xBC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00,
+  0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0x78, 0x00, 0xF3, 0xC0, 0x07, 0x9E,
+  0x00, 0x3C, 0x78, 0x03, 0xC3, 0xE0, 0x3E, 0x0F, 0xC7, 0xE0, 0x3F, 0xFE,
+  0x00, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x0E, 0x3F, 0xE0, 0xEF,
+  0xFF, 0x0E, 0xF1, 0xF8, 0xFC, 0x07, 0xCF, 0x80, 0x3C, 0xF8, 0x01, 0xEF,
+  0x00, 0x1E, 0xF0, 0x01, 0xEE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x01,
+  0xEF, 0x00, 0x1E, 0xF0, 0x01, 0xEF, 0x80, 0x3C, 0xFC, 0x07, 0xCF, 0xF1,
+  0xF8, 0xEF, 0xFF, 0x0E, 0x7F, 0xE0, 0xE1, 0xF8, 0x0E, 0x00, 0x00, 0xE0,
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE7, 0x0F, 0xFF,
+  0x71, 0xFC, 0xFF, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0x78, 0x00, 0xF7, 0x80,
+  0x0F, 0x78, 0x00, 0xF7, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
+  0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0x78, 0x00, 0xF7,
+  0x80, 0x0F, 0x78, 0x00, 0xF3, 0xC0, 0x1F, 0x3E, 0x03, 0xF1, 0xF8, 0xFF,
+  0x0F, 0xFF, 0x70, 0x7F, 0xE7, 0x01, 0xF8, 0x70, 0x00, 0x07, 0x00, 0x00,
+  0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x70, 0x01, 0xF9, 0xFE, 0xFF, 0xBF, 0xFE, 0x3E, 0x0F,
+  0x03, 0xC0, 0xF0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x03, 0xF8,
+  0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x8F, 0xC7, 0xC0, 0x78, 0xF0, 0x07,
+  0x9E, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x00,
+  0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x1E,
+  0x00, 0x01, 0xFE, 0x00, 0x3D, 0xE0, 0x07, 0xBC, 0x00, 0xF7, 0xC0, 0x3C,
+  0xFE, 0x3F, 0x8F, 0xFF, 0xE0, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x1C, 0x07,
+  0x01, 0xC0, 0x70, 0x1C, 0x07, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0x01, 0xC0,
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x81, 0xE0, 0x7F, 0x1F, 0xC1, 0xF0,
+  0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
+  0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xFC, 0x3F, 0xDF,
+  0xFE, 0xF3, 0xFF, 0x3C, 0x7F, 0x00, 0x78, 0x00, 0x7B, 0xC0, 0x07, 0x9E,
+  0x00, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x1E, 0x1E, 0x00, 0xF0, 0x78, 0x07,
+  0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0x78, 0x1C, 0x03, 0xC1, 0xE0, 0x1E,
+  0x0F, 0x00, 0x78, 0x70, 0x03, 0xC7, 0x80, 0x1E, 0x38, 0x00, 0x71, 0xC0,
+  0x03, 0xDE, 0x00, 0x1E, 0xE0, 0x00, 0x77, 0x00, 0x03, 0xF8, 0x00, 0x1F,
+  0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x07, 0xC0, 0x3E, 0xF0,
+  0x0F, 0x80, 0x79, 0xE0, 0x1F, 0x00, 0xF3, 0xC0, 0x7F, 0x01, 0xE3, 0xC0,
+  0xFE, 0x07, 0x87, 0x81, 0xDC, 0x0F, 0x0F, 0x03, 0xB8, 0x1E, 0x0E, 0x0F,
+  0x78, 0x3C, 0x1E, 0x1E, 0xF0, 0xF0, 0x3C, 0x38, 0xE1, 0xE0, 0x78, 0x71,
+  0xC3, 0xC0, 0x70, 0xE3, 0xC7, 0x00, 0xF3, 0xC7, 0x9E, 0x01, 0xE7, 0x07,
+  0x3C, 0x01, 0xCE, 0x0E, 0x70, 0x03, 0x9C, 0x1E, 0xE0, 0x07, 0xF8, 0x3F,
+  0xC0, 0x0F, 0xE0, 0x3F, 0x80, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0x80, 0xFC,
+  0x00, 0x3F, 0x01, 0xF8, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x78, 0x03, 0xC0,
+  0x00, 0x78, 0x01, 0xF3, 0xC0, 0x1E, 0x1E, 0x03, 0xC1, 0xE0, 0x38, 0x0F,
+  0x07, 0x80, 0x78, 0xF0, 0x07, 0x8E, 0x00, 0x3D, 0xE0, 0x01, 0xFC, 0x00,
+  0x1F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0xC0,
+  0x03, 0xFE, 0x00, 0x39, 0xE0, 0x07, 0x8F, 0x00, 0xF0, 0xF0, 0x1E, 0x07,
+  0x81, 0xE0, 0x3C, 0x3C, 0x03, 0xC7, 0x80, 0x1E, 0x78, 0x00, 0xF0, 0x70,
+  0x00, 0xF7, 0x80, 0x0F, 0x78, 0x01, 0xE3, 0x80, 0x1E, 0x3C, 0x01, 0xE3,
+  0xC0, 0x3C, 0x1C, 0x03, 0xC1, 0xE0, 0x38, 0x1E, 0x07, 0x80, 0xE0, 0x78,
+  0x0F, 0x07, 0x00, 0xF0, 0xF0, 0x07, 0x0F, 0x00, 0x78, 0xE0, 0x07, 0x9E,
+  0x00, 0x39, 0xE0, 0x03, 0xDC, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x00, 0x1F,
+  0x80, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x03,
+  0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x7F, 0xFF,
+  0xCF, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x1E,
+  0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00,
+  0x1E, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0xFF,
+  0xC3, 0x87, 0x9C, 0x0E, 0x60, 0x19, 0x80, 0x7E, 0x01, 0xD8, 0x06, 0x70,
+  0x38, 0xE1, 0xE3, 0xFF, 0x03, 0xF0, 0x0F, 0xC1, 0xFF, 0x1F, 0x3C, 0xE0,
+  0x7E, 0x03, 0xF0, 0x1C, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x1F, 0x03, 0xF0,
+  0x3E, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0 };
+
+const GFXglyph FreeSans_subset_22pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   4,  31,  14,    5,  -30 },   // 0x21 '!'
+  {    17,  36,  32,  38,    1,  -30 },   // 0x25 '%'
+  {   161,   4,  11,   9,    2,  -30 },   // 0x27 '''
+  {   167,  10,  41,  14,    3,  -30 },   // 0x28 '('
+  {   219,   9,  41,  14,    2,  -30 },   // 0x29 ')'
+  {   266,  21,  21,  25,    2,  -19 },   // 0x2B '+'
+  {   322,   4,  11,  12,    4,   -3 },   // 0x2C ','
+  {   328,  10,   3,  14,    2,  -12 },   // 0x2D '-'
+  {   332,   5,   4,  11,    3,   -3 },   // 0x2E '.'
+  {   335,  12,  32,  12,    0,  -30 },   // 0x2F '/'
+  {   383,  20,  32,  24,    2,  -30 },   // 0x30 '0'
+  {   463,  11,  31,  24,    4,  -30 },   // 0x31 '1'
+  {   506,  21,  31,  24,    1,  -30 },   // 0x32 '2'
+  {   588,  21,  32,  24,    1,  -30 },   // 0x33 '3'
+  {   672,  21,  31,  24,    1,  -30 },   // 0x34 '4'
+  {   754,  21,  32,  24,    1,  -30 },   // 0x35 '5'
+  {   838,  20,  32,  24,    2,  -30 },   // 0x36 '6'
+  {   918,  20,  31,  24,    2,  -30 },   // 0x37 '7'
+  {   996,  20,  32,  24,    2,  -30 },   // 0x38 '8'
+  {  1076,  20,  32,  24,    2,  -30 },   // 0x39 '9'
+  {  1156,   5,  23,  11,    3,  -22 },   // 0x3A ':'
+  {  1171,  21,  21,  25,    2,  -19 },   // 0x3E '>'
+  {  1227,  19,  32,  24,    3,  -31 },   // 0x3F '?'
+  {  1303,  27,  31,  29,    1,  -30 },   // 0x41 'A'
+  {  1408,  24,  31,  29,    3,  -30 },   // 0x42 'B'
+  {  1501,  27,  33,  31,    2,  -31 },   // 0x43 'C'
+  {  1613,  25,  31,  30,    3,  -30 },   // 0x44 'D'
+  {  1710,  23,  31,  27,    3,  -30 },   // 0x45 'E'
+  {  1800,  22,  31,  26,    3,  -30 },   // 0x46 'F'
+  {  1886,  28,  33,  33,    2,  -31 },   // 0x47 'G'
+  {  2002,  25,  31,  31,    3,  -30 },   // 0x48 'H'
+  {  2099,   4,  31,  12,    4,  -30 },   // 0x49 'I'
+  {  2115,  18,  32,  23,    1,  -30 },   // 0x4A 'J'
+  {  2187,  25,  31,  29,    3,  -30 },   // 0x4B 'K'
+  {  2284,  20,  31,  24,    3,  -30 },   // 0x4C 'L'
+  {  2362,  30,  31,  36,    3,  -30 },   // 0x4D 'M'
+  {  2479,  25,  31,  31,    3,  -30 },   // 0x4E 'N'
+  {  2576,  30,  33,  34,    2,  -31 },   // 0x4F 'O'
+  {  2700,  23,  31,  28,    3,  -30 },   // 0x50 'P'
+  {  2790,  30,  35,  34,    2,  -31 },   // 0x51 'Q'
+  {  2922,  26,  31,  31,    3,  -30 },   // 0x52 'R'
+  {  3023,  25,  33,  29,    2,  -31 },   // 0x53 'S'
+  {  3127,  25,  31,  27,    1,  -30 },   // 0x54 'T'
+  {  3224,  25,  32,  31,    3,  -30 },   // 0x55 'U'
+  {  3324,  26,  31,  28,    1,  -30 },   // 0x56 'V'
+  {  3425,  39,  31,  40,    1,  -30 },   // 0x57 'W'
+  {  3577,  28,  31,  29,    1,  -30 },   // 0x59 'Y'
+  {  3686,  24,  31,  27,    1,  -30 },   // 0x5A 'Z'
+  {  3779,   8,  40,  12,    3,  -30 },   // 0x5B '['
+  {  3819,   8,  40,  12,    1,  -30 },   // 0x5D ']'
+  {  3859,  26,   2,  24,   -1,    7 },   // 0x5F '_'
+  {  3866,  22,  25,  23,    1,  -23 },   // 0x61 'a'
+  {  3935,  20,  32,  24,    3,  -30 },   // 0x62 'b'
+  {  4015,  20,  25,  22,    1,  -23 },   // 0x63 'c'
+  {  4078,  20,  32,  24,    1,  -30 },   // 0x64 'd'
+  {  4158,  21,  25,  23,    1,  -23 },   // 0x65 'e'
+  {  4224,  10,  32,  12,    1,  -31 },   // 0x66 'f'
+  {  4264,  20,  33,  24,    1,  -23 },   // 0x67 'g'
+  {  4347,  18,  31,  23,    3,  -30 },   // 0x68 'h'
+  {  4417,   3,  31,  10,    3,  -30 },   // 0x69 'i'
+  {  4429,  19,  31,  22,    3,  -30 },   // 0x6B 'k'
+  {  4503,   3,  31,   9,    3,  -30 },   // 0x6C 'l'
+  {  4515,  29,  24,  35,    3,  -23 },   // 0x6D 'm'
+  {  4602,  18,  24,  23,    3,  -23 },   // 0x6E 'n'
+  {  4656,  21,  25,  23,    1,  -23 },   // 0x6F 'o'
+  {  4722,  20,  33,  24,    3,  -23 },   // 0x70 'p'
+  {  4805,  20,  33,  24,    1,  -23 },   // 0x71 'q'
+  {  4888,  10,  24,  14,    3,  -23 },   // 0x72 'r'
+  {  4918,  19,  25,  21,    1,  -23 },   // 0x73 's'
+  {  4978,  10,  30,  12,    1,  -28 },   // 0x74 't'
+  {  5016,  18,  24,  23,    3,  -22 },   // 0x75 'u'
+  {  5070,  21,  23,  21,    0,  -22 },   // 0x76 'v'
+  {  5131,  31,  23,  31,    0,  -22 },   // 0x77 'w'
+  {  5221,  20,  23,  21,    0,  -22 },   // 0x78 'x'
+  {  5279,  20,  33,  21,    0,  -22 },   // 0x79 'y'
+  {  5362,  19,  23,  21,    1,  -22 },   // 0x7A 'z'
+  {  5417,   3,  41,  11,    4,  -30 },   // 0x7C '|'
+  {  5433,  14,  12,  26,    6,  -28 },   // 0xB0 ''
+  {  5454,  13,  18,  15,    1,  -34 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_22pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_22pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_22pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_22pt8bGlyphs,
+  0x20, 0x6F, 52 };
+
+// Approx. 6275 bytes
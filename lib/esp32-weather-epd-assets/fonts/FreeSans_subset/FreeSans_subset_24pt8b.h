@@ -0,0 +1,651 @@
+const uint8_t FreeSans_subset_24pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+  0x66, 0x66, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x07,
+  0xC0, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0x01,
+  0xC0, 0x03, 0xE7, 0xE0, 0x07, 0x00, 0x0F, 0x03, 0xE0, 0x0E, 0x00, 0x1C,
+  0x03, 0xC0, 0x38, 0x00, 0x38, 0x03, 0x80, 0x70, 0x00, 0xF0, 0x07, 0x01,
+  0xC0, 0x01, 0xE0, 0x0E, 0x03, 0x80, 0x03, 0xC0, 0x1C, 0x0E, 0x00, 0x03,
+  0x80, 0x38, 0x1C, 0x00, 0x07, 0x80, 0xF0, 0x70, 0x00, 0x07, 0x87, 0xC1,
+  0xE0, 0x00, 0x0F, 0xFF, 0x03, 0x80, 0x00, 0x0F, 0xFC, 0x0F, 0x00, 0x00,
+  0x07, 0xF0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x07, 0x03, 0xFF,
+  0x00, 0x00, 0x1C, 0x0F, 0xFF, 0x00, 0x00, 0x38, 0x1E, 0x1F, 0x00, 0x00,
+  0xE0, 0x78, 0x0F, 0x00, 0x01, 0xC0, 0xE0, 0x1E, 0x00, 0x07, 0x03, 0xC0,
+  0x1C, 0x00, 0x0E, 0x07, 0x80, 0x38, 0x00, 0x38, 0x0F, 0x00, 0x70, 0x00,
+  0x70, 0x1E, 0x00, 0xE0, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x07, 0x80, 0x3C,
+  0x0F, 0x80, 0x0E, 0x00, 0x3E, 0x7E, 0x00, 0x3C, 0x00, 0x3F, 0xF8, 0x00,
+  0x70, 0x00, 0x3F, 0xE0, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xFF,
+  0xBD, 0xEE, 0x73, 0x8C, 0x60, 0x00, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70,
+  0x0E, 0x03, 0x80, 0x70, 0x1E, 0x03, 0x80, 0x70, 0x1E, 0x03, 0x80, 0x70,
+  0x1E, 0x03, 0xC0, 0x78, 0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x0E, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x0E, 0x01,
+  0xC0, 0x3C, 0x07, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x38,
+  0x03, 0x80, 0x70, 0x07, 0x00, 0x60, 0xE0, 0x18, 0x07, 0x00, 0xE0, 0x38,
+  0x07, 0x01, 0xC0, 0x78, 0x0E, 0x03, 0xC0, 0xF0, 0x1C, 0x07, 0x81, 0xE0,
+  0x78, 0x0E, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x01,
+  0xC0, 0xF0, 0x38, 0x0E, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0x1C, 0x07, 0x03,
+  0x80, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0,
+  0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03,
+  0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8C,
+  0x67, 0x39, 0xBD, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x18, 0x01, 0xC0, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x38, 0x01,
+  0x80, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x70, 0x03, 0x80, 0x18, 0x01, 0xC0,
+  0x0E, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0x80, 0x0C, 0x00, 0xE0, 0x07,
+  0x00, 0x30, 0x03, 0x80, 0x1C, 0x00, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x00,
+  0x38, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x00, 0x00, 0xFC,
+  0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x1F, 0x03, 0xE0,
+  0xF8, 0x07, 0xC3, 0xC0, 0x0F, 0x1F, 0x00, 0x3C, 0x78, 0x00, 0xF9, 0xE0,
+  0x01, 0xE7, 0x80, 0x07, 0xBE, 0x00, 0x1E, 0xF8, 0x00, 0x7F, 0xC0, 0x01,
+  0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00,
+  0x07, 0xFE, 0x00, 0x1E, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xE7, 0x80, 0x07,
+  0x9F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF8, 0x07, 0xC1, 0xF0, 0x3E, 0x07,
+  0xF7, 0xF0, 0x0F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0xF0, 0x1E, 0x07, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x01, 0xFE,
+  0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0x01, 0xF0,
+  0xF8, 0x03, 0xE7, 0xC0, 0x07, 0x9E, 0x00, 0x1F, 0x78, 0x00, 0x3F, 0xE0,
+  0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80,
+  0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x0F,
+  0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0xF0, 0x1F, 0x87, 0xC0,
+  0x1F, 0x0F, 0x00, 0x1E, 0x1E, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0xF0, 0x00,
+  0x79, 0xE0, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0,
+  0x01, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80,
+  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x7D, 0xE0,
+  0x00, 0xFB, 0xC0, 0x01, 0xE7, 0xC0, 0x03, 0xC7, 0x80, 0x0F, 0x8F, 0xC0,
+  0x7E, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x03, 0xF8,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0,
+  0x00, 0x7B, 0xE0, 0x00, 0xF7, 0xC0, 0x03, 0xCF, 0x80, 0x0F, 0x1F, 0x00,
+  0x1E, 0x3E, 0x00, 0x78, 0x7C, 0x01, 0xE0, 0xF8, 0x07, 0xC1, 0xF0, 0x0F,
+  0x03, 0xE0, 0x3C, 0x07, 0xC0, 0xF0, 0x0F, 0x81, 0xE0, 0x1F, 0x07, 0x80,
+  0x3E, 0x1E, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0,
+  0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFC, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x1E, 0x00,
+  0x79, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xC1, 0xFC, 0x7C,
+  0x01, 0xF9, 0xE0, 0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1E, 0xF8, 0x00, 0xF9, 0xF0,
+  0x03, 0xC7, 0xE0, 0x3F, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x3F, 0xFE,
+  0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xFC,
+  0x03, 0xFF, 0xF8, 0x1F, 0x81, 0xF0, 0x78, 0x03, 0xC3, 0xE0, 0x0F, 0x8F,
+  0x00, 0x1E, 0x7C, 0x00, 0x79, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00,
+  0x00, 0xF8, 0x00, 0x03, 0xC1, 0xF8, 0x0F, 0x3F, 0xF8, 0x3D, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xF3, 0xFC, 0x07, 0xCF, 0xE0, 0x0F, 0xBF, 0x00, 0x1E, 0xF8,
+  0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00,
+  0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x07, 0xDE, 0x00, 0x1F, 0x3C, 0x00, 0x78,
+  0xF8, 0x03, 0xE1, 0xF0, 0x3F, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x1F,
+  0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07,
+  0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01,
+  0xE0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07,
+  0xFF, 0xF8, 0x3F, 0x03, 0xF0, 0xF0, 0x07, 0xC7, 0xC0, 0x0F, 0x9E, 0x00,
+  0x3E, 0x78, 0x00, 0x79, 0xE0, 0x01, 0xE7, 0x80, 0x07, 0x9F, 0x00, 0x3E,
+  0x3C, 0x00, 0xF0, 0xF8, 0x0F, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x07,
+  0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xF0, 0x3F, 0x1F, 0x00, 0x3E, 0x78, 0x00,
+  0x7B, 0xE0, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x79, 0xF0,
+  0x03, 0xE7, 0xE0, 0x3F, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x1F, 0xFE,
+  0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF8, 0x3E, 0x03, 0xE1, 0xF0, 0x07, 0xC7, 0x80, 0x0F, 0x3E,
+  0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x07, 0xBC, 0x00,
+  0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F,
+  0x7C, 0x01, 0xFD, 0xF8, 0x0F, 0xF3, 0xFF, 0xFB, 0xC7, 0xFF, 0xEF, 0x0F,
+  0xFE, 0x3C, 0x07, 0xE1, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xE7, 0x80, 0x0F, 0x9E, 0x00, 0x3C, 0x78, 0x01, 0xF1,
+  0xF0, 0x0F, 0x83, 0xE0, 0x7E, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x1F,
+  0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x01,
+  0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x01,
+  0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00,
+  0x0F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00,
+  0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x83,
+  0xFF, 0xFC, 0x7C, 0x07, 0xEF, 0x80, 0x3E, 0xF0, 0x01, 0xFF, 0x00, 0x1F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01,
+  0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03,
+  0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01,
+  0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00,
+  0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x1F,
+  0x3C, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x87,
+  0x80, 0x00, 0x3C, 0x1F, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x07, 0x80, 0xF0,
+  0x00, 0x1E, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x1E, 0x00,
+  0x0F, 0x00, 0x7C, 0x00, 0x7C, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07,
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
+  0xFF, 0xF0, 0x1F, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x0F, 0x83, 0xE0, 0x00,
+  0x3E, 0x0F, 0x80, 0x00, 0xF8, 0x3C, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x07,
+  0xC7, 0xC0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFB,
+  0xE0, 0x00, 0x01, 0xE0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFE, 0x1F, 0xFF, 0xFF, 0x8F, 0x00, 0x07, 0xE7, 0x80, 0x01, 0xF3, 0xC0,
+  0x00, 0x7D, 0xE0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0x78, 0x00, 0x0F, 0xBC,
+  0x00, 0x07, 0xDE, 0x00, 0x03, 0xCF, 0x00, 0x01, 0xE7, 0x80, 0x01, 0xF3,
+  0xC0, 0x03, 0xF1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFC,
+  0x3F, 0xFF, 0xFF, 0x9E, 0x00, 0x07, 0xEF, 0x00, 0x01, 0xF7, 0x80, 0x00,
+  0x7F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80,
+  0x01, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x7F,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xFE, 0x01, 0xFC, 0x07, 0xC0, 0x03,
+  0xF0, 0x7C, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x3E, 0x3E, 0x00, 0x01, 0xF3,
+  0xE0, 0x00, 0x07, 0x9F, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xFB, 0xE0, 0x00,
+  0x07, 0xDF, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F,
+  0x0F, 0x80, 0x01, 0xF0, 0x7F, 0x00, 0x1F, 0x81, 0xFE, 0x03, 0xF8, 0x07,
+  0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
+  0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0,
+  0x7F, 0xFF, 0xFE, 0x0F, 0x00, 0x0F, 0xE1, 0xE0, 0x00, 0x7E, 0x3C, 0x00,
+  0x07, 0xC7, 0x80, 0x00, 0x7C, 0xF0, 0x00, 0x07, 0x9E, 0x00, 0x00, 0xFB,
+  0xC0, 0x00, 0x0F, 0x78, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x1E, 0xF0,
+  0x00, 0x07, 0xDE, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x3E, 0x78, 0x00, 0x0F,
+  0xCF, 0x00, 0x03, 0xF1, 0xE0, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80,
+  0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFE,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0xFF,
+  0x01, 0xF8, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x3E,
+  0x3E, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x00, 0xFB,
+  0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
+  0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00,
+  0x00, 0x0F, 0x78, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x3D, 0xF0, 0x00,
+  0x00, 0xF9, 0xF0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x07, 0xE3, 0xF0, 0x00,
+  0x1F, 0xC3, 0xF0, 0x00, 0x7F, 0x83, 0xF8, 0x07, 0xEF, 0x03, 0xFF, 0xFF,
+  0x8E, 0x03, 0xFF, 0xFE, 0x1C, 0x01, 0xFF, 0xF0, 0x38, 0x00, 0x7F, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00,
+  0x07, 0xC0, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
+  0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x3D, 0xF0, 0x0F, 0x9F, 0x03, 0xF3, 0xFF,
+  0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0xF0, 0x00, 0x07,
+  0xDE, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x7C, 0x78, 0x00, 0x1F, 0x0F, 0x00,
+  0x07, 0xC1, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0x7C, 0x07, 0x80, 0x1F, 0x00,
+  0xF0, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0x78, 0x1F,
+  0x00, 0x0F, 0x07, 0xC0, 0x01, 0xE1, 0xF0, 0x00, 0x3C, 0x7E, 0x00, 0x07,
+  0x9F, 0xE0, 0x00, 0xF7, 0xFE, 0x00, 0x1F, 0xF7, 0xC0, 0x03, 0xFC, 0x7C,
+  0x00, 0x7F, 0x07, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xF0, 0x0F, 0x80, 0x3C,
+  0x00, 0xF8, 0x07, 0x80, 0x0F, 0x80, 0xF0, 0x01, 0xF0, 0x1E, 0x00, 0x1F,
+  0x03, 0xC0, 0x01, 0xF0, 0x78, 0x00, 0x3E, 0x0F, 0x00, 0x03, 0xE1, 0xE0,
+  0x00, 0x3E, 0x3C, 0x00, 0x07, 0xE7, 0x80, 0x00, 0x7C, 0xF0, 0x00, 0x07,
+  0xDE, 0x00, 0x00, 0xFC, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78,
+  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xF7, 0x00, 0x01, 0xEF, 0xF7, 0x80, 0x01, 0xEF, 0xF7, 0x80,
+  0x01, 0xEF, 0xF3, 0x80, 0x03, 0xCF, 0xF3, 0xC0, 0x03, 0xCF, 0xF3, 0xC0,
+  0x03, 0x8F, 0xF1, 0xC0, 0x07, 0x8F, 0xF1, 0xE0, 0x07, 0x8F, 0xF1, 0xE0,
+  0x07, 0x0F, 0xF0, 0xE0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0,
+  0x0E, 0x0F, 0xF0, 0x78, 0x1E, 0x0F, 0xF0, 0x78, 0x1E, 0x0F, 0xF0, 0x78,
+  0x1C, 0x0F, 0xF0, 0x3C, 0x3C, 0x0F, 0xF0, 0x3C, 0x3C, 0x0F, 0xF0, 0x3C,
+  0x38, 0x0F, 0xF0, 0x1E, 0x78, 0x0F, 0xF0, 0x1E, 0x78, 0x0F, 0xF0, 0x1E,
+  0x70, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x07,
+  0xC0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
+  0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xE0,
+  0x00, 0xFF, 0xBC, 0x00, 0x1F, 0xF7, 0xC0, 0x03, 0xFE, 0x7C, 0x00, 0x7F,
+  0xCF, 0x80, 0x0F, 0xF8, 0xF8, 0x01, 0xFF, 0x0F, 0x80, 0x3F, 0xE1, 0xF0,
+  0x07, 0xFC, 0x1F, 0x00, 0xFF, 0x81, 0xF0, 0x1F, 0xF0, 0x3E, 0x03, 0xFE,
+  0x03, 0xE0, 0x7F, 0xC0, 0x3C, 0x0F, 0xF8, 0x07, 0xC1, 0xFF, 0x00, 0x7C,
+  0x3F, 0xE0, 0x07, 0x87, 0xFC, 0x00, 0xF8, 0xFF, 0x80, 0x0F, 0x9F, 0xF0,
+  0x01, 0xF3, 0xFE, 0x00, 0x1F, 0x7F, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x80,
+  0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+  0xFC, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
+  0x03, 0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x3E, 0x3E, 0x00,
+  0x00, 0x1F, 0x1F, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x03, 0xE7, 0x80,
+  0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1E,
+  0x78, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x0F,
+  0x87, 0xC0, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x07,
+  0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x03, 0xFF, 0xFF,
+  0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFC, 0xF0, 0x00, 0x7E, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0,
+  0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0,
+  0x00, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC,
+  0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x03,
+  0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
+  0x1F, 0x1F, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x03, 0xE7, 0x80, 0x00,
+  0x00, 0xF7, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1E, 0x78,
+  0x00, 0x00, 0x1F, 0x3E, 0x00, 0x04, 0x0F, 0x9F, 0x00, 0x03, 0x0F, 0x87,
+  0xC0, 0x03, 0xC7, 0xC1, 0xF0, 0x01, 0xFF, 0xC0, 0xFC, 0x00, 0x7F, 0xE0,
+  0x3F, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x03, 0xFF, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xCF, 0xC0, 0x01, 0xFF, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x8F, 0x00,
+  0x01, 0xF9, 0xE0, 0x00, 0x1F, 0x3C, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x3E,
+  0xF0, 0x00, 0x07, 0xDE, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x1F, 0x78, 0x00,
+  0x03, 0xEF, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x1F, 0x3C, 0x00, 0x07, 0xC7,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+  0xF8, 0x78, 0x00, 0x1F, 0x8F, 0x00, 0x00, 0xF9, 0xE0, 0x00, 0x1F, 0x3C,
+  0x00, 0x01, 0xE7, 0x80, 0x00, 0x3C, 0xF0, 0x00, 0x07, 0x9E, 0x00, 0x00,
+  0xF3, 0xC0, 0x00, 0x1E, 0x78, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x79, 0xE0,
+  0x00, 0x0F, 0x3C, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x3E, 0xF0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x7C, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x1F,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x01, 0xF8, 0x03, 0xF0, 0x7C, 0x00, 0x1F,
+  0x0F, 0x80, 0x01, 0xE1, 0xE0, 0x00, 0x3E, 0x7C, 0x00, 0x03, 0xCF, 0x80,
+  0x00, 0x79, 0xF0, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+  0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xBC,
+  0x00, 0x00, 0xF7, 0xC0, 0x00, 0x3E, 0xF8, 0x00, 0x07, 0x8F, 0x80, 0x01,
+  0xF0, 0xFE, 0x00, 0xFC, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
+  0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1E, 0x7C, 0x00, 0x0F, 0x9F,
+  0x80, 0x07, 0xE3, 0xF8, 0x07, 0xF0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC,
+  0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF7, 0xC0,
+  0x00, 0x0F, 0x9E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xC7, 0xC0, 0x00,
+  0x3E, 0x1E, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0xF8,
+  0x1E, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x3C, 0x07, 0xC0, 0x03, 0xE0, 0x1E,
+  0x00, 0x1F, 0x00, 0xF8, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
+  0x7C, 0x00, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x1F, 0x01, 0xE0,
+  0x00, 0xF8, 0x0F, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x1F, 0x07, 0x80, 0x00,
+  0xF8, 0x3C, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x78,
+  0xF0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x7B, 0xC0,
+  0x00, 0x03, 0xDE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x80, 0x03,
+  0xF0, 0x00, 0x7D, 0xE0, 0x00, 0xFC, 0x00, 0x1E, 0x7C, 0x00, 0x7F, 0x80,
+  0x0F, 0x9F, 0x00, 0x1F, 0xE0, 0x03, 0xE7, 0xC0, 0x07, 0xF8, 0x00, 0xF8,
+  0xF0, 0x01, 0xFE, 0x00, 0x3C, 0x3E, 0x00, 0xF3, 0xC0, 0x0F, 0x0F, 0x80,
+  0x3C, 0xF0, 0x07, 0xC3, 0xE0, 0x0F, 0x3C, 0x01, 0xF0, 0x78, 0x07, 0x8F,
+  0x80, 0x78, 0x1F, 0x01, 0xE1, 0xE0, 0x1E, 0x07, 0xC0, 0x78, 0x78, 0x0F,
+  0x81, 0xF0, 0x1E, 0x1E, 0x03, 0xE0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xE0, 0xF0, 0x3C, 0x1F, 0x00, 0xF8, 0x3C,
+  0x0F, 0x87, 0xC0, 0x1E, 0x1E, 0x01, 0xE1, 0xE0, 0x07, 0x87, 0x80, 0x78,
+  0x78, 0x01, 0xF1, 0xE0, 0x1E, 0x1E, 0x00, 0x7C, 0xF0, 0x03, 0xCF, 0x80,
+  0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x3C, 0xF0, 0x00, 0xFB,
+  0xC0, 0x0F, 0xBC, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x00,
+  0x7F, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xF8,
+  0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0xF8, 0x00,
+  0x00, 0x7D, 0xF0, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x00,
+  0x7C, 0x1F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C,
+  0x03, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x7C, 0x00,
+  0x3F, 0x01, 0xF0, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0xF8, 0x3C, 0x00, 0x03,
+  0xE1, 0xF0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3F,
+  0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF0,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0,
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x00, 0x07,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3E, 0x01, 0xF0, 0x3C,
+  0x00, 0xF0, 0x3C, 0x00, 0x78, 0x7C, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xF8, 0x3F, 0xF8, 0x78, 0x7F, 0x00, 0x78, 0x7C, 0x00, 0x78, 0x78,
+  0x00, 0x78, 0xF8, 0x00, 0x78, 0xF0, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x78,
+  0x01, 0xF8, 0x7C, 0x03, 0xF8, 0x7F, 0xBF, 0xFC, 0x3F, 0xFF, 0x7F, 0x1F,
+  0xFC, 0x7F, 0x07, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0xF0, 0xFE, 0x03, 0xCF, 0xFE, 0x0F, 0x7F, 0xFC, 0x3F,
+  0xFF, 0xF8, 0xFF, 0x03, 0xF3, 0xF0, 0x07, 0xCF, 0x80, 0x0F, 0xBE, 0x00,
+  0x3E, 0xF8, 0x00, 0x7B, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x7F, 0xC0, 0x01, 0xEF, 0x00, 0x07, 0xBE, 0x00, 0x3E, 0xFC, 0x00,
+  0xFB, 0xF0, 0x07, 0xCF, 0xF0, 0x3E, 0x3B, 0xFF, 0xF8, 0xE7, 0xFF, 0xC3,
+  0x8F, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xFC, 0x03,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xC1, 0xF0, 0x1F, 0x1F, 0x00, 0x78, 0xF0, 0x03,
+  0xEF, 0x80, 0x0F, 0x78, 0x00, 0x7B, 0xC0, 0x00, 0x1E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xC0, 0x03, 0xDE, 0x00, 0x1E, 0xF8, 0x00, 0xF3, 0xC0,
+  0x0F, 0x9F, 0x00, 0x78, 0x7C, 0x07, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+  0x1F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00,
+  0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01,
+  0xC0, 0x00, 0x07, 0x00, 0xFC, 0x1C, 0x0F, 0xFC, 0x70, 0xFF, 0xF9, 0xC7,
+  0xFF, 0xF7, 0x1F, 0x81, 0xFC, 0xF8, 0x03, 0xF3, 0xC0, 0x07, 0xDF, 0x00,
+  0x1F, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03, 0xFE, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0x78,
+  0x00, 0x3D, 0xE0, 0x00, 0xF7, 0x80, 0x03, 0xDF, 0x00, 0x1F, 0x3C, 0x00,
+  0x7C, 0xF8, 0x03, 0xF1, 0xF0, 0x1F, 0xC7, 0xFF, 0xF7, 0x0F, 0xFF, 0xDC,
+  0x0F, 0xFC, 0x70, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00,
+  0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xF0, 0x1F, 0x07, 0xC0, 0x1F, 0x0F,
+  0x00, 0x1E, 0x3E, 0x00, 0x3E, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0,
+  0x00, 0xF3, 0xC0, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+  0xF3, 0xC0, 0x01, 0xE3, 0xC0, 0x07, 0xC7, 0xC0, 0x1F, 0x07, 0xC0, 0x7E,
+  0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0xF8, 0x00,
+  0x03, 0xE0, 0xFC, 0x3F, 0x8F, 0xC1, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x00,
+  0xFC, 0x00, 0x0F, 0xFC, 0xF0, 0xFF, 0xFB, 0xC3, 0xFF, 0xFF, 0x1F, 0x03,
+  0xFC, 0xF8, 0x03, 0xF3, 0xC0, 0x0F, 0xDF, 0x00, 0x1F, 0x78, 0x00, 0x7D,
+  0xE0, 0x00, 0xF7, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0x78, 0x00, 0x3D, 0xE0, 0x00,
+  0xF7, 0x80, 0x07, 0xDF, 0x00, 0x1F, 0x3C, 0x00, 0xFC, 0xF8, 0x03, 0xF1,
+  0xF0, 0x3F, 0xC7, 0xFF, 0xEF, 0x0F, 0xFF, 0x3C, 0x0F, 0xF8, 0xF0, 0x1F,
+  0x83, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x39, 0xE0, 0x01, 0xE7, 0xC0, 0x07,
+  0x8F, 0x80, 0x3C, 0x3F, 0x03, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x00,
+  0xFF, 0xC0, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F,
+  0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0xFE, 0x1E,
+  0x7F, 0xF3, 0xDF, 0xFF, 0x7F, 0xEF, 0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFE,
+  0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
+  0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3C, 0xFF,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x1F, 0x3C, 0x01, 0xF1, 0xE0, 0x1F, 0x0F,
+  0x01, 0xF0, 0x78, 0x1F, 0x03, 0xC1, 0xF0, 0x1E, 0x1F, 0x00, 0xF1, 0xF0,
+  0x07, 0x9F, 0x00, 0x3D, 0xF8, 0x01, 0xFF, 0xE0, 0x0F, 0xEF, 0x00, 0x7E,
+  0x7C, 0x03, 0xF1, 0xF0, 0x1F, 0x0F, 0x80, 0xF0, 0x3E, 0x07, 0x80, 0xF0,
+  0x3C, 0x07, 0xC1, 0xE0, 0x1F, 0x0F, 0x00, 0xF8, 0x78, 0x03, 0xE3, 0xC0,
+  0x0F, 0x9E, 0x00, 0x7C, 0xF0, 0x01, 0xF7, 0x80, 0x07, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x03, 0xF0, 0xE3, 0xFF, 0x0F, 0xFC, 0xE7,
+  0xFF, 0x9F, 0xFE, 0xEF, 0xBF, 0xBE, 0xFF, 0xFC, 0x07, 0xF8, 0x1F, 0xF8,
+  0x07, 0xF0, 0x0F, 0xF8, 0x03, 0xE0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+  0x7E, 0x1C, 0x3F, 0xF3, 0x8F, 0xFF, 0x73, 0xEF, 0xFE, 0xE0, 0x3F, 0xF8,
+  0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
+  0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
+  0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00,
+  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00,
+  0x1C, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF,
+  0x81, 0xF0, 0x1F, 0x07, 0xC0, 0x1F, 0x0F, 0x00, 0x1E, 0x3E, 0x00, 0x3E,
+  0x78, 0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF7, 0xC0, 0x01, 0xFF,
+  0x00, 0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0x78,
+  0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF3, 0xE0, 0x03, 0xE3, 0xC0,
+  0x07, 0x87, 0xC0, 0x1F, 0x07, 0xC0, 0x7C, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xE0, 0x07, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0x87, 0xFE,
+  0x0E, 0x7F, 0xFC, 0x3B, 0xFF, 0xF8, 0xEF, 0x03, 0xF3, 0xF0, 0x07, 0xCF,
+  0xC0, 0x0F, 0xBE, 0x00, 0x3E, 0xF8, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00,
+  0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x07, 0xBE,
+  0x00, 0x3E, 0xFC, 0x00, 0xFB, 0xF0, 0x07, 0xCF, 0xF0, 0x3F, 0x3F, 0xFF,
+  0xF8, 0xF7, 0xFF, 0xC3, 0xCF, 0xFE, 0x0F, 0x0F, 0xE0, 0x3C, 0x00, 0x00,
+  0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x0F, 0xFC, 0x70, 0xFF, 0xF9, 0xC3, 0xFF, 0xF7, 0x1F, 0x81, 0xFC,
+  0xF8, 0x03, 0xF3, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x78, 0x00, 0x3D, 0xE0,
+  0x00, 0xF7, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0xF7,
+  0x80, 0x03, 0xDF, 0x00, 0x1F, 0x3C, 0x00, 0x7C, 0xF8, 0x03, 0xF3, 0xF0,
+  0x1F, 0xC7, 0xFF, 0xF7, 0x0F, 0xFF, 0x9C, 0x1F, 0xFC, 0x70, 0x1F, 0xC1,
+  0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00,
+  0x07, 0x00, 0xFE, 0x3F, 0xE7, 0xFE, 0x7F, 0xEF, 0x8F, 0xC0, 0xF8, 0x0F,
+  0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x87,
+  0xFF, 0xFC, 0x7C, 0x07, 0xCF, 0x80, 0x3C, 0xF0, 0x03, 0xCF, 0x00, 0x3E,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFC,
+  0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x07, 0xE0, 0x00,
+  0x1E, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xEF, 0x80, 0x1E, 0xFC,
+  0x03, 0xE7, 0xFF, 0xFC, 0x3F, 0xFF, 0x81, 0xFF, 0xF0, 0x07, 0xF8, 0x00,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x87, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3F, 0x47, 0xF8, 0x7F, 0x07, 0xE0, 0xF0, 0x00,
+  0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01,
+  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03,
+  0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F,
+  0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x7F,
+  0xF0, 0x1F, 0xDF, 0xDF, 0xBB, 0xFF, 0xE7, 0x3F, 0xF8, 0xE1, 0xFC, 0x00,
+  0x78, 0x00, 0x3E, 0xF0, 0x00, 0x79, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xE3,
+  0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x07, 0x80, 0x3C, 0x0F, 0x00, 0x78, 0x1F,
+  0x01, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x7C, 0x1E, 0x00, 0x78,
+  0x3C, 0x00, 0xF0, 0x78, 0x01, 0xF1, 0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7,
+  0x80, 0x03, 0xDE, 0x00, 0x07, 0xBC, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
+  0x78, 0x03, 0xE0, 0x07, 0xBC, 0x01, 0xF8, 0x03, 0xDE, 0x00, 0xFC, 0x03,
+  0xEF, 0x80, 0x7E, 0x01, 0xE3, 0xC0, 0x7F, 0x00, 0xF1, 0xE0, 0x3F, 0xC0,
+  0x78, 0xF0, 0x1F, 0xE0, 0x7C, 0x3C, 0x0E, 0xF0, 0x3C, 0x1E, 0x0F, 0x38,
+  0x1E, 0x0F, 0x07, 0x9E, 0x0F, 0x07, 0xC3, 0xCF, 0x0F, 0x01, 0xE1, 0xC7,
+  0x87, 0x80, 0xF1, 0xE1, 0xC3, 0xC0, 0x78, 0xF0, 0xF1, 0xE0, 0x1E, 0x78,
+  0x79, 0xE0, 0x0F, 0x38, 0x3C, 0xF0, 0x07, 0x9C, 0x0E, 0x78, 0x03, 0xDE,
+  0x07, 0xB8, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x3F,
+  0x80, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x03,
+  0xE0, 0x0F, 0xC0, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x78, 0xF0,
+  0x03, 0xE1, 0xE0, 0x0F, 0x07, 0xC0, 0x78, 0x0F, 0x03, 0xE0, 0x1E, 0x0F,
+  0x00, 0x7C, 0x78, 0x00, 0xF3, 0xE0, 0x01, 0xEF, 0x00, 0x07, 0xF8, 0x00,
+  0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F,
+  0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x3E, 0x00, 0x78, 0x7C,
+  0x03, 0xE0, 0xF0, 0x0F, 0x03, 0xE0, 0x78, 0x07, 0xC3, 0xE0, 0x0F, 0x1F,
+  0x00, 0x3E, 0x78, 0x00, 0x7C, 0x78, 0x00, 0x3D, 0xE0, 0x01, 0xE7, 0x80,
+  0x07, 0x8F, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC1, 0xE0, 0x1F,
+  0x07, 0x80, 0x78, 0x1E, 0x01, 0xE0, 0x3C, 0x0F, 0x80, 0xF0, 0x3C, 0x03,
+  0xC0, 0xF0, 0x07, 0x87, 0x80, 0x1E, 0x1E, 0x00, 0x78, 0x78, 0x00, 0xF3,
+  0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80,
+  0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0,
+  0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
+  0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x00, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0xC0, 0x7F, 0xC3, 0xFF, 0x9E, 0x0E, 0x70, 0x1F, 0x80,
+  0x7E, 0x00, 0xF8, 0x03, 0xE0, 0x1D, 0xC0, 0x77, 0x83, 0x8F, 0xFE, 0x1F,
+  0xF0, 0x3F, 0x00, 0x1F, 0xE0, 0xFF, 0xE7, 0x87, 0xDC, 0x07, 0x70, 0x1F,
+  0x80, 0x7E, 0x01, 0xC0, 0x07, 0x00, 0x38, 0x03, 0xE0, 0x3F, 0x01, 0xF0,
+  0x1F, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF };
+
+const GFXglyph FreeSans_subset_24pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   4,  34,  16,    6,  -33 },   // 0x21 '!'
+  {    18,  39,  35,  42,    1,  -33 },   // 0x25 '%'
+  {   189,   5,  12,   9,    2,  -33 },   // 0x27 '''
+  {   197,  11,  44,  16,    3,  -33 },   // 0x28 '('
+  {   258,  10,  44,  16,    2,  -33 },   // 0x29 ')'
+  {   313,  23,  23,  27,    2,  -21 },   // 0x2B '+'
+  {   380,   5,  12,  13,    4,   -4 },   // 0x2C ','
+  {   388,  11,   3,  16,    2,  -13 },   // 0x2D '-'
+  {   393,   5,   5,  12,    4,   -4 },   // 0x2E '.'
+  {   397,  13,  35,  13,    0,  -33 },   // 0x2F '/'
+  {   454,  22,  35,  26,    2,  -33 },   // 0x30 '0'
+  {   551,  11,  34,  26,    5,  -33 },   // 0x31 '1'
+  {   598,  22,  34,  26,    2,  -33 },   // 0x32 '2'
+  {   692,  23,  35,  26,    1,  -33 },   // 0x33 '3'
+  {   793,  23,  34,  26,    1,  -33 },   // 0x34 '4'
+  {   891,  22,  35,  26,    2,  -33 },   // 0x35 '5'
+  {   988,  22,  35,  26,    2,  -33 },   // 0x36 '6'
+  {  1085,  22,  34,  26,    2,  -33 },   // 0x37 '7'
+  {  1179,  22,  35,  26,    2,  -33 },   // 0x38 '8'
+  {  1276,  22,  35,  26,    2,  -33 },   // 0x39 '9'
+  {  1373,   5,  25,  12,    4,  -24 },   // 0x3A ':'
+  {  1389,  23,  23,  27,    2,  -21 },   // 0x3E '>'
+  {  1456,  20,  35,  26,    4,  -34 },   // 0x3F '?'
+  {  1544,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  1672,  25,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  1779,  29,  36,  33,    2,  -34 },   // 0x43 'C'
+  {  1910,  27,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  2025,  24,  34,  30,    4,  -33 },   // 0x45 'E'
+  {  2127,  23,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  2225,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  2365,  26,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  2476,   4,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  2493,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
+  {  2577,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  2692,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  2782,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  2918,  27,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  3033,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  3182,  24,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  3284,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
+  {  3441,  27,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  3556,  27,  36,  31,    2,  -34 },   // 0x53 'S'
+  {  3678,  27,  34,  30,    1,  -33 },   // 0x54 'T'
+  {  3793,  26,  35,  34,    4,  -33 },   // 0x55 'U'
+  {  3907,  29,  34,  30,    1,  -33 },   // 0x56 'V'
+  {  4031,  42,  34,  44,    1,  -33 },   // 0x57 'W'
+  {  4210,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
+  {  4338,  26,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  4449,   9,  44,  13,    3,  -33 },   // 0x5B '['
+  {  4499,   9,  44,  13,    1,  -33 },   // 0x5D ']'
+  {  4549,  28,   2,  26,   -1,    7 },   // 0x5F '_'
+  {  4556,  24,  27,  26,    1,  -25 },   // 0x61 'a'
+  {  4637,  22,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  4734,  21,  27,  24,    1,  -25 },   // 0x63 'c'
+  {  4805,  22,  35,  26,    1,  -33 },   // 0x64 'd'
+  {  4902,  23,  27,  25,    1,  -25 },   // 0x65 'e'
+  {  4980,  11,  34,  13,    1,  -33 },   // 0x66 'f'
+  {  5027,  22,  36,  26,    1,  -25 },   // 0x67 'g'
+  {  5126,  19,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  5207,   4,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  5224,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  5314,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  5331,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  5435,  19,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  5497,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
+  {  5575,  22,  36,  26,    3,  -25 },   // 0x70 'p'
+  {  5674,  22,  36,  26,    1,  -25 },   // 0x71 'q'
+  {  5773,  12,  26,  16,    3,  -25 },   // 0x72 'r'
+  {  5812,  20,  27,  23,    2,  -25 },   // 0x73 's'
+  {  5880,  11,  33,  13,    1,  -31 },   // 0x74 't'
+  {  5926,  19,  26,  25,    3,  -24 },   // 0x75 'u'
+  {  5988,  23,  25,  23,    0,  -24 },   // 0x76 'v'
+  {  6060,  33,  25,  34,    0,  -24 },   // 0x77 'w'
+  {  6164,  22,  25,  22,    0,  -24 },   // 0x78 'x'
+  {  6233,  22,  35,  22,    0,  -24 },   // 0x79 'y'
+  {  6330,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  6393,   3,  44,  12,    4,  -33 },   // 0x7C '|'
+  {  6410,  14,  14,  28,    7,  -31 },   // 0xB0 ''
+  {  6435,  14,  20,  16,    1,  -37 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_24pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_24pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_24pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_24pt8bGlyphs,
+  0x20, 0x6F, 56 };
+
+// Approx. 7261 bytes
@@ -0,0 +1,748 @@
+const uint8_t FreeSans_subset_26pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x00, 0xF0, 0x00,
+  0x1F, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x80, 0x01, 0xFF,
+  0xF0, 0x00, 0xE0, 0x00, 0x7C, 0x3E, 0x00, 0x38, 0x00, 0x1F, 0x01, 0xE0,
+  0x07, 0x00, 0x03, 0xC0, 0x1C, 0x01, 0xC0, 0x00, 0x70, 0x03, 0xC0, 0x38,
+  0x00, 0x1E, 0x00, 0x78, 0x0E, 0x00, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x00,
+  0x38, 0x01, 0xE0, 0x70, 0x00, 0x07, 0x80, 0x3C, 0x1E, 0x00, 0x00, 0xF0,
+  0x0F, 0x03, 0x80, 0x00, 0x0F, 0x03, 0xE0, 0xF0, 0x00, 0x01, 0xFF, 0xF8,
+  0x1C, 0x00, 0x00, 0x1F, 0xFE, 0x07, 0x80, 0x00, 0x01, 0xFF, 0x80, 0xE0,
+  0x00, 0x00, 0x0F, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x38, 0x07, 0xF8, 0x00,
+  0x00, 0x0E, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0xFF, 0xFC, 0x00, 0x00,
+  0x70, 0x1F, 0x0F, 0x80, 0x00, 0x0E, 0x07, 0x80, 0x78, 0x00, 0x03, 0x80,
+  0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x1C, 0x00, 0xF0, 0x00, 0x1C, 0x07, 0x80,
+  0x1E, 0x00, 0x07, 0x80, 0xF0, 0x03, 0xC0, 0x00, 0xE0, 0x1E, 0x00, 0x78,
+  0x00, 0x3C, 0x01, 0xC0, 0x0E, 0x00, 0x07, 0x00, 0x3C, 0x03, 0xC0, 0x01,
+  0xE0, 0x07, 0xC0, 0xF8, 0x00, 0x38, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0x00,
+  0x07, 0xFF, 0x80, 0x01, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x78, 0x00, 0x03,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0xE0, 0x38, 0x0E,
+  0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x70, 0x1E, 0x03, 0x80, 0xF0, 0x1E,
+  0x03, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x70, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3C, 0x03, 0x80, 0x78, 0x0F, 0x01, 0xE0, 0x1C, 0x03, 0xC0, 0x78,
+  0x07, 0x00, 0xF0, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x07, 0x00,
+  0x70, 0x07, 0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x38, 0x07, 0x80,
+  0x70, 0x0F, 0x01, 0xE0, 0x1C, 0x03, 0xC0, 0x78, 0x07, 0x00, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0xC0, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0E, 0x03, 0xC0, 0x78, 0x0E, 0x03, 0xC0, 0x78, 0x0E, 0x03, 0xC0,
+  0x70, 0x1E, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x71, 0xC7, 0x1C, 0x63, 0xBC, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70,
+  0x03, 0x80, 0x0E, 0x00, 0x38, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0xE0,
+  0x03, 0x80, 0x0E, 0x00, 0x30, 0x01, 0xC0, 0x07, 0x00, 0x18, 0x00, 0xE0,
+  0x03, 0x80, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0xE0,
+  0x03, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xF0, 0x1F, 0xC3, 0xF8, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0x7C,
+  0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E,
+  0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E,
+  0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C,
+  0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0,
+  0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x38, 0x03,
+  0xC0, 0x1E, 0x00, 0xF0, 0x0F, 0x80, 0xFC, 0x0F, 0xE7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F,
+  0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0xFF,
+  0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x1F, 0x81,
+  0xFC, 0x3F, 0x00, 0x7E, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00,
+  0x1F, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x1F, 0x78, 0x00,
+  0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
+  0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xF8, 0x3F, 0x81, 0xF8, 0x3E, 0x00, 0xFC, 0x7C, 0x00, 0x7C, 0x7C, 0x00,
+  0x3C, 0x78, 0x00, 0x3E, 0x78, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00,
+  0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x03,
+  0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
+  0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E, 0x7C, 0x00,
+  0x3E, 0x7E, 0x00, 0x7C, 0x3F, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1E, 0xF0, 0x00,
+  0x1E, 0x78, 0x00, 0x1F, 0x3C, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x00,
+  0x0F, 0x87, 0x80, 0x07, 0x83, 0xC0, 0x07, 0x81, 0xE0, 0x07, 0xC0, 0xF0,
+  0x07, 0xC0, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x1E, 0x03, 0xE0, 0x0F,
+  0x01, 0xE0, 0x07, 0x81, 0xE0, 0x03, 0xC1, 0xF0, 0x01, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC,
+  0x1F, 0xFF, 0xFC, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x7F, 0x00, 0x3D, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F, 0x81, 0xFC, 0x7E, 0x00, 0xFE,
+  0x7C, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E,
+  0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7C, 0x3F, 0x81, 0xF8, 0x1F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
+  0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x0F, 0xC1, 0xF8,
+  0x1F, 0x80, 0x7C, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E,
+  0x3C, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0xF8, 0x3F, 0x80, 0xF9, 0xFF, 0xE0, 0xFB, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xF8, 0xFF, 0xC1, 0xFC, 0xFF, 0x00, 0x7E, 0xFE, 0x00, 0x3E,
+  0xFC, 0x00, 0x1E, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0x78, 0x00, 0x0F, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x1F,
+  0x7C, 0x00, 0x1F, 0x3C, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x00, 0x7C,
+  0x1F, 0xC1, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
+  0x00, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
+  0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
+  0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+  0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x1F, 0x81, 0xF8, 0x3F, 0x00, 0xFC,
+  0x3E, 0x00, 0x7C, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E,
+  0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C,
+  0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0x01, 0xFC, 0x7E, 0x00, 0x7E,
+  0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x81, 0xFC,
+  0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
+  0x00, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0,
+  0x3F, 0x83, 0xF8, 0x3E, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x3C,
+  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
+  0x78, 0x00, 0x3F, 0x7C, 0x00, 0x7F, 0x7E, 0x00, 0xFF, 0x3F, 0x83, 0xFF,
+  0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xDF, 0x07, 0xFF, 0x9F, 0x01, 0xFC, 0x1F,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E,
+  0x78, 0x00, 0x3E, 0x78, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0xF8,
+  0x3E, 0x01, 0xF8, 0x3F, 0x83, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0,
+  0x07, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+  0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
+  0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+  0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0xFF,
+  0xFC, 0x3F, 0x03, 0xF9, 0xF0, 0x07, 0xE7, 0x80, 0x0F, 0xBE, 0x00, 0x1F,
+  0xF8, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0x00,
+  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
+  0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0x1F, 0xF8, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00,
+  0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00,
+  0x78, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x01,
+  0xF0, 0x1F, 0x80, 0x01, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x80, 0x03,
+  0xE0, 0x0F, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07,
+  0xC0, 0x03, 0xE0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x1F,
+  0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0xFC, 0x3E,
+  0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7E, 0x7C,
+  0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+  0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x7F, 0x8F, 0x80, 0x01, 0xF8,
+  0xF8, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0x7C, 0xF8, 0x00, 0x07, 0xCF, 0x80,
+  0x00, 0x7C, 0xF8, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x7C, 0xF8, 0x00, 0x07,
+  0xCF, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x0F, 0x8F, 0x80, 0x03, 0xF0, 0xFF,
+  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0x00, 0x3F, 0xCF, 0x80, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xEF,
+  0x80, 0x00, 0x3E, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3E,
+  0xF8, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x7E, 0xF8, 0x00, 0x1F, 0xCF, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xE0, 0x03,
+  0xF8, 0x0F, 0xC0, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00,
+  0x7C, 0x3E, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00,
+  0x3E, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00,
+  0x1F, 0x7C, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
+  0x3E, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
+  0xFC, 0x0F, 0xE0, 0x03, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x03, 0xFF, 0xFF,
+  0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
+  0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x7F, 0x83, 0xE0, 0x00, 0x7F, 0x0F,
+  0x80, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xF3, 0xE0,
+  0x00, 0x07, 0xCF, 0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x3E, 0xF8, 0x00,
+  0x00, 0xFB, 0xE0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00,
+  0x1E, 0xF8, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x07,
+  0xBE, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x01, 0xEF,
+  0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFB, 0xE0,
+  0x00, 0x03, 0xEF, 0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x7C, 0xF8, 0x00,
+  0x03, 0xF3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x7E, 0x3E, 0x00, 0x07,
+  0xF0, 0xF8, 0x00, 0x7F, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xDF,
+  0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0x80, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+  0x9F, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
+  0xFF, 0xE0, 0x03, 0xFE, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0xFC,
+  0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x1F, 0x0F,
+  0x80, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x00, 0x3E,
+  0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0xF7,
+  0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x07,
+  0xCF, 0xC0, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00,
+  0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x3E, 0xF0, 0x3F, 0xE0,
+  0x7F, 0x3C, 0x07, 0xFF, 0xFF, 0x8F, 0x00, 0xFF, 0xFF, 0xC1, 0xC0, 0x0F,
+  0xFF, 0xC0, 0x70, 0x00, 0x7F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xC0,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00,
+  0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
+  0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E,
+  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
+  0x1F, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF,
+  0x80, 0x0F, 0xFC, 0x00, 0x7B, 0xE0, 0x07, 0xDF, 0x80, 0x3E, 0x7C, 0x03,
+  0xF3, 0xF8, 0x3F, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0xFF, 0xF0, 0x01,
+  0xFE, 0x00, 0xF8, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x0F, 0xCF, 0x80, 0x00,
+  0x7E, 0x3E, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0xFC,
+  0x0F, 0x80, 0x07, 0xE0, 0x3E, 0x00, 0x3F, 0x00, 0xF8, 0x01, 0xF8, 0x03,
+  0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x7E, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0xF8,
+  0x1F, 0x80, 0x03, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x3E, 0x3F,
+  0x80, 0x00, 0xF9, 0xFE, 0x00, 0x03, 0xEF, 0xFC, 0x00, 0x0F, 0xFD, 0xF8,
+  0x00, 0x3F, 0xE3, 0xE0, 0x00, 0xFF, 0x07, 0xC0, 0x03, 0xF8, 0x1F, 0x80,
+  0x0F, 0xC0, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF8, 0x03,
+  0xE0, 0x03, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x3E, 0x00, 0x1F, 0x80, 0xF8,
+  0x00, 0x3F, 0x03, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x01, 0xF8, 0x3E, 0x00,
+  0x03, 0xF0, 0xF8, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00,
+  0x3F, 0x3E, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x01,
+  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0,
+  0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00,
+  0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03,
+  0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0x00, 0x0F,
+  0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
+  0x00, 0x0F, 0x7F, 0xFC, 0x00, 0x01, 0xEF, 0xFF, 0xC0, 0x00, 0x3D, 0xFF,
+  0x78, 0x00, 0x0F, 0x3F, 0xEF, 0x00, 0x01, 0xE7, 0xFD, 0xF0, 0x00, 0x3C,
+  0xFF, 0x9E, 0x00, 0x0F, 0x1F, 0xF3, 0xC0, 0x01, 0xE3, 0xFE, 0x7C, 0x00,
+  0x3C, 0x7F, 0xC7, 0x80, 0x0F, 0x0F, 0xF8, 0xF0, 0x01, 0xE1, 0xFF, 0x1F,
+  0x00, 0x3C, 0x3F, 0xE1, 0xE0, 0x0F, 0x07, 0xFC, 0x3C, 0x01, 0xE0, 0xFF,
+  0x87, 0xC0, 0x3C, 0x1F, 0xF0, 0x78, 0x0F, 0x03, 0xFE, 0x0F, 0x01, 0xE0,
+  0x7F, 0xC1, 0xF0, 0x3C, 0x0F, 0xF8, 0x1E, 0x0F, 0x01, 0xFF, 0x03, 0xC1,
+  0xE0, 0x3F, 0xE0, 0x3C, 0x3C, 0x07, 0xFC, 0x07, 0x8F, 0x00, 0xFF, 0x80,
+  0xF1, 0xE0, 0x1F, 0xF0, 0x0F, 0x3C, 0x03, 0xFE, 0x01, 0xEF, 0x00, 0x7F,
+  0xC0, 0x3D, 0xE0, 0x0F, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0x00,
+  0x3F, 0xE0, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0x1F,
+  0x00, 0x1E, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F,
+  0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xDF,
+  0x00, 0x03, 0xFE, 0x7C, 0x00, 0x1F, 0xF3, 0xF0, 0x00, 0xFF, 0x8F, 0x80,
+  0x07, 0xFC, 0x3E, 0x00, 0x3F, 0xE1, 0xF8, 0x01, 0xFF, 0x07, 0xC0, 0x0F,
+  0xF8, 0x1F, 0x00, 0x7F, 0xC0, 0xF8, 0x03, 0xFE, 0x03, 0xE0, 0x1F, 0xF0,
+  0x0F, 0x80, 0xFF, 0x80, 0x7C, 0x07, 0xFC, 0x01, 0xF0, 0x3F, 0xE0, 0x0F,
+  0xC1, 0xFF, 0x00, 0x3E, 0x0F, 0xF8, 0x00, 0xF8, 0x7F, 0xC0, 0x07, 0xE3,
+  0xFE, 0x00, 0x1F, 0x1F, 0xF0, 0x00, 0x7C, 0xFF, 0x80, 0x03, 0xE7, 0xFC,
+  0x00, 0x0F, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFF,
+  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x03,
+  0xFE, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F,
+  0x01, 0xF8, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00,
+  0x00, 0xFC, 0x3E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0x7E, 0x7C,
+  0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x01,
+  0xEF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xE7, 0xC0, 0x00,
+  0x00, 0x3E, 0x7C, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0x7E, 0x3E,
+  0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x0F,
+  0x81, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x7F, 0x00,
+  0x0F, 0xE0, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
+  0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xFF, 0xFF, 0xCF, 0x80, 0x07, 0xF9, 0xF0, 0x00, 0x3F, 0xBE, 0x00, 0x01,
+  0xF7, 0xC0, 0x00, 0x3E, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
+  0xFE, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0x9F, 0xFF,
+  0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x81,
+  0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
+  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
+  0x03, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00,
+  0x7F, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x0F, 0x83, 0xF0,
+  0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0x7E,
+  0x7C, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00,
+  0x01, 0xEF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xE7, 0xC0,
+  0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x20, 0x7E,
+  0x3E, 0x00, 0x03, 0x07, 0xC3, 0xF0, 0x00, 0x78, 0xFC, 0x1F, 0x00, 0x07,
+  0xCF, 0x81, 0xF8, 0x00, 0x3F, 0xF8, 0x0F, 0xC0, 0x01, 0xFF, 0x00, 0x7F,
+  0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x7E, 0x00, 0x03, 0xFC,
+  0x03, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xFF, 0xF0, 0xF8, 0x00, 0x1F, 0xE3, 0xE0, 0x00, 0x0F, 0xCF, 0x80, 0x00,
+  0x3F, 0x3E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x07,
+  0xCF, 0x80, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x01, 0xF3,
+  0xE0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x3E, 0x3E, 0x00, 0x01, 0xF8, 0xF8,
+  0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x83, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00,
+  0x3E, 0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x07,
+  0xCF, 0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x01, 0xF3,
+  0xE0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x7C, 0xF8,
+  0x00, 0x01, 0xF3, 0xE0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x1F, 0xBE, 0x00,
+  0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF,
+  0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0x1F,
+  0xC0, 0x7E, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x7C,
+  0x3E, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x0F, 0x0F,
+  0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
+  0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFE,
+  0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x7D, 0xE0, 0x00, 0x01, 0xE7, 0xC0,
+  0x00, 0x0F, 0x9F, 0x80, 0x00, 0x3E, 0x3F, 0x00, 0x01, 0xF0, 0xFE, 0x00,
+  0x0F, 0xC1, 0xFF, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
+  0x80, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x1F, 0x3E, 0x00, 0x00,
+  0xF9, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xFC, 0x3F, 0x00, 0x0F, 0xE0,
+  0xFF, 0x83, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
+  0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0x7D, 0xF0, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x03, 0xE7, 0xC0, 0x00,
+  0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00,
+  0x78, 0x1F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x07,
+  0x80, 0x7C, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x78,
+  0x01, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0x80,
+  0x07, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x0F, 0x80, 0x78, 0x00,
+  0x1F, 0x01, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x3E, 0x07, 0x80, 0x00,
+  0x7C, 0x1F, 0x00, 0x00, 0x78, 0x3E, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x01,
+  0xF1, 0xF0, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x07,
+  0xDF, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
+  0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
+  0xE0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x9F,
+  0x00, 0x07, 0xF0, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0xE0, 0x00, 0xF9, 0xF0,
+  0x00, 0x7F, 0x80, 0x07, 0xE7, 0xE0, 0x03, 0xFE, 0x00, 0x1F, 0x0F, 0x80,
+  0x0F, 0xFC, 0x00, 0x7C, 0x3E, 0x00, 0x3D, 0xF0, 0x01, 0xF0, 0xF8, 0x00,
+  0xF3, 0xC0, 0x0F, 0xC3, 0xF0, 0x07, 0xCF, 0x00, 0x3E, 0x07, 0xC0, 0x1E,
+  0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x78, 0xF8, 0x03, 0xE0, 0x7C, 0x01, 0xE1,
+  0xE0, 0x0F, 0x01, 0xF0, 0x0F, 0x87, 0x80, 0x7C, 0x03, 0xE0, 0x3C, 0x1F,
+  0x01, 0xF0, 0x0F, 0x80, 0xF0, 0x3C, 0x07, 0xC0, 0x3E, 0x07, 0xC0, 0xF0,
+  0x1E, 0x00, 0xF8, 0x1F, 0x03, 0xE0, 0xF8, 0x01, 0xF0, 0x78, 0x0F, 0x83,
+  0xE0, 0x07, 0xC1, 0xE0, 0x1E, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x78, 0x3C,
+  0x00, 0x3C, 0x3C, 0x01, 0xF0, 0xF0, 0x00, 0xF8, 0xF0, 0x03, 0xC7, 0xC0,
+  0x03, 0xE3, 0xC0, 0x0F, 0x1F, 0x00, 0x0F, 0x9F, 0x00, 0x3E, 0x78, 0x00,
+  0x1E, 0x78, 0x00, 0xF9, 0xE0, 0x00, 0x79, 0xE0, 0x01, 0xEF, 0x80, 0x01,
+  0xFF, 0x80, 0x07, 0xBE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0,
+  0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x1F, 0x9F,
+  0x80, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x0F, 0xC0,
+  0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x03, 0xE0,
+  0x07, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xF0,
+  0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xE0, 0xF8,
+  0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3F, 0x7E,
+  0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+  0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
+  0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
+  0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C,
+  0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07,
+  0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0,
+  0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F,
+  0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+  0x00, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xF0,
+  0x1F, 0x83, 0xE0, 0x07, 0xC1, 0xF0, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0x78,
+  0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0x00,
+  0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0xFF, 0xF0, 0xF0,
+  0x7F, 0x00, 0x78, 0x7E, 0x00, 0x3C, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x0F,
+  0x0F, 0x00, 0x07, 0x87, 0x80, 0x03, 0xC3, 0xC0, 0x03, 0xE1, 0xF0, 0x03,
+  0xF0, 0xFC, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xCF, 0xE3, 0xFF,
+  0x87, 0xF0, 0x7F, 0x01, 0xF8, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0xF1,
+  0xFF, 0xC0, 0xF3, 0xFF, 0xF0, 0xF7, 0xFF, 0xF8, 0xFF, 0x83, 0xF8, 0xFF,
+  0x00, 0xFC, 0xFE, 0x00, 0x7C, 0xFC, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8,
+  0x00, 0x1E, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0,
+  0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E, 0xFC,
+  0x00, 0x3E, 0xFE, 0x00, 0x7C, 0xFF, 0x00, 0xFC, 0xFF, 0x83, 0xF8, 0xF7,
+  0xFF, 0xF0, 0xF3, 0xFF, 0xE0, 0xF1, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00,
+  0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0x83,
+  0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0F, 0x9E, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+  0xE0, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
+  0x0F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xF8, 0x00, 0x7D, 0xE0, 0x01, 0xF7,
+  0xC0, 0x07, 0x8F, 0x80, 0x3E, 0x3F, 0x83, 0xF0, 0x7F, 0xFF, 0xC0, 0xFF,
+  0xFE, 0x01, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
+  0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x01, 0xF8, 0x3C,
+  0x1F, 0xFC, 0x78, 0x7F, 0xFE, 0xF1, 0xFF, 0xFF, 0xE7, 0xF0, 0x7F, 0xCF,
+  0x80, 0x3F, 0xBE, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0,
+  0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00,
+  0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
+  0x7F, 0x80, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xDF, 0x00, 0x0F,
+  0xBE, 0x00, 0x3F, 0x3E, 0x00, 0xFE, 0x7F, 0x07, 0xFC, 0x7F, 0xFF, 0xB8,
+  0x7F, 0xFE, 0x70, 0x7F, 0xF8, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
+  0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0x83, 0xF8,
+  0x3E, 0x00, 0xFC, 0x7C, 0x00, 0x7C, 0x78, 0x00, 0x3C, 0xF8, 0x00, 0x3E,
+  0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xFF, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E,
+  0x78, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0x3E, 0x00, 0xFC, 0x3F, 0x81, 0xF8,
+  0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
+  0x01, 0xF0, 0x7F, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x0F,
+  0xFE, 0x3C, 0x3F, 0xFE, 0x78, 0xFF, 0xFE, 0xF3, 0xF8, 0x3F, 0xE7, 0xC0,
+  0x1F, 0xDF, 0x00, 0x1F, 0xBC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
+  0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03,
+  0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
+  0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xEF, 0x00, 0x0F, 0xDF,
+  0x00, 0x1F, 0x9F, 0x00, 0x7F, 0x3F, 0x83, 0xDE, 0x3F, 0xFF, 0xBC, 0x3F,
+  0xFE, 0x78, 0x3F, 0xF8, 0xF0, 0x1F, 0xC3, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+  0x0F, 0x7C, 0x00, 0x1E, 0x78, 0x00, 0x7C, 0xF8, 0x00, 0xF1, 0xF8, 0x07,
+  0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0x80,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0x83, 0xF8, 0x3C, 0x7F, 0xF1, 0xE7, 0xFF, 0xCF, 0x7F, 0xFF, 0x7F,
+  0x80, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x03,
+  0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
+  0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
+  0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
+  0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x07, 0xE7, 0x80,
+  0x1F, 0x8F, 0x00, 0x7E, 0x1E, 0x01, 0xF8, 0x3C, 0x07, 0xE0, 0x78, 0x1F,
+  0x80, 0xF0, 0x7E, 0x01, 0xE1, 0xF8, 0x03, 0xC7, 0xE0, 0x07, 0x9F, 0x80,
+  0x0F, 0x7F, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3E, 0x00,
+  0xFC, 0x3E, 0x01, 0xF0, 0x7E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x7C, 0x0F,
+  0x00, 0xF8, 0x1E, 0x00, 0xF8, 0x3C, 0x01, 0xF8, 0x78, 0x01, 0xF0, 0xF0,
+  0x01, 0xF1, 0xE0, 0x03, 0xF3, 0xC0, 0x03, 0xE7, 0x80, 0x07, 0xEF, 0x00,
+  0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00,
+  0xFE, 0x1E, 0x3F, 0xF0, 0x7F, 0xF3, 0xCF, 0xFF, 0x1F, 0xFF, 0x7B, 0xFF,
+  0xF7, 0xFF, 0xEF, 0xF0, 0x7F, 0xE0, 0x7F, 0xF8, 0x07, 0xF8, 0x07, 0xFF,
+  0x00, 0x7E, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x0F, 0xF8, 0x01, 0xF0, 0x01,
+  0xFE, 0x00, 0x1E, 0x00, 0x3F, 0xC0, 0x03, 0xC0, 0x07, 0xF8, 0x00, 0x78,
+  0x00, 0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x01, 0xE0, 0x03, 0xFC, 0x00,
+  0x3C, 0x00, 0x7F, 0x80, 0x07, 0x80, 0x0F, 0xF0, 0x00, 0xF0, 0x01, 0xFE,
+  0x00, 0x1E, 0x00, 0x3F, 0xC0, 0x03, 0xC0, 0x07, 0xF8, 0x00, 0x78, 0x00,
+  0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x01, 0xE0, 0x03, 0xFC, 0x00, 0x3C,
+  0x00, 0x7F, 0x80, 0x07, 0x80, 0x0F, 0xF0, 0x00, 0xF0, 0x01, 0xFE, 0x00,
+  0x1E, 0x00, 0x3F, 0xC0, 0x03, 0xC0, 0x07, 0xF8, 0x00, 0x78, 0x00, 0xF0,
+  0x00, 0x3F, 0x07, 0x87, 0xFE, 0x3C, 0xFF, 0xFD, 0xEF, 0xFF, 0xEF, 0x70,
+  0x1F, 0xFF, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
+  0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00,
+  0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC,
+  0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01,
+  0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
+  0x00, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xF0, 0x3F, 0x83, 0xF8, 0x3E, 0x00, 0xFC, 0x7C, 0x00, 0x7C, 0x7C,
+  0x00, 0x3C, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF0, 0x00, 0x1E, 0xF0,
+  0x00, 0x1E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0,
+  0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF8,
+  0x00, 0x3E, 0xF8, 0x00, 0x3E, 0x78, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0x3E,
+  0x00, 0xFC, 0x3F, 0x83, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07,
+  0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0xF1, 0xFF, 0xC0, 0xF3,
+  0xFF, 0xE0, 0xF7, 0xFF, 0xF0, 0xFF, 0x83, 0xF8, 0xFF, 0x00, 0xFC, 0xFE,
+  0x00, 0x7C, 0xFC, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x1E, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0,
+  0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E, 0xFC, 0x00, 0x3E, 0xFE,
+  0x00, 0x7C, 0xFF, 0x00, 0xFC, 0xFF, 0x83, 0xF8, 0xF7, 0xFF, 0xF8, 0xF3,
+  0xFF, 0xF0, 0xF1, 0xFF, 0xC0, 0xF0, 0x7F, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFE, 0x1C, 0x3F, 0xFF, 0x38, 0xFF,
+  0xFF, 0x73, 0xF8, 0x3F, 0xE7, 0xC0, 0x1F, 0xDF, 0x00, 0x1F, 0xBE, 0x00,
+  0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
+  0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFF,
+  0x80, 0x03, 0xEF, 0x80, 0x07, 0xDF, 0x00, 0x1F, 0xBF, 0x00, 0x7F, 0x3F,
+  0x83, 0xFE, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0x78, 0x3F, 0xFC, 0xF0, 0x0F,
+  0xE1, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x8F, 0xFC, 0xFF,
+  0xEF, 0xFF, 0x7F, 0xFF, 0x83, 0xF8, 0x1F, 0x80, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
+  0x80, 0x3C, 0x01, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0xFC, 0x07, 0xFF,
+  0xF0, 0x7F, 0xFF, 0xC7, 0xE0, 0x3F, 0x3E, 0x00, 0xF9, 0xE0, 0x07, 0xDF,
+  0x00, 0x1E, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x00,
+  0x03, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
+  0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x07,
+  0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x1F, 0x7E, 0x03, 0xF3, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF8, 0x3F, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x0F, 0xF0,
+  0x7F, 0x03, 0xF0, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
+  0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F,
+  0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
+  0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
+  0xFF, 0xE0, 0x0F, 0xEF, 0xC0, 0xFF, 0x7F, 0xFF, 0xF9, 0xFF, 0xFB, 0xC7,
+  0xFF, 0x1E, 0x0F, 0xF0, 0x00, 0x78, 0x00, 0x0F, 0xBE, 0x00, 0x0F, 0x9F,
+  0x00, 0x07, 0xC7, 0x80, 0x03, 0xC3, 0xE0, 0x03, 0xE1, 0xF0, 0x01, 0xF0,
+  0x78, 0x00, 0xF0, 0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x07, 0x80, 0x3C,
+  0x03, 0xE0, 0x3E, 0x01, 0xF0, 0x1E, 0x00, 0x78, 0x0F, 0x00, 0x3E, 0x0F,
+  0x80, 0x0F, 0x07, 0x80, 0x07, 0x83, 0xC0, 0x03, 0xE3, 0xC0, 0x00, 0xF1,
+  0xE0, 0x00, 0x78, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x07,
+  0xBC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00, 0xF8, 0x01, 0xF7, 0xC0,
+  0x1F, 0x80, 0x1F, 0x7C, 0x01, 0xFC, 0x01, 0xF7, 0xC0, 0x1F, 0xC0, 0x1E,
+  0x3C, 0x01, 0xFC, 0x03, 0xE3, 0xE0, 0x3F, 0xC0, 0x3E, 0x3E, 0x03, 0xFE,
+  0x03, 0xC1, 0xE0, 0x3D, 0xE0, 0x3C, 0x1E, 0x03, 0xDE, 0x07, 0xC1, 0xF0,
+  0x79, 0xE0, 0x78, 0x1F, 0x07, 0x9F, 0x07, 0x80, 0xF0, 0x78, 0xF0, 0x78,
+  0x0F, 0x07, 0x8F, 0x0F, 0x80, 0xF8, 0xF0, 0xF0, 0xF0, 0x07, 0x8F, 0x0F,
+  0x8F, 0x00, 0x78, 0xF0, 0x78, 0xF0, 0x07, 0x8F, 0x07, 0x9E, 0x00, 0x7D,
+  0xE0, 0x79, 0xE0, 0x03, 0xDE, 0x07, 0xDE, 0x00, 0x3D, 0xE0, 0x3D, 0xE0,
+  0x03, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x01, 0xFC, 0x03,
+  0xFC, 0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F,
+  0x80, 0x1F, 0x80, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x3E,
+  0x00, 0x3C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x80, 0xF0, 0x07,
+  0x81, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE3, 0xC0, 0x01, 0xE7, 0xC0, 0x01,
+  0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x01,
+  0xF7, 0x80, 0x03, 0xE7, 0xC0, 0x03, 0xC3, 0xE0, 0x07, 0xC1, 0xE0, 0x0F,
+  0x81, 0xF0, 0x0F, 0x00, 0xF8, 0x1F, 0x00, 0x78, 0x3E, 0x00, 0x7C, 0x3C,
+  0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1F, 0x7C, 0x00, 0x1E, 0x7C,
+  0x00, 0x3E, 0x3C, 0x00, 0x3E, 0x3E, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1E,
+  0x00, 0x78, 0x1E, 0x00, 0x78, 0x1F, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x81, 0xF0, 0x07, 0x81, 0xE0, 0x07, 0x83, 0xE0, 0x07,
+  0xC3, 0xE0, 0x03, 0xC3, 0xC0, 0x03, 0xC7, 0xC0, 0x03, 0xE7, 0x80, 0x01,
+  0xE7, 0x80, 0x01, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F,
+  0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+  0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
+  0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00,
+  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xE0,
+  0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0x3F, 0xE0, 0xFF, 0xE3, 0xC3, 0xEF,
+  0x01, 0xDC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80,
+  0x3F, 0x80, 0xE7, 0x87, 0xC7, 0xFF, 0x07, 0xFC, 0x03, 0xE0, 0x01, 0x80,
+  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3E, 0x78, 0x1E, 0x70, 0x0E, 0x70, 0x0F,
+  0xF0, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE };
+
+const GFXglyph FreeSans_subset_26pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
+  {     1,   5,  37,  17,    6,  -36 },   // 0x21 '!'
+  {    25,  43,  38,  45,    1,  -36 },   // 0x25 '%'
+  {   230,   4,  12,  10,    3,  -36 },   // 0x27 '''
+  {   236,  11,  48,  17,    4,  -36 },   // 0x28 '('
+  {   302,  11,  48,  17,    2,  -36 },   // 0x29 ')'
+  {   368,  24,  25,  30,    3,  -23 },   // 0x2B '+'
+  {   443,   6,  13,  14,    4,   -4 },   // 0x2C ','
+  {   453,  13,   4,  17,    2,  -15 },   // 0x2D '-'
+  {   460,   5,   5,  13,    4,   -4 },   // 0x2E '.'
+  {   464,  14,  38,  14,    0,  -36 },   // 0x2F '/'
+  {   531,  24,  38,  28,    2,  -36 },   // 0x30 '0'
+  {   645,  13,  37,  28,    5,  -36 },   // 0x31 '1'
+  {   706,  24,  37,  28,    2,  -36 },   // 0x32 '2'
+  {   817,  24,  38,  28,    2,  -36 },   // 0x33 '3'
+  {   931,  25,  37,  28,    1,  -36 },   // 0x34 '4'
+  {  1047,  24,  38,  28,    2,  -36 },   // 0x35 '5'
+  {  1161,  24,  38,  28,    2,  -36 },   // 0x36 '6'
+  {  1275,  24,  37,  28,    2,  -36 },   // 0x37 '7'
+  {  1386,  24,  38,  28,    2,  -36 },   // 0x38 '8'
+  {  1500,  24,  38,  28,    2,  -36 },   // 0x39 '9'
+  {  1614,   5,  27,  13,    4,  -26 },   // 0x3A ':'
+  {  1631,  24,  25,  30,    3,  -23 },   // 0x3E '>'
+  {  1706,  22,  38,  28,    4,  -37 },   // 0x3F '?'
+  {  1811,  32,  37,  34,    1,  -36 },   // 0x41 'A'
+  {  1959,  28,  37,  34,    4,  -36 },   // 0x42 'B'
+  {  2089,  32,  39,  36,    2,  -37 },   // 0x43 'C'
+  {  2245,  30,  37,  36,    4,  -36 },   // 0x44 'D'
+  {  2384,  27,  37,  32,    4,  -36 },   // 0x45 'E'
+  {  2509,  25,  37,  31,    4,  -36 },   // 0x46 'F'
+  {  2625,  34,  39,  39,    2,  -37 },   // 0x47 'G'
+  {  2791,  29,  37,  37,    4,  -36 },   // 0x48 'H'
+  {  2926,   5,  37,  14,    5,  -36 },   // 0x49 'I'
+  {  2950,  21,  38,  27,    2,  -36 },   // 0x4A 'J'
+  {  3050,  30,  37,  34,    4,  -36 },   // 0x4B 'K'
+  {  3189,  23,  37,  29,    4,  -36 },   // 0x4C 'L'
+  {  3296,  35,  37,  43,    4,  -36 },   // 0x4D 'M'
+  {  3458,  29,  37,  37,    4,  -36 },   // 0x4E 'N'
+  {  3593,  36,  39,  40,    2,  -37 },   // 0x4F 'O'
+  {  3769,  27,  37,  33,    4,  -36 },   // 0x50 'P'
+  {  3894,  36,  41,  40,    2,  -37 },   // 0x51 'Q'
+  {  4079,  30,  37,  36,    4,  -36 },   // 0x52 'R'
+  {  4218,  30,  39,  34,    2,  -37 },   // 0x53 'S'
+  {  4365,  29,  37,  32,    2,  -36 },   // 0x54 'T'
+  {  4500,  29,  38,  37,    4,  -36 },   // 0x55 'U'
+  {  4638,  31,  37,  33,    1,  -36 },   // 0x56 'V'
+  {  4782,  46,  37,  48,    1,  -36 },   // 0x57 'W'
+  {  4995,  33,  37,  35,    1,  -36 },   // 0x59 'Y'
+  {  5148,  28,  37,  31,    2,  -36 },   // 0x5A 'Z'
+  {  5278,  10,  48,  14,    3,  -36 },   // 0x5B '['
+  {  5338,  10,  48,  14,    1,  -36 },   // 0x5D ']'
+  {  5398,  30,   3,  28,   -1,    7 },   // 0x5F '_'
+  {  5410,  25,  29,  28,    2,  -27 },   // 0x61 'a'
+  {  5501,  24,  38,  28,    3,  -36 },   // 0x62 'b'
+  {  5615,  22,  29,  26,    2,  -27 },   // 0x63 'c'
+  {  5695,  23,  38,  28,    2,  -36 },   // 0x64 'd'
+  {  5805,  24,  29,  27,    2,  -27 },   // 0x65 'e'
+  {  5892,  12,  37,  14,    1,  -36 },   // 0x66 'f'
+  {  5948,  23,  39,  28,    2,  -27 },   // 0x67 'g'
+  {  6061,  21,  37,  27,    3,  -36 },   // 0x68 'h'
+  {  6159,   5,  37,  11,    3,  -36 },   // 0x69 'i'
+  {  6183,  23,  37,  26,    3,  -36 },   // 0x6B 'k'
+  {  6290,   4,  37,  11,    3,  -36 },   // 0x6C 'l'
+  {  6309,  35,  28,  41,    3,  -27 },   // 0x6D 'm'
+  {  6432,  21,  28,  27,    3,  -27 },   // 0x6E 'n'
+  {  6506,  24,  29,  27,    2,  -27 },   // 0x6F 'o'
+  {  6593,  24,  39,  28,    3,  -27 },   // 0x70 'p'
+  {  6710,  23,  39,  28,    2,  -27 },   // 0x71 'q'
+  {  6823,  13,  28,  17,    3,  -27 },   // 0x72 'r'
+  {  6869,  21,  29,  25,    2,  -27 },   // 0x73 's'
+  {  6946,  12,  35,  14,    1,  -33 },   // 0x74 't'
+  {  6999,  21,  28,  27,    3,  -26 },   // 0x75 'u'
+  {  7073,  25,  27,  25,    0,  -26 },   // 0x76 'v'
+  {  7158,  36,  27,  37,    0,  -26 },   // 0x77 'w'
+  {  7280,  24,  27,  24,    0,  -26 },   // 0x78 'x'
+  {  7361,  24,  38,  24,    0,  -26 },   // 0x79 'y'
+  {  7475,  21,  27,  25,    2,  -26 },   // 0x7A 'z'
+  {  7546,   3,  48,  13,    5,  -36 },   // 0x7C '|'
+  {  7564,  15,  16,  31,    8,  -34 },   // 0xB0 ''
+  {  7594,  16,  22,  18,    1,  -41 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_26pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_26pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_26pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_26pt8bGlyphs,
+  0x20, 0x6F, 61 };
+
+// Approx. 8429 bytes
@@ -0,0 +1,370 @@
+const uint8_t FreeSans_subset_48pt8b_temperatureBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0x80,
+  0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x07,
+  0xFC, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xF8,
+  0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
+  0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x00,
+  0x7F, 0x83, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x7F,
+  0xC7, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC7,
+  0xFC, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xE7, 0xF8,
+  0x00, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xEF, 0xF8, 0x00,
+  0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x00,
+  0x01, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x00, 0x01,
+  0xFE, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x1F, 0xEF, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+  0xEF, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE7,
+  0xF8, 0x00, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xE7, 0xF8,
+  0x00, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00,
+  0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00,
+  0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0x83, 0xFE, 0x00, 0x00, 0x07,
+  0xF8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x07,
+  0xFC, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
+  0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0,
+  0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00,
+  0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
+  0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE,
+  0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
+  0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
+  0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
+  0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07,
+  0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
+  0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC,
+  0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0,
+  0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
+  0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00,
+  0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F,
+  0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xF0, 0x07, 0xFF,
+  0x80, 0x07, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00,
+  0x00, 0x3F, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00,
+  0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
+  0xF9, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x03, 0xFE,
+  0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x9F,
+  0xE0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFE,
+  0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
+  0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0x01,
+  0xFF, 0x81, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
+  0xE0, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8,
+  0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE1, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC7, 0xFC,
+  0x00, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBF,
+  0xE0, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE7, 0xF8,
+  0x00, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00,
+  0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00,
+  0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0x00,
+  0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x7F,
+  0xF8, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
+  0x00, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00,
+  0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00,
+  0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
+  0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFE,
+  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
+  0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03,
+  0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x3F,
+  0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
+  0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x07, 0xFF, 0x80, 0x00, 0x0F, 0xF1, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xBF,
+  0xFF, 0xFF, 0x00, 0x03, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
+  0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+  0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+  0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x3F,
+  0xE0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC,
+  0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x80,
+  0x00, 0x03, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00,
+  0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x7F,
+  0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC7,
+  0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
+  0xF0, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x0F, 0xF8,
+  0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x1F,
+  0xF0, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xE0,
+  0x00, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
+  0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0xF8, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x0F, 0xF8,
+  0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0x0F, 0xF9, 0xFF,
+  0xFF, 0xFF, 0x80, 0xFF, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x7F,
+  0xF8, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
+  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0xFF,
+  0xE0, 0x00, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC0,
+  0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x0F,
+  0xF7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF7,
+  0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF3, 0xFC,
+  0x00, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00,
+  0x00, 0x03, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xE1, 0xFE, 0x00, 0x00,
+  0x07, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x0F,
+  0xFC, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF8,
+  0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+  0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
+  0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
+  0xFF, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x3F, 0xF0,
+  0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00,
+  0x01, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00,
+  0x1F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x07,
+  0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+  0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC1,
+  0xFF, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x7F,
+  0xC0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xFC,
+  0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
+  0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+  0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x07,
+  0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x03, 0xFE,
+  0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00,
+  0x00, 0x1F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x00,
+  0x07, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
+  0xDF, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF7,
+  0xF8, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0xFF,
+  0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0,
+  0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00,
+  0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xF8, 0x00,
+  0x7F, 0xF8, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x1F,
+  0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
+  0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x87,
+  0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x8F, 0xF8,
+  0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xCF, 0xF8, 0x00,
+  0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00,
+  0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x01,
+  0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x01, 0xFE,
+  0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x7F, 0xC0, 0x00,
+  0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xE0, 0x00, 0x01,
+  0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x07, 0xFF,
+  0xF1, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xF0, 0x1F,
+  0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0xE0, 0x03, 0xFF,
+  0xFF, 0xC1, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x1F, 0xF8,
+  0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x7F, 0x80,
+  0x00, 0x00, 0x7F, 0x87, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00,
+  0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x03,
+  0xFE, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x07, 0xFC,
+  0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00,
+  0x7F, 0xFC, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+  0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x00, 0x7F,
+  0x87, 0xE0, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x1F, 0x9F,
+  0x00, 0x00, 0x7D, 0xF8, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x01,
+  0xF3, 0xE0, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0xFC, 0xFE, 0x00, 0x0F, 0xC3,
+  0xF8, 0x00, 0xFE, 0x1F, 0xE0, 0x0F, 0xE0, 0x7F, 0xE3, 0xFF, 0x01, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFE,
+  0x00, 0x00, 0x7F, 0x80, 0x00 };
+
+const GFXglyph FreeSans_subset_48pt8b_temperatureGlyphs[] PROGMEM = {
+  {     0,   1,   1,  75,    0,    0 },   // 0x20 ' '
+  {     1,   1,   1,  75,    0,    0 },   // 0x25 '%'
+  {     2,   1,   1,  75,    0,    0 },   // 0x28 '('
+  {     3,   1,   1,  75,    0,    0 },   // 0x29 ')'
+  {     4,   1,   1,  75,    0,    0 },   // 0x2B '+'
+  {     5,   1,   1,  75,    0,    0 },   // 0x2C ','
+  {     6,  23,   7,  31,    4,  -28 },   // 0x2D '-'
+  {    27,   9,  10,  24,    8,   -9 },   // 0x2E '.'
+  {    39,   1,   1,  75,    0,    0 },   // 0x2F '/'
+  {    40,  44,  69,  52,    4,  -66 },   // 0x30 '0'
+  {   420,  23,  67,  52,   10,  -66 },   // 0x31 '1'
+  {   613,  45,  67,  52,    3,  -66 },   // 0x32 '2'
+  {   990,  45,  69,  52,    3,  -66 },   // 0x33 '3'
+  {  1379,  46,  67,  52,    3,  -66 },   // 0x34 '4'
+  {  1765,  45,  69,  52,    3,  -66 },   // 0x35 '5'
+  {  2154,  44,  69,  52,    4,  -66 },   // 0x36 '6'
+  {  2534,  45,  67,  52,    4,  -66 },   // 0x37 '7'
+  {  2911,  45,  69,  52,    3,  -66 },   // 0x38 '8'
+  {  3300,  44,  69,  52,    4,  -66 },   // 0x39 '9'
+  {  3680,   1,   1,  75,    0,    0 },   // 0x3A ':'
+  {  3681,   1,   1,  75,    0,    0 },   // 0x3F '?'
+  {  3682,   1,   1,  75,    0,    0 },   // 0x7C '|'
+  {  3683,  29,  28,  57,   14,  -63 } }; // 0xB0 ''
+
+const uint8_t FreeSans_subset_48pt8b_temperatureRemap[] PROGMEM = {
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x22, 0x23, 0x00, 0x24,
+  0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+  0x31, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_48pt8b_temperature PROGMEM = {
+  (uint8_t  *)FreeSans_subset_48pt8b_temperatureBitmaps,
+  (GFXglyph *)FreeSans_subset_48pt8b_temperatureGlyphs,
+  0x20, 0x36, 113 };
+
+// Approx. 4177 bytes
@@ -0,0 +1,130 @@
+const uint8_t FreeSans_subset_4pt8bBitmaps[] PROGMEM = {
+  0x00, 0xF4, 0x49, 0x51, 0xC1, 0x22, 0xA9, 0x80, 0x80, 0x7E, 0x15, 0x58,
+  0x22, 0xF2, 0x80, 0xC0, 0x00, 0x1A, 0xA0, 0x69, 0x99, 0x96, 0x75, 0x50,
+  0x79, 0x12, 0xCF, 0x69, 0x21, 0x96, 0x26, 0x6A, 0xF2, 0x78, 0x61, 0x96,
+  0x69, 0xAD, 0x96, 0xF2, 0x24, 0x44, 0x69, 0x69, 0x96, 0x69, 0x97, 0x96,
+  0x00, 0x86, 0x1E, 0xE4, 0xA0, 0x80, 0x22, 0x94, 0xE8, 0xC4, 0xE9, 0xE9,
+  0x9E, 0x74, 0x61, 0x08, 0xB8, 0xE9, 0x99, 0x9E, 0xF8, 0xE8, 0x8F, 0xF3,
+  0xC9, 0x00, 0x7A, 0x08, 0x27, 0x85, 0xF0, 0x99, 0xF9, 0x99, 0xFC, 0x24,
+  0x9A, 0xC0, 0x9A, 0xCC, 0xA9, 0x92, 0x49, 0xC0, 0x8C, 0x67, 0xDE, 0xD4,
+  0x99, 0xDB, 0xB9, 0x7A, 0x28, 0x61, 0x85, 0xE0, 0xE9, 0x9E, 0x88, 0x7A,
+  0x28, 0x61, 0x85, 0xE0, 0xF9, 0x9E, 0x99, 0x74, 0x50, 0x78, 0xB8, 0xF9,
+  0x08, 0x42, 0x10, 0x99, 0x99, 0x9E, 0x8C, 0x94, 0xA6, 0x10, 0x93, 0x26,
+  0xAB, 0x66, 0x4C, 0x80, 0x8A, 0x94, 0x42, 0x10, 0xF8, 0x88, 0x84, 0x7C,
+  0xEA, 0xAB, 0xD5, 0x57, 0x70, 0x61, 0x79, 0xF0, 0x8F, 0x99, 0x9F, 0x69,
+  0x89, 0x60, 0x17, 0x99, 0x97, 0x69, 0xF9, 0x60, 0x7A, 0xA0, 0x79, 0x99,
+  0x79, 0x60, 0x8F, 0x99, 0x99, 0x7C, 0x8A, 0xCE, 0xA9, 0xFC, 0xEE, 0x59,
+  0x65, 0x94, 0xF9, 0x99, 0x90, 0x69, 0x99, 0x60, 0xF9, 0x99, 0xF8, 0x80,
+  0x79, 0x99, 0x71, 0x10, 0xEA, 0x80, 0x68, 0x69, 0x60, 0xBA, 0x90, 0x99,
+  0x99, 0x70, 0x9A, 0xA6, 0x40, 0xAA, 0xEB, 0x96, 0x50, 0xA6, 0x46, 0xA0,
+  0xAA, 0xA6, 0x44, 0x80, 0xE2, 0x44, 0xF0, 0x7C, 0xF8, 0xEB, 0x00 };
+
+const GFXglyph FreeSans_subset_4pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
+  {     1,   1,   6,   3,    1,   -5 },   // 0x21 '!'
+  {     2,   7,   6,   7,    0,   -5 },   // 0x25 '%'
+  {     8,   1,   2,   2,    0,   -5 },   // 0x27 '''
+  {     9,   1,   7,   3,    1,   -5 },   // 0x28 '('
+  {    10,   2,   7,   3,    0,   -5 },   // 0x29 ')'
+  {    12,   4,   4,   5,    0,   -3 },   // 0x2B '+'
+  {    14,   1,   2,   2,    1,    0 },   // 0x2C ','
+  {    15,   2,   1,   3,    0,   -2 },   // 0x2D '-'
+  {    16,   1,   1,   2,    1,    0 },   // 0x2E '.'
+  {    17,   2,   6,   2,    0,   -5 },   // 0x2F '/'
+  {    19,   4,   6,   4,    0,   -5 },   // 0x30 '0'
+  {    22,   2,   6,   4,    1,   -5 },   // 0x31 '1'
+  {    24,   4,   6,   4,    0,   -5 },   // 0x32 '2'
+  {    27,   4,   6,   4,    0,   -5 },   // 0x33 '3'
+  {    30,   4,   6,   4,    0,   -5 },   // 0x34 '4'
+  {    33,   4,   6,   4,    0,   -5 },   // 0x35 '5'
+  {    36,   4,   6,   4,    0,   -5 },   // 0x36 '6'
+  {    39,   4,   6,   4,    0,   -5 },   // 0x37 '7'
+  {    42,   4,   6,   4,    0,   -5 },   // 0x38 '8'
+  {    45,   4,   6,   4,    0,   -5 },   // 0x39 '9'
+  {    48,   1,   5,   2,    1,   -4 },   // 0x3A ':'
+  {    49,   4,   4,   5,    0,   -3 },   // 0x3E '>'
+  {    51,   3,   6,   4,    1,   -5 },   // 0x3F '?'
+  {    54,   5,   6,   5,    0,   -5 },   // 0x41 'A'
+  {    58,   4,   6,   5,    1,   -5 },   // 0x42 'B'
+  {    61,   5,   6,   6,    0,   -5 },   // 0x43 'C'
+  {    65,   4,   6,   5,    1,   -5 },   // 0x44 'D'
+  {    68,   4,   6,   5,    1,   -5 },   // 0x45 'E'
+  {    71,   3,   6,   5,    1,   -5 },   // 0x46 'F'
+  {    74,   6,   6,   6,    0,   -5 },   // 0x47 'G'
+  {    79,   4,   6,   6,    1,   -5 },   // 0x48 'H'
+  {    82,   1,   6,   2,    1,   -5 },   // 0x49 'I'
+  {    83,   3,   6,   4,    0,   -5 },   // 0x4A 'J'
+  {    86,   4,   6,   5,    1,   -5 },   // 0x4B 'K'
+  {    89,   3,   6,   4,    1,   -5 },   // 0x4C 'L'
+  {    92,   5,   6,   7,    1,   -5 },   // 0x4D 'M'
+  {    96,   4,   6,   6,    1,   -5 },   // 0x4E 'N'
+  {    99,   6,   6,   6,    0,   -5 },   // 0x4F 'O'
+  {   104,   4,   6,   5,    1,   -5 },   // 0x50 'P'
+  {   107,   6,   6,   6,    0,   -5 },   // 0x51 'Q'
+  {   112,   4,   6,   6,    1,   -5 },   // 0x52 'R'
+  {   115,   5,   6,   5,    0,   -5 },   // 0x53 'S'
+  {   119,   5,   6,   5,    0,   -5 },   // 0x54 'T'
+  {   123,   4,   6,   6,    1,   -5 },   // 0x55 'U'
+  {   126,   5,   6,   5,    0,   -5 },   // 0x56 'V'
+  {   130,   7,   6,   7,    0,   -5 },   // 0x57 'W'
+  {   136,   5,   6,   5,    0,   -5 },   // 0x59 'Y'
+  {   140,   5,   6,   5,    0,   -5 },   // 0x5A 'Z'
+  {   144,   2,   8,   2,    0,   -5 },   // 0x5B '['
+  {   146,   2,   8,   2,    0,   -5 },   // 0x5D ']'
+  {   148,   5,   1,   4,    0,    2 },   // 0x5F '_'
+  {   149,   4,   5,   4,    0,   -4 },   // 0x61 'a'
+  {   152,   4,   6,   4,    0,   -5 },   // 0x62 'b'
+  {   155,   4,   5,   4,    0,   -4 },   // 0x63 'c'
+  {   158,   4,   6,   4,    0,   -5 },   // 0x64 'd'
+  {   161,   4,   5,   4,    0,   -4 },   // 0x65 'e'
+  {   164,   2,   6,   2,    0,   -5 },   // 0x66 'f'
+  {   166,   4,   7,   4,    0,   -4 },   // 0x67 'g'
+  {   170,   4,   6,   4,    0,   -5 },   // 0x68 'h'
+  {   173,   1,   6,   2,    0,   -5 },   // 0x69 'i'
+  {   174,   4,   6,   4,    0,   -5 },   // 0x6B 'k'
+  {   177,   1,   6,   2,    0,   -5 },   // 0x6C 'l'
+  {   178,   6,   5,   6,    0,   -4 },   // 0x6D 'm'
+  {   182,   4,   5,   4,    0,   -4 },   // 0x6E 'n'
+  {   185,   4,   5,   4,    0,   -4 },   // 0x6F 'o'
+  {   188,   4,   7,   4,    0,   -4 },   // 0x70 'p'
+  {   192,   4,   7,   4,    0,   -4 },   // 0x71 'q'
+  {   196,   2,   5,   3,    0,   -4 },   // 0x72 'r'
+  {   198,   4,   5,   4,    0,   -4 },   // 0x73 's'
+  {   201,   2,   6,   2,    0,   -5 },   // 0x74 't'
+  {   203,   4,   5,   4,    0,   -4 },   // 0x75 'u'
+  {   206,   4,   5,   4,    0,   -4 },   // 0x76 'v'
+  {   209,   6,   5,   6,    0,   -4 },   // 0x77 'w'
+  {   213,   4,   5,   4,    0,   -4 },   // 0x78 'x'
+  {   216,   4,   7,   4,    0,   -4 },   // 0x79 'y'
+  {   220,   4,   5,   4,    0,   -4 },   // 0x7A 'z'
+  {   223,   1,   7,   2,    0,   -5 },   // 0x7C '|'
+  {   224,   3,   2,   5,    1,   -4 },   // 0xB0 ''
+  {   225,   3,   3,   3,    0,   -5 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_4pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_4pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_4pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_4pt8bGlyphs,
+  0x20, 0x6F, 9 };
+
+// Approx. 1018 bytes
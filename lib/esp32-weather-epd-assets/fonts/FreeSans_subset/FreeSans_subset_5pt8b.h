@@ -0,0 +1,139 @@
+const uint8_t FreeSans_subset_5pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFD, 0x64, 0x94, 0x68, 0x08, 0x13, 0x15, 0x23, 0xC0, 0x6A, 0xAA,
+  0x80, 0x89, 0x24, 0x92, 0x80, 0x01, 0x3E, 0x42, 0x00, 0xC0, 0xE0, 0x80,
+  0x29, 0x29, 0x24, 0x72, 0x63, 0x18, 0xA5, 0xC0, 0x75, 0x54, 0x72, 0x42,
+  0x26, 0x23, 0xE0, 0x74, 0x42, 0x60, 0xC5, 0xC0, 0x11, 0x94, 0xAF, 0x88,
+  0x40, 0x7A, 0x1C, 0x10, 0xC5, 0xC0, 0x32, 0x61, 0x6C, 0xC5, 0xC0, 0xF8,
+  0x44, 0x42, 0x11, 0x00, 0x72, 0x52, 0xE8, 0xC5, 0xC0, 0x74, 0x62, 0x97,
+  0x85, 0xC0, 0x84, 0x83, 0x06, 0x6C, 0x00, 0xE9, 0x92, 0x24, 0x04, 0x10,
+  0xC2, 0x8A, 0x49, 0xF4, 0x61, 0xF4, 0x63, 0xE8, 0xC6, 0x3E, 0x38, 0x89,
+  0x04, 0x08, 0x08, 0x91, 0x1C, 0xF4, 0x63, 0x18, 0xC6, 0x3E, 0xFC, 0x21,
+  0xF8, 0x42, 0x1F, 0xFC, 0x21, 0xE8, 0x42, 0x10, 0x3C, 0x89, 0x0C, 0x08,
+  0xF0, 0x50, 0x9F, 0x8C, 0x63, 0xF8, 0xC6, 0x31, 0xFF, 0x11, 0x11, 0x19,
+  0x97, 0x8C, 0xA9, 0xCA, 0x4A, 0x71, 0x88, 0x88, 0x88, 0x8F, 0x87, 0x8F,
+  0x2E, 0x5C, 0xB6, 0x6C, 0xC9, 0x8E, 0x73, 0x5A, 0xCE, 0x71, 0x3C, 0x85,
+  0x0C, 0x18, 0x28, 0x50, 0x9E, 0xF4, 0x63, 0x1F, 0x42, 0x10, 0x3C, 0x8D,
+  0x0C, 0x18, 0x28, 0x51, 0x9F, 0xFA, 0x28, 0xA2, 0xF2, 0x28, 0xA2, 0x79,
+  0x14, 0x1C, 0x0E, 0x14, 0x5E, 0xFC, 0x41, 0x04, 0x10, 0x41, 0x04, 0x8C,
+  0x63, 0x18, 0xC6, 0x2E, 0x85, 0x14, 0x92, 0x28, 0xC3, 0x04, 0x88, 0xC4,
+  0x55, 0x4A, 0xA5, 0x52, 0xA8, 0x8C, 0x44, 0xC5, 0x12, 0x8A, 0x10, 0x41,
+  0x04, 0x7C, 0x21, 0x84, 0x21, 0x84, 0x3F, 0xFF, 0xC0, 0xD5, 0x55, 0x70,
+  0xFC, 0x70, 0x47, 0xD8, 0xBC, 0x88, 0xE9, 0x99, 0x9E, 0x74, 0x61, 0x08,
+  0xB8, 0x08, 0x5F, 0x18, 0xC6, 0x2F, 0x74, 0x7F, 0x08, 0xB8, 0x6B, 0xA4,
+  0x92, 0x7C, 0x63, 0x18, 0xBE, 0x2E, 0x88, 0xE9, 0x99, 0x99, 0xBF, 0x88,
+  0xAC, 0xCA, 0xA9, 0xFF, 0xEE, 0x5A, 0x69, 0xA6, 0x90, 0xE9, 0x99, 0x99,
+  0x74, 0x63, 0x18, 0xB8, 0xE9, 0x99, 0x9E, 0x80, 0x7C, 0x63, 0x18, 0xBC,
+  0x21, 0xEA, 0xA0, 0x79, 0x43, 0x97, 0x5D, 0x24, 0x98, 0x99, 0x99, 0x9F,
+  0x8C, 0x94, 0xA6, 0x10, 0x93, 0x65, 0xB3, 0x66, 0xCD, 0x80, 0x92, 0x88,
+  0x45, 0x48, 0x94, 0x94, 0xC6, 0x11, 0x18, 0xF1, 0x24, 0x4F, 0xFF, 0x80,
+  0x1D, 0x80, 0x65, 0x70 };
+
+const GFXglyph FreeSans_subset_5pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   2,    0,    0 },   // 0x20 ' '
+  {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
+  {     2,   8,   7,   9,    0,   -6 },   // 0x25 '%'
+  {     9,   1,   2,   2,    0,   -6 },   // 0x27 '''
+  {    10,   2,   9,   3,    1,   -7 },   // 0x28 '('
+  {    13,   3,   9,   3,    0,   -7 },   // 0x29 ')'
+  {    17,   5,   5,   6,    0,   -4 },   // 0x2B '+'
+  {    21,   1,   2,   3,    1,    0 },   // 0x2C ','
+  {    22,   3,   1,   3,    0,   -2 },   // 0x2D '-'
+  {    23,   1,   1,   2,    1,    0 },   // 0x2E '.'
+  {    24,   3,   8,   3,    0,   -7 },   // 0x2F '/'
+  {    27,   5,   7,   5,    0,   -6 },   // 0x30 '0'
+  {    32,   2,   7,   5,    1,   -6 },   // 0x31 '1'
+  {    34,   5,   7,   5,    0,   -6 },   // 0x32 '2'
+  {    39,   5,   7,   5,    0,   -6 },   // 0x33 '3'
+  {    44,   5,   7,   5,    0,   -6 },   // 0x34 '4'
+  {    49,   5,   7,   5,    0,   -6 },   // 0x35 '5'
+  {    54,   5,   7,   5,    0,   -6 },   // 0x36 '6'
+  {    59,   5,   7,   5,    0,   -6 },   // 0x37 '7'
+  {    64,   5,   7,   5,    0,   -6 },   // 0x38 '8'
+  {    69,   5,   7,   5,    0,   -6 },   // 0x39 '9'
+  {    74,   1,   6,   2,    1,   -5 },   // 0x3A ':'
+  {    75,   5,   5,   6,    0,   -4 },   // 0x3E '>'
+  {    79,   4,   8,   5,    1,   -7 },   // 0x3F '?'
+  {    83,   6,   8,   7,    0,   -7 },   // 0x41 'A'
+  {    89,   5,   8,   7,    1,   -7 },   // 0x42 'B'
+  {    94,   7,   8,   7,    0,   -7 },   // 0x43 'C'
+  {   101,   5,   8,   7,    1,   -7 },   // 0x44 'D'
+  {   106,   5,   8,   6,    1,   -7 },   // 0x45 'E'
+  {   111,   5,   8,   6,    1,   -7 },   // 0x46 'F'
+  {   116,   7,   8,   8,    0,   -7 },   // 0x47 'G'
+  {   123,   5,   8,   7,    1,   -7 },   // 0x48 'H'
+  {   128,   1,   8,   3,    1,   -7 },   // 0x49 'I'
+  {   129,   4,   8,   5,    0,   -7 },   // 0x4A 'J'
+  {   133,   5,   8,   7,    1,   -7 },   // 0x4B 'K'
+  {   138,   4,   8,   6,    1,   -7 },   // 0x4C 'L'
+  {   142,   7,   8,   8,    1,   -7 },   // 0x4D 'M'
+  {   149,   5,   8,   7,    1,   -7 },   // 0x4E 'N'
+  {   154,   7,   8,   8,    0,   -7 },   // 0x4F 'O'
+  {   161,   5,   8,   6,    1,   -7 },   // 0x50 'P'
+  {   166,   7,   8,   8,    0,   -7 },   // 0x51 'Q'
+  {   173,   6,   8,   7,    1,   -7 },   // 0x52 'R'
+  {   179,   6,   8,   7,    0,   -7 },   // 0x53 'S'
+  {   185,   6,   8,   6,    0,   -7 },   // 0x54 'T'
+  {   191,   5,   8,   7,    1,   -7 },   // 0x55 'U'
+  {   196,   6,   8,   6,    0,   -7 },   // 0x56 'V'
+  {   202,   9,   8,   9,    0,   -7 },   // 0x57 'W'
+  {   211,   6,   8,   7,    0,   -7 },   // 0x59 'Y'
+  {   217,   6,   8,   6,    0,   -7 },   // 0x5A 'Z'
+  {   223,   1,  10,   3,    1,   -7 },   // 0x5B '['
+  {   225,   2,  10,   3,    0,   -7 },   // 0x5D ']'
+  {   228,   6,   1,   5,    0,    2 },   // 0x5F '_'
+  {   229,   5,   6,   5,    0,   -5 },   // 0x61 'a'
+  {   233,   4,   8,   5,    1,   -7 },   // 0x62 'b'
+  {   237,   5,   6,   5,    0,   -5 },   // 0x63 'c'
+  {   241,   5,   8,   5,    0,   -7 },   // 0x64 'd'
+  {   246,   5,   6,   5,    0,   -5 },   // 0x65 'e'
+  {   250,   3,   8,   3,    0,   -7 },   // 0x66 'f'
+  {   253,   5,   8,   5,    0,   -5 },   // 0x67 'g'
+  {   258,   4,   8,   5,    1,   -7 },   // 0x68 'h'
+  {   262,   1,   8,   2,    1,   -7 },   // 0x69 'i'
+  {   263,   4,   8,   5,    1,   -7 },   // 0x6B 'k'
+  {   267,   1,   8,   2,    0,   -7 },   // 0x6C 'l'
+  {   268,   6,   6,   8,    1,   -5 },   // 0x6D 'm'
+  {   273,   4,   6,   5,    1,   -5 },   // 0x6E 'n'
+  {   276,   5,   6,   5,    0,   -5 },   // 0x6F 'o'
+  {   280,   4,   8,   5,    1,   -5 },   // 0x70 'p'
+  {   284,   5,   8,   5,    0,   -5 },   // 0x71 'q'
+  {   289,   2,   6,   3,    1,   -5 },   // 0x72 'r'
+  {   291,   4,   6,   5,    0,   -5 },   // 0x73 's'
+  {   294,   3,   7,   3,    0,   -6 },   // 0x74 't'
+  {   297,   4,   6,   5,    1,   -5 },   // 0x75 'u'
+  {   300,   5,   6,   5,    0,   -5 },   // 0x76 'v'
+  {   304,   7,   6,   7,    0,   -5 },   // 0x77 'w'
+  {   310,   5,   6,   5,    0,   -5 },   // 0x78 'x'
+  {   314,   5,   8,   5,    0,   -5 },   // 0x79 'y'
+  {   319,   4,   6,   5,    0,   -5 },   // 0x7A 'z'
+  {   322,   1,   9,   2,    1,   -7 },   // 0x7C '|'
+  {   324,   3,   3,   6,    1,   -6 },   // 0xB0 ''
+  {   326,   3,   4,   3,    0,   -7 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_5pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_5pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_5pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_5pt8bGlyphs,
+  0x20, 0x6F, 12 };
+
+// Approx. 1119 bytes
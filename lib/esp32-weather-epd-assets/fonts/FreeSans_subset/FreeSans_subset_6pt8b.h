@@ -0,0 +1,150 @@
+const uint8_t FreeSans_subset_6pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFC, 0x80, 0x01, 0x1C, 0x89, 0x21, 0xD0, 0x04, 0x02, 0x60, 0xA4,
+  0x49, 0x11, 0x80, 0xC0, 0x5A, 0xAA, 0x94, 0x89, 0x12, 0x49, 0x4A, 0x00,
+  0x21, 0x3E, 0x42, 0x00, 0xE0, 0xC0, 0x80, 0x24, 0xA4, 0xA4, 0x80, 0x39,
+  0x24, 0x51, 0xC5, 0x14, 0x52, 0x38, 0x27, 0x92, 0x49, 0x20, 0x39, 0x14,
+  0x41, 0x08, 0xC4, 0x10, 0xFC, 0x79, 0x34, 0x42, 0x18, 0x18, 0x51, 0x78,
+  0x08, 0x62, 0x8A, 0x49, 0x2F, 0xC2, 0x08, 0x7D, 0x04, 0x1E, 0x4C, 0x10,
+  0x51, 0x78, 0x39, 0x14, 0x1E, 0xCD, 0x14, 0x51, 0x38, 0xF8, 0x44, 0x22,
+  0x11, 0x08, 0x40, 0x39, 0x34, 0x53, 0x39, 0x18, 0x51, 0x78, 0x39, 0x2C,
+  0x71, 0x4C, 0xD0, 0x52, 0x78, 0x82, 0x06, 0x0E, 0x36, 0x40, 0x74, 0x62,
+  0x33, 0x10, 0x80, 0x20, 0x18, 0x18, 0x28, 0x24, 0x24, 0x7C, 0x42, 0x42,
+  0x82, 0xFA, 0x18, 0x61, 0xFA, 0x18, 0x61, 0xF8, 0x3C, 0x62, 0x43, 0x40,
+  0xC0, 0x40, 0x41, 0x62, 0x3C, 0xF9, 0x0A, 0x14, 0x18, 0x30, 0x61, 0x42,
+  0xF8, 0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0xFC, 0xFE, 0x08, 0x20, 0xFA,
+  0x08, 0x20, 0x80, 0x3E, 0x63, 0x41, 0x40, 0xC7, 0x41, 0x41, 0x63, 0x3F,
+  0x87, 0x0E, 0x1C, 0x3F, 0xF0, 0xE1, 0xC3, 0x86, 0xFF, 0x80, 0x08, 0x42,
+  0x10, 0x87, 0x29, 0x70, 0x85, 0x12, 0x45, 0x0F, 0x12, 0x22, 0x46, 0x84,
+  0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, 0xC3, 0xC3, 0xC3, 0xA5, 0xA5, 0xA5,
+  0x99, 0x99, 0x99, 0x83, 0x87, 0x8D, 0x19, 0x32, 0x62, 0xC7, 0x86, 0x1E,
+  0x31, 0x90, 0x48, 0x1C, 0x0A, 0x05, 0x04, 0xC6, 0x1E, 0x00, 0xFA, 0x18,
+  0x61, 0xFA, 0x08, 0x20, 0x80, 0x1E, 0x31, 0x90, 0x48, 0x1C, 0x0A, 0x05,
+  0x04, 0xC6, 0x1F, 0x00, 0xFD, 0x0A, 0x14, 0x2F, 0x90, 0xA1, 0x42, 0x86,
+  0x7A, 0x18, 0x70, 0x78, 0x18, 0x61, 0x78, 0xFE, 0x20, 0x40, 0x81, 0x02,
+  0x04, 0x08, 0x10, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0x62, 0x78, 0xC2,
+  0x85, 0x1A, 0x22, 0x44, 0x8A, 0x0C, 0x18, 0xC4, 0x28, 0x89, 0x29, 0x25,
+  0x24, 0xA4, 0x63, 0x8C, 0x61, 0x8C, 0x31, 0x80, 0xC2, 0x42, 0x24, 0x34,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x08, 0x30, 0x41, 0x06, 0x18, 0x20,
+  0xFE, 0xEA, 0xAA, 0xAB, 0xD5, 0x55, 0x57, 0xFE, 0x79, 0x20, 0x9E, 0xCA,
+  0x27, 0x40, 0x84, 0x3D, 0x18, 0xC6, 0x31, 0xF0, 0x39, 0x28, 0x20, 0x85,
+  0x23, 0x80, 0x04, 0x17, 0x53, 0x86, 0x18, 0x53, 0x7C, 0x39, 0x38, 0x7F,
+  0x81, 0x33, 0x80, 0x6B, 0xA4, 0x92, 0x40, 0x35, 0x38, 0x61, 0x85, 0x37,
+  0x51, 0x78, 0x84, 0x3D, 0x38, 0xC6, 0x31, 0x88, 0xBF, 0x80, 0x84, 0x25,
+  0x4C, 0x52, 0xD2, 0x98, 0xFF, 0x80, 0xF6, 0x99, 0x91, 0x91, 0x91, 0x91,
+  0x91, 0xF4, 0xE3, 0x18, 0xC6, 0x20, 0x39, 0x38, 0x61, 0x85, 0x37, 0x80,
+  0xF4, 0x63, 0x18, 0xC7, 0xD0, 0x80, 0x3D, 0x38, 0x61, 0x85, 0x37, 0x41,
+  0x04, 0xF2, 0x49, 0x20, 0x7A, 0x50, 0xF0, 0xE5, 0xE0, 0x4B, 0xA4, 0x92,
+  0x60, 0x8C, 0x63, 0x18, 0xCF, 0xA0, 0x8D, 0x24, 0x92, 0x70, 0xC3, 0x00,
+  0x89, 0xD9, 0x59, 0x56, 0x56, 0x26, 0x26, 0x4A, 0x8C, 0x43, 0x2F, 0x20,
+  0x8A, 0x52, 0xA5, 0x18, 0x84, 0x22, 0x00, 0x78, 0x44, 0x46, 0x23, 0xE0,
+  0xFF, 0xE0, 0xF6, 0xA0, 0x69, 0x16, 0x8F };
+
+const GFXglyph FreeSans_subset_6pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   1,   9,   4,    1,   -8 },   // 0x21 '!'
+  {     3,  10,   9,  10,    0,   -8 },   // 0x25 '%'
+  {    15,   1,   3,   2,    1,   -8 },   // 0x27 '''
+  {    16,   2,  11,   4,    1,   -8 },   // 0x28 '('
+  {    19,   3,  11,   4,    0,   -8 },   // 0x29 ')'
+  {    24,   5,   5,   7,    1,   -4 },   // 0x2B '+'
+  {    28,   1,   3,   3,    1,    0 },   // 0x2C ','
+  {    29,   2,   1,   4,    1,   -3 },   // 0x2D '-'
+  {    30,   1,   1,   3,    1,    0 },   // 0x2E '.'
+  {    31,   3,   9,   3,    0,   -8 },   // 0x2F '/'
+  {    35,   6,   9,   7,    0,   -8 },   // 0x30 '0'
+  {    42,   3,   9,   7,    1,   -8 },   // 0x31 '1'
+  {    46,   6,   9,   7,    0,   -8 },   // 0x32 '2'
+  {    53,   6,   9,   7,    0,   -8 },   // 0x33 '3'
+  {    60,   6,   9,   7,    0,   -8 },   // 0x34 '4'
+  {    67,   6,   9,   7,    0,   -8 },   // 0x35 '5'
+  {    74,   6,   9,   7,    0,   -8 },   // 0x36 '6'
+  {    81,   5,   9,   7,    1,   -8 },   // 0x37 '7'
+  {    87,   6,   9,   7,    0,   -8 },   // 0x38 '8'
+  {    94,   6,   9,   7,    0,   -8 },   // 0x39 '9'
+  {   101,   1,   7,   3,    1,   -6 },   // 0x3A ':'
+  {   102,   5,   6,   7,    1,   -5 },   // 0x3E '>'
+  {   106,   5,   9,   7,    1,   -8 },   // 0x3F '?'
+  {   112,   8,   9,   8,    0,   -8 },   // 0x41 'A'
+  {   121,   6,   9,   8,    1,   -8 },   // 0x42 'B'
+  {   128,   8,   9,   8,    0,   -8 },   // 0x43 'C'
+  {   137,   7,   9,   8,    1,   -8 },   // 0x44 'D'
+  {   145,   6,   9,   7,    1,   -8 },   // 0x45 'E'
+  {   152,   6,   9,   7,    1,   -8 },   // 0x46 'F'
+  {   159,   8,   9,   9,    0,   -8 },   // 0x47 'G'
+  {   168,   7,   9,   8,    1,   -8 },   // 0x48 'H'
+  {   176,   1,   9,   3,    1,   -8 },   // 0x49 'I'
+  {   178,   5,   9,   6,    0,   -8 },   // 0x4A 'J'
+  {   184,   7,   9,   8,    1,   -8 },   // 0x4B 'K'
+  {   192,   5,   9,   7,    1,   -8 },   // 0x4C 'L'
+  {   198,   8,   9,  10,    1,   -8 },   // 0x4D 'M'
+  {   207,   7,   9,   9,    1,   -8 },   // 0x4E 'N'
+  {   215,   9,   9,   9,    0,   -8 },   // 0x4F 'O'
+  {   226,   6,   9,   8,    1,   -8 },   // 0x50 'P'
+  {   233,   9,   9,   9,    0,   -8 },   // 0x51 'Q'
+  {   244,   7,   9,   8,    1,   -8 },   // 0x52 'R'
+  {   252,   6,   9,   8,    1,   -8 },   // 0x53 'S'
+  {   259,   7,   9,   7,    0,   -8 },   // 0x54 'T'
+  {   267,   7,   9,   8,    1,   -8 },   // 0x55 'U'
+  {   275,   7,   9,   8,    0,   -8 },   // 0x56 'V'
+  {   283,  11,   9,  11,    0,   -8 },   // 0x57 'W'
+  {   296,   8,   9,   8,    0,   -8 },   // 0x59 'Y'
+  {   305,   7,   9,   7,    0,   -8 },   // 0x5A 'Z'
+  {   313,   2,  12,   3,    1,   -8 },   // 0x5B '['
+  {   316,   2,  12,   3,    0,   -8 },   // 0x5D ']'
+  {   319,   7,   1,   7,    0,    2 },   // 0x5F '_'
+  {   320,   6,   7,   6,    0,   -6 },   // 0x61 'a'
+  {   326,   5,   9,   7,    1,   -8 },   // 0x62 'b'
+  {   332,   6,   7,   6,    0,   -6 },   // 0x63 'c'
+  {   338,   6,   9,   7,    0,   -8 },   // 0x64 'd'
+  {   345,   6,   7,   6,    0,   -6 },   // 0x65 'e'
+  {   351,   3,   9,   3,    0,   -8 },   // 0x66 'f'
+  {   355,   6,   9,   6,    0,   -6 },   // 0x67 'g'
+  {   362,   5,   9,   6,    1,   -8 },   // 0x68 'h'
+  {   368,   1,   9,   3,    1,   -8 },   // 0x69 'i'
+  {   370,   5,   9,   6,    1,   -8 },   // 0x6B 'k'
+  {   376,   1,   9,   3,    1,   -8 },   // 0x6C 'l'
+  {   378,   8,   7,  10,    1,   -6 },   // 0x6D 'm'
+  {   385,   5,   7,   6,    1,   -6 },   // 0x6E 'n'
+  {   390,   6,   7,   6,    0,   -6 },   // 0x6F 'o'
+  {   396,   5,   9,   7,    1,   -6 },   // 0x70 'p'
+  {   402,   6,   9,   7,    0,   -6 },   // 0x71 'q'
+  {   409,   3,   7,   4,    1,   -6 },   // 0x72 'r'
+  {   412,   5,   7,   6,    0,   -6 },   // 0x73 's'
+  {   417,   3,   9,   3,    0,   -8 },   // 0x74 't'
+  {   421,   5,   7,   6,    1,   -6 },   // 0x75 'u'
+  {   426,   6,   7,   6,    0,   -6 },   // 0x76 'v'
+  {   432,   8,   7,   8,    0,   -6 },   // 0x77 'w'
+  {   439,   5,   7,   6,    0,   -6 },   // 0x78 'x'
+  {   444,   5,  10,   6,    0,   -6 },   // 0x79 'y'
+  {   451,   5,   7,   6,    0,   -6 },   // 0x7A 'z'
+  {   456,   1,  11,   3,    1,   -8 },   // 0x7C '|'
+  {   458,   3,   4,   7,    2,   -7 },   // 0xB0 ''
+  {   460,   4,   6,   4,    0,   -9 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_6pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_6pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_6pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_6pt8bGlyphs,
+  0x20, 0x6F, 14 };
+
+// Approx. 1254 bytes
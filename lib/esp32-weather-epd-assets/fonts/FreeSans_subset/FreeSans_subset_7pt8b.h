@@ -0,0 +1,161 @@
+const uint8_t FreeSans_subset_7pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0x40, 0x00, 0x87, 0x10, 0xC9, 0x08, 0xA0, 0x72, 0x00, 0x40,
+  0x04, 0xE0, 0x91, 0x09, 0x11, 0x0E, 0xE0, 0x29, 0x49, 0x24, 0x99, 0x22,
+  0x91, 0x24, 0x92, 0x49, 0x48, 0x00, 0x82, 0x3F, 0x20, 0x82, 0x00, 0xD8,
+  0xE0, 0xC0, 0x12, 0x22, 0x44, 0x48, 0x88, 0x73, 0x28, 0xE1, 0x86, 0x18,
+  0x63, 0xC9, 0xC0, 0x13, 0xF1, 0x11, 0x11, 0x11, 0x3C, 0xCD, 0x08, 0x10,
+  0x61, 0x8C, 0x20, 0x41, 0xFC, 0x3C, 0x89, 0x18, 0x21, 0x80, 0xC0, 0xA1,
+  0x46, 0x78, 0x0C, 0x18, 0x71, 0xE2, 0xC9, 0x93, 0x7F, 0x0C, 0x18, 0x7E,
+  0x81, 0x03, 0xE4, 0x60, 0x40, 0xA1, 0x44, 0x78, 0x7B, 0x28, 0x60, 0xFA,
+  0x38, 0x61, 0xCD, 0xE0, 0xFC, 0x10, 0x86, 0x10, 0x82, 0x08, 0x41, 0x00,
+  0x3C, 0xC9, 0x1A, 0x23, 0x88, 0xD0, 0xA1, 0x46, 0x78, 0x72, 0x28, 0x61,
+  0x8D, 0xD0, 0x63, 0x89, 0xC0, 0xC0, 0x03, 0x03, 0x03, 0x81, 0x1D, 0x88,
+  0x00, 0x7B, 0x38, 0x43, 0x08, 0x43, 0x00, 0x00, 0xC0, 0x0C, 0x0E, 0x05,
+  0x02, 0xC2, 0x21, 0x11, 0xFC, 0x82, 0x41, 0x60, 0xC0, 0xFC, 0x86, 0x82,
+  0x82, 0xFC, 0x82, 0x83, 0x83, 0x82, 0xFC, 0x3C, 0x42, 0x83, 0x80, 0x80,
+  0x80, 0x81, 0x83, 0x42, 0x3C, 0xFC, 0x86, 0x83, 0x81, 0x81, 0x81, 0x81,
+  0x83, 0x86, 0xFC, 0xFF, 0x02, 0x04, 0x0F, 0xF0, 0x20, 0x40, 0x81, 0xFC,
+  0xFF, 0x02, 0x04, 0x0F, 0xD0, 0x20, 0x40, 0x81, 0x00, 0x3E, 0x31, 0xB0,
+  0x50, 0x08, 0x04, 0x7E, 0x03, 0x03, 0x63, 0x9F, 0x40, 0x83, 0x83, 0x83,
+  0x83, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xF0, 0x04, 0x10,
+  0x41, 0x04, 0x10, 0x71, 0x4D, 0xE0, 0x82, 0x84, 0x88, 0x90, 0xB0, 0xD8,
+  0x8C, 0x84, 0x86, 0x83, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF0,
+  0xC0, 0xE0, 0xE8, 0x74, 0x3A, 0x2C, 0x96, 0x4B, 0x29, 0x8C, 0xC6, 0x40,
+  0xC1, 0xC1, 0xA1, 0xB1, 0x91, 0x89, 0x8D, 0x85, 0x87, 0x83, 0x3E, 0x31,
+  0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83, 0x63, 0x1F, 0x00, 0xFD, 0x0E,
+  0x0C, 0x18, 0x7F, 0xA0, 0x40, 0x81, 0x00, 0x3E, 0x31, 0xB0, 0x70, 0x18,
+  0x0C, 0x06, 0x03, 0x8B, 0x63, 0x1F, 0xC0, 0x00, 0xFE, 0x82, 0x83, 0x83,
+  0x82, 0xFC, 0x82, 0x83, 0x83, 0x83, 0x7C, 0xC6, 0x82, 0xC0, 0x78, 0x0E,
+  0x02, 0x82, 0xC6, 0x7C, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x42, 0x3C,
+  0xC1, 0x20, 0x90, 0xCC, 0x42, 0x21, 0x30, 0x50, 0x28, 0x1C, 0x04, 0x00,
+  0xC2, 0x12, 0x38, 0x91, 0x44, 0x8A, 0x66, 0xD2, 0x14, 0xD0, 0xA2, 0x85,
+  0x14, 0x38, 0xC0, 0x82, 0x00, 0x41, 0xB0, 0x88, 0xC6, 0x41, 0x40, 0x60,
+  0x20, 0x10, 0x08, 0x04, 0x00, 0x7F, 0x03, 0x06, 0x04, 0x08, 0x18, 0x30,
+  0x60, 0x40, 0xFF, 0xEA, 0xAA, 0xAA, 0xC0, 0xE4, 0x92, 0x49, 0x24, 0x9E,
+  0xFF, 0x3C, 0x88, 0x10, 0xE6, 0x58, 0xB1, 0x3F, 0x82, 0x0B, 0xB3, 0x86,
+  0x18, 0x61, 0xCF, 0xE0, 0x38, 0x89, 0x16, 0x0C, 0x08, 0x91, 0x1C, 0x02,
+  0x04, 0xEB, 0x34, 0x78, 0x70, 0xA3, 0x66, 0x74, 0x3C, 0x89, 0x0F, 0xFC,
+  0x08, 0xD1, 0x1C, 0x34, 0xF4, 0x44, 0x44, 0x44, 0x3A, 0x8D, 0x1E, 0x1C,
+  0x28, 0xD1, 0x9D, 0x06, 0x88, 0xE0, 0x82, 0x0B, 0xB2, 0x8E, 0x38, 0xE3,
+  0x8E, 0x30, 0xBF, 0xC0, 0x82, 0x08, 0xA4, 0xA3, 0x89, 0x24, 0x8A, 0x30,
+  0xFF, 0xC0, 0xFB, 0xE6, 0x62, 0x31, 0x18, 0x8C, 0x46, 0x23, 0x11, 0xFB,
+  0x28, 0xE3, 0x8E, 0x38, 0xE3, 0x38, 0x89, 0x1E, 0x1C, 0x28, 0xD1, 0x1C,
+  0xFB, 0x38, 0x61, 0x86, 0x1C, 0xEE, 0x82, 0x08, 0x00, 0x3A, 0xCD, 0x1E,
+  0x1C, 0x28, 0xD9, 0x9D, 0x02, 0x04, 0x08, 0xBA, 0x49, 0x24, 0x39, 0x14,
+  0x1C, 0x1F, 0x14, 0x5E, 0x44, 0xF4, 0x44, 0x44, 0x47, 0x8E, 0x38, 0xE3,
+  0x8E, 0x38, 0xFF, 0xC4, 0x89, 0x12, 0x42, 0x85, 0x0C, 0x18, 0xCC, 0xD3,
+  0x24, 0xC9, 0x52, 0x53, 0x8C, 0xC3, 0x30, 0xCC, 0x45, 0x22, 0x8C, 0x30,
+  0xA4, 0xB1, 0x85, 0x14, 0xD2, 0x28, 0xE3, 0x0C, 0x30, 0x86, 0x00, 0x7C,
+  0x30, 0x84, 0x31, 0x84, 0x3F, 0xFF, 0xF8, 0x69, 0x99, 0x60, 0x79, 0x12,
+  0x4F };
+
+const GFXglyph FreeSans_subset_7pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   1,  10,   5,    2,   -9 },   // 0x21 '!'
+  {     3,  12,  10,  12,    0,   -9 },   // 0x25 '%'
+  {    18,   1,   3,   3,    1,   -9 },   // 0x27 '''
+  {    19,   3,  13,   5,    1,   -9 },   // 0x28 '('
+  {    24,   3,  13,   5,    1,   -9 },   // 0x29 ')'
+  {    29,   6,   7,   8,    1,   -6 },   // 0x2B '+'
+  {    35,   2,   3,   4,    1,    0 },   // 0x2C ','
+  {    36,   3,   1,   5,    1,   -3 },   // 0x2D '-'
+  {    37,   2,   1,   3,    1,    0 },   // 0x2E '.'
+  {    38,   4,  10,   4,    0,   -9 },   // 0x2F '/'
+  {    43,   6,  10,   8,    1,   -9 },   // 0x30 '0'
+  {    51,   4,  10,   8,    1,   -9 },   // 0x31 '1'
+  {    56,   7,  10,   8,    0,   -9 },   // 0x32 '2'
+  {    65,   7,  10,   8,    0,   -9 },   // 0x33 '3'
+  {    74,   7,  10,   8,    0,   -9 },   // 0x34 '4'
+  {    83,   7,  10,   8,    0,   -9 },   // 0x35 '5'
+  {    92,   6,  10,   8,    1,   -9 },   // 0x36 '6'
+  {   100,   6,  10,   8,    1,   -9 },   // 0x37 '7'
+  {   108,   7,  10,   8,    0,   -9 },   // 0x38 '8'
+  {   117,   6,  10,   8,    1,   -9 },   // 0x39 '9'
+  {   125,   2,   8,   3,    1,   -7 },   // 0x3A ':'
+  {   127,   6,   7,   8,    1,   -6 },   // 0x3E '>'
+  {   133,   6,  10,   8,    1,   -9 },   // 0x3F '?'
+  {   141,   9,  10,   9,    0,   -9 },   // 0x41 'A'
+  {   153,   8,  10,   9,    1,   -9 },   // 0x42 'B'
+  {   163,   8,  10,  10,    1,   -9 },   // 0x43 'C'
+  {   173,   8,  10,  10,    1,   -9 },   // 0x44 'D'
+  {   183,   7,  10,   9,    1,   -9 },   // 0x45 'E'
+  {   192,   7,  10,   8,    1,   -9 },   // 0x46 'F'
+  {   201,   9,  10,  10,    1,   -9 },   // 0x47 'G'
+  {   213,   8,  10,  10,    1,   -9 },   // 0x48 'H'
+  {   223,   2,  10,   4,    1,   -9 },   // 0x49 'I'
+  {   226,   6,  10,   7,    0,   -9 },   // 0x4A 'J'
+  {   234,   8,  10,   9,    1,   -9 },   // 0x4B 'K'
+  {   244,   6,  10,   8,    1,   -9 },   // 0x4C 'L'
+  {   252,   9,  10,  12,    1,   -9 },   // 0x4D 'M'
+  {   264,   8,  10,  10,    1,   -9 },   // 0x4E 'N'
+  {   274,   9,  10,  11,    1,   -9 },   // 0x4F 'O'
+  {   286,   7,  10,   9,    1,   -9 },   // 0x50 'P'
+  {   295,   9,  11,  11,    1,   -9 },   // 0x51 'Q'
+  {   308,   8,  10,  10,    1,   -9 },   // 0x52 'R'
+  {   318,   8,  10,   9,    1,   -9 },   // 0x53 'S'
+  {   328,   8,  10,   9,    0,   -9 },   // 0x54 'T'
+  {   338,   8,  10,  10,    1,   -9 },   // 0x55 'U'
+  {   348,   9,  10,   9,    0,   -9 },   // 0x56 'V'
+  {   360,  13,  10,  13,    0,   -9 },   // 0x57 'W'
+  {   377,   9,  10,   9,    0,   -9 },   // 0x59 'Y'
+  {   389,   8,  10,   8,    0,   -9 },   // 0x5A 'Z'
+  {   399,   2,  13,   4,    1,   -9 },   // 0x5B '['
+  {   403,   3,  13,   4,    0,   -9 },   // 0x5D ']'
+  {   408,   8,   1,   8,    0,    3 },   // 0x5F '_'
+  {   409,   7,   8,   7,    0,   -7 },   // 0x61 'a'
+  {   416,   6,  10,   8,    1,   -9 },   // 0x62 'b'
+  {   424,   7,   8,   7,    0,   -7 },   // 0x63 'c'
+  {   431,   7,  10,   8,    0,   -9 },   // 0x64 'd'
+  {   440,   7,   8,   7,    0,   -7 },   // 0x65 'e'
+  {   447,   4,  10,   4,    0,   -9 },   // 0x66 'f'
+  {   452,   7,  11,   8,    0,   -7 },   // 0x67 'g'
+  {   462,   6,  10,   7,    1,   -9 },   // 0x68 'h'
+  {   470,   1,  10,   3,    1,   -9 },   // 0x69 'i'
+  {   472,   6,  10,   7,    1,   -9 },   // 0x6B 'k'
+  {   480,   1,  10,   3,    1,   -9 },   // 0x6C 'l'
+  {   482,   9,   8,  11,    1,   -7 },   // 0x6D 'm'
+  {   491,   6,   8,   7,    1,   -7 },   // 0x6E 'n'
+  {   497,   7,   8,   7,    0,   -7 },   // 0x6F 'o'
+  {   504,   6,  11,   8,    1,   -7 },   // 0x70 'p'
+  {   513,   7,  11,   8,    0,   -7 },   // 0x71 'q'
+  {   523,   3,   8,   5,    1,   -7 },   // 0x72 'r'
+  {   526,   6,   8,   7,    0,   -7 },   // 0x73 's'
+  {   532,   4,  10,   4,    0,   -9 },   // 0x74 't'
+  {   537,   6,   8,   7,    1,   -7 },   // 0x75 'u'
+  {   543,   7,   8,   7,    0,   -7 },   // 0x76 'v'
+  {   550,  10,   8,  10,    0,   -7 },   // 0x77 'w'
+  {   560,   6,   8,   7,    0,   -7 },   // 0x78 'x'
+  {   566,   6,  11,   7,    0,   -7 },   // 0x79 'y'
+  {   575,   6,   8,   7,    0,   -7 },   // 0x7A 'z'
+  {   581,   1,  13,   3,    1,   -9 },   // 0x7C '|'
+  {   583,   4,   5,   8,    2,   -9 },   // 0xB0 ''
+  {   586,   4,   6,   5,    0,  -10 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_7pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_7pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_7pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_7pt8bGlyphs,
+  0x20, 0x6F, 16 };
+
+// Approx. 1380 bytes
@@ -0,0 +1,175 @@
+const uint8_t FreeSans_subset_8pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xB0, 0x00, 0x43, 0xC2, 0x13, 0x20, 0x99, 0x07, 0x90, 0x01,
+  0x00, 0x09, 0xC0, 0x99, 0x04, 0x88, 0x46, 0x42, 0x1C, 0xF0, 0x22, 0x44,
+  0x4C, 0x88, 0x8C, 0x44, 0x42, 0x00, 0x91, 0x26, 0x49, 0x25, 0xA5, 0x20,
+  0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0xF5, 0x80, 0xE0, 0xF0, 0x11,
+  0x12, 0x22, 0x44, 0x44, 0x88, 0x38, 0x9B, 0x1C, 0x38, 0x70, 0x61, 0xC3,
+  0xC6, 0x99, 0xE0, 0x27, 0x92, 0x49, 0x24, 0x80, 0x79, 0x8E, 0x1C, 0x10,
+  0x61, 0x8E, 0x30, 0xC1, 0x03, 0xF8, 0x3C, 0x66, 0x43, 0x43, 0x06, 0x1C,
+  0x03, 0x03, 0x43, 0x62, 0x3C, 0x06, 0x0E, 0x0E, 0x16, 0x26, 0x66, 0x46,
+  0xFF, 0x06, 0x06, 0x06, 0x7C, 0x83, 0x06, 0x0F, 0xD8, 0xC1, 0x81, 0x87,
+  0x99, 0xE0, 0x38, 0xCB, 0x1C, 0x0B, 0x98, 0xA1, 0xC1, 0x87, 0x89, 0xE0,
+  0xFE, 0x04, 0x10, 0x60, 0x82, 0x04, 0x18, 0x20, 0x41, 0x80, 0x79, 0x9A,
+  0x1C, 0x3C, 0x4F, 0x31, 0xC1, 0x83, 0x8D, 0xE0, 0x79, 0x9A, 0x1C, 0x38,
+  0x79, 0xDE, 0x83, 0x85, 0x99, 0xE0, 0xF0, 0x03, 0xC0, 0x01, 0x80, 0xE0,
+  0x70, 0x63, 0xB8, 0x40, 0x3C, 0x8F, 0x1E, 0x10, 0x61, 0x86, 0x08, 0x10,
+  0x00, 0x40, 0x80, 0x0C, 0x03, 0x81, 0xA0, 0x68, 0x13, 0x0C, 0xC3, 0x10,
+  0xFE, 0x61, 0x98, 0x24, 0x0F, 0x03, 0xFE, 0x61, 0xB0, 0x58, 0x2C, 0x37,
+  0xF3, 0x0D, 0x83, 0xC1, 0xE0, 0xF0, 0xDF, 0xC0, 0x3E, 0x31, 0xB0, 0x78,
+  0x18, 0x04, 0x02, 0x01, 0x01, 0xC0, 0xE0, 0xDC, 0xC7, 0xC0, 0xFE, 0x61,
+  0xB0, 0x78, 0x3C, 0x0E, 0x07, 0x03, 0x81, 0xC1, 0xE0, 0xF0, 0xDF, 0xC0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1C, 0xE4, 0x0F, 0x03, 0x80, 0x20, 0x08, 0x7E, 0x01, 0xC0, 0x70,
+  0x37, 0x1C, 0x7D, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0xFF, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x10, 0xFF, 0xF0, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x8E, 0x3C, 0xDE, 0xC1, 0xE1, 0xB1, 0x99, 0x8D, 0x87, 0xC3, 0xB1,
+  0x88, 0xC6, 0x61, 0xB0, 0x58, 0x30, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0xC1, 0x83, 0x07, 0xF0, 0xC0, 0x7C, 0x1F, 0x82, 0xF0, 0x5F, 0x0B,
+  0xA2, 0x74, 0x4E, 0xC9, 0xCB, 0x39, 0x47, 0x38, 0xE3, 0x10, 0xC0, 0xF0,
+  0x78, 0x3E, 0x1D, 0x8E, 0x47, 0x33, 0x89, 0xC6, 0xE1, 0xF0, 0x78, 0x30,
+  0x1F, 0x0E, 0x71, 0x03, 0x60, 0x28, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xC0,
+  0x48, 0x19, 0xCE, 0x0F, 0x80, 0xFE, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xFE,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x0E, 0x71, 0x03, 0x60, 0x28, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0xC2, 0x48, 0x79, 0xCE, 0x0F, 0xE0, 0x00, 0xFF,
+  0x61, 0xF0, 0x78, 0x3C, 0x1E, 0x1B, 0xFD, 0x83, 0xC1, 0xE0, 0xF0, 0x78,
+  0x30, 0x3E, 0x31, 0xB0, 0x58, 0x2C, 0x03, 0xE0, 0x3C, 0x03, 0x81, 0xE0,
+  0xD8, 0xC7, 0xC0, 0xFF, 0x86, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0xD8, 0xC7, 0xC0, 0xC0, 0xD0, 0x26, 0x09, 0x86,
+  0x21, 0x0C, 0x43, 0x30, 0x48, 0x1A, 0x07, 0x80, 0xC0, 0x30, 0xC3, 0x05,
+  0x0E, 0x34, 0x38, 0xD8, 0xA3, 0x66, 0x88, 0x93, 0x22, 0x4D, 0x8D, 0x16,
+  0x3C, 0x50, 0x61, 0xC1, 0x83, 0x06, 0x0C, 0x40, 0xD8, 0x22, 0x18, 0xC4,
+  0x1B, 0x02, 0x80, 0xE0, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x7F, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x20, 0x30, 0x30, 0x30, 0x10, 0x1F, 0xF0,
+  0xF2, 0x49, 0x24, 0x92, 0x49, 0x38, 0xE4, 0x92, 0x49, 0x24, 0x92, 0x78,
+  0xFF, 0x80, 0x3C, 0x66, 0x42, 0x02, 0x7E, 0x42, 0xC2, 0x46, 0x7B, 0x81,
+  0x02, 0x05, 0xEE, 0x78, 0xE0, 0xC1, 0x83, 0x87, 0x15, 0xC0, 0x3C, 0xCD,
+  0x0A, 0x0C, 0x08, 0x10, 0xB3, 0x3C, 0x01, 0x01, 0x01, 0x3D, 0x67, 0x43,
+  0x43, 0xC1, 0x43, 0x43, 0x67, 0x3D, 0x3C, 0x66, 0x43, 0x43, 0xFF, 0x40,
+  0x43, 0x66, 0x3C, 0x36, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x3F, 0x67, 0x43,
+  0x43, 0xC3, 0x43, 0x43, 0x67, 0x3B, 0x02, 0x62, 0x3C, 0x82, 0x08, 0x2F,
+  0xC7, 0x18, 0x61, 0x86, 0x18, 0x61, 0xDF, 0xF0, 0x81, 0x02, 0x04, 0x69,
+  0x96, 0x2C, 0x68, 0x99, 0x12, 0x34, 0x30, 0xFF, 0xF0, 0xB9, 0xD9, 0xCE,
+  0x11, 0xC2, 0x38, 0x47, 0x08, 0xE1, 0x1C, 0x23, 0x84, 0x60, 0xBF, 0x1C,
+  0x61, 0x86, 0x18, 0x61, 0x84, 0x3C, 0x66, 0x43, 0x43, 0xC1, 0x43, 0x43,
+  0x66, 0x3C, 0xBD, 0xCF, 0x1C, 0x18, 0x30, 0x70, 0xF3, 0xBD, 0x02, 0x04,
+  0x00, 0x3D, 0x67, 0x43, 0x43, 0xC1, 0x43, 0x43, 0x67, 0x3D, 0x01, 0x01,
+  0x01, 0xBE, 0xC8, 0x88, 0x88, 0x80, 0x7B, 0x38, 0xF0, 0x78, 0x38, 0x73,
+  0x78, 0x66, 0xF6, 0x66, 0x66, 0x66, 0x30, 0x86, 0x18, 0x61, 0x86, 0x18,
+  0x73, 0x7C, 0xC2, 0x42, 0x46, 0x64, 0x24, 0x2C, 0x38, 0x18, 0x18, 0xC6,
+  0x29, 0xCD, 0x29, 0x25, 0x26, 0xA4, 0x57, 0x8E, 0x61, 0x8C, 0x31, 0x80,
+  0x46, 0xC8, 0xB1, 0xC1, 0x87, 0x0B, 0x32, 0xC6, 0xC2, 0x8D, 0x13, 0x22,
+  0xC5, 0x0E, 0x0C, 0x10, 0x20, 0xC3, 0x00, 0x7E, 0x0C, 0x30, 0x41, 0x06,
+  0x18, 0x20, 0xFE, 0xFF, 0xFE, 0x72, 0x62, 0x97, 0x00, 0x72, 0x62, 0x36,
+  0x23, 0xE0 };
+
+const GFXglyph FreeSans_subset_8pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   1,  12,   5,    2,  -11 },   // 0x21 '!'
+  {     3,  13,  11,  14,    0,  -10 },   // 0x25 '%'
+  {    21,   1,   4,   3,    1,  -10 },   // 0x27 '''
+  {    22,   4,  15,   5,    1,  -11 },   // 0x28 '('
+  {    30,   3,  15,   5,    1,  -11 },   // 0x29 ')'
+  {    36,   7,   7,   9,    1,   -6 },   // 0x2B '+'
+  {    43,   2,   5,   4,    1,   -1 },   // 0x2C ','
+  {    45,   3,   1,   5,    1,   -4 },   // 0x2D '-'
+  {    46,   2,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    47,   4,  12,   4,    0,  -11 },   // 0x2F '/'
+  {    53,   7,  11,   9,    1,  -10 },   // 0x30 '0'
+  {    63,   3,  11,   9,    2,  -10 },   // 0x31 '1'
+  {    68,   7,  11,   9,    1,  -10 },   // 0x32 '2'
+  {    78,   8,  11,   9,    0,  -10 },   // 0x33 '3'
+  {    89,   8,  11,   9,    0,  -10 },   // 0x34 '4'
+  {   100,   7,  11,   9,    1,  -10 },   // 0x35 '5'
+  {   110,   7,  11,   9,    1,  -10 },   // 0x36 '6'
+  {   120,   7,  11,   9,    1,  -10 },   // 0x37 '7'
+  {   130,   7,  11,   9,    1,  -10 },   // 0x38 '8'
+  {   140,   7,  11,   9,    1,  -10 },   // 0x39 '9'
+  {   150,   2,   9,   4,    1,   -8 },   // 0x3A ':'
+  {   153,   7,   8,   9,    1,   -7 },   // 0x3E '>'
+  {   160,   7,  12,   9,    1,  -11 },   // 0x3F '?'
+  {   171,  10,  12,  10,    0,  -11 },   // 0x41 'A'
+  {   186,   9,  12,  10,    1,  -11 },   // 0x42 'B'
+  {   200,   9,  12,  11,    1,  -11 },   // 0x43 'C'
+  {   214,   9,  12,  11,    1,  -11 },   // 0x44 'D'
+  {   228,   8,  12,  10,    1,  -11 },   // 0x45 'E'
+  {   240,   8,  12,   9,    1,  -11 },   // 0x46 'F'
+  {   252,  10,  12,  12,    1,  -11 },   // 0x47 'G'
+  {   267,   9,  12,  11,    1,  -11 },   // 0x48 'H'
+  {   281,   1,  12,   4,    2,  -11 },   // 0x49 'I'
+  {   283,   6,  12,   8,    1,  -11 },   // 0x4A 'J'
+  {   292,   9,  12,  11,    1,  -11 },   // 0x4B 'K'
+  {   306,   7,  12,   9,    1,  -11 },   // 0x4C 'L'
+  {   317,  11,  12,  13,    1,  -11 },   // 0x4D 'M'
+  {   334,   9,  12,  11,    1,  -11 },   // 0x4E 'N'
+  {   348,  11,  12,  12,    1,  -11 },   // 0x4F 'O'
+  {   365,   8,  12,  10,    1,  -11 },   // 0x50 'P'
+  {   377,  11,  13,  12,    1,  -11 },   // 0x51 'Q'
+  {   395,   9,  12,  11,    1,  -11 },   // 0x52 'R'
+  {   409,   9,  12,  10,    1,  -11 },   // 0x53 'S'
+  {   423,   9,  12,  10,    0,  -11 },   // 0x54 'T'
+  {   437,   9,  12,  11,    1,  -11 },   // 0x55 'U'
+  {   451,  10,  12,  10,    0,  -11 },   // 0x56 'V'
+  {   466,  14,  12,  15,    0,  -11 },   // 0x57 'W'
+  {   487,  10,  12,  11,    0,  -11 },   // 0x59 'Y'
+  {   502,   9,  12,  10,    0,  -11 },   // 0x5A 'Z'
+  {   516,   3,  15,   4,    1,  -11 },   // 0x5B '['
+  {   522,   3,  15,   4,    0,  -11 },   // 0x5D ']'
+  {   528,   9,   1,   9,    0,    3 },   // 0x5F '_'
+  {   530,   8,   9,   9,    0,   -8 },   // 0x61 'a'
+  {   539,   7,  12,   9,    1,  -11 },   // 0x62 'b'
+  {   550,   7,   9,   8,    0,   -8 },   // 0x63 'c'
+  {   558,   8,  12,   9,    0,  -11 },   // 0x64 'd'
+  {   570,   8,   9,   8,    0,   -8 },   // 0x65 'e'
+  {   579,   4,  12,   4,    0,  -11 },   // 0x66 'f'
+  {   585,   8,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   597,   6,  12,   8,    1,  -11 },   // 0x68 'h'
+  {   606,   1,  12,   3,    1,  -11 },   // 0x69 'i'
+  {   608,   7,  12,   8,    1,  -11 },   // 0x6B 'k'
+  {   619,   1,  12,   3,    1,  -11 },   // 0x6C 'l'
+  {   621,  11,   9,  13,    1,   -8 },   // 0x6D 'm'
+  {   634,   6,   9,   8,    1,   -8 },   // 0x6E 'n'
+  {   641,   8,   9,   8,    0,   -8 },   // 0x6F 'o'
+  {   650,   7,  12,   9,    1,   -8 },   // 0x70 'p'
+  {   661,   8,  12,   9,    0,   -8 },   // 0x71 'q'
+  {   673,   4,   9,   5,    1,   -8 },   // 0x72 'r'
+  {   678,   6,   9,   8,    1,   -8 },   // 0x73 's'
+  {   685,   4,  11,   4,    0,  -10 },   // 0x74 't'
+  {   691,   6,   9,   8,    1,   -8 },   // 0x75 'u'
+  {   698,   8,   9,   8,    0,   -8 },   // 0x76 'v'
+  {   707,  11,   9,  11,    0,   -8 },   // 0x77 'w'
+  {   720,   7,   9,   7,    0,   -8 },   // 0x78 'x'
+  {   728,   7,  12,   7,    0,   -8 },   // 0x79 'y'
+  {   739,   7,   9,   8,    0,   -8 },   // 0x7A 'z'
+  {   747,   1,  15,   4,    1,  -11 },   // 0x7C '|'
+  {   749,   5,   5,  10,    2,  -10 },   // 0xB0 ''
+  {   753,   5,   7,   5,    0,  -12 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_8pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_8pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_8pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_8pt8bGlyphs,
+  0x20, 0x6F, 19 };
+
+// Approx. 1549 bytes
@@ -0,0 +1,190 @@
+const uint8_t FreeSans_subset_9pt8bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xA3, 0xC0, 0x00, 0x30, 0x78, 0x41, 0x11, 0x86, 0x32,
+  0x04, 0x48, 0x07, 0x90, 0x00, 0x40, 0x00, 0x9E, 0x02, 0x26, 0x04, 0x84,
+  0x11, 0x08, 0x21, 0x30, 0x83, 0xC0, 0xFA, 0x12, 0x24, 0x44, 0xCC, 0xCC,
+  0xC4, 0x46, 0x23, 0x10, 0x8C, 0x46, 0x22, 0x22, 0x22, 0x22, 0x64, 0x48,
+  0x80, 0x08, 0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x08, 0xF0, 0xF0,
+  0xF0, 0x08, 0x44, 0x21, 0x10, 0x84, 0x42, 0x11, 0x08, 0x00, 0x3C, 0x66,
+  0xC2, 0xC3, 0x83, 0x83, 0x83, 0x83, 0x83, 0xC3, 0xC2, 0x66, 0x3C, 0x11,
+  0x3F, 0x11, 0x11, 0x11, 0x11, 0x10, 0x3C, 0x66, 0xC3, 0xC3, 0x83, 0x03,
+  0x06, 0x1C, 0x30, 0x40, 0xC0, 0xFF, 0xFF, 0x3C, 0xE6, 0xC2, 0x83, 0x02,
+  0x06, 0x1C, 0x03, 0x03, 0x83, 0x83, 0xE6, 0x7C, 0x02, 0x03, 0x03, 0x81,
+  0x41, 0xA1, 0x90, 0x88, 0xC4, 0xC2, 0x7F, 0xC0, 0x80, 0x40, 0x20, 0x7E,
+  0x7E, 0x40, 0xC0, 0xFC, 0xE6, 0xC3, 0x03, 0x03, 0x83, 0xC3, 0xE6, 0x3C,
+  0x3C, 0x66, 0xC3, 0xC0, 0x80, 0xBE, 0xC3, 0xC3, 0x83, 0xC3, 0xC3, 0x66,
+  0x3C, 0xFF, 0xFF, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x30, 0x30,
+  0x20, 0x20, 0x3C, 0x66, 0xC2, 0xC3, 0xC2, 0x66, 0x7C, 0xC2, 0x83, 0x83,
+  0xC3, 0xE6, 0x3C, 0x3C, 0x66, 0xC2, 0x83, 0x83, 0x83, 0xC7, 0x7F, 0x03,
+  0x03, 0xC2, 0x6E, 0x38, 0xF0, 0x00, 0xF0, 0x00, 0xC0, 0x78, 0x0E, 0x03,
+  0x07, 0x1C, 0xE0, 0x80, 0x3C, 0x66, 0x43, 0xC3, 0x03, 0x06, 0x0C, 0x18,
+  0x18, 0x18, 0x00, 0x18, 0x18, 0x06, 0x01, 0xC0, 0x3C, 0x05, 0x81, 0x98,
+  0x33, 0x04, 0x61, 0x86, 0x3F, 0xCC, 0x19, 0x81, 0xB0, 0x3C, 0x06, 0xFF,
+  0x30, 0xEC, 0x0B, 0x02, 0xC0, 0xB0, 0xEF, 0xF3, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x06, 0xFF, 0x00, 0x1F, 0x07, 0x71, 0x83, 0x60, 0x2C, 0x01, 0x00,
+  0x20, 0x04, 0x00, 0xC0, 0x78, 0x09, 0x83, 0x1D, 0xC1, 0xF0, 0xFF, 0x18,
+  0x73, 0x03, 0x60, 0x6C, 0x05, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x58, 0x1B,
+  0x03, 0x61, 0xCF, 0xF0, 0xFF, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F,
+  0xFB, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0xFD, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00,
+  0x1F, 0x87, 0x39, 0x81, 0xE0, 0x3C, 0x01, 0x00, 0x20, 0xFC, 0x01, 0xC0,
+  0x38, 0x05, 0x81, 0x9C, 0xF1, 0xFA, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0,
+  0x70, 0x1F, 0xFF, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x40, 0xFF,
+  0xF8, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x0E, 0x1E, 0x67,
+  0x80, 0xC0, 0xD8, 0x33, 0x0C, 0x63, 0x0C, 0xC1, 0xB0, 0x3F, 0x07, 0x30,
+  0xC3, 0x18, 0x63, 0x06, 0x60, 0x6C, 0x0C, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0x3E, 0x03, 0xF0,
+  0x7F, 0x05, 0xD0, 0x5D, 0x8D, 0xD8, 0x9C, 0x89, 0xCD, 0x9C, 0xD1, 0xC5,
+  0x1C, 0x71, 0xC6, 0x10, 0xE0, 0x78, 0x1F, 0x07, 0x41, 0xD8, 0x73, 0x1C,
+  0xC7, 0x19, 0xC3, 0x70, 0xDC, 0x1F, 0x03, 0xC0, 0xC0, 0x1F, 0x83, 0x9C,
+  0x60, 0x6C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C, 0x03,
+  0x60, 0x63, 0x9C, 0x1F, 0x00, 0xFF, 0x30, 0xEC, 0x0F, 0x03, 0xC0, 0xF0,
+  0x6F, 0xFB, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x1F, 0x03,
+  0x9C, 0x60, 0x6C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C,
+  0x12, 0x61, 0xE3, 0x9E, 0x1F, 0x30, 0x00, 0xFF, 0x98, 0x3B, 0x03, 0x60,
+  0x2C, 0x0D, 0x81, 0xBF, 0xC6, 0x0C, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0x6C,
+  0x06, 0x3E, 0x1C, 0xEC, 0x0B, 0x02, 0xC0, 0x1E, 0x01, 0xF0, 0x0E, 0x00,
+  0xE0, 0x3C, 0x0D, 0xCE, 0x3F, 0x00, 0xFF, 0xC2, 0x00, 0x80, 0x20, 0x08,
+  0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x00, 0xC0,
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x16,
+  0x0D, 0xCE, 0x1F, 0x00, 0xC0, 0x6C, 0x0D, 0x81, 0x30, 0x63, 0x0C, 0x61,
+  0x04, 0x60, 0xCC, 0x19, 0x01, 0x60, 0x38, 0x07, 0x00, 0x60, 0xC1, 0x83,
+  0x41, 0xC3, 0x61, 0xC3, 0x63, 0x42, 0x63, 0x46, 0x22, 0x66, 0x32, 0x66,
+  0x36, 0x24, 0x36, 0x24, 0x14, 0x3C, 0x14, 0x3C, 0x1C, 0x18, 0x18, 0x18,
+  0x60, 0x66, 0x06, 0x30, 0xC3, 0x0C, 0x19, 0x80, 0xD0, 0x0F, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0x80, 0xC0, 0xC0,
+  0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0F, 0xF8, 0xFB,
+  0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xE0, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0xF0, 0xFF, 0xC0, 0x7C, 0xE6, 0xC2, 0x02, 0x3E, 0xE2, 0x82,
+  0x86, 0xCE, 0x7B, 0xC0, 0xC0, 0xC0, 0xDC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC3, 0xE6, 0xBC, 0x3C, 0xDF, 0x0C, 0x08, 0x10, 0x20, 0xE1, 0xE6,
+  0x78, 0x03, 0x03, 0x03, 0x3B, 0xEF, 0xC3, 0x83, 0x83, 0x83, 0x83, 0xC3,
+  0xE7, 0x3F, 0x3C, 0x66, 0xC2, 0x83, 0xFF, 0x80, 0x80, 0xC2, 0x66, 0x3C,
+  0x39, 0x09, 0xF2, 0x10, 0x84, 0x21, 0x08, 0x42, 0x00, 0x3B, 0x6F, 0xC3,
+  0x83, 0x83, 0x83, 0x83, 0xC3, 0xEF, 0x3B, 0x02, 0xC6, 0x7C, 0xC1, 0x83,
+  0x06, 0xEE, 0x78, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x20, 0xF3, 0xFF,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xCC, 0xD8, 0xF0, 0xF8, 0xD8, 0xCC,
+  0xC4, 0xC6, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0xEE, 0x73, 0xC6, 0x1C,
+  0x61, 0xC6, 0x1C, 0x61, 0xC6, 0x1C, 0x61, 0xC6, 0x1C, 0x61, 0xBD, 0x4F,
+  0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x84, 0x3C, 0xE6, 0xC2, 0x83, 0x83,
+  0x83, 0x83, 0xC2, 0xE6, 0x3C, 0xBC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC3, 0xE6, 0xFC, 0xC0, 0xC0, 0xC0, 0x3B, 0x67, 0xC3, 0x83, 0x83, 0x83,
+  0x83, 0xC3, 0xE7, 0x3B, 0x03, 0x03, 0x03, 0x9B, 0xCC, 0xCC, 0xCC, 0xCC,
+  0x79, 0x9A, 0x1E, 0x0F, 0x83, 0xC1, 0xC1, 0xCE, 0xF8, 0x21, 0x09, 0xF2,
+  0x10, 0x84, 0x21, 0x08, 0x43, 0x80, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+  0xE3, 0xCE, 0xF4, 0xC1, 0x21, 0x98, 0xCC, 0x42, 0x61, 0x30, 0xD0, 0x38,
+  0x1C, 0x0C, 0x00, 0xC6, 0x12, 0x38, 0x91, 0xCC, 0xCA, 0x66, 0xD2, 0x16,
+  0xD0, 0xA7, 0x87, 0x1C, 0x38, 0xC0, 0xC6, 0x00, 0x43, 0x62, 0x36, 0x1C,
+  0x18, 0x18, 0x3C, 0x26, 0x62, 0xC3, 0xC3, 0x43, 0x42, 0x62, 0x26, 0x24,
+  0x34, 0x1C, 0x18, 0x18, 0x18, 0x10, 0x30, 0x60, 0xFE, 0x0C, 0x30, 0xC1,
+  0x06, 0x18, 0x60, 0x81, 0xFC, 0xFF, 0xFF, 0x80, 0x74, 0x63, 0x17, 0x00,
+  0x79, 0x34, 0x46, 0x21, 0x0F, 0xC0 };
+
+const GFXglyph FreeSans_subset_9pt8bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     5,  15,  13,  16,    0,  -12 },   // 0x25 '%'
+  {    30,   2,   4,   4,    1,  -12 },   // 0x27 '''
+  {    31,   4,  17,   6,    1,  -12 },   // 0x28 '('
+  {    40,   4,  17,   6,    1,  -12 },   // 0x29 ')'
+  {    49,   8,   9,  10,    1,   -8 },   // 0x2B '+'
+  {    58,   1,   5,   5,    2,   -1 },   // 0x2C ','
+  {    59,   4,   1,   6,    1,   -4 },   // 0x2D '-'
+  {    60,   2,   2,   4,    1,   -1 },   // 0x2E '.'
+  {    61,   5,  13,   5,    0,  -12 },   // 0x2F '/'
+  {    70,   8,  13,  10,    1,  -12 },   // 0x30 '0'
+  {    83,   4,  13,  10,    2,  -12 },   // 0x31 '1'
+  {    90,   8,  13,  10,    1,  -12 },   // 0x32 '2'
+  {   103,   8,  13,  10,    1,  -12 },   // 0x33 '3'
+  {   116,   9,  13,  10,    0,  -12 },   // 0x34 '4'
+  {   131,   8,  13,  10,    1,  -12 },   // 0x35 '5'
+  {   144,   8,  13,  10,    1,  -12 },   // 0x36 '6'
+  {   157,   8,  13,  10,    1,  -12 },   // 0x37 '7'
+  {   170,   8,  13,  10,    1,  -12 },   // 0x38 '8'
+  {   183,   8,  13,  10,    1,  -12 },   // 0x39 '9'
+  {   196,   2,  10,   4,    1,   -9 },   // 0x3A ':'
+  {   199,   8,   9,  10,    1,   -8 },   // 0x3E '>'
+  {   208,   8,  13,  10,    1,  -12 },   // 0x3F '?'
+  {   221,  11,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   239,  10,  13,  12,    1,  -12 },   // 0x42 'B'
+  {   256,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {   274,  11,  13,  12,    1,  -12 },   // 0x44 'D'
+  {   292,  10,  13,  11,    1,  -12 },   // 0x45 'E'
+  {   309,   9,  13,  11,    1,  -12 },   // 0x46 'F'
+  {   324,  11,  13,  13,    1,  -12 },   // 0x47 'G'
+  {   342,  10,  13,  13,    1,  -12 },   // 0x48 'H'
+  {   359,   1,  13,   5,    2,  -12 },   // 0x49 'I'
+  {   361,   7,  13,   9,    1,  -12 },   // 0x4A 'J'
+  {   373,  11,  13,  12,    1,  -12 },   // 0x4B 'K'
+  {   391,   8,  13,  10,    1,  -12 },   // 0x4C 'L'
+  {   404,  12,  13,  15,    1,  -12 },   // 0x4D 'M'
+  {   424,  10,  13,  13,    1,  -12 },   // 0x4E 'N'
+  {   441,  12,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   461,  10,  13,  12,    1,  -12 },   // 0x50 'P'
+  {   478,  12,  14,  14,    1,  -12 },   // 0x51 'Q'
+  {   499,  11,  13,  13,    1,  -12 },   // 0x52 'R'
+  {   517,  10,  13,  12,    1,  -12 },   // 0x53 'S'
+  {   534,  10,  13,  11,    1,  -12 },   // 0x54 'T'
+  {   551,  10,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   568,  11,  13,  11,    0,  -12 },   // 0x56 'V'
+  {   586,  16,  13,  17,    0,  -12 },   // 0x57 'W'
+  {   612,  12,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {   632,   9,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   647,   3,  17,   5,    1,  -12 },   // 0x5B '['
+  {   654,   4,  17,   5,    0,  -12 },   // 0x5D ']'
+  {   663,  10,   1,  10,    0,    3 },   // 0x5F '_'
+  {   665,   8,  10,  10,    1,   -9 },   // 0x61 'a'
+  {   675,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {   688,   7,  10,   9,    1,   -9 },   // 0x63 'c'
+  {   697,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {   710,   8,  10,   9,    1,   -9 },   // 0x65 'e'
+  {   720,   5,  13,   5,    0,  -12 },   // 0x66 'f'
+  {   729,   8,  13,  10,    1,   -9 },   // 0x67 'g'
+  {   742,   7,  13,   9,    1,  -12 },   // 0x68 'h'
+  {   754,   2,  13,   4,    1,  -12 },   // 0x69 'i'
+  {   758,   8,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {   771,   2,  13,   4,    1,  -12 },   // 0x6C 'l'
+  {   775,  12,  10,  14,    1,   -9 },   // 0x6D 'm'
+  {   790,   7,  10,   9,    1,   -9 },   // 0x6E 'n'
+  {   799,   8,  10,   9,    1,   -9 },   // 0x6F 'o'
+  {   809,   8,  13,  10,    1,   -9 },   // 0x70 'p'
+  {   822,   8,  13,  10,    1,   -9 },   // 0x71 'q'
+  {   835,   4,  10,   6,    1,   -9 },   // 0x72 'r'
+  {   840,   7,  10,   9,    1,   -9 },   // 0x73 's'
+  {   849,   5,  13,   5,    0,  -12 },   // 0x74 't'
+  {   858,   7,  10,   9,    1,   -9 },   // 0x75 'u'
+  {   867,   9,  10,   9,    0,   -9 },   // 0x76 'v'
+  {   879,  13,  10,  13,    0,   -9 },   // 0x77 'w'
+  {   896,   8,  10,   8,    0,   -9 },   // 0x78 'x'
+  {   906,   8,  14,   8,    0,   -9 },   // 0x79 'y'
+  {   920,   7,  10,   9,    1,   -9 },   // 0x7A 'z'
+  {   929,   1,  17,   4,    2,  -12 },   // 0x7C '|'
+  {   932,   5,   5,  11,    3,  -11 },   // 0xB0 ''
+  {   936,   6,   7,   6,    0,  -13 } }; // 0xB2 ''
+
+const uint8_t FreeSans_subset_9pt8bRemap[] PROGMEM = {
+  0x20, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x24, 0x25, 0x00, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x00, 0x00, 0x00, 0x36, 0x37, 0x00, 0x38, 0x39, 0x3A,
+  0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x51,
+  0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+  0x5B, 0x5C, 0x00, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXfont FreeSans_subset_9pt8b PROGMEM = {
+  (uint8_t  *)FreeSans_subset_9pt8bBitmaps,
+  (GFXglyph *)FreeSans_subset_9pt8bGlyphs,
+  0x20, 0x6F, 21 };
+
+// Approx. 1733 bytes
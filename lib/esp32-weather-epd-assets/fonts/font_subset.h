@@ -0,0 +1,16 @@
+#ifndef __FONTS_FONT_SUBSET_H__
+#define __FONTS_FONT_SUBSET_H__
+#include <Adafruit_GFX.h>
+
+// A font generated by fonts/subset_fonts.py. The glyph table of such a font
+// only holds the glyphs that are used, so text must be translated through
+// remap before it is measured or printed: remap[c - 0x20] is the code of
+// character c (0x20..0xFF) in the subset font, or 0 if it was left out.
+// Characters below 0x20 ('\n', '\r') are not translated.
+typedef struct font_subset
+{
+  const GFXfont *font;
+  const uint8_t *remap;
+} font_subset_t;
+
+#endif
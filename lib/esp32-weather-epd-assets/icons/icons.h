@@ -1060,6 +1060,10 @@ typedef enum icon_name {
   wind_direction_meteorological_9deg,
 } icon_name_t;
 
+#ifdef ICON_ATLAS
+// Returns the bitmap decoded from the icon atlas (see icon_atlas.cpp).
+const unsigned char* getBitmap(icon_name_t icon, size_t size);
+#else
 constexpr const unsigned char* getBitmap(icon_name_t icon, size_t size)
 {
   switch (icon) {
@@ -15655,5 +15659,6 @@ constexpr const unsigned char* getBitmap(icon_name_t icon, size_t size)
     return nullptr;
   }
 }
+#endif // ICON_ATLAS
 
 #endif
\ No newline at end of file
@@ -0,0 +1,4161 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 pack_icon_atlas.py`
+
+#ifndef __ICONS_ATLAS_H__
+#define __ICONS_ATLAS_H__
+
+#include <cstdint>
+#include <pgmspace.h>
+
+#define ICON_ATLAS_VERSION 1
+#define ICON_ATLAS_NUM_SIZES 3
+#define ICON_ATLAS_NONE 0xff
+
+// 150 bitmaps, 277000 bytes uncompressed, 46006 bytes compressed
+const uint16_t ICON_ATLAS_SIZES[ICON_ATLAS_NUM_SIZES] = {32, 64, 196};
+
+// indexed by icon_name_t
+const uint8_t ICON_ATLAS_SLOT[1042] PROGMEM = {
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, 0, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 1, 2,
+  ICON_ATLAS_NONE, 3, 4, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 5, ICON_ATLAS_NONE,
+  6, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 7, 8, 9, 10, 11, ICON_ATLAS_NONE, 12,
+  ICON_ATLAS_NONE, 13, ICON_ATLAS_NONE, 14, 15, 16, 17, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, 18, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, 19, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, 20, 21, 22, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 23, 24, 25, 26, 27, 28,
+  ICON_ATLAS_NONE, 29, ICON_ATLAS_NONE, 30, ICON_ATLAS_NONE, 31, 32, 33,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 34,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 35, 36, 37,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 38, 39,
+  40, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 41, 42, 43, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, 44, 45, ICON_ATLAS_NONE, 46,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, 47, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, 48, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, 49,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+  ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE, ICON_ATLAS_NONE,
+};
+
+// indexed by [slot][size index]
+const uint32_t ICON_ATLAS_OFFSET[50][ICON_ATLAS_NUM_SIZES] PROGMEM = {
+  {0, 57, 170}, // wi_cloud
+  {529, 602, 747}, // wi_cloudy
+  {1206, 1279, 1422}, // wi_cloudy_gusts
+  {1914, 2010, 2207}, // wi_day_cloudy
+  {2830, 2942, 3171}, // wi_day_cloudy_gusts
+  {3932, 4016, 4190}, // wi_day_fog
+  {4778, 4851, 4988}, // wi_day_haze
+  {5465, 5616, 5933}, // wi_day_rain
+  {6964, 7099, 7387}, // wi_day_rain_mix
+  {8325, 8462, 8751}, // wi_day_rain_wind
+  {9687, 9814, 10089}, // wi_day_showers
+  {10987, 11112, 11382}, // wi_day_sleet
+  {12253, 12368, 12625}, // wi_day_snow
+  {13457, 13572, 13829}, // wi_day_snow_wind
+  {14661, 14796, 15089}, // wi_day_storm_showers
+  {16030, 16115, 16290}, // wi_day_sunny
+  {16909, 17015, 17220}, // wi_day_sunny_overcast
+  {17899, 18052, 18371}, // wi_day_thunderstorm
+  {19392, 19431, 19527}, // wi_dust
+  {19797, 19842, 19932}, // wi_fog
+  {20245, 20306, 20431}, // wi_na
+  {20819, 20892, 21043}, // wi_night_alt_cloudy
+  {21504, 21591, 21772}, // wi_night_alt_cloudy_gusts
+  {22367, 22434, 22563}, // wi_night_alt_partly_cloudy
+  {22991, 23119, 23388}, // wi_night_alt_rain
+  {24247, 24359, 24605}, // wi_night_alt_rain_mix
+  {25383, 25499, 25740}, // wi_night_alt_rain_wind
+  {26514, 26620, 26847}, // wi_night_alt_showers
+  {27576, 27674, 27896}, // wi_night_alt_sleet
+  {28605, 28693, 28902}, // wi_night_alt_snow
+  {29571, 29659, 29868}, // wi_night_alt_snow_wind
+  {30537, 30649, 30894}, // wi_night_alt_storm_showers
+  {31666, 31794, 32065}, // wi_night_alt_thunderstorm
+  {32920, 32975, 33084}, // wi_night_clear
+  {33461, 33524, 33648}, // wi_night_fog
+  {34068, 34180, 34411}, // wi_rain
+  {35158, 35252, 35458}, // wi_rain_mix
+  {36126, 36224, 36427}, // wi_rain_wind
+  {37083, 37134, 37244}, // wi_sandstorm
+  {37625, 37713, 37900}, // wi_showers
+  {38528, 38610, 38794}, // wi_sleet
+  {39396, 39463, 39600}, // wi_smoke
+  {40079, 40151, 40320}, // wi_snow
+  {40881, 40953, 41122}, // wi_snow_wind
+  {41683, 41728, 41819}, // wi_stars
+  {42227, 42321, 42524}, // wi_storm_showers
+  {43181, 43208, 43264}, // wi_strong_wind
+  {43491, 43605, 43840}, // wi_thunderstorm
+  {44601, 44677, 44832}, // wi_tornado
+  {45353, 45416, 45539}, // wi_volcano
+};
+
+const uint8_t ICON_ATLAS_DATA[46006] PROGMEM = {
+  0x8d, 0x02, 0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x15, 0x03, 0x07,
+  0x02, 0x14, 0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a,
+  0x06, 0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0b, 0x02, 0x10,
+  0x02, 0x0c, 0x04, 0x0c, 0x04, 0x0d, 0x12, 0xa7, 0x02, 0x9a, 0x08, 0x09,
+  0x35, 0x0d, 0x32, 0x0f, 0x30, 0x07, 0x03, 0x07, 0x2e, 0x05, 0x09, 0x05,
+  0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04,
+  0x28, 0x04, 0x11, 0x04, 0x27, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09,
+  0x1e, 0x08, 0x12, 0x0a, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06,
+  0x17, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x24, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03,
+  0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x15, 0x04, 0x22, 0x04, 0x16, 0x05, 0x20, 0x05,
+  0x17, 0x06, 0x1c, 0x06, 0x19, 0x26, 0x1b, 0x24, 0x1e, 0x20, 0x23, 0x1a,
+  0xd3, 0x08, 0x99, 0x4a, 0x09, 0xb5, 0x01, 0x14, 0xad, 0x01, 0x1b, 0xa7,
+  0x01, 0x1f, 0xa3, 0x01, 0x23, 0x9f, 0x01, 0x27, 0x9b, 0x01, 0x2b, 0x98,
+  0x01, 0x2d, 0x95, 0x01, 0x30, 0x93, 0x01, 0x33, 0x90, 0x01, 0x35, 0x8e,
+  0x01, 0x18, 0x07, 0x18, 0x8c, 0x01, 0x14, 0x11, 0x14, 0x8a, 0x01, 0x13,
+  0x15, 0x13, 0x88, 0x01, 0x11, 0x1a, 0x12, 0x86, 0x01, 0x11, 0x1d, 0x10,
+  0x86, 0x01, 0x0f, 0x21, 0x0f, 0x84, 0x01, 0x0f, 0x23, 0x0f, 0x82, 0x01,
+  0x0f, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01, 0x0e, 0x29,
+  0x0e, 0x7e, 0x0e, 0x2b, 0x0d, 0x7e, 0x0d, 0x2d, 0x0d, 0x7d, 0x0c, 0x2f,
+  0x0c, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c, 0x0c, 0x31, 0x0c, 0x7a, 0x0d, 0x31,
+  0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x33, 0x0c, 0x78, 0x0c, 0x35,
+  0x0b, 0x78, 0x0c, 0x35, 0x12, 0x6f, 0x0e, 0x35, 0x17, 0x67, 0x10, 0x37,
+  0x19, 0x62, 0x12, 0x37, 0x1b, 0x5e, 0x14, 0x37, 0x1d, 0x5a, 0x16, 0x37,
+  0x1e, 0x58, 0x17, 0x37, 0x20, 0x55, 0x18, 0x37, 0x21, 0x53, 0x19, 0x38,
+  0x21, 0x51, 0x19, 0x39, 0x22, 0x4f, 0x1a, 0x39, 0x23, 0x4d, 0x15, 0x4e,
+  0x15, 0x4b, 0x12, 0x56, 0x12, 0x49, 0x11, 0x5a, 0x11, 0x48, 0x0f, 0x5e,
+  0x0f, 0x47, 0x0f, 0x60, 0x0f, 0x45, 0x0f, 0x62, 0x0f, 0x44, 0x0e, 0x64,
+  0x0e, 0x43, 0x0e, 0x66, 0x0e, 0x42, 0x0d, 0x68, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x3f, 0x0c, 0x6e,
+  0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0b, 0x3d, 0x0c, 0x70, 0x0c, 0x3c, 0x0c, 0x70, 0x0c, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0c, 0x71,
+  0x0b, 0x3c, 0x0c, 0x70, 0x0c, 0x3d, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0b, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e,
+  0x0c, 0x3f, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0d, 0x6a,
+  0x0d, 0x41, 0x0d, 0x68, 0x0d, 0x42, 0x0e, 0x66, 0x0e, 0x43, 0x0e, 0x64,
+  0x0e, 0x44, 0x0f, 0x62, 0x0f, 0x45, 0x0f, 0x60, 0x0f, 0x47, 0x0f, 0x5e,
+  0x0f, 0x48, 0x11, 0x5a, 0x11, 0x49, 0x12, 0x56, 0x12, 0x4b, 0x15, 0x4e,
+  0x15, 0x4d, 0x76, 0x4f, 0x74, 0x51, 0x72, 0x53, 0x70, 0x56, 0x6d, 0x58,
+  0x6a, 0x5c, 0x67, 0x5e, 0x64, 0x63, 0x5f, 0x68, 0x59, 0x70, 0x4e, 0xcf,
+  0x51, 0x90, 0x02, 0x05, 0x1a, 0x03, 0x02, 0x02, 0x15, 0x04, 0x06, 0x02,
+  0x12, 0x08, 0x05, 0x02, 0x10, 0x03, 0x04, 0x03, 0x04, 0x04, 0x0e, 0x02,
+  0x06, 0x02, 0x07, 0x02, 0x0c, 0x02, 0x08, 0x03, 0x06, 0x02, 0x0a, 0x03,
+  0x08, 0x05, 0x04, 0x02, 0x09, 0x02, 0x0d, 0x03, 0x03, 0x02, 0x08, 0x02,
+  0x0f, 0x02, 0x02, 0x02, 0x09, 0x02, 0x10, 0x01, 0x01, 0x02, 0x0a, 0x02,
+  0x0f, 0x02, 0x0e, 0x01, 0x0f, 0x02, 0x0e, 0x03, 0x0c, 0x02, 0x10, 0x0f,
+  0xab, 0x02, 0xa1, 0x08, 0x09, 0x36, 0x0b, 0x34, 0x0e, 0x32, 0x04, 0x06,
+  0x05, 0x29, 0x06, 0x0d, 0x04, 0x27, 0x0a, 0x0c, 0x04, 0x24, 0x0e, 0x0b,
+  0x03, 0x23, 0x06, 0x04, 0x06, 0x0a, 0x07, 0x1e, 0x05, 0x08, 0x05, 0x09,
+  0x08, 0x1d, 0x04, 0x0a, 0x04, 0x09, 0x09, 0x1b, 0x04, 0x0c, 0x04, 0x0e,
+  0x04, 0x1a, 0x03, 0x0e, 0x03, 0x0f, 0x04, 0x18, 0x04, 0x0e, 0x04, 0x0f,
+  0x03, 0x16, 0x05, 0x10, 0x07, 0x0b, 0x04, 0x14, 0x06, 0x10, 0x09, 0x0a,
+  0x03, 0x13, 0x06, 0x11, 0x0a, 0x09, 0x03, 0x12, 0x04, 0x1a, 0x05, 0x07,
+  0x04, 0x11, 0x04, 0x1d, 0x03, 0x07, 0x03, 0x12, 0x03, 0x1e, 0x04, 0x05,
+  0x04, 0x12, 0x03, 0x1f, 0x03, 0x04, 0x04, 0x12, 0x03, 0x20, 0x03, 0x02,
+  0x06, 0x12, 0x03, 0x20, 0x03, 0x02, 0x04, 0x14, 0x03, 0x20, 0x03, 0x02,
+  0x03, 0x16, 0x03, 0x1f, 0x03, 0x1b, 0x03, 0x1e, 0x04, 0x1b, 0x04, 0x1d,
+  0x03, 0x1d, 0x04, 0x1a, 0x05, 0x1e, 0x21, 0x20, 0x1f, 0x22, 0x1c, 0x27,
+  0x16, 0xda, 0x08, 0xac, 0x4a, 0x0e, 0xb3, 0x01, 0x15, 0xac, 0x01, 0x1a,
+  0xa9, 0x01, 0x1d, 0xa5, 0x01, 0x21, 0xa1, 0x01, 0x24, 0x9f, 0x01, 0x26,
+  0x9d, 0x01, 0x29, 0x9a, 0x01, 0x2b, 0x98, 0x01, 0x13, 0x07, 0x13, 0x96,
+  0x01, 0x10, 0x0f, 0x0f, 0x97, 0x01, 0x0d, 0x13, 0x0e, 0x99, 0x01, 0x09,
+  0x16, 0x0d, 0x9a, 0x01, 0x05, 0x19, 0x0d, 0x80, 0x01, 0x0e, 0x0c, 0x03,
+  0x1b, 0x0c, 0x7c, 0x15, 0x28, 0x0c, 0x78, 0x1b, 0x26, 0x0b, 0x76, 0x1f,
+  0x25, 0x0b, 0x73, 0x23, 0x24, 0x0a, 0x72, 0x25, 0x23, 0x0b, 0x70, 0x28,
+  0x22, 0x0a, 0x6e, 0x2b, 0x21, 0x0a, 0x6d, 0x2d, 0x21, 0x0f, 0x66, 0x14,
+  0x07, 0x14, 0x20, 0x13, 0x61, 0x11, 0x0f, 0x11, 0x1f, 0x15, 0x5e, 0x0f,
+  0x15, 0x0f, 0x1e, 0x17, 0x5b, 0x0e, 0x19, 0x0e, 0x1e, 0x18, 0x59, 0x0d,
+  0x1b, 0x0e, 0x1d, 0x19, 0x57, 0x0d, 0x1e, 0x0c, 0x1d, 0x1a, 0x55, 0x0c,
+  0x21, 0x0c, 0x1c, 0x1b, 0x54, 0x0b, 0x23, 0x0c, 0x1b, 0x1c, 0x52, 0x0b,
+  0x25, 0x0b, 0x1b, 0x1d, 0x51, 0x0b, 0x26, 0x0b, 0x29, 0x0f, 0x4f, 0x0b,
+  0x27, 0x0b, 0x2b, 0x0e, 0x4e, 0x0a, 0x29, 0x0b, 0x2b, 0x0d, 0x4d, 0x0b,
+  0x2a, 0x0a, 0x2d, 0x0c, 0x4c, 0x0a, 0x2b, 0x0a, 0x2e, 0x0b, 0x4c, 0x0a,
+  0x2c, 0x0a, 0x2e, 0x0b, 0x4a, 0x0a, 0x2d, 0x0a, 0x2e, 0x0b, 0x4a, 0x0a,
+  0x2d, 0x10, 0x29, 0x0a, 0x48, 0x0c, 0x2e, 0x13, 0x26, 0x0a, 0x44, 0x0e,
+  0x2f, 0x16, 0x23, 0x0a, 0x42, 0x10, 0x2f, 0x18, 0x21, 0x0a, 0x40, 0x12,
+  0x2f, 0x1a, 0x20, 0x09, 0x3f, 0x13, 0x2f, 0x1b, 0x1f, 0x09, 0x3e, 0x14,
+  0x2f, 0x1d, 0x1d, 0x09, 0x3c, 0x15, 0x31, 0x1d, 0x1c, 0x09, 0x3b, 0x16,
+  0x31, 0x1e, 0x1b, 0x0a, 0x3a, 0x14, 0x33, 0x1f, 0x1a, 0x09, 0x3a, 0x10,
+  0x47, 0x11, 0x19, 0x09, 0x39, 0x0e, 0x4d, 0x0e, 0x19, 0x09, 0x38, 0x0d,
+  0x50, 0x0e, 0x17, 0x0a, 0x38, 0x0c, 0x53, 0x0d, 0x16, 0x0a, 0x37, 0x0c,
+  0x55, 0x0c, 0x16, 0x0a, 0x36, 0x0c, 0x57, 0x0c, 0x14, 0x0a, 0x37, 0x0b,
+  0x59, 0x0b, 0x14, 0x0a, 0x36, 0x0b, 0x5b, 0x0b, 0x12, 0x0b, 0x36, 0x0a,
+  0x5d, 0x0a, 0x11, 0x0b, 0x37, 0x0a, 0x5d, 0x0a, 0x10, 0x0c, 0x36, 0x0a,
+  0x5f, 0x0a, 0x0e, 0x0c, 0x37, 0x0a, 0x5f, 0x0a, 0x0c, 0x0e, 0x37, 0x0a,
+  0x5f, 0x0a, 0x0a, 0x0f, 0x38, 0x09, 0x61, 0x09, 0x06, 0x12, 0x39, 0x09,
+  0x61, 0x09, 0x05, 0x12, 0x3a, 0x09, 0x61, 0x0a, 0x04, 0x11, 0x3a, 0x0a,
+  0x61, 0x0a, 0x04, 0x10, 0x3b, 0x0a, 0x61, 0x0a, 0x04, 0x0f, 0x3c, 0x0a,
+  0x61, 0x0a, 0x04, 0x0e, 0x3d, 0x0a, 0x61, 0x0a, 0x04, 0x0c, 0x40, 0x09,
+  0x61, 0x0a, 0x04, 0x0a, 0x42, 0x09, 0x61, 0x09, 0x05, 0x08, 0x44, 0x09,
+  0x61, 0x09, 0x05, 0x04, 0x48, 0x0a, 0x5f, 0x0a, 0x51, 0x0a, 0x5f, 0x0a,
+  0x51, 0x0b, 0x5e, 0x0a, 0x52, 0x0a, 0x5d, 0x0a, 0x53, 0x0b, 0x5c, 0x0a,
+  0x54, 0x0a, 0x5b, 0x0b, 0x54, 0x0b, 0x59, 0x0b, 0x55, 0x0c, 0x57, 0x0c,
+  0x56, 0x0c, 0x55, 0x0c, 0x58, 0x0c, 0x53, 0x0d, 0x58, 0x0e, 0x4f, 0x0e,
+  0x5a, 0x0f, 0x4c, 0x0e, 0x5c, 0x10, 0x47, 0x10, 0x5d, 0x67, 0x5e, 0x65,
+  0x60, 0x63, 0x63, 0x5f, 0x66, 0x5d, 0x69, 0x5a, 0x6b, 0x57, 0x6f, 0x53,
+  0x74, 0x4d, 0x7c, 0x44, 0xe2, 0x51, 0x8e, 0x02, 0x05, 0x19, 0x09, 0x16,
+  0x03, 0x05, 0x02, 0x16, 0x02, 0x07, 0x02, 0x14, 0x02, 0x09, 0x02, 0x12,
+  0x03, 0x09, 0x05, 0x0d, 0x04, 0x04, 0x02, 0x04, 0x06, 0x0c, 0x02, 0x05,
+  0x04, 0x07, 0x02, 0x0b, 0x02, 0x06, 0x01, 0x02, 0x02, 0x07, 0x02, 0x15,
+  0x02, 0x07, 0x02, 0x08, 0x0f, 0x07, 0x02, 0x08, 0x0e, 0x08, 0x02, 0x1d,
+  0x02, 0x0a, 0x06, 0x05, 0x0b, 0x09, 0x09, 0x02, 0x0b, 0x11, 0x02, 0x1f,
+  0x01, 0x1b, 0x05, 0x1c, 0x03, 0xb4, 0x01, 0x9c, 0x08, 0x09, 0x35, 0x0d,
+  0x32, 0x10, 0x2f, 0x07, 0x04, 0x07, 0x2d, 0x05, 0x09, 0x06, 0x2b, 0x05,
+  0x0c, 0x04, 0x2a, 0x05, 0x0e, 0x04, 0x29, 0x04, 0x0f, 0x04, 0x28, 0x04,
+  0x11, 0x04, 0x27, 0x04, 0x11, 0x06, 0x23, 0x06, 0x11, 0x09, 0x1e, 0x08,
+  0x12, 0x0a, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x09, 0x06, 0x0d, 0x06,
+  0x17, 0x05, 0x0a, 0x08, 0x0e, 0x05, 0x16, 0x04, 0x0a, 0x0a, 0x0e, 0x04,
+  0x16, 0x04, 0x0b, 0x03, 0x02, 0x04, 0x0f, 0x04, 0x15, 0x03, 0x12, 0x04,
+  0x0e, 0x04, 0x2a, 0x04, 0x0e, 0x04, 0x2a, 0x04, 0x0f, 0x03, 0x28, 0x05,
+  0x10, 0x03, 0x10, 0x1d, 0x0f, 0x04, 0x10, 0x1c, 0x10, 0x04, 0x10, 0x1b,
+  0x11, 0x04, 0x3b, 0x04, 0x3b, 0x05, 0x39, 0x06, 0x12, 0x0f, 0x08, 0x16,
+  0x13, 0x11, 0x05, 0x16, 0x14, 0x12, 0x04, 0x14, 0x17, 0x11, 0x05, 0x10,
+  0x28, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x36, 0x03, 0x02, 0x04, 0x37, 0x09,
+  0x37, 0x08, 0x39, 0x06, 0xa8, 0x05, 0x9e, 0x4a, 0x0b, 0xb4, 0x01, 0x15,
+  0xac, 0x01, 0x1b, 0xa7, 0x01, 0x20, 0xa2, 0x01, 0x24, 0x9e, 0x01, 0x28,
+  0x9a, 0x01, 0x2b, 0x98, 0x01, 0x2e, 0x95, 0x01, 0x30, 0x92, 0x01, 0x33,
+  0x90, 0x01, 0x35, 0x8e, 0x01, 0x17, 0x0a, 0x16, 0x8c, 0x01, 0x14, 0x12,
+  0x13, 0x8a, 0x01, 0x12, 0x17, 0x12, 0x88, 0x01, 0x11, 0x1b, 0x11, 0x87,
+  0x01, 0x10, 0x1e, 0x10, 0x85, 0x01, 0x0f, 0x21, 0x10, 0x83, 0x01, 0x0f,
+  0x24, 0x0e, 0x82, 0x01, 0x0f, 0x26, 0x0e, 0x81, 0x01, 0x0e, 0x28, 0x0e,
+  0x7f, 0x0e, 0x2a, 0x0d, 0x7f, 0x0d, 0x2c, 0x0d, 0x7d, 0x0d, 0x2d, 0x0d,
+  0x7d, 0x0c, 0x2f, 0x0d, 0x7b, 0x0d, 0x30, 0x0c, 0x7b, 0x0c, 0x31, 0x0c,
+  0x7b, 0x0c, 0x32, 0x0c, 0x79, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x34, 0x0b,
+  0x79, 0x0b, 0x35, 0x0c, 0x78, 0x0b, 0x35, 0x14, 0x6d, 0x0e, 0x36, 0x17,
+  0x66, 0x11, 0x36, 0x1a, 0x61, 0x12, 0x37, 0x1c, 0x5e, 0x13, 0x37, 0x1e,
+  0x5a, 0x15, 0x38, 0x1e, 0x58, 0x16, 0x38, 0x20, 0x54, 0x18, 0x38, 0x21,
+  0x52, 0x19, 0x38, 0x22, 0x50, 0x1a, 0x38, 0x23, 0x4e, 0x19, 0x17, 0x0a,
+  0x19, 0x24, 0x4c, 0x14, 0x1a, 0x0f, 0x28, 0x14, 0x4a, 0x12, 0x1c, 0x12,
+  0x29, 0x12, 0x49, 0x10, 0x1c, 0x16, 0x29, 0x10, 0x48, 0x0f, 0x1d, 0x18,
+  0x2a, 0x0f, 0x46, 0x0f, 0x1d, 0x1a, 0x2a, 0x0f, 0x45, 0x0e, 0x1e, 0x1b,
+  0x2a, 0x0e, 0x44, 0x0e, 0x1e, 0x1d, 0x2a, 0x0e, 0x43, 0x0d, 0x1f, 0x1d,
+  0x2b, 0x0d, 0x42, 0x0d, 0x20, 0x1e, 0x2b, 0x0d, 0x41, 0x0c, 0x21, 0x1e,
+  0x2c, 0x0c, 0x40, 0x0d, 0x22, 0x0b, 0x05, 0x0e, 0x2b, 0x0d, 0x3f, 0x0c,
+  0x23, 0x09, 0x08, 0x0d, 0x2c, 0x0c, 0x3f, 0x0c, 0x25, 0x06, 0x0a, 0x0c,
+  0x2c, 0x0c, 0x3f, 0x0b, 0x37, 0x0b, 0x2d, 0x0b, 0x81, 0x01, 0x0c, 0x2c,
+  0x0c, 0x80, 0x01, 0x0c, 0x2d, 0x0b, 0x80, 0x01, 0x0c, 0x2d, 0x0b, 0x80,
+  0x01, 0x0c, 0x2d, 0x0b, 0x80, 0x01, 0x0b, 0x2e, 0x0b, 0x80, 0x01, 0x0b,
+  0x2e, 0x0b, 0x7f, 0x0c, 0x2e, 0x0b, 0x7e, 0x0d, 0x2e, 0x0b, 0x7c, 0x0f,
+  0x2e, 0x0b, 0x32, 0x58, 0x2f, 0x0b, 0x31, 0x59, 0x2f, 0x0b, 0x30, 0x59,
+  0x30, 0x0b, 0x30, 0x58, 0x31, 0x0b, 0x30, 0x58, 0x30, 0x0c, 0x30, 0x57,
+  0x31, 0x0c, 0x30, 0x56, 0x32, 0x0b, 0x31, 0x54, 0x33, 0x0c, 0x32, 0x52,
+  0x34, 0x0c, 0x33, 0x4f, 0x35, 0x0c, 0x36, 0x49, 0x38, 0x0d, 0xb7, 0x01,
+  0x0d, 0xb6, 0x01, 0x0d, 0xb6, 0x01, 0x0e, 0xb5, 0x01, 0x0e, 0xb4, 0x01,
+  0x0f, 0xb4, 0x01, 0x10, 0xb2, 0x01, 0x11, 0xb1, 0x01, 0x12, 0xad, 0x01,
+  0x17, 0x39, 0x2c, 0x17, 0x47, 0x39, 0x30, 0x14, 0x46, 0x39, 0x32, 0x13,
+  0x45, 0x3a, 0x34, 0x11, 0x43, 0x3c, 0x35, 0x10, 0x42, 0x3d, 0x36, 0x0f,
+  0x41, 0x3e, 0x36, 0x0f, 0x3f, 0x40, 0x37, 0x0e, 0x3d, 0x43, 0x37, 0x0d,
+  0x3b, 0x46, 0x36, 0x0d, 0x38, 0x4b, 0x35, 0x0d, 0x33, 0x76, 0x0e, 0xb8,
+  0x01, 0x0c, 0xb9, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xa8,
+  0x01, 0x04, 0x0c, 0x0c, 0xa6, 0x01, 0x08, 0x09, 0x0d, 0xa6, 0x01, 0x09,
+  0x07, 0x0d, 0xa6, 0x01, 0x0d, 0x01, 0x10, 0xa6, 0x01, 0x1d, 0xa7, 0x01,
+  0x1d, 0xa7, 0x01, 0x1c, 0xa8, 0x01, 0x1c, 0xa8, 0x01, 0x1b, 0xaa, 0x01,
+  0x19, 0xac, 0x01, 0x17, 0xaf, 0x01, 0x14, 0xb1, 0x01, 0x11, 0xb5, 0x01,
+  0x0d, 0xbb, 0x01, 0x05, 0xb5, 0x2d, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02,
+  0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d, 0x02,
+  0x16, 0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05, 0x03,
+  0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x02, 0x09, 0x02,
+  0x08, 0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x04, 0x08, 0x05, 0x02, 0x01,
+  0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x11, 0x03,
+  0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x01, 0x01, 0x08, 0x02,
+  0x12, 0x02, 0x01, 0x02, 0x07, 0x03, 0x10, 0x02, 0x03, 0x01, 0x08, 0x04,
+  0x0c, 0x03, 0x0e, 0x11, 0xab, 0x02, 0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c,
+  0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c, 0x03, 0x1f, 0x05, 0x18, 0x04, 0x20,
+  0x04, 0x17, 0x05, 0x21, 0x03, 0x16, 0x05, 0x3b, 0x04, 0x2e, 0x08, 0x07,
+  0x02, 0x2d, 0x0c, 0x28, 0x08, 0x02, 0x0f, 0x25, 0x12, 0x04, 0x06, 0x22,
+  0x12, 0x08, 0x05, 0x20, 0x08, 0x01, 0x09, 0x0a, 0x05, 0x1e, 0x06, 0x08,
+  0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c, 0x04, 0x0b, 0x04, 0x1c, 0x04, 0x0e,
+  0x04, 0x0a, 0x04, 0x1b, 0x04, 0x0f, 0x05, 0x09, 0x04, 0x04, 0x07, 0x10,
+  0x04, 0x10, 0x04, 0x09, 0x04, 0x04, 0x08, 0x0f, 0x03, 0x11, 0x05, 0x08,
+  0x04, 0x04, 0x07, 0x0d, 0x06, 0x12, 0x08, 0x04, 0x04, 0x17, 0x07, 0x12,
+  0x0a, 0x02, 0x04, 0x16, 0x08, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15,
+  0x05, 0x1f, 0x07, 0x14, 0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15,
+  0x03, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x14,
+  0x04, 0x25, 0x04, 0x03, 0x01, 0x0f, 0x04, 0x25, 0x03, 0x03, 0x03, 0x0f,
+  0x03, 0x24, 0x04, 0x03, 0x04, 0x0e, 0x04, 0x23, 0x04, 0x03, 0x05, 0x0d,
+  0x05, 0x21, 0x05, 0x04, 0x03, 0x0f, 0x05, 0x1f, 0x05, 0x18, 0x05, 0x1d,
+  0x05, 0x19, 0x26, 0x1c, 0x23, 0x1e, 0x21, 0x22, 0x1a, 0xda, 0x08, 0x8a,
+  0x0a, 0x05, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0x8e, 0x01, 0x06, 0x25,
+  0x0b, 0x25, 0x05, 0x63, 0x08, 0x24, 0x0a, 0x25, 0x08, 0x60, 0x0a, 0x23,
+  0x0a, 0x24, 0x09, 0x5f, 0x0c, 0x23, 0x08, 0x23, 0x0c, 0x5e, 0x0d, 0x23,
+  0x06, 0x23, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0e, 0x49, 0x0f, 0x5f,
+  0x0e, 0x47, 0x10, 0x5f, 0x0e, 0x46, 0x10, 0x61, 0x0d, 0x45, 0x10, 0x63,
+  0x0c, 0x44, 0x10, 0x65, 0x0b, 0x44, 0x0f, 0x67, 0x0a, 0x43, 0x0f, 0x69,
+  0x08, 0x44, 0x0e, 0x6c, 0x05, 0x45, 0x0d, 0xb7, 0x01, 0x0c, 0xb8, 0x01,
+  0x0b, 0x92, 0x01, 0x10, 0x17, 0x0a, 0x90, 0x01, 0x16, 0x15, 0x08, 0x8e,
+  0x01, 0x1c, 0x13, 0x06, 0x8d, 0x01, 0x20, 0xa3, 0x01, 0x23, 0x9f, 0x01,
+  0x26, 0x9d, 0x01, 0x29, 0x7c, 0x10, 0x0d, 0x2c, 0x77, 0x18, 0x08, 0x2e,
+  0x73, 0x1e, 0x04, 0x30, 0x70, 0x22, 0x01, 0x32, 0x6d, 0x38, 0x0c, 0x14,
+  0x6a, 0x37, 0x12, 0x12, 0x68, 0x36, 0x16, 0x11, 0x66, 0x35, 0x1a, 0x0f,
+  0x64, 0x36, 0x1c, 0x0f, 0x62, 0x36, 0x1f, 0x0e, 0x60, 0x36, 0x21, 0x0d,
+  0x5f, 0x15, 0x0e, 0x15, 0x21, 0x0d, 0x5d, 0x13, 0x14, 0x13, 0x20, 0x0d,
+  0x5c, 0x12, 0x19, 0x11, 0x20, 0x0d, 0x5a, 0x11, 0x1c, 0x11, 0x20, 0x0c,
+  0x5a, 0x10, 0x1f, 0x10, 0x1f, 0x0c, 0x59, 0x0f, 0x22, 0x0f, 0x20, 0x0c,
+  0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c, 0x57, 0x0e, 0x27, 0x0e, 0x1f, 0x0b,
+  0x56, 0x0e, 0x29, 0x0d, 0x1f, 0x0b, 0x56, 0x0d, 0x2b, 0x0d, 0x1e, 0x0c,
+  0x54, 0x0d, 0x2c, 0x0d, 0x1f, 0x0b, 0x0f, 0x11, 0x34, 0x0c, 0x2e, 0x0d,
+  0x1e, 0x0b, 0x0e, 0x14, 0x31, 0x0d, 0x2f, 0x0c, 0x1e, 0x0b, 0x0d, 0x16,
+  0x30, 0x0c, 0x30, 0x0d, 0x1d, 0x0b, 0x0c, 0x17, 0x2f, 0x0d, 0x31, 0x0c,
+  0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18,
+  0x2e, 0x0c, 0x33, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x34, 0x0c,
+  0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x35, 0x0f, 0x18, 0x0b, 0x0c, 0x17,
+  0x2c, 0x0e, 0x35, 0x16, 0x11, 0x0b, 0x0d, 0x15, 0x2a, 0x10, 0x36, 0x19,
+  0x0e, 0x0b, 0x0f, 0x12, 0x29, 0x12, 0x36, 0x1b, 0x0c, 0x0b, 0x48, 0x14,
+  0x37, 0x1c, 0x09, 0x0c, 0x47, 0x15, 0x37, 0x1e, 0x07, 0x0b, 0x46, 0x17,
+  0x37, 0x1f, 0x06, 0x0b, 0x45, 0x17, 0x38, 0x20, 0x04, 0x0c, 0x44, 0x18,
+  0x38, 0x22, 0x02, 0x0c, 0x43, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2f,
+  0x42, 0x15, 0x4c, 0x21, 0x41, 0x12, 0x55, 0x1b, 0x41, 0x11, 0x59, 0x19,
+  0x41, 0x0f, 0x5d, 0x16, 0x41, 0x0f, 0x60, 0x14, 0x40, 0x0f, 0x62, 0x12,
+  0x41, 0x0e, 0x64, 0x10, 0x41, 0x0e, 0x66, 0x0e, 0x42, 0x0d, 0x68, 0x0d,
+  0x41, 0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0d, 0x40, 0x0c, 0x6c, 0x0c,
+  0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x6f, 0x0c,
+  0x3e, 0x0b, 0x6f, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b,
+  0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0c,
+  0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x09, 0x07, 0x2d, 0x0c, 0x70, 0x0b, 0x08, 0x09, 0x2c, 0x0c, 0x70, 0x0b,
+  0x08, 0x0a, 0x2c, 0x0b, 0x70, 0x0b, 0x07, 0x0c, 0x2b, 0x0b, 0x70, 0x0b,
+  0x07, 0x0d, 0x2a, 0x0c, 0x6e, 0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x6e, 0x0c,
+  0x07, 0x0e, 0x29, 0x0c, 0x6d, 0x0c, 0x08, 0x0f, 0x29, 0x0c, 0x6c, 0x0c,
+  0x09, 0x0e, 0x29, 0x0c, 0x6b, 0x0d, 0x0a, 0x0d, 0x29, 0x0d, 0x6a, 0x0c,
+  0x0c, 0x0c, 0x2a, 0x0d, 0x68, 0x0d, 0x0d, 0x0b, 0x2a, 0x0e, 0x66, 0x0d,
+  0x0f, 0x09, 0x2c, 0x0e, 0x64, 0x0e, 0x10, 0x07, 0x2d, 0x0f, 0x62, 0x0e,
+  0x13, 0x03, 0x30, 0x0f, 0x60, 0x0f, 0x47, 0x0f, 0x5e, 0x0f, 0x48, 0x11,
+  0x5a, 0x10, 0x4a, 0x12, 0x56, 0x12, 0x4b, 0x14, 0x4f, 0x15, 0x4d, 0x76,
+  0x4f, 0x74, 0x51, 0x72, 0x53, 0x70, 0x55, 0x6d, 0x59, 0x6a, 0x5b, 0x67,
+  0x5f, 0x63, 0x64, 0x5e, 0x68, 0x59, 0x70, 0x4f, 0xe3, 0x51, 0x33, 0x02,
+  0x1e, 0x02, 0x1e, 0x02, 0x17, 0x02, 0x06, 0x01, 0x06, 0x01, 0x10, 0x02,
+  0x0c, 0x02, 0x1d, 0x02, 0x16, 0x06, 0x14, 0x0d, 0x11, 0x09, 0x05, 0x02,
+  0x0f, 0x03, 0x05, 0x02, 0x05, 0x02, 0x0f, 0x02, 0x07, 0x02, 0x05, 0x02,
+  0x02, 0x03, 0x08, 0x02, 0x08, 0x02, 0x05, 0x02, 0x02, 0x04, 0x06, 0x03,
+  0x09, 0x04, 0x02, 0x02, 0x0a, 0x04, 0x04, 0x02, 0x04, 0x07, 0x0b, 0x02,
+  0x05, 0x04, 0x07, 0x03, 0x0a, 0x02, 0x06, 0x01, 0x02, 0x02, 0x07, 0x02,
+  0x15, 0x02, 0x07, 0x02, 0x08, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x05, 0x0e,
+  0x08, 0x02, 0x01, 0x02, 0x1a, 0x02, 0x03, 0x01, 0x05, 0x07, 0x05, 0x0b,
+  0x08, 0x0a, 0x02, 0x0b, 0x11, 0x02, 0x1f, 0x01, 0x1b, 0x05, 0x1c, 0x03,
+  0xb7, 0x01, 0xa7, 0x01, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3d,
+  0x03, 0x3d, 0x03, 0x2f, 0x02, 0x0c, 0x03, 0x0c, 0x02, 0x20, 0x04, 0x0b,
+  0x02, 0x0c, 0x04, 0x1f, 0x05, 0x17, 0x05, 0x20, 0x04, 0x16, 0x05, 0x22,
+  0x02, 0x17, 0x04, 0x31, 0x02, 0x09, 0x03, 0x2e, 0x09, 0x06, 0x02, 0x2d,
+  0x0d, 0x27, 0x09, 0x02, 0x0f, 0x24, 0x12, 0x05, 0x06, 0x22, 0x11, 0x09,
+  0x05, 0x20, 0x08, 0x01, 0x08, 0x0b, 0x04, 0x1f, 0x05, 0x09, 0x05, 0x0b,
+  0x04, 0x1d, 0x05, 0x0b, 0x05, 0x0a, 0x04, 0x1c, 0x05, 0x0d, 0x05, 0x0a,
+  0x03, 0x1c, 0x04, 0x0f, 0x04, 0x0a, 0x04, 0x04, 0x07, 0x10, 0x03, 0x11,
+  0x04, 0x09, 0x04, 0x03, 0x08, 0x0f, 0x04, 0x11, 0x04, 0x09, 0x04, 0x04,
+  0x07, 0x0d, 0x06, 0x11, 0x09, 0x04, 0x04, 0x16, 0x08, 0x12, 0x0a, 0x01,
+  0x04, 0x16, 0x08, 0x13, 0x0f, 0x15, 0x06, 0x09, 0x06, 0x0d, 0x09, 0x15,
+  0x05, 0x09, 0x08, 0x0e, 0x06, 0x15, 0x04, 0x0b, 0x09, 0x0e, 0x04, 0x16,
+  0x04, 0x0b, 0x04, 0x01, 0x04, 0x0f, 0x04, 0x15, 0x03, 0x12, 0x04, 0x0e,
+  0x04, 0x2a, 0x04, 0x0e, 0x04, 0x2a, 0x04, 0x0f, 0x03, 0x28, 0x05, 0x10,
+  0x03, 0x03, 0x02, 0x0a, 0x1e, 0x0f, 0x04, 0x02, 0x04, 0x09, 0x1d, 0x10,
+  0x04, 0x02, 0x05, 0x08, 0x1c, 0x11, 0x04, 0x03, 0x04, 0x34, 0x04, 0x05,
+  0x03, 0x33, 0x05, 0x39, 0x06, 0x11, 0x10, 0x08, 0x16, 0x12, 0x12, 0x06,
+  0x15, 0x13, 0x13, 0x05, 0x13, 0x16, 0x12, 0x05, 0x10, 0x28, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x36, 0x03, 0x02, 0x05, 0x36, 0x09, 0x37, 0x08, 0x39,
+  0x06, 0xae, 0x05, 0x91, 0x0a, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a,
+  0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0x8e, 0x01, 0x06, 0x24, 0x0b, 0x25, 0x06, 0x62, 0x09, 0x24, 0x0a, 0x24,
+  0x09, 0x60, 0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x5f, 0x0c, 0x23, 0x08, 0x23,
+  0x0c, 0x5e, 0x0d, 0x23, 0x06, 0x23, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e,
+  0x0f, 0x48, 0x0f, 0x5f, 0x0e, 0x47, 0x10, 0x5f, 0x0e, 0x46, 0x10, 0x61,
+  0x0d, 0x45, 0x10, 0x63, 0x0c, 0x44, 0x10, 0x65, 0x0b, 0x44, 0x0f, 0x67,
+  0x09, 0x44, 0x0f, 0x69, 0x08, 0x44, 0x0e, 0x6c, 0x04, 0x46, 0x0d, 0xb7,
+  0x01, 0x0c, 0x94, 0x01, 0x0a, 0x1a, 0x0b, 0x90, 0x01, 0x14, 0x15, 0x0a,
+  0x8e, 0x01, 0x1a, 0x13, 0x08, 0x8d, 0x01, 0x1e, 0x13, 0x05, 0x8c, 0x01,
+  0x22, 0xa1, 0x01, 0x24, 0x9e, 0x01, 0x28, 0x83, 0x01, 0x04, 0x14, 0x2a,
+  0x7b, 0x13, 0x0b, 0x2c, 0x77, 0x19, 0x07, 0x2e, 0x73, 0x1f, 0x03, 0x31,
+  0x6f, 0x39, 0x06, 0x16, 0x6d, 0x37, 0x0e, 0x13, 0x6a, 0x36, 0x14, 0x11,
+  0x68, 0x36, 0x17, 0x10, 0x66, 0x35, 0x1a, 0x0f, 0x64, 0x36, 0x1d, 0x0e,
+  0x62, 0x35, 0x20, 0x0e, 0x60, 0x36, 0x21, 0x0d, 0x5f, 0x15, 0x0f, 0x14,
+  0x21, 0x0d, 0x5d, 0x13, 0x15, 0x12, 0x20, 0x0d, 0x5c, 0x12, 0x19, 0x11,
+  0x20, 0x0d, 0x5b, 0x10, 0x1d, 0x10, 0x20, 0x0c, 0x5a, 0x10, 0x1f, 0x10,
+  0x1f, 0x0c, 0x59, 0x0f, 0x23, 0x0e, 0x20, 0x0c, 0x57, 0x0f, 0x25, 0x0e,
+  0x1f, 0x0c, 0x57, 0x0e, 0x27, 0x0e, 0x1f, 0x0b, 0x56, 0x0e, 0x29, 0x0d,
+  0x1f, 0x0c, 0x55, 0x0d, 0x2b, 0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2d, 0x0c,
+  0x1f, 0x0b, 0x0f, 0x11, 0x34, 0x0d, 0x2d, 0x0d, 0x1e, 0x0b, 0x0d, 0x15,
+  0x31, 0x0d, 0x2f, 0x0c, 0x1e, 0x0b, 0x0c, 0x17, 0x30, 0x0c, 0x31, 0x0c,
+  0x1d, 0x0b, 0x0c, 0x17, 0x30, 0x0c, 0x31, 0x0c, 0x1d, 0x0b, 0x0c, 0x18,
+  0x2e, 0x0c, 0x33, 0x0b, 0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x33, 0x0c,
+  0x1c, 0x0b, 0x0c, 0x18, 0x2e, 0x0b, 0x35, 0x0b, 0x1c, 0x0b, 0x0c, 0x17,
+  0x2f, 0x0b, 0x35, 0x12, 0x15, 0x0b, 0x0c, 0x17, 0x2c, 0x0e, 0x35, 0x17,
+  0x10, 0x0b, 0x0d, 0x15, 0x2a, 0x11, 0x35, 0x19, 0x0e, 0x0b, 0x0e, 0x13,
+  0x29, 0x12, 0x37, 0x1b, 0x0a, 0x0c, 0x49, 0x13, 0x37, 0x1c, 0x09, 0x0c,
+  0x47, 0x15, 0x37, 0x1e, 0x07, 0x0b, 0x47, 0x16, 0x37, 0x1f, 0x05, 0x0c,
+  0x45, 0x18, 0x37, 0x21, 0x03, 0x0c, 0x44, 0x19, 0x37, 0x22, 0x01, 0x0d,
+  0x43, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x17, 0x07, 0x1b, 0x2e, 0x42, 0x16,
+  0x19, 0x0d, 0x26, 0x1f, 0x42, 0x12, 0x1c, 0x11, 0x29, 0x1a, 0x42, 0x10,
+  0x1c, 0x15, 0x29, 0x17, 0x42, 0x0f, 0x1d, 0x17, 0x2a, 0x15, 0x41, 0x0f,
+  0x1d, 0x19, 0x2a, 0x13, 0x42, 0x0e, 0x1e, 0x1a, 0x2a, 0x12, 0x41, 0x0e,
+  0x1e, 0x1c, 0x2a, 0x10, 0x42, 0x0d, 0x1f, 0x1d, 0x2a, 0x0e, 0x42, 0x0d,
+  0x20, 0x1d, 0x2b, 0x0d, 0x42, 0x0c, 0x21, 0x1e, 0x2b, 0x0c, 0x42, 0x0c,
+  0x21, 0x0c, 0x04, 0x0e, 0x2c, 0x0c, 0x40, 0x0c, 0x23, 0x09, 0x08, 0x0c,
+  0x2c, 0x0c, 0x40, 0x0c, 0x24, 0x07, 0x0a, 0x0c, 0x2c, 0x0b, 0x40, 0x0b,
+  0x28, 0x01, 0x0d, 0x0c, 0x2c, 0x0c, 0x81, 0x01, 0x0b, 0x2d, 0x0b, 0x81,
+  0x01, 0x0b, 0x2d, 0x0b, 0x81, 0x01, 0x0b, 0x2d, 0x0b, 0x81, 0x01, 0x0b,
+  0x2d, 0x0b, 0x81, 0x01, 0x0b, 0x2d, 0x0c, 0x7f, 0x0c, 0x2e, 0x0b, 0x7f,
+  0x0c, 0x2e, 0x0b, 0x7e, 0x0c, 0x2f, 0x0b, 0x7c, 0x0e, 0x2f, 0x0b, 0x0a,
+  0x03, 0x23, 0x5a, 0x2e, 0x0c, 0x08, 0x07, 0x1f, 0x5b, 0x2f, 0x0b, 0x08,
+  0x09, 0x1d, 0x5c, 0x2f, 0x0b, 0x07, 0x0b, 0x1c, 0x5b, 0x30, 0x0b, 0x07,
+  0x0c, 0x1a, 0x5b, 0x31, 0x0b, 0x07, 0x0d, 0x19, 0x5a, 0x31, 0x0c, 0x07,
+  0x0e, 0x18, 0x59, 0x32, 0x0c, 0x07, 0x0e, 0x19, 0x57, 0x33, 0x0b, 0x08,
+  0x0f, 0x18, 0x56, 0x33, 0x0c, 0x09, 0x0e, 0x19, 0x53, 0x34, 0x0d, 0x0a,
+  0x0d, 0x1b, 0x4e, 0x37, 0x0c, 0x0c, 0x0c, 0x9f, 0x01, 0x0d, 0x0d, 0x0a,
+  0x9f, 0x01, 0x0d, 0x0f, 0x09, 0x9e, 0x01, 0x0e, 0x10, 0x07, 0x9e, 0x01,
+  0x0e, 0x14, 0x01, 0xa0, 0x01, 0x0f, 0xb3, 0x01, 0x10, 0xb2, 0x01, 0x11,
+  0xb1, 0x01, 0x13, 0x7d, 0x46, 0x37, 0x2f, 0x17, 0x46, 0x37, 0x32, 0x15,
+  0x45, 0x37, 0x35, 0x13, 0x44, 0x38, 0x36, 0x12, 0x43, 0x38, 0x38, 0x11,
+  0x41, 0x3a, 0x39, 0x10, 0x40, 0x3b, 0x3a, 0x0f, 0x3e, 0x3e, 0x3a, 0x0e,
+  0x3c, 0x40, 0x3b, 0x0d, 0x3a, 0x43, 0x3a, 0x0d, 0x37, 0x48, 0x39, 0x0d,
+  0x30, 0x79, 0x0e, 0xb8, 0x01, 0x0c, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0c,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0xb8, 0x01, 0x0c, 0xa8, 0x01, 0x04, 0x0c, 0x0c, 0xa6, 0x01, 0x08, 0x09,
+  0x0c, 0xa6, 0x01, 0x0a, 0x07, 0x0d, 0xa6, 0x01, 0x1e, 0xa6, 0x01, 0x1d,
+  0xa7, 0x01, 0x1d, 0xa7, 0x01, 0x1c, 0xa8, 0x01, 0x1b, 0xa9, 0x01, 0x1b,
+  0xaa, 0x01, 0x19, 0xac, 0x01, 0x17, 0xaf, 0x01, 0x13, 0xb2, 0x01, 0x11,
+  0xb5, 0x01, 0x0d, 0xbc, 0x01, 0x03, 0xc8, 0x2d, 0x34, 0x01, 0x1e, 0x02,
+  0x1e, 0x02, 0x17, 0x02, 0x06, 0x01, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02,
+  0x1d, 0x02, 0x17, 0x05, 0x14, 0x0d, 0x11, 0x09, 0x05, 0x02, 0x0f, 0x03,
+  0x05, 0x02, 0x06, 0x02, 0x0e, 0x02, 0x07, 0x02, 0x05, 0x02, 0x03, 0x02,
+  0x08, 0x02, 0x09, 0x02, 0x04, 0x02, 0x02, 0x04, 0x06, 0x03, 0x09, 0x05,
+  0x01, 0x02, 0x0a, 0x04, 0x0a, 0x07, 0x0b, 0x02, 0x10, 0x03, 0x0b, 0x01,
+  0x12, 0x02, 0x2b, 0x14, 0x02, 0x02, 0x07, 0x16, 0x01, 0x02, 0x1f, 0x01,
+  0x24, 0x16, 0x4f, 0x16, 0x0b, 0x14, 0xa6, 0x01, 0xa7, 0x01, 0x03, 0x3d,
+  0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x2f, 0x02, 0x0c,
+  0x03, 0x0c, 0x03, 0x1f, 0x04, 0x0c, 0x02, 0x0b, 0x04, 0x1f, 0x05, 0x17,
+  0x05, 0x20, 0x04, 0x16, 0x05, 0x22, 0x02, 0x17, 0x04, 0x3c, 0x03, 0x2e,
+  0x09, 0x06, 0x02, 0x2d, 0x0d, 0x27, 0x09, 0x02, 0x0f, 0x24, 0x12, 0x05,
+  0x06, 0x22, 0x11, 0x09, 0x05, 0x20, 0x08, 0x02, 0x08, 0x0a, 0x04, 0x1f,
+  0x05, 0x09, 0x05, 0x0b, 0x04, 0x1d, 0x05, 0x0b, 0x05, 0x0a, 0x04, 0x1c,
+  0x05, 0x0d, 0x05, 0x0a, 0x03, 0x1c, 0x04, 0x0f, 0x04, 0x0a, 0x04, 0x04,
+  0x07, 0x10, 0x03, 0x11, 0x04, 0x09, 0x04, 0x03, 0x08, 0x0f, 0x04, 0x11,
+  0x05, 0x08, 0x04, 0x04, 0x07, 0x0d, 0x06, 0x11, 0x09, 0x04, 0x04, 0x16,
+  0x08, 0x12, 0x0a, 0x02, 0x03, 0x16, 0x08, 0x13, 0x0f, 0x15, 0x06, 0x1c,
+  0x09, 0x15, 0x04, 0x20, 0x06, 0x15, 0x04, 0x22, 0x04, 0x16, 0x04, 0x23,
+  0x04, 0xd6, 0x01, 0x28, 0x05, 0x02, 0x0f, 0x2c, 0x02, 0x04, 0x0e, 0x2c,
+  0x02, 0x05, 0x0e, 0x2a, 0x04, 0x04, 0x3d, 0x03, 0x88, 0x01, 0x2b, 0x15,
+  0x2b, 0x15, 0x2b, 0x16, 0x29, 0xdf, 0x01, 0x2b, 0x15, 0x2c, 0x14, 0x2b,
+  0xcb, 0x05, 0x92, 0x0a, 0x05, 0xbd, 0x01, 0x08, 0xbc, 0x01, 0x09, 0xba,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0x8e,
+  0x01, 0x06, 0x25, 0x0b, 0x25, 0x06, 0x62, 0x08, 0x24, 0x0b, 0x24, 0x08,
+  0x60, 0x0a, 0x23, 0x0a, 0x24, 0x09, 0x60, 0x0b, 0x23, 0x09, 0x23, 0x0b,
+  0x5f, 0x0c, 0x23, 0x06, 0x24, 0x0c, 0x5f, 0x0d, 0x4b, 0x0d, 0x5f, 0x0e,
+  0x49, 0x0e, 0x5f, 0x0e, 0x48, 0x0f, 0x5f, 0x0f, 0x46, 0x0f, 0x61, 0x0e,
+  0x45, 0x0f, 0x63, 0x0d, 0x44, 0x0f, 0x65, 0x0b, 0x44, 0x0f, 0x67, 0x0a,
+  0x43, 0x0f, 0x69, 0x08, 0x44, 0x0e, 0x6c, 0x05, 0x45, 0x0d, 0xb7, 0x01,
+  0x0c, 0xb8, 0x01, 0x0b, 0x92, 0x01, 0x11, 0x16, 0x0a, 0x8f, 0x01, 0x18,
+  0x14, 0x08, 0x8e, 0x01, 0x1c, 0x13, 0x06, 0x8d, 0x01, 0x20, 0xa2, 0x01,
+  0x24, 0x9f, 0x01, 0x27, 0x82, 0x01, 0x06, 0x13, 0x2a, 0x7b, 0x13, 0x0b,
+  0x2c, 0x77, 0x19, 0x07, 0x2e, 0x73, 0x1f, 0x03, 0x30, 0x70, 0x3b, 0x02,
+  0x18, 0x6d, 0x37, 0x0e, 0x13, 0x6b, 0x36, 0x13, 0x11, 0x68, 0x36, 0x17,
+  0x10, 0x66, 0x35, 0x1a, 0x10, 0x64, 0x35, 0x1d, 0x0e, 0x62, 0x36, 0x1f,
+  0x0e, 0x60, 0x1b, 0x02, 0x1a, 0x20, 0x0d, 0x5f, 0x15, 0x0f, 0x15, 0x20,
+  0x0d, 0x5d, 0x13, 0x15, 0x13, 0x20, 0x0c, 0x5d, 0x11, 0x19, 0x12, 0x1f,
+  0x0d, 0x5b, 0x10, 0x1d, 0x10, 0x20, 0x0c, 0x5a, 0x10, 0x20, 0x0f, 0x20,
+  0x0b, 0x59, 0x0f, 0x23, 0x0f, 0x1f, 0x0c, 0x58, 0x0e, 0x25, 0x0e, 0x20,
+  0x0b, 0x57, 0x0e, 0x27, 0x0e, 0x1f, 0x0b, 0x56, 0x0e, 0x29, 0x0e, 0x1e,
+  0x0c, 0x55, 0x0d, 0x2b, 0x0d, 0x1f, 0x0b, 0x54, 0x0d, 0x2d, 0x0d, 0x1e,
+  0x0b, 0x0f, 0x12, 0x33, 0x0d, 0x2e, 0x0c, 0x1e, 0x0b, 0x0e, 0x14, 0x32,
+  0x0c, 0x2f, 0x0d, 0x1d, 0x0b, 0x0d, 0x16, 0x30, 0x0c, 0x31, 0x0c, 0x1d,
+  0x0b, 0x0c, 0x18, 0x2f, 0x0c, 0x31, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2e,
+  0x0c, 0x33, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x33, 0x0c, 0x1c,
+  0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x34, 0x0b, 0x1c, 0x0b, 0x0c, 0x18, 0x2e,
+  0x0b, 0x35, 0x13, 0x14, 0x0b, 0x0c, 0x17, 0x2d, 0x0d, 0x35, 0x17, 0x10,
+  0x0b, 0x0d, 0x15, 0x2b, 0x10, 0x36, 0x19, 0x0d, 0x0b, 0x0f, 0x12, 0x2a,
+  0x11, 0x37, 0x1b, 0x0b, 0x0b, 0x49, 0x13, 0x37, 0x1d, 0x08, 0x0c, 0x47,
+  0x15, 0x37, 0x1f, 0x06, 0x0b, 0x47, 0x16, 0x37, 0x20, 0x05, 0x0b, 0x45,
+  0x18, 0x37, 0x21, 0x03, 0x0c, 0x44, 0x19, 0x38, 0x21, 0x02, 0x0c, 0x43,
+  0x1a, 0x38, 0x2e, 0x43, 0x1a, 0x39, 0x2e, 0x42, 0x15, 0x4f, 0x1e, 0x42,
+  0x11, 0x56, 0x1a, 0x42, 0x10, 0x5a, 0x18, 0x41, 0x0f, 0x5e, 0x15, 0x42,
+  0x0e, 0x61, 0x12, 0x42, 0x0e, 0x63, 0x11, 0x41, 0x0e, 0x65, 0x0f, 0x42,
+  0x0d, 0x67, 0x0d, 0x42, 0x0d, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x42,
+  0x0c, 0x6b, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6d, 0x0b, 0xb4,
+  0x0f, 0x03, 0x33, 0x80, 0x01, 0x0c, 0x07, 0x30, 0x82, 0x01, 0x0a, 0x09,
+  0x2e, 0x84, 0x01, 0x08, 0x0b, 0x2c, 0x85, 0x01, 0x08, 0x0c, 0x2b, 0x85,
+  0x01, 0x08, 0x0d, 0x2a, 0x85, 0x01, 0x08, 0x0e, 0x29, 0x85, 0x01, 0x08,
+  0x0f, 0x29, 0x84, 0x01, 0x09, 0x0e, 0x2a, 0x82, 0x01, 0x0a, 0x0e, 0x2b,
+  0x80, 0x01, 0x0c, 0x0d, 0x2d, 0x7c, 0x0f, 0x0c, 0xb9, 0x01, 0x0b, 0xba,
+  0x01, 0x09, 0xbc, 0x01, 0x07, 0xc0, 0x01, 0x01, 0xf3, 0x07, 0x7f, 0x44,
+  0x82, 0x01, 0x41, 0x84, 0x01, 0x40, 0x84, 0x01, 0x3f, 0x86, 0x01, 0x3e,
+  0x86, 0x01, 0x3e, 0x86, 0x01, 0x3e, 0x85, 0x01, 0x40, 0x84, 0x01, 0x41,
+  0x82, 0x01, 0x43, 0x7f, 0xc7, 0x0e, 0x7d, 0x45, 0x81, 0x01, 0x42, 0x83,
+  0x01, 0x40, 0x85, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85,
+  0x01, 0x3f, 0x85, 0x01, 0x40, 0x83, 0x01, 0x41, 0x83, 0x01, 0x43, 0x7f,
+  0xe7, 0x32, 0xcf, 0x01, 0x02, 0x1e, 0x02, 0x17, 0x01, 0x06, 0x02, 0x06,
+  0x01, 0x10, 0x02, 0x0c, 0x02, 0x11, 0x02, 0x0a, 0x02, 0x13, 0x01, 0x0a,
+  0x01, 0x17, 0x06, 0x19, 0x03, 0x02, 0x03, 0x17, 0x02, 0x06, 0x02, 0x16,
+  0x02, 0x06, 0x02, 0x10, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x0b,
+  0x02, 0x10, 0x03, 0x0e, 0x06, 0x02, 0x01, 0x02, 0x03, 0x11, 0x08, 0x01,
+  0x01, 0x01, 0x05, 0x34, 0x04, 0x03, 0x02, 0x14, 0x02, 0x01, 0x05, 0x01,
+  0x04, 0xaa, 0x02, 0xdf, 0x05, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04,
+  0x3c, 0x04, 0x3c, 0x04, 0x2e, 0x03, 0x0b, 0x04, 0x0b, 0x03, 0x1f, 0x05,
+  0x18, 0x04, 0x20, 0x05, 0x16, 0x05, 0x21, 0x05, 0x14, 0x05, 0x23, 0x04,
+  0x14, 0x04, 0x25, 0x03, 0x14, 0x03, 0x30, 0x06, 0x38, 0x0a, 0x34, 0x0e,
+  0x31, 0x10, 0x2f, 0x06, 0x06, 0x06, 0x2d, 0x05, 0x0a, 0x05, 0x2c, 0x04,
+  0x0c, 0x04, 0x2b, 0x05, 0x0d, 0x04, 0x20, 0x04, 0x06, 0x04, 0x0e, 0x04,
+  0x06, 0x04, 0x15, 0x07, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x07, 0x13, 0x08,
+  0x04, 0x04, 0x0f, 0x03, 0x04, 0x08, 0x13, 0x07, 0x1e, 0x07, 0x9a, 0x01,
+  0x0f, 0x03, 0x02, 0x03, 0x09, 0x20, 0x10, 0x01, 0x04, 0x01, 0x0a, 0x20,
+  0x0f, 0x02, 0x03, 0x03, 0x09, 0xe3, 0x01, 0x02, 0x03, 0x0a, 0x03, 0x07,
+  0x26, 0x04, 0x01, 0x0c, 0x01, 0x08, 0x26, 0x03, 0x02, 0x0c, 0x02, 0x07,
+  0x27, 0x01, 0x04, 0x0a, 0x04, 0x05, 0xd5, 0x08, 0xa3, 0x33, 0x06, 0xbd,
+  0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0x8f, 0x01, 0x03, 0x26, 0x0c, 0x26, 0x03, 0x64, 0x07, 0x24,
+  0x0b, 0x25, 0x06, 0x62, 0x09, 0x24, 0x0a, 0x24, 0x08, 0x61, 0x0a, 0x23,
+  0x0a, 0x23, 0x0a, 0x5f, 0x0c, 0x23, 0x08, 0x23, 0x0b, 0x5f, 0x0d, 0x24,
+  0x04, 0x24, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0f, 0x48, 0x0e, 0x60,
+  0x0f, 0x46, 0x0f, 0x60, 0x10, 0x44, 0x0f, 0x62, 0x10, 0x42, 0x0f, 0x64,
+  0x10, 0x40, 0x0f, 0x66, 0x10, 0x3e, 0x0f, 0x68, 0x0f, 0x3e, 0x0e, 0x6b,
+  0x0e, 0x3d, 0x0d, 0x6d, 0x0d, 0x3c, 0x0d, 0x6f, 0x0c, 0x3d, 0x0b, 0x71,
+  0x0a, 0x3e, 0x0a, 0x73, 0x09, 0x3e, 0x09, 0x75, 0x07, 0x40, 0x07, 0x77,
+  0x04, 0x1a, 0x10, 0x1a, 0x03, 0x94, 0x01, 0x16, 0xab, 0x01, 0x1c, 0xa6,
+  0x01, 0x20, 0xa2, 0x01, 0x24, 0x9f, 0x01, 0x26, 0x9c, 0x01, 0x2a, 0x99,
+  0x01, 0x2c, 0x97, 0x01, 0x2e, 0x95, 0x01, 0x30, 0x93, 0x01, 0x32, 0x91,
+  0x01, 0x15, 0x0a, 0x15, 0x8f, 0x01, 0x13, 0x11, 0x12, 0x8e, 0x01, 0x10,
+  0x16, 0x11, 0x8c, 0x01, 0x10, 0x19, 0x0f, 0x8b, 0x01, 0x0f, 0x1c, 0x0f,
+  0x89, 0x01, 0x0f, 0x1e, 0x0f, 0x88, 0x01, 0x0e, 0x20, 0x0e, 0x87, 0x01,
+  0x0e, 0x22, 0x0e, 0x86, 0x01, 0x0d, 0x24, 0x0d, 0x85, 0x01, 0x0d, 0x26,
+  0x0d, 0x84, 0x01, 0x0d, 0x27, 0x0c, 0x84, 0x01, 0x0c, 0x28, 0x0c, 0x83,
+  0x01, 0x0d, 0x29, 0x0c, 0x82, 0x01, 0x0c, 0x2a, 0x0c, 0x62, 0x0f, 0x11,
+  0x0c, 0x2b, 0x0b, 0x11, 0x0e, 0x41, 0x14, 0x0e, 0x0b, 0x2c, 0x0b, 0x0e,
+  0x14, 0x3d, 0x16, 0x0c, 0x0c, 0x2c, 0x0c, 0x0c, 0x16, 0x3b, 0x17, 0x0c,
+  0x0c, 0x2d, 0x0b, 0x0c, 0x17, 0x3a, 0x18, 0x0b, 0x0c, 0x2d, 0x0b, 0x0b,
+  0x18, 0x3a, 0x18, 0x0b, 0x0b, 0x2e, 0x0b, 0x0b, 0x18, 0x3a, 0x18, 0x0b,
+  0x0b, 0x2e, 0x0b, 0x0b, 0x18, 0x3a, 0x18, 0x0b, 0x0b, 0x2e, 0x0b, 0x0b,
+  0x18, 0x3a, 0x17, 0x0c, 0x0b, 0x2e, 0x0b, 0x0c, 0x17, 0x3b, 0x16, 0x0d,
+  0x08, 0x32, 0x08, 0x0d, 0x16, 0x3d, 0x14, 0x5e, 0x14, 0x40, 0x0f, 0x64,
+  0x0f, 0xa8, 0x08, 0x2c, 0x09, 0x06, 0x0a, 0x1a, 0x63, 0x2f, 0x07, 0x08,
+  0x08, 0x1c, 0x62, 0x2f, 0x06, 0x0a, 0x06, 0x1d, 0x61, 0x31, 0x04, 0x0c,
+  0x04, 0x1f, 0x60, 0x31, 0x04, 0x0c, 0x04, 0x1f, 0x60, 0x31, 0x04, 0x0c,
+  0x04, 0x1f, 0x60, 0x31, 0x05, 0x0a, 0x05, 0x1f, 0x61, 0x2f, 0x06, 0x0a,
+  0x06, 0x1d, 0x62, 0x2f, 0x07, 0x08, 0x07, 0x1d, 0x63, 0x2d, 0x09, 0x06,
+  0x0a, 0x1a, 0x8d, 0x0d, 0x03, 0x0d, 0x1c, 0x0d, 0x0f, 0x7a, 0x07, 0x09,
+  0x1f, 0x0a, 0x13, 0x77, 0x09, 0x07, 0x22, 0x07, 0x15, 0x75, 0x0b, 0x05,
+  0x23, 0x06, 0x16, 0x75, 0x0b, 0x05, 0x24, 0x05, 0x17, 0x74, 0x0b, 0x05,
+  0x24, 0x04, 0x18, 0x74, 0x0b, 0x05, 0x24, 0x04, 0x18, 0x74, 0x0b, 0x05,
+  0x24, 0x04, 0x18, 0x74, 0x0b, 0x05, 0x23, 0x06, 0x16, 0x76, 0x09, 0x06,
+  0x23, 0x06, 0x16, 0x77, 0x07, 0x08, 0x21, 0x08, 0x14, 0x7a, 0x03, 0x0c,
+  0x1d, 0x0c, 0x10, 0xd5, 0x51, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x17,
+  0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d, 0x02, 0x16,
+  0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05, 0x03, 0x05,
+  0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x03, 0x08, 0x02, 0x08,
+  0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x03, 0x09, 0x05, 0x02, 0x01, 0x0b,
+  0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x12, 0x02, 0x0a,
+  0x02, 0x12, 0x02, 0x0a, 0x02, 0x05, 0x02, 0x02, 0x01, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x01, 0x08, 0x02, 0x05, 0x02, 0x02, 0x01, 0x02, 0x02, 0x04,
+  0x02, 0x01, 0x02, 0x07, 0x03, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x01, 0x08, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x0e, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x03, 0x13,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x16,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0x1b, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x74,
+  0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c,
+  0x04, 0x1e, 0x05, 0x18, 0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16,
+  0x05, 0x3b, 0x04, 0x2d, 0x0a, 0x06, 0x01, 0x2e, 0x0c, 0x28, 0x08, 0x02,
+  0x10, 0x23, 0x13, 0x04, 0x06, 0x22, 0x12, 0x08, 0x05, 0x20, 0x07, 0x03,
+  0x08, 0x0a, 0x05, 0x1e, 0x06, 0x08, 0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c,
+  0x04, 0x0b, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b, 0x04, 0x0f,
+  0x05, 0x09, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10, 0x04, 0x09, 0x04, 0x04,
+  0x08, 0x0e, 0x04, 0x11, 0x04, 0x09, 0x04, 0x04, 0x08, 0x0c, 0x06, 0x12,
+  0x08, 0x04, 0x04, 0x06, 0x04, 0x0d, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x15,
+  0x09, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x15,
+  0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x03, 0x24, 0x04, 0x14,
+  0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x0c, 0x02, 0x06,
+  0x01, 0x06, 0x01, 0x09, 0x03, 0x04, 0x01, 0x0f, 0x04, 0x0b, 0x04, 0x04,
+  0x03, 0x04, 0x03, 0x08, 0x03, 0x03, 0x03, 0x0f, 0x03, 0x0b, 0x04, 0x03,
+  0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x0e, 0x04, 0x0a, 0x03, 0x04,
+  0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x0d, 0x05, 0x08, 0x04, 0x04,
+  0x03, 0x04, 0x04, 0x06, 0x05, 0x04, 0x03, 0x0f, 0x05, 0x07, 0x04, 0x03,
+  0x04, 0x04, 0x03, 0x06, 0x05, 0x17, 0x06, 0x06, 0x04, 0x03, 0x04, 0x03,
+  0x04, 0x05, 0x05, 0x19, 0x08, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x02,
+  0x07, 0x1c, 0x06, 0x02, 0x04, 0x04, 0x03, 0x04, 0x03, 0x03, 0x06, 0x1e,
+  0x05, 0x02, 0x04, 0x03, 0x04, 0x04, 0x03, 0x03, 0x05, 0x22, 0x01, 0x03,
+  0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x2a, 0x03, 0x04, 0x04, 0x03,
+  0x04, 0x2d, 0x04, 0x04, 0x03, 0x04, 0x03, 0x2e, 0x04, 0x03, 0x04, 0x03,
+  0x04, 0x2e, 0x04, 0x03, 0x04, 0x03, 0x04, 0x2e, 0x03, 0x04, 0x03, 0x04,
+  0x04, 0x35, 0x03, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x03, 0x3c, 0x04, 0x3c,
+  0x04, 0x3d, 0x02, 0xe9, 0x02, 0x89, 0x0a, 0x06, 0xbd, 0x01, 0x08, 0xbb,
+  0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0x90,
+  0x01, 0x02, 0x27, 0x0b, 0x27, 0x01, 0x65, 0x07, 0x25, 0x0b, 0x24, 0x07,
+  0x61, 0x09, 0x24, 0x0a, 0x24, 0x09, 0x60, 0x0a, 0x23, 0x0a, 0x23, 0x0b,
+  0x5e, 0x0c, 0x23, 0x08, 0x23, 0x0c, 0x5e, 0x0d, 0x24, 0x05, 0x23, 0x0d,
+  0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0f, 0x48, 0x0f, 0x5e, 0x0f, 0x47, 0x10,
+  0x5f, 0x0e, 0x46, 0x10, 0x61, 0x0d, 0x45, 0x10, 0x63, 0x0c, 0x44, 0x10,
+  0x65, 0x0b, 0x44, 0x0f, 0x67, 0x09, 0x44, 0x0f, 0x69, 0x07, 0x45, 0x0e,
+  0x6c, 0x04, 0x46, 0x0d, 0xb7, 0x01, 0x0c, 0x95, 0x01, 0x08, 0x1b, 0x0b,
+  0x91, 0x01, 0x12, 0x17, 0x09, 0x8f, 0x01, 0x18, 0x15, 0x07, 0x8d, 0x01,
+  0x1e, 0x13, 0x05, 0x8d, 0x01, 0x21, 0xa1, 0x01, 0x24, 0x9e, 0x01, 0x28,
+  0x82, 0x01, 0x06, 0x13, 0x2a, 0x7a, 0x14, 0x0b, 0x2c, 0x76, 0x1a, 0x07,
+  0x2e, 0x73, 0x1e, 0x04, 0x31, 0x6e, 0x3c, 0x02, 0x18, 0x6d, 0x37, 0x0e,
+  0x13, 0x6a, 0x37, 0x13, 0x11, 0x68, 0x36, 0x17, 0x10, 0x65, 0x36, 0x1a,
+  0x10, 0x63, 0x36, 0x1d, 0x0e, 0x62, 0x36, 0x1f, 0x0e, 0x60, 0x18, 0x06,
+  0x18, 0x21, 0x0d, 0x5f, 0x14, 0x10, 0x14, 0x21, 0x0d, 0x5d, 0x12, 0x16,
+  0x12, 0x20, 0x0d, 0x5c, 0x11, 0x1a, 0x11, 0x20, 0x0d, 0x5a, 0x10, 0x1e,
+  0x10, 0x20, 0x0c, 0x59, 0x10, 0x20, 0x10, 0x1f, 0x0d, 0x58, 0x0f, 0x23,
+  0x0e, 0x20, 0x0c, 0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c, 0x56, 0x0e, 0x28,
+  0x0e, 0x1f, 0x0b, 0x56, 0x0d, 0x2a, 0x0d, 0x1f, 0x0c, 0x54, 0x0e, 0x2b,
+  0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2d, 0x0c, 0x1f, 0x0b, 0x0f, 0x12, 0x32,
+  0x0d, 0x2e, 0x0d, 0x1e, 0x0b, 0x0d, 0x15, 0x31, 0x0c, 0x30, 0x0c, 0x1e,
+  0x0b, 0x0d, 0x16, 0x2f, 0x0d, 0x30, 0x0c, 0x1e, 0x0b, 0x0c, 0x18, 0x2e,
+  0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x33, 0x0b, 0x1d,
+  0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x34, 0x0b, 0x1d, 0x0b, 0x0c, 0x18, 0x2d,
+  0x0c, 0x34, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x35, 0x10, 0x17,
+  0x0b, 0x0c, 0x17, 0x2c, 0x0d, 0x36, 0x16, 0x11, 0x0b, 0x0d, 0x16, 0x29,
+  0x10, 0x36, 0x19, 0x0e, 0x0b, 0x0f, 0x12, 0x29, 0x12, 0x36, 0x1b, 0x0b,
+  0x0c, 0x48, 0x14, 0x37, 0x1c, 0x09, 0x0c, 0x46, 0x16, 0x37, 0x1e, 0x07,
+  0x0c, 0x45, 0x17, 0x37, 0x1f, 0x05, 0x0c, 0x45, 0x17, 0x38, 0x20, 0x04,
+  0x0c, 0x43, 0x19, 0x38, 0x21, 0x02, 0x0d, 0x42, 0x1a, 0x38, 0x2f, 0x42,
+  0x1b, 0x39, 0x2e, 0x42, 0x15, 0x4d, 0x20, 0x41, 0x12, 0x55, 0x1b, 0x41,
+  0x11, 0x5a, 0x18, 0x40, 0x10, 0x5d, 0x16, 0x41, 0x0f, 0x60, 0x13, 0x41,
+  0x0e, 0x63, 0x12, 0x40, 0x0e, 0x65, 0x10, 0x41, 0x0d, 0x67, 0x0e, 0x42,
+  0x0d, 0x68, 0x0d, 0x41, 0x0d, 0x6a, 0x0c, 0x41, 0x0c, 0x6b, 0x0d, 0x3f,
+  0x0d, 0x6c, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e,
+  0x0b, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x26, 0x04, 0x13,
+  0x03, 0x12, 0x04, 0x1b, 0x0c, 0x3c, 0x0b, 0x24, 0x08, 0x0f, 0x07, 0x0e,
+  0x08, 0x19, 0x0b, 0x09, 0x07, 0x2d, 0x0b, 0x24, 0x09, 0x0d, 0x09, 0x0d,
+  0x09, 0x18, 0x0b, 0x08, 0x09, 0x2c, 0x0b, 0x23, 0x0a, 0x0c, 0x0a, 0x0c,
+  0x0a, 0x18, 0x0b, 0x08, 0x0a, 0x2b, 0x0c, 0x22, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x17, 0x0b, 0x07, 0x0c, 0x2a, 0x0c, 0x21, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x17, 0x0b, 0x07, 0x0d, 0x2a, 0x0b, 0x21, 0x0c, 0x0a, 0x0c, 0x0a,
+  0x0c, 0x16, 0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x20, 0x0b, 0x0b, 0x0c, 0x0a,
+  0x0b, 0x17, 0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x20, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x16, 0x0c, 0x09, 0x0e, 0x28, 0x0d, 0x1e, 0x0c, 0x0b, 0x0b, 0x0a,
+  0x0c, 0x16, 0x0c, 0x09, 0x0e, 0x29, 0x0c, 0x1e, 0x0c, 0x0a, 0x0c, 0x0a,
+  0x0c, 0x15, 0x0d, 0x0a, 0x0d, 0x29, 0x0d, 0x1d, 0x0b, 0x0b, 0x0c, 0x0a,
+  0x0b, 0x16, 0x0c, 0x0c, 0x0c, 0x2a, 0x0d, 0x1b, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x15, 0x0d, 0x0d, 0x0b, 0x2a, 0x0d, 0x1b, 0x0c, 0x0b, 0x0b, 0x0a,
+  0x0c, 0x14, 0x0d, 0x0f, 0x09, 0x2c, 0x0d, 0x1a, 0x0c, 0x0a, 0x0c, 0x0a,
+  0x0b, 0x14, 0x0e, 0x10, 0x07, 0x2d, 0x0e, 0x19, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x13, 0x0e, 0x14, 0x02, 0x30, 0x0f, 0x16, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x12, 0x0f, 0x46, 0x10, 0x15, 0x0c, 0x0b, 0x0b, 0x0a, 0x0c, 0x11,
+  0x0f, 0x48, 0x11, 0x13, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x10, 0x10, 0x4a,
+  0x12, 0x11, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x12, 0x4b, 0x14, 0x0d,
+  0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x15, 0x4d, 0x17, 0x09, 0x0c, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x06, 0x18, 0x4f, 0x16, 0x09, 0x0b, 0x0b, 0x0c, 0x0a,
+  0x0b, 0x07, 0x17, 0x51, 0x15, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x07,
+  0x16, 0x53, 0x14, 0x08, 0x0c, 0x0b, 0x0b, 0x0a, 0x0c, 0x07, 0x15, 0x55,
+  0x13, 0x08, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x08, 0x13, 0x59, 0x11, 0x08,
+  0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x08, 0x12, 0x5b, 0x10, 0x07, 0x0c, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x08, 0x10, 0x5f, 0x0e, 0x07, 0x0c, 0x0b, 0x0b, 0x0a,
+  0x0c, 0x08, 0x0f, 0x62, 0x0c, 0x07, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x09,
+  0x0c, 0x68, 0x09, 0x07, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0a, 0x6f,
+  0x04, 0x06, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x04, 0x7e, 0x0c, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x8d, 0x01,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0c,
+  0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c,
+  0x0b, 0x0b, 0x0a, 0x0c, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x8d,
+  0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b, 0x0a, 0x0c, 0x8c, 0x01, 0x0b, 0x0b,
+  0x0c, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0b, 0x0c, 0x0a, 0x8e, 0x01,
+  0x0a, 0x0b, 0x0b, 0x0c, 0x0a, 0x8e, 0x01, 0x09, 0x0b, 0x0c, 0x0c, 0x09,
+  0x90, 0x01, 0x08, 0x0b, 0x0c, 0x0d, 0x07, 0x93, 0x01, 0x04, 0x0d, 0x0b,
+  0x11, 0x02, 0xa6, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x09, 0xbc, 0x01, 0x07, 0xbf,
+  0x01, 0x04, 0xfa, 0x17, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x17, 0x01,
+  0x06, 0x02, 0x05, 0x02, 0x10, 0x02, 0x0b, 0x03, 0x1d, 0x02, 0x16, 0x06,
+  0x13, 0x05, 0x01, 0x08, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05, 0x03,
+  0x05, 0x02, 0x0e, 0x02, 0x07, 0x03, 0x05, 0x01, 0x03, 0x02, 0x09, 0x02,
+  0x08, 0x02, 0x05, 0x01, 0x02, 0x04, 0x06, 0x03, 0x09, 0x05, 0x01, 0x02,
+  0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x11, 0x02,
+  0x0b, 0x01, 0x13, 0x02, 0x0a, 0x01, 0x06, 0x01, 0x07, 0x01, 0x04, 0x02,
+  0x01, 0x01, 0x08, 0x02, 0x05, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02,
+  0x07, 0x02, 0x05, 0x01, 0x06, 0x02, 0x03, 0x02, 0x03, 0x01, 0x08, 0x03,
+  0x0d, 0x03, 0x0e, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x17, 0x01, 0x1b, 0x01, 0x06, 0x01, 0x17, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x1b, 0x01, 0x3e, 0x02, 0x1e, 0x01, 0x55, 0xa5, 0x01, 0x02, 0x3d, 0x04,
+  0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x2e, 0x02, 0x0c, 0x04,
+  0x0b, 0x03, 0x1f, 0x04, 0x0c, 0x02, 0x0b, 0x04, 0x1f, 0x05, 0x17, 0x05,
+  0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16, 0x05, 0x3b, 0x04, 0x2d, 0x09,
+  0x07, 0x01, 0x2e, 0x0c, 0x28, 0x08, 0x02, 0x0f, 0x24, 0x13, 0x04, 0x06,
+  0x22, 0x12, 0x08, 0x05, 0x20, 0x12, 0x0a, 0x05, 0x1e, 0x06, 0x08, 0x05,
+  0x0b, 0x04, 0x1d, 0x05, 0x0b, 0x05, 0x0b, 0x03, 0x1d, 0x04, 0x0d, 0x05,
+  0x0a, 0x04, 0x1b, 0x04, 0x0f, 0x04, 0x0a, 0x04, 0x04, 0x07, 0x10, 0x04,
+  0x10, 0x04, 0x09, 0x04, 0x04, 0x08, 0x0e, 0x04, 0x11, 0x04, 0x09, 0x04,
+  0x04, 0x07, 0x0d, 0x06, 0x12, 0x08, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x07,
+  0x12, 0x0a, 0x02, 0x04, 0x15, 0x09, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09,
+  0x15, 0x05, 0x1f, 0x06, 0x15, 0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04,
+  0x15, 0x03, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03,
+  0x14, 0x04, 0x0c, 0x01, 0x18, 0x03, 0x14, 0x04, 0x0b, 0x04, 0x0b, 0x03,
+  0x08, 0x03, 0x03, 0x03, 0x0e, 0x04, 0x0b, 0x04, 0x0a, 0x04, 0x07, 0x04,
+  0x03, 0x04, 0x0e, 0x04, 0x0a, 0x03, 0x0b, 0x04, 0x07, 0x04, 0x03, 0x04,
+  0x0e, 0x04, 0x0a, 0x03, 0x0b, 0x03, 0x07, 0x04, 0x05, 0x03, 0x0f, 0x04,
+  0x09, 0x02, 0x0d, 0x02, 0x06, 0x05, 0x17, 0x06, 0x1d, 0x05, 0x19, 0x08,
+  0x03, 0x02, 0x05, 0x03, 0x04, 0x02, 0x04, 0x07, 0x1b, 0x07, 0x02, 0x04,
+  0x03, 0x04, 0x04, 0x03, 0x03, 0x06, 0x1e, 0x05, 0x02, 0x04, 0x03, 0x04,
+  0x04, 0x03, 0x03, 0x05, 0x22, 0x01, 0x04, 0x02, 0x04, 0x04, 0x04, 0x02,
+  0x04, 0x01, 0x31, 0x03, 0x36, 0x02, 0x0c, 0x02, 0x2f, 0x03, 0x0b, 0x04,
+  0x2e, 0x03, 0x04, 0x03, 0x04, 0x04, 0x2e, 0x03, 0x04, 0x03, 0x04, 0x03,
+  0x2f, 0x03, 0x04, 0x03, 0x04, 0x03, 0xb5, 0x01, 0x03, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x03, 0x3e, 0x01, 0xaa, 0x02, 0x89, 0x0a, 0x05, 0xbe, 0x01,
+  0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0x8f, 0x01, 0x05, 0x25, 0x0b, 0x25, 0x06, 0x62,
+  0x08, 0x24, 0x0b, 0x24, 0x08, 0x61, 0x09, 0x24, 0x0a, 0x23, 0x0a, 0x5f,
+  0x0b, 0x24, 0x08, 0x23, 0x0b, 0x5f, 0x0c, 0x24, 0x06, 0x23, 0x0d, 0x5e,
+  0x0d, 0x4b, 0x0e, 0x5e, 0x0e, 0x49, 0x0f, 0x5e, 0x0e, 0x48, 0x0f, 0x60,
+  0x0e, 0x46, 0x10, 0x61, 0x0d, 0x45, 0x10, 0x63, 0x0c, 0x44, 0x10, 0x65,
+  0x0b, 0x43, 0x10, 0x67, 0x09, 0x44, 0x0f, 0x69, 0x07, 0x44, 0x0f, 0x6b,
+  0x05, 0x45, 0x0e, 0xb6, 0x01, 0x0d, 0xb8, 0x01, 0x0b, 0x92, 0x01, 0x10,
+  0x17, 0x0a, 0x8f, 0x01, 0x17, 0x15, 0x08, 0x8e, 0x01, 0x1b, 0x14, 0x06,
+  0x8d, 0x01, 0x20, 0xa2, 0x01, 0x23, 0xa0, 0x01, 0x26, 0x9c, 0x01, 0x29,
+  0x7c, 0x11, 0x0d, 0x2c, 0x76, 0x18, 0x09, 0x2e, 0x73, 0x1d, 0x05, 0x30,
+  0x6f, 0x23, 0x01, 0x32, 0x6d, 0x38, 0x0b, 0x15, 0x6a, 0x37, 0x11, 0x12,
+  0x68, 0x37, 0x16, 0x10, 0x66, 0x36, 0x19, 0x10, 0x64, 0x36, 0x1c, 0x0f,
+  0x62, 0x36, 0x1e, 0x0e, 0x61, 0x36, 0x20, 0x0e, 0x5f, 0x15, 0x0d, 0x16,
+  0x20, 0x0d, 0x5e, 0x13, 0x13, 0x13, 0x21, 0x0d, 0x5c, 0x11, 0x19, 0x11,
+  0x21, 0x0c, 0x5b, 0x11, 0x1b, 0x11, 0x20, 0x0d, 0x59, 0x10, 0x1f, 0x10,
+  0x20, 0x0c, 0x58, 0x10, 0x21, 0x10, 0x1f, 0x0c, 0x58, 0x0e, 0x25, 0x0e,
+  0x20, 0x0c, 0x56, 0x0e, 0x27, 0x0e, 0x1f, 0x0c, 0x56, 0x0d, 0x29, 0x0d,
+  0x20, 0x0b, 0x55, 0x0d, 0x2b, 0x0d, 0x1f, 0x0b, 0x55, 0x0d, 0x2c, 0x0d,
+  0x1e, 0x0b, 0x10, 0x11, 0x33, 0x0d, 0x2d, 0x0d, 0x1f, 0x0b, 0x0d, 0x15,
+  0x31, 0x0c, 0x2f, 0x0c, 0x1f, 0x0b, 0x0c, 0x16, 0x30, 0x0d, 0x30, 0x0c,
+  0x1e, 0x0b, 0x0c, 0x17, 0x2f, 0x0c, 0x31, 0x0c, 0x1e, 0x0b, 0x0b, 0x18,
+  0x2f, 0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0b, 0x19, 0x2d, 0x0c, 0x33, 0x0c,
+  0x1d, 0x0b, 0x0b, 0x18, 0x2e, 0x0c, 0x34, 0x0b, 0x1d, 0x0b, 0x0b, 0x18,
+  0x2e, 0x0b, 0x35, 0x0e, 0x1a, 0x0b, 0x0c, 0x17, 0x2d, 0x0c, 0x35, 0x16,
+  0x12, 0x0b, 0x0d, 0x15, 0x2a, 0x10, 0x36, 0x18, 0x0e, 0x0c, 0x0e, 0x13,
+  0x29, 0x12, 0x36, 0x1a, 0x0c, 0x0c, 0x48, 0x13, 0x37, 0x1c, 0x0a, 0x0b,
+  0x47, 0x15, 0x37, 0x1e, 0x08, 0x0b, 0x46, 0x16, 0x37, 0x1f, 0x06, 0x0c,
+  0x45, 0x17, 0x37, 0x21, 0x04, 0x0c, 0x43, 0x19, 0x37, 0x22, 0x02, 0x0c,
+  0x43, 0x1a, 0x38, 0x22, 0x01, 0x0c, 0x42, 0x1a, 0x39, 0x2f, 0x41, 0x18,
+  0x4a, 0x20, 0x42, 0x12, 0x54, 0x1c, 0x41, 0x11, 0x59, 0x18, 0x41, 0x10,
+  0x5d, 0x16, 0x41, 0x0e, 0x60, 0x14, 0x41, 0x0e, 0x62, 0x13, 0x40, 0x0e,
+  0x64, 0x11, 0x41, 0x0d, 0x66, 0x0f, 0x41, 0x0d, 0x68, 0x0e, 0x41, 0x0d,
+  0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0c,
+  0x6d, 0x0c, 0x3f, 0x0b, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e, 0x0c,
+  0x6f, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0c, 0x3d, 0x0b,
+  0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b,
+  0x71, 0x0b, 0x3d, 0x0b, 0x26, 0x03, 0x48, 0x0b, 0x3d, 0x0b, 0x24, 0x07,
+  0x25, 0x06, 0x1b, 0x0b, 0x09, 0x06, 0x2e, 0x0b, 0x23, 0x09, 0x23, 0x09,
+  0x19, 0x0b, 0x08, 0x08, 0x2d, 0x0b, 0x23, 0x0a, 0x22, 0x09, 0x18, 0x0c,
+  0x07, 0x0a, 0x2c, 0x0b, 0x22, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x08, 0x0b,
+  0x2b, 0x0c, 0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x08, 0x0c, 0x2a, 0x0c,
+  0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x07, 0x0e, 0x2a, 0x0b, 0x21, 0x0b,
+  0x20, 0x0c, 0x16, 0x0c, 0x08, 0x0e, 0x29, 0x0c, 0x1f, 0x0c, 0x20, 0x0b,
+  0x17, 0x0c, 0x08, 0x0e, 0x29, 0x0c, 0x1f, 0x0c, 0x20, 0x0b, 0x17, 0x0b,
+  0x0a, 0x0e, 0x28, 0x0d, 0x1e, 0x0b, 0x20, 0x0c, 0x16, 0x0c, 0x0b, 0x0d,
+  0x29, 0x0c, 0x1e, 0x0b, 0x20, 0x0c, 0x15, 0x0d, 0x0c, 0x0c, 0x29, 0x0d,
+  0x1d, 0x0b, 0x20, 0x0b, 0x16, 0x0c, 0x0e, 0x0a, 0x2b, 0x0d, 0x1c, 0x0a,
+  0x22, 0x0a, 0x15, 0x0d, 0x0f, 0x09, 0x2b, 0x0e, 0x1b, 0x0a, 0x22, 0x0a,
+  0x14, 0x0d, 0x11, 0x07, 0x2d, 0x0e, 0x1b, 0x08, 0x24, 0x08, 0x14, 0x0e,
+  0x13, 0x03, 0x2f, 0x0f, 0x1c, 0x05, 0x26, 0x06, 0x14, 0x0e, 0x47, 0x0f,
+  0x5e, 0x10, 0x48, 0x10, 0x5b, 0x10, 0x49, 0x12, 0x57, 0x11, 0x4b, 0x15,
+  0x27, 0x01, 0x27, 0x14, 0x4d, 0x18, 0x0b, 0x03, 0x12, 0x07, 0x20, 0x17,
+  0x4f, 0x17, 0x09, 0x07, 0x0f, 0x09, 0x0e, 0x06, 0x0b, 0x17, 0x50, 0x16,
+  0x09, 0x08, 0x0d, 0x0a, 0x0c, 0x09, 0x0a, 0x15, 0x53, 0x15, 0x08, 0x0a,
+  0x0c, 0x0b, 0x0b, 0x09, 0x0a, 0x14, 0x56, 0x13, 0x08, 0x0a, 0x0c, 0x0b,
+  0x0a, 0x0b, 0x09, 0x13, 0x58, 0x12, 0x08, 0x0a, 0x0c, 0x0b, 0x0a, 0x0b,
+  0x09, 0x12, 0x5b, 0x10, 0x08, 0x0a, 0x0b, 0x0c, 0x0a, 0x0b, 0x09, 0x10,
+  0x5f, 0x0e, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0e, 0x63, 0x0c,
+  0x08, 0x0a, 0x0b, 0x0b, 0x0c, 0x09, 0x0a, 0x0c, 0x68, 0x09, 0x09, 0x08,
+  0x0c, 0x0b, 0x0d, 0x08, 0x0a, 0x09, 0x6f, 0x04, 0x0c, 0x05, 0x0c, 0x0c,
+  0x0e, 0x05, 0x0c, 0x05, 0x94, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x0a, 0xba, 0x01, 0x09, 0xa6, 0x01, 0x02, 0x14, 0x07, 0xa5, 0x01, 0x06,
+  0x15, 0x01, 0x10, 0x06, 0x91, 0x01, 0x08, 0x23, 0x09, 0x8f, 0x01, 0x0a,
+  0x22, 0x0a, 0x8e, 0x01, 0x0a, 0x21, 0x0b, 0x8e, 0x01, 0x0b, 0x20, 0x0b,
+  0x8d, 0x01, 0x0c, 0x0c, 0x05, 0x0f, 0x0b, 0x8d, 0x01, 0x0b, 0x0c, 0x08,
+  0x0d, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x09, 0x0d, 0x0b, 0x8d, 0x01, 0x0b,
+  0x0b, 0x0a, 0x0c, 0x0b, 0x8d, 0x01, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x8e,
+  0x01, 0x0a, 0x0b, 0x0b, 0x0c, 0x0a, 0x8e, 0x01, 0x0a, 0x0c, 0x0a, 0x0c,
+  0x0a, 0x8f, 0x01, 0x09, 0x0c, 0x0a, 0x0c, 0x09, 0x91, 0x01, 0x07, 0x0e,
+  0x08, 0x0e, 0x08, 0x94, 0x01, 0x01, 0x12, 0x06, 0x11, 0x04, 0xf9, 0x08,
+  0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x09, 0xbc, 0x01, 0x07, 0xc0, 0x01, 0x02, 0xf4, 0x14, 0x32, 0x02, 0x1e,
+  0x02, 0x1e, 0x02, 0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c,
+  0x02, 0x1d, 0x02, 0x16, 0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f,
+  0x02, 0x05, 0x03, 0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x02, 0x02,
+  0x02, 0x09, 0x02, 0x08, 0x02, 0x05, 0x02, 0x02, 0x03, 0x06, 0x03, 0x09,
+  0x05, 0x02, 0x01, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a,
+  0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x01,
+  0x01, 0x08, 0x02, 0x12, 0x02, 0x01, 0x02, 0x07, 0x03, 0x05, 0x02, 0x03,
+  0x01, 0x05, 0x02, 0x03, 0x01, 0x08, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03,
+  0x03, 0x0e, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x13, 0x02, 0x02,
+  0x03, 0x02, 0x02, 0x15, 0x01, 0x02, 0x03, 0x02, 0x02, 0x19, 0x02, 0x03,
+  0x01, 0x15, 0x01, 0x03, 0x02, 0x22, 0x01, 0x1a, 0x01, 0x04, 0x01, 0x19,
+  0x02, 0x56, 0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c,
+  0x02, 0x0c, 0x04, 0x1e, 0x05, 0x18, 0x05, 0x1f, 0x04, 0x17, 0x05, 0x21,
+  0x03, 0x16, 0x05, 0x30, 0x02, 0x09, 0x04, 0x2d, 0x0a, 0x06, 0x02, 0x2d,
+  0x0c, 0x28, 0x08, 0x02, 0x10, 0x23, 0x13, 0x04, 0x07, 0x21, 0x12, 0x08,
+  0x05, 0x20, 0x07, 0x03, 0x08, 0x0a, 0x05, 0x1e, 0x05, 0x09, 0x06, 0x0a,
+  0x04, 0x1d, 0x05, 0x0c, 0x05, 0x0a, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a,
+  0x04, 0x1b, 0x04, 0x0f, 0x05, 0x09, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10,
+  0x04, 0x0a, 0x03, 0x04, 0x08, 0x0e, 0x04, 0x11, 0x05, 0x08, 0x04, 0x04,
+  0x08, 0x0c, 0x06, 0x12, 0x08, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x07, 0x12,
+  0x0a, 0x02, 0x04, 0x15, 0x09, 0x12, 0x10, 0x15, 0x06, 0x1b, 0x09, 0x15,
+  0x05, 0x1f, 0x07, 0x14, 0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15,
+  0x03, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x04, 0x13,
+  0x04, 0x25, 0x04, 0x13, 0x04, 0x25, 0x03, 0x03, 0x03, 0x0e, 0x04, 0x25,
+  0x03, 0x03, 0x04, 0x0e, 0x04, 0x23, 0x04, 0x03, 0x05, 0x0d, 0x04, 0x0d,
+  0x02, 0x07, 0x02, 0x0a, 0x05, 0x04, 0x03, 0x0f, 0x04, 0x0b, 0x04, 0x05,
+  0x03, 0x09, 0x05, 0x17, 0x06, 0x08, 0x04, 0x05, 0x04, 0x08, 0x05, 0x19,
+  0x07, 0x05, 0x05, 0x04, 0x05, 0x04, 0x08, 0x1b, 0x06, 0x04, 0x05, 0x04,
+  0x05, 0x04, 0x08, 0x1e, 0x03, 0x05, 0x04, 0x05, 0x04, 0x04, 0x08, 0x26,
+  0x04, 0x05, 0x04, 0x05, 0x05, 0x28, 0x05, 0x04, 0x05, 0x04, 0x04, 0x2b,
+  0x03, 0x04, 0x05, 0x04, 0x05, 0x2c, 0x01, 0x04, 0x05, 0x04, 0x05, 0x32,
+  0x04, 0x05, 0x04, 0x29, 0x02, 0x07, 0x04, 0x06, 0x03, 0x2a, 0x03, 0x05,
+  0x05, 0x07, 0x01, 0x2a, 0x04, 0x05, 0x04, 0x34, 0x02, 0x07, 0x02, 0x05,
+  0x03, 0x3d, 0x03, 0x33, 0x01, 0x09, 0x03, 0x32, 0x03, 0x3d, 0x03, 0x3d,
+  0x02, 0xad, 0x02, 0x89, 0x0a, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a,
+  0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0x27, 0x02, 0x65, 0x06, 0x25, 0x0b, 0x25, 0x06, 0x61, 0x09, 0x24, 0x0b,
+  0x23, 0x09, 0x60, 0x0a, 0x23, 0x0a, 0x23, 0x0b, 0x5e, 0x0c, 0x23, 0x08,
+  0x23, 0x0c, 0x5e, 0x0d, 0x24, 0x05, 0x23, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e,
+  0x5e, 0x0e, 0x49, 0x0f, 0x5f, 0x0e, 0x48, 0x0f, 0x5f, 0x0e, 0x47, 0x0f,
+  0x61, 0x0d, 0x46, 0x0f, 0x63, 0x0c, 0x45, 0x0f, 0x65, 0x0b, 0x44, 0x0f,
+  0x67, 0x09, 0x44, 0x0f, 0x69, 0x07, 0x45, 0x0e, 0x6c, 0x04, 0x46, 0x0d,
+  0xb7, 0x01, 0x0c, 0x94, 0x01, 0x0a, 0x1a, 0x0b, 0x91, 0x01, 0x13, 0x16,
+  0x09, 0x8f, 0x01, 0x19, 0x14, 0x07, 0x8e, 0x01, 0x1d, 0x13, 0x05, 0x8d,
+  0x01, 0x21, 0xa1, 0x01, 0x25, 0x9e, 0x01, 0x27, 0x80, 0x01, 0x0b, 0x10,
+  0x2b, 0x79, 0x15, 0x0a, 0x2d, 0x75, 0x1b, 0x06, 0x2f, 0x71, 0x20, 0x03,
+  0x31, 0x6e, 0x57, 0x6b, 0x39, 0x0d, 0x14, 0x69, 0x37, 0x12, 0x13, 0x66,
+  0x37, 0x17, 0x10, 0x65, 0x36, 0x1a, 0x10, 0x63, 0x36, 0x1d, 0x0f, 0x61,
+  0x36, 0x1f, 0x0e, 0x60, 0x18, 0x06, 0x18, 0x21, 0x0e, 0x5e, 0x14, 0x10,
+  0x14, 0x21, 0x0d, 0x5d, 0x12, 0x16, 0x12, 0x21, 0x0d, 0x5b, 0x11, 0x1a,
+  0x11, 0x20, 0x0d, 0x5a, 0x10, 0x1e, 0x10, 0x20, 0x0d, 0x58, 0x10, 0x20,
+  0x10, 0x20, 0x0c, 0x58, 0x0f, 0x23, 0x0f, 0x1f, 0x0c, 0x57, 0x0e, 0x26,
+  0x0e, 0x20, 0x0c, 0x56, 0x0d, 0x28, 0x0e, 0x1f, 0x0c, 0x55, 0x0d, 0x2a,
+  0x0d, 0x1f, 0x0c, 0x54, 0x0d, 0x2c, 0x0d, 0x1f, 0x0b, 0x54, 0x0d, 0x2d,
+  0x0c, 0x1f, 0x0b, 0x10, 0x10, 0x34, 0x0c, 0x2e, 0x0d, 0x1e, 0x0c, 0x0d,
+  0x14, 0x31, 0x0c, 0x30, 0x0c, 0x1e, 0x0c, 0x0c, 0x16, 0x30, 0x0c, 0x30,
+  0x0d, 0x1d, 0x0c, 0x0b, 0x18, 0x2e, 0x0c, 0x32, 0x0c, 0x1d, 0x0c, 0x0b,
+  0x18, 0x2e, 0x0c, 0x33, 0x0b, 0x1e, 0x0b, 0x0b, 0x18, 0x2e, 0x0b, 0x34,
+  0x0c, 0x1c, 0x0c, 0x0b, 0x18, 0x2e, 0x0b, 0x34, 0x0c, 0x1c, 0x0c, 0x0b,
+  0x18, 0x2d, 0x0b, 0x36, 0x11, 0x16, 0x0c, 0x0c, 0x17, 0x2b, 0x0d, 0x36,
+  0x16, 0x11, 0x0c, 0x0c, 0x16, 0x29, 0x10, 0x36, 0x19, 0x0e, 0x0b, 0x0f,
+  0x13, 0x28, 0x12, 0x36, 0x1b, 0x0c, 0x0b, 0x48, 0x14, 0x37, 0x1c, 0x0a,
+  0x0b, 0x46, 0x15, 0x38, 0x1e, 0x07, 0x0c, 0x45, 0x16, 0x38, 0x1f, 0x06,
+  0x0c, 0x44, 0x17, 0x38, 0x21, 0x03, 0x0c, 0x43, 0x19, 0x38, 0x22, 0x02,
+  0x0c, 0x42, 0x1a, 0x38, 0x30, 0x41, 0x1b, 0x39, 0x2e, 0x42, 0x15, 0x4e,
+  0x1f, 0x41, 0x12, 0x56, 0x1a, 0x41, 0x11, 0x5a, 0x18, 0x40, 0x10, 0x5e,
+  0x15, 0x41, 0x0f, 0x60, 0x14, 0x40, 0x0e, 0x63, 0x12, 0x40, 0x0e, 0x65,
+  0x10, 0x41, 0x0d, 0x67, 0x0f, 0x40, 0x0d, 0x69, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e,
+  0x0c, 0x3e, 0x0b, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70,
+  0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71,
+  0x0c, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x09, 0x06, 0x2d,
+  0x0b, 0x71, 0x0c, 0x08, 0x08, 0x2c, 0x0b, 0x71, 0x0c, 0x07, 0x0a, 0x2b,
+  0x0c, 0x70, 0x0b, 0x07, 0x0c, 0x2a, 0x0c, 0x70, 0x0b, 0x07, 0x0d, 0x29,
+  0x0c, 0x6f, 0x0c, 0x07, 0x0e, 0x29, 0x0b, 0x6f, 0x0c, 0x07, 0x0f, 0x28,
+  0x0c, 0x6e, 0x0b, 0x09, 0x0e, 0x28, 0x0c, 0x6d, 0x0c, 0x09, 0x0e, 0x29,
+  0x0c, 0x6c, 0x0c, 0x0a, 0x0d, 0x29, 0x0d, 0x6a, 0x0c, 0x0c, 0x0c, 0x29,
+  0x0d, 0x27, 0x06, 0x15, 0x06, 0x21, 0x0d, 0x0d, 0x0b, 0x2a, 0x0d, 0x25,
+  0x08, 0x13, 0x08, 0x1f, 0x0d, 0x0f, 0x0a, 0x2a, 0x0e, 0x23, 0x0a, 0x11,
+  0x0a, 0x1d, 0x0e, 0x10, 0x08, 0x2c, 0x0e, 0x21, 0x0b, 0x10, 0x0b, 0x1c,
+  0x0e, 0x13, 0x04, 0x2e, 0x0f, 0x1f, 0x0c, 0x10, 0x0b, 0x1b, 0x0f, 0x46,
+  0x10, 0x1c, 0x0d, 0x0f, 0x0c, 0x1a, 0x0f, 0x48, 0x10, 0x1b, 0x0d, 0x0e,
+  0x0d, 0x18, 0x10, 0x49, 0x12, 0x18, 0x0e, 0x0d, 0x0e, 0x16, 0x12, 0x4a,
+  0x15, 0x13, 0x0e, 0x0d, 0x0f, 0x12, 0x15, 0x4c, 0x18, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0d, 0x1a, 0x4e, 0x16, 0x0f, 0x0e, 0x0d, 0x0e, 0x0d, 0x1a, 0x50,
+  0x14, 0x0f, 0x0e, 0x0d, 0x0e, 0x0d, 0x1a, 0x52, 0x12, 0x0f, 0x0e, 0x0d,
+  0x0f, 0x0c, 0x1a, 0x55, 0x10, 0x0e, 0x0e, 0x0d, 0x0f, 0x0c, 0x1a, 0x57,
+  0x0e, 0x0e, 0x0f, 0x0d, 0x0e, 0x0d, 0x18, 0x5b, 0x0b, 0x0f, 0x0e, 0x0d,
+  0x0e, 0x0d, 0x17, 0x5e, 0x09, 0x0f, 0x0e, 0x0d, 0x0e, 0x0d, 0x17, 0x62,
+  0x05, 0x0f, 0x0e, 0x0d, 0x0f, 0x0c, 0x15, 0x67, 0x02, 0x0f, 0x0e, 0x0e,
+  0x0e, 0x0c, 0x13, 0x7b, 0x0e, 0x0d, 0x0e, 0x0d, 0x0f, 0x7e, 0x0e, 0x0d,
+  0x0e, 0x0d, 0x0e, 0x7f, 0x0e, 0x0d, 0x0e, 0x0d, 0x0e, 0x80, 0x01, 0x0d,
+  0x0d, 0x0f, 0x0c, 0x0f, 0x80, 0x01, 0x0d, 0x0d, 0x0e, 0x0d, 0x0e, 0x81,
+  0x01, 0x0c, 0x0d, 0x0e, 0x0d, 0x0e, 0x82, 0x01, 0x0b, 0x0d, 0x0e, 0x0d,
+  0x0e, 0x84, 0x01, 0x09, 0x0d, 0x0e, 0x0d, 0x0e, 0x86, 0x01, 0x07, 0x0d,
+  0x0f, 0x0c, 0x0f, 0x87, 0x01, 0x05, 0x0e, 0x0e, 0x0d, 0x0e, 0x9a, 0x01,
+  0x0e, 0x0d, 0x0e, 0x9a, 0x01, 0x0e, 0x0e, 0x0d, 0x9a, 0x01, 0x0e, 0x0e,
+  0x0d, 0x9a, 0x01, 0x0f, 0x0e, 0x0d, 0x9a, 0x01, 0x0e, 0x0f, 0x0c, 0x80,
+  0x01, 0x05, 0x15, 0x0e, 0x11, 0x0a, 0x7f, 0x08, 0x13, 0x0e, 0x12, 0x09,
+  0x80, 0x01, 0x09, 0x11, 0x0f, 0x13, 0x07, 0x80, 0x01, 0x0b, 0x10, 0x0e,
+  0x15, 0x05, 0x81, 0x01, 0x0b, 0x0f, 0x0e, 0x9c, 0x01, 0x0b, 0x0f, 0x0d,
+  0x9d, 0x01, 0x0b, 0x0f, 0x0c, 0x9e, 0x01, 0x0a, 0x10, 0x0c, 0x9f, 0x01,
+  0x09, 0x11, 0x0a, 0x0f, 0x06, 0x8c, 0x01, 0x07, 0x13, 0x08, 0x0f, 0x08,
+  0x8c, 0x01, 0x04, 0x16, 0x06, 0x0f, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0x9a, 0x01,
+  0x06, 0x1b, 0x08, 0x9a, 0x01, 0x08, 0x1b, 0x06, 0x9a, 0x01, 0x0a, 0x1c,
+  0x02, 0x9c, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xc0, 0x01,
+  0x02, 0xbb, 0x13, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x17, 0x01, 0x06,
+  0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d, 0x02, 0x16, 0x06, 0x13,
+  0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x06, 0x02, 0x05, 0x02, 0x0e,
+  0x02, 0x08, 0x02, 0x05, 0x01, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x02, 0x01,
+  0x04, 0x06, 0x04, 0x08, 0x05, 0x02, 0x01, 0x0b, 0x04, 0x0a, 0x07, 0x0a,
+  0x03, 0x10, 0x03, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a,
+  0x02, 0x05, 0x02, 0x06, 0x01, 0x04, 0x02, 0x01, 0x01, 0x08, 0x02, 0x05,
+  0x02, 0x05, 0x02, 0x04, 0x02, 0x01, 0x02, 0x07, 0x03, 0x04, 0x01, 0x06,
+  0x02, 0x03, 0x02, 0x03, 0x01, 0x08, 0x04, 0x0c, 0x03, 0x0e, 0x03, 0x05,
+  0x02, 0x05, 0x02, 0x13, 0x01, 0x03, 0x01, 0x02, 0x01, 0x18, 0x01, 0x06,
+  0x02, 0x17, 0x01, 0x06, 0x01, 0x3a, 0x02, 0x1e, 0x02, 0x74, 0xa5, 0x01,
+  0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x2e,
+  0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c, 0x03, 0x1f,
+  0x05, 0x18, 0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16, 0x05, 0x3b,
+  0x04, 0x2e, 0x08, 0x07, 0x02, 0x2d, 0x0c, 0x28, 0x08, 0x03, 0x0e, 0x25,
+  0x12, 0x04, 0x06, 0x22, 0x12, 0x08, 0x05, 0x20, 0x08, 0x02, 0x08, 0x0a,
+  0x05, 0x1e, 0x06, 0x08, 0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c, 0x05, 0x0a,
+  0x03, 0x1d, 0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b, 0x04, 0x10, 0x04, 0x09,
+  0x04, 0x04, 0x07, 0x10, 0x04, 0x10, 0x04, 0x09, 0x04, 0x04, 0x08, 0x0f,
+  0x03, 0x12, 0x04, 0x08, 0x04, 0x04, 0x07, 0x0d, 0x06, 0x12, 0x08, 0x04,
+  0x04, 0x05, 0x05, 0x0d, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x16, 0x08, 0x12,
+  0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x07, 0x14, 0x05, 0x21,
+  0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x03, 0x24, 0x04, 0x14, 0x04, 0x25,
+  0x03, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x0c, 0x02, 0x0d, 0x01, 0x09,
+  0x03, 0x14, 0x04, 0x0b, 0x04, 0x0b, 0x03, 0x08, 0x03, 0x03, 0x03, 0x0f,
+  0x03, 0x0b, 0x04, 0x0a, 0x04, 0x07, 0x04, 0x03, 0x04, 0x0e, 0x04, 0x0a,
+  0x04, 0x0a, 0x04, 0x07, 0x04, 0x03, 0x05, 0x0d, 0x05, 0x09, 0x03, 0x0b,
+  0x04, 0x06, 0x05, 0x04, 0x03, 0x0f, 0x05, 0x08, 0x03, 0x0c, 0x02, 0x06,
+  0x05, 0x06, 0x01, 0x11, 0x05, 0x1c, 0x06, 0x1a, 0x07, 0x0a, 0x03, 0x0a,
+  0x07, 0x1c, 0x06, 0x0a, 0x03, 0x0a, 0x06, 0x1e, 0x05, 0x09, 0x04, 0x0a,
+  0x05, 0x27, 0x01, 0x05, 0x04, 0x0a, 0x01, 0x2a, 0x03, 0x04, 0x04, 0x03,
+  0x03, 0x2e, 0x04, 0x05, 0x02, 0x04, 0x03, 0x2e, 0x04, 0x0a, 0x04, 0x2e,
+  0x04, 0x0a, 0x04, 0x2e, 0x03, 0x0b, 0x03, 0x76, 0x02, 0x3d, 0x03, 0x3d,
+  0x03, 0x3c, 0x04, 0x3c, 0x04, 0x3d, 0x02, 0xe9, 0x02, 0x8a, 0x0a, 0x04,
+  0xbe, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0x8e, 0x01, 0x05, 0x25, 0x0b, 0x26,
+  0x05, 0x63, 0x07, 0x25, 0x0a, 0x25, 0x07, 0x61, 0x09, 0x24, 0x0a, 0x24,
+  0x09, 0x5f, 0x0b, 0x24, 0x08, 0x24, 0x0b, 0x5e, 0x0c, 0x24, 0x06, 0x24,
+  0x0c, 0x5e, 0x0d, 0x25, 0x02, 0x25, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e,
+  0x0f, 0x48, 0x0f, 0x5f, 0x0e, 0x47, 0x0f, 0x61, 0x0d, 0x46, 0x0f, 0x63,
+  0x0c, 0x45, 0x10, 0x64, 0x0b, 0x44, 0x10, 0x66, 0x0a, 0x43, 0x10, 0x68,
+  0x08, 0x44, 0x0f, 0x6a, 0x06, 0x45, 0x0e, 0x6d, 0x01, 0x48, 0x0d, 0xb7,
+  0x01, 0x0c, 0x92, 0x01, 0x0e, 0x18, 0x0b, 0x8f, 0x01, 0x16, 0x15, 0x09,
+  0x8e, 0x01, 0x1a, 0x14, 0x06, 0x8e, 0x01, 0x1e, 0x14, 0x02, 0x8e, 0x01,
+  0x22, 0xa0, 0x01, 0x26, 0x9d, 0x01, 0x28, 0x7d, 0x11, 0x0d, 0x2b, 0x77,
+  0x19, 0x07, 0x2e, 0x73, 0x1f, 0x03, 0x30, 0x70, 0x55, 0x6d, 0x39, 0x0a,
+  0x15, 0x6a, 0x38, 0x11, 0x12, 0x68, 0x36, 0x16, 0x10, 0x67, 0x36, 0x18,
+  0x10, 0x64, 0x36, 0x1c, 0x0f, 0x62, 0x36, 0x1e, 0x0e, 0x61, 0x1a, 0x02,
+  0x1b, 0x1f, 0x0e, 0x5f, 0x14, 0x10, 0x15, 0x1f, 0x0d, 0x5e, 0x13, 0x15,
+  0x13, 0x1f, 0x0d, 0x5c, 0x11, 0x1a, 0x11, 0x20, 0x0c, 0x5b, 0x11, 0x1d,
+  0x10, 0x20, 0x0c, 0x5a, 0x0f, 0x20, 0x10, 0x1f, 0x0c, 0x59, 0x0f, 0x23,
+  0x0f, 0x1f, 0x0c, 0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c, 0x57, 0x0e, 0x27,
+  0x0e, 0x1f, 0x0b, 0x56, 0x0e, 0x29, 0x0e, 0x1e, 0x0b, 0x56, 0x0d, 0x2b,
+  0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2d, 0x0d, 0x1e, 0x0b, 0x10, 0x0f, 0x35,
+  0x0c, 0x2e, 0x0d, 0x1e, 0x0b, 0x0e, 0x14, 0x31, 0x0d, 0x2f, 0x0c, 0x1e,
+  0x0b, 0x0d, 0x16, 0x30, 0x0c, 0x31, 0x0c, 0x1d, 0x0b, 0x0c, 0x17, 0x30,
+  0x0b, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x33, 0x0c, 0x1c,
+  0x0b, 0x0b, 0x19, 0x2e, 0x0c, 0x33, 0x0c, 0x1c, 0x0b, 0x0b, 0x19, 0x2e,
+  0x0b, 0x34, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x35, 0x11, 0x16,
+  0x0b, 0x0c, 0x17, 0x2c, 0x0e, 0x35, 0x17, 0x10, 0x0b, 0x0d, 0x16, 0x29,
+  0x10, 0x36, 0x1a, 0x0d, 0x0b, 0x0e, 0x13, 0x29, 0x12, 0x37, 0x1b, 0x0a,
+  0x0c, 0x48, 0x14, 0x37, 0x1d, 0x08, 0x0c, 0x47, 0x15, 0x37, 0x1e, 0x07,
+  0x0b, 0x46, 0x17, 0x37, 0x20, 0x05, 0x0b, 0x45, 0x18, 0x37, 0x21, 0x03,
+  0x0c, 0x44, 0x18, 0x38, 0x22, 0x02, 0x0c, 0x43, 0x19, 0x38, 0x2f, 0x43,
+  0x1a, 0x39, 0x2e, 0x42, 0x15, 0x4e, 0x1f, 0x41, 0x12, 0x56, 0x1a, 0x41,
+  0x11, 0x5a, 0x18, 0x41, 0x0f, 0x5e, 0x15, 0x41, 0x0f, 0x60, 0x14, 0x40,
+  0x0f, 0x62, 0x12, 0x41, 0x0e, 0x64, 0x10, 0x41, 0x0e, 0x66, 0x0f, 0x41,
+  0x0d, 0x68, 0x0d, 0x41, 0x0d, 0x6a, 0x0c, 0x41, 0x0c, 0x6c, 0x0c, 0x40,
+  0x0c, 0x6c, 0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e,
+  0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3d,
+  0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d,
+  0x0c, 0x71, 0x0a, 0x3d, 0x0c, 0x71, 0x0a, 0x3d, 0x0c, 0x25, 0x05, 0x28,
+  0x03, 0x1c, 0x0a, 0x3d, 0x0c, 0x23, 0x08, 0x25, 0x07, 0x19, 0x0b, 0x0a,
+  0x05, 0x2e, 0x0c, 0x23, 0x09, 0x23, 0x09, 0x18, 0x0b, 0x08, 0x08, 0x2d,
+  0x0c, 0x22, 0x0b, 0x21, 0x0a, 0x18, 0x0b, 0x08, 0x09, 0x2d, 0x0b, 0x22,
+  0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x07, 0x0b, 0x2c, 0x0b, 0x22, 0x0b, 0x21,
+  0x0b, 0x17, 0x0b, 0x07, 0x0c, 0x2b, 0x0c, 0x20, 0x0c, 0x21, 0x0b, 0x16,
+  0x0c, 0x07, 0x0d, 0x2a, 0x0c, 0x20, 0x0c, 0x20, 0x0c, 0x16, 0x0b, 0x08,
+  0x0e, 0x29, 0x0d, 0x1f, 0x0b, 0x21, 0x0b, 0x16, 0x0c, 0x08, 0x0f, 0x29,
+  0x0c, 0x1e, 0x0c, 0x21, 0x0b, 0x16, 0x0c, 0x09, 0x0e, 0x29, 0x0d, 0x1d,
+  0x0c, 0x20, 0x0c, 0x15, 0x0d, 0x0a, 0x0d, 0x2a, 0x0c, 0x1d, 0x0c, 0x20,
+  0x0c, 0x15, 0x0c, 0x0c, 0x0c, 0x2a, 0x0d, 0x1c, 0x0b, 0x21, 0x0b, 0x15,
+  0x0d, 0x0d, 0x0b, 0x2a, 0x0e, 0x1b, 0x0b, 0x21, 0x0b, 0x14, 0x0d, 0x0f,
+  0x09, 0x2c, 0x0e, 0x1b, 0x0a, 0x22, 0x0a, 0x13, 0x0e, 0x10, 0x07, 0x2e,
+  0x0e, 0x1a, 0x09, 0x23, 0x09, 0x13, 0x0e, 0x12, 0x05, 0x2f, 0x0f, 0x1b,
+  0x06, 0x25, 0x08, 0x12, 0x0f, 0x14, 0x01, 0x32, 0x10, 0x1b, 0x02, 0x28,
+  0x05, 0x12, 0x10, 0x49, 0x10, 0x59, 0x11, 0x4a, 0x13, 0x54, 0x13, 0x4b,
+  0x16, 0x25, 0x02, 0x25, 0x16, 0x4d, 0x18, 0x20, 0x06, 0x21, 0x17, 0x4f,
+  0x17, 0x1f, 0x08, 0x1f, 0x17, 0x51, 0x16, 0x1e, 0x0a, 0x1e, 0x16, 0x53,
+  0x15, 0x1e, 0x0a, 0x1e, 0x15, 0x56, 0x13, 0x1e, 0x0b, 0x1d, 0x13, 0x59,
+  0x12, 0x1d, 0x0c, 0x1d, 0x12, 0x5c, 0x10, 0x1d, 0x0b, 0x1e, 0x10, 0x60,
+  0x0e, 0x1d, 0x0b, 0x1e, 0x0e, 0x64, 0x0c, 0x1d, 0x0b, 0x1e, 0x0c, 0x69,
+  0x09, 0x1c, 0x0c, 0x1e, 0x09, 0x72, 0x02, 0x08, 0x05, 0x10, 0x0b, 0x20,
+  0x03, 0x80, 0x01, 0x07, 0x0f, 0x0b, 0x0b, 0x07, 0x90, 0x01, 0x09, 0x0e,
+  0x0b, 0x0a, 0x09, 0x8f, 0x01, 0x0a, 0x0d, 0x0b, 0x0a, 0x09, 0x8e, 0x01,
+  0x0b, 0x0e, 0x09, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0f, 0x08, 0x0a, 0x0b,
+  0x8d, 0x01, 0x0b, 0x10, 0x06, 0x0b, 0x0b, 0x8d, 0x01, 0x0b, 0x20, 0x0c,
+  0x8c, 0x01, 0x0c, 0x20, 0x0c, 0x8c, 0x01, 0x0b, 0x21, 0x0b, 0x8d, 0x01,
+  0x0b, 0x20, 0x0c, 0x8d, 0x01, 0x0b, 0x20, 0x0c, 0x8d, 0x01, 0x0b, 0x20,
+  0x0b, 0x8e, 0x01, 0x0a, 0x21, 0x0b, 0x8e, 0x01, 0x0a, 0x21, 0x0b, 0x8f,
+  0x01, 0x09, 0x22, 0x09, 0x90, 0x01, 0x08, 0x24, 0x08, 0x92, 0x01, 0x04,
+  0x27, 0x06, 0xf1, 0x05, 0x05, 0xbd, 0x01, 0x09, 0xbb, 0x01, 0x09, 0xba,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xbb,
+  0x01, 0x08, 0xbd, 0x01, 0x06, 0xbd, 0x19, 0x32, 0x02, 0x1e, 0x02, 0x1e,
+  0x02, 0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d,
+  0x02, 0x16, 0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05,
+  0x03, 0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x02, 0x09,
+  0x02, 0x08, 0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x03, 0x09, 0x05, 0x02,
+  0x01, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x01, 0x13, 0x02, 0x01, 0x01, 0x08,
+  0x02, 0x12, 0x02, 0x01, 0x02, 0x07, 0x02, 0x11, 0x02, 0x03, 0x01, 0x08,
+  0x03, 0x0d, 0x03, 0x0e, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01,
+  0x03, 0x17, 0x01, 0x1b, 0x01, 0x06, 0x01, 0x18, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x18, 0x01, 0x02, 0x01, 0x03, 0x01, 0x3a, 0x02, 0x1e, 0x02, 0x54,
+  0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c,
+  0x04, 0x1e, 0x05, 0x18, 0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16,
+  0x05, 0x3b, 0x04, 0x2d, 0x09, 0x07, 0x02, 0x2d, 0x0c, 0x28, 0x08, 0x02,
+  0x0f, 0x24, 0x13, 0x04, 0x06, 0x22, 0x12, 0x08, 0x05, 0x20, 0x08, 0x02,
+  0x08, 0x0a, 0x05, 0x1e, 0x06, 0x08, 0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c,
+  0x05, 0x0a, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b, 0x04, 0x0f,
+  0x05, 0x09, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10, 0x04, 0x09, 0x04, 0x04,
+  0x08, 0x0e, 0x04, 0x11, 0x05, 0x08, 0x04, 0x04, 0x08, 0x0c, 0x06, 0x12,
+  0x08, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x15,
+  0x09, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x07, 0x14,
+  0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x03, 0x24, 0x04, 0x14,
+  0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x04, 0x13, 0x04, 0x25, 0x04, 0x13,
+  0x04, 0x25, 0x03, 0x03, 0x03, 0x0e, 0x04, 0x24, 0x04, 0x03, 0x04, 0x0e,
+  0x04, 0x23, 0x04, 0x03, 0x05, 0x0d, 0x04, 0x22, 0x05, 0x04, 0x03, 0x0f,
+  0x04, 0x20, 0x05, 0x17, 0x06, 0x1d, 0x05, 0x19, 0x08, 0x04, 0x01, 0x05,
+  0x02, 0x06, 0x01, 0x04, 0x08, 0x1a, 0x07, 0x03, 0x03, 0x04, 0x03, 0x04,
+  0x03, 0x03, 0x06, 0x1e, 0x05, 0x03, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03,
+  0x05, 0x22, 0x01, 0x04, 0x02, 0x04, 0x04, 0x04, 0x02, 0x04, 0x02, 0x30,
+  0x03, 0x36, 0x02, 0x06, 0x01, 0x05, 0x02, 0x2f, 0x04, 0x0a, 0x04, 0x2e,
+  0x04, 0x03, 0x03, 0x04, 0x04, 0x2e, 0x04, 0x03, 0x03, 0x04, 0x03, 0x2f,
+  0x03, 0x04, 0x03, 0x04, 0x03, 0xb5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04,
+  0x3c, 0x04, 0x3d, 0x02, 0xa9, 0x02, 0x89, 0x0a, 0x06, 0xbd, 0x01, 0x08,
+  0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0x8d, 0x01, 0x06, 0x26, 0x0a, 0x26, 0x06, 0x61, 0x09,
+  0x24, 0x0a, 0x25, 0x08, 0x5f, 0x0b, 0x23, 0x0a, 0x24, 0x0a, 0x5e, 0x0b,
+  0x24, 0x08, 0x24, 0x0b, 0x5e, 0x0c, 0x24, 0x06, 0x24, 0x0c, 0x5e, 0x0d,
+  0x4c, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0f, 0x48, 0x0f, 0x5f, 0x0e,
+  0x47, 0x0f, 0x61, 0x0d, 0x46, 0x0f, 0x63, 0x0c, 0x45, 0x0f, 0x65, 0x0b,
+  0x44, 0x0f, 0x67, 0x09, 0x44, 0x0f, 0x69, 0x07, 0x45, 0x0e, 0x6b, 0x05,
+  0x46, 0x0d, 0xb7, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0x92, 0x01, 0x10, 0x18,
+  0x09, 0x90, 0x01, 0x17, 0x14, 0x08, 0x8e, 0x01, 0x1c, 0x13, 0x06, 0x8d,
+  0x01, 0x20, 0xa2, 0x01, 0x24, 0x9f, 0x01, 0x26, 0x82, 0x01, 0x08, 0x12,
+  0x2a, 0x7a, 0x14, 0x0b, 0x2c, 0x76, 0x1a, 0x07, 0x2e, 0x72, 0x1f, 0x04,
+  0x30, 0x6f, 0x56, 0x6c, 0x39, 0x0c, 0x14, 0x6a, 0x37, 0x12, 0x12, 0x67,
+  0x37, 0x16, 0x11, 0x65, 0x36, 0x1a, 0x0f, 0x64, 0x36, 0x1c, 0x0f, 0x62,
+  0x36, 0x1e, 0x0f, 0x60, 0x18, 0x06, 0x18, 0x20, 0x0e, 0x5f, 0x14, 0x10,
+  0x14, 0x20, 0x0e, 0x5d, 0x12, 0x16, 0x12, 0x20, 0x0d, 0x5c, 0x11, 0x1a,
+  0x11, 0x20, 0x0d, 0x5a, 0x10, 0x1e, 0x10, 0x20, 0x0c, 0x59, 0x10, 0x20,
+  0x10, 0x1f, 0x0c, 0x59, 0x0f, 0x22, 0x10, 0x1f, 0x0c, 0x57, 0x0e, 0x26,
+  0x0e, 0x1f, 0x0c, 0x56, 0x0e, 0x28, 0x0e, 0x1f, 0x0b, 0x56, 0x0d, 0x2a,
+  0x0d, 0x1f, 0x0c, 0x54, 0x0e, 0x2b, 0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2c,
+  0x0d, 0x1f, 0x0b, 0x10, 0x10, 0x33, 0x0d, 0x2e, 0x0d, 0x1e, 0x0b, 0x0e,
+  0x14, 0x31, 0x0c, 0x30, 0x0c, 0x1e, 0x0b, 0x0d, 0x16, 0x2f, 0x0d, 0x30,
+  0x0d, 0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c,
+  0x18, 0x2e, 0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x34,
+  0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x34, 0x0c, 0x1c, 0x0b, 0x0c,
+  0x18, 0x2d, 0x0c, 0x35, 0x11, 0x16, 0x0b, 0x0c, 0x18, 0x2b, 0x0d, 0x36,
+  0x16, 0x11, 0x0b, 0x0d, 0x16, 0x29, 0x10, 0x36, 0x19, 0x0e, 0x0b, 0x0e,
+  0x14, 0x28, 0x12, 0x36, 0x1c, 0x0b, 0x0b, 0x48, 0x14, 0x37, 0x1c, 0x09,
+  0x0c, 0x46, 0x16, 0x37, 0x1e, 0x07, 0x0c, 0x45, 0x16, 0x38, 0x1f, 0x06,
+  0x0b, 0x45, 0x17, 0x38, 0x21, 0x03, 0x0c, 0x43, 0x19, 0x38, 0x22, 0x02,
+  0x0c, 0x42, 0x1a, 0x38, 0x2f, 0x42, 0x1b, 0x38, 0x2f, 0x42, 0x15, 0x4d,
+  0x20, 0x41, 0x12, 0x55, 0x1b, 0x41, 0x11, 0x5a, 0x18, 0x40, 0x10, 0x5d,
+  0x16, 0x41, 0x0e, 0x61, 0x14, 0x40, 0x0e, 0x63, 0x12, 0x40, 0x0e, 0x65,
+  0x10, 0x41, 0x0d, 0x67, 0x0f, 0x40, 0x0d, 0x69, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0c, 0x41, 0x0c, 0x6b, 0x0d, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d,
+  0x0c, 0x3f, 0x0b, 0x6f, 0x0c, 0x3d, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x09, 0x05, 0x2e,
+  0x0b, 0x71, 0x0c, 0x08, 0x07, 0x2d, 0x0b, 0x71, 0x0c, 0x07, 0x09, 0x2c,
+  0x0c, 0x70, 0x0b, 0x07, 0x0b, 0x2b, 0x0c, 0x70, 0x0b, 0x07, 0x0c, 0x2b,
+  0x0b, 0x6f, 0x0c, 0x07, 0x0d, 0x2a, 0x0c, 0x6e, 0x0c, 0x07, 0x0e, 0x29,
+  0x0c, 0x6e, 0x0c, 0x07, 0x0f, 0x28, 0x0c, 0x6d, 0x0c, 0x09, 0x0e, 0x29,
+  0x0c, 0x6c, 0x0c, 0x0a, 0x0d, 0x29, 0x0d, 0x6a, 0x0d, 0x0b, 0x0c, 0x29,
+  0x0d, 0x69, 0x0d, 0x0d, 0x0b, 0x2a, 0x0d, 0x67, 0x0e, 0x0e, 0x09, 0x2b,
+  0x0e, 0x65, 0x0e, 0x10, 0x08, 0x2c, 0x0e, 0x63, 0x0f, 0x11, 0x05, 0x2f,
+  0x0e, 0x61, 0x0f, 0x46, 0x10, 0x5e, 0x0f, 0x48, 0x11, 0x5a, 0x11, 0x49,
+  0x11, 0x57, 0x12, 0x4a, 0x14, 0x51, 0x14, 0x4c, 0x18, 0x21, 0x05, 0x21,
+  0x18, 0x4e, 0x17, 0x0b, 0x06, 0x0f, 0x08, 0x0e, 0x05, 0x0c, 0x17, 0x50,
+  0x16, 0x0a, 0x08, 0x0d, 0x09, 0x0d, 0x08, 0x0a, 0x16, 0x52, 0x15, 0x09,
+  0x0a, 0x0b, 0x0b, 0x0b, 0x09, 0x0a, 0x15, 0x55, 0x13, 0x09, 0x0a, 0x0b,
+  0x0b, 0x0b, 0x0a, 0x09, 0x14, 0x57, 0x12, 0x09, 0x0a, 0x0b, 0x0b, 0x0a,
+  0x0b, 0x09, 0x13, 0x5a, 0x10, 0x09, 0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x09,
+  0x11, 0x5d, 0x0f, 0x09, 0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x09, 0x0f, 0x62,
+  0x0c, 0x09, 0x0a, 0x0a, 0x0b, 0x0c, 0x0a, 0x09, 0x0d, 0x67, 0x09, 0x0a,
+  0x08, 0x0b, 0x0b, 0x0d, 0x08, 0x0a, 0x0b, 0x6d, 0x05, 0x0b, 0x06, 0x0c,
+  0x0b, 0x0e, 0x06, 0x0b, 0x07, 0x92, 0x01, 0x0b, 0x11, 0x01, 0xa7, 0x01,
+  0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x09, 0xbc, 0x01, 0x07, 0xa6, 0x01,
+  0x06, 0x13, 0x04, 0x0e, 0x05, 0x93, 0x01, 0x08, 0x23, 0x08, 0x90, 0x01,
+  0x0a, 0x21, 0x09, 0x90, 0x01, 0x0a, 0x20, 0x0b, 0x8e, 0x01, 0x0c, 0x1f,
+  0x0b, 0x8e, 0x01, 0x0c, 0x0b, 0x05, 0x0f, 0x0b, 0x8e, 0x01, 0x0b, 0x0b,
+  0x08, 0x0d, 0x0b, 0x8e, 0x01, 0x0b, 0x0a, 0x09, 0x0d, 0x0b, 0x8e, 0x01,
+  0x0b, 0x0a, 0x0a, 0x0c, 0x0b, 0x8e, 0x01, 0x0b, 0x09, 0x0b, 0x0b, 0x0b,
+  0x8f, 0x01, 0x0b, 0x09, 0x0b, 0x0c, 0x0a, 0x8f, 0x01, 0x0a, 0x0b, 0x0a,
+  0x0c, 0x0a, 0x90, 0x01, 0x09, 0x0b, 0x0a, 0x0c, 0x0a, 0x90, 0x01, 0x08,
+  0x0d, 0x08, 0x0e, 0x08, 0x93, 0x01, 0x05, 0x0f, 0x06, 0x10, 0x06, 0xaa,
+  0x01, 0x02, 0xcc, 0x07, 0x05, 0xbe, 0x01, 0x08, 0xbb, 0x01, 0x09, 0xbb,
+  0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xba,
+  0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbe, 0x01, 0x04, 0xf3,
+  0x14, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x17, 0x01, 0x06, 0x02, 0x06,
+  0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d, 0x02, 0x16, 0x06, 0x13, 0x05, 0x01,
+  0x08, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05, 0x03, 0x05, 0x02, 0x0e,
+  0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x02, 0x09, 0x02, 0x08, 0x02, 0x05,
+  0x02, 0x01, 0x04, 0x06, 0x04, 0x08, 0x05, 0x01, 0x02, 0x0b, 0x04, 0x0a,
+  0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x12, 0x02, 0x01, 0x01, 0x08, 0x02, 0x12, 0x02, 0x01,
+  0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x02, 0x03, 0x01, 0x08, 0x04, 0x0c,
+  0x03, 0x0e, 0x03, 0x02, 0x01, 0x05, 0x02, 0x01, 0x03, 0x37, 0x02, 0x1b,
+  0x01, 0x1f, 0x01, 0x05, 0x02, 0x3b, 0x02, 0x72, 0xa5, 0x01, 0x02, 0x3d,
+  0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x2e, 0x02, 0x0c,
+  0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c, 0x03, 0x1f, 0x05, 0x18,
+  0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16, 0x05, 0x3b, 0x04, 0x2e,
+  0x08, 0x07, 0x02, 0x2d, 0x0c, 0x28, 0x08, 0x03, 0x0e, 0x25, 0x12, 0x04,
+  0x06, 0x22, 0x12, 0x08, 0x05, 0x20, 0x08, 0x02, 0x08, 0x0a, 0x05, 0x1e,
+  0x06, 0x08, 0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c, 0x04, 0x0b, 0x04, 0x1c,
+  0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b, 0x04, 0x10, 0x03, 0x0a, 0x04, 0x04,
+  0x07, 0x10, 0x04, 0x10, 0x04, 0x09, 0x04, 0x04, 0x08, 0x0f, 0x03, 0x12,
+  0x03, 0x09, 0x04, 0x04, 0x07, 0x0e, 0x05, 0x12, 0x08, 0x04, 0x04, 0x05,
+  0x05, 0x0d, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x16, 0x08, 0x12, 0x0f, 0x16,
+  0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x15, 0x05, 0x21, 0x05, 0x15,
+  0x04, 0x23, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x03, 0x25, 0x03, 0x14,
+  0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x04, 0x01, 0x0f, 0x04, 0x25,
+  0x03, 0x03, 0x03, 0x0f, 0x03, 0x24, 0x04, 0x03, 0x04, 0x0e, 0x04, 0x11,
+  0x01, 0x11, 0x04, 0x03, 0x04, 0x0e, 0x05, 0x0f, 0x03, 0x0f, 0x05, 0x04,
+  0x03, 0x0f, 0x05, 0x0e, 0x03, 0x0e, 0x05, 0x18, 0x05, 0x0d, 0x03, 0x0c,
+  0x06, 0x19, 0x08, 0x04, 0x02, 0x0b, 0x02, 0x04, 0x07, 0x1c, 0x06, 0x03,
+  0x03, 0x0b, 0x03, 0x03, 0x06, 0x1e, 0x05, 0x03, 0x03, 0x0b, 0x03, 0x03,
+  0x05, 0x23, 0x01, 0x04, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x32, 0x03, 0x3d,
+  0x03, 0x3d, 0x03, 0x3e, 0x01, 0x37, 0x03, 0x0b, 0x03, 0x2f, 0x03, 0x0b,
+  0x03, 0x2f, 0x03, 0x0b, 0x03, 0x76, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0xa5,
+  0x03, 0x8a, 0x0a, 0x04, 0xbf, 0x01, 0x07, 0xbc, 0x01, 0x08, 0xbb, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0x90, 0x01,
+  0x04, 0x25, 0x0b, 0x26, 0x05, 0x63, 0x08, 0x24, 0x0a, 0x24, 0x08, 0x61,
+  0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x60, 0x0b, 0x23, 0x08, 0x23, 0x0b, 0x5f,
+  0x0d, 0x23, 0x06, 0x23, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0e, 0x4a,
+  0x0e, 0x5e, 0x0f, 0x48, 0x0e, 0x60, 0x0e, 0x47, 0x0f, 0x61, 0x0d, 0x46,
+  0x0f, 0x63, 0x0c, 0x45, 0x0f, 0x65, 0x0b, 0x44, 0x0f, 0x67, 0x0a, 0x43,
+  0x0f, 0x69, 0x08, 0x44, 0x0e, 0x6b, 0x06, 0x45, 0x0d, 0xb7, 0x01, 0x0c,
+  0xb8, 0x01, 0x0b, 0x92, 0x01, 0x0f, 0x18, 0x0a, 0x90, 0x01, 0x16, 0x15,
+  0x08, 0x8e, 0x01, 0x1c, 0x13, 0x06, 0x8d, 0x01, 0x20, 0xa3, 0x01, 0x23,
+  0x9f, 0x01, 0x26, 0x9d, 0x01, 0x29, 0x7c, 0x10, 0x0d, 0x2c, 0x77, 0x18,
+  0x08, 0x2e, 0x74, 0x1d, 0x04, 0x30, 0x70, 0x22, 0x01, 0x32, 0x6d, 0x38,
+  0x0c, 0x14, 0x6b, 0x36, 0x12, 0x12, 0x68, 0x36, 0x16, 0x11, 0x66, 0x35,
+  0x1a, 0x0f, 0x64, 0x36, 0x1c, 0x0f, 0x62, 0x36, 0x1e, 0x0f, 0x60, 0x36,
+  0x20, 0x0e, 0x5f, 0x15, 0x0f, 0x14, 0x20, 0x0e, 0x5d, 0x13, 0x15, 0x12,
+  0x20, 0x0d, 0x5c, 0x12, 0x19, 0x11, 0x20, 0x0d, 0x5b, 0x10, 0x1d, 0x10,
+  0x20, 0x0c, 0x5a, 0x0f, 0x20, 0x10, 0x1f, 0x0c, 0x59, 0x0f, 0x23, 0x0e,
+  0x20, 0x0c, 0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c, 0x57, 0x0e, 0x27, 0x0d,
+  0x20, 0x0b, 0x56, 0x0e, 0x29, 0x0d, 0x1f, 0x0b, 0x56, 0x0d, 0x2b, 0x0d,
+  0x1e, 0x0c, 0x54, 0x0d, 0x2d, 0x0c, 0x1e, 0x0c, 0x0f, 0x11, 0x34, 0x0d,
+  0x2d, 0x0d, 0x1e, 0x0b, 0x0d, 0x15, 0x31, 0x0d, 0x2f, 0x0c, 0x1e, 0x0b,
+  0x0c, 0x17, 0x30, 0x0c, 0x31, 0x0b, 0x1e, 0x0b, 0x0c, 0x17, 0x2f, 0x0d,
+  0x31, 0x0c, 0x1d, 0x0b, 0x0b, 0x19, 0x2e, 0x0c, 0x33, 0x0b, 0x1d, 0x0b,
+  0x0b, 0x19, 0x2e, 0x0c, 0x33, 0x0b, 0x1d, 0x0b, 0x0b, 0x19, 0x2e, 0x0b,
+  0x34, 0x0c, 0x1c, 0x0b, 0x0b, 0x18, 0x2e, 0x0c, 0x35, 0x0f, 0x18, 0x0b,
+  0x0c, 0x17, 0x2d, 0x0d, 0x35, 0x16, 0x11, 0x0b, 0x0d, 0x15, 0x2b, 0x10,
+  0x35, 0x19, 0x0d, 0x0c, 0x0e, 0x13, 0x29, 0x12, 0x37, 0x1a, 0x0b, 0x0c,
+  0x49, 0x13, 0x37, 0x1c, 0x09, 0x0c, 0x47, 0x15, 0x37, 0x1d, 0x08, 0x0b,
+  0x46, 0x17, 0x37, 0x1f, 0x05, 0x0c, 0x45, 0x18, 0x37, 0x20, 0x04, 0x0c,
+  0x44, 0x19, 0x37, 0x21, 0x02, 0x0d, 0x43, 0x19, 0x38, 0x2f, 0x43, 0x1a,
+  0x39, 0x2e, 0x42, 0x16, 0x4d, 0x1e, 0x42, 0x13, 0x55, 0x1a, 0x42, 0x11,
+  0x59, 0x17, 0x42, 0x10, 0x5d, 0x15, 0x41, 0x0f, 0x60, 0x13, 0x42, 0x0e,
+  0x62, 0x12, 0x41, 0x0e, 0x64, 0x10, 0x41, 0x0e, 0x66, 0x0e, 0x42, 0x0d,
+  0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x41, 0x0d, 0x6a, 0x0d, 0x40, 0x0c,
+  0x6c, 0x0c, 0x40, 0x0b, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c,
+  0x6e, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b,
+  0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b,
+  0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x0b, 0x01,
+  0x30, 0x0c, 0x70, 0x0b, 0x09, 0x06, 0x2f, 0x0b, 0x70, 0x0b, 0x08, 0x09,
+  0x2d, 0x0b, 0x70, 0x0b, 0x07, 0x0b, 0x2c, 0x0b, 0x70, 0x0b, 0x07, 0x0c,
+  0x2b, 0x0b, 0x70, 0x0b, 0x07, 0x0c, 0x2b, 0x0c, 0x6e, 0x0c, 0x07, 0x0d,
+  0x2a, 0x0c, 0x6e, 0x0c, 0x07, 0x0e, 0x2a, 0x0b, 0x6d, 0x0c, 0x08, 0x0f,
+  0x29, 0x0c, 0x6c, 0x0c, 0x09, 0x0e, 0x29, 0x0d, 0x32, 0x06, 0x32, 0x0d,
+  0x0a, 0x0d, 0x2a, 0x0c, 0x31, 0x08, 0x30, 0x0d, 0x0c, 0x0c, 0x2a, 0x0d,
+  0x2f, 0x0a, 0x2f, 0x0d, 0x0d, 0x0a, 0x2c, 0x0d, 0x2e, 0x0a, 0x2e, 0x0d,
+  0x0f, 0x09, 0x2c, 0x0e, 0x2d, 0x0a, 0x2d, 0x0e, 0x10, 0x07, 0x2e, 0x0e,
+  0x2c, 0x0a, 0x2c, 0x0e, 0x13, 0x03, 0x30, 0x0f, 0x2b, 0x0a, 0x2b, 0x0f,
+  0x47, 0x10, 0x29, 0x0a, 0x29, 0x10, 0x49, 0x10, 0x29, 0x08, 0x28, 0x11,
+  0x4a, 0x13, 0x27, 0x06, 0x27, 0x12, 0x4c, 0x16, 0x4b, 0x17, 0x4d, 0x18,
+  0x0b, 0x06, 0x24, 0x06, 0x0b, 0x18, 0x4f, 0x17, 0x0a, 0x08, 0x22, 0x08,
+  0x0a, 0x17, 0x51, 0x16, 0x09, 0x0a, 0x20, 0x0a, 0x09, 0x16, 0x53, 0x15,
+  0x09, 0x0a, 0x20, 0x0a, 0x09, 0x14, 0x57, 0x13, 0x09, 0x0b, 0x1f, 0x0a,
+  0x09, 0x13, 0x59, 0x12, 0x09, 0x0b, 0x1f, 0x0a, 0x09, 0x12, 0x5c, 0x10,
+  0x09, 0x0a, 0x20, 0x0a, 0x09, 0x10, 0x60, 0x0e, 0x09, 0x0a, 0x20, 0x0a,
+  0x09, 0x0e, 0x64, 0x0c, 0x0a, 0x08, 0x22, 0x08, 0x0a, 0x0c, 0x69, 0x09,
+  0x0b, 0x06, 0x24, 0x06, 0x0b, 0x09, 0x71, 0x03, 0x0e, 0x03, 0x27, 0x02,
+  0x0e, 0x01, 0xe1, 0x02, 0x04, 0xbe, 0x01, 0x08, 0xbb, 0x01, 0x09, 0xbb,
+  0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x05, 0xac,
+  0x01, 0x02, 0x28, 0x02, 0x96, 0x01, 0x06, 0x24, 0x06, 0x93, 0x01, 0x08,
+  0x22, 0x08, 0x91, 0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01, 0x0a, 0x20, 0x0a,
+  0x90, 0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01,
+  0x0a, 0x20, 0x0a, 0x91, 0x01, 0x09, 0x20, 0x0a, 0x91, 0x01, 0x08, 0x22,
+  0x08, 0x94, 0x01, 0x05, 0x25, 0x04, 0xb3, 0x04, 0x04, 0xbe, 0x01, 0x08,
+  0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a,
+  0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08,
+  0xbe, 0x01, 0x04, 0xf8, 0x1a, 0x32, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x17,
+  0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d, 0x02, 0x16,
+  0x06, 0x13, 0x05, 0x01, 0x08, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05,
+  0x03, 0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x02, 0x09,
+  0x02, 0x08, 0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x04, 0x08, 0x05, 0x01,
+  0x02, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x01, 0x01, 0x08,
+  0x02, 0x12, 0x02, 0x01, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x02, 0x03,
+  0x01, 0x08, 0x04, 0x0c, 0x03, 0x0e, 0x03, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x03, 0x36, 0x02, 0x1b, 0x01, 0x1f, 0x01, 0x06, 0x01, 0x3b, 0x01, 0x74,
+  0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c,
+  0x03, 0x1f, 0x05, 0x18, 0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x03, 0x16,
+  0x05, 0x3b, 0x04, 0x2e, 0x08, 0x07, 0x02, 0x2d, 0x0c, 0x28, 0x08, 0x03,
+  0x0e, 0x25, 0x12, 0x04, 0x06, 0x22, 0x12, 0x08, 0x05, 0x20, 0x08, 0x02,
+  0x08, 0x0a, 0x05, 0x1e, 0x06, 0x08, 0x06, 0x0a, 0x04, 0x1d, 0x05, 0x0c,
+  0x04, 0x0b, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b, 0x04, 0x10,
+  0x03, 0x0a, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10, 0x04, 0x09, 0x04, 0x04,
+  0x08, 0x0f, 0x03, 0x12, 0x03, 0x09, 0x04, 0x04, 0x07, 0x0e, 0x05, 0x12,
+  0x08, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x16,
+  0x08, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x15,
+  0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15,
+  0x03, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x04,
+  0x01, 0x0f, 0x04, 0x25, 0x03, 0x03, 0x03, 0x0f, 0x03, 0x24, 0x04, 0x03,
+  0x04, 0x0e, 0x04, 0x11, 0x01, 0x11, 0x04, 0x03, 0x04, 0x0e, 0x05, 0x0f,
+  0x03, 0x0f, 0x05, 0x04, 0x03, 0x0f, 0x05, 0x0e, 0x03, 0x0e, 0x05, 0x18,
+  0x05, 0x0d, 0x03, 0x0c, 0x06, 0x19, 0x08, 0x04, 0x02, 0x0b, 0x02, 0x04,
+  0x07, 0x1c, 0x06, 0x03, 0x03, 0x0b, 0x03, 0x03, 0x06, 0x1e, 0x05, 0x03,
+  0x03, 0x0b, 0x03, 0x03, 0x05, 0x23, 0x01, 0x04, 0x01, 0x0d, 0x01, 0x04,
+  0x01, 0x31, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3e, 0x01, 0x36, 0x03, 0x0b,
+  0x03, 0x2f, 0x04, 0x0a, 0x03, 0x2f, 0x03, 0x0b, 0x03, 0x75, 0x03, 0x3d,
+  0x03, 0x3d, 0x03, 0xa8, 0x03, 0x8a, 0x0a, 0x04, 0xbf, 0x01, 0x07, 0xbc,
+  0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0x90, 0x01, 0x04, 0x25, 0x0b, 0x26, 0x05, 0x63, 0x08, 0x24,
+  0x0a, 0x24, 0x08, 0x61, 0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x60, 0x0b, 0x23,
+  0x08, 0x23, 0x0b, 0x5f, 0x0d, 0x23, 0x06, 0x23, 0x0d, 0x5e, 0x0e, 0x4a,
+  0x0e, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0f, 0x48, 0x0e, 0x60, 0x0e, 0x47,
+  0x0f, 0x61, 0x0d, 0x46, 0x0f, 0x63, 0x0c, 0x45, 0x0f, 0x65, 0x0b, 0x44,
+  0x0f, 0x67, 0x0a, 0x43, 0x0f, 0x69, 0x08, 0x44, 0x0e, 0x6b, 0x06, 0x45,
+  0x0d, 0xb7, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0x92, 0x01, 0x0f, 0x18, 0x0a,
+  0x90, 0x01, 0x16, 0x15, 0x08, 0x8e, 0x01, 0x1c, 0x13, 0x06, 0x8d, 0x01,
+  0x20, 0xa3, 0x01, 0x23, 0x9f, 0x01, 0x26, 0x9d, 0x01, 0x29, 0x7c, 0x10,
+  0x0d, 0x2c, 0x77, 0x18, 0x08, 0x2e, 0x74, 0x1d, 0x04, 0x30, 0x70, 0x22,
+  0x01, 0x32, 0x6d, 0x38, 0x0c, 0x14, 0x6b, 0x36, 0x12, 0x12, 0x68, 0x36,
+  0x16, 0x11, 0x66, 0x35, 0x1a, 0x0f, 0x64, 0x36, 0x1c, 0x0f, 0x62, 0x36,
+  0x1e, 0x0f, 0x60, 0x36, 0x20, 0x0e, 0x5f, 0x15, 0x0f, 0x14, 0x20, 0x0e,
+  0x5d, 0x13, 0x15, 0x12, 0x20, 0x0d, 0x5c, 0x12, 0x19, 0x11, 0x20, 0x0d,
+  0x5b, 0x10, 0x1d, 0x10, 0x20, 0x0c, 0x5a, 0x0f, 0x20, 0x10, 0x1f, 0x0c,
+  0x59, 0x0f, 0x23, 0x0e, 0x20, 0x0c, 0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c,
+  0x57, 0x0e, 0x27, 0x0d, 0x20, 0x0b, 0x56, 0x0e, 0x29, 0x0d, 0x1f, 0x0b,
+  0x56, 0x0d, 0x2b, 0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2d, 0x0c, 0x1e, 0x0c,
+  0x0f, 0x11, 0x34, 0x0d, 0x2d, 0x0d, 0x1e, 0x0b, 0x0d, 0x15, 0x31, 0x0d,
+  0x2f, 0x0c, 0x1e, 0x0b, 0x0c, 0x17, 0x30, 0x0c, 0x31, 0x0b, 0x1e, 0x0b,
+  0x0c, 0x17, 0x2f, 0x0d, 0x31, 0x0c, 0x1d, 0x0b, 0x0b, 0x19, 0x2e, 0x0c,
+  0x33, 0x0b, 0x1d, 0x0b, 0x0b, 0x19, 0x2e, 0x0c, 0x33, 0x0b, 0x1d, 0x0b,
+  0x0b, 0x19, 0x2e, 0x0b, 0x34, 0x0c, 0x1c, 0x0b, 0x0b, 0x18, 0x2e, 0x0c,
+  0x35, 0x0f, 0x18, 0x0b, 0x0c, 0x17, 0x2d, 0x0d, 0x35, 0x16, 0x11, 0x0b,
+  0x0d, 0x15, 0x2b, 0x10, 0x35, 0x19, 0x0d, 0x0c, 0x0e, 0x13, 0x29, 0x12,
+  0x37, 0x1a, 0x0b, 0x0c, 0x49, 0x13, 0x37, 0x1c, 0x09, 0x0c, 0x47, 0x15,
+  0x37, 0x1d, 0x08, 0x0b, 0x46, 0x17, 0x37, 0x1f, 0x05, 0x0c, 0x45, 0x18,
+  0x37, 0x20, 0x04, 0x0c, 0x44, 0x19, 0x37, 0x21, 0x02, 0x0d, 0x43, 0x19,
+  0x38, 0x2f, 0x43, 0x1a, 0x39, 0x2e, 0x42, 0x16, 0x4d, 0x1e, 0x42, 0x13,
+  0x55, 0x1a, 0x42, 0x11, 0x59, 0x17, 0x42, 0x10, 0x5d, 0x15, 0x41, 0x0f,
+  0x60, 0x13, 0x42, 0x0e, 0x62, 0x12, 0x41, 0x0e, 0x64, 0x10, 0x41, 0x0e,
+  0x66, 0x0e, 0x42, 0x0d, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x41, 0x0d,
+  0x6a, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0b, 0x6d, 0x0c, 0x3f, 0x0c,
+  0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b,
+  0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c,
+  0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b,
+  0x71, 0x0c, 0x0b, 0x01, 0x30, 0x0c, 0x70, 0x0b, 0x09, 0x06, 0x2f, 0x0b,
+  0x70, 0x0b, 0x08, 0x09, 0x2d, 0x0b, 0x70, 0x0b, 0x07, 0x0b, 0x2c, 0x0b,
+  0x70, 0x0b, 0x07, 0x0c, 0x2b, 0x0b, 0x70, 0x0b, 0x07, 0x0c, 0x2b, 0x0c,
+  0x6e, 0x0c, 0x07, 0x0d, 0x2a, 0x0c, 0x6e, 0x0c, 0x07, 0x0e, 0x2a, 0x0b,
+  0x6d, 0x0c, 0x08, 0x0f, 0x29, 0x0c, 0x6c, 0x0c, 0x09, 0x0e, 0x29, 0x0d,
+  0x32, 0x06, 0x32, 0x0d, 0x0a, 0x0d, 0x2a, 0x0c, 0x31, 0x08, 0x30, 0x0d,
+  0x0c, 0x0c, 0x2a, 0x0d, 0x2f, 0x0a, 0x2f, 0x0d, 0x0d, 0x0a, 0x2c, 0x0d,
+  0x2e, 0x0a, 0x2e, 0x0d, 0x0f, 0x09, 0x2c, 0x0e, 0x2d, 0x0a, 0x2d, 0x0e,
+  0x10, 0x07, 0x2e, 0x0e, 0x2c, 0x0a, 0x2c, 0x0e, 0x13, 0x03, 0x30, 0x0f,
+  0x2b, 0x0a, 0x2b, 0x0f, 0x47, 0x10, 0x29, 0x0a, 0x29, 0x10, 0x49, 0x10,
+  0x29, 0x08, 0x28, 0x11, 0x4a, 0x13, 0x27, 0x06, 0x27, 0x12, 0x4c, 0x16,
+  0x4b, 0x17, 0x4d, 0x18, 0x0b, 0x06, 0x24, 0x06, 0x0b, 0x18, 0x4f, 0x17,
+  0x0a, 0x08, 0x22, 0x08, 0x0a, 0x17, 0x51, 0x16, 0x09, 0x0a, 0x20, 0x0a,
+  0x09, 0x16, 0x53, 0x15, 0x09, 0x0a, 0x20, 0x0a, 0x09, 0x14, 0x57, 0x13,
+  0x09, 0x0b, 0x1f, 0x0a, 0x09, 0x13, 0x59, 0x12, 0x09, 0x0b, 0x1f, 0x0a,
+  0x09, 0x12, 0x5c, 0x10, 0x09, 0x0a, 0x20, 0x0a, 0x09, 0x10, 0x60, 0x0e,
+  0x09, 0x0a, 0x20, 0x0a, 0x09, 0x0e, 0x64, 0x0c, 0x0a, 0x08, 0x22, 0x08,
+  0x0a, 0x0c, 0x69, 0x09, 0x0b, 0x06, 0x24, 0x06, 0x0b, 0x09, 0x71, 0x03,
+  0x0e, 0x03, 0x27, 0x02, 0x0e, 0x01, 0xde, 0x02, 0x04, 0xbf, 0x01, 0x07,
+  0xbc, 0x01, 0x09, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xbb, 0x01, 0x09, 0xbb, 0x01, 0x08,
+  0xbe, 0x01, 0x05, 0xa9, 0x01, 0x01, 0x29, 0x01, 0x96, 0x01, 0x07, 0x23,
+  0x07, 0x92, 0x01, 0x09, 0x21, 0x09, 0x91, 0x01, 0x09, 0x20, 0x0a, 0x90,
+  0x01, 0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b,
+  0x1f, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x90, 0x01, 0x09, 0x21, 0x09,
+  0x92, 0x01, 0x07, 0x23, 0x07, 0x94, 0x01, 0x05, 0x25, 0x05, 0xaf, 0x04,
+  0x05, 0xbe, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x09, 0xbc, 0x01, 0x07, 0xbf, 0x01, 0x04, 0x80, 0x1b, 0x32, 0x02, 0x1e,
+  0x02, 0x1e, 0x02, 0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c,
+  0x02, 0x1d, 0x02, 0x16, 0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f,
+  0x02, 0x06, 0x02, 0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03,
+  0x02, 0x09, 0x02, 0x08, 0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x03, 0x09,
+  0x05, 0x02, 0x01, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a,
+  0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x01, 0x04, 0x04, 0x06,
+  0x01, 0x04, 0x02, 0x01, 0x01, 0x08, 0x02, 0x03, 0x03, 0x06, 0x02, 0x04,
+  0x02, 0x01, 0x02, 0x07, 0x03, 0x01, 0x04, 0x06, 0x02, 0x03, 0x02, 0x03,
+  0x01, 0x08, 0x06, 0x0a, 0x03, 0x0e, 0x05, 0x03, 0x02, 0x04, 0x03, 0x10,
+  0x05, 0x02, 0x02, 0x01, 0x01, 0x15, 0x05, 0x05, 0x02, 0x16, 0x02, 0x06,
+  0x02, 0x16, 0x01, 0x1e, 0x02, 0x03, 0x01, 0x1a, 0x01, 0x03, 0x02, 0x74,
+  0xa4, 0x01, 0x03, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f, 0x04, 0x0c, 0x02, 0x0c,
+  0x04, 0x1e, 0x05, 0x18, 0x04, 0x20, 0x04, 0x17, 0x05, 0x21, 0x02, 0x17,
+  0x05, 0x30, 0x02, 0x09, 0x04, 0x2d, 0x0a, 0x06, 0x01, 0x2d, 0x0d, 0x27,
+  0x09, 0x02, 0x10, 0x23, 0x13, 0x04, 0x06, 0x22, 0x12, 0x08, 0x05, 0x20,
+  0x07, 0x04, 0x07, 0x0a, 0x05, 0x1e, 0x05, 0x09, 0x06, 0x0a, 0x04, 0x1d,
+  0x05, 0x0c, 0x05, 0x0a, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a, 0x04, 0x1b,
+  0x04, 0x10, 0x04, 0x09, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10, 0x04, 0x09,
+  0x04, 0x04, 0x08, 0x0e, 0x04, 0x11, 0x05, 0x08, 0x04, 0x04, 0x08, 0x0c,
+  0x06, 0x12, 0x08, 0x04, 0x04, 0x06, 0x04, 0x0c, 0x08, 0x12, 0x0a, 0x02,
+  0x04, 0x15, 0x09, 0x12, 0x0f, 0x15, 0x06, 0x1c, 0x09, 0x15, 0x05, 0x1f,
+  0x06, 0x15, 0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x03, 0x24,
+  0x04, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x04, 0x13, 0x04, 0x08,
+  0x06, 0x0d, 0x02, 0x08, 0x04, 0x03, 0x01, 0x0f, 0x04, 0x07, 0x07, 0x0c,
+  0x04, 0x07, 0x03, 0x03, 0x03, 0x0e, 0x04, 0x07, 0x07, 0x0c, 0x04, 0x06,
+  0x04, 0x03, 0x04, 0x0e, 0x04, 0x05, 0x07, 0x0d, 0x03, 0x07, 0x04, 0x03,
+  0x05, 0x0d, 0x04, 0x05, 0x07, 0x0d, 0x03, 0x06, 0x05, 0x04, 0x03, 0x0f,
+  0x05, 0x03, 0x06, 0x0e, 0x03, 0x05, 0x05, 0x17, 0x06, 0x01, 0x06, 0x16,
+  0x05, 0x19, 0x0c, 0x07, 0x02, 0x0a, 0x07, 0x1b, 0x0a, 0x07, 0x04, 0x09,
+  0x06, 0x1e, 0x08, 0x07, 0x04, 0x09, 0x05, 0x21, 0x06, 0x07, 0x03, 0x0a,
+  0x02, 0x23, 0x0b, 0x03, 0x03, 0x03, 0x03, 0x29, 0x0a, 0x05, 0x01, 0x04,
+  0x04, 0x28, 0x09, 0x0b, 0x03, 0x2d, 0x05, 0x0b, 0x03, 0x2d, 0x04, 0x0c,
+  0x03, 0x2c, 0x04, 0x3c, 0x03, 0x06, 0x02, 0x35, 0x02, 0x06, 0x04, 0x33,
+  0x03, 0x06, 0x04, 0x33, 0x02, 0x07, 0x04, 0x33, 0x01, 0x08, 0x03, 0x33,
+  0x01, 0x09, 0x03, 0xe8, 0x02, 0xc7, 0x08, 0x02, 0xc0, 0x01, 0x06, 0xbd,
+  0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0x90, 0x01, 0x01, 0x27, 0x0c, 0x27, 0x01, 0x65, 0x07, 0x25,
+  0x0a, 0x26, 0x06, 0x61, 0x09, 0x24, 0x0a, 0x24, 0x09, 0x5f, 0x0b, 0x23,
+  0x0a, 0x23, 0x0b, 0x5e, 0x0c, 0x23, 0x08, 0x23, 0x0c, 0x5e, 0x0d, 0x24,
+  0x05, 0x23, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e, 0x0e, 0x49, 0x0f, 0x5e,
+  0x0f, 0x47, 0x10, 0x5f, 0x0e, 0x46, 0x10, 0x61, 0x0d, 0x45, 0x10, 0x63,
+  0x0c, 0x44, 0x10, 0x65, 0x0b, 0x44, 0x0f, 0x67, 0x09, 0x44, 0x0f, 0x69,
+  0x07, 0x45, 0x0e, 0x6c, 0x04, 0x46, 0x0d, 0xb7, 0x01, 0x0c, 0x94, 0x01,
+  0x0a, 0x1a, 0x0b, 0x91, 0x01, 0x13, 0x16, 0x09, 0x8f, 0x01, 0x18, 0x15,
+  0x07, 0x8d, 0x01, 0x1e, 0x13, 0x05, 0x8c, 0x01, 0x22, 0xa1, 0x01, 0x24,
+  0x9e, 0x01, 0x28, 0x7f, 0x0c, 0x10, 0x2a, 0x79, 0x16, 0x0a, 0x2c, 0x75,
+  0x1c, 0x06, 0x2e, 0x72, 0x20, 0x03, 0x31, 0x6e, 0x56, 0x6c, 0x38, 0x0e,
+  0x13, 0x69, 0x38, 0x12, 0x12, 0x67, 0x37, 0x16, 0x11, 0x65, 0x36, 0x1a,
+  0x10, 0x62, 0x37, 0x1c, 0x0f, 0x61, 0x37, 0x1f, 0x0e, 0x5f, 0x17, 0x0a,
+  0x17, 0x20, 0x0d, 0x5e, 0x14, 0x12, 0x14, 0x20, 0x0d, 0x5c, 0x13, 0x16,
+  0x13, 0x1f, 0x0d, 0x5b, 0x12, 0x1a, 0x11, 0x20, 0x0d, 0x5a, 0x10, 0x1e,
+  0x10, 0x20, 0x0c, 0x59, 0x10, 0x20, 0x10, 0x1f, 0x0d, 0x57, 0x0f, 0x24,
+  0x0f, 0x1f, 0x0c, 0x57, 0x0e, 0x26, 0x0e, 0x1f, 0x0c, 0x56, 0x0e, 0x28,
+  0x0e, 0x1f, 0x0b, 0x55, 0x0e, 0x2a, 0x0d, 0x1f, 0x0c, 0x54, 0x0d, 0x2c,
+  0x0d, 0x1e, 0x0c, 0x53, 0x0e, 0x2d, 0x0c, 0x1f, 0x0b, 0x0f, 0x12, 0x32,
+  0x0d, 0x2e, 0x0d, 0x1e, 0x0b, 0x0d, 0x15, 0x31, 0x0c, 0x30, 0x0c, 0x1e,
+  0x0b, 0x0d, 0x16, 0x2f, 0x0d, 0x31, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2e,
+  0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2d, 0x0d, 0x33, 0x0b, 0x1d,
+  0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x34, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d,
+  0x0c, 0x34, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x35, 0x13, 0x14,
+  0x0b, 0x0c, 0x17, 0x2b, 0x0e, 0x36, 0x17, 0x10, 0x0b, 0x0d, 0x16, 0x28,
+  0x11, 0x36, 0x1a, 0x0d, 0x0b, 0x0f, 0x12, 0x28, 0x13, 0x36, 0x1c, 0x0b,
+  0x0b, 0x47, 0x15, 0x37, 0x1d, 0x08, 0x0c, 0x46, 0x15, 0x38, 0x1e, 0x07,
+  0x0c, 0x44, 0x17, 0x38, 0x20, 0x05, 0x0b, 0x44, 0x18, 0x38, 0x21, 0x03,
+  0x0c, 0x43, 0x19, 0x38, 0x22, 0x02, 0x0c, 0x42, 0x1a, 0x38, 0x2f, 0x42,
+  0x1a, 0x3a, 0x2e, 0x41, 0x15, 0x50, 0x1e, 0x40, 0x12, 0x57, 0x1a, 0x41,
+  0x10, 0x5b, 0x18, 0x40, 0x10, 0x5e, 0x15, 0x40, 0x0f, 0x61, 0x13, 0x41,
+  0x0e, 0x63, 0x12, 0x40, 0x0e, 0x65, 0x10, 0x41, 0x0d, 0x67, 0x0e, 0x41,
+  0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x3f,
+  0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x6f, 0x0c, 0x3d,
+  0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c,
+  0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x18, 0x15, 0x26,
+  0x05, 0x19, 0x0c, 0x3c, 0x0b, 0x17, 0x16, 0x25, 0x08, 0x17, 0x0c, 0x09,
+  0x05, 0x2e, 0x0b, 0x17, 0x15, 0x25, 0x0a, 0x16, 0x0c, 0x07, 0x09, 0x2c,
+  0x0b, 0x16, 0x16, 0x25, 0x0a, 0x16, 0x0b, 0x08, 0x0a, 0x2b, 0x0c, 0x15,
+  0x15, 0x25, 0x0b, 0x16, 0x0b, 0x07, 0x0c, 0x2a, 0x0c, 0x15, 0x15, 0x25,
+  0x0b, 0x16, 0x0b, 0x07, 0x0d, 0x2a, 0x0b, 0x14, 0x15, 0x26, 0x0b, 0x15,
+  0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x13, 0x15, 0x25, 0x0c, 0x15, 0x0c, 0x07,
+  0x0e, 0x29, 0x0c, 0x12, 0x15, 0x26, 0x0c, 0x14, 0x0c, 0x08, 0x0f, 0x28,
+  0x0c, 0x12, 0x15, 0x26, 0x0c, 0x14, 0x0c, 0x09, 0x0e, 0x29, 0x0c, 0x11,
+  0x14, 0x27, 0x0b, 0x14, 0x0d, 0x0a, 0x0d, 0x29, 0x0d, 0x0f, 0x15, 0x26,
+  0x0c, 0x14, 0x0c, 0x0c, 0x0c, 0x29, 0x0e, 0x0e, 0x14, 0x27, 0x0c, 0x13,
+  0x0d, 0x0d, 0x0b, 0x2a, 0x0d, 0x0e, 0x14, 0x28, 0x0a, 0x13, 0x0d, 0x0f,
+  0x09, 0x2b, 0x0e, 0x0c, 0x14, 0x29, 0x0a, 0x12, 0x0e, 0x10, 0x07, 0x2d,
+  0x0e, 0x0b, 0x13, 0x2a, 0x0a, 0x11, 0x0e, 0x13, 0x04, 0x2f, 0x0f, 0x08,
+  0x14, 0x2b, 0x08, 0x11, 0x0f, 0x46, 0x10, 0x07, 0x13, 0x2e, 0x04, 0x12,
+  0x0f, 0x48, 0x11, 0x05, 0x13, 0x42, 0x10, 0x4a, 0x12, 0x02, 0x13, 0x41,
+  0x12, 0x4b, 0x26, 0x15, 0x04, 0x24, 0x15, 0x4c, 0x25, 0x15, 0x07, 0x1e,
+  0x18, 0x4e, 0x24, 0x14, 0x09, 0x1d, 0x17, 0x51, 0x21, 0x14, 0x0a, 0x1d,
+  0x16, 0x53, 0x20, 0x14, 0x0b, 0x1c, 0x15, 0x55, 0x1e, 0x15, 0x0b, 0x1c,
+  0x14, 0x57, 0x1d, 0x14, 0x0c, 0x1c, 0x12, 0x5b, 0x1a, 0x15, 0x0c, 0x1c,
+  0x10, 0x5f, 0x18, 0x15, 0x0b, 0x1d, 0x0f, 0x62, 0x15, 0x16, 0x0b, 0x1d,
+  0x0c, 0x68, 0x11, 0x16, 0x0c, 0x1d, 0x0a, 0x6a, 0x11, 0x16, 0x0b, 0x0d,
+  0x03, 0x0f, 0x04, 0x6e, 0x21, 0x07, 0x0b, 0x0b, 0x07, 0x7f, 0x21, 0x07,
+  0x0b, 0x0a, 0x09, 0x7e, 0x20, 0x08, 0x0b, 0x0a, 0x0a, 0x7c, 0x20, 0x0a,
+  0x09, 0x0a, 0x0b, 0x7c, 0x1f, 0x0b, 0x08, 0x0b, 0x0b, 0x7b, 0x20, 0x0d,
+  0x05, 0x0c, 0x0b, 0x7b, 0x1f, 0x1e, 0x0c, 0x7b, 0x1e, 0x1f, 0x0c, 0x7a,
+  0x1e, 0x20, 0x0c, 0x7a, 0x1d, 0x21, 0x0b, 0x7b, 0x1d, 0x20, 0x0c, 0x89,
+  0x01, 0x0e, 0x21, 0x0c, 0x89, 0x01, 0x0d, 0x23, 0x0b, 0x89, 0x01, 0x0c,
+  0x24, 0x0a, 0x89, 0x01, 0x0d, 0x24, 0x0a, 0x89, 0x01, 0x0c, 0x26, 0x08,
+  0x8a, 0x01, 0x0b, 0x28, 0x06, 0x8a, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0a, 0xb9, 0x01, 0x0a, 0x12, 0x06, 0xa2, 0x01, 0x09, 0x11, 0x09,
+  0xa1, 0x01, 0x08, 0x12, 0x09, 0xa0, 0x01, 0x09, 0x11, 0x0b, 0x9f, 0x01,
+  0x08, 0x12, 0x0b, 0x9f, 0x01, 0x07, 0x13, 0x0b, 0x9e, 0x01, 0x07, 0x13,
+  0x0c, 0x9e, 0x01, 0x07, 0x13, 0x0c, 0x9e, 0x01, 0x06, 0x14, 0x0b, 0x9e,
+  0x01, 0x06, 0x15, 0x0b, 0x9e, 0x01, 0x05, 0x16, 0x0b, 0x9e, 0x01, 0x05,
+  0x15, 0x0c, 0x9d, 0x01, 0x05, 0x16, 0x0b, 0x9e, 0x01, 0x04, 0x17, 0x0b,
+  0x9e, 0x01, 0x03, 0x19, 0x0a, 0x9d, 0x01, 0x03, 0x1b, 0x08, 0x9e, 0x01,
+  0x03, 0x1c, 0x06, 0x9f, 0x01, 0x02, 0x1f, 0x02, 0xfa, 0x17, 0xaf, 0x01,
+  0x02, 0x1e, 0x02, 0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c,
+  0x02, 0x11, 0x02, 0x0a, 0x02, 0x17, 0x04, 0x1a, 0x08, 0x17, 0x03, 0x04,
+  0x03, 0x16, 0x02, 0x06, 0x02, 0x16, 0x01, 0x08, 0x01, 0x10, 0x04, 0x01,
+  0x02, 0x08, 0x02, 0x01, 0x04, 0x0b, 0x02, 0x03, 0x01, 0x08, 0x01, 0x03,
+  0x02, 0x11, 0x02, 0x06, 0x02, 0x16, 0x03, 0x04, 0x03, 0x17, 0x08, 0x19,
+  0x06, 0x16, 0x02, 0x0a, 0x02, 0x11, 0x02, 0x0c, 0x02, 0x10, 0x01, 0x06,
+  0x02, 0x06, 0x01, 0x17, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0xaf, 0x01, 0xde,
+  0x04, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04,
+  0x2e, 0x03, 0x0b, 0x04, 0x0b, 0x03, 0x1f, 0x05, 0x18, 0x04, 0x20, 0x05,
+  0x16, 0x05, 0x21, 0x05, 0x14, 0x05, 0x23, 0x04, 0x14, 0x04, 0x25, 0x03,
+  0x07, 0x06, 0x07, 0x03, 0x2e, 0x0a, 0x34, 0x0e, 0x31, 0x10, 0x2f, 0x06,
+  0x06, 0x06, 0x2d, 0x05, 0x0a, 0x04, 0x2d, 0x04, 0x0c, 0x04, 0x2c, 0x03,
+  0x0e, 0x03, 0x2b, 0x04, 0x0e, 0x04, 0x20, 0x05, 0x05, 0x04, 0x0e, 0x04,
+  0x05, 0x05, 0x14, 0x08, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x07, 0x13, 0x08,
+  0x04, 0x04, 0x0f, 0x03, 0x04, 0x08, 0x13, 0x07, 0x04, 0x04, 0x0e, 0x04,
+  0x04, 0x07, 0x1f, 0x04, 0x0e, 0x04, 0x2a, 0x04, 0x0e, 0x04, 0x2b, 0x04,
+  0x0c, 0x04, 0x2c, 0x05, 0x0a, 0x05, 0x2d, 0x05, 0x08, 0x05, 0x2f, 0x06,
+  0x04, 0x06, 0x31, 0x0e, 0x33, 0x0c, 0x2d, 0x02, 0x07, 0x08, 0x07, 0x02,
+  0x25, 0x04, 0x14, 0x04, 0x23, 0x05, 0x14, 0x05, 0x21, 0x05, 0x16, 0x05,
+  0x20, 0x04, 0x18, 0x04, 0x20, 0x03, 0x0c, 0x02, 0x0c, 0x03, 0x20, 0x02,
+  0x0c, 0x04, 0x0c, 0x02, 0x2e, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04,
+  0x3c, 0x04, 0x3d, 0x02, 0x9f, 0x05, 0xc8, 0x28, 0x04, 0xbe, 0x01, 0x08,
+  0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0x8e, 0x01, 0x06, 0x24, 0x0c, 0x24, 0x06, 0x63, 0x08,
+  0x24, 0x0a, 0x24, 0x08, 0x61, 0x0a, 0x23, 0x0a, 0x23, 0x0a, 0x60, 0x0b,
+  0x23, 0x08, 0x23, 0x0b, 0x5f, 0x0d, 0x23, 0x06, 0x23, 0x0d, 0x5e, 0x0e,
+  0x4a, 0x0e, 0x5e, 0x0f, 0x48, 0x0f, 0x5f, 0x0f, 0x46, 0x0f, 0x60, 0x10,
+  0x44, 0x10, 0x61, 0x10, 0x42, 0x10, 0x63, 0x10, 0x40, 0x10, 0x65, 0x10,
+  0x3f, 0x0f, 0x67, 0x0f, 0x3e, 0x0f, 0x69, 0x0f, 0x3d, 0x0e, 0x6b, 0x0e,
+  0x3c, 0x0e, 0x6d, 0x0d, 0x3c, 0x0d, 0x6f, 0x0b, 0x3e, 0x0b, 0x71, 0x0a,
+  0x17, 0x10, 0x17, 0x0a, 0x73, 0x08, 0x15, 0x16, 0x15, 0x08, 0x75, 0x06,
+  0x13, 0x1c, 0x13, 0x05, 0x8e, 0x01, 0x20, 0xa2, 0x01, 0x23, 0xa0, 0x01,
+  0x26, 0x9c, 0x01, 0x29, 0x9a, 0x01, 0x2c, 0x97, 0x01, 0x2e, 0x95, 0x01,
+  0x30, 0x93, 0x01, 0x32, 0x91, 0x01, 0x14, 0x0c, 0x14, 0x8f, 0x01, 0x12,
+  0x12, 0x12, 0x8d, 0x01, 0x11, 0x16, 0x10, 0x8d, 0x01, 0x0f, 0x1a, 0x0f,
+  0x8b, 0x01, 0x0f, 0x1c, 0x0f, 0x8a, 0x01, 0x0e, 0x1e, 0x0e, 0x89, 0x01,
+  0x0e, 0x20, 0x0e, 0x87, 0x01, 0x0e, 0x22, 0x0d, 0x87, 0x01, 0x0d, 0x24,
+  0x0d, 0x85, 0x01, 0x0d, 0x26, 0x0c, 0x85, 0x01, 0x0c, 0x28, 0x0c, 0x84,
+  0x01, 0x0c, 0x28, 0x0c, 0x83, 0x01, 0x0c, 0x2a, 0x0b, 0x83, 0x01, 0x0c,
+  0x2a, 0x0c, 0x82, 0x01, 0x0b, 0x2c, 0x0b, 0x82, 0x01, 0x0b, 0x2c, 0x0b,
+  0x81, 0x01, 0x0c, 0x2c, 0x0b, 0x61, 0x12, 0x0e, 0x0c, 0x2d, 0x0a, 0x0f,
+  0x12, 0x3e, 0x15, 0x0d, 0x0b, 0x2e, 0x0b, 0x0d, 0x14, 0x3c, 0x17, 0x0c,
+  0x0b, 0x2e, 0x0b, 0x0c, 0x16, 0x3b, 0x17, 0x0c, 0x0b, 0x2e, 0x0b, 0x0c,
+  0x17, 0x3a, 0x18, 0x0b, 0x0b, 0x2e, 0x0b, 0x0b, 0x18, 0x3a, 0x18, 0x0b,
+  0x0b, 0x2e, 0x0b, 0x0b, 0x18, 0x3a, 0x18, 0x0b, 0x0b, 0x2e, 0x0b, 0x0b,
+  0x18, 0x3a, 0x17, 0x0c, 0x0b, 0x2e, 0x0b, 0x0c, 0x17, 0x3a, 0x17, 0x0c,
+  0x0b, 0x2e, 0x0b, 0x0c, 0x16, 0x3c, 0x15, 0x0d, 0x0b, 0x2e, 0x0b, 0x0d,
+  0x15, 0x3e, 0x12, 0x0e, 0x0c, 0x2d, 0x0b, 0x0e, 0x12, 0x60, 0x0c, 0x2c,
+  0x0b, 0x82, 0x01, 0x0b, 0x2c, 0x0b, 0x82, 0x01, 0x0b, 0x2c, 0x0b, 0x82,
+  0x01, 0x0c, 0x2a, 0x0c, 0x82, 0x01, 0x0c, 0x2a, 0x0b, 0x84, 0x01, 0x0c,
+  0x28, 0x0c, 0x84, 0x01, 0x0c, 0x28, 0x0c, 0x84, 0x01, 0x0d, 0x26, 0x0c,
+  0x86, 0x01, 0x0d, 0x24, 0x0d, 0x86, 0x01, 0x0d, 0x24, 0x0c, 0x88, 0x01,
+  0x0d, 0x22, 0x0d, 0x88, 0x01, 0x0e, 0x20, 0x0d, 0x8a, 0x01, 0x0f, 0x1c,
+  0x0f, 0x8b, 0x01, 0x0f, 0x1a, 0x0f, 0x8c, 0x01, 0x10, 0x18, 0x0f, 0x8e,
+  0x01, 0x11, 0x14, 0x11, 0x8f, 0x01, 0x13, 0x0e, 0x13, 0x91, 0x01, 0x16,
+  0x06, 0x16, 0x93, 0x01, 0x30, 0x95, 0x01, 0x2e, 0x97, 0x01, 0x2c, 0x99,
+  0x01, 0x2a, 0x9c, 0x01, 0x26, 0x9f, 0x01, 0x24, 0xa2, 0x01, 0x20, 0x8e,
+  0x01, 0x05, 0x13, 0x1c, 0x13, 0x05, 0x76, 0x08, 0x14, 0x18, 0x14, 0x07,
+  0x74, 0x0a, 0x16, 0x12, 0x16, 0x0a, 0x71, 0x0b, 0x1d, 0x04, 0x1d, 0x0b,
+  0x6f, 0x0d, 0x3d, 0x0c, 0x6d, 0x0e, 0x3c, 0x0e, 0x6b, 0x0f, 0x3d, 0x0e,
+  0x69, 0x0f, 0x3e, 0x0f, 0x67, 0x10, 0x3e, 0x10, 0x65, 0x10, 0x40, 0x10,
+  0x63, 0x10, 0x42, 0x10, 0x61, 0x10, 0x44, 0x10, 0x60, 0x0f, 0x46, 0x0f,
+  0x5f, 0x0f, 0x48, 0x0e, 0x5f, 0x0e, 0x4a, 0x0e, 0x5e, 0x0d, 0x23, 0x06,
+  0x23, 0x0d, 0x5f, 0x0b, 0x23, 0x08, 0x23, 0x0b, 0x60, 0x0a, 0x23, 0x0a,
+  0x23, 0x0a, 0x61, 0x08, 0x24, 0x0a, 0x24, 0x08, 0x63, 0x05, 0x25, 0x0b,
+  0x25, 0x06, 0x8e, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbe, 0x01, 0x04, 0x9c,
+  0x30, 0x30, 0x01, 0x1e, 0x02, 0x1e, 0x02, 0x1e, 0x02, 0x16, 0x02, 0x07,
+  0x01, 0x07, 0x02, 0x0d, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0b, 0x03, 0x10,
+  0x01, 0x04, 0x05, 0x19, 0x08, 0x17, 0x03, 0x04, 0x03, 0x16, 0x02, 0x07,
+  0x02, 0x14, 0x02, 0x08, 0x02, 0x0e, 0x03, 0x03, 0x02, 0x09, 0x02, 0x02,
+  0x03, 0x07, 0x04, 0x03, 0x04, 0x07, 0x02, 0x02, 0x04, 0x0c, 0x06, 0x05,
+  0x03, 0x11, 0x03, 0x02, 0x03, 0x04, 0x02, 0x11, 0x03, 0x04, 0x04, 0x01,
+  0x03, 0x10, 0x04, 0x05, 0x06, 0x10, 0x03, 0x09, 0x03, 0x11, 0x02, 0x0b,
+  0x02, 0x02, 0x02, 0x0d, 0x02, 0x0b, 0x02, 0x02, 0x03, 0x0d, 0x02, 0x09,
+  0x03, 0x03, 0x03, 0x0c, 0x0d, 0x05, 0x01, 0x0f, 0x09, 0xef, 0x01, 0xdf,
+  0x01, 0x03, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04,
+  0x3c, 0x04, 0x2b, 0x04, 0x0d, 0x04, 0x0d, 0x03, 0x1b, 0x05, 0x0d, 0x01,
+  0x0e, 0x05, 0x1a, 0x06, 0x1a, 0x06, 0x1b, 0x05, 0x19, 0x06, 0x1d, 0x05,
+  0x17, 0x06, 0x1f, 0x04, 0x17, 0x05, 0x21, 0x03, 0x08, 0x08, 0x08, 0x03,
+  0x2a, 0x0d, 0x32, 0x0f, 0x30, 0x12, 0x2d, 0x07, 0x06, 0x06, 0x2c, 0x06,
+  0x0a, 0x05, 0x2a, 0x06, 0x0c, 0x05, 0x29, 0x05, 0x0e, 0x04, 0x29, 0x04,
+  0x0f, 0x05, 0x27, 0x05, 0x10, 0x04, 0x27, 0x04, 0x11, 0x04, 0x1a, 0x07,
+  0x06, 0x04, 0x11, 0x04, 0x05, 0x07, 0x0e, 0x07, 0x06, 0x07, 0x0e, 0x04,
+  0x05, 0x07, 0x0e, 0x07, 0x06, 0x09, 0x0c, 0x04, 0x05, 0x07, 0x0f, 0x05,
+  0x05, 0x0c, 0x0b, 0x04, 0x06, 0x05, 0x19, 0x0e, 0x0a, 0x04, 0x24, 0x06,
+  0x03, 0x06, 0x08, 0x05, 0x23, 0x05, 0x06, 0x06, 0x07, 0x04, 0x24, 0x04,
+  0x08, 0x06, 0x05, 0x05, 0x22, 0x06, 0x09, 0x08, 0x01, 0x05, 0x22, 0x07,
+  0x09, 0x0e, 0x21, 0x07, 0x0a, 0x0d, 0x21, 0x06, 0x10, 0x08, 0x22, 0x05,
+  0x13, 0x05, 0x22, 0x05, 0x15, 0x04, 0x05, 0x02, 0x1b, 0x05, 0x15, 0x04,
+  0x04, 0x05, 0x19, 0x05, 0x15, 0x04, 0x04, 0x06, 0x19, 0x04, 0x15, 0x04,
+  0x05, 0x06, 0x18, 0x05, 0x13, 0x05, 0x06, 0x05, 0x18, 0x1c, 0x08, 0x05,
+  0x18, 0x1b, 0x09, 0x03, 0x1a, 0x19, 0x0b, 0x01, 0x1c, 0x16, 0xdc, 0x07,
+  0x81, 0x0d, 0x06, 0xbd, 0x01, 0x09, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d,
+  0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d,
+  0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d,
+  0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0d,
+  0xb7, 0x01, 0x0d, 0x87, 0x01, 0x04, 0x2c, 0x0d, 0x2b, 0x04, 0x56, 0x08,
+  0x2a, 0x0c, 0x2a, 0x08, 0x53, 0x0a, 0x29, 0x0c, 0x29, 0x0a, 0x52, 0x0b,
+  0x29, 0x0b, 0x28, 0x0c, 0x50, 0x0d, 0x28, 0x0a, 0x28, 0x0d, 0x50, 0x0e,
+  0x29, 0x07, 0x28, 0x0e, 0x50, 0x0f, 0x2a, 0x03, 0x29, 0x0f, 0x50, 0x10,
+  0x54, 0x10, 0x50, 0x11, 0x52, 0x11, 0x51, 0x11, 0x50, 0x12, 0x51, 0x12,
+  0x4e, 0x12, 0x53, 0x12, 0x4c, 0x12, 0x55, 0x12, 0x4a, 0x12, 0x57, 0x12,
+  0x48, 0x12, 0x59, 0x11, 0x48, 0x11, 0x5b, 0x11, 0x46, 0x11, 0x5d, 0x10,
+  0x46, 0x10, 0x5f, 0x0f, 0x46, 0x0f, 0x61, 0x0e, 0x46, 0x0e, 0x63, 0x0d,
+  0x22, 0x02, 0x22, 0x0d, 0x65, 0x0b, 0x1b, 0x12, 0x1b, 0x0b, 0x67, 0x0a,
+  0x17, 0x19, 0x18, 0x0a, 0x69, 0x08, 0x16, 0x1e, 0x16, 0x08, 0x6c, 0x04,
+  0x16, 0x22, 0x16, 0x04, 0x86, 0x01, 0x26, 0x9c, 0x01, 0x2a, 0x99, 0x01,
+  0x2c, 0x96, 0x01, 0x30, 0x93, 0x01, 0x32, 0x91, 0x01, 0x34, 0x8f, 0x01,
+  0x36, 0x8d, 0x01, 0x38, 0x8b, 0x01, 0x18, 0x0a, 0x18, 0x89, 0x01, 0x15,
+  0x12, 0x15, 0x87, 0x01, 0x14, 0x16, 0x14, 0x85, 0x01, 0x13, 0x1a, 0x13,
+  0x84, 0x01, 0x11, 0x1e, 0x11, 0x83, 0x01, 0x11, 0x20, 0x11, 0x81, 0x01,
+  0x11, 0x22, 0x11, 0x80, 0x01, 0x10, 0x24, 0x10, 0x7f, 0x10, 0x26, 0x10,
+  0x7e, 0x0f, 0x28, 0x0f, 0x7d, 0x0f, 0x2a, 0x0f, 0x7c, 0x0e, 0x2c, 0x0e,
+  0x7c, 0x0e, 0x2c, 0x0e, 0x7b, 0x0e, 0x2e, 0x0e, 0x7a, 0x0d, 0x2f, 0x0e,
+  0x7a, 0x0d, 0x30, 0x0e, 0x78, 0x0e, 0x30, 0x0e, 0x78, 0x0d, 0x32, 0x0d,
+  0x78, 0x0d, 0x32, 0x0d, 0x78, 0x0d, 0x32, 0x0e, 0x52, 0x0e, 0x16, 0x0d,
+  0x34, 0x0d, 0x12, 0x0e, 0x30, 0x13, 0x13, 0x0d, 0x34, 0x0d, 0x10, 0x12,
+  0x2d, 0x15, 0x12, 0x0d, 0x34, 0x0d, 0x0e, 0x15, 0x2b, 0x16, 0x12, 0x0d,
+  0x34, 0x0d, 0x0e, 0x16, 0x2a, 0x17, 0x11, 0x0d, 0x34, 0x0d, 0x0d, 0x18,
+  0x28, 0x18, 0x11, 0x10, 0x31, 0x0d, 0x0d, 0x18, 0x28, 0x18, 0x11, 0x15,
+  0x2c, 0x0d, 0x0d, 0x18, 0x28, 0x18, 0x11, 0x18, 0x29, 0x0d, 0x0d, 0x18,
+  0x28, 0x18, 0x11, 0x1a, 0x27, 0x0d, 0x0d, 0x18, 0x29, 0x16, 0x11, 0x1d,
+  0x25, 0x0d, 0x0e, 0x16, 0x2a, 0x16, 0x0f, 0x21, 0x23, 0x0d, 0x0e, 0x15,
+  0x2d, 0x13, 0x0f, 0x23, 0x22, 0x0d, 0x0f, 0x13, 0x2f, 0x10, 0x10, 0x25,
+  0x21, 0x0d, 0x11, 0x0f, 0x50, 0x27, 0x1f, 0x0e, 0x6f, 0x29, 0x1e, 0x0d,
+  0x6f, 0x2b, 0x1d, 0x0d, 0x6e, 0x2d, 0x1b, 0x0e, 0x6e, 0x2d, 0x1b, 0x0e,
+  0x6d, 0x13, 0x09, 0x13, 0x19, 0x0e, 0x6d, 0x12, 0x0d, 0x12, 0x18, 0x0e,
+  0x6d, 0x10, 0x11, 0x10, 0x17, 0x0f, 0x6c, 0x10, 0x13, 0x10, 0x16, 0x0e,
+  0x6d, 0x0f, 0x15, 0x0f, 0x15, 0x0f, 0x6d, 0x0e, 0x17, 0x0e, 0x14, 0x0f,
+  0x6d, 0x0e, 0x19, 0x12, 0x0e, 0x10, 0x6c, 0x0f, 0x19, 0x15, 0x0a, 0x10,
+  0x6b, 0x10, 0x1b, 0x16, 0x07, 0x11, 0x69, 0x12, 0x1b, 0x18, 0x04, 0x11,
+  0x68, 0x13, 0x1d, 0x18, 0x01, 0x12, 0x68, 0x14, 0x1d, 0x2b, 0x67, 0x15,
+  0x1d, 0x2a, 0x67, 0x16, 0x1d, 0x29, 0x67, 0x17, 0x1d, 0x28, 0x67, 0x18,
+  0x1d, 0x27, 0x68, 0x17, 0x1f, 0x25, 0x68, 0x18, 0x1f, 0x24, 0x68, 0x16,
+  0x23, 0x22, 0x69, 0x11, 0x35, 0x14, 0x69, 0x10, 0x38, 0x11, 0x6b, 0x0f,
+  0x3b, 0x0f, 0x6b, 0x0e, 0x3d, 0x0e, 0x6a, 0x0e, 0x3e, 0x0e, 0x6a, 0x0e,
+  0x3f, 0x0e, 0x0f, 0x07, 0x53, 0x0d, 0x41, 0x0d, 0x0e, 0x09, 0x52, 0x0d,
+  0x41, 0x0d, 0x0d, 0x0b, 0x51, 0x0d, 0x41, 0x0d, 0x0c, 0x0d, 0x50, 0x0d,
+  0x41, 0x0d, 0x0c, 0x0e, 0x4f, 0x0d, 0x41, 0x0d, 0x0c, 0x0f, 0x4e, 0x0d,
+  0x41, 0x0d, 0x0c, 0x10, 0x4d, 0x0d, 0x41, 0x0d, 0x0c, 0x11, 0x4c, 0x0d,
+  0x41, 0x0d, 0x0d, 0x11, 0x4b, 0x0e, 0x3f, 0x0e, 0x0d, 0x12, 0x4a, 0x0e,
+  0x3f, 0x0d, 0x0f, 0x12, 0x4a, 0x0e, 0x3d, 0x0e, 0x10, 0x12, 0x49, 0x0f,
+  0x3b, 0x0f, 0x11, 0x12, 0x48, 0x10, 0x39, 0x0f, 0x13, 0x12, 0x48, 0x10,
+  0x37, 0x10, 0x14, 0x11, 0x48, 0x13, 0x31, 0x13, 0x15, 0x10, 0x49, 0x55,
+  0x17, 0x0f, 0x49, 0x54, 0x19, 0x0e, 0x4a, 0x53, 0x1a, 0x0d, 0x4b, 0x51,
+  0x1c, 0x0c, 0x4c, 0x4f, 0x1e, 0x0a, 0x4e, 0x4d, 0x20, 0x08, 0x50, 0x4b,
+  0x23, 0x04, 0x53, 0x49, 0x7c, 0x47, 0x7f, 0x43, 0x83, 0x01, 0x3f, 0x87,
+  0x01, 0x3b, 0x90, 0x01, 0x2d, 0x90, 0x44, 0x32, 0x02, 0x1e, 0x02, 0x1e,
+  0x02, 0x17, 0x01, 0x06, 0x02, 0x06, 0x01, 0x10, 0x02, 0x0c, 0x02, 0x1d,
+  0x02, 0x16, 0x06, 0x13, 0x0e, 0x11, 0x09, 0x04, 0x03, 0x0f, 0x02, 0x05,
+  0x03, 0x05, 0x02, 0x0e, 0x02, 0x08, 0x02, 0x05, 0x01, 0x03, 0x02, 0x09,
+  0x02, 0x08, 0x02, 0x05, 0x02, 0x01, 0x04, 0x06, 0x03, 0x09, 0x05, 0x02,
+  0x01, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x03, 0x10, 0x03, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x03, 0x04, 0x02, 0x01, 0x03,
+  0x01, 0x04, 0x02, 0x01, 0x01, 0x08, 0x02, 0x03, 0x03, 0x03, 0x01, 0x02,
+  0x02, 0x04, 0x02, 0x01, 0x02, 0x07, 0x03, 0x01, 0x04, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x03, 0x01, 0x08, 0x06, 0x03, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x0e, 0x05, 0x03, 0x02, 0x01, 0x02, 0x01, 0x03, 0x10, 0x05, 0x01,
+  0x02, 0x02, 0x02, 0x14, 0x05, 0x01, 0x02, 0x02, 0x02, 0x16, 0x02, 0x02,
+  0x02, 0x02, 0x01, 0x17, 0x01, 0x03, 0x02, 0x19, 0x02, 0x02, 0x02, 0x1a,
+  0x01, 0x03, 0x02, 0x74, 0xa5, 0x01, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x3c, 0x04, 0x2e, 0x02, 0x0c, 0x04, 0x0c, 0x02, 0x1f,
+  0x04, 0x0c, 0x02, 0x0c, 0x03, 0x1f, 0x05, 0x18, 0x04, 0x20, 0x04, 0x17,
+  0x05, 0x21, 0x03, 0x16, 0x05, 0x3b, 0x04, 0x2d, 0x09, 0x07, 0x01, 0x2e,
+  0x0c, 0x28, 0x08, 0x02, 0x10, 0x24, 0x12, 0x04, 0x06, 0x22, 0x12, 0x08,
+  0x05, 0x20, 0x08, 0x02, 0x08, 0x0a, 0x05, 0x1e, 0x06, 0x08, 0x06, 0x0a,
+  0x04, 0x1d, 0x05, 0x0c, 0x04, 0x0b, 0x04, 0x1c, 0x04, 0x0e, 0x04, 0x0a,
+  0x04, 0x1b, 0x04, 0x0f, 0x05, 0x09, 0x04, 0x04, 0x07, 0x10, 0x04, 0x10,
+  0x04, 0x09, 0x04, 0x04, 0x08, 0x0e, 0x04, 0x11, 0x05, 0x08, 0x04, 0x04,
+  0x07, 0x0d, 0x06, 0x12, 0x08, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x07, 0x12,
+  0x0a, 0x02, 0x04, 0x15, 0x09, 0x12, 0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15,
+  0x05, 0x1f, 0x06, 0x15, 0x05, 0x21, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15,
+  0x03, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03, 0x14, 0x04, 0x25, 0x03, 0x14,
+  0x04, 0x08, 0x06, 0x06, 0x01, 0x06, 0x01, 0x09, 0x03, 0x04, 0x01, 0x0f,
+  0x04, 0x07, 0x07, 0x05, 0x03, 0x04, 0x03, 0x08, 0x03, 0x03, 0x03, 0x0f,
+  0x03, 0x07, 0x07, 0x04, 0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x0e,
+  0x04, 0x05, 0x07, 0x05, 0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x0d,
+  0x05, 0x04, 0x07, 0x05, 0x03, 0x04, 0x04, 0x06, 0x05, 0x04, 0x03, 0x0f,
+  0x05, 0x03, 0x06, 0x05, 0x04, 0x04, 0x03, 0x06, 0x05, 0x17, 0x06, 0x01,
+  0x06, 0x06, 0x04, 0x03, 0x04, 0x04, 0x06, 0x19, 0x0c, 0x06, 0x04, 0x03,
+  0x04, 0x02, 0x07, 0x1c, 0x09, 0x07, 0x03, 0x04, 0x03, 0x03, 0x06, 0x1e,
+  0x08, 0x06, 0x04, 0x04, 0x03, 0x03, 0x05, 0x21, 0x06, 0x06, 0x04, 0x03,
+  0x04, 0x03, 0x02, 0x23, 0x0b, 0x02, 0x04, 0x03, 0x04, 0x28, 0x0a, 0x03,
+  0x03, 0x04, 0x03, 0x29, 0x09, 0x03, 0x04, 0x03, 0x04, 0x2d, 0x05, 0x03,
+  0x04, 0x04, 0x03, 0x2d, 0x04, 0x04, 0x03, 0x05, 0x02, 0x2e, 0x03, 0x04,
+  0x04, 0x34, 0x03, 0x05, 0x04, 0x34, 0x02, 0x06, 0x04, 0x34, 0x02, 0x06,
+  0x03, 0x34, 0x02, 0x07, 0x03, 0x34, 0x01, 0x08, 0x03, 0xa8, 0x03, 0x89,
+  0x0a, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0x8f, 0x01, 0x05, 0x26,
+  0x0a, 0x26, 0x05, 0x62, 0x09, 0x24, 0x0a, 0x25, 0x08, 0x60, 0x0a, 0x23,
+  0x0a, 0x24, 0x09, 0x5f, 0x0c, 0x23, 0x08, 0x24, 0x0b, 0x5e, 0x0d, 0x23,
+  0x06, 0x24, 0x0c, 0x5e, 0x0e, 0x4b, 0x0d, 0x5e, 0x0e, 0x4a, 0x0e, 0x5e,
+  0x0f, 0x48, 0x0f, 0x5f, 0x0e, 0x47, 0x0f, 0x61, 0x0d, 0x46, 0x0f, 0x63,
+  0x0c, 0x45, 0x0f, 0x65, 0x0b, 0x44, 0x0f, 0x67, 0x09, 0x44, 0x0f, 0x69,
+  0x07, 0x45, 0x0e, 0x6b, 0x05, 0x46, 0x0d, 0xb7, 0x01, 0x0c, 0x96, 0x01,
+  0x05, 0x1d, 0x0b, 0x91, 0x01, 0x12, 0x16, 0x0a, 0x8f, 0x01, 0x18, 0x14,
+  0x08, 0x8e, 0x01, 0x1c, 0x13, 0x06, 0x8d, 0x01, 0x20, 0xa2, 0x01, 0x24,
+  0x9f, 0x01, 0x27, 0x83, 0x01, 0x04, 0x14, 0x2a, 0x7b, 0x12, 0x0c, 0x2c,
+  0x76, 0x1a, 0x07, 0x2e, 0x73, 0x1e, 0x04, 0x30, 0x70, 0x55, 0x6d, 0x38,
+  0x0c, 0x14, 0x6a, 0x37, 0x12, 0x12, 0x68, 0x36, 0x16, 0x11, 0x65, 0x36,
+  0x1a, 0x0f, 0x64, 0x36, 0x1c, 0x0f, 0x62, 0x36, 0x1f, 0x0e, 0x60, 0x19,
+  0x05, 0x18, 0x21, 0x0d, 0x5f, 0x14, 0x10, 0x14, 0x21, 0x0d, 0x5d, 0x12,
+  0x16, 0x12, 0x20, 0x0d, 0x5c, 0x11, 0x1a, 0x11, 0x20, 0x0d, 0x5a, 0x11,
+  0x1d, 0x10, 0x20, 0x0c, 0x59, 0x10, 0x20, 0x10, 0x1f, 0x0d, 0x58, 0x0f,
+  0x22, 0x0f, 0x20, 0x0c, 0x57, 0x0f, 0x25, 0x0e, 0x1f, 0x0c, 0x56, 0x0f,
+  0x27, 0x0e, 0x1f, 0x0b, 0x56, 0x0e, 0x29, 0x0d, 0x1f, 0x0c, 0x54, 0x0e,
+  0x2b, 0x0d, 0x1e, 0x0c, 0x54, 0x0d, 0x2c, 0x0d, 0x1f, 0x0b, 0x0f, 0x11,
+  0x33, 0x0d, 0x2e, 0x0d, 0x1e, 0x0b, 0x0d, 0x15, 0x31, 0x0c, 0x30, 0x0c,
+  0x1e, 0x0b, 0x0c, 0x17, 0x30, 0x0c, 0x30, 0x0d, 0x1d, 0x0b, 0x0c, 0x18,
+  0x2e, 0x0c, 0x32, 0x0c, 0x1d, 0x0b, 0x0c, 0x18, 0x2e, 0x0c, 0x32, 0x0c,
+  0x1d, 0x0b, 0x0b, 0x19, 0x2e, 0x0b, 0x34, 0x0c, 0x1c, 0x0b, 0x0b, 0x19,
+  0x2d, 0x0c, 0x34, 0x0c, 0x1c, 0x0b, 0x0c, 0x18, 0x2d, 0x0c, 0x35, 0x12,
+  0x15, 0x0b, 0x0c, 0x17, 0x2c, 0x0d, 0x36, 0x17, 0x10, 0x0b, 0x0d, 0x15,
+  0x2a, 0x10, 0x36, 0x19, 0x0e, 0x0b, 0x0e, 0x13, 0x29, 0x12, 0x36, 0x1b,
+  0x0b, 0x0c, 0x48, 0x14, 0x37, 0x1c, 0x09, 0x0c, 0x46, 0x16, 0x37, 0x1e,
+  0x07, 0x0c, 0x45, 0x16, 0x38, 0x1f, 0x05, 0x0c, 0x45, 0x17, 0x38, 0x20,
+  0x04, 0x0c, 0x43, 0x19, 0x38, 0x22, 0x01, 0x0d, 0x42, 0x1a, 0x38, 0x2f,
+  0x43, 0x1a, 0x38, 0x2f, 0x42, 0x15, 0x4d, 0x20, 0x41, 0x12, 0x55, 0x1b,
+  0x41, 0x11, 0x5a, 0x18, 0x40, 0x10, 0x5d, 0x16, 0x41, 0x0f, 0x60, 0x13,
+  0x41, 0x0e, 0x63, 0x12, 0x41, 0x0d, 0x65, 0x10, 0x41, 0x0d, 0x67, 0x0e,
+  0x42, 0x0d, 0x68, 0x0d, 0x41, 0x0d, 0x6a, 0x0c, 0x41, 0x0c, 0x6b, 0x0d,
+  0x40, 0x0c, 0x6c, 0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3f, 0x0c, 0x6e, 0x0c,
+  0x3e, 0x0b, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x18, 0x14,
+  0x10, 0x04, 0x12, 0x04, 0x1b, 0x0c, 0x0b, 0x01, 0x30, 0x0b, 0x17, 0x16,
+  0x0e, 0x07, 0x0f, 0x07, 0x19, 0x0b, 0x09, 0x06, 0x2e, 0x0b, 0x17, 0x15,
+  0x0e, 0x09, 0x0d, 0x09, 0x18, 0x0b, 0x08, 0x09, 0x2c, 0x0b, 0x16, 0x16,
+  0x0d, 0x0a, 0x0c, 0x0a, 0x18, 0x0b, 0x08, 0x0a, 0x2b, 0x0c, 0x15, 0x15,
+  0x0e, 0x0b, 0x0b, 0x0b, 0x17, 0x0b, 0x07, 0x0c, 0x2a, 0x0c, 0x15, 0x15,
+  0x0e, 0x0b, 0x0b, 0x0b, 0x17, 0x0b, 0x07, 0x0d, 0x2a, 0x0b, 0x14, 0x15,
+  0x0e, 0x0c, 0x0a, 0x0c, 0x16, 0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x13, 0x15,
+  0x0e, 0x0c, 0x0a, 0x0b, 0x17, 0x0c, 0x07, 0x0e, 0x29, 0x0c, 0x13, 0x14,
+  0x0f, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x08, 0x0f, 0x28, 0x0d, 0x11, 0x15,
+  0x0f, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x09, 0x0e, 0x29, 0x0c, 0x11, 0x14,
+  0x0f, 0x0c, 0x0a, 0x0c, 0x15, 0x0d, 0x0a, 0x0d, 0x29, 0x0d, 0x0f, 0x15,
+  0x0f, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x0c, 0x0c, 0x2a, 0x0d, 0x0e, 0x14,
+  0x10, 0x0b, 0x0b, 0x0b, 0x15, 0x0d, 0x0d, 0x0b, 0x2a, 0x0e, 0x0d, 0x14,
+  0x10, 0x0b, 0x0a, 0x0c, 0x14, 0x0d, 0x0f, 0x09, 0x2c, 0x0d, 0x0c, 0x14,
+  0x10, 0x0c, 0x0a, 0x0c, 0x13, 0x0e, 0x10, 0x07, 0x2d, 0x0f, 0x0a, 0x14,
+  0x10, 0x0b, 0x0b, 0x0b, 0x13, 0x0e, 0x13, 0x03, 0x30, 0x0f, 0x09, 0x13,
+  0x11, 0x0b, 0x0b, 0x0b, 0x12, 0x0f, 0x46, 0x10, 0x07, 0x13, 0x11, 0x0c,
+  0x0a, 0x0c, 0x10, 0x10, 0x48, 0x11, 0x05, 0x13, 0x11, 0x0c, 0x0a, 0x0b,
+  0x0f, 0x11, 0x4a, 0x12, 0x02, 0x13, 0x12, 0x0b, 0x0b, 0x0b, 0x0d, 0x13,
+  0x4b, 0x26, 0x12, 0x0b, 0x0b, 0x0b, 0x08, 0x17, 0x4d, 0x24, 0x12, 0x0c,
+  0x0a, 0x0c, 0x06, 0x18, 0x4f, 0x23, 0x12, 0x0c, 0x0a, 0x0b, 0x07, 0x17,
+  0x51, 0x21, 0x13, 0x0b, 0x0b, 0x0b, 0x07, 0x16, 0x53, 0x20, 0x13, 0x0b,
+  0x0a, 0x0c, 0x07, 0x15, 0x55, 0x1e, 0x13, 0x0c, 0x0a, 0x0c, 0x07, 0x14,
+  0x58, 0x1c, 0x13, 0x0b, 0x0b, 0x0b, 0x08, 0x12, 0x5b, 0x1a, 0x14, 0x0b,
+  0x0b, 0x0b, 0x08, 0x11, 0x5e, 0x18, 0x14, 0x0b, 0x0a, 0x0c, 0x08, 0x0f,
+  0x63, 0x14, 0x14, 0x0c, 0x0a, 0x0c, 0x08, 0x0d, 0x67, 0x12, 0x14, 0x0b,
+  0x0b, 0x0b, 0x09, 0x0a, 0x6a, 0x11, 0x15, 0x0b, 0x0b, 0x0b, 0x09, 0x05,
+  0x6e, 0x21, 0x05, 0x0c, 0x0a, 0x0c, 0x7c, 0x21, 0x05, 0x0c, 0x0a, 0x0b,
+  0x7d, 0x20, 0x06, 0x0b, 0x0b, 0x0b, 0x7c, 0x20, 0x07, 0x0b, 0x0b, 0x0b,
+  0x7c, 0x1f, 0x07, 0x0c, 0x0a, 0x0c, 0x7b, 0x20, 0x07, 0x0b, 0x0b, 0x0b,
+  0x7c, 0x1f, 0x08, 0x0b, 0x0b, 0x0b, 0x7c, 0x1e, 0x09, 0x0b, 0x0a, 0x0c,
+  0x7b, 0x1e, 0x09, 0x0c, 0x0a, 0x0c, 0x7b, 0x1e, 0x09, 0x0b, 0x0b, 0x0b,
+  0x7c, 0x1d, 0x0a, 0x0b, 0x0b, 0x0b, 0x8b, 0x01, 0x0d, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x8a, 0x01, 0x0d, 0x0b, 0x0c, 0x0c, 0x09, 0x8b, 0x01, 0x0c, 0x0c,
+  0x0b, 0x0d, 0x09, 0x8b, 0x01, 0x0c, 0x0c, 0x0b, 0x0e, 0x07, 0x8b, 0x01,
+  0x0c, 0x0c, 0x0c, 0x10, 0x03, 0x8d, 0x01, 0x0b, 0x0d, 0x0c, 0xa0, 0x01,
+  0x0a, 0x0e, 0x0b, 0xa0, 0x01, 0x0b, 0x0e, 0x0b, 0xa0, 0x01, 0x0a, 0x0e,
+  0x0c, 0xa0, 0x01, 0x09, 0x0f, 0x0b, 0xa0, 0x01, 0x09, 0x10, 0x0b, 0xa0,
+  0x01, 0x08, 0x11, 0x0b, 0xa0, 0x01, 0x08, 0x10, 0x0c, 0x9f, 0x01, 0x08,
+  0x11, 0x0b, 0xa0, 0x01, 0x07, 0x12, 0x0b, 0xa0, 0x01, 0x06, 0x12, 0x0c,
+  0xa0, 0x01, 0x06, 0x12, 0x0c, 0x9f, 0x01, 0x06, 0x13, 0x0b, 0xa0, 0x01,
+  0x05, 0x14, 0x0b, 0xa0, 0x01, 0x04, 0x15, 0x0b, 0x9f, 0x01, 0x04, 0x16,
+  0x0b, 0x9f, 0x01, 0x04, 0x16, 0x0a, 0xa0, 0x01, 0x03, 0x18, 0x08, 0xa0,
+  0x01, 0x03, 0x1b, 0x05, 0xa1, 0x01, 0x02, 0xc2, 0x01, 0x02, 0xde, 0x19,
+  0xe8, 0x02, 0x05, 0x01, 0x08, 0x01, 0x01, 0x52, 0x02, 0x01, 0x06, 0x01,
+  0x03, 0x51, 0x08, 0x01, 0x01, 0x01, 0x05, 0x10, 0x07, 0x02, 0x01, 0x02,
+  0x03, 0x32, 0x02, 0x01, 0x05, 0x01, 0x04, 0x13, 0x01, 0x02, 0x05, 0x02,
+  0x03, 0xca, 0x02, 0xd0, 0x0a, 0x09, 0x03, 0x0e, 0x04, 0x02, 0x20, 0x0a,
+  0x01, 0x10, 0x02, 0x03, 0x20, 0x0a, 0x01, 0x10, 0x02, 0x03, 0x21, 0x07,
+  0x05, 0x0d, 0x04, 0x01, 0xa7, 0x01, 0x01, 0x04, 0x0a, 0x03, 0x06, 0x27,
+  0x03, 0x02, 0x0b, 0x02, 0x08, 0x26, 0x03, 0x02, 0x0c, 0x01, 0x08, 0x26,
+  0x03, 0x02, 0x0b, 0x03, 0x06, 0xe2, 0x01, 0x0f, 0x02, 0x03, 0x02, 0x0a,
+  0x20, 0x0f, 0x02, 0x04, 0x01, 0x0a, 0x20, 0x0f, 0x02, 0x03, 0x03, 0x09,
+  0xe2, 0x01, 0x03, 0x02, 0x0b, 0x03, 0x06, 0x27, 0x03, 0x02, 0x0c, 0x01,
+  0x08, 0x26, 0x03, 0x02, 0x0c, 0x01, 0x08, 0x27, 0x01, 0x04, 0x09, 0x05,
+  0x04, 0x96, 0x0a, 0xf6, 0x63, 0x1a, 0x0a, 0x2c, 0x0a, 0x06, 0x63, 0x1c,
+  0x08, 0x2e, 0x08, 0x08, 0x61, 0x1e, 0x06, 0x30, 0x06, 0x0a, 0x60, 0x1e,
+  0x06, 0x30, 0x06, 0x0a, 0x60, 0x1f, 0x05, 0x30, 0x05, 0x0b, 0x60, 0x1f,
+  0x05, 0x30, 0x05, 0x0b, 0x60, 0x1e, 0x06, 0x30, 0x06, 0x0a, 0x60, 0x1e,
+  0x06, 0x30, 0x06, 0x0a, 0x61, 0x1c, 0x08, 0x2e, 0x08, 0x08, 0x63, 0x1a,
+  0x0a, 0x2c, 0x0a, 0x06, 0x95, 0x0d, 0x04, 0x0c, 0x1c, 0x0d, 0x10, 0x7a,
+  0x06, 0x09, 0x20, 0x09, 0x13, 0x78, 0x08, 0x07, 0x22, 0x07, 0x15, 0x76,
+  0x0a, 0x05, 0x24, 0x05, 0x17, 0x75, 0x0a, 0x05, 0x24, 0x05, 0x17, 0x75,
+  0x0a, 0x05, 0x24, 0x05, 0x17, 0x75, 0x0a, 0x05, 0x24, 0x05, 0x17, 0x75,
+  0x0a, 0x05, 0x24, 0x05, 0x17, 0x75, 0x0a, 0x05, 0x24, 0x05, 0x17, 0x76,
+  0x08, 0x07, 0x22, 0x07, 0x15, 0x77, 0x07, 0x09, 0x20, 0x09, 0x13, 0x7a,
+  0x03, 0x0d, 0x1c, 0x0d, 0x0f, 0x8d, 0x0d, 0x29, 0x0c, 0x03, 0x0d, 0x17,
+  0x66, 0x2d, 0x08, 0x07, 0x09, 0x1b, 0x63, 0x2f, 0x06, 0x09, 0x07, 0x1d,
+  0x61, 0x30, 0x05, 0x0b, 0x05, 0x1e, 0x61, 0x30, 0x05, 0x0b, 0x05, 0x1e,
+  0x61, 0x31, 0x04, 0x0b, 0x05, 0x1e, 0x61, 0x30, 0x05, 0x0b, 0x05, 0x1e,
+  0x61, 0x30, 0x05, 0x0b, 0x05, 0x1e, 0x62, 0x2f, 0x06, 0x09, 0x07, 0x1d,
+  0x62, 0x2e, 0x08, 0x07, 0x08, 0x1c, 0x65, 0x2a, 0x0b, 0x05, 0x0b, 0x19,
+  0x8d, 0x0d, 0x05, 0x0a, 0x1c, 0x0d, 0x11, 0x79, 0x08, 0x08, 0x1e, 0x0b,
+  0x14, 0x77, 0x09, 0x06, 0x20, 0x09, 0x16, 0x75, 0x0a, 0x06, 0x21, 0x07,
+  0x17, 0x75, 0x0b, 0x04, 0x23, 0x06, 0x17, 0x74, 0x0c, 0x04, 0x24, 0x05,
+  0x17, 0x74, 0x0c, 0x04, 0x25, 0x04, 0x17, 0x75, 0x0a, 0x05, 0x24, 0x05,
+  0x17, 0x75, 0x0a, 0x06, 0x23, 0x06, 0x16, 0x76, 0x09, 0x06, 0x22, 0x07,
+  0x15, 0x78, 0x06, 0x09, 0x20, 0x09, 0x13, 0xfc, 0x60, 0x8d, 0x02, 0x05,
+  0x1a, 0x08, 0x17, 0x02, 0x05, 0x03, 0x15, 0x02, 0x07, 0x02, 0x15, 0x02,
+  0x08, 0x02, 0x12, 0x03, 0x09, 0x05, 0x0e, 0x04, 0x0a, 0x05, 0x0c, 0x02,
+  0x11, 0x02, 0x0b, 0x01, 0x12, 0x02, 0x2b, 0x15, 0x0b, 0x15, 0x48, 0x15,
+  0x50, 0x15, 0x0b, 0x15, 0xa3, 0x01, 0x9b, 0x08, 0x09, 0x35, 0x0d, 0x32,
+  0x0f, 0x30, 0x08, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05, 0x2c, 0x05, 0x0b,
+  0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04, 0x29, 0x03, 0x11,
+  0x03, 0x28, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09, 0x1e, 0x08, 0x11,
+  0x0b, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06, 0x18, 0x04, 0x20,
+  0x04, 0x17, 0x04, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04, 0xd7, 0x01, 0x28,
+  0x16, 0x2b, 0x15, 0x2b, 0x16, 0x2a, 0xd0, 0x01, 0x2a, 0x16, 0x2b, 0x15,
+  0x2b, 0x16, 0x29, 0xdf, 0x01, 0x2b, 0x15, 0x2b, 0x15, 0x2b, 0xc6, 0x05,
+  0xa0, 0x4a, 0x01, 0xbb, 0x01, 0x12, 0xae, 0x01, 0x19, 0xa8, 0x01, 0x1f,
+  0xa3, 0x01, 0x23, 0x9f, 0x01, 0x27, 0x9c, 0x01, 0x29, 0x99, 0x01, 0x2d,
+  0x96, 0x01, 0x2f, 0x94, 0x01, 0x31, 0x92, 0x01, 0x33, 0x8f, 0x01, 0x36,
+  0x8e, 0x01, 0x14, 0x0e, 0x15, 0x8c, 0x01, 0x12, 0x15, 0x12, 0x8a, 0x01,
+  0x11, 0x19, 0x11, 0x88, 0x01, 0x10, 0x1d, 0x10, 0x86, 0x01, 0x10, 0x1f,
+  0x10, 0x84, 0x01, 0x0f, 0x23, 0x0f, 0x83, 0x01, 0x0e, 0x25, 0x0e, 0x82,
+  0x01, 0x0e, 0x27, 0x0e, 0x81, 0x01, 0x0d, 0x29, 0x0d, 0x80, 0x01, 0x0d,
+  0x2b, 0x0d, 0x7f, 0x0c, 0x2d, 0x0c, 0x7e, 0x0d, 0x2d, 0x0d, 0x7d, 0x0c,
+  0x2f, 0x0c, 0x7c, 0x0c, 0x31, 0x0c, 0x7b, 0x0c, 0x31, 0x0c, 0x7b, 0x0b,
+  0x33, 0x0b, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0b, 0x34, 0x0c, 0x79, 0x0b,
+  0x35, 0x12, 0x70, 0x0d, 0x35, 0x17, 0x68, 0x10, 0x35, 0x1a, 0x63, 0x11,
+  0x37, 0x1b, 0x5f, 0x13, 0x37, 0x1d, 0x5b, 0x15, 0x37, 0x1e, 0x59, 0x16,
+  0x37, 0x20, 0x56, 0x17, 0x37, 0x21, 0x53, 0x19, 0x37, 0x22, 0x51, 0x19,
+  0x38, 0x23, 0x4f, 0x1a, 0x39, 0x23, 0x4e, 0x14, 0x4f, 0x14, 0x4c, 0x11,
+  0x56, 0x12, 0x4a, 0x10, 0x5a, 0x10, 0x49, 0x0f, 0x5e, 0x0f, 0x48, 0x0e,
+  0x60, 0x0f, 0x46, 0x0e, 0x62, 0x0e, 0x46, 0x0d, 0x64, 0x0e, 0x44, 0x0d,
+  0x66, 0x0d, 0x44, 0x0c, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x42, 0x0c,
+  0x6a, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0b, 0x6e, 0x0b, 0xea, 0x0f,
+  0x80, 0x01, 0x43, 0x82, 0x01, 0x41, 0x83, 0x01, 0x40, 0x85, 0x01, 0x3f,
+  0x85, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85, 0x01, 0x40, 0x83, 0x01, 0x42,
+  0x82, 0x01, 0x43, 0x80, 0x01, 0x46, 0x7b, 0x9a, 0x0e, 0x7f, 0x44, 0x82,
+  0x01, 0x41, 0x84, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85,
+  0x01, 0x3f, 0x85, 0x01, 0x40, 0x84, 0x01, 0x40, 0x83, 0x01, 0x42, 0x82,
+  0x01, 0x44, 0x7e, 0xc6, 0x0e, 0x7e, 0x45, 0x81, 0x01, 0x42, 0x83, 0x01,
+  0x40, 0x84, 0x01, 0x40, 0x85, 0x01, 0x3f, 0x85, 0x01, 0x3f, 0x85, 0x01,
+  0x3f, 0x84, 0x01, 0x41, 0x83, 0x01, 0x41, 0x82, 0x01, 0x44, 0x7f, 0xd8,
+  0x32, 0x88, 0x03, 0x01, 0x03, 0x01, 0x04, 0x01, 0x02, 0x02, 0x11, 0x03,
+  0x02, 0x02, 0x03, 0x01, 0x02, 0x03, 0x10, 0x04, 0x01, 0x02, 0x02, 0x02,
+  0x01, 0x04, 0x10, 0x07, 0x02, 0x01, 0x02, 0x04, 0x10, 0x02, 0x01, 0x04,
+  0x01, 0x02, 0x01, 0x06, 0x0f, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x06,
+  0x0f, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x17, 0x01,
+  0x90, 0x03, 0xa2, 0x0c, 0x03, 0x2a, 0x05, 0x03, 0x04, 0x07, 0x03, 0x03,
+  0x04, 0x23, 0x05, 0x03, 0x04, 0x06, 0x03, 0x03, 0x06, 0x22, 0x06, 0x02,
+  0x04, 0x06, 0x03, 0x03, 0x06, 0x22, 0x06, 0x02, 0x04, 0x06, 0x03, 0x03,
+  0x07, 0x21, 0x07, 0x01, 0x04, 0x05, 0x03, 0x03, 0x08, 0x21, 0x07, 0x01,
+  0x04, 0x05, 0x03, 0x03, 0x08, 0x21, 0x0c, 0x04, 0x04, 0x02, 0x04, 0x02,
+  0x04, 0x20, 0x04, 0x01, 0x07, 0x04, 0x03, 0x03, 0x04, 0x02, 0x04, 0x20,
+  0x04, 0x01, 0x07, 0x04, 0x03, 0x03, 0x04, 0x02, 0x04, 0x20, 0x04, 0x02,
+  0x06, 0x03, 0x03, 0x03, 0x0c, 0x1f, 0x04, 0x02, 0x06, 0x03, 0x03, 0x03,
+  0x0c, 0x1f, 0x04, 0x03, 0x05, 0x03, 0x03, 0x03, 0x0d, 0x1e, 0x04, 0x03,
+  0x05, 0x02, 0x03, 0x03, 0x05, 0x04, 0x05, 0x1e, 0x04, 0x04, 0x04, 0x02,
+  0x03, 0x03, 0x04, 0x06, 0x04, 0xcf, 0x0c, 0xd4, 0x73, 0x0a, 0x7f, 0x0e,
+  0x0c, 0x0d, 0x14, 0x09, 0x09, 0x0e, 0x69, 0x0f, 0x0b, 0x0d, 0x13, 0x0a,
+  0x09, 0x0e, 0x69, 0x0f, 0x0b, 0x0d, 0x13, 0x09, 0x09, 0x0f, 0x69, 0x10,
+  0x0a, 0x0d, 0x13, 0x09, 0x09, 0x10, 0x68, 0x10, 0x0a, 0x0d, 0x12, 0x0a,
+  0x08, 0x11, 0x68, 0x11, 0x09, 0x0d, 0x12, 0x09, 0x09, 0x12, 0x67, 0x11,
+  0x09, 0x0d, 0x12, 0x09, 0x09, 0x12, 0x67, 0x12, 0x08, 0x0d, 0x11, 0x0a,
+  0x08, 0x13, 0x67, 0x12, 0x08, 0x0d, 0x11, 0x09, 0x09, 0x14, 0x66, 0x13,
+  0x07, 0x0d, 0x10, 0x0a, 0x09, 0x14, 0x66, 0x14, 0x06, 0x0d, 0x10, 0x09,
+  0x09, 0x15, 0x66, 0x14, 0x06, 0x0d, 0x10, 0x09, 0x09, 0x16, 0x65, 0x15,
+  0x05, 0x0d, 0x0f, 0x0a, 0x08, 0x17, 0x65, 0x15, 0x05, 0x0d, 0x0f, 0x09,
+  0x09, 0x17, 0x65, 0x16, 0x04, 0x0d, 0x0f, 0x09, 0x09, 0x18, 0x64, 0x16,
+  0x04, 0x0d, 0x0e, 0x0a, 0x08, 0x0c, 0x01, 0x0c, 0x64, 0x17, 0x03, 0x0d,
+  0x0e, 0x09, 0x09, 0x0c, 0x02, 0x0c, 0x63, 0x17, 0x03, 0x0d, 0x0d, 0x0a,
+  0x09, 0x0c, 0x02, 0x0c, 0x63, 0x18, 0x02, 0x0d, 0x0d, 0x09, 0x09, 0x0c,
+  0x03, 0x0c, 0x63, 0x18, 0x02, 0x0d, 0x0d, 0x09, 0x09, 0x0c, 0x04, 0x0c,
+  0x62, 0x19, 0x01, 0x0d, 0x0c, 0x0a, 0x09, 0x0c, 0x04, 0x0c, 0x62, 0x0d,
+  0x01, 0x19, 0x0c, 0x09, 0x09, 0x0c, 0x05, 0x0c, 0x62, 0x0d, 0x01, 0x19,
+  0x0c, 0x09, 0x09, 0x0c, 0x05, 0x0d, 0x61, 0x0d, 0x02, 0x18, 0x0b, 0x0a,
+  0x08, 0x0d, 0x06, 0x0c, 0x61, 0x0d, 0x03, 0x17, 0x0b, 0x09, 0x09, 0x0d,
+  0x06, 0x0c, 0x61, 0x0d, 0x03, 0x17, 0x0a, 0x0a, 0x09, 0x0c, 0x07, 0x0d,
+  0x60, 0x0d, 0x04, 0x16, 0x0a, 0x09, 0x09, 0x0d, 0x08, 0x0c, 0x60, 0x0d,
+  0x04, 0x16, 0x0a, 0x09, 0x09, 0x22, 0x5f, 0x0d, 0x05, 0x15, 0x09, 0x0a,
+  0x09, 0x22, 0x5f, 0x0d, 0x05, 0x15, 0x09, 0x09, 0x09, 0x23, 0x5f, 0x0d,
+  0x06, 0x14, 0x09, 0x09, 0x09, 0x24, 0x5e, 0x0d, 0x07, 0x13, 0x08, 0x0a,
+  0x08, 0x25, 0x5e, 0x0d, 0x07, 0x13, 0x08, 0x09, 0x09, 0x25, 0x5e, 0x0d,
+  0x08, 0x12, 0x07, 0x0a, 0x09, 0x26, 0x5d, 0x0d, 0x08, 0x12, 0x07, 0x09,
+  0x09, 0x27, 0x5d, 0x0d, 0x09, 0x11, 0x07, 0x09, 0x09, 0x27, 0x5d, 0x0d,
+  0x09, 0x11, 0x06, 0x0a, 0x09, 0x28, 0x5c, 0x0d, 0x0a, 0x10, 0x06, 0x09,
+  0x09, 0x0d, 0x0f, 0x0d, 0x5c, 0x0d, 0x0a, 0x10, 0x06, 0x09, 0x09, 0x0d,
+  0x0f, 0x0e, 0x5b, 0x0d, 0x0b, 0x0f, 0x05, 0x0a, 0x09, 0x0d, 0x0f, 0x0e,
+  0x5b, 0x0d, 0x0c, 0x0e, 0x05, 0x09, 0x09, 0x0e, 0x10, 0x0d, 0x5b, 0x0d,
+  0x0c, 0x0e, 0x04, 0x0a, 0x09, 0x0d, 0x11, 0x0e, 0x5a, 0x0d, 0x0d, 0x0d,
+  0x04, 0x09, 0x09, 0x0e, 0x11, 0x0e, 0x85, 0x01, 0x09, 0x93, 0x75, 0xd3,
+  0x01, 0x05, 0x1a, 0x06, 0x14, 0x08, 0x02, 0x02, 0x13, 0x08, 0x04, 0x01,
+  0x12, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03,
+  0x0e, 0x02, 0x08, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02,
+  0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x02, 0x10, 0x03, 0x0b, 0x02, 0x11, 0x02,
+  0x0a, 0x02, 0x13, 0x01, 0x0a, 0x02, 0x13, 0x01, 0x0b, 0x02, 0x11, 0x02,
+  0x0b, 0x02, 0x11, 0x02, 0x0c, 0x04, 0x0b, 0x04, 0x0e, 0x11, 0xa8, 0x02,
+  0xeb, 0x05, 0x02, 0x3a, 0x09, 0x36, 0x0a, 0x34, 0x0c, 0x33, 0x07, 0x02,
+  0x04, 0x2a, 0x07, 0x02, 0x05, 0x05, 0x03, 0x27, 0x10, 0x06, 0x03, 0x26,
+  0x10, 0x07, 0x04, 0x23, 0x09, 0x01, 0x08, 0x07, 0x04, 0x23, 0x05, 0x08,
+  0x06, 0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d,
+  0x05, 0x06, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x10,
+  0x04, 0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x08, 0x05, 0x18, 0x06, 0x11,
+  0x09, 0x03, 0x04, 0x17, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x16, 0x08, 0x12,
+  0x0f, 0x16, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x16, 0x04, 0x21,
+  0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x23, 0x04, 0x16, 0x04, 0x22,
+  0x04, 0x16, 0x05, 0x20, 0x04, 0x18, 0x06, 0x1c, 0x06, 0x19, 0x26, 0x1b,
+  0x24, 0x1e, 0x20, 0x23, 0x1a, 0xd4, 0x08, 0xcd, 0x36, 0x0b, 0xb5, 0x01,
+  0x13, 0xae, 0x01, 0x19, 0xa9, 0x01, 0x1d, 0xa5, 0x01, 0x1f, 0xa3, 0x01,
+  0x21, 0xa2, 0x01, 0x21, 0xa1, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01,
+  0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x16, 0x05, 0x0c, 0x9c, 0x01, 0x13,
+  0x09, 0x0b, 0x9d, 0x01, 0x11, 0x0b, 0x0b, 0x83, 0x01, 0x11, 0x08, 0x10,
+  0x0d, 0x0b, 0x7f, 0x18, 0x04, 0x0f, 0x0f, 0x0c, 0x7b, 0x2d, 0x11, 0x0b,
+  0x79, 0x2e, 0x12, 0x0b, 0x77, 0x2f, 0x13, 0x0b, 0x75, 0x30, 0x14, 0x0b,
+  0x74, 0x30, 0x15, 0x0c, 0x71, 0x32, 0x15, 0x0c, 0x70, 0x32, 0x17, 0x0b,
+  0x6f, 0x34, 0x16, 0x0c, 0x6d, 0x36, 0x15, 0x0c, 0x6c, 0x16, 0x0c, 0x16,
+  0x15, 0x0c, 0x6a, 0x13, 0x14, 0x13, 0x14, 0x0d, 0x68, 0x12, 0x18, 0x12,
+  0x14, 0x0c, 0x67, 0x11, 0x1c, 0x11, 0x13, 0x0d, 0x66, 0x0f, 0x1f, 0x11,
+  0x13, 0x0d, 0x64, 0x0f, 0x22, 0x0f, 0x13, 0x0e, 0x62, 0x0f, 0x24, 0x0f,
+  0x13, 0x0f, 0x5f, 0x0f, 0x26, 0x0f, 0x12, 0x10, 0x5e, 0x0e, 0x28, 0x0e,
+  0x13, 0x11, 0x5b, 0x0e, 0x2a, 0x0e, 0x13, 0x12, 0x59, 0x0d, 0x2c, 0x0d,
+  0x14, 0x14, 0x55, 0x0d, 0x2e, 0x0d, 0x14, 0x16, 0x52, 0x0d, 0x2e, 0x0d,
+  0x15, 0x16, 0x51, 0x0c, 0x30, 0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32, 0x0c,
+  0x16, 0x14, 0x50, 0x0c, 0x32, 0x0c, 0x17, 0x12, 0x51, 0x0b, 0x33, 0x0c,
+  0x18, 0x11, 0x50, 0x0c, 0x34, 0x0c, 0x19, 0x0f, 0x50, 0x0c, 0x34, 0x12,
+  0x15, 0x0c, 0x4f, 0x0d, 0x36, 0x16, 0x10, 0x0c, 0x4c, 0x10, 0x36, 0x19,
+  0x0d, 0x0c, 0x4a, 0x12, 0x36, 0x1b, 0x0a, 0x0c, 0x49, 0x14, 0x36, 0x1d,
+  0x08, 0x0c, 0x47, 0x15, 0x37, 0x1f, 0x05, 0x0d, 0x46, 0x16, 0x38, 0x1f,
+  0x03, 0x0d, 0x46, 0x17, 0x38, 0x20, 0x01, 0x0e, 0x44, 0x19, 0x38, 0x2e,
+  0x44, 0x1a, 0x38, 0x2e, 0x43, 0x1b, 0x38, 0x2d, 0x44, 0x16, 0x4a, 0x1f,
+  0x44, 0x13, 0x53, 0x19, 0x44, 0x11, 0x59, 0x16, 0x43, 0x10, 0x5d, 0x13,
+  0x44, 0x0f, 0x5f, 0x11, 0x44, 0x0f, 0x61, 0x0f, 0x45, 0x0d, 0x65, 0x0e,
+  0x43, 0x0d, 0x67, 0x0d, 0x43, 0x0d, 0x67, 0x0e, 0x41, 0x0d, 0x69, 0x0d,
+  0x41, 0x0c, 0x6b, 0x0c, 0x41, 0x0c, 0x6b, 0x0d, 0x3f, 0x0c, 0x6d, 0x0c,
+  0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0b, 0x6f, 0x0b, 0x3f, 0x0b, 0x6f, 0x0c,
+  0x3d, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x6f, 0x0c, 0x3e, 0x0b, 0x6f, 0x0c,
+  0x3e, 0x0b, 0x6f, 0x0b, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c,
+  0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6b, 0x0c, 0x41, 0x0d, 0x69, 0x0d,
+  0x42, 0x0d, 0x68, 0x0c, 0x43, 0x0e, 0x66, 0x0d, 0x44, 0x0e, 0x64, 0x0d,
+  0x45, 0x0f, 0x62, 0x0e, 0x46, 0x0f, 0x60, 0x0e, 0x48, 0x0f, 0x5d, 0x10,
+  0x48, 0x11, 0x5a, 0x10, 0x4a, 0x12, 0x55, 0x12, 0x4c, 0x14, 0x4f, 0x14,
+  0x4e, 0x75, 0x50, 0x73, 0x52, 0x71, 0x54, 0x6f, 0x56, 0x6d, 0x59, 0x69,
+  0x5c, 0x67, 0x5f, 0x63, 0x63, 0x5f, 0x68, 0x59, 0x70, 0x4f, 0xd2, 0x51,
+  0xd4, 0x01, 0x05, 0x1a, 0x06, 0x14, 0x08, 0x03, 0x01, 0x13, 0x08, 0x04,
+  0x02, 0x11, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x08, 0x02, 0x03,
+  0x03, 0x0e, 0x02, 0x08, 0x02, 0x04, 0x03, 0x0b, 0x04, 0x08, 0x05, 0x01,
+  0x02, 0x0b, 0x04, 0x04, 0x01, 0x05, 0x07, 0x0a, 0x03, 0x05, 0x04, 0x07,
+  0x02, 0x0b, 0x02, 0x06, 0x01, 0x01, 0x02, 0x08, 0x02, 0x15, 0x01, 0x08,
+  0x02, 0x08, 0x0e, 0x08, 0x02, 0x07, 0x0e, 0x09, 0x02, 0x1d, 0x02, 0x1c,
+  0x03, 0x09, 0x09, 0x03, 0x0a, 0x12, 0x02, 0x1e, 0x02, 0x1b, 0x05, 0x1b,
+  0x04, 0xb4, 0x01, 0xed, 0x05, 0x03, 0x3a, 0x09, 0x35, 0x0b, 0x34, 0x0c,
+  0x33, 0x06, 0x03, 0x04, 0x29, 0x08, 0x01, 0x05, 0x05, 0x04, 0x27, 0x0f,
+  0x06, 0x04, 0x25, 0x10, 0x07, 0x04, 0x24, 0x08, 0x01, 0x09, 0x07, 0x04,
+  0x22, 0x06, 0x08, 0x06, 0x06, 0x04, 0x21, 0x05, 0x0c, 0x05, 0x06, 0x04,
+  0x20, 0x04, 0x0e, 0x04, 0x06, 0x06, 0x1d, 0x04, 0x10, 0x04, 0x06, 0x07,
+  0x1b, 0x04, 0x10, 0x04, 0x07, 0x06, 0x1b, 0x03, 0x12, 0x04, 0x08, 0x04,
+  0x19, 0x05, 0x12, 0x08, 0x04, 0x04, 0x17, 0x07, 0x12, 0x0a, 0x01, 0x04,
+  0x17, 0x08, 0x12, 0x0f, 0x16, 0x06, 0x09, 0x05, 0x0d, 0x08, 0x16, 0x05,
+  0x09, 0x08, 0x0e, 0x05, 0x16, 0x05, 0x0a, 0x09, 0x0e, 0x04, 0x16, 0x04,
+  0x0b, 0x04, 0x01, 0x05, 0x0e, 0x04, 0x15, 0x03, 0x12, 0x04, 0x0e, 0x04,
+  0x2a, 0x04, 0x0f, 0x03, 0x2a, 0x04, 0x0f, 0x04, 0x27, 0x06, 0x0f, 0x04,
+  0x0f, 0x1d, 0x10, 0x03, 0x0f, 0x1d, 0x11, 0x03, 0x10, 0x1b, 0x11, 0x04,
+  0x3b, 0x05, 0x3a, 0x05, 0x3a, 0x05, 0x12, 0x10, 0x07, 0x17, 0x11, 0x12,
+  0x06, 0x15, 0x14, 0x12, 0x05, 0x14, 0x16, 0x12, 0x04, 0x11, 0x27, 0x04,
+  0x3d, 0x03, 0x3c, 0x04, 0x36, 0x04, 0x01, 0x05, 0x36, 0x09, 0x37, 0x09,
+  0x38, 0x07, 0xa8, 0x05, 0xd4, 0x36, 0x0c, 0xb4, 0x01, 0x14, 0xad, 0x01,
+  0x1b, 0xa7, 0x01, 0x1d, 0xa5, 0x01, 0x1f, 0xa3, 0x01, 0x21, 0xa2, 0x01,
+  0x22, 0xa1, 0x01, 0x23, 0x9f, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01,
+  0x26, 0x9e, 0x01, 0x15, 0x06, 0x0b, 0x9d, 0x01, 0x12, 0x0a, 0x0b, 0x9c,
+  0x01, 0x11, 0x0c, 0x0b, 0x82, 0x01, 0x11, 0x08, 0x10, 0x0e, 0x0b, 0x7e,
+  0x19, 0x04, 0x0e, 0x10, 0x0b, 0x7c, 0x2c, 0x11, 0x0b, 0x7a, 0x2d, 0x12,
+  0x0b, 0x78, 0x2e, 0x13, 0x0c, 0x75, 0x2f, 0x14, 0x0c, 0x73, 0x31, 0x15,
+  0x0b, 0x72, 0x31, 0x16, 0x0c, 0x70, 0x32, 0x16, 0x0c, 0x6f, 0x34, 0x15,
+  0x0d, 0x6d, 0x36, 0x15, 0x0c, 0x6c, 0x15, 0x0e, 0x15, 0x14, 0x0d, 0x6a,
+  0x13, 0x14, 0x13, 0x14, 0x0c, 0x69, 0x11, 0x19, 0x12, 0x13, 0x0d, 0x67,
+  0x10, 0x1d, 0x11, 0x13, 0x0d, 0x65, 0x10, 0x20, 0x0f, 0x13, 0x0e, 0x63,
+  0x10, 0x22, 0x0f, 0x13, 0x0e, 0x62, 0x0e, 0x25, 0x0f, 0x12, 0x0f, 0x60,
+  0x0e, 0x27, 0x0e, 0x13, 0x10, 0x5e, 0x0d, 0x29, 0x0e, 0x13, 0x11, 0x5b,
+  0x0d, 0x2b, 0x0d, 0x13, 0x13, 0x59, 0x0d, 0x2c, 0x0d, 0x13, 0x15, 0x55,
+  0x0d, 0x2e, 0x0c, 0x14, 0x16, 0x53, 0x0c, 0x2f, 0x0d, 0x14, 0x16, 0x51,
+  0x0d, 0x30, 0x0c, 0x15, 0x15, 0x51, 0x0c, 0x32, 0x0c, 0x15, 0x14, 0x51,
+  0x0c, 0x32, 0x0c, 0x16, 0x13, 0x50, 0x0c, 0x34, 0x0b, 0x18, 0x11, 0x50,
+  0x0c, 0x34, 0x0b, 0x1a, 0x0f, 0x50, 0x0b, 0x35, 0x12, 0x14, 0x0d, 0x4f,
+  0x0d, 0x36, 0x16, 0x10, 0x0c, 0x4c, 0x10, 0x36, 0x19, 0x0c, 0x0d, 0x4a,
+  0x12, 0x36, 0x1b, 0x0a, 0x0c, 0x49, 0x13, 0x37, 0x1d, 0x07, 0x0d, 0x47,
+  0x15, 0x37, 0x1e, 0x05, 0x0d, 0x47, 0x16, 0x38, 0x1f, 0x02, 0x0e, 0x46,
+  0x17, 0x38, 0x2e, 0x46, 0x18, 0x38, 0x2e, 0x44, 0x1a, 0x38, 0x2d, 0x44,
+  0x1a, 0x18, 0x06, 0x1b, 0x2d, 0x44, 0x15, 0x19, 0x0e, 0x24, 0x1f, 0x44,
+  0x12, 0x1b, 0x12, 0x28, 0x18, 0x44, 0x11, 0x1c, 0x14, 0x29, 0x15, 0x44,
+  0x10, 0x1d, 0x17, 0x29, 0x13, 0x44, 0x0e, 0x1e, 0x19, 0x29, 0x11, 0x44,
+  0x0e, 0x1e, 0x1b, 0x2a, 0x0e, 0x44, 0x0e, 0x1e, 0x1c, 0x2b, 0x0d, 0x44,
+  0x0d, 0x1f, 0x1d, 0x2b, 0x0d, 0x42, 0x0d, 0x20, 0x1e, 0x2b, 0x0c, 0x42,
+  0x0d, 0x20, 0x1e, 0x2b, 0x0d, 0x41, 0x0c, 0x22, 0x0c, 0x03, 0x0e, 0x2c,
+  0x0c, 0x40, 0x0d, 0x22, 0x09, 0x08, 0x0d, 0x2c, 0x0b, 0x40, 0x0c, 0x24,
+  0x07, 0x0a, 0x0c, 0x2c, 0x0c, 0x3f, 0x0b, 0x27, 0x03, 0x0d, 0x0b, 0x2d,
+  0x0b, 0x81, 0x01, 0x0b, 0x2d, 0x0b, 0x81, 0x01, 0x0c, 0x2c, 0x0c, 0x80,
+  0x01, 0x0c, 0x2d, 0x0b, 0x80, 0x01, 0x0c, 0x2d, 0x0b, 0x80, 0x01, 0x0b,
+  0x2e, 0x0b, 0x80, 0x01, 0x0b, 0x2e, 0x0b, 0x7f, 0x0c, 0x2e, 0x0b, 0x7e,
+  0x0d, 0x2e, 0x0b, 0x7c, 0x0f, 0x2e, 0x0b, 0x31, 0x59, 0x2f, 0x0b, 0x2f,
+  0x5b, 0x2f, 0x0b, 0x2e, 0x5b, 0x30, 0x0b, 0x2e, 0x5a, 0x31, 0x0b, 0x2e,
+  0x5a, 0x30, 0x0c, 0x2d, 0x5a, 0x31, 0x0b, 0x2f, 0x58, 0x32, 0x0b, 0x2f,
+  0x57, 0x32, 0x0c, 0x2f, 0x55, 0x34, 0x0c, 0x30, 0x52, 0x35, 0x0c, 0x33,
+  0x4d, 0x37, 0x0d, 0xb7, 0x01, 0x0c, 0xb7, 0x01, 0x0d, 0xb6, 0x01, 0x0d,
+  0xb6, 0x01, 0x0e, 0xb5, 0x01, 0x0e, 0xb4, 0x01, 0x10, 0xb3, 0x01, 0x10,
+  0xb1, 0x01, 0x12, 0xae, 0x01, 0x15, 0x38, 0x2e, 0x18, 0x46, 0x37, 0x31,
+  0x16, 0x45, 0x37, 0x34, 0x14, 0x44, 0x38, 0x36, 0x12, 0x42, 0x3a, 0x37,
+  0x11, 0x41, 0x3a, 0x39, 0x10, 0x40, 0x3c, 0x38, 0x10, 0x3e, 0x3e, 0x39,
+  0x0f, 0x3c, 0x41, 0x39, 0x0e, 0x3a, 0x44, 0x38, 0x0e, 0x38, 0x47, 0x38,
+  0x0d, 0x33, 0x76, 0x0e, 0xb8, 0x01, 0x0d, 0xb8, 0x01, 0x0c, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xa8, 0x01, 0x04, 0x0c, 0x0c, 0xa7, 0x01, 0x07,
+  0x09, 0x0d, 0xa6, 0x01, 0x09, 0x07, 0x0d, 0xa6, 0x01, 0x0d, 0x02, 0x0f,
+  0xa6, 0x01, 0x1e, 0xa6, 0x01, 0x1d, 0xa7, 0x01, 0x1d, 0xa7, 0x01, 0x1c,
+  0xa9, 0x01, 0x1a, 0xaa, 0x01, 0x19, 0xac, 0x01, 0x17, 0xaf, 0x01, 0x14,
+  0xb1, 0x01, 0x11, 0xb5, 0x01, 0x0d, 0xbb, 0x01, 0x05, 0xb7, 0x2d, 0x90,
+  0x02, 0x05, 0x19, 0x07, 0x18, 0x04, 0x02, 0x02, 0x18, 0x02, 0x04, 0x02,
+  0x17, 0x03, 0x04, 0x02, 0x17, 0x02, 0x06, 0x02, 0x16, 0x04, 0x04, 0x04,
+  0x13, 0x06, 0x04, 0x04, 0x11, 0x03, 0x02, 0x03, 0x04, 0x02, 0x12, 0x02,
+  0x04, 0x04, 0x01, 0x03, 0x10, 0x04, 0x05, 0x06, 0x11, 0x02, 0x09, 0x03,
+  0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x09, 0x03,
+  0x12, 0x0d, 0x15, 0x0a, 0xec, 0x01, 0xa1, 0x08, 0x08, 0x36, 0x0b, 0x33,
+  0x0d, 0x32, 0x0e, 0x31, 0x07, 0x04, 0x04, 0x30, 0x06, 0x06, 0x04, 0x30,
+  0x05, 0x07, 0x04, 0x2f, 0x05, 0x08, 0x04, 0x2f, 0x04, 0x09, 0x04, 0x2e,
+  0x05, 0x09, 0x05, 0x2d, 0x04, 0x0b, 0x05, 0x2c, 0x04, 0x0b, 0x06, 0x2b,
+  0x06, 0x0a, 0x07, 0x29, 0x09, 0x08, 0x08, 0x26, 0x0b, 0x08, 0x08, 0x24,
+  0x0d, 0x08, 0x06, 0x24, 0x06, 0x02, 0x07, 0x08, 0x05, 0x23, 0x05, 0x06,
+  0x06, 0x07, 0x05, 0x23, 0x04, 0x08, 0x06, 0x05, 0x05, 0x22, 0x06, 0x09,
+  0x08, 0x01, 0x06, 0x21, 0x07, 0x09, 0x0e, 0x21, 0x08, 0x09, 0x0d, 0x21,
+  0x07, 0x0c, 0x0b, 0x22, 0x05, 0x13, 0x05, 0x23, 0x04, 0x15, 0x04, 0x22,
+  0x05, 0x15, 0x04, 0x22, 0x05, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x23,
+  0x05, 0x13, 0x05, 0x23, 0x1c, 0x25, 0x1b, 0x26, 0x19, 0x28, 0x16, 0x2d,
+  0x10, 0x9b, 0x07, 0xec, 0x4b, 0x11, 0xb0, 0x01, 0x18, 0xa9, 0x01, 0x1e,
+  0xa3, 0x01, 0x22, 0xa1, 0x01, 0x23, 0x9f, 0x01, 0x25, 0x9d, 0x01, 0x27,
+  0x9c, 0x01, 0x27, 0x9c, 0x01, 0x28, 0x9b, 0x01, 0x29, 0x9a, 0x01, 0x2a,
+  0x99, 0x01, 0x2b, 0x98, 0x01, 0x1a, 0x05, 0x0d, 0x97, 0x01, 0x17, 0x09,
+  0x0c, 0x97, 0x01, 0x15, 0x0c, 0x0c, 0x96, 0x01, 0x14, 0x0e, 0x0c, 0x95,
+  0x01, 0x13, 0x10, 0x0c, 0x95, 0x01, 0x11, 0x12, 0x0d, 0x93, 0x01, 0x11,
+  0x13, 0x0d, 0x93, 0x01, 0x10, 0x14, 0x0d, 0x92, 0x01, 0x10, 0x15, 0x0d,
+  0x91, 0x01, 0x10, 0x16, 0x0d, 0x91, 0x01, 0x0f, 0x18, 0x0d, 0x90, 0x01,
+  0x0e, 0x19, 0x0d, 0x8f, 0x01, 0x0e, 0x1a, 0x0d, 0x8f, 0x01, 0x0e, 0x1a,
+  0x0e, 0x8d, 0x01, 0x0e, 0x1c, 0x0d, 0x8d, 0x01, 0x0e, 0x1c, 0x0e, 0x8c,
+  0x01, 0x0d, 0x1d, 0x0e, 0x8c, 0x01, 0x0d, 0x1e, 0x0e, 0x8a, 0x01, 0x0e,
+  0x1e, 0x0f, 0x89, 0x01, 0x0d, 0x20, 0x0e, 0x89, 0x01, 0x0d, 0x20, 0x0f,
+  0x88, 0x01, 0x0d, 0x21, 0x0f, 0x87, 0x01, 0x0d, 0x21, 0x10, 0x86, 0x01,
+  0x0c, 0x23, 0x11, 0x84, 0x01, 0x0c, 0x24, 0x11, 0x83, 0x01, 0x0d, 0x23,
+  0x13, 0x81, 0x01, 0x14, 0x1d, 0x14, 0x7e, 0x18, 0x1b, 0x15, 0x7c, 0x1b,
+  0x19, 0x18, 0x78, 0x1c, 0x18, 0x1a, 0x74, 0x20, 0x17, 0x1a, 0x72, 0x22,
+  0x18, 0x18, 0x71, 0x24, 0x18, 0x17, 0x70, 0x27, 0x17, 0x15, 0x70, 0x28,
+  0x18, 0x14, 0x6f, 0x2a, 0x19, 0x12, 0x6e, 0x2c, 0x19, 0x11, 0x6d, 0x2e,
+  0x1a, 0x0e, 0x6e, 0x14, 0x06, 0x15, 0x19, 0x0e, 0x6d, 0x12, 0x0c, 0x12,
+  0x18, 0x0f, 0x6c, 0x11, 0x10, 0x11, 0x17, 0x0e, 0x6d, 0x10, 0x12, 0x10,
+  0x16, 0x0f, 0x6d, 0x0f, 0x14, 0x10, 0x15, 0x0e, 0x6d, 0x0f, 0x16, 0x0f,
+  0x14, 0x0f, 0x6d, 0x0e, 0x18, 0x10, 0x11, 0x10, 0x6c, 0x0e, 0x1a, 0x14,
+  0x0b, 0x10, 0x6b, 0x10, 0x1a, 0x17, 0x07, 0x10, 0x6a, 0x12, 0x1b, 0x17,
+  0x05, 0x11, 0x68, 0x13, 0x1c, 0x19, 0x01, 0x12, 0x68, 0x14, 0x1c, 0x2b,
+  0x68, 0x15, 0x1d, 0x2a, 0x67, 0x15, 0x1e, 0x29, 0x67, 0x16, 0x1e, 0x28,
+  0x67, 0x17, 0x1e, 0x27, 0x67, 0x18, 0x1e, 0x26, 0x68, 0x18, 0x1e, 0x25,
+  0x68, 0x16, 0x22, 0x23, 0x68, 0x12, 0x34, 0x15, 0x69, 0x10, 0x38, 0x11,
+  0x6b, 0x0f, 0x3a, 0x0f, 0x6b, 0x0f, 0x3c, 0x0e, 0x6b, 0x0e, 0x3e, 0x0e,
+  0x6a, 0x0d, 0x3f, 0x0e, 0x6a, 0x0d, 0x40, 0x0d, 0x69, 0x0e, 0x40, 0x0d,
+  0x69, 0x0d, 0x42, 0x0c, 0x69, 0x0d, 0x42, 0x0c, 0x69, 0x0d, 0x42, 0x0c,
+  0x69, 0x0d, 0x42, 0x0c, 0x69, 0x0d, 0x42, 0x0c, 0x69, 0x0e, 0x40, 0x0d,
+  0x6a, 0x0d, 0x40, 0x0d, 0x6a, 0x0d, 0x3f, 0x0e, 0x6a, 0x0e, 0x3e, 0x0e,
+  0x6a, 0x0f, 0x3c, 0x0e, 0x6c, 0x0f, 0x3a, 0x0f, 0x6c, 0x10, 0x38, 0x10,
+  0x6d, 0x12, 0x32, 0x12, 0x6e, 0x56, 0x6f, 0x54, 0x70, 0x53, 0x72, 0x52,
+  0x73, 0x50, 0x75, 0x4e, 0x77, 0x4c, 0x79, 0x4a, 0x7b, 0x48, 0x7e, 0x44,
+  0x82, 0x01, 0x40, 0x86, 0x01, 0x3c, 0x8c, 0x01, 0x34, 0x80, 0x44, 0xd3,
+  0x01, 0x05, 0x1a, 0x06, 0x14, 0x07, 0x03, 0x02, 0x13, 0x08, 0x04, 0x02,
+  0x11, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03,
+  0x0e, 0x01, 0x09, 0x02, 0x04, 0x03, 0x0b, 0x03, 0x09, 0x05, 0x01, 0x02,
+  0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02,
+  0x0a, 0x02, 0x13, 0x01, 0x0a, 0x02, 0x06, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x05, 0x01, 0x0b, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x0b, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x0c, 0x03,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x0e, 0x03, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x13, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x16, 0x02, 0x02, 0x02, 0x02, 0x02, 0x16, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0x1b, 0x01, 0x1e, 0x02, 0x1e, 0x02, 0x71, 0xea, 0x05, 0x04, 0x39, 0x0a,
+  0x34, 0x0c, 0x33, 0x0c, 0x33, 0x06, 0x04, 0x03, 0x29, 0x08, 0x01, 0x05,
+  0x06, 0x03, 0x27, 0x0f, 0x07, 0x04, 0x25, 0x10, 0x07, 0x04, 0x23, 0x08,
+  0x03, 0x07, 0x07, 0x04, 0x22, 0x06, 0x09, 0x05, 0x07, 0x04, 0x21, 0x05,
+  0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d, 0x05, 0x06, 0x06, 0x1d, 0x04,
+  0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03, 0x08, 0x06, 0x1a, 0x04,
+  0x11, 0x04, 0x09, 0x04, 0x18, 0x06, 0x11, 0x09, 0x03, 0x05, 0x16, 0x07,
+  0x12, 0x0b, 0x01, 0x04, 0x16, 0x08, 0x13, 0x0f, 0x15, 0x06, 0x1c, 0x08,
+  0x15, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04,
+  0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04,
+  0x14, 0x03, 0x0d, 0x01, 0x06, 0x01, 0x06, 0x02, 0x08, 0x04, 0x14, 0x03,
+  0x0c, 0x03, 0x04, 0x03, 0x04, 0x04, 0x07, 0x04, 0x14, 0x04, 0x0a, 0x04,
+  0x04, 0x03, 0x04, 0x04, 0x07, 0x04, 0x14, 0x04, 0x0a, 0x04, 0x04, 0x03,
+  0x04, 0x03, 0x08, 0x03, 0x16, 0x04, 0x09, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x07, 0x04, 0x16, 0x05, 0x08, 0x03, 0x04, 0x04, 0x03, 0x04, 0x06, 0x05,
+  0x17, 0x06, 0x06, 0x03, 0x04, 0x03, 0x04, 0x04, 0x04, 0x06, 0x19, 0x07,
+  0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x03, 0x07, 0x1b, 0x06, 0x03, 0x04,
+  0x03, 0x04, 0x03, 0x04, 0x02, 0x07, 0x1e, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x03, 0x04, 0x02, 0x05, 0x23, 0x01, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04,
+  0x03, 0x01, 0x29, 0x04, 0x03, 0x04, 0x04, 0x03, 0x2e, 0x04, 0x03, 0x04,
+  0x03, 0x04, 0x2e, 0x04, 0x03, 0x04, 0x03, 0x04, 0x2e, 0x03, 0x04, 0x03,
+  0x04, 0x04, 0x2e, 0x03, 0x03, 0x04, 0x04, 0x03, 0x35, 0x04, 0x3c, 0x04,
+  0x3c, 0x03, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x3d, 0x02, 0xe3, 0x02,
+  0xcb, 0x36, 0x10, 0xb1, 0x01, 0x16, 0xab, 0x01, 0x1c, 0xa6, 0x01, 0x1e,
+  0xa4, 0x01, 0x20, 0xa2, 0x01, 0x22, 0xa1, 0x01, 0x23, 0xa0, 0x01, 0x23,
+  0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x14,
+  0x08, 0x0b, 0x9c, 0x01, 0x12, 0x0b, 0x0b, 0x88, 0x01, 0x04, 0x0f, 0x11,
+  0x0d, 0x0b, 0x81, 0x01, 0x12, 0x07, 0x10, 0x0f, 0x0b, 0x7d, 0x1a, 0x03,
+  0x0f, 0x10, 0x0b, 0x7b, 0x2c, 0x12, 0x0b, 0x79, 0x2d, 0x13, 0x0b, 0x77,
+  0x2f, 0x13, 0x0c, 0x74, 0x30, 0x14, 0x0c, 0x73, 0x30, 0x16, 0x0b, 0x71,
+  0x31, 0x17, 0x0c, 0x6f, 0x32, 0x17, 0x0c, 0x6e, 0x34, 0x16, 0x0d, 0x6c,
+  0x18, 0x06, 0x18, 0x16, 0x0c, 0x6b, 0x14, 0x10, 0x14, 0x15, 0x0d, 0x69,
+  0x12, 0x16, 0x12, 0x14, 0x0e, 0x67, 0x11, 0x1a, 0x11, 0x14, 0x0d, 0x66,
+  0x10, 0x1e, 0x10, 0x13, 0x0e, 0x64, 0x10, 0x20, 0x10, 0x13, 0x0e, 0x63,
+  0x0f, 0x22, 0x0f, 0x14, 0x0e, 0x61, 0x0e, 0x26, 0x0e, 0x13, 0x10, 0x5e,
+  0x0e, 0x28, 0x0e, 0x13, 0x10, 0x5d, 0x0d, 0x2a, 0x0d, 0x14, 0x11, 0x5a,
+  0x0d, 0x2b, 0x0e, 0x13, 0x14, 0x57, 0x0d, 0x2c, 0x0d, 0x14, 0x16, 0x53,
+  0x0d, 0x2e, 0x0d, 0x14, 0x17, 0x51, 0x0c, 0x30, 0x0c, 0x15, 0x16, 0x50,
+  0x0d, 0x30, 0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32, 0x0c, 0x16, 0x14, 0x50,
+  0x0c, 0x32, 0x0c, 0x18, 0x12, 0x4f, 0x0c, 0x34, 0x0b, 0x19, 0x11, 0x4f,
+  0x0c, 0x34, 0x0c, 0x1a, 0x0e, 0x50, 0x0b, 0x36, 0x11, 0x16, 0x0c, 0x4e,
+  0x0d, 0x36, 0x16, 0x11, 0x0c, 0x4b, 0x10, 0x36, 0x19, 0x0d, 0x0c, 0x4a,
+  0x12, 0x36, 0x1c, 0x09, 0x0d, 0x48, 0x14, 0x37, 0x1d, 0x07, 0x0d, 0x46,
+  0x15, 0x38, 0x1e, 0x05, 0x0d, 0x46, 0x16, 0x38, 0x20, 0x02, 0x0e, 0x45,
+  0x17, 0x38, 0x2f, 0x44, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2e, 0x43,
+  0x1b, 0x38, 0x2d, 0x44, 0x14, 0x4e, 0x1e, 0x43, 0x12, 0x55, 0x19, 0x43,
+  0x10, 0x5b, 0x15, 0x43, 0x10, 0x5d, 0x13, 0x43, 0x0f, 0x61, 0x10, 0x44,
+  0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42,
+  0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0d, 0x6b, 0x0c, 0x40,
+  0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3f, 0x0b, 0x6f, 0x0b, 0x3e,
+  0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x72, 0x0a, 0x3d, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x26, 0x04, 0x12,
+  0x04, 0x12, 0x04, 0x1c, 0x0b, 0x3c, 0x0b, 0x24, 0x08, 0x0f, 0x07, 0x0e,
+  0x08, 0x19, 0x0b, 0x3d, 0x0b, 0x23, 0x0a, 0x0d, 0x09, 0x0c, 0x0a, 0x18,
+  0x0b, 0x3d, 0x0b, 0x23, 0x0a, 0x0c, 0x0a, 0x0c, 0x0a, 0x18, 0x0b, 0x3d,
+  0x0b, 0x23, 0x0a, 0x0c, 0x0b, 0x0b, 0x0a, 0x18, 0x0b, 0x3d, 0x0c, 0x21,
+  0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x17, 0x0b, 0x3d, 0x0c, 0x21, 0x0b, 0x0b,
+  0x0c, 0x0a, 0x0c, 0x16, 0x0c, 0x3e, 0x0b, 0x21, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x17, 0x0c, 0x3e, 0x0c, 0x20, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x17,
+  0x0b, 0x3f, 0x0c, 0x1f, 0x0c, 0x0b, 0x0b, 0x0a, 0x0c, 0x16, 0x0c, 0x40,
+  0x0c, 0x1e, 0x0b, 0x0b, 0x0c, 0x0a, 0x0c, 0x15, 0x0d, 0x40, 0x0c, 0x1e,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x41, 0x0d, 0x1d, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x15, 0x0d, 0x42, 0x0d, 0x1b, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x14, 0x0d, 0x43, 0x0e, 0x1a, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x13,
+  0x0e, 0x44, 0x0e, 0x19, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x13, 0x0e, 0x45,
+  0x0f, 0x18, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x12, 0x0f, 0x46, 0x10, 0x15,
+  0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x11, 0x0f, 0x48, 0x10, 0x14, 0x0c, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x0f, 0x10, 0x4a, 0x11, 0x12, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0e, 0x12, 0x4b, 0x14, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a,
+  0x15, 0x4c, 0x18, 0x09, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x18, 0x4e,
+  0x17, 0x09, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x06, 0x17, 0x50, 0x16, 0x09,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x07, 0x16, 0x53, 0x14, 0x09, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x07, 0x15, 0x55, 0x13, 0x08, 0x0c, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x07, 0x14, 0x57, 0x12, 0x08, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x07,
+  0x12, 0x5b, 0x10, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x11, 0x5e,
+  0x0e, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0f, 0x62, 0x0c, 0x07,
+  0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0d, 0x67, 0x09, 0x07, 0x0c, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x08, 0x0a, 0x6e, 0x05, 0x07, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x09, 0x05, 0x7f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c,
+  0x0a, 0x0c, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x8c,
+  0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x8c, 0x01,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0b, 0x0b,
+  0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0c, 0x8c, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8d, 0x01, 0x0b,
+  0x0a, 0x0c, 0x0b, 0x0b, 0x8e, 0x01, 0x0a, 0x0a, 0x0c, 0x0c, 0x0a, 0x8e,
+  0x01, 0x09, 0x0b, 0x0b, 0x0d, 0x09, 0x90, 0x01, 0x07, 0x0c, 0x0b, 0x0e,
+  0x08, 0x92, 0x01, 0x03, 0x0d, 0x0c, 0x11, 0x03, 0xa4, 0x01, 0x0c, 0xb8,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x09, 0xbb,
+  0x01, 0x09, 0xbc, 0x01, 0x07, 0xab, 0x19, 0xd3, 0x01, 0x05, 0x1a, 0x03,
+  0x01, 0x02, 0x14, 0x07, 0x03, 0x02, 0x12, 0x09, 0x04, 0x02, 0x11, 0x02,
+  0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0e, 0x01,
+  0x09, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b, 0x04,
+  0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02,
+  0x13, 0x01, 0x0a, 0x02, 0x06, 0x01, 0x06, 0x01, 0x05, 0x01, 0x0b, 0x02,
+  0x05, 0x02, 0x05, 0x02, 0x03, 0x02, 0x0b, 0x02, 0x05, 0x01, 0x06, 0x01,
+  0x04, 0x02, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x03, 0x16, 0x02, 0x1b, 0x01, 0x06, 0x01, 0x17, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x1b, 0x01, 0x3e, 0x02, 0x1e, 0x01, 0x52, 0xea,
+  0x05, 0x04, 0x39, 0x0a, 0x34, 0x0c, 0x33, 0x0c, 0x33, 0x06, 0x04, 0x03,
+  0x29, 0x08, 0x01, 0x05, 0x06, 0x03, 0x27, 0x0f, 0x07, 0x04, 0x25, 0x10,
+  0x07, 0x04, 0x23, 0x08, 0x03, 0x07, 0x07, 0x04, 0x22, 0x06, 0x09, 0x05,
+  0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d, 0x05,
+  0x06, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03,
+  0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x09, 0x04, 0x18, 0x06, 0x11, 0x09,
+  0x03, 0x05, 0x16, 0x07, 0x12, 0x0b, 0x01, 0x04, 0x16, 0x08, 0x13, 0x0f,
+  0x15, 0x06, 0x1c, 0x08, 0x15, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04,
+  0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x0d, 0x01, 0x0d, 0x01, 0x09, 0x04,
+  0x14, 0x03, 0x0c, 0x03, 0x0b, 0x03, 0x08, 0x04, 0x14, 0x04, 0x0b, 0x03,
+  0x0b, 0x03, 0x08, 0x04, 0x14, 0x04, 0x0a, 0x04, 0x0a, 0x04, 0x08, 0x03,
+  0x16, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x07, 0x04, 0x16, 0x05, 0x09, 0x02,
+  0x0c, 0x02, 0x07, 0x05, 0x17, 0x06, 0x1c, 0x06, 0x19, 0x07, 0x04, 0x02,
+  0x05, 0x02, 0x05, 0x02, 0x03, 0x08, 0x1b, 0x06, 0x03, 0x03, 0x04, 0x04,
+  0x03, 0x03, 0x03, 0x07, 0x1d, 0x05, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x23, 0x01, 0x04, 0x01, 0x05, 0x03, 0x05, 0x02, 0x04, 0x01,
+  0x31, 0x03, 0x35, 0x02, 0x0d, 0x01, 0x30, 0x03, 0x0b, 0x03, 0x2e, 0x04,
+  0x04, 0x02, 0x05, 0x03, 0x2e, 0x04, 0x03, 0x04, 0x04, 0x03, 0x2f, 0x02,
+  0x05, 0x03, 0x04, 0x03, 0xb4, 0x01, 0x03, 0x3d, 0x04, 0x3c, 0x03, 0x3d,
+  0x03, 0x3e, 0x01, 0xa4, 0x02, 0xcb, 0x36, 0x0f, 0xb2, 0x01, 0x16, 0xab,
+  0x01, 0x1c, 0xa6, 0x01, 0x1e, 0xa4, 0x01, 0x20, 0xa2, 0x01, 0x22, 0xa1,
+  0x01, 0x23, 0xa0, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e,
+  0x01, 0x18, 0x01, 0x0d, 0x9d, 0x01, 0x13, 0x09, 0x0b, 0x9c, 0x01, 0x11,
+  0x0c, 0x0b, 0x88, 0x01, 0x04, 0x0f, 0x10, 0x0e, 0x0b, 0x80, 0x01, 0x13,
+  0x07, 0x10, 0x0f, 0x0b, 0x7d, 0x19, 0x04, 0x0f, 0x10, 0x0b, 0x7a, 0x2d,
+  0x12, 0x0b, 0x78, 0x2e, 0x13, 0x0b, 0x76, 0x30, 0x13, 0x0c, 0x74, 0x30,
+  0x14, 0x0c, 0x72, 0x31, 0x16, 0x0b, 0x71, 0x31, 0x17, 0x0c, 0x6f, 0x32,
+  0x17, 0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6c, 0x18, 0x08, 0x17, 0x16, 0x0c,
+  0x6b, 0x14, 0x10, 0x14, 0x15, 0x0d, 0x69, 0x12, 0x16, 0x12, 0x15, 0x0c,
+  0x68, 0x11, 0x1a, 0x11, 0x14, 0x0d, 0x66, 0x10, 0x1e, 0x10, 0x14, 0x0d,
+  0x64, 0x10, 0x20, 0x10, 0x13, 0x0e, 0x62, 0x0f, 0x23, 0x0f, 0x14, 0x0e,
+  0x61, 0x0e, 0x26, 0x0e, 0x13, 0x0f, 0x5f, 0x0e, 0x28, 0x0e, 0x13, 0x10,
+  0x5d, 0x0d, 0x2a, 0x0d, 0x14, 0x11, 0x5a, 0x0d, 0x2c, 0x0d, 0x13, 0x13,
+  0x57, 0x0e, 0x2c, 0x0d, 0x14, 0x15, 0x54, 0x0d, 0x2e, 0x0d, 0x14, 0x17,
+  0x51, 0x0c, 0x30, 0x0c, 0x15, 0x16, 0x50, 0x0d, 0x30, 0x0c, 0x16, 0x15,
+  0x50, 0x0c, 0x32, 0x0c, 0x17, 0x13, 0x4f, 0x0d, 0x32, 0x0c, 0x18, 0x12,
+  0x4f, 0x0c, 0x34, 0x0b, 0x1a, 0x0f, 0x50, 0x0c, 0x34, 0x0c, 0x1a, 0x0e,
+  0x50, 0x0b, 0x36, 0x11, 0x16, 0x0c, 0x4e, 0x0d, 0x36, 0x16, 0x11, 0x0c,
+  0x4b, 0x10, 0x36, 0x19, 0x0d, 0x0c, 0x4a, 0x12, 0x36, 0x1c, 0x09, 0x0d,
+  0x48, 0x14, 0x36, 0x1e, 0x07, 0x0d, 0x46, 0x15, 0x38, 0x1e, 0x05, 0x0d,
+  0x46, 0x16, 0x38, 0x20, 0x02, 0x0e, 0x45, 0x17, 0x38, 0x2f, 0x44, 0x19,
+  0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2e, 0x43, 0x1a, 0x39, 0x2d, 0x43, 0x16,
+  0x4e, 0x1c, 0x44, 0x12, 0x55, 0x19, 0x43, 0x10, 0x5b, 0x15, 0x43, 0x10,
+  0x5d, 0x13, 0x43, 0x0f, 0x61, 0x10, 0x44, 0x0e, 0x63, 0x0e, 0x44, 0x0e,
+  0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42, 0x0d, 0x69, 0x0d, 0x41, 0x0c,
+  0x6b, 0x0c, 0x40, 0x0d, 0x6b, 0x0c, 0x40, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c,
+  0x6d, 0x0c, 0x3f, 0x0b, 0x6f, 0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c,
+  0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b,
+  0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b,
+  0x71, 0x0b, 0x3d, 0x0b, 0x26, 0x04, 0x47, 0x0b, 0x3d, 0x0b, 0x25, 0x07,
+  0x24, 0x07, 0x1a, 0x0b, 0x3d, 0x0b, 0x24, 0x09, 0x22, 0x09, 0x19, 0x0b,
+  0x3d, 0x0b, 0x23, 0x0a, 0x22, 0x0a, 0x18, 0x0b, 0x3d, 0x0b, 0x23, 0x0b,
+  0x20, 0x0b, 0x18, 0x0b, 0x3d, 0x0c, 0x21, 0x0c, 0x20, 0x0b, 0x18, 0x0b,
+  0x3d, 0x0c, 0x21, 0x0c, 0x20, 0x0b, 0x17, 0x0c, 0x3e, 0x0b, 0x21, 0x0b,
+  0x21, 0x0b, 0x17, 0x0b, 0x3f, 0x0c, 0x20, 0x0b, 0x20, 0x0c, 0x16, 0x0c,
+  0x3f, 0x0c, 0x1f, 0x0c, 0x20, 0x0b, 0x17, 0x0c, 0x3f, 0x0d, 0x1e, 0x0b,
+  0x21, 0x0b, 0x16, 0x0d, 0x40, 0x0d, 0x1d, 0x0b, 0x20, 0x0c, 0x16, 0x0c,
+  0x41, 0x0d, 0x1d, 0x0b, 0x21, 0x0b, 0x15, 0x0d, 0x42, 0x0d, 0x1c, 0x0b,
+  0x21, 0x0a, 0x15, 0x0d, 0x43, 0x0e, 0x1c, 0x09, 0x22, 0x0a, 0x14, 0x0e,
+  0x44, 0x0e, 0x1b, 0x08, 0x24, 0x08, 0x14, 0x0e, 0x45, 0x0f, 0x1c, 0x05,
+  0x26, 0x06, 0x14, 0x0f, 0x46, 0x10, 0x5e, 0x0f, 0x48, 0x10, 0x5b, 0x10,
+  0x4a, 0x11, 0x57, 0x12, 0x4a, 0x15, 0x27, 0x01, 0x27, 0x15, 0x4c, 0x18,
+  0x0c, 0x03, 0x12, 0x06, 0x20, 0x18, 0x4e, 0x17, 0x0a, 0x07, 0x0e, 0x09,
+  0x0e, 0x06, 0x0b, 0x17, 0x50, 0x16, 0x09, 0x09, 0x0d, 0x0a, 0x0c, 0x08,
+  0x0a, 0x16, 0x52, 0x15, 0x08, 0x0a, 0x0c, 0x0b, 0x0b, 0x0a, 0x09, 0x15,
+  0x55, 0x13, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x14, 0x57, 0x12,
+  0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x12, 0x5b, 0x10, 0x08, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x11, 0x5d, 0x0f, 0x08, 0x0a, 0x0b, 0x0c,
+  0x0b, 0x0a, 0x09, 0x0f, 0x62, 0x0c, 0x09, 0x09, 0x0b, 0x0b, 0x0c, 0x0a,
+  0x09, 0x0d, 0x66, 0x0a, 0x0a, 0x07, 0x0c, 0x0b, 0x0d, 0x08, 0x0a, 0x0a,
+  0x6e, 0x05, 0x0b, 0x05, 0x0d, 0x0b, 0x0e, 0x06, 0x0b, 0x06, 0x94, 0x01,
+  0x0b, 0xb9, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xa6, 0x01,
+  0x02, 0x15, 0x06, 0xa5, 0x01, 0x06, 0x16, 0x01, 0x0f, 0x06, 0x91, 0x01,
+  0x09, 0x23, 0x08, 0x8f, 0x01, 0x0a, 0x22, 0x0a, 0x8e, 0x01, 0x0b, 0x21,
+  0x0a, 0x8e, 0x01, 0x0b, 0x20, 0x0c, 0x8c, 0x01, 0x0c, 0x0c, 0x06, 0x0e,
+  0x0c, 0x8c, 0x01, 0x0c, 0x0b, 0x08, 0x0d, 0x0b, 0x8d, 0x01, 0x0b, 0x0b,
+  0x0a, 0x0c, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0a, 0x0c, 0x0b, 0x8d, 0x01,
+  0x0b, 0x0b, 0x0a, 0x0c, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0a, 0x0c, 0x0a,
+  0x8f, 0x01, 0x09, 0x0c, 0x0a, 0x0c, 0x0a, 0x8f, 0x01, 0x09, 0x0c, 0x0a,
+  0x0d, 0x09, 0x90, 0x01, 0x07, 0x0e, 0x08, 0x0f, 0x07, 0x94, 0x01, 0x02,
+  0x11, 0x06, 0x11, 0x04, 0xf9, 0x08, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x09, 0xbc, 0x01, 0x07, 0xbf, 0x01,
+  0x03, 0xe2, 0x14, 0xd3, 0x01, 0x05, 0x1a, 0x06, 0x14, 0x07, 0x03, 0x02,
+  0x13, 0x08, 0x04, 0x02, 0x11, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02,
+  0x07, 0x02, 0x04, 0x03, 0x0e, 0x01, 0x09, 0x02, 0x04, 0x03, 0x0b, 0x03,
+  0x09, 0x05, 0x01, 0x02, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x02, 0x10, 0x03,
+  0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02, 0x13, 0x01, 0x0a, 0x02, 0x13, 0x01,
+  0x0b, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x06, 0x01, 0x03, 0x02, 0x05, 0x02,
+  0x0c, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x0e, 0x02, 0x02, 0x03,
+  0x02, 0x02, 0x02, 0x04, 0x12, 0x03, 0x02, 0x02, 0x02, 0x03, 0x15, 0x01,
+  0x02, 0x02, 0x03, 0x02, 0x18, 0x03, 0x02, 0x02, 0x14, 0x02, 0x03, 0x02,
+  0x1e, 0x01, 0x03, 0x01, 0x19, 0x01, 0x05, 0x01, 0x19, 0x01, 0x54, 0xeb,
+  0x05, 0x03, 0x39, 0x0a, 0x34, 0x0c, 0x33, 0x0c, 0x33, 0x06, 0x04, 0x03,
+  0x29, 0x08, 0x02, 0x05, 0x05, 0x03, 0x27, 0x0f, 0x07, 0x04, 0x25, 0x10,
+  0x07, 0x04, 0x23, 0x09, 0x01, 0x08, 0x07, 0x04, 0x22, 0x06, 0x09, 0x05,
+  0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d, 0x05,
+  0x06, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03,
+  0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x08, 0x05, 0x18, 0x05, 0x12, 0x09,
+  0x03, 0x05, 0x16, 0x07, 0x12, 0x0a, 0x02, 0x04, 0x16, 0x08, 0x13, 0x0f,
+  0x15, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x16, 0x04, 0x22, 0x04,
+  0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x23, 0x04, 0x16, 0x04, 0x0c, 0x03,
+  0x06, 0x02, 0x0b, 0x04, 0x16, 0x05, 0x0a, 0x04, 0x05, 0x04, 0x09, 0x05,
+  0x17, 0x05, 0x08, 0x05, 0x04, 0x05, 0x07, 0x06, 0x19, 0x07, 0x05, 0x04,
+  0x05, 0x04, 0x05, 0x08, 0x1b, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x08,
+  0x1d, 0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x07, 0x26, 0x05, 0x04, 0x05,
+  0x04, 0x05, 0x29, 0x04, 0x04, 0x05, 0x04, 0x05, 0x2a, 0x03, 0x05, 0x04,
+  0x04, 0x05, 0x2b, 0x02, 0x05, 0x04, 0x05, 0x04, 0x32, 0x05, 0x04, 0x04,
+  0x2a, 0x01, 0x07, 0x05, 0x05, 0x04, 0x29, 0x03, 0x05, 0x05, 0x07, 0x02,
+  0x2a, 0x03, 0x05, 0x04, 0x34, 0x03, 0x06, 0x02, 0x05, 0x03, 0x3d, 0x03,
+  0x3d, 0x03, 0x32, 0x03, 0x09, 0x01, 0x33, 0x03, 0x3d, 0x03, 0xa7, 0x02,
+  0xcd, 0x36, 0x0c, 0xb4, 0x01, 0x14, 0xad, 0x01, 0x1a, 0xa7, 0x01, 0x1e,
+  0xa4, 0x01, 0x20, 0xa3, 0x01, 0x21, 0xa1, 0x01, 0x23, 0xa0, 0x01, 0x23,
+  0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x15,
+  0x06, 0x0c, 0x9c, 0x01, 0x12, 0x0a, 0x0c, 0x9b, 0x01, 0x11, 0x0c, 0x0c,
+  0x81, 0x01, 0x11, 0x09, 0x0f, 0x0f, 0x0b, 0x7e, 0x18, 0x04, 0x0f, 0x10,
+  0x0b, 0x7b, 0x1d, 0x01, 0x0f, 0x11, 0x0b, 0x79, 0x2e, 0x12, 0x0b, 0x77,
+  0x2f, 0x13, 0x0c, 0x74, 0x30, 0x14, 0x0c, 0x73, 0x30, 0x15, 0x0c, 0x71,
+  0x31, 0x17, 0x0b, 0x70, 0x32, 0x17, 0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6d,
+  0x36, 0x16, 0x0c, 0x6b, 0x14, 0x0f, 0x15, 0x15, 0x0d, 0x69, 0x12, 0x15,
+  0x13, 0x14, 0x0d, 0x68, 0x11, 0x19, 0x12, 0x14, 0x0d, 0x66, 0x10, 0x1d,
+  0x11, 0x13, 0x0e, 0x64, 0x10, 0x20, 0x0f, 0x14, 0x0e, 0x62, 0x10, 0x22,
+  0x0f, 0x13, 0x0f, 0x61, 0x0e, 0x25, 0x0f, 0x13, 0x0f, 0x5f, 0x0e, 0x27,
+  0x0e, 0x14, 0x10, 0x5d, 0x0d, 0x29, 0x0e, 0x13, 0x12, 0x5a, 0x0d, 0x2b,
+  0x0d, 0x14, 0x13, 0x58, 0x0d, 0x2c, 0x0d, 0x14, 0x15, 0x54, 0x0d, 0x2e,
+  0x0c, 0x15, 0x17, 0x51, 0x0c, 0x30, 0x0c, 0x15, 0x17, 0x4f, 0x0d, 0x30,
+  0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32, 0x0c, 0x16, 0x14, 0x50, 0x0c, 0x32,
+  0x0c, 0x17, 0x13, 0x4f, 0x0c, 0x34, 0x0b, 0x19, 0x11, 0x4f, 0x0c, 0x34,
+  0x0b, 0x1a, 0x0f, 0x50, 0x0b, 0x35, 0x0f, 0x18, 0x0d, 0x4e, 0x0d, 0x36,
+  0x15, 0x12, 0x0c, 0x4b, 0x10, 0x36, 0x19, 0x0d, 0x0d, 0x49, 0x12, 0x36,
+  0x1b, 0x0a, 0x0d, 0x48, 0x13, 0x37, 0x1d, 0x08, 0x0d, 0x46, 0x15, 0x38,
+  0x1d, 0x06, 0x0d, 0x46, 0x16, 0x38, 0x1f, 0x03, 0x0e, 0x45, 0x17, 0x38,
+  0x20, 0x01, 0x0e, 0x44, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2e, 0x43,
+  0x1a, 0x39, 0x2d, 0x43, 0x18, 0x4a, 0x1f, 0x43, 0x13, 0x54, 0x19, 0x43,
+  0x11, 0x59, 0x16, 0x43, 0x10, 0x5d, 0x13, 0x43, 0x10, 0x5f, 0x11, 0x44,
+  0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42,
+  0x0d, 0x69, 0x0d, 0x41, 0x0d, 0x69, 0x0d, 0x40, 0x0d, 0x6b, 0x0c, 0x40,
+  0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0b, 0x6f, 0x0b, 0x3e,
+  0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x6f, 0x0c, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x70, 0x0c, 0x3d, 0x0c, 0x6f, 0x0c, 0x3d,
+  0x0c, 0x6f, 0x0b, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f,
+  0x0d, 0x6b, 0x0d, 0x40, 0x0c, 0x29, 0x03, 0x3f, 0x0c, 0x41, 0x0d, 0x26,
+  0x07, 0x15, 0x05, 0x22, 0x0d, 0x42, 0x0d, 0x24, 0x09, 0x13, 0x07, 0x20,
+  0x0d, 0x43, 0x0e, 0x23, 0x0a, 0x11, 0x09, 0x1e, 0x0e, 0x44, 0x0e, 0x21,
+  0x0b, 0x10, 0x0b, 0x1c, 0x0e, 0x45, 0x0f, 0x1f, 0x0c, 0x0f, 0x0c, 0x1b,
+  0x0f, 0x46, 0x0f, 0x1d, 0x0d, 0x0e, 0x0d, 0x1a, 0x0f, 0x48, 0x10, 0x1a,
+  0x0e, 0x0e, 0x0d, 0x18, 0x10, 0x49, 0x12, 0x18, 0x0e, 0x0d, 0x0e, 0x16,
+  0x12, 0x4a, 0x14, 0x14, 0x0e, 0x0d, 0x0e, 0x14, 0x14, 0x4c, 0x17, 0x0f,
+  0x0e, 0x0d, 0x0e, 0x0f, 0x19, 0x4e, 0x16, 0x0e, 0x0e, 0x0d, 0x0f, 0x0d,
+  0x1a, 0x50, 0x14, 0x0e, 0x0f, 0x0d, 0x0e, 0x0d, 0x1a, 0x52, 0x12, 0x0e,
+  0x0f, 0x0d, 0x0e, 0x0d, 0x1a, 0x54, 0x10, 0x0f, 0x0e, 0x0d, 0x0e, 0x0d,
+  0x1a, 0x57, 0x0d, 0x0f, 0x0e, 0x0d, 0x0e, 0x0e, 0x18, 0x5a, 0x0c, 0x0e,
+  0x0e, 0x0d, 0x0f, 0x0d, 0x17, 0x5e, 0x09, 0x0e, 0x0f, 0x0d, 0x0e, 0x0d,
+  0x17, 0x61, 0x06, 0x0e, 0x0f, 0x0d, 0x0e, 0x0d, 0x15, 0x67, 0x02, 0x0f,
+  0x0e, 0x0d, 0x0e, 0x0d, 0x14, 0x79, 0x0e, 0x0d, 0x0e, 0x0e, 0x0f, 0x7d,
+  0x0e, 0x0d, 0x0f, 0x0d, 0x0e, 0x7e, 0x0f, 0x0d, 0x0e, 0x0d, 0x0e, 0x7f,
+  0x0e, 0x0d, 0x0e, 0x0d, 0x0e, 0x80, 0x01, 0x0d, 0x0d, 0x0e, 0x0d, 0x0e,
+  0x81, 0x01, 0x0c, 0x0d, 0x0e, 0x0e, 0x0e, 0x81, 0x01, 0x0b, 0x0d, 0x0f,
+  0x0d, 0x0e, 0x82, 0x01, 0x0b, 0x0d, 0x0e, 0x0d, 0x0e, 0x84, 0x01, 0x09,
+  0x0d, 0x0e, 0x0d, 0x0e, 0x86, 0x01, 0x06, 0x0e, 0x0e, 0x0d, 0x0f, 0x89,
+  0x01, 0x01, 0x0f, 0x0e, 0x0e, 0x0e, 0x99, 0x01, 0x0f, 0x0d, 0x0e, 0x9a,
+  0x01, 0x0e, 0x0d, 0x0e, 0x9a, 0x01, 0x0e, 0x0e, 0x0d, 0x9a, 0x01, 0x0e,
+  0x0f, 0x0d, 0x80, 0x01, 0x03, 0x16, 0x0e, 0x10, 0x0c, 0x7f, 0x07, 0x13,
+  0x0f, 0x11, 0x0a, 0x7f, 0x09, 0x12, 0x0e, 0x12, 0x09, 0x7f, 0x0a, 0x11,
+  0x0e, 0x14, 0x07, 0x80, 0x01, 0x0b, 0x0f, 0x0e, 0x16, 0x05, 0x81, 0x01,
+  0x0b, 0x0f, 0x0d, 0x9d, 0x01, 0x0b, 0x0f, 0x0d, 0x9d, 0x01, 0x0b, 0x0f,
+  0x0c, 0x9f, 0x01, 0x09, 0x10, 0x0b, 0xa0, 0x01, 0x09, 0x11, 0x09, 0x0f,
+  0x07, 0x8c, 0x01, 0x06, 0x14, 0x07, 0x0f, 0x09, 0xa6, 0x01, 0x05, 0x0f,
+  0x0a, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0x9b, 0x01, 0x03, 0x1c, 0x09, 0x9a, 0x01, 0x07, 0x1a, 0x09, 0x99,
+  0x01, 0x09, 0x1b, 0x05, 0x9b, 0x01, 0x09, 0xba, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x09, 0xbc, 0x01,
+  0x08, 0xbd, 0x01, 0x05, 0xaa, 0x13, 0xd3, 0x01, 0x05, 0x1a, 0x06, 0x14,
+  0x08, 0x02, 0x02, 0x12, 0x09, 0x04, 0x02, 0x11, 0x02, 0x05, 0x03, 0x03,
+  0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0e, 0x01, 0x09, 0x02, 0x04,
+  0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b, 0x04, 0x0a, 0x07, 0x0a,
+  0x02, 0x10, 0x03, 0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02, 0x13, 0x01, 0x0a,
+  0x02, 0x06, 0x01, 0x06, 0x01, 0x05, 0x01, 0x0b, 0x02, 0x05, 0x02, 0x05,
+  0x02, 0x03, 0x02, 0x0b, 0x02, 0x05, 0x01, 0x06, 0x01, 0x04, 0x02, 0x0c,
+  0x03, 0x0d, 0x03, 0x0e, 0x03, 0x04, 0x02, 0x05, 0x03, 0x13, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x17, 0x02, 0x05, 0x02, 0x17, 0x02, 0x05, 0x02, 0x3a,
+  0x02, 0x1e, 0x02, 0x71, 0xeb, 0x05, 0x02, 0x3a, 0x0a, 0x34, 0x0c, 0x33,
+  0x0c, 0x33, 0x07, 0x03, 0x03, 0x29, 0x08, 0x02, 0x05, 0x05, 0x03, 0x27,
+  0x0f, 0x07, 0x04, 0x25, 0x10, 0x07, 0x04, 0x23, 0x09, 0x01, 0x08, 0x07,
+  0x04, 0x22, 0x06, 0x09, 0x05, 0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06,
+  0x05, 0x1f, 0x05, 0x0d, 0x04, 0x07, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07,
+  0x07, 0x1a, 0x04, 0x10, 0x04, 0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x08,
+  0x05, 0x18, 0x06, 0x11, 0x09, 0x03, 0x05, 0x16, 0x07, 0x12, 0x0a, 0x02,
+  0x04, 0x16, 0x08, 0x12, 0x10, 0x15, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f,
+  0x06, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x0d,
+  0x01, 0x0d, 0x01, 0x09, 0x04, 0x14, 0x04, 0x0b, 0x03, 0x0b, 0x03, 0x08,
+  0x04, 0x14, 0x04, 0x0a, 0x04, 0x0b, 0x04, 0x07, 0x04, 0x14, 0x04, 0x0a,
+  0x04, 0x0b, 0x03, 0x07, 0x04, 0x16, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x07,
+  0x04, 0x16, 0x05, 0x09, 0x02, 0x0c, 0x03, 0x06, 0x04, 0x18, 0x06, 0x1c,
+  0x06, 0x19, 0x07, 0x0b, 0x02, 0x0a, 0x08, 0x1b, 0x06, 0x0a, 0x04, 0x09,
+  0x07, 0x1e, 0x04, 0x0a, 0x03, 0x0a, 0x05, 0x23, 0x01, 0x0a, 0x03, 0x0b,
+  0x01, 0x29, 0x03, 0x05, 0x03, 0x03, 0x03, 0x2f, 0x03, 0x05, 0x02, 0x04,
+  0x04, 0x2d, 0x04, 0x0b, 0x03, 0x2e, 0x04, 0x0b, 0x03, 0x2f, 0x02, 0x0c,
+  0x03, 0x75, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x03, 0x3d, 0x03, 0x3d,
+  0x03, 0xe3, 0x02, 0xcd, 0x36, 0x0c, 0xb4, 0x01, 0x14, 0xad, 0x01, 0x1b,
+  0xa7, 0x01, 0x1d, 0xa5, 0x01, 0x1f, 0xa3, 0x01, 0x21, 0xa2, 0x01, 0x22,
+  0xa0, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26,
+  0x9d, 0x01, 0x15, 0x07, 0x0b, 0x9c, 0x01, 0x13, 0x0a, 0x0b, 0x9b, 0x01,
+  0x12, 0x0c, 0x0b, 0x81, 0x01, 0x11, 0x09, 0x10, 0x0e, 0x0b, 0x7d, 0x19,
+  0x04, 0x0f, 0x10, 0x0b, 0x7b, 0x2d, 0x11, 0x0b, 0x79, 0x2e, 0x12, 0x0b,
+  0x77, 0x2f, 0x13, 0x0c, 0x74, 0x30, 0x14, 0x0c, 0x73, 0x30, 0x15, 0x0c,
+  0x71, 0x32, 0x16, 0x0c, 0x6f, 0x32, 0x17, 0x0c, 0x6e, 0x34, 0x16, 0x0c,
+  0x6d, 0x36, 0x16, 0x0c, 0x6b, 0x14, 0x0f, 0x15, 0x15, 0x0d, 0x69, 0x12,
+  0x15, 0x13, 0x14, 0x0d, 0x68, 0x11, 0x19, 0x12, 0x14, 0x0d, 0x66, 0x10,
+  0x1d, 0x11, 0x13, 0x0e, 0x64, 0x10, 0x20, 0x0f, 0x14, 0x0e, 0x63, 0x0f,
+  0x22, 0x0f, 0x13, 0x0f, 0x61, 0x0e, 0x25, 0x0f, 0x13, 0x0f, 0x5f, 0x0e,
+  0x27, 0x0e, 0x14, 0x10, 0x5d, 0x0d, 0x29, 0x0e, 0x13, 0x11, 0x5b, 0x0d,
+  0x2b, 0x0d, 0x14, 0x13, 0x58, 0x0d, 0x2c, 0x0d, 0x14, 0x15, 0x54, 0x0d,
+  0x2e, 0x0c, 0x15, 0x17, 0x51, 0x0c, 0x2f, 0x0d, 0x15, 0x16, 0x50, 0x0d,
+  0x30, 0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32, 0x0c, 0x16, 0x14, 0x50, 0x0c,
+  0x32, 0x0c, 0x17, 0x13, 0x4f, 0x0c, 0x33, 0x0c, 0x19, 0x10, 0x50, 0x0c,
+  0x34, 0x0b, 0x1a, 0x0f, 0x50, 0x0b, 0x35, 0x12, 0x15, 0x0d, 0x4e, 0x0d,
+  0x36, 0x16, 0x11, 0x0c, 0x4b, 0x10, 0x36, 0x19, 0x0d, 0x0c, 0x4a, 0x12,
+  0x36, 0x1b, 0x0a, 0x0d, 0x48, 0x13, 0x37, 0x1d, 0x08, 0x0d, 0x46, 0x15,
+  0x37, 0x1e, 0x06, 0x0d, 0x46, 0x16, 0x37, 0x20, 0x03, 0x0e, 0x45, 0x17,
+  0x38, 0x20, 0x01, 0x0e, 0x44, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2e,
+  0x43, 0x1a, 0x39, 0x2d, 0x43, 0x16, 0x4c, 0x1f, 0x43, 0x12, 0x55, 0x19,
+  0x43, 0x11, 0x59, 0x16, 0x43, 0x10, 0x5d, 0x13, 0x43, 0x0f, 0x60, 0x11,
+  0x44, 0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65, 0x0d, 0x44, 0x0d, 0x67, 0x0d,
+  0x42, 0x0d, 0x69, 0x0c, 0x42, 0x0d, 0x69, 0x0d, 0x40, 0x0d, 0x6b, 0x0c,
+  0x40, 0x0c, 0x6d, 0x0b, 0x40, 0x0c, 0x6d, 0x0c, 0x3f, 0x0b, 0x6f, 0x0b,
+  0x3e, 0x0c, 0x6f, 0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x26, 0x04,
+  0x29, 0x02, 0x1c, 0x0b, 0x3d, 0x0b, 0x24, 0x08, 0x25, 0x06, 0x1a, 0x0b,
+  0x3d, 0x0b, 0x23, 0x09, 0x24, 0x08, 0x19, 0x0b, 0x3d, 0x0b, 0x23, 0x0a,
+  0x22, 0x0a, 0x18, 0x0b, 0x3d, 0x0b, 0x22, 0x0b, 0x22, 0x0a, 0x18, 0x0b,
+  0x3d, 0x0c, 0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0c, 0x3d, 0x0c, 0x21, 0x0b,
+  0x21, 0x0b, 0x17, 0x0b, 0x3f, 0x0b, 0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0b,
+  0x3f, 0x0c, 0x1f, 0x0c, 0x21, 0x0b, 0x16, 0x0c, 0x3f, 0x0c, 0x1f, 0x0c,
+  0x20, 0x0c, 0x16, 0x0c, 0x3f, 0x0d, 0x1e, 0x0b, 0x21, 0x0b, 0x16, 0x0c,
+  0x41, 0x0d, 0x1d, 0x0b, 0x21, 0x0b, 0x15, 0x0d, 0x41, 0x0d, 0x1c, 0x0c,
+  0x21, 0x0b, 0x15, 0x0d, 0x42, 0x0d, 0x1b, 0x0c, 0x21, 0x0b, 0x14, 0x0d,
+  0x43, 0x0e, 0x1b, 0x0a, 0x22, 0x0a, 0x14, 0x0e, 0x44, 0x0e, 0x1a, 0x0a,
+  0x22, 0x0a, 0x13, 0x0e, 0x45, 0x10, 0x19, 0x08, 0x24, 0x08, 0x12, 0x0f,
+  0x47, 0x10, 0x1a, 0x04, 0x27, 0x06, 0x12, 0x10, 0x48, 0x11, 0x59, 0x11,
+  0x4a, 0x12, 0x55, 0x12, 0x4b, 0x17, 0x4c, 0x16, 0x4c, 0x18, 0x20, 0x07,
+  0x20, 0x18, 0x4e, 0x17, 0x1f, 0x09, 0x1f, 0x17, 0x50, 0x16, 0x1f, 0x09,
+  0x1f, 0x16, 0x53, 0x14, 0x1e, 0x0b, 0x1e, 0x15, 0x55, 0x13, 0x1e, 0x0b,
+  0x1e, 0x13, 0x58, 0x12, 0x1e, 0x0b, 0x1e, 0x12, 0x5b, 0x10, 0x1d, 0x0c,
+  0x1e, 0x10, 0x5f, 0x0e, 0x1d, 0x0b, 0x1f, 0x0f, 0x62, 0x0c, 0x1d, 0x0b,
+  0x1f, 0x0c, 0x68, 0x09, 0x1d, 0x0b, 0x1f, 0x0a, 0x6e, 0x05, 0x09, 0x03,
+  0x10, 0x0c, 0x1f, 0x05, 0x7f, 0x07, 0x0e, 0x0b, 0x0c, 0x06, 0x91, 0x01,
+  0x09, 0x0d, 0x0b, 0x0b, 0x08, 0x8f, 0x01, 0x0a, 0x0e, 0x0a, 0x0a, 0x0a,
+  0x8e, 0x01, 0x0b, 0x0d, 0x09, 0x0b, 0x0a, 0x8d, 0x01, 0x0c, 0x0e, 0x08,
+  0x0a, 0x0c, 0x8c, 0x01, 0x0c, 0x0f, 0x06, 0x0b, 0x0c, 0x8c, 0x01, 0x0b,
+  0x21, 0x0b, 0x8d, 0x01, 0x0b, 0x21, 0x0b, 0x8d, 0x01, 0x0b, 0x20, 0x0c,
+  0x8c, 0x01, 0x0c, 0x20, 0x0c, 0x8c, 0x01, 0x0b, 0x21, 0x0b, 0x8d, 0x01,
+  0x0b, 0x21, 0x0b, 0x8d, 0x01, 0x0b, 0x21, 0x0b, 0x8d, 0x01, 0x0b, 0x21,
+  0x0b, 0x8e, 0x01, 0x09, 0x22, 0x0a, 0x90, 0x01, 0x07, 0x24, 0x09, 0x91,
+  0x01, 0x05, 0x26, 0x07, 0xf0, 0x05, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xba, 0x01,
+  0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xc0, 0x01, 0x02, 0xeb, 0x17,
+  0xd3, 0x01, 0x05, 0x1a, 0x06, 0x14, 0x08, 0x02, 0x02, 0x13, 0x08, 0x04,
+  0x02, 0x11, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04,
+  0x03, 0x0e, 0x02, 0x08, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01,
+  0x02, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x02, 0x10, 0x03, 0x0b, 0x02, 0x11,
+  0x02, 0x0a, 0x02, 0x13, 0x01, 0x0a, 0x02, 0x13, 0x01, 0x0b, 0x02, 0x11,
+  0x02, 0x0b, 0x02, 0x11, 0x02, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x01,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x16, 0x02, 0x1b, 0x01, 0x06,
+  0x01, 0x17, 0x02, 0x02, 0x01, 0x02, 0x02, 0x1b, 0x01, 0x3e, 0x02, 0x1e,
+  0x01, 0x52, 0xa7, 0x06, 0x09, 0x36, 0x0b, 0x33, 0x0c, 0x33, 0x07, 0x03,
+  0x03, 0x29, 0x08, 0x02, 0x05, 0x05, 0x03, 0x27, 0x10, 0x06, 0x03, 0x26,
+  0x10, 0x07, 0x04, 0x23, 0x09, 0x01, 0x08, 0x07, 0x04, 0x23, 0x05, 0x09,
+  0x05, 0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d,
+  0x05, 0x06, 0x05, 0x1e, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x11,
+  0x03, 0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x08, 0x05, 0x18, 0x06, 0x11,
+  0x09, 0x04, 0x04, 0x16, 0x07, 0x12, 0x0b, 0x01, 0x04, 0x16, 0x08, 0x13,
+  0x0f, 0x15, 0x06, 0x1b, 0x09, 0x15, 0x05, 0x1f, 0x06, 0x16, 0x04, 0x22,
+  0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24,
+  0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x04, 0x24,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x03, 0x16, 0x04, 0x22,
+  0x04, 0x16, 0x05, 0x20, 0x05, 0x17, 0x06, 0x1c, 0x06, 0x19, 0x07, 0x04,
+  0x01, 0x06, 0x02, 0x05, 0x01, 0x05, 0x07, 0x1b, 0x06, 0x03, 0x03, 0x04,
+  0x04, 0x03, 0x03, 0x03, 0x07, 0x1d, 0x05, 0x03, 0x03, 0x04, 0x04, 0x03,
+  0x03, 0x03, 0x05, 0x22, 0x02, 0x04, 0x02, 0x04, 0x03, 0x05, 0x02, 0x04,
+  0x02, 0x30, 0x03, 0x36, 0x01, 0x07, 0x01, 0x05, 0x01, 0x30, 0x03, 0x0b,
+  0x03, 0x2f, 0x03, 0x04, 0x02, 0x05, 0x03, 0x2e, 0x04, 0x03, 0x04, 0x03,
+  0x04, 0x2f, 0x03, 0x03, 0x04, 0x04, 0x03, 0xb4, 0x01, 0x03, 0x3d, 0x03,
+  0x3d, 0x03, 0x3d, 0x03, 0x3e, 0x01, 0xa4, 0x02, 0xcf, 0x36, 0x08, 0xb7,
+  0x01, 0x12, 0xaf, 0x01, 0x18, 0xa9, 0x01, 0x1d, 0xa5, 0x01, 0x1f, 0xa3,
+  0x01, 0x21, 0xa2, 0x01, 0x22, 0xa1, 0x01, 0x22, 0xa0, 0x01, 0x24, 0x9f,
+  0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x17, 0x04, 0x0c, 0x9c, 0x01,
+  0x14, 0x09, 0x0b, 0x9c, 0x01, 0x11, 0x0c, 0x0b, 0x82, 0x01, 0x10, 0x09,
+  0x10, 0x0e, 0x0b, 0x7e, 0x18, 0x04, 0x10, 0x0f, 0x0b, 0x7b, 0x2d, 0x11,
+  0x0b, 0x79, 0x2e, 0x12, 0x0b, 0x77, 0x2f, 0x13, 0x0b, 0x75, 0x30, 0x14,
+  0x0c, 0x73, 0x30, 0x15, 0x0c, 0x71, 0x32, 0x16, 0x0b, 0x70, 0x32, 0x17,
+  0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6d, 0x36, 0x16, 0x0c, 0x6b, 0x15, 0x0e,
+  0x15, 0x15, 0x0c, 0x6a, 0x13, 0x14, 0x13, 0x14, 0x0d, 0x68, 0x12, 0x18,
+  0x12, 0x14, 0x0c, 0x67, 0x11, 0x1c, 0x11, 0x13, 0x0d, 0x65, 0x10, 0x20,
+  0x10, 0x13, 0x0d, 0x64, 0x0f, 0x22, 0x0f, 0x13, 0x0e, 0x62, 0x0f, 0x24,
+  0x0f, 0x13, 0x0e, 0x60, 0x0f, 0x26, 0x0f, 0x13, 0x0f, 0x5e, 0x0e, 0x28,
+  0x0e, 0x13, 0x10, 0x5c, 0x0e, 0x2a, 0x0e, 0x13, 0x11, 0x5a, 0x0d, 0x2c,
+  0x0d, 0x14, 0x13, 0x56, 0x0d, 0x2e, 0x0d, 0x14, 0x16, 0x52, 0x0c, 0x30,
+  0x0c, 0x15, 0x16, 0x50, 0x0d, 0x30, 0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32,
+  0x0c, 0x16, 0x14, 0x50, 0x0c, 0x32, 0x0c, 0x17, 0x13, 0x4f, 0x0c, 0x34,
+  0x0b, 0x19, 0x10, 0x50, 0x0c, 0x34, 0x0c, 0x19, 0x0f, 0x50, 0x0c, 0x34,
+  0x12, 0x15, 0x0d, 0x4e, 0x0d, 0x36, 0x16, 0x11, 0x0c, 0x4b, 0x10, 0x36,
+  0x19, 0x0d, 0x0c, 0x4a, 0x12, 0x36, 0x1b, 0x0b, 0x0c, 0x48, 0x14, 0x36,
+  0x1d, 0x08, 0x0c, 0x47, 0x16, 0x37, 0x1e, 0x05, 0x0d, 0x46, 0x16, 0x38,
+  0x1f, 0x04, 0x0d, 0x45, 0x17, 0x38, 0x20, 0x02, 0x0d, 0x45, 0x18, 0x38,
+  0x2f, 0x44, 0x19, 0x38, 0x2e, 0x44, 0x1a, 0x38, 0x2d, 0x44, 0x17, 0x3d,
+  0x2c, 0x43, 0x13, 0x54, 0x19, 0x43, 0x11, 0x59, 0x16, 0x43, 0x10, 0x5d,
+  0x13, 0x44, 0x0f, 0x60, 0x10, 0x44, 0x0f, 0x62, 0x0e, 0x44, 0x0f, 0x64,
+  0x0e, 0x43, 0x0e, 0x66, 0x0d, 0x42, 0x0e, 0x68, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0c, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0d, 0x6c, 0x0c, 0x3f, 0x0c, 0x6d,
+  0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70,
+  0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70,
+  0x0b, 0x3d, 0x0c, 0x6f, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e,
+  0x0b, 0x3f, 0x0c, 0x6d, 0x0c, 0x40, 0x0c, 0x6b, 0x0d, 0x40, 0x0d, 0x6a,
+  0x0c, 0x41, 0x0d, 0x69, 0x0d, 0x42, 0x0d, 0x67, 0x0d, 0x43, 0x0e, 0x65,
+  0x0e, 0x44, 0x0e, 0x63, 0x0e, 0x45, 0x0f, 0x61, 0x0f, 0x46, 0x0f, 0x5e,
+  0x10, 0x48, 0x10, 0x5b, 0x11, 0x48, 0x12, 0x56, 0x13, 0x4a, 0x14, 0x50,
+  0x15, 0x4c, 0x18, 0x21, 0x05, 0x21, 0x18, 0x4e, 0x17, 0x0b, 0x05, 0x10,
+  0x08, 0x0e, 0x05, 0x0c, 0x17, 0x50, 0x16, 0x0a, 0x08, 0x0d, 0x09, 0x0d,
+  0x07, 0x0b, 0x16, 0x52, 0x15, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x09, 0x0a,
+  0x15, 0x55, 0x13, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x14, 0x57,
+  0x12, 0x09, 0x0a, 0x0b, 0x0b, 0x0a, 0x0b, 0x09, 0x13, 0x5a, 0x10, 0x09,
+  0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x09, 0x11, 0x5e, 0x0e, 0x09, 0x0a, 0x0a,
+  0x0c, 0x0a, 0x0b, 0x09, 0x0f, 0x62, 0x0c, 0x09, 0x0a, 0x0a, 0x0b, 0x0c,
+  0x0a, 0x09, 0x0d, 0x66, 0x0a, 0x0a, 0x08, 0x0b, 0x0b, 0x0c, 0x09, 0x0a,
+  0x0b, 0x6c, 0x06, 0x0b, 0x06, 0x0c, 0x0b, 0x0d, 0x07, 0x0b, 0x07, 0x83,
+  0x01, 0x01, 0x0e, 0x0c, 0x0f, 0x03, 0xa7, 0x01, 0x0a, 0xba, 0x01, 0x0a,
+  0xba, 0x01, 0x09, 0xbc, 0x01, 0x07, 0xa6, 0x01, 0x06, 0x13, 0x04, 0x0e,
+  0x05, 0x93, 0x01, 0x08, 0x23, 0x08, 0x90, 0x01, 0x0a, 0x21, 0x09, 0x90,
+  0x01, 0x0a, 0x20, 0x0b, 0x8e, 0x01, 0x0c, 0x1f, 0x0b, 0x8e, 0x01, 0x0c,
+  0x0c, 0x04, 0x0f, 0x0b, 0x8e, 0x01, 0x0b, 0x0b, 0x07, 0x0e, 0x0b, 0x8e,
+  0x01, 0x0b, 0x0a, 0x09, 0x0d, 0x0b, 0x8e, 0x01, 0x0b, 0x0a, 0x0a, 0x0c,
+  0x0b, 0x8e, 0x01, 0x0b, 0x09, 0x0b, 0x0b, 0x0b, 0x8f, 0x01, 0x0b, 0x09,
+  0x0b, 0x0c, 0x0a, 0x8f, 0x01, 0x0a, 0x0a, 0x0b, 0x0c, 0x0a, 0x90, 0x01,
+  0x09, 0x0b, 0x0a, 0x0c, 0x0a, 0x90, 0x01, 0x08, 0x0c, 0x09, 0x0e, 0x08,
+  0x93, 0x01, 0x05, 0x0e, 0x07, 0x10, 0x06, 0xa9, 0x01, 0x04, 0xcc, 0x07,
+  0x04, 0xbe, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xe1, 0x14, 0xd3, 0x01, 0x05,
+  0x1a, 0x06, 0x14, 0x08, 0x02, 0x02, 0x12, 0x09, 0x04, 0x02, 0x11, 0x02,
+  0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0e, 0x01,
+  0x09, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b, 0x04,
+  0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02,
+  0x13, 0x01, 0x0a, 0x02, 0x13, 0x01, 0x0b, 0x02, 0x11, 0x02, 0x0b, 0x02,
+  0x08, 0x01, 0x08, 0x02, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x03, 0x37, 0x01, 0x3b, 0x02, 0x05, 0x02, 0x3b, 0x01,
+  0x70, 0xeb, 0x05, 0x02, 0x3a, 0x09, 0x35, 0x0b, 0x34, 0x0c, 0x33, 0x07,
+  0x03, 0x03, 0x29, 0x08, 0x02, 0x05, 0x05, 0x03, 0x27, 0x0f, 0x07, 0x03,
+  0x25, 0x11, 0x07, 0x04, 0x23, 0x08, 0x03, 0x07, 0x07, 0x04, 0x22, 0x06,
+  0x09, 0x05, 0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05,
+  0x0d, 0x05, 0x06, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04,
+  0x11, 0x03, 0x08, 0x06, 0x1a, 0x04, 0x11, 0x04, 0x08, 0x05, 0x18, 0x06,
+  0x11, 0x09, 0x04, 0x04, 0x16, 0x07, 0x12, 0x0b, 0x01, 0x04, 0x16, 0x08,
+  0x13, 0x0f, 0x15, 0x06, 0x1c, 0x08, 0x15, 0x05, 0x20, 0x05, 0x16, 0x04,
+  0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04,
+  0x24, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03,
+  0x25, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x11, 0x01, 0x12, 0x03,
+  0x16, 0x04, 0x0f, 0x04, 0x0f, 0x04, 0x16, 0x05, 0x0e, 0x04, 0x0e, 0x05,
+  0x17, 0x06, 0x0d, 0x02, 0x0d, 0x06, 0x19, 0x07, 0x04, 0x02, 0x0c, 0x02,
+  0x04, 0x07, 0x1b, 0x06, 0x03, 0x04, 0x0a, 0x04, 0x02, 0x07, 0x1d, 0x05,
+  0x03, 0x04, 0x0a, 0x03, 0x03, 0x05, 0x23, 0x01, 0x04, 0x02, 0x0c, 0x01,
+  0x05, 0x01, 0x32, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x3d, 0x02, 0x37, 0x02,
+  0x0b, 0x03, 0x2f, 0x04, 0x0a, 0x04, 0x2f, 0x03, 0x0a, 0x03, 0x77, 0x02,
+  0x3d, 0x04, 0x3c, 0x04, 0x9f, 0x03, 0xcc, 0x36, 0x0d, 0xb3, 0x01, 0x15,
+  0xad, 0x01, 0x1a, 0xa7, 0x01, 0x1e, 0xa4, 0x01, 0x20, 0xa3, 0x01, 0x21,
+  0xa1, 0x01, 0x22, 0xa1, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25,
+  0x9e, 0x01, 0x26, 0x9d, 0x01, 0x16, 0x06, 0x0b, 0x9c, 0x01, 0x13, 0x0a,
+  0x0b, 0x86, 0x01, 0x08, 0x0e, 0x11, 0x0c, 0x0b, 0x80, 0x01, 0x13, 0x08,
+  0x10, 0x0e, 0x0b, 0x7d, 0x1a, 0x03, 0x0f, 0x10, 0x0b, 0x7a, 0x2e, 0x11,
+  0x0b, 0x78, 0x2f, 0x12, 0x0b, 0x76, 0x30, 0x13, 0x0b, 0x75, 0x30, 0x14,
+  0x0c, 0x72, 0x31, 0x15, 0x0c, 0x71, 0x31, 0x17, 0x0b, 0x70, 0x32, 0x17,
+  0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6c, 0x18, 0x08, 0x17, 0x16, 0x0c, 0x6a,
+  0x15, 0x10, 0x14, 0x15, 0x0c, 0x69, 0x13, 0x16, 0x12, 0x14, 0x0d, 0x68,
+  0x11, 0x1a, 0x11, 0x14, 0x0d, 0x66, 0x10, 0x1e, 0x10, 0x13, 0x0d, 0x65,
+  0x10, 0x20, 0x10, 0x13, 0x0d, 0x63, 0x0f, 0x23, 0x0f, 0x13, 0x0f, 0x61,
+  0x0e, 0x26, 0x0e, 0x13, 0x0f, 0x5f, 0x0e, 0x28, 0x0e, 0x13, 0x0f, 0x5e,
+  0x0d, 0x2a, 0x0d, 0x13, 0x11, 0x5b, 0x0d, 0x2c, 0x0d, 0x13, 0x12, 0x58,
+  0x0e, 0x2c, 0x0d, 0x14, 0x15, 0x54, 0x0d, 0x2e, 0x0d, 0x14, 0x17, 0x51,
+  0x0c, 0x30, 0x0c, 0x15, 0x16, 0x50, 0x0d, 0x30, 0x0c, 0x16, 0x15, 0x50,
+  0x0c, 0x32, 0x0c, 0x16, 0x14, 0x4f, 0x0d, 0x32, 0x0c, 0x17, 0x13, 0x4f,
+  0x0c, 0x34, 0x0b, 0x19, 0x10, 0x50, 0x0c, 0x34, 0x0c, 0x19, 0x0f, 0x50,
+  0x0b, 0x36, 0x11, 0x15, 0x0d, 0x4e, 0x0d, 0x36, 0x16, 0x11, 0x0c, 0x4b,
+  0x10, 0x36, 0x19, 0x0d, 0x0c, 0x4a, 0x12, 0x36, 0x1b, 0x0b, 0x0c, 0x48,
+  0x14, 0x36, 0x1d, 0x08, 0x0d, 0x46, 0x15, 0x38, 0x1e, 0x05, 0x0d, 0x46,
+  0x16, 0x38, 0x1f, 0x03, 0x0e, 0x44, 0x18, 0x38, 0x20, 0x01, 0x0e, 0x44,
+  0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38, 0x2e, 0x43, 0x1b, 0x38, 0x2d, 0x43,
+  0x17, 0x4d, 0x1d, 0x43, 0x12, 0x56, 0x18, 0x43, 0x10, 0x5b, 0x15, 0x43,
+  0x10, 0x5e, 0x12, 0x43, 0x0f, 0x61, 0x10, 0x44, 0x0e, 0x63, 0x0e, 0x44,
+  0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42, 0x0d, 0x69, 0x0d, 0x41,
+  0x0c, 0x6b, 0x0c, 0x40, 0x0d, 0x6b, 0x0d, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f,
+  0x0c, 0x6e, 0x0b, 0x3f, 0x0b, 0x6f, 0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d,
+  0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x6f, 0x0c, 0x3e, 0x0b, 0x6f, 0x0c, 0x3e,
+  0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0d, 0x33, 0x06, 0x32,
+  0x0d, 0x40, 0x0d, 0x31, 0x08, 0x31, 0x0c, 0x41, 0x0d, 0x30, 0x09, 0x30,
+  0x0d, 0x42, 0x0d, 0x2f, 0x0a, 0x2e, 0x0d, 0x43, 0x0e, 0x2d, 0x0b, 0x2d,
+  0x0e, 0x44, 0x0e, 0x2c, 0x0b, 0x2c, 0x0e, 0x45, 0x0f, 0x2b, 0x0b, 0x2b,
+  0x0f, 0x46, 0x10, 0x2a, 0x0a, 0x2a, 0x0f, 0x48, 0x10, 0x29, 0x09, 0x29,
+  0x10, 0x4a, 0x11, 0x28, 0x07, 0x28, 0x12, 0x4a, 0x15, 0x27, 0x01, 0x27,
+  0x15, 0x4c, 0x18, 0x0c, 0x05, 0x26, 0x04, 0x0c, 0x18, 0x4e, 0x17, 0x0b,
+  0x08, 0x22, 0x08, 0x0a, 0x17, 0x50, 0x16, 0x0a, 0x09, 0x21, 0x0a, 0x09,
+  0x16, 0x52, 0x15, 0x0a, 0x0a, 0x20, 0x0a, 0x09, 0x15, 0x55, 0x13, 0x09,
+  0x0b, 0x1f, 0x0b, 0x09, 0x14, 0x57, 0x12, 0x09, 0x0b, 0x1f, 0x0b, 0x09,
+  0x12, 0x5b, 0x10, 0x09, 0x0b, 0x20, 0x0a, 0x09, 0x11, 0x5d, 0x0f, 0x0a,
+  0x0a, 0x20, 0x0a, 0x09, 0x0f, 0x62, 0x0c, 0x0a, 0x09, 0x21, 0x09, 0x0a,
+  0x0d, 0x66, 0x0a, 0x0b, 0x07, 0x23, 0x08, 0x0a, 0x0a, 0x6e, 0x05, 0x0d,
+  0x04, 0x26, 0x04, 0x0c, 0x05, 0xde, 0x02, 0x03, 0xbf, 0x01, 0x07, 0xbc,
+  0x01, 0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd,
+  0x01, 0x06, 0xed, 0x02, 0x06, 0x24, 0x06, 0x93, 0x01, 0x08, 0x22, 0x08,
+  0x91, 0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01, 0x0a, 0x20, 0x0a, 0x8f, 0x01,
+  0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x90, 0x01, 0x0a, 0x20,
+  0x0a, 0x90, 0x01, 0x0a, 0x20, 0x0a, 0x91, 0x01, 0x08, 0x22, 0x08, 0x93,
+  0x01, 0x06, 0x24, 0x06, 0xb2, 0x04, 0x03, 0xbf, 0x01, 0x07, 0xbc, 0x01,
+  0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01,
+  0x06, 0xe6, 0x1a, 0xd3, 0x01, 0x05, 0x1a, 0x06, 0x14, 0x08, 0x02, 0x02,
+  0x12, 0x09, 0x04, 0x02, 0x11, 0x02, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02,
+  0x07, 0x02, 0x04, 0x03, 0x0e, 0x01, 0x09, 0x02, 0x04, 0x02, 0x0c, 0x03,
+  0x09, 0x05, 0x01, 0x02, 0x0b, 0x04, 0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02,
+  0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02, 0x13, 0x01, 0x0a, 0x02, 0x13, 0x01,
+  0x0b, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x08, 0x01, 0x08, 0x02, 0x0c, 0x03,
+  0x0d, 0x03, 0x0e, 0x03, 0x01, 0x01, 0x06, 0x01, 0x02, 0x03, 0x36, 0x02,
+  0x3a, 0x02, 0x05, 0x02, 0x3a, 0x02, 0x71, 0xeb, 0x05, 0x02, 0x3a, 0x09,
+  0x35, 0x0b, 0x34, 0x0c, 0x33, 0x07, 0x03, 0x03, 0x29, 0x08, 0x02, 0x05,
+  0x05, 0x03, 0x27, 0x0f, 0x07, 0x03, 0x25, 0x11, 0x07, 0x04, 0x23, 0x08,
+  0x03, 0x07, 0x07, 0x04, 0x22, 0x06, 0x09, 0x05, 0x07, 0x04, 0x21, 0x05,
+  0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d, 0x05, 0x06, 0x06, 0x1d, 0x04,
+  0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03, 0x08, 0x06, 0x1a, 0x04,
+  0x11, 0x04, 0x08, 0x05, 0x18, 0x06, 0x11, 0x09, 0x04, 0x04, 0x16, 0x07,
+  0x12, 0x0b, 0x01, 0x04, 0x16, 0x08, 0x13, 0x0f, 0x15, 0x06, 0x1c, 0x08,
+  0x15, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04,
+  0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04,
+  0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x04, 0x11, 0x01, 0x12, 0x03, 0x16, 0x04, 0x0f, 0x04, 0x0f, 0x04,
+  0x16, 0x05, 0x0e, 0x04, 0x0e, 0x05, 0x17, 0x06, 0x0d, 0x02, 0x0d, 0x06,
+  0x19, 0x07, 0x03, 0x02, 0x0c, 0x02, 0x05, 0x07, 0x1b, 0x06, 0x02, 0x04,
+  0x0a, 0x04, 0x03, 0x07, 0x1d, 0x05, 0x03, 0x03, 0x0a, 0x04, 0x03, 0x05,
+  0x23, 0x01, 0x04, 0x01, 0x0c, 0x02, 0x05, 0x01, 0x31, 0x02, 0x3d, 0x03,
+  0x3d, 0x03, 0x3e, 0x01, 0x37, 0x03, 0x0b, 0x02, 0x30, 0x03, 0x0a, 0x04,
+  0x2f, 0x03, 0x0b, 0x02, 0x76, 0x02, 0x3d, 0x04, 0x3d, 0x03, 0xa2, 0x03,
+  0xcc, 0x36, 0x0d, 0xb3, 0x01, 0x15, 0xad, 0x01, 0x1a, 0xa7, 0x01, 0x1e,
+  0xa4, 0x01, 0x20, 0xa3, 0x01, 0x21, 0xa1, 0x01, 0x22, 0xa1, 0x01, 0x23,
+  0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x16,
+  0x06, 0x0b, 0x9c, 0x01, 0x13, 0x0a, 0x0b, 0x86, 0x01, 0x08, 0x0e, 0x11,
+  0x0c, 0x0b, 0x80, 0x01, 0x13, 0x08, 0x10, 0x0e, 0x0b, 0x7d, 0x1a, 0x03,
+  0x0f, 0x10, 0x0b, 0x7a, 0x2e, 0x11, 0x0b, 0x78, 0x2f, 0x12, 0x0b, 0x76,
+  0x30, 0x13, 0x0b, 0x75, 0x30, 0x14, 0x0c, 0x72, 0x31, 0x15, 0x0c, 0x71,
+  0x31, 0x17, 0x0b, 0x70, 0x32, 0x17, 0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6c,
+  0x18, 0x08, 0x17, 0x16, 0x0c, 0x6a, 0x15, 0x10, 0x14, 0x15, 0x0c, 0x69,
+  0x13, 0x16, 0x12, 0x14, 0x0d, 0x68, 0x11, 0x1a, 0x11, 0x14, 0x0d, 0x66,
+  0x10, 0x1e, 0x10, 0x13, 0x0d, 0x65, 0x10, 0x20, 0x10, 0x13, 0x0d, 0x63,
+  0x0f, 0x23, 0x0f, 0x13, 0x0f, 0x61, 0x0e, 0x26, 0x0e, 0x13, 0x0f, 0x5f,
+  0x0e, 0x28, 0x0e, 0x13, 0x0f, 0x5e, 0x0d, 0x2a, 0x0d, 0x13, 0x11, 0x5b,
+  0x0d, 0x2c, 0x0d, 0x13, 0x12, 0x58, 0x0e, 0x2c, 0x0d, 0x14, 0x15, 0x54,
+  0x0d, 0x2e, 0x0d, 0x14, 0x17, 0x51, 0x0c, 0x30, 0x0c, 0x15, 0x16, 0x50,
+  0x0d, 0x30, 0x0c, 0x16, 0x15, 0x50, 0x0c, 0x32, 0x0c, 0x16, 0x14, 0x4f,
+  0x0d, 0x32, 0x0c, 0x17, 0x13, 0x4f, 0x0c, 0x34, 0x0b, 0x19, 0x10, 0x50,
+  0x0c, 0x34, 0x0c, 0x19, 0x0f, 0x50, 0x0b, 0x36, 0x11, 0x15, 0x0d, 0x4e,
+  0x0d, 0x36, 0x16, 0x11, 0x0c, 0x4b, 0x10, 0x36, 0x19, 0x0d, 0x0c, 0x4a,
+  0x12, 0x36, 0x1b, 0x0b, 0x0c, 0x48, 0x14, 0x36, 0x1d, 0x08, 0x0d, 0x46,
+  0x15, 0x38, 0x1e, 0x05, 0x0d, 0x46, 0x16, 0x38, 0x1f, 0x03, 0x0e, 0x44,
+  0x18, 0x38, 0x20, 0x01, 0x0e, 0x44, 0x19, 0x38, 0x2f, 0x43, 0x1a, 0x38,
+  0x2e, 0x43, 0x1b, 0x38, 0x2d, 0x43, 0x17, 0x4d, 0x1d, 0x43, 0x12, 0x56,
+  0x18, 0x43, 0x10, 0x5b, 0x15, 0x43, 0x10, 0x5e, 0x12, 0x43, 0x0f, 0x61,
+  0x10, 0x44, 0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67,
+  0x0d, 0x42, 0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0d, 0x6b,
+  0x0d, 0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3f, 0x0b, 0x6f,
+  0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x6f,
+  0x0c, 0x3e, 0x0b, 0x6f, 0x0c, 0x3e, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6d,
+  0x0c, 0x3f, 0x0d, 0x33, 0x06, 0x32, 0x0d, 0x40, 0x0d, 0x31, 0x08, 0x31,
+  0x0c, 0x41, 0x0d, 0x30, 0x09, 0x30, 0x0d, 0x42, 0x0d, 0x2f, 0x0a, 0x2e,
+  0x0d, 0x43, 0x0e, 0x2d, 0x0b, 0x2d, 0x0e, 0x44, 0x0e, 0x2c, 0x0b, 0x2c,
+  0x0e, 0x45, 0x0f, 0x2b, 0x0b, 0x2b, 0x0f, 0x46, 0x10, 0x2a, 0x0a, 0x2a,
+  0x0f, 0x48, 0x10, 0x29, 0x09, 0x29, 0x10, 0x4a, 0x11, 0x28, 0x07, 0x28,
+  0x12, 0x4a, 0x15, 0x27, 0x01, 0x27, 0x15, 0x4c, 0x18, 0x0a, 0x04, 0x26,
+  0x05, 0x0e, 0x18, 0x4e, 0x17, 0x08, 0x08, 0x22, 0x08, 0x0d, 0x17, 0x50,
+  0x16, 0x07, 0x0a, 0x20, 0x0a, 0x0c, 0x16, 0x52, 0x15, 0x07, 0x0a, 0x20,
+  0x0a, 0x0c, 0x15, 0x55, 0x13, 0x07, 0x0a, 0x20, 0x0a, 0x0c, 0x14, 0x57,
+  0x12, 0x07, 0x0a, 0x20, 0x0b, 0x0b, 0x12, 0x5b, 0x10, 0x07, 0x0a, 0x20,
+  0x0a, 0x0c, 0x11, 0x5d, 0x0f, 0x07, 0x0a, 0x20, 0x0a, 0x0c, 0x0f, 0x62,
+  0x0c, 0x08, 0x08, 0x22, 0x09, 0x0c, 0x0d, 0x66, 0x0a, 0x08, 0x08, 0x23,
+  0x07, 0x0d, 0x0a, 0x6e, 0x05, 0x0a, 0x04, 0x26, 0x04, 0x0f, 0x05, 0xda,
+  0x02, 0x03, 0xbf, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x09, 0xba,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba,
+  0x01, 0x09, 0xbb, 0x01, 0x09, 0xbd, 0x01, 0x06, 0xeb, 0x02, 0x06, 0x24,
+  0x06, 0x93, 0x01, 0x08, 0x22, 0x09, 0x90, 0x01, 0x0a, 0x21, 0x09, 0x90,
+  0x01, 0x0a, 0x20, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b,
+  0x1f, 0x0b, 0x8f, 0x01, 0x0a, 0x20, 0x0b, 0x8f, 0x01, 0x0a, 0x20, 0x0a,
+  0x91, 0x01, 0x08, 0x22, 0x09, 0x92, 0x01, 0x06, 0x24, 0x06, 0xb0, 0x04,
+  0x03, 0xbf, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01,
+  0x09, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xef, 0x1a, 0xd3, 0x01, 0x05,
+  0x1a, 0x06, 0x14, 0x08, 0x02, 0x02, 0x12, 0x09, 0x04, 0x01, 0x12, 0x02,
+  0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0e, 0x01,
+  0x09, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b, 0x04,
+  0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02,
+  0x13, 0x01, 0x0a, 0x02, 0x04, 0x03, 0x07, 0x01, 0x04, 0x01, 0x0b, 0x02,
+  0x03, 0x03, 0x06, 0x02, 0x03, 0x02, 0x0b, 0x02, 0x02, 0x03, 0x07, 0x02,
+  0x03, 0x02, 0x0c, 0x06, 0x0a, 0x03, 0x0e, 0x04, 0x04, 0x02, 0x04, 0x03,
+  0x10, 0x05, 0x02, 0x01, 0x02, 0x01, 0x15, 0x05, 0x05, 0x02, 0x16, 0x02,
+  0x06, 0x01, 0x16, 0x02, 0x1e, 0x01, 0x03, 0x02, 0x1a, 0x01, 0x03, 0x02,
+  0x71, 0xeb, 0x05, 0x02, 0x3a, 0x09, 0x35, 0x0b, 0x34, 0x0c, 0x33, 0x07,
+  0x03, 0x03, 0x29, 0x08, 0x01, 0x06, 0x05, 0x03, 0x27, 0x0f, 0x07, 0x03,
+  0x26, 0x10, 0x07, 0x04, 0x23, 0x08, 0x03, 0x07, 0x07, 0x04, 0x22, 0x06,
+  0x09, 0x05, 0x07, 0x04, 0x21, 0x05, 0x0b, 0x05, 0x06, 0x05, 0x1f, 0x05,
+  0x0d, 0x05, 0x06, 0x06, 0x1d, 0x04, 0x0f, 0x04, 0x07, 0x07, 0x1a, 0x04,
+  0x11, 0x03, 0x08, 0x06, 0x1a, 0x04, 0x11, 0x05, 0x07, 0x05, 0x18, 0x06,
+  0x11, 0x09, 0x04, 0x03, 0x17, 0x07, 0x12, 0x0b, 0x01, 0x04, 0x16, 0x08,
+  0x13, 0x0e, 0x16, 0x06, 0x1c, 0x08, 0x15, 0x05, 0x20, 0x05, 0x16, 0x04,
+  0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04,
+  0x24, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x08, 0x07, 0x0c, 0x02,
+  0x08, 0x04, 0x14, 0x04, 0x07, 0x07, 0x0c, 0x03, 0x07, 0x04, 0x14, 0x04,
+  0x06, 0x07, 0x0c, 0x04, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07, 0x0c, 0x04,
+  0x06, 0x04, 0x16, 0x04, 0x05, 0x06, 0x0d, 0x04, 0x06, 0x04, 0x16, 0x05,
+  0x03, 0x07, 0x0d, 0x03, 0x06, 0x04, 0x18, 0x06, 0x01, 0x06, 0x15, 0x06,
+  0x19, 0x0b, 0x07, 0x03, 0x09, 0x08, 0x1b, 0x0a, 0x07, 0x03, 0x09, 0x07,
+  0x1e, 0x07, 0x07, 0x04, 0x09, 0x05, 0x21, 0x06, 0x07, 0x04, 0x04, 0x01,
+  0x05, 0x01, 0x24, 0x0a, 0x03, 0x03, 0x04, 0x03, 0x28, 0x0b, 0x04, 0x01,
+  0x05, 0x03, 0x28, 0x0a, 0x0a, 0x04, 0x2c, 0x05, 0x0b, 0x04, 0x2c, 0x04,
+  0x0c, 0x03, 0x2d, 0x04, 0x3c, 0x03, 0x05, 0x03, 0x34, 0x03, 0x06, 0x03,
+  0x34, 0x02, 0x06, 0x04, 0x34, 0x02, 0x06, 0x04, 0x34, 0x01, 0x07, 0x04,
+  0x33, 0x01, 0x09, 0x02, 0xe3, 0x02, 0xcd, 0x36, 0x0b, 0xb5, 0x01, 0x14,
+  0xad, 0x01, 0x1a, 0xa7, 0x01, 0x1e, 0xa4, 0x01, 0x20, 0xa3, 0x01, 0x21,
+  0xa1, 0x01, 0x22, 0xa1, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25,
+  0x9e, 0x01, 0x26, 0x9d, 0x01, 0x15, 0x07, 0x0b, 0x9c, 0x01, 0x13, 0x0a,
+  0x0b, 0x86, 0x01, 0x07, 0x0e, 0x11, 0x0d, 0x0b, 0x80, 0x01, 0x13, 0x08,
+  0x10, 0x0e, 0x0b, 0x7d, 0x1a, 0x03, 0x0f, 0x10, 0x0b, 0x7a, 0x2e, 0x11,
+  0x0b, 0x78, 0x2f, 0x12, 0x0b, 0x76, 0x30, 0x13, 0x0b, 0x75, 0x30, 0x14,
+  0x0b, 0x73, 0x31, 0x15, 0x0c, 0x71, 0x31, 0x17, 0x0b, 0x70, 0x32, 0x17,
+  0x0c, 0x6e, 0x34, 0x16, 0x0c, 0x6d, 0x18, 0x06, 0x18, 0x16, 0x0c, 0x6b,
+  0x14, 0x10, 0x14, 0x15, 0x0c, 0x6a, 0x12, 0x16, 0x12, 0x14, 0x0d, 0x68,
+  0x11, 0x1a, 0x11, 0x14, 0x0d, 0x66, 0x10, 0x1e, 0x10, 0x13, 0x0e, 0x64,
+  0x10, 0x20, 0x10, 0x13, 0x0e, 0x62, 0x0f, 0x23, 0x0f, 0x13, 0x0f, 0x61,
+  0x0e, 0x26, 0x0e, 0x13, 0x0f, 0x5f, 0x0e, 0x28, 0x0e, 0x13, 0x0f, 0x5e,
+  0x0d, 0x2a, 0x0d, 0x13, 0x11, 0x5b, 0x0d, 0x2b, 0x0e, 0x13, 0x12, 0x59,
+  0x0d, 0x2c, 0x0d, 0x14, 0x14, 0x55, 0x0d, 0x2e, 0x0d, 0x14, 0x17, 0x51,
+  0x0c, 0x30, 0x0c, 0x15, 0x16, 0x50, 0x0d, 0x30, 0x0c, 0x16, 0x15, 0x50,
+  0x0c, 0x32, 0x0c, 0x16, 0x14, 0x50, 0x0c, 0x32, 0x0c, 0x17, 0x12, 0x50,
+  0x0c, 0x34, 0x0b, 0x19, 0x10, 0x50, 0x0c, 0x34, 0x0c, 0x19, 0x0f, 0x50,
+  0x0c, 0x34, 0x14, 0x13, 0x0d, 0x4e, 0x0d, 0x36, 0x17, 0x10, 0x0b, 0x4c,
+  0x10, 0x36, 0x1a, 0x0c, 0x0c, 0x49, 0x13, 0x36, 0x1c, 0x0a, 0x0c, 0x48,
+  0x14, 0x36, 0x1e, 0x07, 0x0c, 0x47, 0x15, 0x38, 0x1e, 0x05, 0x0d, 0x46,
+  0x16, 0x38, 0x20, 0x02, 0x0d, 0x45, 0x18, 0x38, 0x2f, 0x44, 0x19, 0x38,
+  0x2e, 0x44, 0x1a, 0x38, 0x2e, 0x43, 0x1a, 0x39, 0x2d, 0x43, 0x16, 0x4e,
+  0x1c, 0x44, 0x12, 0x55, 0x19, 0x43, 0x11, 0x5a, 0x15, 0x43, 0x10, 0x5d,
+  0x13, 0x43, 0x0f, 0x61, 0x10, 0x44, 0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65,
+  0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42, 0x0d, 0x69, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0c, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e,
+  0x0b, 0x3f, 0x0b, 0x6f, 0x0b, 0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x18, 0x14, 0x27, 0x05, 0x19, 0x0b, 0x3d, 0x0b, 0x17,
+  0x16, 0x25, 0x08, 0x17, 0x0b, 0x3d, 0x0b, 0x17, 0x15, 0x25, 0x09, 0x17,
+  0x0b, 0x3d, 0x0b, 0x16, 0x16, 0x24, 0x0b, 0x16, 0x0b, 0x3d, 0x0b, 0x16,
+  0x15, 0x25, 0x0b, 0x16, 0x0b, 0x3d, 0x0c, 0x15, 0x15, 0x25, 0x0b, 0x16,
+  0x0b, 0x3d, 0x0c, 0x14, 0x15, 0x25, 0x0c, 0x15, 0x0c, 0x3e, 0x0b, 0x14,
+  0x15, 0x25, 0x0c, 0x15, 0x0b, 0x3f, 0x0c, 0x12, 0x15, 0x26, 0x0c, 0x14,
+  0x0c, 0x3f, 0x0c, 0x12, 0x15, 0x26, 0x0b, 0x15, 0x0c, 0x40, 0x0c, 0x11,
+  0x14, 0x26, 0x0c, 0x14, 0x0c, 0x41, 0x0d, 0x0f, 0x15, 0x26, 0x0c, 0x13,
+  0x0d, 0x41, 0x0d, 0x0f, 0x14, 0x27, 0x0c, 0x13, 0x0d, 0x42, 0x0d, 0x0e,
+  0x13, 0x28, 0x0b, 0x13, 0x0d, 0x43, 0x0e, 0x0c, 0x14, 0x29, 0x0a, 0x12,
+  0x0e, 0x44, 0x0e, 0x0b, 0x13, 0x2a, 0x09, 0x12, 0x0e, 0x46, 0x0f, 0x08,
+  0x14, 0x2b, 0x08, 0x10, 0x10, 0x46, 0x10, 0x07, 0x13, 0x2e, 0x04, 0x11,
+  0x10, 0x48, 0x11, 0x05, 0x13, 0x41, 0x11, 0x4a, 0x12, 0x02, 0x13, 0x3f,
+  0x13, 0x4c, 0x26, 0x15, 0x04, 0x21, 0x18, 0x4d, 0x24, 0x15, 0x07, 0x1e,
+  0x18, 0x4e, 0x24, 0x14, 0x09, 0x1d, 0x17, 0x51, 0x21, 0x14, 0x0a, 0x1d,
+  0x16, 0x53, 0x20, 0x14, 0x0b, 0x1c, 0x14, 0x56, 0x1e, 0x14, 0x0c, 0x1c,
+  0x13, 0x59, 0x1c, 0x14, 0x0c, 0x1c, 0x12, 0x5b, 0x1a, 0x15, 0x0b, 0x1d,
+  0x10, 0x5f, 0x18, 0x15, 0x0b, 0x1d, 0x0e, 0x63, 0x15, 0x15, 0x0c, 0x1d,
+  0x0c, 0x68, 0x11, 0x16, 0x0c, 0x1d, 0x09, 0x6b, 0x11, 0x16, 0x0b, 0x0d,
+  0x04, 0x0d, 0x04, 0x6f, 0x21, 0x07, 0x0b, 0x0b, 0x07, 0x7f, 0x21, 0x07,
+  0x0b, 0x0a, 0x09, 0x7d, 0x21, 0x08, 0x0a, 0x0b, 0x0a, 0x7c, 0x20, 0x09,
+  0x0a, 0x0a, 0x0b, 0x7c, 0x1f, 0x0b, 0x08, 0x0b, 0x0b, 0x7b, 0x20, 0x0d,
+  0x05, 0x0c, 0x0b, 0x7b, 0x1f, 0x1e, 0x0c, 0x7b, 0x1e, 0x1f, 0x0c, 0x7a,
+  0x1e, 0x20, 0x0b, 0x7b, 0x1e, 0x20, 0x0b, 0x7b, 0x1d, 0x20, 0x0c, 0x89,
+  0x01, 0x0e, 0x21, 0x0c, 0x89, 0x01, 0x0d, 0x22, 0x0b, 0x8a, 0x01, 0x0d,
+  0x23, 0x0a, 0x89, 0x01, 0x0d, 0x24, 0x0a, 0x89, 0x01, 0x0c, 0x26, 0x08,
+  0x8a, 0x01, 0x0b, 0x28, 0x06, 0x8b, 0x01, 0x0b, 0xb8, 0x01, 0x0b, 0xb9,
+  0x01, 0x0a, 0x13, 0x01, 0xa6, 0x01, 0x09, 0x11, 0x07, 0xa2, 0x01, 0x0a,
+  0x10, 0x09, 0xa1, 0x01, 0x09, 0x10, 0x0a, 0xa1, 0x01, 0x08, 0x11, 0x0b,
+  0x9f, 0x01, 0x08, 0x12, 0x0b, 0x9f, 0x01, 0x08, 0x11, 0x0c, 0x9f, 0x01,
+  0x07, 0x12, 0x0c, 0x9e, 0x01, 0x07, 0x13, 0x0b, 0x9f, 0x01, 0x06, 0x14,
+  0x0b, 0x9f, 0x01, 0x06, 0x13, 0x0c, 0x9f, 0x01, 0x05, 0x14, 0x0c, 0x9e,
+  0x01, 0x05, 0x15, 0x0b, 0x9f, 0x01, 0x04, 0x16, 0x0b, 0x9f, 0x01, 0x04,
+  0x16, 0x0b, 0x9e, 0x01, 0x04, 0x18, 0x09, 0x9f, 0x01, 0x03, 0x1a, 0x08,
+  0x9f, 0x01, 0x02, 0x1c, 0x06, 0x9f, 0x01, 0x03, 0x89, 0x18, 0xd3, 0x01,
+  0x05, 0x1a, 0x06, 0x14, 0x07, 0x03, 0x02, 0x12, 0x09, 0x04, 0x02, 0x10,
+  0x03, 0x05, 0x03, 0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0d,
+  0x02, 0x09, 0x02, 0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b,
+  0x04, 0x0a, 0x07, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0a,
+  0x02, 0x13, 0x01, 0x0a, 0x02, 0x04, 0x03, 0x03, 0x01, 0x02, 0x02, 0x04,
+  0x01, 0x0b, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x0b,
+  0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x04, 0x02, 0x0c, 0x06, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x03, 0x0e, 0x04, 0x04, 0x01, 0x02, 0x02, 0x01,
+  0x03, 0x10, 0x05, 0x01, 0x02, 0x02, 0x02, 0x14, 0x05, 0x01, 0x02, 0x02,
+  0x01, 0x17, 0x02, 0x02, 0x02, 0x02, 0x01, 0x16, 0x02, 0x02, 0x02, 0x1a,
+  0x01, 0x03, 0x02, 0x1e, 0x02, 0x71, 0xea, 0x05, 0x04, 0x39, 0x0a, 0x34,
+  0x0b, 0x34, 0x0c, 0x33, 0x06, 0x04, 0x03, 0x29, 0x08, 0x01, 0x06, 0x05,
+  0x03, 0x27, 0x0f, 0x07, 0x03, 0x25, 0x11, 0x07, 0x04, 0x23, 0x08, 0x03,
+  0x07, 0x07, 0x04, 0x22, 0x06, 0x09, 0x05, 0x07, 0x04, 0x21, 0x04, 0x0c,
+  0x05, 0x06, 0x05, 0x1f, 0x04, 0x0e, 0x05, 0x06, 0x06, 0x1d, 0x04, 0x0f,
+  0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03, 0x08, 0x06, 0x1a, 0x04, 0x11,
+  0x05, 0x08, 0x04, 0x18, 0x05, 0x12, 0x09, 0x04, 0x03, 0x17, 0x07, 0x12,
+  0x0b, 0x01, 0x04, 0x16, 0x08, 0x13, 0x0e, 0x16, 0x06, 0x1c, 0x08, 0x15,
+  0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15,
+  0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14,
+  0x03, 0x08, 0x07, 0x05, 0x02, 0x05, 0x02, 0x08, 0x04, 0x14, 0x04, 0x07,
+  0x07, 0x04, 0x03, 0x04, 0x04, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07, 0x05,
+  0x03, 0x04, 0x04, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07, 0x04, 0x04, 0x04,
+  0x03, 0x07, 0x04, 0x16, 0x04, 0x04, 0x07, 0x05, 0x04, 0x03, 0x04, 0x07,
+  0x04, 0x16, 0x05, 0x03, 0x06, 0x06, 0x04, 0x03, 0x04, 0x06, 0x04, 0x18,
+  0x06, 0x01, 0x06, 0x06, 0x03, 0x04, 0x04, 0x04, 0x06, 0x19, 0x0b, 0x06,
+  0x04, 0x04, 0x03, 0x02, 0x08, 0x1b, 0x0a, 0x06, 0x04, 0x03, 0x04, 0x02,
+  0x07, 0x1e, 0x07, 0x07, 0x04, 0x03, 0x04, 0x02, 0x05, 0x21, 0x06, 0x07,
+  0x03, 0x04, 0x04, 0x03, 0x01, 0x24, 0x0a, 0x02, 0x04, 0x04, 0x03, 0x28,
+  0x0b, 0x02, 0x04, 0x03, 0x04, 0x28, 0x0a, 0x03, 0x04, 0x03, 0x04, 0x2c,
+  0x05, 0x04, 0x03, 0x04, 0x03, 0x2d, 0x04, 0x04, 0x04, 0x04, 0x03, 0x2d,
+  0x03, 0x05, 0x04, 0x34, 0x03, 0x05, 0x04, 0x34, 0x02, 0x06, 0x03, 0x34,
+  0x02, 0x06, 0x04, 0x34, 0x01, 0x07, 0x04, 0x3c, 0x03, 0x3e, 0x02, 0xe3,
+  0x02, 0xcb, 0x36, 0x10, 0xb1, 0x01, 0x16, 0xab, 0x01, 0x1c, 0xa6, 0x01,
+  0x1e, 0xa4, 0x01, 0x20, 0xa2, 0x01, 0x22, 0xa1, 0x01, 0x22, 0xa1, 0x01,
+  0x23, 0xa0, 0x01, 0x24, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01,
+  0x14, 0x08, 0x0b, 0x9c, 0x01, 0x12, 0x0b, 0x0b, 0x86, 0x01, 0x07, 0x0e,
+  0x11, 0x0d, 0x0b, 0x80, 0x01, 0x13, 0x07, 0x10, 0x0f, 0x0b, 0x7d, 0x1a,
+  0x03, 0x0f, 0x10, 0x0b, 0x7a, 0x2e, 0x11, 0x0b, 0x78, 0x2e, 0x13, 0x0b,
+  0x76, 0x30, 0x13, 0x0b, 0x75, 0x30, 0x15, 0x0b, 0x72, 0x31, 0x16, 0x0b,
+  0x71, 0x31, 0x17, 0x0b, 0x6f, 0x33, 0x17, 0x0c, 0x6d, 0x35, 0x17, 0x0b,
+  0x6c, 0x18, 0x08, 0x18, 0x15, 0x0c, 0x6a, 0x14, 0x11, 0x14, 0x15, 0x0c,
+  0x69, 0x13, 0x16, 0x12, 0x15, 0x0c, 0x67, 0x12, 0x1a, 0x11, 0x14, 0x0d,
+  0x66, 0x10, 0x1e, 0x10, 0x14, 0x0d, 0x64, 0x0f, 0x21, 0x10, 0x13, 0x0e,
+  0x62, 0x0f, 0x23, 0x10, 0x13, 0x0e, 0x60, 0x0f, 0x26, 0x0e, 0x13, 0x0f,
+  0x5f, 0x0e, 0x28, 0x0e, 0x13, 0x10, 0x5c, 0x0e, 0x2a, 0x0d, 0x14, 0x11,
+  0x5a, 0x0d, 0x2b, 0x0e, 0x14, 0x13, 0x56, 0x0d, 0x2d, 0x0d, 0x14, 0x16,
+  0x53, 0x0d, 0x2e, 0x0d, 0x14, 0x17, 0x50, 0x0d, 0x30, 0x0c, 0x15, 0x16,
+  0x50, 0x0c, 0x31, 0x0d, 0x16, 0x14, 0x50, 0x0c, 0x32, 0x0c, 0x17, 0x13,
+  0x4f, 0x0c, 0x33, 0x0c, 0x18, 0x11, 0x50, 0x0c, 0x34, 0x0b, 0x1a, 0x0f,
+  0x50, 0x0c, 0x34, 0x0c, 0x1a, 0x0e, 0x4f, 0x0c, 0x35, 0x14, 0x14, 0x0c,
+  0x4d, 0x0e, 0x36, 0x17, 0x10, 0x0b, 0x4b, 0x11, 0x36, 0x1a, 0x0c, 0x0c,
+  0x49, 0x13, 0x36, 0x1c, 0x0a, 0x0c, 0x47, 0x14, 0x37, 0x1e, 0x07, 0x0c,
+  0x47, 0x15, 0x38, 0x1e, 0x05, 0x0d, 0x45, 0x17, 0x38, 0x20, 0x02, 0x0d,
+  0x45, 0x18, 0x38, 0x2f, 0x44, 0x19, 0x38, 0x2e, 0x44, 0x1a, 0x38, 0x2e,
+  0x43, 0x1a, 0x39, 0x2d, 0x43, 0x15, 0x4f, 0x1c, 0x43, 0x13, 0x56, 0x17,
+  0x44, 0x10, 0x5b, 0x15, 0x43, 0x10, 0x5e, 0x12, 0x43, 0x0f, 0x61, 0x10,
+  0x44, 0x0e, 0x63, 0x0e, 0x44, 0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d,
+  0x42, 0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0c, 0x40, 0x0d, 0x6b, 0x0c,
+  0x40, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0b, 0x3f, 0x0b, 0x6f, 0x0b,
+  0x3e, 0x0c, 0x6f, 0x0c, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x18, 0x14,
+  0x10, 0x04, 0x12, 0x04, 0x1b, 0x0b, 0x3d, 0x0b, 0x17, 0x16, 0x0d, 0x08,
+  0x0e, 0x08, 0x19, 0x0b, 0x3d, 0x0b, 0x17, 0x15, 0x0e, 0x09, 0x0c, 0x0a,
+  0x18, 0x0b, 0x3d, 0x0b, 0x16, 0x16, 0x0d, 0x0a, 0x0c, 0x0a, 0x18, 0x0b,
+  0x3d, 0x0b, 0x16, 0x15, 0x0e, 0x0b, 0x0b, 0x0a, 0x18, 0x0b, 0x3d, 0x0c,
+  0x14, 0x16, 0x0e, 0x0b, 0x0a, 0x0c, 0x16, 0x0c, 0x3d, 0x0c, 0x14, 0x15,
+  0x0e, 0x0c, 0x0a, 0x0b, 0x17, 0x0b, 0x3f, 0x0b, 0x14, 0x15, 0x0e, 0x0b,
+  0x0b, 0x0b, 0x17, 0x0b, 0x3f, 0x0c, 0x12, 0x15, 0x0f, 0x0b, 0x0b, 0x0b,
+  0x16, 0x0c, 0x3f, 0x0c, 0x12, 0x15, 0x0f, 0x0b, 0x0a, 0x0c, 0x16, 0x0c,
+  0x40, 0x0c, 0x11, 0x14, 0x0f, 0x0c, 0x0a, 0x0b, 0x16, 0x0c, 0x41, 0x0d,
+  0x0f, 0x14, 0x10, 0x0b, 0x0b, 0x0b, 0x15, 0x0d, 0x41, 0x0d, 0x0f, 0x14,
+  0x10, 0x0b, 0x0a, 0x0c, 0x15, 0x0d, 0x42, 0x0d, 0x0d, 0x14, 0x10, 0x0c,
+  0x0a, 0x0c, 0x14, 0x0d, 0x43, 0x0e, 0x0c, 0x14, 0x10, 0x0c, 0x0a, 0x0b,
+  0x14, 0x0e, 0x44, 0x0e, 0x0b, 0x13, 0x11, 0x0b, 0x0b, 0x0b, 0x12, 0x0f,
+  0x46, 0x0e, 0x09, 0x14, 0x11, 0x0b, 0x0a, 0x0c, 0x11, 0x0f, 0x47, 0x10,
+  0x07, 0x13, 0x11, 0x0c, 0x0a, 0x0c, 0x10, 0x10, 0x48, 0x11, 0x05, 0x13,
+  0x11, 0x0c, 0x0a, 0x0b, 0x0f, 0x11, 0x4a, 0x12, 0x02, 0x13, 0x12, 0x0b,
+  0x0b, 0x0b, 0x0c, 0x13, 0x4c, 0x26, 0x12, 0x0b, 0x0a, 0x0c, 0x07, 0x17,
+  0x4d, 0x25, 0x12, 0x0c, 0x0a, 0x0c, 0x06, 0x18, 0x4e, 0x24, 0x12, 0x0c,
+  0x0a, 0x0b, 0x07, 0x17, 0x51, 0x21, 0x13, 0x0b, 0x0b, 0x0b, 0x07, 0x16,
+  0x53, 0x20, 0x13, 0x0b, 0x0a, 0x0c, 0x07, 0x14, 0x56, 0x1e, 0x13, 0x0c,
+  0x0a, 0x0c, 0x07, 0x13, 0x58, 0x1c, 0x14, 0x0b, 0x0b, 0x0b, 0x08, 0x12,
+  0x5b, 0x1a, 0x14, 0x0b, 0x0b, 0x0b, 0x08, 0x10, 0x5f, 0x17, 0x15, 0x0b,
+  0x0a, 0x0c, 0x08, 0x0e, 0x63, 0x15, 0x14, 0x0c, 0x0a, 0x0c, 0x08, 0x0c,
+  0x68, 0x11, 0x15, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x6b, 0x11, 0x15, 0x0b,
+  0x0b, 0x0b, 0x09, 0x04, 0x6f, 0x21, 0x05, 0x0c, 0x0a, 0x0c, 0x7c, 0x21,
+  0x05, 0x0c, 0x0a, 0x0b, 0x7c, 0x21, 0x06, 0x0b, 0x0b, 0x0b, 0x7c, 0x20,
+  0x07, 0x0b, 0x0b, 0x0b, 0x7c, 0x1f, 0x07, 0x0c, 0x0a, 0x0c, 0x7b, 0x1f,
+  0x08, 0x0c, 0x0a, 0x0b, 0x7c, 0x1f, 0x08, 0x0b, 0x0b, 0x0b, 0x7b, 0x1f,
+  0x09, 0x0b, 0x0b, 0x0b, 0x7b, 0x1e, 0x09, 0x0c, 0x0a, 0x0c, 0x7b, 0x1d,
+  0x0a, 0x0b, 0x0b, 0x0b, 0x7c, 0x1c, 0x0b, 0x0b, 0x0b, 0x0b, 0x8a, 0x01,
+  0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x8a, 0x01, 0x0d, 0x0b, 0x0c, 0x0b, 0x0b,
+  0x8a, 0x01, 0x0c, 0x0c, 0x0b, 0x0c, 0x0a, 0x8a, 0x01, 0x0c, 0x0d, 0x0b,
+  0x0d, 0x09, 0x8a, 0x01, 0x0c, 0x0d, 0x0b, 0x0e, 0x07, 0x8b, 0x01, 0x0b,
+  0x0d, 0x0c, 0x0f, 0x05, 0x8c, 0x01, 0x0a, 0x0e, 0x0b, 0xa0, 0x01, 0x0a,
+  0x0f, 0x0b, 0xa0, 0x01, 0x09, 0x0f, 0x0c, 0xa0, 0x01, 0x09, 0x0f, 0x0c,
+  0xa0, 0x01, 0x08, 0x10, 0x0b, 0xa0, 0x01, 0x08, 0x11, 0x0b, 0xa0, 0x01,
+  0x07, 0x11, 0x0c, 0xa0, 0x01, 0x06, 0x12, 0x0c, 0x9f, 0x01, 0x07, 0x12,
+  0x0b, 0xa0, 0x01, 0x06, 0x13, 0x0b, 0xa0, 0x01, 0x05, 0x13, 0x0c, 0xa0,
+  0x01, 0x04, 0x14, 0x0b, 0xa0, 0x01, 0x04, 0x15, 0x0b, 0xa0, 0x01, 0x04,
+  0x15, 0x0b, 0xa0, 0x01, 0x03, 0x16, 0x0b, 0xa0, 0x01, 0x02, 0x17, 0x0a,
+  0xa0, 0x01, 0x02, 0x18, 0x0a, 0xbb, 0x01, 0x09, 0xbc, 0x01, 0x07, 0xbf,
+  0x01, 0x02, 0xae, 0x19, 0x8d, 0x02, 0x04, 0x1a, 0x07, 0x18, 0x03, 0x03,
+  0x02, 0x18, 0x02, 0x04, 0x02, 0x17, 0x02, 0x06, 0x02, 0x16, 0x02, 0x07,
+  0x02, 0x15, 0x02, 0x08, 0x04, 0x11, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0b,
+  0x01, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x13, 0x02, 0x08,
+  0x02, 0x14, 0x04, 0x04, 0x04, 0x15, 0x09, 0x19, 0x06, 0xad, 0x02, 0x9b,
+  0x08, 0x08, 0x36, 0x0a, 0x34, 0x0c, 0x33, 0x08, 0x01, 0x04, 0x32, 0x06,
+  0x05, 0x03, 0x31, 0x06, 0x06, 0x04, 0x2f, 0x05, 0x08, 0x04, 0x2f, 0x04,
+  0x0a, 0x04, 0x2d, 0x05, 0x0a, 0x04, 0x2d, 0x04, 0x0c, 0x04, 0x2c, 0x04,
+  0x0d, 0x05, 0x29, 0x04, 0x0f, 0x06, 0x27, 0x04, 0x10, 0x0a, 0x22, 0x04,
+  0x11, 0x09, 0x22, 0x04, 0x13, 0x07, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04,
+  0x16, 0x04, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04, 0x16, 0x04, 0x23, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x05, 0x12, 0x05, 0x25, 0x05,
+  0x10, 0x05, 0x27, 0x05, 0x0e, 0x05, 0x28, 0x06, 0x0c, 0x06, 0x29, 0x07,
+  0x08, 0x07, 0x2b, 0x14, 0x2e, 0x10, 0x31, 0x0e, 0x35, 0x08, 0x9c, 0x09,
+  0x9d, 0x4a, 0x0d, 0xb1, 0x01, 0x14, 0xad, 0x01, 0x17, 0xaa, 0x01, 0x1a,
+  0xa8, 0x01, 0x1c, 0xa6, 0x01, 0x1e, 0xa4, 0x01, 0x20, 0xa2, 0x01, 0x22,
+  0xa1, 0x01, 0x23, 0x9f, 0x01, 0x25, 0x9e, 0x01, 0x26, 0x9d, 0x01, 0x18,
+  0x05, 0x0b, 0x9b, 0x01, 0x15, 0x09, 0x0b, 0x9a, 0x01, 0x14, 0x0b, 0x0b,
+  0x99, 0x01, 0x13, 0x0d, 0x0b, 0x98, 0x01, 0x12, 0x10, 0x0a, 0x97, 0x01,
+  0x11, 0x12, 0x0b, 0x95, 0x01, 0x11, 0x13, 0x0b, 0x94, 0x01, 0x10, 0x15,
+  0x0b, 0x93, 0x01, 0x10, 0x17, 0x0b, 0x92, 0x01, 0x0f, 0x18, 0x0b, 0x91,
+  0x01, 0x0f, 0x19, 0x0c, 0x90, 0x01, 0x0e, 0x1b, 0x0b, 0x8f, 0x01, 0x0e,
+  0x1c, 0x0c, 0x8d, 0x01, 0x0e, 0x1e, 0x0c, 0x8c, 0x01, 0x0e, 0x1e, 0x0c,
+  0x8b, 0x01, 0x0e, 0x20, 0x0c, 0x8a, 0x01, 0x0d, 0x21, 0x0d, 0x88, 0x01,
+  0x0e, 0x22, 0x0d, 0x87, 0x01, 0x0d, 0x23, 0x0e, 0x86, 0x01, 0x0d, 0x24,
+  0x0e, 0x84, 0x01, 0x0d, 0x26, 0x0e, 0x83, 0x01, 0x0d, 0x26, 0x0f, 0x82,
+  0x01, 0x0c, 0x28, 0x10, 0x7f, 0x0d, 0x29, 0x10, 0x7e, 0x0d, 0x2a, 0x11,
+  0x7c, 0x0c, 0x2c, 0x13, 0x79, 0x0c, 0x2d, 0x15, 0x75, 0x0d, 0x2e, 0x1d,
+  0x6c, 0x0c, 0x30, 0x20, 0x68, 0x0c, 0x32, 0x1e, 0x68, 0x0c, 0x33, 0x1d,
+  0x68, 0x0c, 0x35, 0x1b, 0x68, 0x0c, 0x36, 0x1a, 0x68, 0x0c, 0x38, 0x18,
+  0x68, 0x0c, 0x3a, 0x16, 0x68, 0x0c, 0x3d, 0x13, 0x68, 0x0c, 0x40, 0x10,
+  0x68, 0x0c, 0x43, 0x0d, 0x68, 0x0c, 0x45, 0x0b, 0x68, 0x0c, 0x45, 0x0b,
+  0x68, 0x0c, 0x45, 0x0b, 0x68, 0x0c, 0x45, 0x0b, 0x68, 0x0c, 0x45, 0x0b,
+  0x68, 0x0d, 0x43, 0x0b, 0x6a, 0x0c, 0x43, 0x0b, 0x6a, 0x0c, 0x43, 0x0b,
+  0x6a, 0x0c, 0x42, 0x0c, 0x6a, 0x0d, 0x41, 0x0c, 0x6a, 0x0d, 0x41, 0x0b,
+  0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0d, 0x3f, 0x0c, 0x6c, 0x0d, 0x3e, 0x0c,
+  0x6e, 0x0d, 0x3c, 0x0d, 0x6e, 0x0e, 0x3b, 0x0d, 0x6f, 0x0d, 0x3a, 0x0d,
+  0x70, 0x0e, 0x38, 0x0e, 0x71, 0x0e, 0x37, 0x0d, 0x72, 0x0e, 0x36, 0x0e,
+  0x73, 0x0e, 0x34, 0x0e, 0x74, 0x0f, 0x32, 0x0f, 0x75, 0x0f, 0x30, 0x0f,
+  0x76, 0x10, 0x2e, 0x0f, 0x78, 0x10, 0x2c, 0x10, 0x79, 0x11, 0x28, 0x11,
+  0x7b, 0x11, 0x26, 0x11, 0x7c, 0x13, 0x22, 0x12, 0x7e, 0x13, 0x1f, 0x13,
+  0x80, 0x01, 0x15, 0x1a, 0x15, 0x81, 0x01, 0x16, 0x16, 0x16, 0x83, 0x01,
+  0x18, 0x10, 0x18, 0x85, 0x01, 0x3d, 0x88, 0x01, 0x3b, 0x8b, 0x01, 0x38,
+  0x8d, 0x01, 0x36, 0x90, 0x01, 0x32, 0x93, 0x01, 0x30, 0x96, 0x01, 0x2c,
+  0x9a, 0x01, 0x28, 0x9e, 0x01, 0x24, 0xa3, 0x01, 0x1e, 0xa9, 0x01, 0x18,
+  0xb2, 0x01, 0x0d, 0xf7, 0x54, 0xd4, 0x01, 0x05, 0x1a, 0x03, 0x01, 0x02,
+  0x14, 0x07, 0x03, 0x02, 0x12, 0x09, 0x04, 0x02, 0x11, 0x02, 0x05, 0x03,
+  0x03, 0x02, 0x10, 0x02, 0x07, 0x02, 0x04, 0x03, 0x0e, 0x02, 0x08, 0x02,
+  0x04, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x01, 0x02, 0x0b, 0x03, 0x0d, 0x04,
+  0x0b, 0x02, 0x11, 0x02, 0x0b, 0x01, 0x13, 0x01, 0x2b, 0x15, 0x0b, 0x15,
+  0x29, 0x14, 0x0b, 0x15, 0x50, 0x15, 0xc3, 0x01, 0xec, 0x05, 0x04, 0x39,
+  0x0a, 0x34, 0x0b, 0x34, 0x0c, 0x33, 0x06, 0x03, 0x04, 0x29, 0x0e, 0x06,
+  0x03, 0x27, 0x0f, 0x07, 0x03, 0x26, 0x10, 0x07, 0x04, 0x23, 0x08, 0x03,
+  0x07, 0x07, 0x04, 0x23, 0x05, 0x09, 0x05, 0x07, 0x04, 0x21, 0x05, 0x0b,
+  0x05, 0x06, 0x05, 0x1f, 0x05, 0x0d, 0x05, 0x06, 0x06, 0x1d, 0x04, 0x0f,
+  0x04, 0x07, 0x07, 0x1a, 0x04, 0x11, 0x03, 0x08, 0x06, 0x1a, 0x04, 0x11,
+  0x06, 0x06, 0x05, 0x18, 0x06, 0x11, 0x09, 0x03, 0x04, 0x17, 0x08, 0x11,
+  0x10, 0x16, 0x08, 0x13, 0x0e, 0x16, 0x06, 0x1c, 0x07, 0x17, 0x04, 0x20,
+  0x05, 0x16, 0x04, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04, 0xd6, 0x01, 0x2a,
+  0x15, 0x2b, 0x15, 0x2b, 0x16, 0x2a, 0xd0, 0x01, 0x2b, 0x15, 0x2b, 0x15,
+  0x2b, 0xdf, 0x01, 0x29, 0x16, 0x2b, 0x15, 0x2b, 0x16, 0x2a, 0xc6, 0x05,
+  0x92, 0x35, 0x05, 0xb9, 0x01, 0x11, 0xb0, 0x01, 0x18, 0xaa, 0x01, 0x1c,
+  0xa6, 0x01, 0x1e, 0xa4, 0x01, 0x20, 0xa2, 0x01, 0x21, 0xa2, 0x01, 0x22,
+  0xa1, 0x01, 0x23, 0xa0, 0x01, 0x24, 0x9e, 0x01, 0x26, 0x9e, 0x01, 0x26,
+  0x9d, 0x01, 0x13, 0x08, 0x0b, 0x9d, 0x01, 0x12, 0x0a, 0x0b, 0x85, 0x01,
+  0x0c, 0x0b, 0x11, 0x0c, 0x0b, 0x81, 0x01, 0x15, 0x05, 0x10, 0x0e, 0x0b,
+  0x7e, 0x1b, 0x02, 0x0f, 0x0f, 0x0c, 0x7a, 0x2d, 0x11, 0x0c, 0x78, 0x2e,
+  0x13, 0x0b, 0x77, 0x2e, 0x14, 0x0b, 0x75, 0x30, 0x14, 0x0b, 0x74, 0x30,
+  0x15, 0x0c, 0x71, 0x31, 0x16, 0x0c, 0x70, 0x33, 0x16, 0x0c, 0x6e, 0x35,
+  0x15, 0x0c, 0x6d, 0x16, 0x0a, 0x17, 0x14, 0x0d, 0x6b, 0x13, 0x12, 0x14,
+  0x14, 0x0c, 0x6a, 0x12, 0x17, 0x12, 0x13, 0x0d, 0x68, 0x11, 0x1b, 0x11,
+  0x13, 0x0d, 0x66, 0x10, 0x1e, 0x10, 0x13, 0x0e, 0x65, 0x0f, 0x21, 0x0f,
+  0x13, 0x0e, 0x63, 0x0f, 0x23, 0x0f, 0x12, 0x0f, 0x61, 0x0e, 0x26, 0x0e,
+  0x13, 0x10, 0x5f, 0x0d, 0x28, 0x0e, 0x13, 0x10, 0x5d, 0x0e, 0x29, 0x0e,
+  0x12, 0x13, 0x5a, 0x0d, 0x2b, 0x0d, 0x13, 0x14, 0x57, 0x0d, 0x2d, 0x0c,
+  0x14, 0x16, 0x54, 0x0c, 0x2f, 0x0c, 0x14, 0x17, 0x51, 0x0d, 0x2f, 0x0c,
+  0x15, 0x16, 0x51, 0x0c, 0x31, 0x0c, 0x15, 0x14, 0x52, 0x0c, 0x31, 0x0c,
+  0x17, 0x12, 0x51, 0x0c, 0x33, 0x0b, 0x18, 0x11, 0x51, 0x0c, 0x33, 0x0c,
+  0x19, 0x0f, 0x51, 0x0b, 0x35, 0x0b, 0x1a, 0x0d, 0x51, 0x0c, 0x35, 0x15,
+  0x11, 0x0c, 0x4e, 0x0f, 0x35, 0x18, 0x0e, 0x0c, 0x4c, 0x11, 0x35, 0x1a,
+  0x0b, 0x0c, 0x4a, 0x13, 0x37, 0x1b, 0x08, 0x0d, 0x49, 0x14, 0x37, 0x1d,
+  0x06, 0x0c, 0x48, 0x16, 0x37, 0x1f, 0x03, 0x0d, 0x47, 0x17, 0x37, 0x20,
+  0x01, 0x0e, 0x46, 0x18, 0x37, 0x2e, 0x46, 0x19, 0x37, 0x2d, 0x46, 0x19,
+  0x38, 0x2d, 0x45, 0x17, 0x49, 0x1e, 0x45, 0x13, 0x53, 0x18, 0x45, 0x11,
+  0x58, 0x15, 0x46, 0x0f, 0x5c, 0x13, 0x45, 0x0f, 0x5e, 0x11, 0x45, 0x0e,
+  0x62, 0x0e, 0x46, 0x0d, 0x64, 0x0d, 0x45, 0x0d, 0x66, 0x0d, 0x44, 0x0c,
+  0x68, 0x0c, 0x44, 0x0c, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x42, 0x0b,
+  0x6b, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x41, 0x0a, 0x6e, 0x0a, 0xa8, 0x0e,
+  0x7e, 0x44, 0x81, 0x01, 0x42, 0x83, 0x01, 0x41, 0x84, 0x01, 0x40, 0x84,
+  0x01, 0x3f, 0x85, 0x01, 0x40, 0x84, 0x01, 0x40, 0x83, 0x01, 0x42, 0x82,
+  0x01, 0x42, 0x81, 0x01, 0x45, 0x7e, 0x99, 0x0e, 0x7e, 0x44, 0x81, 0x01,
+  0x42, 0x83, 0x01, 0x41, 0x84, 0x01, 0x40, 0x84, 0x01, 0x3f, 0x85, 0x01,
+  0x3f, 0x85, 0x01, 0x40, 0x84, 0x01, 0x40, 0x83, 0x01, 0x42, 0x81, 0x01,
+  0x45, 0x7e, 0xc7, 0x0e, 0x7d, 0x45, 0x81, 0x01, 0x42, 0x83, 0x01, 0x40,
+  0x84, 0x01, 0x40, 0x84, 0x01, 0x40, 0x85, 0x01, 0x3f, 0x84, 0x01, 0x40,
+  0x84, 0x01, 0x41, 0x83, 0x01, 0x42, 0x81, 0x01, 0x44, 0x7f, 0x9c, 0x34,
+  0x8d, 0x02, 0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x16, 0x02, 0x07,
+  0x02, 0x14, 0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a,
+  0x06, 0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12,
+  0x02, 0x0a, 0x02, 0x06, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x02, 0x0a,
+  0x02, 0x05, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x0b, 0x02, 0x04,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x02, 0x0c, 0x04, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x02, 0x01, 0x04, 0x0d, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x03, 0x12, 0x02, 0x02, 0x02, 0x01, 0x02, 0x17, 0x02, 0x01,
+  0x02, 0x02, 0x02, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x1a, 0x02, 0x1e,
+  0x02, 0x1d, 0x02, 0x71, 0x9b, 0x08, 0x07, 0x36, 0x0d, 0x32, 0x0f, 0x30,
+  0x08, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05, 0x2c, 0x05, 0x0b, 0x05, 0x2a,
+  0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04, 0x28, 0x04, 0x11, 0x03, 0x28,
+  0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09, 0x1e, 0x08, 0x12, 0x0a, 0x1b,
+  0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06, 0x18, 0x04, 0x20, 0x04, 0x17,
+  0x04, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14,
+  0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x0c, 0x01, 0x06,
+  0x01, 0x06, 0x02, 0x08, 0x04, 0x14, 0x04, 0x0b, 0x03, 0x04, 0x03, 0x04,
+  0x04, 0x07, 0x04, 0x14, 0x04, 0x0b, 0x03, 0x04, 0x04, 0x03, 0x04, 0x07,
+  0x04, 0x14, 0x04, 0x0a, 0x04, 0x04, 0x03, 0x04, 0x03, 0x08, 0x04, 0x15,
+  0x04, 0x09, 0x04, 0x03, 0x04, 0x03, 0x04, 0x07, 0x04, 0x16, 0x05, 0x08,
+  0x04, 0x03, 0x04, 0x03, 0x04, 0x06, 0x05, 0x17, 0x06, 0x05, 0x04, 0x04,
+  0x03, 0x04, 0x04, 0x04, 0x06, 0x19, 0x07, 0x03, 0x04, 0x03, 0x04, 0x04,
+  0x03, 0x03, 0x07, 0x1b, 0x06, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+  0x06, 0x1e, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x23,
+  0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x29, 0x04, 0x03,
+  0x04, 0x03, 0x04, 0x2e, 0x04, 0x03, 0x04, 0x03, 0x04, 0x2e, 0x03, 0x04,
+  0x04, 0x03, 0x04, 0x2d, 0x04, 0x04, 0x03, 0x04, 0x03, 0x2f, 0x03, 0x03,
+  0x04, 0x04, 0x03, 0x35, 0x04, 0x3c, 0x03, 0x3c, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x03, 0x3e, 0x01, 0xe3, 0x02, 0xd9, 0x4b, 0x11, 0xaf, 0x01,
+  0x19, 0xa9, 0x01, 0x1d, 0xa4, 0x01, 0x23, 0x9f, 0x01, 0x26, 0x9d, 0x01,
+  0x29, 0x99, 0x01, 0x2d, 0x96, 0x01, 0x2f, 0x94, 0x01, 0x31, 0x91, 0x01,
+  0x34, 0x8f, 0x01, 0x36, 0x8d, 0x01, 0x15, 0x0e, 0x15, 0x8b, 0x01, 0x13,
+  0x15, 0x12, 0x8a, 0x01, 0x11, 0x19, 0x11, 0x88, 0x01, 0x10, 0x1d, 0x10,
+  0x86, 0x01, 0x10, 0x1f, 0x10, 0x84, 0x01, 0x0f, 0x22, 0x10, 0x83, 0x01,
+  0x0e, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01, 0x0e, 0x29,
+  0x0d, 0x80, 0x01, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2c, 0x0d, 0x7e, 0x0d,
+  0x2d, 0x0d, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c, 0x0c, 0x31, 0x0c, 0x7b, 0x0c,
+  0x31, 0x0c, 0x7a, 0x0c, 0x33, 0x0b, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0b,
+  0x34, 0x0c, 0x78, 0x0c, 0x35, 0x0e, 0x74, 0x0d, 0x35, 0x16, 0x69, 0x10,
+  0x35, 0x19, 0x63, 0x12, 0x37, 0x1a, 0x60, 0x13, 0x37, 0x1c, 0x5c, 0x15,
+  0x37, 0x1e, 0x58, 0x17, 0x37, 0x1f, 0x56, 0x18, 0x37, 0x21, 0x53, 0x19,
+  0x37, 0x22, 0x51, 0x19, 0x38, 0x23, 0x4f, 0x1a, 0x39, 0x23, 0x4d, 0x16,
+  0x4c, 0x16, 0x4b, 0x13, 0x54, 0x13, 0x4a, 0x10, 0x5a, 0x10, 0x49, 0x10,
+  0x5c, 0x10, 0x47, 0x0f, 0x60, 0x0f, 0x46, 0x0e, 0x62, 0x0e, 0x45, 0x0e,
+  0x64, 0x0e, 0x44, 0x0d, 0x66, 0x0d, 0x43, 0x0d, 0x68, 0x0d, 0x42, 0x0c,
+  0x6a, 0x0c, 0x41, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0b,
+  0x6e, 0x0b, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e, 0x0b,
+  0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3d, 0x0c,
+  0x71, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b,
+  0x72, 0x0b, 0x3c, 0x0b, 0x27, 0x03, 0x14, 0x01, 0x14, 0x03, 0x1c, 0x0b,
+  0x3c, 0x0b, 0x25, 0x07, 0x0f, 0x07, 0x0f, 0x07, 0x1a, 0x0b, 0x3c, 0x0c,
+  0x23, 0x09, 0x0d, 0x09, 0x0d, 0x09, 0x19, 0x0b, 0x3d, 0x0b, 0x23, 0x0a,
+  0x0c, 0x0a, 0x0c, 0x09, 0x18, 0x0b, 0x3e, 0x0b, 0x22, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x17, 0x0b, 0x3e, 0x0b, 0x22, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x17, 0x0b, 0x3e, 0x0c, 0x21, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x17, 0x0b,
+  0x3e, 0x0c, 0x20, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x16, 0x0c, 0x3e, 0x0c,
+  0x20, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x17, 0x0b, 0x40, 0x0c, 0x1f, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x40, 0x0c, 0x1e, 0x0c, 0x0b, 0x0b,
+  0x0a, 0x0c, 0x16, 0x0c, 0x40, 0x0d, 0x1d, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b,
+  0x16, 0x0c, 0x42, 0x0d, 0x1c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x15, 0x0d,
+  0x42, 0x0e, 0x1b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x14, 0x0e, 0x43, 0x0e,
+  0x19, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x14, 0x0d, 0x44, 0x0f, 0x18, 0x0c,
+  0x0a, 0x0c, 0x0a, 0x0b, 0x14, 0x0e, 0x45, 0x0f, 0x17, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x12, 0x0f, 0x47, 0x0f, 0x15, 0x0c, 0x0b, 0x0b, 0x0a, 0x0c,
+  0x11, 0x0f, 0x48, 0x11, 0x13, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x10, 0x11,
+  0x49, 0x12, 0x11, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x0e, 0x12, 0x4b, 0x14,
+  0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x15, 0x4d, 0x17, 0x09, 0x0c,
+  0x0b, 0x0b, 0x0a, 0x0c, 0x07, 0x17, 0x4f, 0x17, 0x08, 0x0c, 0x0a, 0x0c,
+  0x0a, 0x0b, 0x07, 0x17, 0x51, 0x16, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x07, 0x16, 0x53, 0x15, 0x07, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x07, 0x15,
+  0x55, 0x14, 0x07, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x08, 0x14, 0x58, 0x12,
+  0x07, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x08, 0x12, 0x5b, 0x11, 0x07, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x11, 0x5e, 0x0f, 0x06, 0x0c, 0x0b, 0x0b,
+  0x0a, 0x0c, 0x08, 0x0f, 0x62, 0x0d, 0x06, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b,
+  0x09, 0x0d, 0x67, 0x0a, 0x06, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0a,
+  0x6f, 0x04, 0x06, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x04, 0x7e, 0x0c,
+  0x0a, 0x0c, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x8d,
+  0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b, 0x0a,
+  0x0c, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0b,
+  0x0c, 0x0a, 0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01,
+  0x0c, 0x0b, 0x0b, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b,
+  0x8d, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x8c, 0x01, 0x0c, 0x0a, 0x0c, 0x0a, 0x0b, 0x8d, 0x01, 0x0b,
+  0x0b, 0x0c, 0x0b, 0x0a, 0x8e, 0x01, 0x0a, 0x0b, 0x0b, 0x0c, 0x0a, 0x8e,
+  0x01, 0x09, 0x0c, 0x0b, 0x0c, 0x09, 0x90, 0x01, 0x08, 0x0b, 0x0c, 0x0d,
+  0x07, 0x93, 0x01, 0x04, 0x0d, 0x0c, 0x0f, 0x04, 0xa5, 0x01, 0x0b, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x09, 0xbc, 0x01, 0x07, 0xc0, 0x01, 0x02, 0xab, 0x19, 0x8d, 0x02,
+  0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x16, 0x02, 0x07, 0x02, 0x14,
+  0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06, 0x0c,
+  0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a,
+  0x02, 0x06, 0x01, 0x06, 0x01, 0x04, 0x02, 0x0a, 0x02, 0x05, 0x02, 0x05,
+  0x02, 0x04, 0x02, 0x0b, 0x02, 0x04, 0x02, 0x06, 0x01, 0x03, 0x02, 0x0c,
+  0x04, 0x0c, 0x04, 0x0d, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x16, 0x02, 0x1a, 0x01, 0x06, 0x02, 0x17, 0x02, 0x01, 0x02, 0x02,
+  0x02, 0x3a, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x51, 0x9b, 0x08, 0x07, 0x36,
+  0x0d, 0x32, 0x0f, 0x30, 0x08, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05, 0x2c,
+  0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04, 0x28,
+  0x04, 0x11, 0x04, 0x27, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09, 0x1e,
+  0x08, 0x12, 0x0a, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x07, 0x1b, 0x06, 0x18,
+  0x04, 0x20, 0x04, 0x17, 0x04, 0x22, 0x04, 0x16, 0x04, 0x22, 0x04, 0x15,
+  0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14,
+  0x04, 0x0c, 0x01, 0x18, 0x03, 0x14, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x07,
+  0x04, 0x14, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x07, 0x04, 0x14, 0x04, 0x0a,
+  0x04, 0x0b, 0x03, 0x08, 0x04, 0x15, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x07,
+  0x04, 0x16, 0x05, 0x09, 0x02, 0x0c, 0x03, 0x06, 0x05, 0x17, 0x06, 0x1c,
+  0x06, 0x19, 0x07, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x07, 0x1b,
+  0x07, 0x02, 0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x06, 0x1e, 0x05, 0x02,
+  0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x23, 0x01, 0x04, 0x02, 0x04,
+  0x04, 0x04, 0x02, 0x04, 0x01, 0x31, 0x03, 0x36, 0x01, 0x0d, 0x02, 0x2f,
+  0x03, 0x0b, 0x04, 0x2e, 0x03, 0x04, 0x03, 0x04, 0x04, 0x2e, 0x03, 0x04,
+  0x03, 0x04, 0x03, 0x2f, 0x03, 0x04, 0x03, 0x04, 0x03, 0xb5, 0x01, 0x02,
+  0x3d, 0x04, 0x3c, 0x04, 0x3c, 0x03, 0x3e, 0x01, 0xa3, 0x02, 0xd9, 0x4b,
+  0x11, 0xaf, 0x01, 0x19, 0xa9, 0x01, 0x1d, 0xa4, 0x01, 0x23, 0x9f, 0x01,
+  0x26, 0x9d, 0x01, 0x29, 0x99, 0x01, 0x2d, 0x96, 0x01, 0x2f, 0x94, 0x01,
+  0x31, 0x92, 0x01, 0x33, 0x8f, 0x01, 0x36, 0x8d, 0x01, 0x15, 0x0f, 0x14,
+  0x8b, 0x01, 0x13, 0x15, 0x12, 0x8a, 0x01, 0x11, 0x19, 0x11, 0x88, 0x01,
+  0x10, 0x1d, 0x10, 0x86, 0x01, 0x10, 0x1f, 0x10, 0x84, 0x01, 0x0f, 0x23,
+  0x0f, 0x83, 0x01, 0x0e, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80,
+  0x01, 0x0e, 0x29, 0x0d, 0x80, 0x01, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2d,
+  0x0d, 0x7d, 0x0d, 0x2d, 0x0d, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c, 0x0c, 0x31,
+  0x0c, 0x7b, 0x0c, 0x31, 0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x33,
+  0x0c, 0x79, 0x0c, 0x34, 0x0b, 0x78, 0x0c, 0x35, 0x0e, 0x74, 0x0d, 0x35,
+  0x16, 0x69, 0x10, 0x35, 0x19, 0x64, 0x11, 0x37, 0x1a, 0x60, 0x13, 0x37,
+  0x1c, 0x5c, 0x15, 0x37, 0x1e, 0x59, 0x16, 0x37, 0x1f, 0x56, 0x18, 0x37,
+  0x21, 0x53, 0x19, 0x37, 0x22, 0x51, 0x1a, 0x38, 0x22, 0x4f, 0x1a, 0x39,
+  0x23, 0x4d, 0x18, 0x4a, 0x16, 0x4b, 0x13, 0x54, 0x13, 0x4a, 0x11, 0x59,
+  0x10, 0x49, 0x10, 0x5c, 0x10, 0x47, 0x0f, 0x60, 0x0f, 0x46, 0x0e, 0x62,
+  0x0e, 0x45, 0x0e, 0x64, 0x0e, 0x44, 0x0d, 0x66, 0x0d, 0x43, 0x0d, 0x68,
+  0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x41, 0x0d, 0x6b, 0x0c, 0x40, 0x0c, 0x6c,
+  0x0c, 0x40, 0x0c, 0x6d, 0x0b, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f,
+  0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0c, 0x3d, 0x0b, 0x71, 0x0b, 0x3c, 0x0c, 0x71, 0x0b, 0x3c, 0x0c, 0x71,
+  0x0b, 0x3c, 0x0c, 0x71, 0x0b, 0x3c, 0x0c, 0x26, 0x03, 0x48, 0x0b, 0x3c,
+  0x0c, 0x24, 0x07, 0x25, 0x06, 0x1b, 0x0b, 0x3c, 0x0c, 0x23, 0x09, 0x23,
+  0x09, 0x19, 0x0b, 0x3d, 0x0b, 0x23, 0x0a, 0x22, 0x09, 0x18, 0x0c, 0x3d,
+  0x0b, 0x22, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x3e, 0x0b, 0x22, 0x0b, 0x21,
+  0x0b, 0x17, 0x0b, 0x3e, 0x0c, 0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x3e,
+  0x0c, 0x21, 0x0b, 0x20, 0x0c, 0x16, 0x0c, 0x3f, 0x0b, 0x20, 0x0c, 0x20,
+  0x0c, 0x16, 0x0c, 0x3f, 0x0c, 0x1f, 0x0c, 0x20, 0x0b, 0x16, 0x0c, 0x40,
+  0x0d, 0x1e, 0x0b, 0x20, 0x0c, 0x16, 0x0c, 0x41, 0x0c, 0x1e, 0x0b, 0x20,
+  0x0c, 0x15, 0x0d, 0x41, 0x0d, 0x1d, 0x0b, 0x20, 0x0b, 0x15, 0x0d, 0x42,
+  0x0e, 0x1c, 0x0a, 0x22, 0x0a, 0x15, 0x0d, 0x43, 0x0e, 0x1b, 0x0a, 0x22,
+  0x0a, 0x14, 0x0d, 0x45, 0x0e, 0x1b, 0x08, 0x24, 0x08, 0x14, 0x0e, 0x45,
+  0x0f, 0x1c, 0x05, 0x26, 0x06, 0x13, 0x0f, 0x47, 0x0f, 0x5e, 0x0f, 0x48,
+  0x11, 0x5a, 0x11, 0x49, 0x12, 0x56, 0x12, 0x4b, 0x14, 0x28, 0x01, 0x27,
+  0x14, 0x4d, 0x18, 0x0b, 0x04, 0x11, 0x07, 0x20, 0x17, 0x4f, 0x17, 0x09,
+  0x07, 0x0f, 0x09, 0x0e, 0x06, 0x0a, 0x17, 0x51, 0x16, 0x09, 0x08, 0x0e,
+  0x09, 0x0c, 0x09, 0x09, 0x16, 0x53, 0x15, 0x08, 0x0a, 0x0c, 0x0b, 0x0b,
+  0x09, 0x09, 0x15, 0x55, 0x14, 0x08, 0x0a, 0x0c, 0x0b, 0x0a, 0x0b, 0x08,
+  0x14, 0x58, 0x12, 0x08, 0x0a, 0x0c, 0x0b, 0x0a, 0x0b, 0x08, 0x13, 0x5a,
+  0x11, 0x08, 0x0a, 0x0b, 0x0c, 0x0a, 0x0b, 0x08, 0x11, 0x5e, 0x0f, 0x08,
+  0x0a, 0x0b, 0x0b, 0x0c, 0x0a, 0x08, 0x0f, 0x62, 0x0d, 0x09, 0x09, 0x0b,
+  0x0b, 0x0c, 0x09, 0x09, 0x0d, 0x67, 0x0a, 0x09, 0x08, 0x0c, 0x0b, 0x0d,
+  0x08, 0x09, 0x0a, 0x6f, 0x04, 0x0c, 0x04, 0x0d, 0x0c, 0x0e, 0x05, 0x0c,
+  0x05, 0x94, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x09, 0xa6, 0x01, 0x02, 0x14, 0x07, 0xa5, 0x01, 0x06, 0x15, 0x01, 0x10,
+  0x06, 0x91, 0x01, 0x08, 0x24, 0x08, 0x8f, 0x01, 0x0a, 0x22, 0x0a, 0x8e,
+  0x01, 0x0a, 0x21, 0x0b, 0x8d, 0x01, 0x0c, 0x20, 0x0b, 0x8d, 0x01, 0x0c,
+  0x0c, 0x05, 0x0f, 0x0b, 0x8d, 0x01, 0x0b, 0x0c, 0x08, 0x0d, 0x0b, 0x8d,
+  0x01, 0x0b, 0x0b, 0x09, 0x0d, 0x0b, 0x8d, 0x01, 0x0b, 0x0b, 0x0a, 0x0c,
+  0x0b, 0x8d, 0x01, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x8e, 0x01, 0x0a, 0x0b,
+  0x0b, 0x0c, 0x0a, 0x8e, 0x01, 0x0a, 0x0b, 0x0b, 0x0c, 0x0a, 0x8f, 0x01,
+  0x09, 0x0c, 0x09, 0x0d, 0x09, 0x91, 0x01, 0x07, 0x0e, 0x08, 0x0e, 0x08,
+  0x94, 0x01, 0x01, 0x12, 0x06, 0x11, 0x04, 0xf9, 0x08, 0x06, 0xbd, 0x01,
+  0x08, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01,
+  0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x09, 0xbc, 0x01,
+  0x08, 0xbf, 0x01, 0x02, 0xdf, 0x14, 0x8d, 0x02, 0x05, 0x19, 0x08, 0x17,
+  0x03, 0x05, 0x02, 0x16, 0x02, 0x07, 0x02, 0x14, 0x02, 0x08, 0x02, 0x13,
+  0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x02, 0x10, 0x02, 0x0b,
+  0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a,
+  0x02, 0x12, 0x02, 0x0b, 0x02, 0x05, 0x02, 0x03, 0x01, 0x05, 0x02, 0x0c,
+  0x04, 0x02, 0x03, 0x02, 0x02, 0x03, 0x04, 0x0d, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x04, 0x12, 0x02, 0x02, 0x03, 0x02, 0x02, 0x15, 0x01, 0x03,
+  0x02, 0x02, 0x02, 0x19, 0x02, 0x03, 0x01, 0x15, 0x01, 0x03, 0x02, 0x22,
+  0x02, 0x19, 0x01, 0x04, 0x01, 0x1a, 0x01, 0x53, 0x9b, 0x08, 0x07, 0x36,
+  0x0d, 0x32, 0x0f, 0x30, 0x08, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05, 0x2c,
+  0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04, 0x28,
+  0x04, 0x11, 0x04, 0x27, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09, 0x1e,
+  0x07, 0x12, 0x0b, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06, 0x17,
+  0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x05, 0x22, 0x04, 0x15,
+  0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14,
+  0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14,
+  0x04, 0x24, 0x04, 0x15, 0x04, 0x0c, 0x02, 0x07, 0x02, 0x0b, 0x04, 0x16,
+  0x05, 0x0a, 0x04, 0x05, 0x04, 0x09, 0x05, 0x17, 0x06, 0x07, 0x05, 0x05,
+  0x04, 0x07, 0x06, 0x19, 0x07, 0x04, 0x05, 0x05, 0x04, 0x05, 0x08, 0x1b,
+  0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x08, 0x1d, 0x03, 0x05, 0x04, 0x05,
+  0x05, 0x04, 0x07, 0x26, 0x04, 0x05, 0x05, 0x04, 0x05, 0x28, 0x05, 0x04,
+  0x05, 0x04, 0x05, 0x29, 0x04, 0x04, 0x05, 0x04, 0x05, 0x2b, 0x02, 0x05,
+  0x04, 0x04, 0x05, 0x32, 0x05, 0x04, 0x04, 0x29, 0x01, 0x08, 0x05, 0x05,
+  0x03, 0x29, 0x04, 0x05, 0x05, 0x07, 0x01, 0x2a, 0x04, 0x05, 0x04, 0x34,
+  0x02, 0x07, 0x02, 0x05, 0x03, 0x3d, 0x03, 0x33, 0x01, 0x09, 0x03, 0x32,
+  0x03, 0x3d, 0x03, 0x3d, 0x03, 0xa6, 0x02, 0xd9, 0x4b, 0x10, 0xb0, 0x01,
+  0x18, 0xaa, 0x01, 0x1d, 0xa4, 0x01, 0x22, 0xa0, 0x01, 0x26, 0x9d, 0x01,
+  0x29, 0x99, 0x01, 0x2d, 0x96, 0x01, 0x2f, 0x93, 0x01, 0x32, 0x91, 0x01,
+  0x34, 0x8f, 0x01, 0x36, 0x8d, 0x01, 0x15, 0x0e, 0x15, 0x8b, 0x01, 0x13,
+  0x15, 0x12, 0x89, 0x01, 0x12, 0x19, 0x11, 0x87, 0x01, 0x11, 0x1d, 0x10,
+  0x86, 0x01, 0x10, 0x1f, 0x10, 0x84, 0x01, 0x0f, 0x23, 0x0f, 0x82, 0x01,
+  0x0f, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01, 0x0e, 0x29,
+  0x0e, 0x7f, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2d, 0x0d, 0x7d, 0x0c, 0x2e,
+  0x0d, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c, 0x0c, 0x31, 0x0c, 0x7a, 0x0d, 0x31,
+  0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x33, 0x0c, 0x79, 0x0b, 0x34,
+  0x0c, 0x78, 0x0c, 0x35, 0x11, 0x71, 0x0d, 0x35, 0x16, 0x69, 0x0f, 0x36,
+  0x19, 0x63, 0x12, 0x37, 0x1b, 0x5e, 0x14, 0x37, 0x1c, 0x5c, 0x15, 0x37,
+  0x1e, 0x58, 0x17, 0x37, 0x20, 0x55, 0x17, 0x38, 0x21, 0x53, 0x18, 0x38,
+  0x22, 0x51, 0x19, 0x38, 0x23, 0x4f, 0x1a, 0x39, 0x23, 0x4d, 0x16, 0x4b,
+  0x17, 0x4b, 0x12, 0x55, 0x13, 0x49, 0x11, 0x5a, 0x11, 0x48, 0x0f, 0x5e,
+  0x0f, 0x47, 0x0f, 0x60, 0x0f, 0x45, 0x0f, 0x62, 0x0f, 0x44, 0x0e, 0x64,
+  0x0e, 0x43, 0x0e, 0x66, 0x0e, 0x42, 0x0d, 0x68, 0x0d, 0x41, 0x0d, 0x6a,
+  0x0c, 0x41, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x3f, 0x0c, 0x6e,
+  0x0b, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0c, 0x3c, 0x0c, 0x70,
+  0x0c, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0c, 0x71,
+  0x0b, 0x3c, 0x0c, 0x70, 0x0c, 0x3d, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e,
+  0x0c, 0x3f, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0d, 0x6a,
+  0x0d, 0x41, 0x0d, 0x26, 0x03, 0x19, 0x05, 0x21, 0x0d, 0x42, 0x0d, 0x24,
+  0x07, 0x15, 0x08, 0x20, 0x0d, 0x43, 0x0d, 0x22, 0x09, 0x14, 0x09, 0x1e,
+  0x0d, 0x44, 0x0e, 0x20, 0x0a, 0x13, 0x0a, 0x1d, 0x0e, 0x45, 0x0f, 0x1d,
+  0x0c, 0x11, 0x0c, 0x1a, 0x0f, 0x47, 0x0f, 0x1b, 0x0d, 0x10, 0x0d, 0x19,
+  0x0f, 0x48, 0x11, 0x19, 0x0d, 0x0f, 0x0e, 0x17, 0x11, 0x49, 0x12, 0x16,
+  0x0e, 0x0e, 0x0e, 0x16, 0x12, 0x4b, 0x14, 0x12, 0x0e, 0x0f, 0x0e, 0x13,
+  0x14, 0x4d, 0x17, 0x0d, 0x0e, 0x0f, 0x0e, 0x0e, 0x19, 0x4f, 0x15, 0x0d,
+  0x0f, 0x0e, 0x0e, 0x0d, 0x1a, 0x51, 0x13, 0x0d, 0x0f, 0x0e, 0x0e, 0x0d,
+  0x1a, 0x53, 0x12, 0x0c, 0x0f, 0x0e, 0x0f, 0x0c, 0x1a, 0x55, 0x10, 0x0d,
+  0x0e, 0x0e, 0x0f, 0x0d, 0x19, 0x57, 0x0e, 0x0d, 0x0e, 0x0f, 0x0e, 0x0d,
+  0x19, 0x5a, 0x0b, 0x0d, 0x0e, 0x0f, 0x0e, 0x0d, 0x18, 0x5e, 0x08, 0x0d,
+  0x0f, 0x0e, 0x0e, 0x0d, 0x17, 0x62, 0x06, 0x0c, 0x0f, 0x0e, 0x0e, 0x0d,
+  0x16, 0x66, 0x03, 0x0c, 0x0f, 0x0e, 0x0f, 0x0c, 0x14, 0x77, 0x0f, 0x0e,
+  0x0f, 0x0c, 0x11, 0x7b, 0x0e, 0x0f, 0x0e, 0x0d, 0x0e, 0x7d, 0x0e, 0x0f,
+  0x0e, 0x0d, 0x0e, 0x7e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0f, 0x7d, 0x0e, 0x0e,
+  0x0e, 0x0d, 0x0f, 0x7e, 0x0d, 0x0e, 0x0f, 0x0c, 0x0f, 0x80, 0x01, 0x0b,
+  0x0e, 0x0f, 0x0c, 0x0f, 0x81, 0x01, 0x0a, 0x0f, 0x0e, 0x0d, 0x0e, 0x83,
+  0x01, 0x08, 0x0f, 0x0e, 0x0d, 0x0e, 0x85, 0x01, 0x06, 0x0f, 0x0e, 0x0d,
+  0x0e, 0x89, 0x01, 0x01, 0x10, 0x0e, 0x0d, 0x0f, 0x99, 0x01, 0x0f, 0x0d,
+  0x0e, 0x99, 0x01, 0x0f, 0x0d, 0x0e, 0x99, 0x01, 0x0f, 0x0e, 0x0d, 0x9a,
+  0x01, 0x0e, 0x0f, 0x0c, 0x80, 0x01, 0x02, 0x18, 0x0e, 0x11, 0x0a, 0x7f,
+  0x06, 0x15, 0x0e, 0x12, 0x09, 0x7f, 0x08, 0x13, 0x0f, 0x13, 0x07, 0x7f,
+  0x0a, 0x12, 0x0e, 0x15, 0x05, 0x80, 0x01, 0x0a, 0x11, 0x0e, 0x9a, 0x01,
+  0x0b, 0x11, 0x0d, 0x9b, 0x01, 0x0b, 0x11, 0x0c, 0x9d, 0x01, 0x0a, 0x12,
+  0x0a, 0x11, 0x01, 0x8c, 0x01, 0x0a, 0x12, 0x0a, 0x0f, 0x06, 0x8a, 0x01,
+  0x08, 0x14, 0x08, 0x0f, 0x08, 0x8a, 0x01, 0x06, 0x16, 0x05, 0x10, 0x0a,
+  0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a,
+  0xba, 0x01, 0x0a, 0x9a, 0x01, 0x06, 0x1b, 0x08, 0x9a, 0x01, 0x08, 0x1b,
+  0x06, 0x9a, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xb9, 0x01, 0x0c, 0xb9, 0x01,
+  0x0b, 0xb9, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01,
+  0x06, 0xea, 0x14, 0x89, 0x02, 0x02, 0x1f, 0x01, 0x23, 0x01, 0x04, 0x02,
+  0x03, 0x04, 0x0a, 0x02, 0x06, 0x01, 0x08, 0x05, 0x1f, 0x02, 0x1d, 0x02,
+  0x07, 0x19, 0x08, 0x16, 0x2a, 0x11, 0x04, 0x01, 0x09, 0x13, 0x03, 0x01,
+  0x1b, 0x02, 0x1e, 0x02, 0x0e, 0x01, 0x03, 0x02, 0x07, 0x05, 0x0e, 0x01,
+  0x08, 0x02, 0x02, 0x04, 0xaa, 0x02, 0x93, 0x08, 0x02, 0x3e, 0x03, 0x3d,
+  0x03, 0x3e, 0x01, 0x1c, 0x04, 0x27, 0x03, 0x07, 0x03, 0x07, 0x07, 0x16,
+  0x02, 0x0d, 0x03, 0x07, 0x03, 0x06, 0x09, 0x14, 0x04, 0x0c, 0x03, 0x07,
+  0x03, 0x06, 0x0a, 0x13, 0x03, 0x20, 0x03, 0x03, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x0f, 0x31, 0x0e, 0x31, 0x0f, 0x30, 0x10, 0x2f, 0xd2,
+  0x01, 0x21, 0x1e, 0x24, 0x06, 0x03, 0x13, 0x25, 0x05, 0x03, 0x13, 0x26,
+  0x04, 0x03, 0x35, 0x05, 0x3c, 0x04, 0x3c, 0x04, 0x25, 0x03, 0x0e, 0x02,
+  0x04, 0x04, 0x1d, 0x02, 0x06, 0x03, 0x0d, 0x0b, 0x1c, 0x03, 0x06, 0x03,
+  0x07, 0x02, 0x04, 0x0a, 0x1d, 0x03, 0x0f, 0x04, 0x04, 0x08, 0x1f, 0x02,
+  0x0f, 0x04, 0x05, 0x06, 0x32, 0x02, 0xe1, 0x08, 0xc0, 0x4b, 0x04, 0xbe,
+  0x01, 0x07, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba,
+  0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb,
+  0x01, 0x08, 0x5b, 0x01, 0x61, 0x06, 0x56, 0x0c, 0x97, 0x01, 0x06, 0x19,
+  0x11, 0x75, 0x06, 0x18, 0x08, 0x16, 0x14, 0x73, 0x08, 0x16, 0x0a, 0x14,
+  0x17, 0x70, 0x0a, 0x15, 0x0b, 0x12, 0x19, 0x42, 0x04, 0x29, 0x0a, 0x15,
+  0x0b, 0x11, 0x1b, 0x40, 0x07, 0x26, 0x0b, 0x15, 0x0b, 0x10, 0x1d, 0x3e,
+  0x09, 0x25, 0x0b, 0x15, 0x0b, 0x10, 0x1d, 0x3d, 0x0a, 0x26, 0x0a, 0x15,
+  0x0a, 0x11, 0x1e, 0x3c, 0x0b, 0x25, 0x0a, 0x16, 0x09, 0x11, 0x1f, 0x3b,
+  0x0b, 0x26, 0x08, 0x18, 0x07, 0x12, 0x1f, 0x3b, 0x0b, 0x27, 0x06, 0x1c,
+  0x01, 0x15, 0x0c, 0x04, 0x10, 0x3a, 0x0a, 0x2a, 0x02, 0x35, 0x09, 0x08,
+  0x0e, 0x3a, 0x0a, 0x62, 0x07, 0x0a, 0x0d, 0x3b, 0x08, 0x65, 0x03, 0x0d,
+  0x0c, 0x3d, 0x05, 0x76, 0x0d, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8,
+  0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0c, 0xb7,
+  0x01, 0x0d, 0xb6, 0x01, 0x0e, 0x2f, 0x95, 0x01, 0x2c, 0x97, 0x01, 0x2c,
+  0x98, 0x01, 0x2b, 0x98, 0x01, 0x2c, 0x97, 0x01, 0x2c, 0x97, 0x01, 0x2d,
+  0x97, 0x01, 0x2d, 0x95, 0x01, 0x30, 0x93, 0x01, 0x31, 0x92, 0x01, 0x33,
+  0x8f, 0x01, 0x37, 0x8a, 0x01, 0xe2, 0x0f, 0x66, 0x5c, 0x6b, 0x17, 0x05,
+  0x3c, 0x6e, 0x14, 0x07, 0x3b, 0x70, 0x11, 0x09, 0x39, 0x72, 0x0f, 0x0b,
+  0x38, 0x73, 0x0e, 0x0b, 0x38, 0x74, 0x0d, 0x0b, 0x39, 0x74, 0x0c, 0x0b,
+  0x39, 0x75, 0x0b, 0x0b, 0x3a, 0x74, 0x0c, 0x09, 0x3c, 0x74, 0x0c, 0x07,
+  0x3f, 0x72, 0x0e, 0x03, 0xa5, 0x01, 0x0f, 0xb7, 0x01, 0x0d, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0c, 0xb9, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0c, 0x73, 0x05, 0x40, 0x0c, 0x72, 0x07, 0x3e, 0x0c,
+  0x72, 0x09, 0x2b, 0x06, 0x0c, 0x0c, 0x71, 0x0b, 0x29, 0x09, 0x09, 0x0d,
+  0x5a, 0x04, 0x13, 0x0b, 0x28, 0x0b, 0x06, 0x0f, 0x58, 0x08, 0x11, 0x0b,
+  0x28, 0x1f, 0x58, 0x09, 0x11, 0x0b, 0x28, 0x1f, 0x58, 0x0a, 0x11, 0x0a,
+  0x28, 0x1e, 0x59, 0x0a, 0x11, 0x09, 0x16, 0x06, 0x0d, 0x1e, 0x59, 0x0b,
+  0x11, 0x07, 0x16, 0x08, 0x0c, 0x1d, 0x5a, 0x0a, 0x14, 0x03, 0x17, 0x0a,
+  0x0c, 0x1b, 0x5b, 0x0a, 0x2e, 0x0a, 0x0c, 0x1a, 0x5c, 0x0a, 0x2e, 0x0a,
+  0x0e, 0x17, 0x5e, 0x08, 0x2f, 0x0b, 0x0e, 0x15, 0x61, 0x04, 0x31, 0x0a,
+  0x10, 0x12, 0x98, 0x01, 0x0a, 0x13, 0x0d, 0x9b, 0x01, 0x08, 0x17, 0x06,
+  0xa0, 0x01, 0x06, 0xf9, 0x51, 0x8d, 0x02, 0x05, 0x19, 0x08, 0x17, 0x03,
+  0x05, 0x02, 0x16, 0x02, 0x07, 0x02, 0x14, 0x02, 0x08, 0x02, 0x13, 0x03,
+  0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02,
+  0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x06, 0x01, 0x06, 0x01,
+  0x04, 0x02, 0x0a, 0x02, 0x05, 0x02, 0x06, 0x01, 0x04, 0x02, 0x0b, 0x02,
+  0x04, 0x02, 0x05, 0x02, 0x03, 0x02, 0x0c, 0x04, 0x0c, 0x04, 0x0d, 0x03,
+  0x05, 0x02, 0x05, 0x03, 0x12, 0x01, 0x03, 0x02, 0x1a, 0x02, 0x05, 0x02,
+  0x17, 0x01, 0x06, 0x02, 0x3a, 0x01, 0x1e, 0x02, 0x71, 0x9a, 0x08, 0x09,
+  0x35, 0x0d, 0x32, 0x0f, 0x30, 0x07, 0x02, 0x09, 0x2d, 0x05, 0x09, 0x05,
+  0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04,
+  0x28, 0x04, 0x11, 0x04, 0x27, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09,
+  0x1e, 0x08, 0x12, 0x0a, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06,
+  0x17, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x15, 0x05, 0x23, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03,
+  0x14, 0x04, 0x0c, 0x01, 0x18, 0x03, 0x14, 0x04, 0x0b, 0x03, 0x0b, 0x04,
+  0x07, 0x04, 0x14, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x07, 0x04, 0x14, 0x04,
+  0x0a, 0x04, 0x0b, 0x04, 0x07, 0x04, 0x15, 0x04, 0x09, 0x04, 0x0b, 0x03,
+  0x07, 0x04, 0x16, 0x05, 0x09, 0x02, 0x0c, 0x03, 0x06, 0x05, 0x17, 0x06,
+  0x1c, 0x06, 0x19, 0x07, 0x0b, 0x02, 0x0b, 0x07, 0x1b, 0x06, 0x0a, 0x04,
+  0x0a, 0x06, 0x1e, 0x04, 0x0a, 0x04, 0x0a, 0x04, 0x23, 0x01, 0x0a, 0x04,
+  0x0a, 0x01, 0x29, 0x03, 0x05, 0x03, 0x04, 0x03, 0x2e, 0x04, 0x05, 0x02,
+  0x03, 0x04, 0x2e, 0x03, 0x0b, 0x04, 0x2d, 0x04, 0x0b, 0x03, 0x2f, 0x03,
+  0x0b, 0x03, 0x75, 0x02, 0x3e, 0x03, 0x3c, 0x04, 0x3c, 0x04, 0x3c, 0x04,
+  0x3c, 0x03, 0xe2, 0x02, 0x9a, 0x4a, 0x07, 0xb7, 0x01, 0x13, 0xad, 0x01,
+  0x1a, 0xa8, 0x01, 0x1f, 0xa3, 0x01, 0x23, 0x9f, 0x01, 0x27, 0x9b, 0x01,
+  0x2b, 0x98, 0x01, 0x2d, 0x96, 0x01, 0x2f, 0x93, 0x01, 0x33, 0x90, 0x01,
+  0x35, 0x8e, 0x01, 0x1a, 0x02, 0x1b, 0x8c, 0x01, 0x15, 0x0f, 0x15, 0x8a,
+  0x01, 0x13, 0x15, 0x13, 0x88, 0x01, 0x12, 0x19, 0x12, 0x87, 0x01, 0x10,
+  0x1d, 0x11, 0x85, 0x01, 0x0f, 0x21, 0x0f, 0x84, 0x01, 0x0f, 0x23, 0x0f,
+  0x82, 0x01, 0x0f, 0x25, 0x0f, 0x81, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01,
+  0x0e, 0x29, 0x0e, 0x7f, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2d, 0x0d, 0x7d,
+  0x0c, 0x2f, 0x0c, 0x7c, 0x0d, 0x2f, 0x0d, 0x7b, 0x0c, 0x31, 0x0c, 0x7b,
+  0x0c, 0x31, 0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x33, 0x0c, 0x79,
+  0x0b, 0x35, 0x0b, 0x79, 0x0b, 0x35, 0x11, 0x71, 0x0d, 0x35, 0x17, 0x68,
+  0x0f, 0x37, 0x19, 0x63, 0x11, 0x37, 0x1b, 0x5f, 0x13, 0x37, 0x1d, 0x5b,
+  0x15, 0x37, 0x1e, 0x58, 0x17, 0x37, 0x20, 0x55, 0x18, 0x37, 0x21, 0x53,
+  0x19, 0x38, 0x21, 0x51, 0x19, 0x39, 0x22, 0x4f, 0x1a, 0x39, 0x23, 0x4d,
+  0x17, 0x4d, 0x14, 0x4b, 0x13, 0x55, 0x12, 0x49, 0x11, 0x5b, 0x10, 0x48,
+  0x0f, 0x5e, 0x0f, 0x47, 0x0f, 0x61, 0x0e, 0x45, 0x0f, 0x63, 0x0e, 0x44,
+  0x0e, 0x65, 0x0d, 0x43, 0x0e, 0x67, 0x0d, 0x42, 0x0d, 0x69, 0x0c, 0x41,
+  0x0d, 0x6a, 0x0d, 0x40, 0x0d, 0x6b, 0x0c, 0x40, 0x0c, 0x6d, 0x0b, 0x3f,
+  0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e,
+  0x0b, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0c, 0x3c, 0x0c, 0x71, 0x0b, 0x3c,
+  0x0c, 0x71, 0x0b, 0x3c, 0x0c, 0x71, 0x0b, 0x3c, 0x0c, 0x71, 0x0b, 0x3c,
+  0x0b, 0x72, 0x0b, 0x3c, 0x0c, 0x26, 0x03, 0x48, 0x0b, 0x3c, 0x0c, 0x24,
+  0x07, 0x26, 0x06, 0x1a, 0x0b, 0x3c, 0x0c, 0x23, 0x09, 0x23, 0x09, 0x19,
+  0x0b, 0x3c, 0x0c, 0x23, 0x0a, 0x22, 0x0a, 0x18, 0x0b, 0x3c, 0x0c, 0x22,
+  0x0b, 0x22, 0x0a, 0x17, 0x0c, 0x3d, 0x0b, 0x22, 0x0b, 0x21, 0x0b, 0x17,
+  0x0b, 0x3e, 0x0c, 0x21, 0x0b, 0x21, 0x0b, 0x17, 0x0b, 0x3e, 0x0c, 0x20,
+  0x0c, 0x21, 0x0b, 0x16, 0x0c, 0x3e, 0x0c, 0x20, 0x0b, 0x21, 0x0c, 0x16,
+  0x0c, 0x3f, 0x0c, 0x1f, 0x0b, 0x21, 0x0c, 0x15, 0x0c, 0x40, 0x0c, 0x1e,
+  0x0c, 0x21, 0x0b, 0x16, 0x0c, 0x40, 0x0d, 0x1d, 0x0c, 0x21, 0x0b, 0x15,
+  0x0d, 0x41, 0x0d, 0x1c, 0x0b, 0x21, 0x0c, 0x14, 0x0d, 0x42, 0x0e, 0x1b,
+  0x0b, 0x21, 0x0c, 0x14, 0x0d, 0x43, 0x0e, 0x1b, 0x0a, 0x22, 0x0a, 0x14,
+  0x0d, 0x44, 0x0f, 0x1a, 0x09, 0x23, 0x0a, 0x13, 0x0e, 0x45, 0x0f, 0x1a,
+  0x08, 0x24, 0x08, 0x12, 0x0f, 0x47, 0x0f, 0x1b, 0x05, 0x26, 0x07, 0x11,
+  0x10, 0x47, 0x11, 0x5a, 0x11, 0x49, 0x12, 0x56, 0x12, 0x4b, 0x14, 0x50,
+  0x14, 0x4d, 0x17, 0x21, 0x06, 0x21, 0x18, 0x4e, 0x17, 0x1f, 0x08, 0x20,
+  0x17, 0x50, 0x16, 0x1e, 0x0a, 0x1f, 0x16, 0x52, 0x15, 0x1e, 0x0b, 0x1e,
+  0x14, 0x55, 0x14, 0x1e, 0x0b, 0x1e, 0x13, 0x58, 0x12, 0x1d, 0x0c, 0x1e,
+  0x12, 0x5a, 0x11, 0x1d, 0x0c, 0x1e, 0x10, 0x5e, 0x0f, 0x1d, 0x0b, 0x1f,
+  0x0f, 0x61, 0x0d, 0x1d, 0x0b, 0x1f, 0x0c, 0x67, 0x0a, 0x1c, 0x0c, 0x1f,
+  0x09, 0x6e, 0x05, 0x1d, 0x0c, 0x1f, 0x05, 0x7f, 0x06, 0x0f, 0x0b, 0x0c,
+  0x05, 0x92, 0x01, 0x08, 0x0e, 0x0b, 0x0b, 0x08, 0x8f, 0x01, 0x0a, 0x0d,
+  0x0b, 0x0a, 0x09, 0x8f, 0x01, 0x0a, 0x0e, 0x09, 0x0b, 0x0a, 0x8d, 0x01,
+  0x0b, 0x0e, 0x09, 0x0a, 0x0b, 0x8d, 0x01, 0x0b, 0x0f, 0x07, 0x0b, 0x0b,
+  0x8d, 0x01, 0x0b, 0x12, 0x02, 0x0d, 0x0b, 0x8c, 0x01, 0x0c, 0x20, 0x0c,
+  0x8c, 0x01, 0x0c, 0x20, 0x0c, 0x8c, 0x01, 0x0b, 0x21, 0x0b, 0x8d, 0x01,
+  0x0b, 0x21, 0x0b, 0x8d, 0x01, 0x0b, 0x20, 0x0c, 0x8d, 0x01, 0x0b, 0x20,
+  0x0c, 0x8d, 0x01, 0x0a, 0x22, 0x0a, 0x8e, 0x01, 0x0a, 0x22, 0x0a, 0x8f,
+  0x01, 0x08, 0x23, 0x09, 0x91, 0x01, 0x06, 0x25, 0x08, 0xbf, 0x01, 0x02,
+  0xaf, 0x04, 0x05, 0xbe, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x0a,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a,
+  0xbb, 0x01, 0x08, 0xbe, 0x01, 0x04, 0xe6, 0x17, 0x8c, 0x02, 0x05, 0x1a,
+  0x08, 0x17, 0x02, 0x05, 0x03, 0x15, 0x02, 0x07, 0x02, 0x15, 0x02, 0x08,
+  0x02, 0x12, 0x03, 0x09, 0x05, 0x0e, 0x04, 0x0a, 0x05, 0x0c, 0x02, 0x10,
+  0x03, 0x0b, 0x02, 0x11, 0x02, 0x0a, 0x02, 0x13, 0x02, 0x09, 0x02, 0x13,
+  0x02, 0x0a, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x02, 0x0c, 0x03, 0x0d,
+  0x03, 0x0e, 0x03, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x16,
+  0x02, 0x1b, 0x01, 0x06, 0x01, 0x17, 0x02, 0x02, 0x01, 0x02, 0x02, 0x1b,
+  0x01, 0x3e, 0x02, 0x1e, 0x01, 0x52, 0x99, 0x08, 0x08, 0x36, 0x0d, 0x32,
+  0x0f, 0x2f, 0x09, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05, 0x2c, 0x05, 0x0b,
+  0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04, 0x28, 0x04, 0x11,
+  0x03, 0x28, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09, 0x1e, 0x07, 0x12,
+  0x0b, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1b, 0x07, 0x17, 0x05, 0x1f,
+  0x05, 0x17, 0x04, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x04, 0x24,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x03, 0x25,
+  0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24,
+  0x04, 0x15, 0x04, 0x22, 0x04, 0x16, 0x05, 0x20, 0x05, 0x17, 0x05, 0x1e,
+  0x05, 0x19, 0x07, 0x04, 0x01, 0x06, 0x02, 0x0b, 0x07, 0x1b, 0x06, 0x03,
+  0x03, 0x04, 0x04, 0x03, 0x03, 0x03, 0x07, 0x1d, 0x05, 0x03, 0x03, 0x04,
+  0x04, 0x03, 0x03, 0x03, 0x06, 0x21, 0x02, 0x04, 0x02, 0x04, 0x03, 0x05,
+  0x02, 0x04, 0x02, 0x30, 0x03, 0x36, 0x01, 0x07, 0x01, 0x05, 0x01, 0x30,
+  0x03, 0x0b, 0x03, 0x2f, 0x03, 0x04, 0x02, 0x05, 0x03, 0x2e, 0x04, 0x03,
+  0x04, 0x03, 0x04, 0x2f, 0x03, 0x03, 0x04, 0x04, 0x03, 0xb4, 0x01, 0x03,
+  0x3d, 0x03, 0x3d, 0x03, 0x3d, 0x03, 0x3e, 0x01, 0xa4, 0x02, 0xd5, 0x4b,
+  0x12, 0xaf, 0x01, 0x19, 0xa8, 0x01, 0x1e, 0xa4, 0x01, 0x22, 0xa0, 0x01,
+  0x26, 0x9c, 0x01, 0x2a, 0x99, 0x01, 0x2c, 0x96, 0x01, 0x30, 0x93, 0x01,
+  0x32, 0x91, 0x01, 0x34, 0x8f, 0x01, 0x36, 0x8d, 0x01, 0x15, 0x0e, 0x15,
+  0x8b, 0x01, 0x13, 0x14, 0x13, 0x89, 0x01, 0x11, 0x19, 0x12, 0x87, 0x01,
+  0x11, 0x1c, 0x11, 0x85, 0x01, 0x10, 0x20, 0x10, 0x84, 0x01, 0x0f, 0x22,
+  0x0f, 0x83, 0x01, 0x0f, 0x24, 0x0f, 0x81, 0x01, 0x0f, 0x26, 0x0f, 0x80,
+  0x01, 0x0e, 0x28, 0x0e, 0x7f, 0x0e, 0x2a, 0x0e, 0x7e, 0x0d, 0x2c, 0x0d,
+  0x7d, 0x0d, 0x2e, 0x0d, 0x7c, 0x0c, 0x30, 0x0c, 0x7b, 0x0d, 0x30, 0x0d,
+  0x7a, 0x0c, 0x32, 0x0c, 0x7a, 0x0c, 0x32, 0x0c, 0x79, 0x0c, 0x34, 0x0b,
+  0x79, 0x0c, 0x34, 0x0c, 0x78, 0x0c, 0x35, 0x0b, 0x77, 0x0c, 0x36, 0x15,
+  0x69, 0x10, 0x36, 0x19, 0x63, 0x12, 0x36, 0x1b, 0x5f, 0x14, 0x37, 0x1c,
+  0x5b, 0x15, 0x38, 0x1e, 0x58, 0x16, 0x38, 0x1f, 0x56, 0x17, 0x38, 0x20,
+  0x54, 0x18, 0x38, 0x22, 0x51, 0x19, 0x38, 0x23, 0x4f, 0x1a, 0x38, 0x24,
+  0x4d, 0x16, 0x3e, 0x24, 0x4b, 0x13, 0x53, 0x14, 0x49, 0x11, 0x59, 0x11,
+  0x48, 0x10, 0x5d, 0x10, 0x47, 0x0f, 0x5f, 0x10, 0x45, 0x0e, 0x63, 0x0e,
+  0x44, 0x0e, 0x65, 0x0e, 0x43, 0x0d, 0x67, 0x0d, 0x42, 0x0e, 0x68, 0x0d,
+  0x41, 0x0d, 0x69, 0x0d, 0x41, 0x0c, 0x6b, 0x0d, 0x3f, 0x0c, 0x6d, 0x0c,
+  0x3f, 0x0c, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0b, 0x6f, 0x0c,
+  0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b,
+  0x3d, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c,
+  0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c,
+  0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0c, 0x70, 0x0b,
+  0x3d, 0x0c, 0x70, 0x0b, 0x3d, 0x0c, 0x6f, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c,
+  0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6d, 0x0c, 0x40, 0x0c, 0x6c, 0x0c,
+  0x40, 0x0d, 0x6a, 0x0d, 0x40, 0x0d, 0x69, 0x0d, 0x42, 0x0d, 0x68, 0x0d,
+  0x42, 0x0e, 0x66, 0x0d, 0x44, 0x0e, 0x64, 0x0e, 0x44, 0x0f, 0x62, 0x0e,
+  0x46, 0x0f, 0x5f, 0x0f, 0x48, 0x10, 0x5c, 0x10, 0x48, 0x12, 0x58, 0x11,
+  0x4a, 0x14, 0x52, 0x13, 0x4c, 0x18, 0x21, 0x05, 0x22, 0x17, 0x4e, 0x17,
+  0x0b, 0x05, 0x10, 0x08, 0x0e, 0x05, 0x0c, 0x18, 0x4f, 0x16, 0x0a, 0x08,
+  0x0d, 0x09, 0x0d, 0x07, 0x0b, 0x17, 0x51, 0x15, 0x09, 0x09, 0x0c, 0x0b,
+  0x0b, 0x09, 0x0a, 0x15, 0x54, 0x14, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a,
+  0x09, 0x14, 0x57, 0x12, 0x09, 0x0a, 0x0b, 0x0b, 0x0a, 0x0b, 0x09, 0x13,
+  0x59, 0x11, 0x09, 0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x09, 0x11, 0x5d, 0x0f,
+  0x09, 0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x09, 0x10, 0x60, 0x0d, 0x09, 0x0a,
+  0x0a, 0x0b, 0x0c, 0x0a, 0x09, 0x0e, 0x65, 0x0a, 0x0a, 0x08, 0x0b, 0x0b,
+  0x0c, 0x09, 0x0a, 0x0b, 0x6c, 0x06, 0x0b, 0x06, 0x0c, 0x0b, 0x0d, 0x07,
+  0x0b, 0x08, 0x82, 0x01, 0x02, 0x0d, 0x0c, 0x0f, 0x03, 0xa7, 0x01, 0x0a,
+  0xba, 0x01, 0x0a, 0xba, 0x01, 0x09, 0xbc, 0x01, 0x08, 0xa5, 0x01, 0x06,
+  0x13, 0x04, 0x0e, 0x05, 0x93, 0x01, 0x08, 0x23, 0x07, 0x91, 0x01, 0x0a,
+  0x21, 0x09, 0x90, 0x01, 0x0a, 0x20, 0x0b, 0x8e, 0x01, 0x0c, 0x1f, 0x0b,
+  0x8e, 0x01, 0x0c, 0x0c, 0x04, 0x0f, 0x0b, 0x8e, 0x01, 0x0b, 0x0b, 0x07,
+  0x0e, 0x0b, 0x8e, 0x01, 0x0b, 0x0a, 0x09, 0x0d, 0x0b, 0x8e, 0x01, 0x0b,
+  0x0a, 0x0a, 0x0c, 0x0b, 0x8e, 0x01, 0x0b, 0x09, 0x0b, 0x0b, 0x0c, 0x8e,
+  0x01, 0x0b, 0x09, 0x0b, 0x0c, 0x0a, 0x8f, 0x01, 0x0a, 0x0a, 0x0b, 0x0c,
+  0x0a, 0x90, 0x01, 0x09, 0x0b, 0x0a, 0x0c, 0x0a, 0x90, 0x01, 0x08, 0x0c,
+  0x09, 0x0e, 0x08, 0x93, 0x01, 0x05, 0x0e, 0x07, 0x10, 0x06, 0xa9, 0x01,
+  0x04, 0xcc, 0x07, 0x04, 0xbe, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01,
+  0x0a, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01,
+  0x0b, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0b, 0xba, 0x01,
+  0x0a, 0xba, 0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xe1, 0x14,
+  0xad, 0x01, 0x04, 0x1b, 0x03, 0x01, 0x03, 0x18, 0x02, 0x05, 0x02, 0x16,
+  0x02, 0x07, 0x01, 0x15, 0x03, 0x07, 0x04, 0x11, 0x02, 0x09, 0x05, 0x0f,
+  0x02, 0x0e, 0x02, 0x0e, 0x01, 0x0f, 0x02, 0x0e, 0x01, 0x10, 0x01, 0x0e,
+  0x02, 0x0e, 0x02, 0x0e, 0x03, 0x0d, 0x01, 0x10, 0x05, 0x09, 0x02, 0x12,
+  0x04, 0x08, 0x01, 0x16, 0x0a, 0x16, 0x08, 0x18, 0x08, 0x19, 0x05, 0x1c,
+  0x04, 0x1c, 0x04, 0x1d, 0x02, 0xee, 0x01, 0x9b, 0x05, 0x07, 0x37, 0x0b,
+  0x34, 0x0d, 0x32, 0x04, 0x07, 0x04, 0x30, 0x04, 0x09, 0x04, 0x2e, 0x04,
+  0x0b, 0x04, 0x2d, 0x03, 0x0d, 0x03, 0x2c, 0x04, 0x0d, 0x03, 0x2b, 0x04,
+  0x0f, 0x06, 0x25, 0x06, 0x0f, 0x08, 0x22, 0x04, 0x12, 0x09, 0x20, 0x04,
+  0x13, 0x01, 0x05, 0x04, 0x1f, 0x03, 0x1b, 0x04, 0x1d, 0x03, 0x1d, 0x03,
+  0x1d, 0x03, 0x1e, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x1c, 0x03, 0x1e, 0x03,
+  0x1c, 0x03, 0x1e, 0x03, 0x1c, 0x03, 0x1e, 0x03, 0x1c, 0x04, 0x1d, 0x02,
+  0x1d, 0x04, 0x1c, 0x03, 0x1e, 0x05, 0x19, 0x03, 0x20, 0x0a, 0x12, 0x03,
+  0x22, 0x09, 0x12, 0x03, 0x24, 0x08, 0x11, 0x03, 0x29, 0x04, 0x08, 0x01,
+  0x06, 0x03, 0x2b, 0x04, 0x06, 0x04, 0x02, 0x05, 0x2c, 0x13, 0x2e, 0x10,
+  0x2f, 0x10, 0x30, 0x10, 0x30, 0x0f, 0x32, 0x0d, 0x34, 0x0a, 0x37, 0x09,
+  0x39, 0x07, 0x39, 0x07, 0x39, 0x07, 0x3a, 0x05, 0x3c, 0x03, 0x9c, 0x07,
+  0x92, 0x30, 0x0e, 0xb3, 0x01, 0x15, 0xac, 0x01, 0x1a, 0xa8, 0x01, 0x1e,
+  0xa4, 0x01, 0x22, 0xa1, 0x01, 0x25, 0x9e, 0x01, 0x27, 0x9b, 0x01, 0x2a,
+  0x99, 0x01, 0x14, 0x05, 0x13, 0x97, 0x01, 0x10, 0x0f, 0x0f, 0x95, 0x01,
+  0x0f, 0x13, 0x0e, 0x93, 0x01, 0x0e, 0x17, 0x0d, 0x92, 0x01, 0x0c, 0x1b,
+  0x0c, 0x90, 0x01, 0x0c, 0x1d, 0x0c, 0x8e, 0x01, 0x0c, 0x1f, 0x0b, 0x8e,
+  0x01, 0x0b, 0x21, 0x0b, 0x8c, 0x01, 0x0b, 0x23, 0x0a, 0x8b, 0x01, 0x0b,
+  0x25, 0x0a, 0x8a, 0x01, 0x0a, 0x27, 0x09, 0x8a, 0x01, 0x0a, 0x27, 0x0a,
+  0x88, 0x01, 0x0a, 0x29, 0x09, 0x88, 0x01, 0x09, 0x2a, 0x0a, 0x87, 0x01,
+  0x09, 0x2b, 0x09, 0x86, 0x01, 0x0a, 0x2b, 0x09, 0x86, 0x01, 0x09, 0x2c,
+  0x10, 0x7d, 0x0b, 0x2d, 0x13, 0x76, 0x0e, 0x2d, 0x15, 0x72, 0x10, 0x2d,
+  0x17, 0x6e, 0x12, 0x2d, 0x19, 0x6b, 0x13, 0x2d, 0x1a, 0x69, 0x0f, 0x32,
+  0x1b, 0x67, 0x0c, 0x36, 0x1d, 0x64, 0x0b, 0x38, 0x1e, 0x62, 0x0b, 0x39,
+  0x07, 0x06, 0x11, 0x61, 0x0a, 0x3b, 0x03, 0x0e, 0x0e, 0x5f, 0x0a, 0x3c,
+  0x01, 0x12, 0x0d, 0x5e, 0x09, 0x51, 0x0d, 0x5c, 0x09, 0x54, 0x0b, 0x5b,
+  0x0a, 0x55, 0x0b, 0x5a, 0x09, 0x57, 0x0a, 0x59, 0x0a, 0x58, 0x0a, 0x58,
+  0x09, 0x5a, 0x09, 0x58, 0x09, 0x5a, 0x09, 0x57, 0x09, 0x5c, 0x09, 0x56,
+  0x09, 0x5c, 0x09, 0x56, 0x09, 0x5d, 0x08, 0x56, 0x09, 0x5d, 0x08, 0x56,
+  0x09, 0x5d, 0x09, 0x55, 0x09, 0x5d, 0x09, 0x54, 0x0a, 0x5e, 0x08, 0x54,
+  0x0a, 0x5e, 0x08, 0x54, 0x0a, 0x5e, 0x08, 0x55, 0x09, 0x5e, 0x08, 0x55,
+  0x09, 0x5e, 0x08, 0x55, 0x09, 0x5e, 0x07, 0x56, 0x0a, 0x5c, 0x08, 0x56,
+  0x0a, 0x5c, 0x08, 0x56, 0x0b, 0x5b, 0x08, 0x57, 0x0a, 0x5b, 0x07, 0x58,
+  0x0b, 0x59, 0x08, 0x58, 0x0c, 0x58, 0x08, 0x59, 0x0b, 0x57, 0x08, 0x5a,
+  0x0c, 0x55, 0x09, 0x5b, 0x0c, 0x54, 0x08, 0x5c, 0x0e, 0x51, 0x09, 0x5d,
+  0x0e, 0x4f, 0x09, 0x5f, 0x10, 0x0d, 0x02, 0x3c, 0x09, 0x61, 0x12, 0x06,
+  0x07, 0x3a, 0x09, 0x63, 0x1e, 0x39, 0x0a, 0x64, 0x1d, 0x39, 0x09, 0x66,
+  0x1d, 0x38, 0x08, 0x68, 0x1c, 0x38, 0x07, 0x6a, 0x1c, 0x36, 0x08, 0x6c,
+  0x1a, 0x36, 0x08, 0x6e, 0x19, 0x34, 0x09, 0x70, 0x18, 0x33, 0x09, 0x74,
+  0x15, 0x31, 0x09, 0x81, 0x01, 0x0a, 0x1b, 0x02, 0x12, 0x0a, 0x82, 0x01,
+  0x0a, 0x18, 0x05, 0x10, 0x0b, 0x82, 0x01, 0x0c, 0x15, 0x07, 0x0d, 0x0c,
+  0x84, 0x01, 0x0c, 0x12, 0x0c, 0x08, 0x0d, 0x86, 0x01, 0x0e, 0x0d, 0x23,
+  0x87, 0x01, 0x3c, 0x89, 0x01, 0x3a, 0x8b, 0x01, 0x37, 0x8e, 0x01, 0x35,
+  0x8f, 0x01, 0x32, 0x91, 0x01, 0x32, 0x92, 0x01, 0x31, 0x93, 0x01, 0x31,
+  0x92, 0x01, 0x32, 0x92, 0x01, 0x31, 0x93, 0x01, 0x31, 0x93, 0x01, 0x30,
+  0x95, 0x01, 0x2e, 0x96, 0x01, 0x2d, 0x97, 0x01, 0x2c, 0x98, 0x01, 0x2b,
+  0x9a, 0x01, 0x29, 0x9b, 0x01, 0x28, 0x9d, 0x01, 0x25, 0xa0, 0x01, 0x22,
+  0xa3, 0x01, 0x1e, 0xa7, 0x01, 0x1d, 0xa9, 0x01, 0x1c, 0xaa, 0x01, 0x1a,
+  0xaf, 0x01, 0x15, 0xae, 0x01, 0x17, 0xad, 0x01, 0x17, 0xad, 0x01, 0x17,
+  0xad, 0x01, 0x17, 0xad, 0x01, 0x17, 0xae, 0x01, 0x16, 0xae, 0x01, 0x15,
+  0xaf, 0x01, 0x15, 0xb0, 0x01, 0x13, 0xb1, 0x01, 0x13, 0xb2, 0x01, 0x11,
+  0xb4, 0x01, 0x0f, 0xb6, 0x01, 0x0d, 0xb9, 0x01, 0x09, 0x86, 0x44, 0x8d,
+  0x02, 0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x16, 0x02, 0x07, 0x02,
+  0x14, 0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06,
+  0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02,
+  0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0b, 0x02, 0x07, 0x02,
+  0x07, 0x02, 0x0c, 0x04, 0x0c, 0x04, 0x0d, 0x03, 0x02, 0x01, 0x06, 0x01,
+  0x02, 0x03, 0x36, 0x02, 0x3b, 0x01, 0x06, 0x01, 0x3b, 0x02, 0x6f, 0x9a,
+  0x08, 0x08, 0x36, 0x0d, 0x32, 0x0f, 0x30, 0x07, 0x02, 0x08, 0x2e, 0x05,
+  0x09, 0x05, 0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04,
+  0x0f, 0x04, 0x28, 0x04, 0x11, 0x03, 0x28, 0x04, 0x11, 0x04, 0x25, 0x06,
+  0x11, 0x09, 0x1e, 0x07, 0x12, 0x0a, 0x1c, 0x08, 0x13, 0x0b, 0x19, 0x06,
+  0x1c, 0x06, 0x18, 0x04, 0x20, 0x04, 0x17, 0x04, 0x22, 0x04, 0x16, 0x03,
+  0x23, 0x04, 0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03,
+  0x25, 0x04, 0x14, 0x03, 0x25, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04,
+  0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x15, 0x04, 0x0f, 0x04, 0x0f, 0x04,
+  0x16, 0x05, 0x0e, 0x04, 0x0e, 0x05, 0x17, 0x06, 0x0d, 0x02, 0x0d, 0x06,
+  0x19, 0x07, 0x04, 0x02, 0x0c, 0x02, 0x04, 0x07, 0x1b, 0x06, 0x04, 0x03,
+  0x0a, 0x04, 0x02, 0x07, 0x1d, 0x05, 0x04, 0x03, 0x0a, 0x04, 0x02, 0x05,
+  0x23, 0x01, 0x05, 0x01, 0x0c, 0x01, 0x05, 0x01, 0x32, 0x02, 0x3d, 0x04,
+  0x3c, 0x04, 0x3d, 0x02, 0x37, 0x03, 0x0b, 0x02, 0x30, 0x03, 0x0a, 0x04,
+  0x2f, 0x03, 0x0a, 0x03, 0x77, 0x02, 0x3d, 0x04, 0x3c, 0x04, 0x9e, 0x03,
+  0xd9, 0x4b, 0x11, 0xaf, 0x01, 0x18, 0xa9, 0x01, 0x1e, 0xa4, 0x01, 0x22,
+  0xa0, 0x01, 0x26, 0x9d, 0x01, 0x29, 0x99, 0x01, 0x2c, 0x97, 0x01, 0x2f,
+  0x93, 0x01, 0x32, 0x91, 0x01, 0x34, 0x8f, 0x01, 0x1a, 0x02, 0x1a, 0x8d,
+  0x01, 0x14, 0x10, 0x14, 0x8b, 0x01, 0x13, 0x15, 0x12, 0x89, 0x01, 0x11,
+  0x1a, 0x11, 0x88, 0x01, 0x10, 0x1d, 0x10, 0x86, 0x01, 0x0f, 0x20, 0x10,
+  0x84, 0x01, 0x0f, 0x22, 0x0f, 0x83, 0x01, 0x0f, 0x25, 0x0e, 0x82, 0x01,
+  0x0e, 0x27, 0x0e, 0x80, 0x01, 0x0e, 0x29, 0x0d, 0x80, 0x01, 0x0d, 0x2b,
+  0x0d, 0x7e, 0x0d, 0x2c, 0x0d, 0x7e, 0x0c, 0x2e, 0x0d, 0x7c, 0x0d, 0x2f,
+  0x0c, 0x7c, 0x0c, 0x30, 0x0d, 0x7b, 0x0b, 0x32, 0x0c, 0x7a, 0x0c, 0x32,
+  0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0b, 0x34, 0x0c, 0x78, 0x0c, 0x35,
+  0x0e, 0x74, 0x0c, 0x36, 0x15, 0x6a, 0x0f, 0x36, 0x18, 0x65, 0x11, 0x36,
+  0x1b, 0x60, 0x13, 0x37, 0x1c, 0x5c, 0x15, 0x37, 0x1e, 0x59, 0x16, 0x37,
+  0x1f, 0x56, 0x17, 0x38, 0x20, 0x54, 0x18, 0x38, 0x22, 0x51, 0x19, 0x38,
+  0x23, 0x4f, 0x1a, 0x38, 0x24, 0x4d, 0x17, 0x4b, 0x16, 0x4b, 0x13, 0x54,
+  0x12, 0x4b, 0x10, 0x5a, 0x10, 0x49, 0x0f, 0x5d, 0x10, 0x47, 0x0f, 0x60,
+  0x0f, 0x46, 0x0e, 0x62, 0x0e, 0x45, 0x0e, 0x64, 0x0e, 0x44, 0x0d, 0x66,
+  0x0d, 0x43, 0x0d, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x41, 0x0c, 0x6b,
+  0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0b, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e,
+  0x0c, 0x3e, 0x0b, 0x6f, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70,
+  0x0b, 0x3e, 0x0a, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71,
+  0x0b, 0x3d, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72,
+  0x0b, 0x3c, 0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0b, 0x3e, 0x0a, 0x71,
+  0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x6f,
+  0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0b, 0x40, 0x0b, 0x6d,
+  0x0c, 0x40, 0x0c, 0x34, 0x05, 0x33, 0x0c, 0x40, 0x0d, 0x31, 0x08, 0x31,
+  0x0c, 0x42, 0x0c, 0x30, 0x0a, 0x2f, 0x0d, 0x42, 0x0d, 0x2f, 0x0a, 0x2e,
+  0x0e, 0x43, 0x0d, 0x2e, 0x0b, 0x2c, 0x0e, 0x44, 0x0e, 0x2d, 0x0b, 0x2b,
+  0x0f, 0x45, 0x0e, 0x2c, 0x0b, 0x2a, 0x0f, 0x46, 0x10, 0x2a, 0x0a, 0x2a,
+  0x0f, 0x48, 0x10, 0x2a, 0x09, 0x28, 0x11, 0x49, 0x12, 0x28, 0x07, 0x27,
+  0x12, 0x4b, 0x14, 0x26, 0x04, 0x26, 0x14, 0x4c, 0x18, 0x0d, 0x05, 0x25,
+  0x05, 0x0b, 0x18, 0x4e, 0x17, 0x0c, 0x07, 0x22, 0x08, 0x0a, 0x17, 0x50,
+  0x16, 0x0b, 0x09, 0x21, 0x09, 0x09, 0x16, 0x53, 0x14, 0x0a, 0x0a, 0x20,
+  0x0a, 0x09, 0x15, 0x55, 0x13, 0x0a, 0x0b, 0x1f, 0x0b, 0x08, 0x14, 0x57,
+  0x12, 0x0a, 0x0b, 0x1f, 0x0b, 0x08, 0x12, 0x5b, 0x10, 0x0a, 0x0b, 0x1f,
+  0x0b, 0x08, 0x11, 0x5e, 0x0e, 0x0a, 0x0a, 0x20, 0x0a, 0x09, 0x0f, 0x62,
+  0x0c, 0x0b, 0x09, 0x21, 0x09, 0x09, 0x0d, 0x66, 0x0a, 0x0c, 0x07, 0x23,
+  0x07, 0x0a, 0x0a, 0x6e, 0x05, 0x0d, 0x04, 0x26, 0x04, 0x0d, 0x04, 0xdf,
+  0x02, 0x02, 0xc0, 0x01, 0x06, 0xbd, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xed, 0x02, 0x06, 0x24,
+  0x06, 0x93, 0x01, 0x08, 0x22, 0x08, 0x91, 0x01, 0x0a, 0x20, 0x0a, 0x90,
+  0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01, 0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b,
+  0x1f, 0x0b, 0x8f, 0x01, 0x0a, 0x20, 0x0a, 0x90, 0x01, 0x0a, 0x20, 0x0a,
+  0x91, 0x01, 0x08, 0x22, 0x08, 0x93, 0x01, 0x06, 0x24, 0x06, 0xb3, 0x04,
+  0x03, 0xbf, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xba, 0x01, 0x0a, 0xba, 0x01,
+  0x0a, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xba, 0x01,
+  0x0a, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xe3, 0x1a, 0x8d, 0x02, 0x05,
+  0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x16, 0x02, 0x07, 0x02, 0x14, 0x02,
+  0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x02,
+  0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02,
+  0x12, 0x02, 0x0a, 0x02, 0x12, 0x02, 0x0b, 0x02, 0x07, 0x02, 0x07, 0x02,
+  0x0c, 0x04, 0x0c, 0x04, 0x0d, 0x03, 0x02, 0x01, 0x06, 0x01, 0x02, 0x03,
+  0x36, 0x01, 0x3b, 0x01, 0x06, 0x01, 0x3b, 0x01, 0x71, 0x9a, 0x08, 0x08,
+  0x36, 0x0d, 0x32, 0x0f, 0x30, 0x07, 0x02, 0x08, 0x2e, 0x05, 0x09, 0x05,
+  0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04,
+  0x28, 0x04, 0x11, 0x03, 0x28, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09,
+  0x1e, 0x07, 0x12, 0x0a, 0x1c, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06,
+  0x18, 0x04, 0x20, 0x04, 0x17, 0x04, 0x22, 0x04, 0x16, 0x03, 0x23, 0x04,
+  0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x03, 0x25, 0x04,
+  0x14, 0x03, 0x25, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x15, 0x04, 0x0f, 0x04, 0x0f, 0x04, 0x16, 0x05,
+  0x0e, 0x04, 0x0e, 0x05, 0x17, 0x06, 0x0d, 0x02, 0x0d, 0x06, 0x19, 0x07,
+  0x04, 0x02, 0x0c, 0x02, 0x04, 0x07, 0x1b, 0x06, 0x04, 0x03, 0x0a, 0x04,
+  0x02, 0x07, 0x1d, 0x05, 0x04, 0x03, 0x0a, 0x04, 0x02, 0x05, 0x23, 0x01,
+  0x05, 0x01, 0x0c, 0x01, 0x05, 0x01, 0x31, 0x02, 0x3d, 0x04, 0x3d, 0x03,
+  0x3d, 0x02, 0x36, 0x03, 0x0b, 0x02, 0x30, 0x03, 0x0a, 0x04, 0x2f, 0x03,
+  0x0b, 0x03, 0x75, 0x02, 0x3e, 0x03, 0x3d, 0x03, 0xa1, 0x03, 0xd9, 0x4b,
+  0x11, 0xaf, 0x01, 0x18, 0xa9, 0x01, 0x1e, 0xa4, 0x01, 0x22, 0xa0, 0x01,
+  0x26, 0x9d, 0x01, 0x29, 0x99, 0x01, 0x2c, 0x97, 0x01, 0x2f, 0x93, 0x01,
+  0x32, 0x91, 0x01, 0x34, 0x8f, 0x01, 0x1a, 0x02, 0x1a, 0x8d, 0x01, 0x14,
+  0x10, 0x14, 0x8b, 0x01, 0x13, 0x15, 0x12, 0x89, 0x01, 0x11, 0x1a, 0x11,
+  0x88, 0x01, 0x10, 0x1d, 0x10, 0x86, 0x01, 0x0f, 0x20, 0x10, 0x84, 0x01,
+  0x0f, 0x22, 0x0f, 0x83, 0x01, 0x0f, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27,
+  0x0e, 0x80, 0x01, 0x0e, 0x29, 0x0d, 0x80, 0x01, 0x0d, 0x2b, 0x0d, 0x7e,
+  0x0d, 0x2c, 0x0d, 0x7e, 0x0c, 0x2e, 0x0d, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c,
+  0x0c, 0x30, 0x0d, 0x7b, 0x0b, 0x32, 0x0c, 0x7a, 0x0c, 0x32, 0x0c, 0x7a,
+  0x0c, 0x33, 0x0c, 0x79, 0x0b, 0x34, 0x0c, 0x78, 0x0c, 0x35, 0x0e, 0x74,
+  0x0c, 0x36, 0x15, 0x6a, 0x0f, 0x36, 0x18, 0x65, 0x11, 0x36, 0x1b, 0x60,
+  0x13, 0x37, 0x1c, 0x5c, 0x15, 0x37, 0x1e, 0x59, 0x16, 0x37, 0x1f, 0x56,
+  0x17, 0x38, 0x20, 0x54, 0x18, 0x38, 0x22, 0x51, 0x19, 0x38, 0x23, 0x4f,
+  0x1a, 0x38, 0x24, 0x4d, 0x17, 0x4b, 0x16, 0x4b, 0x13, 0x54, 0x12, 0x4b,
+  0x10, 0x5a, 0x10, 0x49, 0x0f, 0x5d, 0x10, 0x47, 0x0f, 0x60, 0x0f, 0x46,
+  0x0e, 0x62, 0x0e, 0x45, 0x0e, 0x64, 0x0e, 0x44, 0x0d, 0x66, 0x0d, 0x43,
+  0x0d, 0x68, 0x0d, 0x42, 0x0c, 0x6a, 0x0c, 0x41, 0x0c, 0x6b, 0x0d, 0x40,
+  0x0c, 0x6c, 0x0c, 0x40, 0x0b, 0x6d, 0x0c, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e,
+  0x0b, 0x6f, 0x0c, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e,
+  0x0a, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d,
+  0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c,
+  0x0b, 0x71, 0x0c, 0x3c, 0x0b, 0x71, 0x0b, 0x3e, 0x0a, 0x71, 0x0b, 0x3e,
+  0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x6f, 0x0c, 0x3e,
+  0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0b, 0x40, 0x0b, 0x6d, 0x0c, 0x40,
+  0x0c, 0x34, 0x05, 0x33, 0x0c, 0x40, 0x0d, 0x31, 0x08, 0x31, 0x0c, 0x42,
+  0x0c, 0x30, 0x0a, 0x2f, 0x0d, 0x42, 0x0d, 0x2f, 0x0a, 0x2e, 0x0e, 0x43,
+  0x0d, 0x2e, 0x0b, 0x2c, 0x0e, 0x44, 0x0e, 0x2d, 0x0b, 0x2b, 0x0f, 0x45,
+  0x0e, 0x2c, 0x0b, 0x2a, 0x0f, 0x46, 0x10, 0x2a, 0x0a, 0x2a, 0x0f, 0x48,
+  0x10, 0x2a, 0x09, 0x28, 0x11, 0x49, 0x12, 0x28, 0x07, 0x27, 0x12, 0x4b,
+  0x14, 0x26, 0x04, 0x26, 0x14, 0x4c, 0x18, 0x0d, 0x05, 0x25, 0x05, 0x0b,
+  0x18, 0x4e, 0x17, 0x0c, 0x07, 0x22, 0x08, 0x0a, 0x17, 0x50, 0x16, 0x0b,
+  0x09, 0x21, 0x09, 0x09, 0x16, 0x53, 0x14, 0x0a, 0x0a, 0x20, 0x0a, 0x09,
+  0x15, 0x55, 0x13, 0x0a, 0x0b, 0x1f, 0x0b, 0x08, 0x14, 0x57, 0x12, 0x0a,
+  0x0b, 0x1f, 0x0b, 0x08, 0x12, 0x5b, 0x10, 0x0a, 0x0b, 0x1f, 0x0b, 0x08,
+  0x11, 0x5e, 0x0e, 0x0a, 0x0a, 0x20, 0x0a, 0x09, 0x0f, 0x62, 0x0c, 0x0b,
+  0x09, 0x21, 0x09, 0x09, 0x0d, 0x66, 0x0a, 0x0c, 0x07, 0x23, 0x07, 0x0a,
+  0x0a, 0x6e, 0x05, 0x0d, 0x04, 0x26, 0x04, 0x0d, 0x04, 0xdc, 0x02, 0x03,
+  0xbf, 0x01, 0x07, 0xbc, 0x01, 0x09, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0b,
+  0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x09,
+  0xbb, 0x01, 0x09, 0xbc, 0x01, 0x06, 0xeb, 0x02, 0x06, 0x24, 0x06, 0x93,
+  0x01, 0x08, 0x21, 0x09, 0x91, 0x01, 0x09, 0x21, 0x09, 0x90, 0x01, 0x0b,
+  0x1f, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x8f, 0x01, 0x0b, 0x1f, 0x0b,
+  0x8f, 0x01, 0x0b, 0x1f, 0x0b, 0x90, 0x01, 0x09, 0x21, 0x09, 0x91, 0x01,
+  0x09, 0x22, 0x08, 0x93, 0x01, 0x06, 0x24, 0x06, 0xaf, 0x04, 0x03, 0xbf,
+  0x01, 0x07, 0xbc, 0x01, 0x09, 0xbb, 0x01, 0x0a, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x0a, 0xba, 0x01, 0x0a, 0xbb,
+  0x01, 0x08, 0xbd, 0x01, 0x06, 0xeb, 0x1a, 0xec, 0x01, 0x02, 0x1d, 0x04,
+  0x1b, 0x07, 0x1a, 0x04, 0x1d, 0x02, 0x1f, 0x01, 0x28, 0x01, 0x1f, 0x01,
+  0x1e, 0x04, 0x0e, 0x02, 0x0c, 0x04, 0x0e, 0x03, 0x0c, 0x01, 0x11, 0x01,
+  0x06, 0x01, 0x06, 0x01, 0x18, 0x01, 0x1d, 0x04, 0x1c, 0x05, 0x1c, 0x02,
+  0x1f, 0x01, 0x90, 0x02, 0x99, 0x06, 0x02, 0x3e, 0x02, 0x3d, 0x04, 0x3c,
+  0x04, 0x3b, 0x07, 0x37, 0x0a, 0x34, 0x0e, 0x32, 0x0f, 0x33, 0x0a, 0x37,
+  0x08, 0x39, 0x06, 0x3b, 0x04, 0x3d, 0x02, 0x3e, 0x02, 0x52, 0x01, 0x3f,
+  0x01, 0x3e, 0x02, 0x3d, 0x04, 0x3b, 0x06, 0x20, 0x01, 0x17, 0x0a, 0x1d,
+  0x03, 0x16, 0x0a, 0x1c, 0x05, 0x17, 0x06, 0x1d, 0x07, 0x17, 0x04, 0x1f,
+  0x05, 0x19, 0x02, 0x21, 0x03, 0x1b, 0x01, 0x22, 0x01, 0x0d, 0x01, 0x0e,
+  0x01, 0x30, 0x02, 0x3d, 0x04, 0x3b, 0x06, 0x38, 0x09, 0x36, 0x0b, 0x37,
+  0x07, 0x3b, 0x04, 0x3c, 0x03, 0x3e, 0x02, 0x3e, 0x01, 0xa1, 0x08, 0x93,
+  0x33, 0x01, 0xc3, 0x01, 0x02, 0xc2, 0x01, 0x02, 0xc2, 0x01, 0x02, 0xc1,
+  0x01, 0x03, 0xc1, 0x01, 0x04, 0xc0, 0x01, 0x04, 0xbf, 0x01, 0x06, 0xbe,
+  0x01, 0x06, 0xbd, 0x01, 0x08, 0xbc, 0x01, 0x08, 0xbb, 0x01, 0x0a, 0xb9,
+  0x01, 0x0c, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0e, 0xb5, 0x01, 0x10, 0xb3,
+  0x01, 0x12, 0xb1, 0x01, 0x14, 0xaf, 0x01, 0x16, 0xac, 0x01, 0x19, 0xaa,
+  0x01, 0x1c, 0xa6, 0x01, 0x1f, 0xa4, 0x01, 0x22, 0x9f, 0x01, 0x28, 0x99,
+  0x01, 0x2d, 0x93, 0x01, 0x36, 0x91, 0x01, 0x30, 0x98, 0x01, 0x28, 0x9e,
+  0x01, 0x24, 0xa2, 0x01, 0x20, 0xa5, 0x01, 0x1d, 0xa9, 0x01, 0x1a, 0xab,
+  0x01, 0x18, 0xad, 0x01, 0x15, 0xb0, 0x01, 0x13, 0xb2, 0x01, 0x11, 0xb4,
+  0x01, 0x0f, 0xb6, 0x01, 0x0e, 0xb7, 0x01, 0x0c, 0xb9, 0x01, 0x0a, 0xba,
+  0x01, 0x0a, 0xbb, 0x01, 0x08, 0xbc, 0x01, 0x07, 0xbe, 0x01, 0x06, 0xbe,
+  0x01, 0x05, 0xc0, 0x01, 0x04, 0x38, 0x01, 0x87, 0x01, 0x04, 0x38, 0x01,
+  0x88, 0x01, 0x02, 0x39, 0x01, 0x88, 0x01, 0x02, 0x39, 0x02, 0x87, 0x01,
+  0x02, 0x38, 0x03, 0x87, 0x01, 0x02, 0x38, 0x03, 0x87, 0x01, 0x01, 0x39,
+  0x04, 0xbf, 0x01, 0x05, 0xbf, 0x01, 0x06, 0xbd, 0x01, 0x07, 0xbc, 0x01,
+  0x09, 0xba, 0x01, 0x0b, 0xb9, 0x01, 0x0c, 0xb7, 0x01, 0x0e, 0xb5, 0x01,
+  0x10, 0x63, 0x01, 0x4e, 0x13, 0x62, 0x01, 0x4d, 0x16, 0x5f, 0x02, 0x4b,
+  0x19, 0x5e, 0x03, 0x48, 0x1e, 0x5a, 0x04, 0x45, 0x24, 0x57, 0x05, 0x43,
+  0x25, 0x56, 0x07, 0x46, 0x1e, 0x58, 0x08, 0x48, 0x19, 0x5a, 0x0a, 0x49,
+  0x16, 0x5a, 0x0d, 0x48, 0x13, 0x5a, 0x10, 0x48, 0x11, 0x59, 0x14, 0x48,
+  0x0e, 0x57, 0x1b, 0x45, 0x0c, 0x5a, 0x16, 0x48, 0x0b, 0x5e, 0x11, 0x4b,
+  0x09, 0x60, 0x0e, 0x4e, 0x07, 0x63, 0x0b, 0x26, 0x01, 0x28, 0x07, 0x64,
+  0x09, 0x27, 0x01, 0x29, 0x05, 0x66, 0x07, 0x28, 0x01, 0x2a, 0x04, 0x66,
+  0x06, 0x28, 0x02, 0x2a, 0x03, 0x68, 0x05, 0x28, 0x03, 0x29, 0x03, 0x69,
+  0x03, 0x29, 0x03, 0x2a, 0x02, 0x69, 0x02, 0x29, 0x04, 0x2a, 0x01, 0x6a,
+  0x02, 0x29, 0x05, 0x29, 0x01, 0x6b, 0x01, 0x28, 0x06, 0x29, 0x01, 0x6b,
+  0x01, 0x27, 0x08, 0xbc, 0x01, 0x09, 0xba, 0x01, 0x0b, 0xb8, 0x01, 0x0c,
+  0xb7, 0x01, 0x0e, 0xb5, 0x01, 0x10, 0xb3, 0x01, 0x13, 0xaf, 0x01, 0x16,
+  0xad, 0x01, 0x19, 0xa8, 0x01, 0x1e, 0xa3, 0x01, 0x24, 0xa0, 0x01, 0x25,
+  0xa2, 0x01, 0x1e, 0xa8, 0x01, 0x1a, 0xac, 0x01, 0x16, 0xb0, 0x01, 0x13,
+  0xb2, 0x01, 0x11, 0xb4, 0x01, 0x0f, 0xb6, 0x01, 0x0c, 0xb9, 0x01, 0x0b,
+  0xba, 0x01, 0x09, 0xbb, 0x01, 0x08, 0xbd, 0x01, 0x06, 0xbf, 0x01, 0x05,
+  0xbf, 0x01, 0x04, 0xc1, 0x01, 0x03, 0xc1, 0x01, 0x03, 0xc1, 0x01, 0x02,
+  0xc3, 0x01, 0x01, 0xc3, 0x01, 0x01, 0xc3, 0x01, 0x01, 0xe1, 0x48, 0x8d,
+  0x02, 0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02, 0x15, 0x03, 0x07, 0x02,
+  0x14, 0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04, 0x0e, 0x04, 0x0a, 0x06,
+  0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x12, 0x02,
+  0x0a, 0x02, 0x04, 0x03, 0x06, 0x01, 0x04, 0x02, 0x0a, 0x02, 0x03, 0x04,
+  0x06, 0x02, 0x03, 0x02, 0x0b, 0x02, 0x02, 0x03, 0x07, 0x01, 0x03, 0x02,
+  0x0c, 0x06, 0x0a, 0x04, 0x0d, 0x05, 0x03, 0x02, 0x05, 0x03, 0x10, 0x04,
+  0x02, 0x02, 0x02, 0x01, 0x14, 0x05, 0x05, 0x02, 0x16, 0x02, 0x06, 0x02,
+  0x16, 0x02, 0x1e, 0x01, 0x03, 0x02, 0x1e, 0x01, 0x71, 0x9b, 0x08, 0x07,
+  0x36, 0x0d, 0x32, 0x0f, 0x30, 0x08, 0x01, 0x08, 0x2e, 0x05, 0x09, 0x05,
+  0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04,
+  0x28, 0x04, 0x11, 0x03, 0x28, 0x04, 0x11, 0x04, 0x25, 0x06, 0x11, 0x09,
+  0x1e, 0x07, 0x12, 0x0b, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1b, 0x07,
+  0x17, 0x05, 0x20, 0x04, 0x17, 0x04, 0x22, 0x04, 0x15, 0x05, 0x22, 0x04,
+  0x15, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04,
+  0x14, 0x04, 0x07, 0x07, 0x0d, 0x01, 0x08, 0x04, 0x14, 0x04, 0x07, 0x07,
+  0x0c, 0x03, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07, 0x0c, 0x04, 0x07, 0x04,
+  0x14, 0x04, 0x06, 0x07, 0x0c, 0x04, 0x07, 0x03, 0x16, 0x04, 0x05, 0x06,
+  0x0d, 0x04, 0x06, 0x04, 0x16, 0x05, 0x03, 0x07, 0x0e, 0x02, 0x06, 0x05,
+  0x17, 0x06, 0x01, 0x06, 0x15, 0x06, 0x19, 0x0c, 0x06, 0x03, 0x0a, 0x07,
+  0x1b, 0x0a, 0x07, 0x03, 0x09, 0x07, 0x1e, 0x08, 0x06, 0x04, 0x09, 0x05,
+  0x21, 0x06, 0x07, 0x04, 0x0a, 0x01, 0x24, 0x0b, 0x02, 0x04, 0x03, 0x03,
+  0x29, 0x0a, 0x04, 0x02, 0x04, 0x03, 0x28, 0x0a, 0x0a, 0x04, 0x2d, 0x04,
+  0x0b, 0x04, 0x2d, 0x03, 0x0d, 0x02, 0x2d, 0x04, 0x3c, 0x03, 0x06, 0x02,
+  0x35, 0x02, 0x06, 0x03, 0x34, 0x02, 0x07, 0x03, 0x34, 0x02, 0x06, 0x04,
+  0x34, 0x01, 0x07, 0x04, 0x3d, 0x02, 0xe2, 0x02, 0xd9, 0x4b, 0x10, 0xb0,
+  0x01, 0x18, 0xaa, 0x01, 0x1d, 0xa4, 0x01, 0x22, 0xa0, 0x01, 0x26, 0x9d,
+  0x01, 0x29, 0x99, 0x01, 0x2c, 0x97, 0x01, 0x2f, 0x93, 0x01, 0x32, 0x91,
+  0x01, 0x34, 0x8f, 0x01, 0x36, 0x8d, 0x01, 0x15, 0x0f, 0x14, 0x8b, 0x01,
+  0x13, 0x15, 0x12, 0x89, 0x01, 0x12, 0x19, 0x11, 0x87, 0x01, 0x11, 0x1d,
+  0x10, 0x86, 0x01, 0x0f, 0x20, 0x10, 0x84, 0x01, 0x0f, 0x22, 0x0f, 0x83,
+  0x01, 0x0f, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01, 0x0e,
+  0x29, 0x0d, 0x80, 0x01, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2c, 0x0d, 0x7e,
+  0x0c, 0x2e, 0x0d, 0x7c, 0x0d, 0x2f, 0x0c, 0x7c, 0x0c, 0x30, 0x0d, 0x7a,
+  0x0d, 0x31, 0x0c, 0x7a, 0x0c, 0x32, 0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x78,
+  0x0c, 0x34, 0x0c, 0x78, 0x0c, 0x35, 0x11, 0x71, 0x0d, 0x35, 0x16, 0x69,
+  0x0f, 0x36, 0x19, 0x63, 0x12, 0x37, 0x1a, 0x5f, 0x14, 0x37, 0x1c, 0x5c,
+  0x15, 0x37, 0x1e, 0x58, 0x17, 0x37, 0x1f, 0x56, 0x18, 0x37, 0x21, 0x53,
+  0x18, 0x38, 0x22, 0x51, 0x19, 0x38, 0x23, 0x4f, 0x1a, 0x38, 0x24, 0x4d,
+  0x16, 0x4b, 0x17, 0x4b, 0x13, 0x54, 0x13, 0x49, 0x11, 0x59, 0x11, 0x49,
+  0x10, 0x5c, 0x10, 0x47, 0x0f, 0x60, 0x0f, 0x45, 0x0f, 0x62, 0x0e, 0x45,
+  0x0e, 0x64, 0x0e, 0x43, 0x0e, 0x66, 0x0d, 0x43, 0x0d, 0x68, 0x0d, 0x41,
+  0x0d, 0x6a, 0x0c, 0x41, 0x0c, 0x6b, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x3f,
+  0x0c, 0x6e, 0x0b, 0x3f, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e,
+  0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0b, 0x3d, 0x0c, 0x70, 0x0b, 0x3d,
+  0x0c, 0x70, 0x0b, 0x3d, 0x0b, 0x71, 0x0b, 0x3d, 0x0b, 0x72, 0x0b, 0x3c,
+  0x0b, 0x72, 0x0b, 0x3c, 0x0b, 0x54, 0x04, 0x1a, 0x0b, 0x3c, 0x0c, 0x17,
+  0x15, 0x25, 0x08, 0x17, 0x0c, 0x3c, 0x0c, 0x16, 0x16, 0x24, 0x0a, 0x16,
+  0x0b, 0x3e, 0x0b, 0x16, 0x15, 0x25, 0x0a, 0x16, 0x0b, 0x3e, 0x0b, 0x15,
+  0x16, 0x24, 0x0b, 0x16, 0x0b, 0x3e, 0x0b, 0x15, 0x15, 0x25, 0x0c, 0x15,
+  0x0b, 0x3e, 0x0c, 0x14, 0x15, 0x25, 0x0c, 0x14, 0x0c, 0x3e, 0x0c, 0x13,
+  0x15, 0x26, 0x0b, 0x15, 0x0c, 0x3f, 0x0b, 0x13, 0x15, 0x25, 0x0c, 0x15,
+  0x0b, 0x40, 0x0c, 0x12, 0x14, 0x26, 0x0c, 0x14, 0x0c, 0x40, 0x0d, 0x10,
+  0x15, 0x26, 0x0c, 0x13, 0x0d, 0x41, 0x0c, 0x10, 0x14, 0x27, 0x0b, 0x14,
+  0x0c, 0x42, 0x0d, 0x0e, 0x15, 0x27, 0x0b, 0x13, 0x0d, 0x42, 0x0e, 0x0d,
+  0x14, 0x28, 0x0b, 0x12, 0x0d, 0x44, 0x0e, 0x0c, 0x13, 0x29, 0x0a, 0x12,
+  0x0e, 0x44, 0x0f, 0x0a, 0x14, 0x2a, 0x09, 0x11, 0x0e, 0x46, 0x0f, 0x09,
+  0x13, 0x2c, 0x07, 0x11, 0x0f, 0x47, 0x0f, 0x08, 0x13, 0x2d, 0x05, 0x10,
+  0x10, 0x48, 0x11, 0x05, 0x13, 0x42, 0x10, 0x4a, 0x12, 0x03, 0x13, 0x3f,
+  0x13, 0x4b, 0x26, 0x16, 0x03, 0x23, 0x16, 0x4d, 0x25, 0x14, 0x07, 0x1e,
+  0x18, 0x4f, 0x23, 0x14, 0x09, 0x1d, 0x17, 0x51, 0x22, 0x13, 0x0b, 0x1c,
+  0x16, 0x53, 0x20, 0x14, 0x0b, 0x1c, 0x15, 0x55, 0x1f, 0x14, 0x0b, 0x1c,
+  0x14, 0x58, 0x1c, 0x15, 0x0b, 0x1c, 0x12, 0x5b, 0x1a, 0x15, 0x0c, 0x1c,
+  0x11, 0x5e, 0x18, 0x15, 0x0c, 0x1c, 0x0f, 0x62, 0x15, 0x16, 0x0b, 0x1d,
+  0x0d, 0x67, 0x12, 0x16, 0x0b, 0x1d, 0x0a, 0x6a, 0x11, 0x16, 0x0c, 0x0c,
+  0x03, 0x0e, 0x06, 0x6e, 0x20, 0x07, 0x0b, 0x0b, 0x07, 0x7f, 0x21, 0x07,
+  0x0b, 0x0b, 0x08, 0x7e, 0x20, 0x09, 0x0a, 0x0a, 0x0a, 0x7d, 0x20, 0x09,
+  0x09, 0x0b, 0x0a, 0x7c, 0x20, 0x0b, 0x08, 0x0a, 0x0b, 0x7c, 0x1f, 0x0e,
+  0x04, 0x0c, 0x0b, 0x7b, 0x1f, 0x1f, 0x0b, 0x7b, 0x1e, 0x20, 0x0b, 0x7b,
+  0x1e, 0x1f, 0x0c, 0x7a, 0x1e, 0x20, 0x0b, 0x7b, 0x1d, 0x21, 0x0b, 0x8a,
+  0x01, 0x0d, 0x22, 0x0b, 0x8a, 0x01, 0x0d, 0x22, 0x0b, 0x89, 0x01, 0x0d,
+  0x23, 0x0a, 0x8a, 0x01, 0x0c, 0x25, 0x09, 0x8a, 0x01, 0x0b, 0x26, 0x09,
+  0x8a, 0x01, 0x0b, 0x28, 0x06, 0x8a, 0x01, 0x0b, 0xb9, 0x01, 0x0a, 0xba,
+  0x01, 0x09, 0x13, 0x01, 0xa6, 0x01, 0x0a, 0x11, 0x06, 0xa3, 0x01, 0x09,
+  0x11, 0x08, 0xa2, 0x01, 0x08, 0x11, 0x0a, 0xa1, 0x01, 0x07, 0x12, 0x0a,
+  0xa0, 0x01, 0x08, 0x11, 0x0b, 0xa0, 0x01, 0x07, 0x12, 0x0b, 0xa0, 0x01,
+  0x06, 0x13, 0x0b, 0x9f, 0x01, 0x06, 0x13, 0x0c, 0x9f, 0x01, 0x06, 0x13,
+  0x0c, 0x9f, 0x01, 0x05, 0x14, 0x0b, 0xa0, 0x01, 0x04, 0x15, 0x0b, 0x9f,
+  0x01, 0x04, 0x16, 0x0b, 0x9f, 0x01, 0x03, 0x17, 0x0b, 0x9f, 0x01, 0x03,
+  0x17, 0x0a, 0xa0, 0x01, 0x02, 0x18, 0x0a, 0xa0, 0x01, 0x01, 0x1a, 0x08,
+  0xbd, 0x01, 0x06, 0xa8, 0x19, 0xd8, 0x02, 0x04, 0x1b, 0x05, 0x1f, 0x02,
+  0x1d, 0x02, 0x07, 0x19, 0x08, 0x16, 0x2a, 0x11, 0x0e, 0x13, 0x1f, 0x02,
+  0x1e, 0x02, 0x1b, 0x05, 0x1b, 0x04, 0xaa, 0x02, 0xf1, 0x09, 0x04, 0x3b,
+  0x07, 0x38, 0x09, 0x37, 0x0a, 0x36, 0x03, 0x03, 0x04, 0x3c, 0x04, 0x3c,
+  0x04, 0x3c, 0x04, 0x0f, 0x31, 0x0e, 0x31, 0x0f, 0x30, 0x10, 0x2f, 0xd2,
+  0x01, 0x21, 0x1e, 0x24, 0x1c, 0x25, 0x1b, 0x26, 0x3c, 0x05, 0x3c, 0x04,
+  0x3c, 0x04, 0x36, 0x02, 0x04, 0x04, 0x35, 0x0b, 0x35, 0x0a, 0x37, 0x08,
+  0x39, 0x06, 0x95, 0x09, 0x85, 0x5a, 0x01, 0xbd, 0x01, 0x0c, 0xb6, 0x01,
+  0x11, 0xb1, 0x01, 0x14, 0xaf, 0x01, 0x17, 0xac, 0x01, 0x19, 0xaa, 0x01,
+  0x1b, 0xa8, 0x01, 0x1d, 0xa7, 0x01, 0x1d, 0xa7, 0x01, 0x1e, 0xa6, 0x01,
+  0x1f, 0xa5, 0x01, 0x1f, 0xa5, 0x01, 0x0c, 0x04, 0x10, 0xa5, 0x01, 0x09,
+  0x08, 0x0e, 0xa6, 0x01, 0x07, 0x0a, 0x0d, 0xa8, 0x01, 0x03, 0x0d, 0x0c,
+  0xb8, 0x01, 0x0d, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c,
+  0xb8, 0x01, 0x0c, 0xb7, 0x01, 0x0d, 0xb7, 0x01, 0x0c, 0xb7, 0x01, 0x0d,
+  0xb6, 0x01, 0x0e, 0x2f, 0x95, 0x01, 0x2c, 0x97, 0x01, 0x2c, 0x98, 0x01,
+  0x2b, 0x98, 0x01, 0x2c, 0x97, 0x01, 0x2c, 0x97, 0x01, 0x2d, 0x97, 0x01,
+  0x2d, 0x95, 0x01, 0x30, 0x93, 0x01, 0x31, 0x92, 0x01, 0x33, 0x8f, 0x01,
+  0x37, 0x8a, 0x01, 0xe2, 0x0f, 0x66, 0x5c, 0x6b, 0x58, 0x6e, 0x56, 0x70,
+  0x53, 0x72, 0x52, 0x73, 0x51, 0x74, 0x51, 0x74, 0x50, 0x75, 0x50, 0x74,
+  0x51, 0x74, 0x52, 0x72, 0xb6, 0x01, 0x0f, 0xb7, 0x01, 0x0d, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0c, 0xb9, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01,
+  0x0c, 0xb8, 0x01, 0x0c, 0xb8, 0x01, 0x0c, 0xb7, 0x01, 0x0c, 0xa6, 0x01,
+  0x06, 0x0c, 0x0c, 0xa5, 0x01, 0x09, 0x09, 0x0d, 0xa4, 0x01, 0x0b, 0x06,
+  0x0f, 0xa4, 0x01, 0x1f, 0xa5, 0x01, 0x1f, 0xa5, 0x01, 0x1e, 0xa6, 0x01,
+  0x1e, 0xa6, 0x01, 0x1d, 0xa8, 0x01, 0x1b, 0xa9, 0x01, 0x1a, 0xac, 0x01,
+  0x17, 0xae, 0x01, 0x15, 0xb0, 0x01, 0x12, 0xb5, 0x01, 0x0d, 0xba, 0x01,
+  0x06, 0x9f, 0x53, 0x8d, 0x02, 0x05, 0x19, 0x08, 0x17, 0x03, 0x05, 0x02,
+  0x16, 0x02, 0x07, 0x02, 0x14, 0x02, 0x08, 0x02, 0x13, 0x03, 0x09, 0x04,
+  0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x02, 0x10, 0x02, 0x0b, 0x02, 0x12, 0x02,
+  0x0a, 0x02, 0x12, 0x02, 0x0a, 0x02, 0x04, 0x03, 0x02, 0x01, 0x03, 0x01,
+  0x04, 0x02, 0x0a, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02,
+  0x0b, 0x02, 0x02, 0x03, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02, 0x0c, 0x06,
+  0x03, 0x02, 0x02, 0x02, 0x01, 0x04, 0x0d, 0x05, 0x03, 0x02, 0x02, 0x02,
+  0x01, 0x03, 0x10, 0x04, 0x02, 0x02, 0x01, 0x02, 0x14, 0x05, 0x02, 0x01,
+  0x02, 0x02, 0x16, 0x03, 0x01, 0x02, 0x02, 0x02, 0x16, 0x02, 0x02, 0x02,
+  0x1a, 0x01, 0x03, 0x02, 0x1a, 0x01, 0x03, 0x01, 0x71, 0x9a, 0x08, 0x09,
+  0x35, 0x0d, 0x32, 0x0f, 0x30, 0x07, 0x03, 0x07, 0x2e, 0x05, 0x09, 0x05,
+  0x2c, 0x05, 0x0b, 0x05, 0x2a, 0x05, 0x0d, 0x05, 0x29, 0x04, 0x0f, 0x04,
+  0x28, 0x04, 0x11, 0x04, 0x27, 0x04, 0x11, 0x05, 0x24, 0x06, 0x11, 0x09,
+  0x1e, 0x08, 0x12, 0x0a, 0x1b, 0x08, 0x13, 0x0b, 0x19, 0x06, 0x1c, 0x06,
+  0x17, 0x05, 0x20, 0x05, 0x16, 0x04, 0x22, 0x04, 0x16, 0x04, 0x23, 0x04,
+  0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x24, 0x04, 0x14, 0x04, 0x25, 0x03,
+  0x14, 0x04, 0x07, 0x07, 0x05, 0x02, 0x05, 0x02, 0x09, 0x03, 0x14, 0x04,
+  0x07, 0x07, 0x04, 0x03, 0x04, 0x04, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07,
+  0x05, 0x04, 0x03, 0x04, 0x07, 0x04, 0x14, 0x04, 0x06, 0x07, 0x05, 0x03,
+  0x04, 0x03, 0x08, 0x04, 0x15, 0x04, 0x05, 0x06, 0x05, 0x04, 0x04, 0x03,
+  0x07, 0x04, 0x16, 0x05, 0x03, 0x07, 0x05, 0x04, 0x03, 0x04, 0x06, 0x05,
+  0x17, 0x06, 0x01, 0x06, 0x06, 0x04, 0x03, 0x04, 0x04, 0x06, 0x19, 0x0c,
+  0x06, 0x03, 0x04, 0x03, 0x03, 0x07, 0x1b, 0x0a, 0x06, 0x04, 0x04, 0x03,
+  0x03, 0x06, 0x1e, 0x08, 0x06, 0x04, 0x03, 0x04, 0x03, 0x04, 0x21, 0x06,
+  0x07, 0x03, 0x04, 0x04, 0x03, 0x01, 0x24, 0x0b, 0x02, 0x03, 0x04, 0x03,
+  0x29, 0x0a, 0x02, 0x04, 0x04, 0x03, 0x28, 0x0a, 0x03, 0x04, 0x03, 0x04,
+  0x2d, 0x05, 0x03, 0x03, 0x04, 0x04, 0x2d, 0x04, 0x04, 0x03, 0x05, 0x02,
+  0x2d, 0x04, 0x04, 0x04, 0x34, 0x03, 0x05, 0x04, 0x34, 0x03, 0x05, 0x03,
+  0x35, 0x02, 0x05, 0x04, 0x35, 0x01, 0x06, 0x04, 0x34, 0x02, 0x06, 0x04,
+  0x34, 0x01, 0xec, 0x02, 0x9b, 0x4a, 0x05, 0xb8, 0x01, 0x13, 0xae, 0x01,
+  0x19, 0xa8, 0x01, 0x1f, 0xa3, 0x01, 0x23, 0x9f, 0x01, 0x27, 0x9b, 0x01,
+  0x2a, 0x99, 0x01, 0x2d, 0x96, 0x01, 0x2f, 0x93, 0x01, 0x33, 0x90, 0x01,
+  0x35, 0x8e, 0x01, 0x18, 0x07, 0x18, 0x8c, 0x01, 0x14, 0x11, 0x14, 0x8a,
+  0x01, 0x13, 0x15, 0x13, 0x88, 0x01, 0x12, 0x19, 0x11, 0x87, 0x01, 0x11,
+  0x1d, 0x10, 0x86, 0x01, 0x0f, 0x21, 0x0f, 0x84, 0x01, 0x0f, 0x23, 0x0f,
+  0x82, 0x01, 0x0f, 0x25, 0x0e, 0x82, 0x01, 0x0e, 0x27, 0x0e, 0x80, 0x01,
+  0x0e, 0x29, 0x0e, 0x7f, 0x0d, 0x2b, 0x0d, 0x7e, 0x0d, 0x2d, 0x0d, 0x7d,
+  0x0c, 0x2f, 0x0c, 0x7c, 0x0d, 0x2f, 0x0d, 0x7b, 0x0c, 0x31, 0x0c, 0x7a,
+  0x0d, 0x31, 0x0c, 0x7a, 0x0c, 0x33, 0x0c, 0x79, 0x0c, 0x33, 0x0c, 0x79,
+  0x0b, 0x35, 0x0b, 0x78, 0x0c, 0x35, 0x13, 0x6e, 0x0e, 0x35, 0x17, 0x67,
+  0x11, 0x36, 0x19, 0x62, 0x12, 0x37, 0x1b, 0x5e, 0x14, 0x37, 0x1d, 0x5b,
+  0x15, 0x37, 0x1f, 0x57, 0x17, 0x37, 0x20, 0x55, 0x18, 0x37, 0x21, 0x53,
+  0x19, 0x38, 0x21, 0x51, 0x19, 0x39, 0x22, 0x4f, 0x1a, 0x39, 0x23, 0x4d,
+  0x15, 0x4e, 0x15, 0x4b, 0x12, 0x56, 0x12, 0x49, 0x11, 0x5a, 0x11, 0x48,
+  0x0f, 0x5e, 0x0f, 0x47, 0x0f, 0x60, 0x0f, 0x45, 0x0f, 0x63, 0x0e, 0x44,
+  0x0e, 0x65, 0x0d, 0x43, 0x0e, 0x67, 0x0d, 0x42, 0x0d, 0x68, 0x0d, 0x41,
+  0x0d, 0x6a, 0x0d, 0x40, 0x0c, 0x6c, 0x0c, 0x40, 0x0c, 0x6c, 0x0c, 0x3f,
+  0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6e, 0x0c, 0x3e, 0x0c, 0x6f, 0x0b, 0x3e,
+  0x0b, 0x70, 0x0b, 0x3e, 0x0b, 0x70, 0x0c, 0x3d, 0x0b, 0x70, 0x0c, 0x3c,
+  0x0c, 0x71, 0x0b, 0x3c, 0x0c, 0x71, 0x0b, 0x3c, 0x0b, 0x72, 0x0b, 0x3c,
+  0x0b, 0x72, 0x0b, 0x3c, 0x0c, 0x18, 0x14, 0x10, 0x03, 0x13, 0x03, 0x1c,
+  0x0b, 0x3c, 0x0c, 0x17, 0x15, 0x0e, 0x07, 0x0f, 0x07, 0x1a, 0x0b, 0x3c,
+  0x0c, 0x16, 0x16, 0x0d, 0x09, 0x0d, 0x09, 0x19, 0x0b, 0x3d, 0x0b, 0x16,
+  0x15, 0x0e, 0x0a, 0x0c, 0x0a, 0x17, 0x0c, 0x3d, 0x0b, 0x15, 0x16, 0x0d,
+  0x0b, 0x0b, 0x0b, 0x17, 0x0b, 0x3e, 0x0b, 0x15, 0x15, 0x0e, 0x0b, 0x0b,
+  0x0b, 0x17, 0x0b, 0x3e, 0x0c, 0x14, 0x15, 0x0e, 0x0b, 0x0b, 0x0b, 0x17,
+  0x0b, 0x3e, 0x0c, 0x13, 0x15, 0x0e, 0x0c, 0x0b, 0x0b, 0x16, 0x0c, 0x3f,
+  0x0b, 0x13, 0x15, 0x0e, 0x0c, 0x0a, 0x0b, 0x17, 0x0c, 0x3f, 0x0c, 0x12,
+  0x14, 0x0f, 0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x40, 0x0d, 0x10, 0x15, 0x0f,
+  0x0b, 0x0b, 0x0b, 0x16, 0x0c, 0x41, 0x0c, 0x10, 0x14, 0x0f, 0x0c, 0x0a,
+  0x0c, 0x15, 0x0d, 0x41, 0x0d, 0x0e, 0x14, 0x10, 0x0b, 0x0b, 0x0b, 0x15,
+  0x0d, 0x42, 0x0e, 0x0d, 0x14, 0x10, 0x0b, 0x0b, 0x0b, 0x14, 0x0e, 0x43,
+  0x0e, 0x0c, 0x13, 0x11, 0x0b, 0x0b, 0x0b, 0x13, 0x0e, 0x44, 0x0f, 0x0a,
+  0x14, 0x10, 0x0c, 0x0a, 0x0c, 0x12, 0x0f, 0x45, 0x0f, 0x09, 0x13, 0x11,
+  0x0b, 0x0b, 0x0b, 0x12, 0x0f, 0x47, 0x0f, 0x08, 0x13, 0x11, 0x0b, 0x0b,
+  0x0b, 0x10, 0x10, 0x48, 0x11, 0x05, 0x13, 0x12, 0x0b, 0x0b, 0x0b, 0x0e,
+  0x12, 0x49, 0x13, 0x02, 0x13, 0x11, 0x0c, 0x0a, 0x0c, 0x0c, 0x13, 0x4b,
+  0x26, 0x12, 0x0b, 0x0b, 0x0b, 0x08, 0x17, 0x4d, 0x25, 0x12, 0x0b, 0x0b,
+  0x0b, 0x06, 0x18, 0x4f, 0x23, 0x13, 0x0b, 0x0b, 0x0b, 0x06, 0x17, 0x51,
+  0x22, 0x12, 0x0c, 0x0a, 0x0c, 0x06, 0x16, 0x53, 0x20, 0x13, 0x0b, 0x0b,
+  0x0b, 0x07, 0x15, 0x55, 0x1f, 0x13, 0x0b, 0x0b, 0x0b, 0x07, 0x14, 0x58,
+  0x1c, 0x14, 0x0b, 0x0b, 0x0b, 0x07, 0x12, 0x5b, 0x1a, 0x14, 0x0c, 0x0a,
+  0x0c, 0x07, 0x11, 0x5e, 0x18, 0x14, 0x0b, 0x0b, 0x0b, 0x08, 0x0f, 0x63,
+  0x14, 0x15, 0x0b, 0x0b, 0x0b, 0x08, 0x0d, 0x67, 0x12, 0x14, 0x0c, 0x0b,
+  0x0b, 0x08, 0x0a, 0x6a, 0x11, 0x15, 0x0c, 0x0a, 0x0c, 0x09, 0x04, 0x6f,
+  0x20, 0x06, 0x0b, 0x0b, 0x0b, 0x7c, 0x21, 0x06, 0x0b, 0x0b, 0x0b, 0x7c,
+  0x20, 0x06, 0x0c, 0x0b, 0x0b, 0x7c, 0x20, 0x06, 0x0c, 0x0a, 0x0c, 0x7b,
+  0x20, 0x07, 0x0b, 0x0b, 0x0b, 0x7c, 0x1f, 0x08, 0x0b, 0x0b, 0x0b, 0x7b,
+  0x20, 0x07, 0x0c, 0x0b, 0x0b, 0x7b, 0x1f, 0x08, 0x0b, 0x0b, 0x0c, 0x7b,
+  0x1e, 0x09, 0x0b, 0x0b, 0x0b, 0x7b, 0x1f, 0x09, 0x0b, 0x0b, 0x0b, 0x7b,
+  0x1e, 0x09, 0x0c, 0x0b, 0x0b, 0x8a, 0x01, 0x0e, 0x0a, 0x0b, 0x0c, 0x0b,
+  0x8a, 0x01, 0x0e, 0x0a, 0x0b, 0x0c, 0x0a, 0x8b, 0x01, 0x0d, 0x0b, 0x0b,
+  0x0c, 0x0a, 0x8a, 0x01, 0x0d, 0x0b, 0x0c, 0x0d, 0x08, 0x8b, 0x01, 0x0d,
+  0x0b, 0x0b, 0x0f, 0x07, 0x8b, 0x01, 0x0c, 0x0c, 0x0b, 0x12, 0x01, 0x8e,
+  0x01, 0x0b, 0x0d, 0x0b, 0xa0, 0x01, 0x0c, 0x0c, 0x0c, 0xa0, 0x01, 0x0b,
+  0x0d, 0x0b, 0xa1, 0x01, 0x0a, 0x0e, 0x0b, 0xa1, 0x01, 0x0a, 0x0e, 0x0b,
+  0xa0, 0x01, 0x0a, 0x0e, 0x0c, 0xa0, 0x01, 0x09, 0x0f, 0x0b, 0xa1, 0x01,
+  0x08, 0x10, 0x0b, 0xa1, 0x01, 0x08, 0x0f, 0x0c, 0xa1, 0x01, 0x07, 0x10,
+  0x0c, 0xa0, 0x01, 0x07, 0x11, 0x0b, 0xa1, 0x01, 0x07, 0x11, 0x0b, 0xa1,
+  0x01, 0x06, 0x12, 0x0b, 0xa1, 0x01, 0x05, 0x12, 0x0c, 0xa0, 0x01, 0x06,
+  0x13, 0x0a, 0xa1, 0x01, 0x05, 0x14, 0x0a, 0xa1, 0x01, 0x04, 0x15, 0x0a,
+  0xa1, 0x01, 0x04, 0x16, 0x08, 0xa2, 0x01, 0x03, 0x18, 0x05, 0xa3, 0x01,
+  0x03, 0xc1, 0x01, 0x03, 0xc1, 0x01, 0x02, 0xc0, 0x16, 0x6d, 0x08, 0x14,
+  0x10, 0x0e, 0x06, 0x07, 0x06, 0x0d, 0x03, 0x0e, 0x03, 0x0b, 0x02, 0x11,
+  0x03, 0x0a, 0x03, 0x10, 0x02, 0x0b, 0x05, 0x0c, 0x04, 0x0a, 0x15, 0x0b,
+  0x02, 0x03, 0x0e, 0x0d, 0x02, 0x0e, 0x03, 0x0d, 0x05, 0x09, 0x04, 0x0e,
+  0x11, 0x0f, 0x03, 0x02, 0x0a, 0x10, 0x03, 0x0a, 0x02, 0x12, 0x06, 0x02,
+  0x06, 0x13, 0x0c, 0x14, 0x01, 0x03, 0x04, 0x17, 0x02, 0x06, 0x02, 0x16,
+  0x0a, 0x17, 0x08, 0x39, 0x01, 0x05, 0x01, 0x19, 0x08, 0x18, 0x07, 0xb2,
+  0x01, 0xa0, 0x03, 0x03, 0x34, 0x16, 0x27, 0x1c, 0x21, 0x21, 0x1e, 0x0f,
+  0x06, 0x0f, 0x1a, 0x0a, 0x14, 0x09, 0x18, 0x08, 0x1a, 0x07, 0x17, 0x05,
+  0x1f, 0x06, 0x15, 0x05, 0x22, 0x04, 0x15, 0x04, 0x23, 0x04, 0x15, 0x05,
+  0x22, 0x04, 0x16, 0x05, 0x20, 0x05, 0x16, 0x07, 0x1b, 0x07, 0x16, 0x0b,
+  0x15, 0x09, 0x16, 0x11, 0x0b, 0x0d, 0x16, 0x28, 0x18, 0x05, 0x04, 0x1d,
+  0x1a, 0x04, 0x09, 0x19, 0x1a, 0x04, 0x0f, 0x09, 0x06, 0x04, 0x1a, 0x05,
+  0x1b, 0x06, 0x1a, 0x07, 0x17, 0x07, 0x1c, 0x0a, 0x10, 0x09, 0x1d, 0x22,
+  0x1d, 0x21, 0x1e, 0x20, 0x20, 0x05, 0x07, 0x12, 0x22, 0x04, 0x16, 0x04,
+  0x22, 0x06, 0x12, 0x06, 0x22, 0x09, 0x0c, 0x08, 0x24, 0x1b, 0x27, 0x18,
+  0x2a, 0x14, 0x2f, 0x0e, 0x2c, 0x04, 0x3b, 0x05, 0x0c, 0x03, 0x2c, 0x05,
+  0x0b, 0x04, 0x2c, 0x06, 0x08, 0x06, 0x2c, 0x14, 0x2d, 0x12, 0x30, 0x0f,
+  0x34, 0x09, 0x75, 0x02, 0x0a, 0x02, 0x31, 0x04, 0x08, 0x04, 0x30, 0x06,
+  0x04, 0x06, 0x30, 0x10, 0x31, 0x0e, 0x33, 0x0c, 0x38, 0x04, 0xe9, 0x04,
+  0xa6, 0x1f, 0x23, 0x9a, 0x01, 0x32, 0x8c, 0x01, 0x3d, 0x82, 0x01, 0x46,
+  0x7b, 0x4d, 0x73, 0x54, 0x6e, 0x59, 0x68, 0x5e, 0x64, 0x63, 0x5f, 0x66,
+  0x5c, 0x6a, 0x59, 0x6d, 0x55, 0x2b, 0x1b, 0x2b, 0x52, 0x23, 0x2d, 0x23,
+  0x50, 0x1f, 0x37, 0x1f, 0x4d, 0x1c, 0x40, 0x1c, 0x4b, 0x1a, 0x47, 0x19,
+  0x4a, 0x17, 0x4d, 0x17, 0x48, 0x15, 0x53, 0x15, 0x46, 0x14, 0x57, 0x14,
+  0x45, 0x12, 0x5b, 0x12, 0x44, 0x11, 0x5f, 0x11, 0x43, 0x0f, 0x63, 0x0f,
+  0x42, 0x0f, 0x65, 0x0f, 0x41, 0x0e, 0x67, 0x0e, 0x41, 0x0d, 0x69, 0x0d,
+  0x41, 0x0c, 0x6b, 0x0c, 0x41, 0x0c, 0x6b, 0x0c, 0x41, 0x0c, 0x6b, 0x0c,
+  0x41, 0x0c, 0x6a, 0x0d, 0x41, 0x0d, 0x69, 0x0d, 0x41, 0x0e, 0x67, 0x0e,
+  0x41, 0x0f, 0x64, 0x0f, 0x43, 0x10, 0x61, 0x10, 0x43, 0x12, 0x5d, 0x12,
+  0x44, 0x13, 0x59, 0x13, 0x45, 0x15, 0x55, 0x14, 0x46, 0x18, 0x4f, 0x17,
+  0x44, 0x1d, 0x49, 0x19, 0x44, 0x21, 0x43, 0x1b, 0x44, 0x25, 0x3c, 0x1e,
+  0x44, 0x2b, 0x33, 0x20, 0x45, 0x32, 0x26, 0x26, 0x45, 0x41, 0x0a, 0x33,
+  0x45, 0x7d, 0x46, 0x7c, 0x48, 0x12, 0x05, 0x63, 0x49, 0x11, 0x09, 0x5f,
+  0x4b, 0x10, 0x0c, 0x5a, 0x4e, 0x0e, 0x11, 0x56, 0x4e, 0x0e, 0x15, 0x53,
+  0x4e, 0x0d, 0x19, 0x50, 0x4e, 0x0d, 0x1d, 0x4c, 0x4e, 0x0c, 0x24, 0x34,
+  0x06, 0x0c, 0x4e, 0x0d, 0x2a, 0x26, 0x0c, 0x0d, 0x4e, 0x0e, 0x38, 0x08,
+  0x1b, 0x0d, 0x4f, 0x0e, 0x58, 0x0f, 0x4f, 0x0f, 0x56, 0x10, 0x4f, 0x11,
+  0x52, 0x11, 0x51, 0x12, 0x4e, 0x13, 0x51, 0x14, 0x4a, 0x14, 0x53, 0x16,
+  0x44, 0x16, 0x55, 0x18, 0x3e, 0x18, 0x57, 0x1b, 0x36, 0x1c, 0x58, 0x1f,
+  0x2d, 0x1f, 0x5a, 0x25, 0x1f, 0x24, 0x5c, 0x67, 0x5b, 0x67, 0x5c, 0x67,
+  0x5c, 0x66, 0x5d, 0x65, 0x5e, 0x64, 0x5f, 0x62, 0x61, 0x17, 0x01, 0x48,
+  0x64, 0x13, 0x09, 0x40, 0x68, 0x11, 0x0f, 0x3a, 0x69, 0x10, 0x16, 0x36,
+  0x68, 0x0e, 0x1e, 0x21, 0x01, 0x0e, 0x68, 0x0d, 0x42, 0x0d, 0x68, 0x0d,
+  0x42, 0x0d, 0x68, 0x0d, 0x41, 0x0e, 0x68, 0x0f, 0x3e, 0x0f, 0x68, 0x11,
+  0x3a, 0x10, 0x6a, 0x13, 0x35, 0x12, 0x6a, 0x16, 0x2e, 0x16, 0x6b, 0x19,
+  0x26, 0x19, 0x6c, 0x1e, 0x1c, 0x1d, 0x6e, 0x29, 0x04, 0x29, 0x6f, 0x54,
+  0x71, 0x52, 0x74, 0x4e, 0x77, 0x4c, 0x7a, 0x48, 0x7e, 0x45, 0x81, 0x01,
+  0x40, 0x86, 0x01, 0x3c, 0x8b, 0x01, 0x36, 0x92, 0x01, 0x2e, 0x89, 0x01,
+  0x06, 0x0c, 0x24, 0x8d, 0x01, 0x08, 0x13, 0x14, 0x94, 0x01, 0x0a, 0xb9,
+  0x01, 0x0c, 0xb7, 0x01, 0x0d, 0x28, 0x03, 0x8b, 0x01, 0x0e, 0x26, 0x07,
+  0x89, 0x01, 0x0e, 0x25, 0x09, 0x87, 0x01, 0x0f, 0x24, 0x0b, 0x86, 0x01,
+  0x0f, 0x23, 0x0c, 0x86, 0x01, 0x0e, 0x24, 0x0c, 0x86, 0x01, 0x0e, 0x22,
+  0x0e, 0x86, 0x01, 0x10, 0x1e, 0x10, 0x86, 0x01, 0x14, 0x16, 0x14, 0x86,
+  0x01, 0x1b, 0x08, 0x1b, 0x87, 0x01, 0x3d, 0x87, 0x01, 0x3c, 0x89, 0x01,
+  0x3b, 0x8a, 0x01, 0x39, 0x8b, 0x01, 0x38, 0x8e, 0x01, 0x35, 0x90, 0x01,
+  0x32, 0x94, 0x01, 0x2e, 0x98, 0x01, 0x2a, 0x9d, 0x01, 0x24, 0xa4, 0x01,
+  0x1c, 0xae, 0x01, 0x10, 0xba, 0x07, 0x05, 0x20, 0x05, 0x98, 0x01, 0x08,
+  0x1d, 0x08, 0x96, 0x01, 0x0a, 0x1b, 0x0a, 0x95, 0x01, 0x0a, 0x1b, 0x0b,
+  0x93, 0x01, 0x0c, 0x19, 0x0c, 0x93, 0x01, 0x0e, 0x16, 0x0d, 0x93, 0x01,
+  0x12, 0x0e, 0x11, 0x93, 0x01, 0x31, 0x93, 0x01, 0x31, 0x94, 0x01, 0x30,
+  0x94, 0x01, 0x2f, 0x96, 0x01, 0x2e, 0x96, 0x01, 0x2d, 0x98, 0x01, 0x2b,
+  0x9b, 0x01, 0x28, 0x9d, 0x01, 0x25, 0xa2, 0x01, 0x20, 0xa7, 0x01, 0x19,
+  0xaf, 0x01, 0x11, 0xaf, 0x2d, 0x8e, 0x01, 0x02, 0x1d, 0x04, 0x1b, 0x07,
+  0x18, 0x09, 0x17, 0x09, 0x17, 0x08, 0x1a, 0x06, 0x1b, 0x04, 0x1c, 0x03,
+  0x1e, 0x02, 0x3d, 0x01, 0x01, 0x02, 0x1b, 0x02, 0x01, 0x02, 0x1b, 0x02,
+  0x01, 0x03, 0x19, 0x03, 0x02, 0x03, 0x17, 0x05, 0x02, 0x03, 0x14, 0x07,
+  0x02, 0x04, 0x13, 0x08, 0x02, 0x03, 0x12, 0x08, 0x03, 0x04, 0x11, 0x07,
+  0x03, 0x06, 0x10, 0x04, 0x06, 0x06, 0xe8, 0x01, 0x9d, 0x04, 0x03, 0x3b,
+  0x07, 0x38, 0x08, 0x37, 0x0a, 0x36, 0x0c, 0x32, 0x10, 0x2f, 0x12, 0x2e,
+  0x12, 0x2e, 0x12, 0x2e, 0x12, 0x2e, 0x11, 0x30, 0x10, 0x31, 0x0e, 0x36,
+  0x0a, 0x36, 0x08, 0x38, 0x08, 0x38, 0x07, 0x3b, 0x04, 0x3c, 0x04, 0x3d,
+  0x02, 0x7c, 0x02, 0x02, 0x02, 0x3a, 0x02, 0x01, 0x04, 0x38, 0x02, 0x02,
+  0x04, 0x37, 0x03, 0x02, 0x05, 0x36, 0x03, 0x02, 0x05, 0x35, 0x04, 0x02,
+  0x06, 0x33, 0x05, 0x02, 0x06, 0x33, 0x05, 0x03, 0x06, 0x30, 0x08, 0x03,
+  0x06, 0x2e, 0x09, 0x04, 0x06, 0x2b, 0x0c, 0x04, 0x06, 0x29, 0x0e, 0x04,
+  0x06, 0x28, 0x0e, 0x04, 0x07, 0x26, 0x0f, 0x05, 0x06, 0x26, 0x0f, 0x05,
+  0x07, 0x24, 0x10, 0x05, 0x08, 0x22, 0x10, 0x06, 0x09, 0x21, 0x0e, 0x07,
+  0x0b, 0x20, 0x0c, 0x08, 0x0c, 0x20, 0x0a, 0x09, 0x0d, 0xd0, 0x07, 0xfd,
+  0x26, 0x06, 0xbb, 0x01, 0x0d, 0xb5, 0x01, 0x11, 0xb2, 0x01, 0x13, 0xb0,
+  0x01, 0x15, 0xad, 0x01, 0x18, 0xac, 0x01, 0x19, 0xaa, 0x01, 0x1b, 0xa8,
+  0x01, 0x1c, 0xa8, 0x01, 0x1d, 0xa6, 0x01, 0x1e, 0xa6, 0x01, 0x1f, 0xa5,
+  0x01, 0x21, 0xa1, 0x01, 0x27, 0x9b, 0x01, 0x2c, 0x96, 0x01, 0x2f, 0x94,
+  0x01, 0x31, 0x92, 0x01, 0x33, 0x90, 0x01, 0x35, 0x8f, 0x01, 0x36, 0x8d,
+  0x01, 0x37, 0x8d, 0x01, 0x37, 0x8d, 0x01, 0x38, 0x8b, 0x01, 0x39, 0x8b,
+  0x01, 0x39, 0x8b, 0x01, 0x39, 0x8b, 0x01, 0x39, 0x8b, 0x01, 0x38, 0x8d,
+  0x01, 0x37, 0x8d, 0x01, 0x37, 0x8d, 0x01, 0x36, 0x8f, 0x01, 0x35, 0x8f,
+  0x01, 0x34, 0x91, 0x01, 0x32, 0x93, 0x01, 0x31, 0x94, 0x01, 0x2f, 0x96,
+  0x01, 0x2e, 0x98, 0x01, 0x2c, 0x9b, 0x01, 0x28, 0xa3, 0x01, 0x20, 0xa4,
+  0x01, 0x20, 0xa5, 0x01, 0x1e, 0xa7, 0x01, 0x1c, 0xa9, 0x01, 0x19, 0xaa,
+  0x01, 0x19, 0xab, 0x01, 0x19, 0xab, 0x01, 0x18, 0xac, 0x01, 0x18, 0xac,
+  0x01, 0x17, 0xad, 0x01, 0x16, 0xaf, 0x01, 0x13, 0xb2, 0x01, 0x10, 0xb5,
+  0x01, 0x0f, 0xb8, 0x01, 0x0c, 0xb9, 0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xb9,
+  0x01, 0x0b, 0xb9, 0x01, 0x0b, 0xba, 0x01, 0x09, 0xbc, 0x01, 0x08, 0xbd,
+  0x01, 0x05, 0x86, 0x06, 0x06, 0x03, 0x05, 0xb4, 0x01, 0x07, 0x04, 0x07,
+  0xb1, 0x01, 0x08, 0x03, 0x09, 0xb0, 0x01, 0x07, 0x04, 0x09, 0xaf, 0x01,
+  0x07, 0x04, 0x0b, 0xae, 0x01, 0x07, 0x04, 0x0b, 0xad, 0x01, 0x07, 0x05,
+  0x0c, 0xab, 0x01, 0x08, 0x04, 0x0d, 0xab, 0x01, 0x08, 0x04, 0x0e, 0xa9,
+  0x01, 0x08, 0x05, 0x0e, 0xa9, 0x01, 0x08, 0x05, 0x0f, 0xa7, 0x01, 0x09,
+  0x04, 0x10, 0xa6, 0x01, 0x09, 0x05, 0x11, 0xa5, 0x01, 0x09, 0x06, 0x11,
+  0xa3, 0x01, 0x0a, 0x06, 0x11, 0xa3, 0x01, 0x0a, 0x06, 0x12, 0xa1, 0x01,
+  0x0b, 0x06, 0x12, 0xa0, 0x01, 0x0c, 0x06, 0x13, 0x9f, 0x01, 0x0c, 0x07,
+  0x12, 0x9e, 0x01, 0x0d, 0x07, 0x13, 0x9d, 0x01, 0x0e, 0x07, 0x13, 0x9b,
+  0x01, 0x0f, 0x07, 0x14, 0x99, 0x01, 0x10, 0x08, 0x14, 0x97, 0x01, 0x12,
+  0x08, 0x13, 0x95, 0x01, 0x14, 0x09, 0x13, 0x93, 0x01, 0x15, 0x0a, 0x13,
+  0x90, 0x01, 0x18, 0x09, 0x14, 0x8e, 0x01, 0x19, 0x0a, 0x14, 0x8c, 0x01,
+  0x1b, 0x0a, 0x14, 0x89, 0x01, 0x1e, 0x0a, 0x14, 0x87, 0x01, 0x1f, 0x0c,
+  0x13, 0x84, 0x01, 0x22, 0x0c, 0x13, 0x82, 0x01, 0x24, 0x0c, 0x12, 0x81,
+  0x01, 0x26, 0x0c, 0x12, 0x7e, 0x28, 0x0d, 0x12, 0x7c, 0x2a, 0x0c, 0x13,
+  0x7b, 0x2b, 0x0c, 0x13, 0x79, 0x2c, 0x0d, 0x13, 0x78, 0x2d, 0x0c, 0x14,
+  0x76, 0x2e, 0x0d, 0x14, 0x75, 0x2e, 0x0d, 0x15, 0x73, 0x2f, 0x0e, 0x14,
+  0x73, 0x2f, 0x0e, 0x15, 0x71, 0x30, 0x0e, 0x16, 0x70, 0x30, 0x0e, 0x17,
+  0x6e, 0x30, 0x0f, 0x18, 0x6d, 0x2f, 0x10, 0x19, 0x6b, 0x30, 0x10, 0x1a,
+  0x69, 0x30, 0x11, 0x1b, 0x68, 0x2f, 0x11, 0x1d, 0x66, 0x2f, 0x12, 0x1d,
+  0x66, 0x2e, 0x13, 0x1e, 0x64, 0x2d, 0x14, 0x20, 0x63, 0x2c, 0x15, 0x21,
+  0x61, 0x2b, 0x16, 0x23, 0x60, 0x29, 0x17, 0x24, 0x60, 0x27, 0x18, 0x25,
+  0x60, 0x25, 0x1a, 0x25, 0x60, 0x22, 0x1c, 0x26, 0x61, 0x1f, 0x1d, 0x26,
+  0x63, 0x1b, 0x1f, 0x26, 0x65, 0x17, 0x20, 0x27, 0xa7, 0x45,
+};
+
+#endif
\ No newline at end of file
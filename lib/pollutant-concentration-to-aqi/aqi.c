@@ -18,6 +18,7 @@
  */
 
 #include "aqi.h"
+#include <limits.h>
 #include <math.h>
 #include <stddef.h>
 
@@ -2857,6 +2858,263 @@ int calc_aqi(aqi_scale_t scale,
                                       pm2_5);
 } // end calc_aqi
 
+/* Length of each aqi_window_t, in hours.
+ */
+static const int AQI_WINDOW_HOURS[NUM_AQI_WINDOWS] = {1, 3, 4, 8, 24};
+
+void init_aqi_windows(aqi_windows_t *w,
+             const float co[24],  const float nh3[24],  const float no[24],
+             const float no2[24], const float o3[24],   const float pb[24],
+             const float so2[24], const float pm10[24], const float pm2_5[24])
+{
+  // same order as aqi_pollutant_t enums
+  const float *pollutants[NUM_AQI_POLLUTANTS] =
+  {
+    co, nh3, no, no2, o3, pb, so2, pm10, pm2_5
+  };
+
+  for (int p = 0; p < NUM_AQI_POLLUTANTS; ++p)
+  {
+    const float *conc = pollutants[p];
+    for (int end = 0; end < 24; ++end)
+    {
+      for (int i = 0; i < NUM_AQI_WINDOWS; ++i)
+      {
+        int hours = min(AQI_WINDOW_HOURS[i], end + 1);
+        if (conc == NULL)
+        {
+          w->avg[p][end][i] = 0.f;
+          continue;
+        }
+
+        // summed in the same order as avg_conc, so the averages are the same
+        // floats
+        float avg = 0;
+        for (int h = end - (hours - 1) ; h <= end ; ++h)
+        {
+          avg += conc[h];
+        }
+        w->avg[p][end][i] = avg / (float) hours;
+      }
+    }
+  }
+  return;
+} // end init_aqi_windows
+
+/* Each scale reads the window averages it needs, ending at hour 'end'.
+ */
+static int windows_australia_aqi(const aqi_windows_t *w, int end)
+{
+  float co_8h     = window_avg_conc(w, AQI_CO,    end, AQI_8H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float o3_4h     = window_avg_conc(w, AQI_O3,    end, AQI_4H);
+  float so2_1h    = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return australia_aqi(co_8h, no2_1h, o3_1h, o3_4h, so2_1h, pm10_24h,
+                       pm2_5_24h);
+} // end windows_australia_aqi
+
+static int windows_canada_aqhi(const aqi_windows_t *w, int end)
+{
+  float no2_3h    = window_avg_conc(w, AQI_NO2,   end, AQI_3H);
+  float o3_3h     = window_avg_conc(w, AQI_O3,    end, AQI_3H);
+  float pm2_5_3h  = window_avg_conc(w, AQI_PM2_5, end, AQI_3H);
+  return canada_aqhi(no2_3h, o3_3h, pm2_5_3h);
+} // end windows_canada_aqhi
+
+static int windows_china_aqi(const aqi_windows_t *w, int end)
+{
+  float co_1h     = window_avg_conc(w, AQI_CO,    end, AQI_1H);
+  float co_24h    = window_avg_conc(w, AQI_CO,    end, AQI_24H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float no2_24h   = window_avg_conc(w, AQI_NO2,   end, AQI_24H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  float so2_1h    = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float so2_24h   = window_avg_conc(w, AQI_SO2,   end, AQI_24H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return china_aqi(co_1h, co_24h, no2_1h, no2_24h, o3_1h, o3_8h, so2_1h,
+                   so2_24h, pm10_24h, pm2_5_24h);
+} // end windows_china_aqi
+
+static int windows_european_union_caqi(const aqi_windows_t *w, int end)
+{
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float pm10_1h   = window_avg_conc(w, AQI_PM10,  end, AQI_1H);
+  float pm2_5_1h  = window_avg_conc(w, AQI_PM2_5, end, AQI_1H);
+  return european_union_caqi(no2_1h, o3_1h, pm10_1h, pm2_5_1h);
+} // end windows_european_union_caqi
+
+static int windows_hong_kong_aqhi(const aqi_windows_t *w, int end)
+{
+  float no2_3h    = window_avg_conc(w, AQI_NO2,   end, AQI_3H);
+  float o3_3h     = window_avg_conc(w, AQI_O3,    end, AQI_3H);
+  float so2_3h    = window_avg_conc(w, AQI_SO2,   end, AQI_3H);
+  float pm10_3h   = window_avg_conc(w, AQI_PM10,  end, AQI_3H);
+  float pm2_5_3h  = window_avg_conc(w, AQI_PM2_5, end, AQI_3H);
+  return hong_kong_aqhi(no2_3h,  o3_3h, so2_3h, pm10_3h, pm2_5_3h);
+} // end windows_hong_kong_aqhi
+
+static int windows_india_aqi(const aqi_windows_t *w, int end)
+{
+  float co_8h     = window_avg_conc(w, AQI_CO,    end, AQI_8H);
+  float nh3_24h   = window_avg_conc(w, AQI_NH3,   end, AQI_24H);
+  float no2_24h   = window_avg_conc(w, AQI_NO2,   end, AQI_24H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  float pb_24h    = window_avg_conc(w, AQI_PB,    end, AQI_24H);
+  float so2_24h   = window_avg_conc(w, AQI_SO2,   end, AQI_24H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return india_aqi(co_8h, nh3_24h, no2_24h, o3_8h, pb_24h, so2_24h, pm10_24h,
+                   pm2_5_24h);
+} // end windows_india_aqi
+
+static int windows_singapore_psi(const aqi_windows_t *w, int end)
+{
+  float co_8h     = window_avg_conc(w, AQI_CO,    end, AQI_8H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  float so2_24h   = window_avg_conc(w, AQI_SO2,   end, AQI_24H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return singapore_psi(co_8h, no2_1h, o3_1h, o3_8h, so2_24h, pm10_24h,
+                       pm2_5_24h);
+} // end windows_singapore_psi
+
+static int windows_south_korea_cai(const aqi_windows_t *w, int end)
+{
+  float co_1h     = window_avg_conc(w, AQI_CO,    end, AQI_1H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float so2_1h    = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return south_korea_cai(co_1h, no2_1h, o3_1h, so2_1h, pm10_24h, pm2_5_24h);
+} // end windows_south_korea_cai
+
+static int windows_united_kingdom_daqi(const aqi_windows_t *w, int end)
+{
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  // USING LAST HOURLY CONCENTRATION!!!
+  float so2_15min = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return united_kingdom_daqi(no2_1h, o3_8h, so2_15min, pm10_24h, pm2_5_24h);
+} // end windows_united_kingdom_daqi
+
+static int windows_united_states_aqi(const aqi_windows_t *w, int end)
+{
+  float co_8h     = window_avg_conc(w, AQI_CO,    end, AQI_8H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  float so2_1h    = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float so2_24h   = window_avg_conc(w, AQI_SO2,   end, AQI_24H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+  return united_states_aqi(co_8h, no2_1h, o3_1h, o3_8h, so2_1h, so2_24h,
+                           pm10_24h, pm2_5_24h);
+} // end windows_united_states_aqi
+
+/* Fast lookup for windows_* functions. Organized alphabetically
+ * (same order as aqi_scale_t enums).
+ */
+static int (*WINDOWS_AQI_LOOKUP_TABLE[NUM_AQI_SCALES])(const aqi_windows_t *,
+                                                       int) = {
+  windows_australia_aqi,
+  windows_canada_aqhi,
+  windows_china_aqi,
+  windows_european_union_caqi,
+  windows_hong_kong_aqhi,
+  windows_india_aqi,
+  windows_singapore_psi,
+  windows_south_korea_cai,
+  windows_united_kingdom_daqi,
+  windows_united_states_aqi,
+};
+
+int calc_aqi_windows(aqi_scale_t scale, const aqi_windows_t *w)
+{
+  return WINDOWS_AQI_LOOKUP_TABLE[scale](w, 24 - 1);
+} // end calc_aqi_windows
+
+void calc_aqi_series(aqi_scale_t scale, const aqi_windows_t *w,
+                     int series[24])
+{
+  for (int h = 0; h < 24; ++h)
+  {
+    series[h] = WINDOWS_AQI_LOOKUP_TABLE[scale](w, h);
+  }
+  return;
+} // end calc_aqi_series
+
+void calc_aqi_all(const aqi_windows_t *w, aqi_all_t *aqi)
+{
+  // every window any scale averages over
+  const int end = 24 - 1;
+  float co_1h     = window_avg_conc(w, AQI_CO,    end, AQI_1H);
+  float co_8h     = window_avg_conc(w, AQI_CO,    end, AQI_8H);
+  float co_24h    = window_avg_conc(w, AQI_CO,    end, AQI_24H);
+  float nh3_24h   = window_avg_conc(w, AQI_NH3,   end, AQI_24H);
+  float no2_1h    = window_avg_conc(w, AQI_NO2,   end, AQI_1H);
+  float no2_3h    = window_avg_conc(w, AQI_NO2,   end, AQI_3H);
+  float no2_24h   = window_avg_conc(w, AQI_NO2,   end, AQI_24H);
+  float o3_1h     = window_avg_conc(w, AQI_O3,    end, AQI_1H);
+  float o3_3h     = window_avg_conc(w, AQI_O3,    end, AQI_3H);
+  float o3_4h     = window_avg_conc(w, AQI_O3,    end, AQI_4H);
+  float o3_8h     = window_avg_conc(w, AQI_O3,    end, AQI_8H);
+  float pb_24h    = window_avg_conc(w, AQI_PB,    end, AQI_24H);
+  float so2_1h    = window_avg_conc(w, AQI_SO2,   end, AQI_1H);
+  float so2_3h    = window_avg_conc(w, AQI_SO2,   end, AQI_3H);
+  float so2_24h   = window_avg_conc(w, AQI_SO2,   end, AQI_24H);
+  float pm10_1h   = window_avg_conc(w, AQI_PM10,  end, AQI_1H);
+  float pm10_3h   = window_avg_conc(w, AQI_PM10,  end, AQI_3H);
+  float pm10_24h  = window_avg_conc(w, AQI_PM10,  end, AQI_24H);
+  float pm2_5_1h  = window_avg_conc(w, AQI_PM2_5, end, AQI_1H);
+  float pm2_5_3h  = window_avg_conc(w, AQI_PM2_5, end, AQI_3H);
+  float pm2_5_24h = window_avg_conc(w, AQI_PM2_5, end, AQI_24H);
+
+  int v[NUM_AQI_SCALES];
+  v[AUSTRALIA_AQI] =
+    australia_aqi(co_8h, no2_1h, o3_1h, o3_4h, so2_1h, pm10_24h, pm2_5_24h);
+  v[CANADA_AQHI] =
+    canada_aqhi(no2_3h, o3_3h, pm2_5_3h);
+  v[CHINA_AQI] =
+    china_aqi(co_1h, co_24h, no2_1h, no2_24h, o3_1h, o3_8h, so2_1h, so2_24h,
+              pm10_24h, pm2_5_24h);
+  v[EUROPEAN_UNION_CAQI] =
+    european_union_caqi(no2_1h, o3_1h, pm10_1h, pm2_5_1h);
+  v[HONG_KONG_AQHI] =
+    hong_kong_aqhi(no2_3h, o3_3h, so2_3h, pm10_3h, pm2_5_3h);
+  v[INDIA_AQI] =
+    india_aqi(co_8h, nh3_24h, no2_24h, o3_8h, pb_24h, so2_24h, pm10_24h,
+              pm2_5_24h);
+  v[SINGAPORE_PSI] =
+    singapore_psi(co_8h, no2_1h, o3_1h, o3_8h, so2_24h, pm10_24h, pm2_5_24h);
+  v[SOUTH_KOREA_CAI] =
+    south_korea_cai(co_1h, no2_1h, o3_1h, so2_1h, pm10_24h, pm2_5_24h);
+  // USING LAST HOURLY CONCENTRATION!!!
+  v[UNITED_KINGDOM_DAQI] =
+    united_kingdom_daqi(no2_1h, o3_8h, so2_1h, pm10_24h, pm2_5_24h);
+  v[UNITED_STATES_AQI] =
+    united_states_aqi(co_8h, no2_1h, o3_1h, o3_8h, so2_1h, so2_24h, pm10_24h,
+                      pm2_5_24h);
+
+  // Only the unbounded scales of Australia and Canada can get past the range
+  // of a short, and only with absurd concentrations.
+  for (int i = 0; i < NUM_AQI_SCALES; ++i)
+  {
+    aqi->val[i] = (short) min(v[i], SHRT_MAX);
+  }
+  return;
+} // end calc_aqi_all
+
 /* Fast lookup for AQI scale max values. Organized alphabetically
  * (same order as aqi_scale_t enums).
  */
@@ -166,6 +166,88 @@ int calc_aqi(aqi_scale_t scale,
              const float no2[24], const float o3[24],   const float pb[24],
              const float so2[24], const float pm10[24], const float pm2_5[24]);
 
+/* Average concentrations of every pollutant over every window the scales use,
+ * ending at each of the last 24 hours, so that the scales (and the AQI at any
+ * of the last 24 hours) only read a table. Build once with init_aqi_windows
+ * and share between scales.
+ *
+ * Windows are summed in the same order as avg_conc, so window_avg_conc returns
+ * exactly the same float as avg_conc for the same hours.
+ */
+typedef enum {
+  AQI_CO,
+  AQI_NH3,
+  AQI_NO,
+  AQI_NO2,
+  AQI_O3,
+  AQI_PB,
+  AQI_SO2,
+  AQI_PM10,
+  AQI_PM2_5,
+  NUM_AQI_POLLUTANTS
+} aqi_pollutant_t;
+
+/* Averaging periods used by the scales. (the UK DAQI's 15 minute so2 average
+ * uses the hourly concentration)
+ */
+typedef enum {
+  AQI_1H,
+  AQI_3H,
+  AQI_4H,
+  AQI_8H,
+  AQI_24H,
+  NUM_AQI_WINDOWS
+} aqi_window_t;
+
+typedef struct {
+  // avg[p][end][window] is the average over the window ending at hour 'end'
+  // (23 is the most recent), 0 if the pollutant is unavailable
+  float avg[NUM_AQI_POLLUTANTS][24][NUM_AQI_WINDOWS];
+} aqi_windows_t;
+
+/* Averages hourly pollutant concentrations, organized like the arguments of
+ * calc_aqi, over every window. Pass NULL for unavailable pollutants. Windows
+ * that would reach before hour 0 are shortened to the hours available.
+ */
+void init_aqi_windows(aqi_windows_t *w,
+             const float co[24],  const float nh3[24],  const float no[24],
+             const float no2[24], const float o3[24],   const float pb[24],
+             const float so2[24], const float pm10[24], const float pm2_5[24]);
+
+/* Returns the average concentration of a pollutant over a window ending at
+ * hour 'end' (0 to 23, 23 is the most recent).
+ */
+static inline float window_avg_conc(const aqi_windows_t *w,
+                                    aqi_pollutant_t pollutant, int end,
+                                    aqi_window_t window)
+{
+  return w->avg[pollutant][end][window];
+}
+
+/* Same as calc_aqi, using concentrations from init_aqi_windows.
+ */
+int calc_aqi_windows(aqi_scale_t scale, const aqi_windows_t *w);
+
+/* Fills 'series' with the Air Quality Index as it was at each of the last 24
+ * hours, least recent first, e.g. to draw the trend. series[23] is the same as
+ * calc_aqi_windows. The earliest hours have less history than some scales
+ * average over, their windows are shortened (see window_avg_conc).
+ */
+void calc_aqi_series(aqi_scale_t scale, const aqi_windows_t *w,
+                     int series[24]);
+
+/* Air Quality Index of every scale, indexed by aqi_scale_t.
+ */
+typedef struct {
+  short val[NUM_AQI_SCALES];
+} aqi_all_t;
+
+/* Evaluates every scale at once, the same as calling calc_aqi_windows for
+ * each of them, but the window averages the scales have in common are only
+ * read once. Values past the range of a short are stored as SHRT_MAX.
+ */
+void calc_aqi_all(const aqi_windows_t *w, aqi_all_t *aqi);
+
 /* Each AQI scale has a maximum value, above which AQI is typically denoted by
  * ">{AQI_MAX}" or "{AQI_MAX}+".
  */
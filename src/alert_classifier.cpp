@@ -0,0 +1,97 @@
+/* Alert terminology matcher for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like unicode_font.cpp this file has no Arduino or ESP-IDF dependencies, so
+// the matcher can be checked and timed on the host.
+
+#include "alert_classifier.h"
+
+/* Returns the child of node n on byte c, or ALERT_MATCHER_ROOT.
+ */
+static inline uint16_t findChild(const alert_matcher_t &m, uint16_t n,
+                                 uint8_t c)
+{
+  if (n == ALERT_MATCHER_ROOT)
+  {
+    return m.root[c];
+  }
+  for (uint16_t i = m.nodes[n].child; i != ALERT_MATCHER_ROOT;
+       i = m.nodes[i].sibling)
+  {
+    if (m.nodes[i].ch == c)
+    {
+      return i;
+    }
+  }
+  return ALERT_MATCHER_ROOT;
+} // end findChild
+
+/* Returns the state after reading byte c in state n. ASCII letters are matched
+ * as lowercase, like the locale terminology.
+ */
+static inline uint16_t stepAlertMatcher(const alert_matcher_t &m, uint16_t n,
+                                        uint8_t c)
+{
+  if (c >= 'A' && c <= 'Z')
+  {
+    c += 'a' - 'A';
+  }
+  uint16_t next = findChild(m, n, c);
+  while (next == ALERT_MATCHER_ROOT && n != ALERT_MATCHER_ROOT)
+  {
+    n = m.nodes[n].fail;
+    next = findChild(m, n, c);
+  }
+  return next;
+} // end stepAlertMatcher
+
+/* Returns the union of the masks of all terms that text contains.
+ *
+ * Only the bits in tailMask are collected from terms that end past the first
+ * head bytes of text, e.g. to match one set of terms against the whole text
+ * and another against a prefix of it in the same pass.
+ */
+uint32_t matchAlertTerms(const alert_matcher_t &m, const char *text,
+                         size_t len, size_t head, uint32_t tailMask)
+{
+  uint32_t found = 0;
+  uint16_t n = ALERT_MATCHER_ROOT;
+  for (size_t i = 0; i < len; ++i)
+  {
+    n = stepAlertMatcher(m, n, static_cast<uint8_t>(text[i]));
+    found |= m.nodes[n].mask & (i < head ? UINT32_MAX : tailMask);
+  }
+  return found;
+} // end matchAlertTerms
+
+/* Returns the union of the masks of all terms found in text that arrives in
+ * pieces. state starts as ALERT_MATCHER_ROOT and carries terms that span
+ * pieces over to the next call.
+ */
+uint32_t feedAlertTerms(const alert_matcher_t &m, uint16_t &state,
+                        const char *text, size_t len)
+{
+  uint32_t found = 0;
+  uint16_t n = state;
+  for (size_t i = 0; i < len; ++i)
+  {
+    n = stepAlertMatcher(m, n, static_cast<uint8_t>(text[i]));
+    found |= m.nodes[n].mask;
+  }
+  state = n;
+  return found;
+} // end feedAlertTerms
@@ -0,0 +1,638 @@
+/* Streaming alerts parser for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like alert_classifier.cpp this file has no Arduino or ESP-IDF dependencies,
+// so the parser can be checked on the host with large responses.
+
+#include <cstring>
+
+#include "alerts_parser.h"
+
+// lexer states
+enum
+{
+  LEX_VALUE,      // between tokens
+  LEX_STRING,
+  LEX_ESCAPE,     // after a backslash in a string
+  LEX_UNICODE,    // reading the digits of \uXXXX
+  LEX_SCALAR,     // number, true, false or null
+  LEX_END         // the top-level value is complete
+};
+
+// destinations of string contents
+enum
+{
+  SINK_NONE,
+  SINK_KEY,       // member name, to p.buf
+  SINK_TEXT,      // kept, to the text arena
+  SINK_TERMS      // description, through the alert terminology matcher
+};
+
+// member names that matter
+enum
+{
+  KEY_OTHER,
+  KEY_ALERTS,
+  KEY_EVENT,
+  KEY_START,
+  KEY_TAGS,
+  KEY_DESCRIPTION
+};
+
+static const struct
+{
+  const char *name;
+  uint8_t     key;
+} KEYS[] = {
+  {"alerts",      KEY_ALERTS},
+  {"event",       KEY_EVENT},
+  {"start",       KEY_START},
+  {"tags",        KEY_TAGS},
+  {"description", KEY_DESCRIPTION},
+};
+
+/* Returns true if the innermost container is the top-level "alerts" array.
+ */
+static inline bool inAlertsArray(const alerts_parser_t &p)
+{
+  return p.depth == 2
+      && p.frame[0].object && p.frame[0].key == KEY_ALERTS
+      && !p.frame[1].object;
+} // end inAlertsArray
+
+/* Returns true if the innermost container is an alert object.
+ */
+static inline bool inAlert(const alerts_parser_t &p)
+{
+  return p.depth == 3
+      && p.frame[0].object && p.frame[0].key == KEY_ALERTS
+      && !p.frame[1].object && p.frame[2].object;
+} // end inAlert
+
+/* Returns true if the innermost container is the "tags" array of an alert.
+ */
+static inline bool inTags(const alerts_parser_t &p)
+{
+  return p.depth == 4
+      && p.frame[0].object && p.frame[0].key == KEY_ALERTS
+      && !p.frame[1].object && p.frame[2].object
+      && p.frame[2].key == KEY_TAGS && !p.frame[3].object;
+} // end inTags
+
+/* Sets up a parser that stores the alerts it reads in alerts. Descriptions
+ * are matched against terms, if not nullptr, and the union of the masks of
+ * the terms found is stored in owm_alerts_t::description_terms.
+ */
+void initAlertsParser(alerts_parser_t &p, owm_resp_alerts_t &alerts,
+                      const alert_matcher_t *terms)
+{
+  memset(&p, 0, sizeof(p));
+  p.alerts = &alerts;
+  p.terms  = terms;
+  p.status = ALERTS_PARSE_MORE;
+  p.lex    = LEX_VALUE;
+  p.sink   = SINK_NONE;
+  p.alert  = -1;
+
+  alerts.count     = 0;
+  alerts.text[0]   = '\0';
+  alerts.text_used = 1;
+  return;
+} // end initAlertsParser
+
+/* Passes string contents to the current sink.
+ */
+static void emit(alerts_parser_t &p, const char *s, size_t n)
+{
+  switch (p.sink)
+  {
+  case SINK_KEY:
+    if (p.buf_len + n < sizeof(p.buf))
+    {
+      memcpy(p.buf + p.buf_len, s, n);
+      p.buf_len += n;
+    }
+    else
+    { // too long to be a member name that matters
+      p.buf_len = sizeof(p.buf);
+    }
+    break;
+  case SINK_TEXT:
+  {
+    owm_resp_alerts_t &a = *p.alerts;
+    size_t room = p.text_end - a.text_used;
+    if (n > room)
+    {
+      n = room;
+      p.text_truncated = true;
+    }
+    memcpy(a.text + a.text_used, s, n);
+    a.text_used += n;
+    break;
+  }
+  case SINK_TERMS:
+    p.alerts->alert[p.alert].description_terms |=
+      feedAlertTerms(*p.terms, p.term_state, s, n);
+    break;
+  default:
+    break;
+  }
+  return;
+} // end emit
+
+/* Passes a code point from a \u escape to the current sink, as UTF-8.
+ */
+static void emitCodepoint(alerts_parser_t &p, uint32_t cp)
+{
+  char u[4];
+  size_t n;
+  if (cp < 0x80)
+  {
+    u[0] = cp;
+    n = 1;
+  }
+  else if (cp < 0x800)
+  {
+    u[0] = 0xc0 | (cp >> 6);
+    u[1] = 0x80 | (cp & 0x3f);
+    n = 2;
+  }
+  else if (cp < 0x10000)
+  {
+    u[0] = 0xe0 | (cp >> 12);
+    u[1] = 0x80 | ((cp >> 6) & 0x3f);
+    u[2] = 0x80 | (cp & 0x3f);
+    n = 3;
+  }
+  else
+  {
+    u[0] = 0xf0 | (cp >> 18);
+    u[1] = 0x80 | ((cp >> 12) & 0x3f);
+    u[2] = 0x80 | ((cp >> 6) & 0x3f);
+    u[3] = 0x80 | (cp & 0x3f);
+    n = 4;
+  }
+  emit(p, u, n);
+  return;
+} // end emitCodepoint
+
+/* Passes the code point of a complete \uXXXX escape on, pairing surrogates.
+ * Unpaired surrogates become U+FFFD.
+ */
+static void emitEscapedUnit(alerts_parser_t &p, uint32_t unit)
+{
+  if (p.high_surrogate != 0)
+  {
+    if (unit >= 0xdc00 && unit <= 0xdfff)
+    {
+      emitCodepoint(p, 0x10000 + ((p.high_surrogate - 0xd800) << 10)
+                       + (unit - 0xdc00));
+      p.high_surrogate = 0;
+      return;
+    }
+    emitCodepoint(p, 0xfffd);
+    p.high_surrogate = 0;
+  }
+  if (unit >= 0xd800 && unit <= 0xdbff)
+  {
+    p.high_surrogate = unit;
+  }
+  else if (unit >= 0xdc00 && unit <= 0xdfff)
+  {
+    emitCodepoint(p, 0xfffd);
+  }
+  else
+  {
+    emitCodepoint(p, unit);
+  }
+  return;
+} // end emitEscapedUnit
+
+/* Flushes a high surrogate that was not followed by an escaped low one.
+ */
+static inline void flushSurrogate(alerts_parser_t &p)
+{
+  if (p.high_surrogate != 0)
+  {
+    emitCodepoint(p, 0xfffd);
+    p.high_surrogate = 0;
+  }
+  return;
+} // end flushSurrogate
+
+/* Starts storing a string in the text arena, at most maxLen bytes of it.
+ */
+static void startText(alerts_parser_t &p, uint16_t &field, size_t maxLen)
+{
+  owm_resp_alerts_t &a = *p.alerts;
+  if (a.text_used >= OWM_ALERTS_TEXT_SIZE - 1)
+  {
+    field = 0; // the empty string
+    return;
+  }
+  const size_t room = OWM_ALERTS_TEXT_SIZE - 1 - a.text_used;
+  field             = a.text_used;
+  p.text_field      = &field;
+  p.text_end        = a.text_used + (maxLen < room ? maxLen : room);
+  p.text_truncated  = false;
+  p.text_arena_full = room < maxLen;
+  p.sink            = SINK_TEXT;
+  return;
+} // end startText
+
+/* Terminates the string being stored. A truncated string is cut before its
+ * last character if that character is incomplete.
+ *
+ * Notes whether the event name of the alert was stored, event names that are
+ * cut short by a full arena do not count.
+ */
+static void endText(alerts_parser_t &p)
+{
+  owm_resp_alerts_t &a = *p.alerts;
+  uint16_t end = a.text_used;
+  if (p.text_truncated && end > *p.text_field)
+  {
+    uint16_t lead = end - 1;
+    while (lead > *p.text_field
+        && (static_cast<uint8_t>(a.text[lead]) & 0xc0) == 0x80)
+    {
+      --lead;
+    }
+    const uint8_t c = a.text[lead];
+    const int len = c < 0x80           ? 1
+                  : (c & 0xe0) == 0xc0 ? 2
+                  : (c & 0xf0) == 0xe0 ? 3
+                  : (c & 0xf8) == 0xf0 ? 4
+                  : 1;
+    if (lead + len > end)
+    {
+      end = lead;
+    }
+  }
+  a.text[end] = '\0';
+  a.text_used = end + 1;
+  if (p.text_field == &a.alert[p.alert].event)
+  {
+    p.event_stored = end > *p.text_field
+                     && !(p.text_truncated && p.text_arena_full);
+  }
+  return;
+} // end endText
+
+/* Counts a value that starts in the innermost container.
+ *
+ * Returns the index of the value if the container is an array.
+ */
+static unsigned beginValue(alerts_parser_t &p)
+{
+  if (p.depth == 0 || p.frame[p.depth - 1].object)
+  {
+    return 0;
+  }
+  alerts_parser_frame_t &f = p.frame[p.depth - 1];
+  const unsigned index = f.items;
+  if (f.items < UINT8_MAX)
+  {
+    ++f.items;
+  }
+  return index;
+} // end beginValue
+
+/* Called at the opening quote of a string.
+ */
+static void beginString(alerts_parser_t &p)
+{
+  p.lex = LEX_STRING;
+  p.sink = SINK_NONE;
+  p.high_surrogate = 0;
+  if (p.depth == 0)
+  {
+    return;
+  }
+  alerts_parser_frame_t &f = p.frame[p.depth - 1];
+  if (f.object && f.expect_key)
+  {
+    p.sink = SINK_KEY;
+    p.buf_len = 0;
+    return;
+  }
+
+  const unsigned index = beginValue(p);
+  if (p.alert < 0)
+  {
+    return;
+  }
+  owm_alerts_t &alert = p.alerts->alert[p.alert];
+  if (inAlert(p) && f.key == KEY_EVENT)
+  {
+    startText(p, alert.event, OWM_ALERT_EVENT_LEN);
+  }
+  else if (inAlert(p) && f.key == KEY_DESCRIPTION && p.terms != nullptr)
+  {
+    p.sink = SINK_TERMS;
+    p.term_state = ALERT_MATCHER_ROOT;
+  }
+  else if (inTags(p) && index == 0)
+  {
+    startText(p, alert.tags, OWM_ALERT_TAG_LEN);
+  }
+  return;
+} // end beginString
+
+/* Called at the closing quote of a string.
+ */
+static void endString(alerts_parser_t &p)
+{
+  flushSurrogate(p);
+  if (p.sink == SINK_KEY)
+  {
+    alerts_parser_frame_t &f = p.frame[p.depth - 1];
+    f.key = KEY_OTHER;
+    f.expect_key = false;
+    for (const auto &k : KEYS)
+    {
+      if (p.buf_len == strlen(k.name)
+       && memcmp(p.buf, k.name, p.buf_len) == 0)
+      {
+        f.key = k.key;
+        break;
+      }
+    }
+  }
+  else if (p.sink == SINK_TEXT)
+  {
+    endText(p);
+  }
+  p.sink = SINK_NONE;
+  p.lex = LEX_VALUE;
+  return;
+} // end endString
+
+/* Called after the last character of a number, true, false or null.
+ */
+static void endScalar(alerts_parser_t &p)
+{
+  p.lex = LEX_VALUE;
+  if (p.alert < 0 || !inAlert(p) || p.frame[2].key != KEY_START)
+  {
+    return;
+  }
+  int64_t v = 0;
+  bool negative = p.buf_len > 0 && p.buf[0] == '-';
+  for (uint8_t i = negative ? 1 : 0; i < p.buf_len; ++i)
+  {
+    if (p.buf[i] < '0' || p.buf[i] > '9')
+    {
+      break;
+    }
+    v = v * 10 + (p.buf[i] - '0');
+  }
+  p.alerts->alert[p.alert].start = negative ? -v : v;
+  return;
+} // end endScalar
+
+/* Handles a byte between tokens.
+ *
+ * Returns false if the input is invalid.
+ */
+static bool structural(alerts_parser_t &p, char c)
+{
+  switch (c)
+  {
+  case ' ': case '\t': case '\n': case '\r':
+  case ':':
+    return true;
+  case ',':
+    if (p.depth == 0)
+    {
+      return false;
+    }
+    if (p.frame[p.depth - 1].object)
+    {
+      p.frame[p.depth - 1].expect_key = true;
+    }
+    return true;
+  case '"':
+    beginString(p);
+    return true;
+  case '{':
+  case '[':
+  {
+    if (p.depth > 0 && p.frame[p.depth - 1].object
+     && p.frame[p.depth - 1].expect_key)
+    {
+      return false;
+    }
+    if (p.depth == ALERTS_PARSER_MAX_DEPTH)
+    {
+      p.status = ALERTS_PARSE_TOO_DEEP;
+      return false;
+    }
+    beginValue(p);
+    if (c == '{' && inAlertsArray(p))
+    {
+      owm_resp_alerts_t &a = *p.alerts;
+      p.alert = -1;
+      if (a.count < OWM_NUM_ALERTS)
+      {
+        p.alert = a.count++;
+        a.alert[p.alert] = owm_alerts_t{};
+        p.alert_text = a.text_used;
+        p.event_stored = false;
+      }
+    }
+    alerts_parser_frame_t &f = p.frame[p.depth++];
+    f.object     = c == '{';
+    f.expect_key = c == '{';
+    f.key        = KEY_OTHER;
+    f.items      = 0;
+    return true;
+  }
+  case '}':
+  case ']':
+    if (p.depth == 0 || p.frame[p.depth - 1].object != (c == '}'))
+    {
+      return false;
+    }
+    if (c == '}' && inAlert(p))
+    {
+      if (p.alert >= 0 && !p.event_stored)
+      {
+        // nothing to draw, give its slot and text to the next alert
+        owm_resp_alerts_t &a = *p.alerts;
+        --a.count;
+        a.text_used = p.alert_text;
+      }
+      p.alert = -1;
+    }
+    if (--p.depth == 0)
+    {
+      p.lex = LEX_END;
+      p.status = ALERTS_PARSE_DONE;
+    }
+    return true;
+  default:
+    if (p.depth == 0)
+    {
+      return false;
+    }
+    beginValue(p);
+    p.lex = LEX_SCALAR;
+    p.buf[0] = c;
+    p.buf_len = 1;
+    return true;
+  }
+} // end structural
+
+/* Parses the next piece of a One Call response. Pieces may end anywhere, in
+ * the middle of a string or an escape sequence.
+ *
+ * Returns ALERTS_PARSE_MORE until the response is complete or invalid.
+ */
+alerts_parse_status_t feedAlertsParser(alerts_parser_t &p, const char *data,
+                                       size_t len)
+{
+  size_t i = 0;
+  while (i < len && p.status == ALERTS_PARSE_MORE)
+  {
+    const char c = data[i];
+    switch (p.lex)
+    {
+    case LEX_VALUE:
+      if (!structural(p, c))
+      {
+        if (p.status == ALERTS_PARSE_MORE)
+        {
+          p.status = ALERTS_PARSE_INVALID;
+        }
+        return p.status;
+      }
+      ++i;
+      break;
+
+    case LEX_STRING:
+    {
+      // pass on everything up to the next quote or backslash at once
+      size_t j = i;
+      while (j < len && data[j] != '"' && data[j] != '\\')
+      {
+        ++j;
+      }
+      if (j > i)
+      {
+        flushSurrogate(p);
+        emit(p, data + i, j - i);
+      }
+      i = j;
+      if (i < len)
+      {
+        if (data[i] == '"')
+        {
+          endString(p);
+        }
+        else
+        {
+          p.lex = LEX_ESCAPE;
+        }
+        ++i;
+      }
+      break;
+    }
+
+    case LEX_ESCAPE:
+    {
+      char e;
+      switch (c)
+      {
+      case '"':  e = '"';  break;
+      case '\\': e = '\\'; break;
+      case '/':  e = '/';  break;
+      case 'b':  e = '\b'; break;
+      case 'f':  e = '\f'; break;
+      case 'n':  e = '\n'; break;
+      case 'r':  e = '\r'; break;
+      case 't':  e = '\t'; break;
+      case 'u':  e = 0;    break;
+      default:
+        p.status = ALERTS_PARSE_INVALID;
+        return p.status;
+      }
+      if (e == 0)
+      {
+        p.lex = LEX_UNICODE;
+        p.unicode = 0;
+        p.unicode_digits = 0;
+      }
+      else
+      {
+        flushSurrogate(p);
+        emit(p, &e, 1);
+        p.lex = LEX_STRING;
+      }
+      ++i;
+      break;
+    }
+
+    case LEX_UNICODE:
+    {
+      int digit;
+      if (c >= '0' && c <= '9')
+      {
+        digit = c - '0';
+      }
+      else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+      {
+        digit = (c | 0x20) - 'a' + 10;
+      }
+      else
+      {
+        p.status = ALERTS_PARSE_INVALID;
+        return p.status;
+      }
+      p.unicode = (p.unicode << 4) | digit;
+      if (++p.unicode_digits == 4)
+      {
+        emitEscapedUnit(p, p.unicode);
+        p.lex = LEX_STRING;
+      }
+      ++i;
+      break;
+    }
+
+    case LEX_SCALAR:
+      if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t'
+       || c == '\n' || c == '\r')
+      {
+        endScalar(p); // c is handled as LEX_VALUE
+      }
+      else
+      {
+        if (p.buf_len < sizeof(p.buf))
+        {
+          p.buf[p.buf_len++] = c;
+        }
+        ++i;
+      }
+      break;
+
+    default: // LEX_END
+      i = len;
+      break;
+    }
+  }
+  return p.status;
+} // end feedAlertsParser
@@ -15,21 +15,29 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "_locale.h"
 #include "api_response.h"
 #include "config.h"
+#include "display_utils.h"
+#include "tlog.h"
 #include <ArduinoJson.h>
+#include <algorithm>
 #include <vector>
 
 DeserializationError deserializeOneCall(WiFiClient &json,
                                         owm_resp_onecall_t &r) {
   int i;
 
+#if DEBUG_LEVEL >= 1
+  // 缓冲区需要一整块连续内存，最大可分配块小于128KB时分配失败
+  TLOG("[debug] Max Allocatable : %u B", ESP.getMaxAllocHeap());
+#endif
   // 使用更大的缓冲区来解析JSON
   DynamicJsonDocument doc(131072); // 128KB，进一步增加缓冲区大小
 
   DeserializationError error = deserializeJson(doc, json);
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] doc.overflowed() : " + String(doc.overflowed()));
+  TLOG("[debug] doc.overflowed() : %d", doc.overflowed());
 #endif
 #if DEBUG_LEVEL >= 2
   serializeJsonPretty(doc, Serial);
@@ -347,7 +355,7 @@ DeserializationError deserializeAirQuality(WiFiClient &json,
 
   DeserializationError error = deserializeJson(doc, json);
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] doc.overflowed() : " + String(doc.overflowed()));
+  TLOG("[debug] doc.overflowed() : %d", doc.overflowed());
 #endif
 #if DEBUG_LEVEL >= 2
   serializeJsonPretty(doc, Serial);
@@ -380,5 +388,55 @@ DeserializationError deserializeAirQuality(WiFiClient &json,
     ++i;
   }
 
+  // 滑动窗口只计算一次，各AQI标准共用；OWM不提供铅(pb)浓度
+  const owm_components_t &c = r.components;
+  init_aqi_windows(&r.windows, c.co, c.nh3, c.no, c.no2, c.o3, NULL, c.so2,
+                   c.pm10, c.pm2_5);
+
   return error;
-} // end deserializeAirQuality
\ No newline at end of file
+} // end deserializeAirQuality
+
+DeserializationError deserializeAlerts(WiFiClient &json,
+                                       owm_resp_alerts_t &r) {
+  // 逐块解析，不缓存整个响应；描述只经过预警术语匹配，不保存
+  alerts_parser_t parser;
+  initAlertsParser(parser, r, &ALERT_MATCHER);
+
+  char buf[256];
+  unsigned long lastRx = millis();
+  alerts_parse_status_t status = ALERTS_PARSE_MORE;
+  while (status == ALERTS_PARSE_MORE) {
+    int n = json.available();
+    if (n > 0) {
+      n = json.read(reinterpret_cast<uint8_t *>(buf),
+                    std::min(n, static_cast<int>(sizeof(buf))));
+      if (n > 0) {
+        status = feedAlertsParser(parser, buf, n);
+        lastRx = millis();
+      }
+    } else if (!json.connected() ||
+               millis() - lastRx > HTTP_CLIENT_TCP_TIMEOUT) {
+      break;
+    } else {
+      delay(1);
+    }
+  }
+#if DEBUG_LEVEL >= 1
+  TLOG("[debug] alerts           : %d, %u B text", r.count,
+       static_cast<unsigned>(r.text_used));
+#endif
+
+  switch (status) {
+  case ALERTS_PARSE_DONE:
+    return DeserializationError::Ok;
+  case ALERTS_PARSE_TOO_DEEP:
+    r.count = 0;
+    return DeserializationError::TooDeep;
+  case ALERTS_PARSE_INVALID:
+    r.count = 0;
+    return DeserializationError::InvalidInput;
+  default:
+    r.count = 0;
+    return DeserializationError::IncompleteInput;
+  }
+} // end deserializeAlerts
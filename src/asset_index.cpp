@@ -0,0 +1,188 @@
+/* Asset image index for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// This file has no Arduino or ESP-IDF dependencies so that asset images can be
+// checked on the host, see assets.cpp for the flash partition side.
+
+#include "asset_index.h"
+
+static_assert(sizeof(asset_header_t) == 32, "asset_header_t layout");
+static_assert(sizeof(asset_entry_t) == 16, "asset_entry_t layout");
+static_assert(sizeof(asset_font_t) == 16, "asset_font_t layout");
+static_assert(sizeof(asset_icon_atlas_t) == 32, "asset_icon_atlas_t layout");
+static_assert(sizeof(asset_unicode_font_t) == 24,
+              "asset_unicode_font_t layout");
+static_assert(sizeof(asset_ufont_range_t) == 8, "asset_ufont_range_t layout");
+static_assert(sizeof(asset_ufont_glyph_t) == 8, "asset_ufont_glyph_t layout");
+
+/* Returns the 32-bit FNV-1a hash of an asset name.
+ */
+uint32_t assetNameHash(const char *name)
+{
+  uint32_t h = 2166136261u;
+  while (*name)
+  {
+    h ^= static_cast<uint8_t>(*name++);
+    h *= 16777619u;
+  }
+  return h;
+} // end assetNameHash
+
+/* Returns the CRC-32 (IEEE 802.3, as zlib.crc32) of a buffer.
+ *
+ * Bitwise, images are only checked after they change (see assets.cpp).
+ */
+uint32_t assetCrc32(const uint8_t *data, size_t len)
+{
+  uint32_t crc = 0xffffffff;
+  for (size_t i = 0; i < len; ++i)
+  {
+    crc ^= data[i];
+    for (int b = 0; b < 8; ++b)
+    {
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+} // end assetCrc32
+
+/* Validates the header, index and checksum of an asset image and fills image.
+ *
+ * size is the number of bytes available at base, which may be larger than the
+ * image (e.g. a whole flash partition). The checksum is skipped if checkCrc is
+ * false, the header and index are always checked.
+ */
+asset_status_t parseAssetImage(const uint8_t *base, size_t size,
+                               asset_image_t &image, bool checkCrc)
+{
+  image = {};
+  if (size < sizeof(asset_header_t))
+  {
+    return ASSET_TOO_SMALL;
+  }
+  const asset_header_t *header = reinterpret_cast<const asset_header_t *>(base);
+  if (header->magic != ASSET_IMAGE_MAGIC)
+  {
+    return ASSET_BAD_MAGIC;
+  }
+  if (header->version != ASSET_IMAGE_VERSION)
+  {
+    return ASSET_BAD_VERSION;
+  }
+  if (header->image_size < sizeof(asset_header_t) || header->image_size > size)
+  {
+    return ASSET_TOO_SMALL;
+  }
+  if (header->index_offset < sizeof(asset_header_t)
+   || header->index_offset % 4 != 0
+   || header->index_offset > header->image_size
+   || header->count * sizeof(asset_entry_t)
+      > header->image_size - header->index_offset)
+  {
+    return ASSET_BAD_INDEX;
+  }
+
+  const asset_entry_t *index = reinterpret_cast<const asset_entry_t *>(
+                                 base + header->index_offset);
+  for (uint16_t i = 0; i < header->count; ++i)
+  {
+    const asset_entry_t &e = index[i];
+    if (e.offset % 4 != 0
+     || e.offset > header->image_size
+     || e.length > header->image_size - e.offset
+     || (i > 0 && index[i - 1].name_hash >= e.name_hash))
+    {
+      return ASSET_BAD_INDEX;
+    }
+  }
+
+  if (checkCrc
+   && assetCrc32(base + sizeof(asset_header_t),
+                 header->image_size - sizeof(asset_header_t))
+      != header->crc32)
+  {
+    return ASSET_BAD_CRC;
+  }
+
+  image.base  = base;
+  image.size  = header->image_size;
+  image.index = index;
+  image.count = header->count;
+  return ASSET_OK;
+} // end parseAssetImage
+
+/* Looks up an asset by name and type.
+ *
+ * Returns a pointer to the asset's blob and sets length, or nullptr if the
+ * image has no such asset.
+ */
+const uint8_t *findAsset(const asset_image_t &image, const char *name,
+                         asset_type_t type, uint32_t *length)
+{
+  const uint32_t hash = assetNameHash(name);
+  int lo = 0;
+  int hi = static_cast<int>(image.count) - 1;
+  while (lo <= hi)
+  {
+    const int mid = (lo + hi) / 2;
+    const asset_entry_t &e = image.index[mid];
+    if (e.name_hash < hash)
+    {
+      lo = mid + 1;
+    }
+    else if (e.name_hash > hash)
+    {
+      hi = mid - 1;
+    }
+    else
+    {
+      if (e.type != type)
+      {
+        return nullptr;
+      }
+      if (length != nullptr)
+      {
+        *length = e.length;
+      }
+      return image.base + e.offset;
+    }
+  }
+  return nullptr;
+} // end findAsset
+
+/* Returns a short description of an asset image status.
+ */
+const char *getAssetStatusStr(asset_status_t status)
+{
+  switch (status)
+  {
+    case ASSET_OK:
+      return "OK";
+    case ASSET_TOO_SMALL:
+      return "Image truncated";
+    case ASSET_BAD_MAGIC:
+      return "No asset image";
+    case ASSET_BAD_VERSION:
+      return "Unsupported asset image version";
+    case ASSET_BAD_INDEX:
+      return "Corrupt asset index";
+    case ASSET_BAD_CRC:
+      return "Asset image checksum mismatch";
+    default:
+      return "";
+  }
+} // end getAssetStatusStr
@@ -0,0 +1,201 @@
+/* Asset partition for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef ASSET_PARTITION
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "assets.h"
+
+static_assert(sizeof(GFXglyph) == 8, "asset fonts store glyphs as GFXglyph");
+
+static const int ASSET_MAX_FONTS = 24;
+static const int ASSET_MAX_UNICODE_FONTS = 4;
+
+typedef struct font_cache_entry
+{
+  uint32_t name_hash;
+  GFXfont  font;
+} font_cache_entry_t;
+
+static asset_image_t assets = {};
+static bool mounted = false;
+static spi_flash_mmap_handle_t mmapHandle;
+static font_cache_entry_t fontCache[ASSET_MAX_FONTS];
+static int fontCacheCount = 0;
+// drawn as nothing, used when a font is missing from the asset image
+static const GFXfont EMPTY_FONT = {nullptr, nullptr, 1, 0, 0};
+
+#ifdef UNICODE_FONT
+static unicode_font_t unicodeFonts[ASSET_MAX_UNICODE_FONTS];
+static int unicodeFontCount = -1; // -1 until the index has been scanned
+#endif
+
+// CRC of the last image that passed the full check, so the checksum is only
+// computed once after the partition is flashed instead of on every wake.
+RTC_DATA_ATTR static uint32_t verifiedCrc = 0;
+
+/* Maps the asset partition into the data address space and validates the
+ * image. Must be called before any asset fonts or icons are drawn.
+ *
+ * Returns true if the asset image is usable.
+ */
+bool mountAssets()
+{
+  if (mounted)
+  {
+    return true;
+  }
+  const esp_partition_t *part = esp_partition_find_first(
+    static_cast<esp_partition_type_t>(ASSET_PARTITION_TYPE),
+    ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION_LABEL);
+  if (part == nullptr)
+  {
+    Serial.println("Error: Asset partition \"" ASSET_PARTITION_LABEL
+                   "\" not found.");
+    return false;
+  }
+
+  const void *base = nullptr;
+  esp_err_t err = esp_partition_mmap(part, 0, part->size,
+                                     ESP_PARTITION_MMAP_DATA,
+                                     &base, &mmapHandle);
+  if (err != ESP_OK)
+  {
+    Serial.printf("Error: Failed to map asset partition (%s).\n",
+                  esp_err_to_name(err));
+    return false;
+  }
+
+  const uint8_t *image = static_cast<const uint8_t *>(base);
+  const uint32_t crc = reinterpret_cast<const asset_header_t *>(image)->crc32;
+  asset_status_t status = parseAssetImage(image, part->size, assets,
+                                          crc != verifiedCrc);
+  if (status != ASSET_OK)
+  {
+    Serial.printf("Error: %s.\n", getAssetStatusStr(status));
+    spi_flash_munmap(mmapHandle);
+    return false;
+  }
+  verifiedCrc = crc;
+  mounted = true;
+  Serial.printf("Assets: %u entries, %u bytes\n",
+                assets.count, static_cast<unsigned>(assets.size));
+  return true;
+} // end mountAssets
+
+/* Returns the mounted asset image, or nullptr if mountAssets failed.
+ */
+const asset_image_t *getAssets()
+{
+  return mounted ? &assets : nullptr;
+} // end getAssets
+
+/* Returns the font with the given name (e.g. "FONT_12pt8b") from the asset
+ * image. The glyphs and bitmaps are read in place from flash.
+ *
+ * Returns an empty font, which draws nothing, if the font is missing.
+ */
+const GFXfont &assetFont(const char *name)
+{
+  const uint32_t hash = assetNameHash(name);
+  for (int i = 0; i < fontCacheCount; ++i)
+  {
+    if (fontCache[i].name_hash == hash)
+    {
+      return fontCache[i].font;
+    }
+  }
+
+  uint32_t length = 0;
+  const uint8_t *blob = mounted ? findAsset(assets, name, ASSET_FONT, &length)
+                                : nullptr;
+  if (blob == nullptr || length < sizeof(asset_font_t)
+   || fontCacheCount >= ASSET_MAX_FONTS)
+  {
+    Serial.printf("Error: Font %s not found in assets.\n", name);
+    return EMPTY_FONT;
+  }
+
+  const asset_font_t *f = reinterpret_cast<const asset_font_t *>(blob);
+  if (f->last < f->first || f->bitmap_offset > length
+   || f->glyph_offset + (f->last - f->first + 1) * sizeof(GFXglyph) > length)
+  {
+    Serial.printf("Error: Font %s is corrupt.\n", name);
+    return EMPTY_FONT;
+  }
+  font_cache_entry_t &e = fontCache[fontCacheCount++];
+  e.name_hash = hash;
+  e.font.bitmap   = const_cast<uint8_t *>(blob + f->bitmap_offset);
+  e.font.glyph    = reinterpret_cast<GFXglyph *>(
+                      const_cast<uint8_t *>(blob + f->glyph_offset));
+  e.font.first    = f->first;
+  e.font.last     = f->last;
+  e.font.yAdvance = f->y_advance;
+  return e.font;
+} // end assetFont
+
+#ifdef UNICODE_FONT
+/* Returns the Unicode font from the asset image whose line height is closest
+ * to yAdvance, so text in a mix of scripts is drawn at roughly the size of
+ * the current GFX font.
+ *
+ * Returns nullptr if the asset image holds no Unicode font.
+ */
+const unicode_font_t *getUnicodeFont(uint8_t yAdvance)
+{
+  if (unicodeFontCount < 0)
+  {
+    unicodeFontCount = 0;
+    for (uint16_t i = 0; mounted && i < assets.count; ++i)
+    {
+      const asset_entry_t &e = assets.index[i];
+      if (e.type != ASSET_UNICODE_FONT
+       || unicodeFontCount >= ASSET_MAX_UNICODE_FONTS)
+      {
+        continue;
+      }
+      if (parseUnicodeFont(assets.base + e.offset, e.length,
+                           unicodeFonts[unicodeFontCount]))
+      {
+        ++unicodeFontCount;
+      }
+      else
+      {
+        Serial.printf("Error: Unicode font %08x is corrupt.\n",
+                      static_cast<unsigned>(e.name_hash));
+      }
+    }
+  }
+
+  const unicode_font_t *best = nullptr;
+  int bestDiff = 0;
+  for (int i = 0; i < unicodeFontCount; ++i)
+  {
+    const int diff = abs(unicodeFonts[i].header->y_advance - yAdvance);
+    if (best == nullptr || diff < bestDiff)
+    {
+      best = &unicodeFonts[i];
+      bestDiff = diff;
+    }
+  }
+  return best;
+} // end getUnicodeFont
+#endif
+
+#endif // ASSET_PARTITION
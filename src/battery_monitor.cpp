@@ -0,0 +1,110 @@
+/* Battery monitor for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like indoor_history.cpp this file has no Arduino or ESP-IDF dependencies,
+// the ADC is read in readBatteryVoltage().
+
+#include <algorithm>
+
+#include "battery_monitor.h"
+
+/* Returns the mean of the middle half of n samples, sorting them in place.
+ */
+uint32_t trimmedMean(uint16_t *samples, int n)
+{
+  if (n <= 0)
+  {
+    return 0;
+  }
+  std::sort(samples, samples + n);
+  // drop the lowest and highest quarter, fewer than 4 samples are all kept
+  int lo = n / 4;
+  int hi = n - n / 4;
+  uint32_t sum = 0;
+  for (int i = lo; i < hi; ++i)
+  {
+    sum += samples[i];
+  }
+  return (sum + (hi - lo) / 2) / (hi - lo);
+} // end trimmedMean
+
+/* Adds a reading to the filter and returns the filtered voltage in
+ * millivolts. The filter starts over if it is not valid or the reading jumped.
+ */
+uint32_t updateBatteryFilter(battery_filter_t &f, uint32_t millivolts)
+{
+  const int32_t sample = static_cast<int32_t>(millivolts
+                                              << BATTERY_FILTER_FRAC);
+  const int32_t estimate = static_cast<int32_t>(f.estimate);
+  const int32_t step = BATTERY_FILTER_STEP_MV << BATTERY_FILTER_FRAC;
+  if (f.magic != BATTERY_FILTER_MAGIC
+   || sample - estimate > step || estimate - sample > step)
+  {
+    f.magic = BATTERY_FILTER_MAGIC;
+    f.estimate = sample;
+  }
+  else
+  {
+    f.estimate = estimate + ((sample - estimate) >> BATTERY_FILTER_SHIFT);
+  }
+  return (f.estimate + (1 << (BATTERY_FILTER_FRAC - 1)))
+         >> BATTERY_FILTER_FRAC;
+} // end updateBatteryFilter
+
+/* Returns the battery charge in tenths of a percent.
+ * Takes a voltage in millivolts and interpolates a table of the state of
+ * charge of a typical LiPo between minv and maxv.
+ *
+ * The table samples an asymmetric sigmoidal approximation from
+ * <https://github.com/rlogiacco/BatterySense> (LGPLv3),
+ *   p = 105 - 105 / (1 + (1.724 * x)^5.5), x = (v - minv) / (maxv - minv)
+ * at x = i / 32, in tenths of a percent and capped at 100 %. The table is
+ * within 0.2 % of the curve.
+ */
+uint32_t batteryPermille(uint32_t v, uint32_t minv, uint32_t maxv)
+{
+  static const uint16_t SOC_TABLE[] =
+  {
+       0,    0,    0,    0,    0,    1,    2,    5,   10,   19,   34,
+      56,   87,  130,  184,  248,  322,  401,  481,  559,  631,  697,
+     754,  803,  845,  879,  908,  931,  951,  967,  980,  991, 1000
+  };
+  const uint32_t steps = sizeof(SOC_TABLE) / sizeof(SOC_TABLE[0]) - 1;
+
+  if (v <= minv || maxv <= minv)
+  {
+    return 0;
+  }
+  if (v >= maxv)
+  {
+    return 1000;
+  }
+  // position in the table in 1/256 steps
+  const uint32_t pos = static_cast<uint32_t>(
+    (static_cast<uint64_t>(v - minv) * steps * 256) / (maxv - minv));
+  const uint32_t i = pos / 256;
+  const uint32_t frac = pos % 256;
+  return (SOC_TABLE[i] * 256 + (SOC_TABLE[i + 1] - SOC_TABLE[i]) * frac
+          + 128) / 256;
+} // end batteryPermille
+
+/* Returns battery percentage, rounded to the nearest integer.
+ */
+uint32_t batteryPercent(uint32_t v, uint32_t minv, uint32_t maxv)
+{
+  return (batteryPermille(v, minv, maxv) + 5) / 10;
+} // end batteryPercent
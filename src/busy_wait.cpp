@@ -0,0 +1,149 @@
+/* E-paper BUSY wait for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+
+#include "busy_wait.h"
+#include "config.h"
+#include "tlog.h"
+
+// Typical ESP32 supply current with WiFi off, while polling at 240MHz and while
+// in light sleep. Only used to estimate the charge saved by sleeping.
+static const float ACTIVE_CURRENT_MA      = 40.0f;
+static const float LIGHT_SLEEP_CURRENT_MA = 0.8f;
+
+static busy_wait_stats_t stats = {};
+static volatile bool sleepAllowed = true;
+// total time spent in light sleep while the panel was busy, kept across deep
+// sleep
+RTC_DATA_ATTR static uint32_t totalSleepMs = 0;
+
+/* Busy callback for GxEPD2 (see GxEPD2_EPD::setBusyCallback).
+ *
+ * GxEPD2 calls this repeatedly while the panel holds BUSY. Instead of
+ * returning right away, which makes GxEPD2 poll the pin at full CPU clock,
+ * the ESP32 enters light sleep until the BUSY pin is released. busyLevel
+ * points to the level the panel holds while busy (the callback parameter), the
+ * wake is armed on the opposite level.
+ *
+ * The pin is sampled again after the wake is armed. If the panel was released
+ * in the meantime this returns without sleeping, a release after the sample
+ * triggers the armed level wake right away.
+ *
+ * A timer wake limits each light sleep to BUSY_WAIT_SLEEP_TIMEOUT_MS. GxEPD2
+ * re-checks the pin after every call and still applies its own busy timeout,
+ * so a missed wake can only delay, never hang, the refresh.
+ *
+ * While sleeping is not allowed (see setBusyWaitSleepAllowed) this waits 1ms,
+ * like GxEPD2 does without a callback.
+ */
+void busyWaitLightSleep(const void *busyLevel)
+{
+  if (!sleepAllowed)
+  {
+    delay(1);
+    return;
+  }
+
+  const gpio_num_t pin = static_cast<gpio_num_t>(PIN_EPD_BUSY);
+  const int busy = *static_cast<const int *>(busyLevel);
+
+  gpio_wakeup_enable(pin, busy ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+  if (gpio_get_level(pin) != busy)
+  {
+    gpio_wakeup_disable(pin);
+    return;
+  }
+
+  Serial.flush(); // UART output is garbled by light sleep
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(BUSY_WAIT_SLEEP_TIMEOUT_MS * 1000ULL);
+
+  const int64_t start = esp_timer_get_time();
+  esp_light_sleep_start();
+  const int64_t elapsed = esp_timer_get_time() - start;
+
+  // don't leave the wake sources armed for later sleeps
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  gpio_wakeup_disable(pin);
+
+  ++stats.sleeps;
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER)
+  {
+    ++stats.timer_wakes;
+  }
+  stats.sleep_us += elapsed;
+  totalSleepMs += elapsed / 1000;
+  return;
+} // end busyWaitLightSleep
+
+/* Light sleep stops both cores. Code that keeps the other core busy while the
+ * panel is written (the pipelined page transfer) disallows it, busy waits then
+ * poll the pin instead.
+ */
+void setBusyWaitSleepAllowed(bool allowed)
+{
+  sleepAllowed = allowed;
+  return;
+} // end setBusyWaitSleepAllowed
+
+/* Resets the counters for the current wake period.
+ */
+void resetBusyWaitStats()
+{
+  stats = {};
+  return;
+} // end resetBusyWaitStats
+
+/* Returns the counters for the current wake period.
+ */
+const busy_wait_stats_t &getBusyWaitStats()
+{
+  return stats;
+} // end getBusyWaitStats
+
+/* Returns the total time spent in light sleep while waiting for the panel
+ * since the last power-on reset.
+ */
+uint32_t getBusyWaitTotalSleepMs()
+{
+  return totalSleepMs;
+} // end getBusyWaitTotalSleepMs
+
+/* Estimates the charge, in milliampere-seconds, saved by sleeping instead of
+ * polling.
+ */
+float estimateBusyWaitSavings_mAs(const busy_wait_stats_t &s)
+{
+  return (ACTIVE_CURRENT_MA - LIGHT_SLEEP_CURRENT_MA) * (s.sleep_us / 1e6f);
+} // end estimateBusyWaitSavings_mAs
+
+/* Prints the busy wait counters to the serial monitor.
+ */
+void printBusyWaitStats()
+{
+  TLOG("Panel busy: %.3fs in light sleep (%u sleeps, %u timeouts), "
+       "~%.1fmAs saved, %lus total",
+       stats.sleep_us / 1e6f, stats.sleeps, stats.timer_wakes,
+       estimateBusyWaitSavings_mAs(stats),
+       static_cast<unsigned long>(totalSleepMs / 1000));
+  return;
+} // end printBusyWaitStats
@@ -0,0 +1,348 @@
+/* In-memory capture display for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#if RENDER_CAPTURE || defined(PIO_UNIT_TESTING)
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <Arduino.h>
+
+#include "capture_display.h"
+
+CaptureDisplay::CaptureDisplay(int16_t w, int16_t h, bool hasColorPlane)
+  : Adafruit_GFX(w, h), _black(nullptr), _color(nullptr),
+    _hasColorPlane(hasColorPlane), _planeSize(((w + 7) / 8) * h),
+    _frame(0), _numTimings(0)
+{}
+
+CaptureDisplay::~CaptureDisplay()
+{
+  free(_black);
+  free(_color);
+}
+
+/* Allocates the frame planes. The parameters only exist for compatibility with
+ * GxEPD2's init().
+ *
+ * If a plane can not be allocated neither is kept. Drawing then does nothing
+ * and nextPage() reports the frame as dropped.
+ */
+void CaptureDisplay::init(uint32_t serial_diag_bitrate, bool initial,
+                          uint16_t reset_duration, bool pulldown_rst_mode)
+{
+  if (_black == nullptr)
+  {
+    _black = static_cast<uint8_t *>(malloc(_planeSize));
+  }
+  if (_hasColorPlane && _color == nullptr)
+  {
+    _color = static_cast<uint8_t *>(malloc(_planeSize));
+  }
+  if (_black == nullptr || (_hasColorPlane && _color == nullptr))
+  {
+    Serial.println("[capture] failed to allocate frame planes ("
+                   + String(_planeSize) + "B each)");
+    free(_black);
+    free(_color);
+    _black = nullptr;
+    _color = nullptr;
+  }
+  _numTimings = 0;
+  return;
+} // end init
+
+void CaptureDisplay::setFullWindow()
+{
+  return;
+}
+
+/* The whole frame is always captured, partial windows are ignored.
+ */
+void CaptureDisplay::setPartialWindow(uint16_t x, uint16_t y,
+                                      uint16_t w, uint16_t h)
+{
+  return;
+}
+
+/* Begins a new frame, sets the whole frame to white.
+ */
+void CaptureDisplay::firstPage()
+{
+  fillScreen(GxEPD_WHITE);
+  return;
+} // end firstPage
+
+/* The whole frame is held in memory, so there is only ever a single page.
+ * Writes the captured frame to the serial port and returns false.
+ */
+bool CaptureDisplay::nextPage()
+{
+  if (_black == nullptr)
+  {
+    Serial.printf("[capture] frame %u dropped, no frame planes\n", _frame);
+    ++_frame;
+    _numTimings = 0;
+    return false;
+  }
+  Serial.printf("[capture] frame %u %dx%d planes=%d\n", _frame,
+                WIDTH, HEIGHT, _hasColorPlane ? 2 : 1);
+  writeTimings();
+  writePlane("black", _black);
+  if (_hasColorPlane)
+  {
+    writePlane("accent", _color);
+  }
+  Serial.printf("[capture] end frame %u\n", _frame);
+  ++_frame;
+  _numTimings = 0;
+  return false;
+} // end nextPage
+
+void CaptureDisplay::hibernate()
+{
+  return;
+}
+
+/* Draws the pixels of a bitmap whose bits are 0, like GxEPD2's
+ * drawInvertedBitmap.
+ */
+void CaptureDisplay::drawInvertedBitmap(int16_t x, int16_t y,
+                                        const uint8_t bitmap[],
+                                        int16_t w, int16_t h, uint16_t color)
+{
+  const int16_t byteWidth = (w + 7) / 8;
+  for (int16_t j = 0; j < h; ++j)
+  {
+    for (int16_t i = 0; i < w; ++i)
+    {
+      uint8_t b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      if (!(b & (0x80 >> (i & 7))))
+      {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+  return;
+} // end drawInvertedBitmap
+
+void CaptureDisplay::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if (x < 0 || y < 0 || x >= width() || y >= height()
+   || _black == nullptr)
+  {
+    return;
+  }
+  switch (getRotation())
+  {
+  case 1:
+    std::swap(x, y);
+    x = WIDTH - 1 - x;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    std::swap(x, y);
+    y = HEIGHT - 1 - y;
+    break;
+  }
+
+  const size_t i = y * ((WIDTH + 7) / 8) + x / 8;
+  const uint8_t bit = 0x80 >> (x & 7);
+  const bool black = color == GxEPD_BLACK;
+  const bool accent = color != GxEPD_BLACK && color != GxEPD_WHITE;
+  if (black || (accent && !_hasColorPlane))
+  {
+    _black[i] |= bit;
+  }
+  else
+  {
+    _black[i] &= ~bit;
+  }
+  if (_hasColorPlane)
+  {
+    if (accent)
+    {
+      _color[i] |= bit;
+    }
+    else
+    {
+      _color[i] &= ~bit;
+    }
+  }
+  return;
+} // end drawPixel
+
+void CaptureDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                   uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+  return;
+}
+
+/* Solid fills are written a byte at a time when the display is not rotated.
+ */
+void CaptureDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint16_t color)
+{
+  if (_black == nullptr)
+  {
+    return;
+  }
+  if (getRotation() != 0)
+  {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+    return;
+  }
+  const bool black = color == GxEPD_BLACK;
+  const bool accent = color != GxEPD_BLACK && color != GxEPD_WHITE;
+  fillPatternRect1bpp(_black, WIDTH, HEIGHT, x, y, w, h, PATTERN_SOLID,
+                      black || (accent && !_hasColorPlane));
+  if (_hasColorPlane)
+  {
+    fillPatternRect1bpp(_color, WIDTH, HEIGHT, x, y, w, h, PATTERN_SOLID,
+                        accent);
+  }
+  return;
+} // end fillRect
+
+/* Writes a row of a pattern fill a byte at a time when the display is not
+ * rotated.
+ */
+bool CaptureDisplay::fillPatternSpan(int16_t x, int16_t y, int16_t w,
+                                     uint8_t bits, uint16_t color)
+{
+  if (getRotation() != 0)
+  {
+    return false;
+  }
+  if (_black == nullptr || y < 0 || y >= HEIGHT)
+  {
+    return true;
+  }
+  const int16_t xStart = std::max<int16_t>(x, 0);
+  const int16_t xEnd = std::min<int16_t>(x + w, WIDTH);
+  const size_t row = y * ((WIDTH + 7) / 8);
+  const bool black = color == GxEPD_BLACK;
+  const bool accent = color != GxEPD_BLACK && color != GxEPD_WHITE;
+  fillPatternSpan1bpp(_black + row, xStart, xEnd, bits,
+                      black || (accent && !_hasColorPlane));
+  if (_hasColorPlane)
+  {
+    fillPatternSpan1bpp(_color + row, xStart, xEnd, bits, accent);
+  }
+  return true;
+} // end fillPatternSpan
+
+void CaptureDisplay::fillScreen(uint16_t color)
+{
+  if (_black == nullptr)
+  {
+    return;
+  }
+  const bool black = color == GxEPD_BLACK;
+  const bool accent = color != GxEPD_BLACK && color != GxEPD_WHITE;
+  memset(_black, (black || (accent && !_hasColorPlane)) ? 0xff : 0x00,
+         _planeSize);
+  if (_hasColorPlane)
+  {
+    memset(_color, accent ? 0xff : 0x00, _planeSize);
+  }
+  return;
+} // end fillScreen
+
+/* Accumulates the time spent in a render call. Labels are expected to be
+ * string literals, calls from the same site are summed.
+ */
+void CaptureDisplay::recordTiming(const char *label, uint32_t elapsed_us)
+{
+  for (int i = 0; i < _numTimings; ++i)
+  {
+    if (_timings[i].label == label)
+    {
+      _timings[i].elapsed_us += elapsed_us;
+      ++_timings[i].calls;
+      return;
+    }
+  }
+  if (_numTimings < MAX_TIMINGS)
+  {
+    _timings[_numTimings++] = {label, elapsed_us, 1};
+  }
+  return;
+} // end recordTiming
+
+/* Prints one line per profiled render call. Only the function name is printed
+ * (the label is cut at the opening parenthesis).
+ */
+void CaptureDisplay::writeTimings()
+{
+  uint32_t total_us = 0;
+  for (int i = 0; i < _numTimings; ++i)
+  {
+    const char *label = _timings[i].label;
+    const char *paren = strchr(label, '(');
+    int len = paren ? paren - label : strlen(label);
+    Serial.printf("[capture] timing %.*s %u us %u calls\n", len, label,
+                  _timings[i].elapsed_us, _timings[i].calls);
+    total_us += _timings[i].elapsed_us;
+  }
+  Serial.printf("[capture] timing total %u us\n", total_us);
+  return;
+} // end writeTimings
+
+/* Writes a plane as base64 encoded raw PBM (P4) raster data, 76 characters per
+ * line. Set bits are black (or accent) pixels.
+ */
+void CaptureDisplay::writePlane(const char *name, const uint8_t *plane)
+{
+  static const char b64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  char line[77];
+  int n = 0;
+
+  Serial.printf("[capture] plane %s P4 %d %d\n", name, WIDTH, HEIGHT);
+  for (size_t i = 0; i < _planeSize; i += 3)
+  {
+    uint32_t v = plane[i] << 16;
+    if (i + 1 < _planeSize) { v |= plane[i + 1] << 8; }
+    if (i + 2 < _planeSize) { v |= plane[i + 2]; }
+    line[n++] = b64[(v >> 18) & 0x3f];
+    line[n++] = b64[(v >> 12) & 0x3f];
+    line[n++] = i + 1 < _planeSize ? b64[(v >> 6) & 0x3f] : '=';
+    line[n++] = i + 2 < _planeSize ? b64[v & 0x3f] : '=';
+    if (n == 76)
+    {
+      line[n] = '\0';
+      Serial.println(line);
+      n = 0;
+    }
+  }
+  if (n > 0)
+  {
+    line[n] = '\0';
+    Serial.println(line);
+  }
+  Serial.printf("[capture] end plane %s\n", name);
+  return;
+} // end writePlane
+
+#endif // RENDER_CAPTURE || defined(PIO_UNIT_TESTING)
@@ -39,6 +39,7 @@
 #include "config.h"
 #include "display_utils.h"
 #include "renderer.h"
+#include "tlog.h"
 #ifndef USE_HTTP
 #include <WiFiClientSecure.h>
 #endif
@@ -49,6 +50,10 @@ static const uint16_t OWM_PORT = 80;
 static const uint16_t OWM_PORT = 443;
 #endif
 
+// Set once the alerts endpoint answered 401 or 404, kept in RTC memory so the
+// request is not repeated on every wake.
+RTC_DATA_ATTR static bool alertsUnavailable = false;
+
 /* Power-on and connect WiFi.
  * Takes int parameter to store WiFi RSSI, or “Received Signal Strength
  * Indicator"
@@ -57,7 +62,7 @@ static const uint16_t OWM_PORT = 443;
  */
 wl_status_t startWiFi(int &wifiRSSI) {
   WiFi.mode(WIFI_STA);
-  Serial.printf("%s '%s'", TXT_CONNECTING_TO, WIFI_SSID);
+  TLOG("%s '%s'", TXT_CONNECTING_TO, WIFI_SSID);
   WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
 
   // timeout if WiFi does not connect in WIFI_TIMEOUT ms from now
@@ -65,18 +70,16 @@ wl_status_t startWiFi(int &wifiRSSI) {
   wl_status_t connection_status = WiFi.status();
 
   while ((connection_status != WL_CONNECTED) && (millis() < timeout)) {
-    Serial.print(".");
     delay(50);
     connection_status = WiFi.status();
   }
-  Serial.println();
 
   if (connection_status == WL_CONNECTED) {
     wifiRSSI = WiFi.RSSI(); // get WiFi signal strength now, because the WiFi
                             // will be turned off to save power!
-    Serial.println("IP: " + WiFi.localIP().toString());
+    TLOG("IP: %s", WiFi.localIP().toString().c_str());
   } else {
-    Serial.printf("%s '%s'\n", TXT_COULD_NOT_CONNECT_TO, WIFI_SSID);
+    TLOG("%s '%s'", TXT_COULD_NOT_CONNECT_TO, WIFI_SSID);
   }
   return connection_status;
 } // startWiFi
@@ -95,10 +98,12 @@ void killWiFi() {
 bool printLocalTime(tm *timeInfo) {
   int attempts = 0;
   while (!getLocalTime(timeInfo) && attempts++ < 3) {
-    Serial.println(TXT_FAILED_TO_GET_TIME);
+    TLOG("%s", TXT_FAILED_TO_GET_TIME);
     return false;
   }
-  Serial.println(timeInfo, "%A, %B %d, %Y %H:%M:%S");
+  TLOG("%04d-%02d-%02d %02d:%02d:%02d", timeInfo->tm_year + 1900,
+       timeInfo->tm_mon + 1, timeInfo->tm_mday, timeInfo->tm_hour,
+       timeInfo->tm_min, timeInfo->tm_sec);
   return true;
 } // printLocalTime
 
@@ -114,14 +119,12 @@ bool waitForSNTPSync(tm *timeInfo) {
   unsigned long timeout = millis() + NTP_TIMEOUT;
   if ((sntp_get_sync_status() == SNTP_SYNC_STATUS_RESET) &&
       (millis() < timeout)) {
-    Serial.print(TXT_WAITING_FOR_SNTP);
+    TLOG("%s", TXT_WAITING_FOR_SNTP);
     delay(100); // ms
     while ((sntp_get_sync_status() == SNTP_SYNC_STATUS_RESET) &&
            (millis() < timeout)) {
-      Serial.print(".");
       delay(100); // ms
     }
-    Serial.println();
   }
   return printLocalTime(timeInfo);
 } // waitForSNTPSync
@@ -143,21 +146,20 @@ int getOWMcurrentWeather(WiFiClientSecure &client, owm_current_t &current)
   String uri = "/data/2.5/weather?lat=" + LAT + "&lon=" + LON +
                "&units=standard&lang=" + OWM_LANG + "&appid=" + OWM_APIKEY;
 
+#if DEBUG_LEVEL >= 2
   // Print the complete URL for debugging (with real API key for verification)
   String fullUrl =
       "http" + String(OWM_PORT == 443 ? "s" : "") + "://" + OWM_ENDPOINT + uri;
   Serial.println("DEBUG: Complete API Request URL:");
   Serial.println(fullUrl);
+#endif
 
-  // This string is printed to terminal to help with debugging. The API key is
-  // censored to reduce the risk of users exposing their key.
-  String sanitizedUri = "http" + String(OWM_PORT == 443 ? "s" : "") + "://" +
-                        OWM_ENDPOINT + "/data/2.5/weather?lat=" + LAT +
-                        "&lon=" + LON + "&units=standard&lang=" + OWM_LANG +
-                        "&appid={API key}";
-
-  Serial.print(TXT_ATTEMPTING_HTTP_REQ);
-  Serial.println(": " + sanitizedUri);
+  // Printed to help with debugging. The API key is censored to reduce the risk
+  // of users exposing their key.
+  TLOG("%s: http%s://%s/data/2.5/weather?lat=%s&lon=%s&units=standard"
+       "&lang=%s&appid={API key}",
+       TXT_ATTEMPTING_HTTP_REQ, OWM_PORT == 443 ? "s" : "",
+       OWM_ENDPOINT.c_str(), LAT.c_str(), LON.c_str(), OWM_LANG.c_str());
   int httpResponse = 0;
   while (!rxSuccess && attempts < 3) {
     wl_status_t connection_status = WiFi.status();
@@ -174,8 +176,10 @@ int getOWMcurrentWeather(WiFiClientSecure &client, owm_current_t &current)
     if (httpResponse == HTTP_CODE_OK) {
       // Parse the current weather JSON response
       String payload = http.getString();
+#if DEBUG_LEVEL >= 2
       Serial.println("DEBUG: Current Weather API Response:");
       Serial.println(payload);
+#endif
 
       DynamicJsonDocument doc(2048);
       DeserializationError error = deserializeJson(doc, payload);
@@ -209,14 +213,13 @@ int getOWMcurrentWeather(WiFiClientSecure &client, owm_current_t &current)
 
         rxSuccess = true;
       } else {
-        Serial.println("Failed to parse current weather JSON");
+        TLOG("Failed to parse current weather JSON");
         httpResponse = -256 - static_cast<int>(error.code());
       }
     }
     client.stop();
     http.end();
-    Serial.println("  " + String(httpResponse, DEC) + " " +
-                   getHttpResponsePhrase(httpResponse));
+    TLOG("  %d %s", httpResponse, getHttpResponsePhrase(httpResponse));
     ++attempts;
   }
 
@@ -242,14 +245,15 @@ int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r)
                "&lang=" + OWM_LANG +
                "&units=standard&cnt=40"; // 获取完整的5天数据（40个数据点）
 
-  // This string is printed to terminal to help with debugging. The API key is
-  // censored to reduce the risk of users exposing their key.
-  String sanitizedUri = OWM_ENDPOINT + uri + "&appid={API key}";
+  // Printed to help with debugging. The API key is censored to reduce the risk
+  // of users exposing their key.
+  TLOG("%s: %s/data/2.5/forecast?lat=%s&lon=%s&lang=%s&units=standard&cnt=40"
+       "&appid={API key}",
+       TXT_ATTEMPTING_HTTP_REQ, OWM_ENDPOINT.c_str(), LAT.c_str(),
+       LON.c_str(), OWM_LANG.c_str());
 
   uri += "&appid=" + OWM_APIKEY;
 
-  Serial.print(TXT_ATTEMPTING_HTTP_REQ);
-  Serial.println(": " + sanitizedUri);
   int httpResponse = 0;
   while (!rxSuccess && attempts < 3) {
     wl_status_t connection_status = WiFi.status();
@@ -273,8 +277,7 @@ int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r)
     }
     client.stop();
     http.end();
-    Serial.println("  " + String(httpResponse, DEC) + " " +
-                   getHttpResponsePhrase(httpResponse));
+    TLOG("  %d %s", httpResponse, getHttpResponsePhrase(httpResponse));
     ++attempts;
   }
 
@@ -309,15 +312,12 @@ int getOWMairpollution(WiFiClientSecure &client, owm_resp_air_pollution_t &r)
   sprintf(startStr, "%lld", start);
   String uri = "/data/2.5/air_pollution/history?lat=" + LAT + "&lon=" + LON +
                "&start=" + startStr + "&end=" + endStr + "&appid=" + OWM_APIKEY;
-  // This string is printed to terminal to help with debugging. The API key is
-  // censored to reduce the risk of users exposing their key.
-  String sanitizedUri = OWM_ENDPOINT +
-                        "/data/2.5/air_pollution/history?lat=" + LAT +
-                        "&lon=" + LON + "&start=" + startStr +
-                        "&end=" + endStr + "&appid={API key}";
-
-  Serial.print(TXT_ATTEMPTING_HTTP_REQ);
-  Serial.println(": " + sanitizedUri);
+  // Printed to help with debugging. The API key is censored to reduce the risk
+  // of users exposing their key.
+  TLOG("%s: %s/data/2.5/air_pollution/history?lat=%s&lon=%s&start=%lld"
+       "&end=%lld&appid={API key}",
+       TXT_ATTEMPTING_HTTP_REQ, OWM_ENDPOINT.c_str(), LAT.c_str(),
+       LON.c_str(), start, end);
   int httpResponse = 0;
   while (!rxSuccess && attempts < 3) {
     wl_status_t connection_status = WiFi.status();
@@ -341,24 +341,94 @@ int getOWMairpollution(WiFiClientSecure &client, owm_resp_air_pollution_t &r)
     }
     client.stop();
     http.end();
-    Serial.println("  " + String(httpResponse, DEC) + " " +
-                   getHttpResponsePhrase(httpResponse));
+    TLOG("  %d %s", httpResponse, getHttpResponsePhrase(httpResponse));
     ++attempts;
   }
 
   return httpResponse;
 } // getOWMairpollution
 
+/* Perform an HTTP GET request to OpenWeatherMap's "One Call" API for alerts
+ * only (everything else is excluded). The response is parsed as it arrives,
+ * so alerts with long descriptions take no extra memory, and stored in the
+ * global variable owm_onecall.alerts.
+ *
+ * Alerts are optional, so unlike the other requests this one is not retried:
+ * a failure costs at most one connection and HTTP_CLIENT_TCP_TIMEOUT. The time
+ * it took is logged. No request is made if OWM_ALERTS_ENDPOINT is empty, or
+ * once the server has answered 401 or 404 (the API key does not cover the
+ * endpoint or it does not exist), until the next reset.
+ *
+ * Returns the HTTP Status Code, or 0 if no request was made.
+ */
+#ifdef USE_HTTP
+int getOWMalerts(WiFiClient &client, owm_resp_alerts_t &r)
+#else
+int getOWMalerts(WiFiClientSecure &client, owm_resp_alerts_t &r)
+#endif
+{
+  if (OWM_ALERTS_ENDPOINT.isEmpty() || alertsUnavailable) {
+    r.count = 0;
+    return 0;
+  }
+
+  const unsigned long startTime = millis();
+  DeserializationError jsonErr = {};
+  String uri = "/data/" + OWM_ONECALL_VERSION + "/onecall?lat=" + LAT +
+               "&lon=" + LON + "&lang=" + OWM_LANG +
+               "&exclude=current,minutely,hourly,daily";
+  // Printed to help with debugging. The API key is censored to reduce the risk
+  // of users exposing their key.
+  TLOG("%s: %s/data/%s/onecall?lat=%s&lon=%s&lang=%s"
+       "&exclude=current,minutely,hourly,daily&appid={API key}",
+       TXT_ATTEMPTING_HTTP_REQ, OWM_ALERTS_ENDPOINT.c_str(),
+       OWM_ONECALL_VERSION.c_str(), LAT.c_str(), LON.c_str(),
+       OWM_LANG.c_str());
+
+  uri += "&appid=" + OWM_APIKEY;
+
+  wl_status_t connection_status = WiFi.status();
+  if (connection_status != WL_CONNECTED) {
+    r.count = 0;
+    // -512 offset distinguishes these errors from httpClient errors
+    return -512 - static_cast<int>(connection_status);
+  }
+
+  HTTPClient http;
+  http.setConnectTimeout(HTTP_CLIENT_TCP_TIMEOUT); // default 5000ms
+  http.setTimeout(HTTP_CLIENT_TCP_TIMEOUT);        // default 5000ms
+  // HTTP/1.0 responses are not chunked, the body can be parsed as is
+  http.useHTTP10(true);
+  http.begin(client, OWM_ALERTS_ENDPOINT, OWM_PORT, uri);
+  int httpResponse = http.GET();
+  if (httpResponse == HTTP_CODE_OK) {
+    jsonErr = deserializeAlerts(http.getStream(), r);
+    if (jsonErr) {
+      // -256 offset distinguishes these errors from httpClient errors
+      httpResponse = -256 - static_cast<int>(jsonErr.code());
+    }
+  }
+  client.stop();
+  http.end();
+  TLOG("  %d %s, %lu ms", httpResponse, getHttpResponsePhrase(httpResponse),
+       millis() - startTime);
+
+  if (httpResponse == HTTP_CODE_UNAUTHORIZED
+   || httpResponse == HTTP_CODE_NOT_FOUND) {
+    alertsUnavailable = true;
+  }
+  if (httpResponse != HTTP_CODE_OK) {
+    r.count = 0;
+  }
+  return httpResponse;
+} // getOWMalerts
+
 /* Prints debug information about heap usage.
  */
 void printHeapUsage() {
-  Serial.println("[debug] Heap Size       : " + String(ESP.getHeapSize()) +
-                 " B");
-  Serial.println("[debug] Available Heap  : " + String(ESP.getFreeHeap()) +
-                 " B");
-  Serial.println("[debug] Min Free Heap   : " + String(ESP.getMinFreeHeap()) +
-                 " B");
-  Serial.println("[debug] Max Allocatable : " + String(ESP.getMaxAllocHeap()) +
-                 " B");
+  TLOG("[debug] Heap Size       : %u B", ESP.getHeapSize());
+  TLOG("[debug] Available Heap  : %u B", ESP.getFreeHeap());
+  TLOG("[debug] Min Free Heap   : %u B", ESP.getMinFreeHeap());
+  TLOG("[debug] Max Allocatable : %u B", ESP.getMaxAllocHeap());
   return;
 }
@@ -0,0 +1,396 @@
+/* Weather condition icon lookup for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <Arduino.h>
+
+#include "condition_icons.h"
+
+// icon header files
+#include "icons/icons.h"
+
+// Weather condition icons
+// OpenWeatherMap condition ids that share the same icon rules are mapped to a
+// condition group, the icon is then chosen by the group and a 4-bit state mask
+// (COND_DAY | COND_MOON | COND_CLOUDY | COND_WINDY). Both lookups are dense
+// tables generated at compile time from conditionGroup() and conditionIcon().
+//
+// References:
+//   https://openweathermap.org/weather-conditions
+typedef enum condition_group
+{
+  COND_THUNDERSTORM,
+  COND_STORM_SHOWERS,
+  COND_SHOWERS,
+  COND_RAIN,
+  COND_RAIN_MIX,
+  COND_SNOW,
+  COND_SLEET,
+  COND_FOG,
+  COND_SMOKE,
+  COND_HAZE,
+  COND_SANDSTORM,
+  COND_DUST,
+  COND_VOLCANO,
+  COND_SQUALL,
+  COND_TORNADO,
+  COND_CLEAR,
+  COND_FEW_CLOUDS,
+  COND_CLOUDS,
+  COND_OVERCAST,
+  // ids not (yet) listed above, by group
+  COND_OTHER_THUNDERSTORM,
+  COND_OTHER_DRIZZLE,
+  COND_OTHER_RAIN,
+  COND_OTHER_SNOW,
+  COND_OTHER_ATMOSPHERE,
+  COND_OTHER_CLOUDS,
+  COND_NA,
+  COND_GROUP_COUNT
+} condition_group_t;
+
+#define COND_DAY    0x1
+#define COND_MOON   0x2
+#define COND_CLOUDY 0x4
+#define COND_WINDY  0x8
+#define COND_STATE_COUNT 16
+
+static constexpr int CONDITION_ID_MIN = 200;
+static constexpr int CONDITION_ID_MAX = 899;
+static constexpr size_t CONDITION_SIZES[] = {32, 64, 196};
+static constexpr int CONDITION_NUM_SIZES = sizeof(CONDITION_SIZES)
+                                           / sizeof(CONDITION_SIZES[0]);
+
+/* Returns the condition group of an OpenWeatherMap condition id.
+ *
+ * Last Updated: June 26, 2022
+ */
+static constexpr condition_group_t conditionGroup(int id)
+{
+  switch (id)
+  {
+  // Group 2xx: Thunderstorm
+  case 200: // Thunderstorm  thunderstorm with light rain     11d
+  case 201: // Thunderstorm  thunderstorm with rain           11d
+  case 202: // Thunderstorm  thunderstorm with heavy rain     11d
+  case 210: // Thunderstorm  light thunderstorm               11d
+  case 211: // Thunderstorm  thunderstorm                     11d
+  case 212: // Thunderstorm  heavy thunderstorm               11d
+  case 221: // Thunderstorm  ragged thunderstorm              11d
+    return COND_THUNDERSTORM;
+  case 230: // Thunderstorm  thunderstorm with light drizzle  11d
+  case 231: // Thunderstorm  thunderstorm with drizzle        11d
+  case 232: // Thunderstorm  thunderstorm with heavy drizzle  11d
+    return COND_STORM_SHOWERS;
+  // Group 3xx: Drizzle
+  case 300: // Drizzle       light intensity drizzle          09d
+  case 301: // Drizzle       drizzle                          09d
+  case 302: // Drizzle       heavy intensity drizzle          09d
+  case 310: // Drizzle       light intensity drizzle rain     09d
+  case 311: // Drizzle       drizzle rain                     09d
+  case 312: // Drizzle       heavy intensity drizzle rain     09d
+  case 313: // Drizzle       shower rain and drizzle          09d
+  case 314: // Drizzle       heavy shower rain and drizzle    09d
+  case 321: // Drizzle       shower drizzle                   09d
+    return COND_SHOWERS;
+  // Group 5xx: Rain
+  case 500: // Rain          light rain                       10d
+  case 501: // Rain          moderate rain                    10d
+  case 502: // Rain          heavy intensity rain             10d
+  case 503: // Rain          very heavy rain                  10d
+  case 504: // Rain          extreme rain                     10d
+    return COND_RAIN;
+  case 511: // Rain          freezing rain                    13d
+    return COND_RAIN_MIX;
+  case 520: // Rain          light intensity shower rain      09d
+  case 521: // Rain          shower rain                      09d
+  case 522: // Rain          heavy intensity shower rain      09d
+  case 531: // Rain          ragged shower rain               09d
+    return COND_SHOWERS;
+  // Group 6xx: Snow
+  case 600: // Snow          light snow                       13d
+  case 601: // Snow          Snow                             13d
+  case 602: // Snow          Heavy snow                       13d
+    return COND_SNOW;
+  case 611: // Snow          Sleet                            13d
+  case 612: // Snow          Light shower sleet               13d
+  case 613: // Snow          Shower sleet                     13d
+    return COND_SLEET;
+  case 615: // Snow          Light rain and snow              13d
+  case 616: // Snow          Rain and snow                    13d
+  case 620: // Snow          Light shower snow                13d
+  case 621: // Snow          Shower snow                      13d
+  case 622: // Snow          Heavy shower snow                13d
+    return COND_RAIN_MIX;
+  // Group 7xx: Atmosphere
+  case 701: // Mist          mist                             50d
+    return COND_FOG;
+  case 711: // Smoke         Smoke                            50d
+    return COND_SMOKE;
+  case 721: // Haze          Haze                             50d
+    return COND_HAZE;
+  case 731: // Dust          sand/dust whirls                 50d
+    return COND_SANDSTORM;
+  case 741: // Fog           fog                              50d
+    return COND_FOG;
+  case 751: // Sand          sand                             50d
+    return COND_SANDSTORM;
+  case 761: // Dust          dust                             50d
+    return COND_DUST;
+  case 762: // Ash           volcanic ash                     50d
+    return COND_VOLCANO;
+  case 771: // Squall        squalls                          50d
+    return COND_SQUALL;
+  case 781: // Tornado       tornado                          50d
+    return COND_TORNADO;
+  // Group 800: Clear
+  case 800: // Clear         clear sky                        01d 01n
+    return COND_CLEAR;
+  // Group 80x: Clouds
+  case 801: // Clouds        few clouds: 11-25%               02d 02n
+    return COND_FEW_CLOUDS;
+  case 802: // Clouds        scattered clouds: 25-50%         03d 03n
+  case 803: // Clouds        broken clouds: 51-84%            04d 04n
+    return COND_CLOUDS;
+  case 804: // Clouds        overcast clouds: 85-100%         04d 04n
+    return COND_OVERCAST;
+  default:
+    // maybe this is a new id in one of the existing groups
+    if (id >= 200 && id < 300) {return COND_OTHER_THUNDERSTORM;}
+    if (id >= 300 && id < 400) {return COND_OTHER_DRIZZLE;}
+    if (id >= 500 && id < 600) {return COND_OTHER_RAIN;}
+    if (id >= 600 && id < 700) {return COND_OTHER_SNOW;}
+    if (id >= 700 && id < 800) {return COND_OTHER_ATMOSPHERE;}
+    if (id >= 800 && id < 900) {return COND_OTHER_CLOUDS;}
+    return COND_NA;
+  }
+} // end conditionGroup
+
+/* Returns the icon for a condition group and state mask.
+ *
+ * Uses multiple factors to return more detailed icons than the simple icon
+ * catagories that OpenWeatherMap provides.
+ */
+static constexpr icon_name_t conditionIcon(condition_group_t group, int state)
+{
+  const bool day    = state & COND_DAY;
+  const bool moon   = state & COND_MOON;
+  const bool cloudy = state & COND_CLOUDY;
+  const bool windy  = state & COND_WINDY;
+  switch (group)
+  {
+  case COND_THUNDERSTORM:
+    if (!cloudy && day)          {return wi_day_thunderstorm;}
+    if (!cloudy && !day && moon) {return wi_night_alt_thunderstorm;}
+    return wi_thunderstorm;
+  case COND_STORM_SHOWERS:
+    if (!cloudy && day)          {return wi_day_storm_showers;}
+    if (!cloudy && !day && moon) {return wi_night_alt_storm_showers;}
+    return wi_storm_showers;
+  case COND_SHOWERS:
+    if (!cloudy && day)          {return wi_day_showers;}
+    if (!cloudy && !day && moon) {return wi_night_alt_showers;}
+    return wi_showers;
+  case COND_RAIN:
+    if (!cloudy && day && windy)          {return wi_day_rain_wind;}
+    if (!cloudy && day)                   {return wi_day_rain;}
+    if (!cloudy && !day && moon && windy) {return wi_night_alt_rain_wind;}
+    if (!cloudy && !day && moon)          {return wi_night_alt_rain;}
+    if (windy)                            {return wi_rain_wind;}
+    return wi_rain;
+  case COND_RAIN_MIX:
+    if (!cloudy && day)          {return wi_day_rain_mix;}
+    if (!cloudy && !day && moon) {return wi_night_alt_rain_mix;}
+    return wi_rain_mix;
+  case COND_SNOW:
+    if (!cloudy && day && windy)          {return wi_day_snow_wind;}
+    if (!cloudy && day)                   {return wi_day_snow;}
+    if (!cloudy && !day && moon && windy) {return wi_night_alt_snow_wind;}
+    if (!cloudy && !day && moon)          {return wi_night_alt_snow;}
+    if (windy)                            {return wi_snow_wind;}
+    return wi_snow;
+  case COND_SLEET:
+    if (!cloudy && day)          {return wi_day_sleet;}
+    if (!cloudy && !day && moon) {return wi_night_alt_sleet;}
+    return wi_sleet;
+  case COND_FOG:
+    if (!cloudy && day)          {return wi_day_fog;}
+    if (!cloudy && !day && moon) {return wi_night_fog;}
+    return wi_fog;
+  case COND_SMOKE:
+    return wi_smoke;
+  case COND_HAZE:
+    if (day && !cloudy) {return wi_day_haze;}
+    return wi_dust;
+  case COND_SANDSTORM:
+    return wi_sandstorm;
+  case COND_DUST:
+    return wi_dust;
+  case COND_VOLCANO:
+    return wi_volcano;
+  case COND_SQUALL:
+    return wi_cloudy_gusts;
+  case COND_TORNADO:
+    return wi_tornado;
+  case COND_CLEAR:
+    if (windy)         {return wi_strong_wind;}
+    if (!day && moon)  {return wi_night_clear;}
+    if (!day && !moon) {return wi_stars;}
+    return wi_day_sunny;
+  case COND_FEW_CLOUDS:
+    if (windy)         {return wi_strong_wind;}
+    if (!day && moon)  {return wi_night_alt_partly_cloudy;}
+    if (!day && !moon) {return wi_stars;}
+    return wi_day_sunny_overcast;
+  case COND_CLOUDS:
+    if (windy && day)           {return wi_day_cloudy_gusts;}
+    if (windy && !day && moon)  {return wi_night_alt_cloudy_gusts;}
+    if (windy && !day && !moon) {return wi_cloudy_gusts;}
+    if (!day && moon)           {return wi_night_alt_cloudy;}
+    if (!day && !moon)          {return wi_cloud;}
+    return wi_day_cloudy;
+  case COND_OVERCAST:
+    if (windy) {return wi_cloudy_gusts;}
+    return wi_cloudy;
+  case COND_OTHER_THUNDERSTORM: return wi_thunderstorm;
+  case COND_OTHER_DRIZZLE:      return wi_showers;
+  case COND_OTHER_RAIN:         return wi_rain;
+  case COND_OTHER_SNOW:         return wi_snow;
+  case COND_OTHER_ATMOSPHERE:   return wi_fog;
+  case COND_OTHER_CLOUDS:       return wi_cloudy;
+  default:                      return wi_na;
+  }
+} // end conditionIcon
+
+// condition id - CONDITION_ID_MIN -> condition_group_t
+static constexpr auto CONDITION_GROUPS = [] {
+  std::array<uint8_t, CONDITION_ID_MAX - CONDITION_ID_MIN + 1> t{};
+  for (size_t i = 0; i < t.size(); ++i)
+  {
+    t[i] = conditionGroup(CONDITION_ID_MIN + i);
+  }
+  return t;
+}();
+
+// distinct icons returned by conditionIcon()
+static constexpr auto CONDITION_ICONS = [] {
+  std::array<icon_name_t, COND_GROUP_COUNT * COND_STATE_COUNT> all{};
+  size_t n = 0;
+  for (int g = 0; g < COND_GROUP_COUNT; ++g)
+  {
+    for (int s = 0; s < COND_STATE_COUNT; ++s)
+    {
+      const icon_name_t icon = conditionIcon(
+                                 static_cast<condition_group_t>(g), s);
+      size_t i = 0;
+      while (i < n && all[i] != icon)
+      {
+        ++i;
+      }
+      if (i == n)
+      {
+        all[n++] = icon;
+      }
+    }
+  }
+  return std::make_pair(all, n);
+}();
+static constexpr size_t CONDITION_NUM_ICONS = CONDITION_ICONS.second;
+
+// [condition_group_t][state] -> index into CONDITION_ICONS
+static constexpr auto CONDITION_ICON_INDEX = [] {
+  std::array<std::array<uint8_t, COND_STATE_COUNT>, COND_GROUP_COUNT> t{};
+  for (int g = 0; g < COND_GROUP_COUNT; ++g)
+  {
+    for (int s = 0; s < COND_STATE_COUNT; ++s)
+    {
+      const icon_name_t icon = conditionIcon(
+                                 static_cast<condition_group_t>(g), s);
+      uint8_t i = 0;
+      while (CONDITION_ICONS.first[i] != icon)
+      {
+        ++i;
+      }
+      t[g][s] = i;
+    }
+  }
+  return t;
+}();
+
+#ifndef ICON_ATLAS
+// [index into CONDITION_ICONS][size index] -> bitmap
+static constexpr auto CONDITION_BITMAPS = [] {
+  std::array<std::array<const uint8_t *, CONDITION_NUM_SIZES>,
+             CONDITION_NUM_ICONS> t{};
+  for (size_t i = 0; i < CONDITION_NUM_ICONS; ++i)
+  {
+    for (int s = 0; s < CONDITION_NUM_SIZES; ++s)
+    {
+      t[i][s] = getBitmap(CONDITION_ICONS.first[i], CONDITION_SIZES[s]);
+    }
+  }
+  return t;
+}();
+#endif
+
+/* Returns the index into CONDITION_ICONS of the icon for a weather condition.
+ * O(1), two table lookups.
+ */
+static inline uint8_t getConditionsIconIndex(int id, bool day, bool moon,
+                                             bool cloudy, bool windy)
+{
+  const int group = (id >= CONDITION_ID_MIN && id <= CONDITION_ID_MAX)
+                    ? CONDITION_GROUPS[id - CONDITION_ID_MIN]
+                    : static_cast<int>(COND_NA);
+  const int state = (day    ? COND_DAY    : 0)
+                  | (moon   ? COND_MOON   : 0)
+                  | (cloudy ? COND_CLOUDY : 0)
+                  | (windy  ? COND_WINDY  : 0);
+  return CONDITION_ICON_INDEX[group][state];
+} // end getConditionsIconIndex
+
+/* Returns the icon for an OpenWeatherMap condition id and the time of day,
+ * moon, cloud and wind state.
+ */
+icon_name_t getConditionsIcon(int id, bool day, bool moon, bool cloudy,
+                              bool windy)
+{
+  return CONDITION_ICONS.first[getConditionsIconIndex(id, day, moon, cloudy,
+                                                      windy)];
+} // end getConditionsIcon
+
+/* Returns a pointer to the size x size bitmap of the icon for an
+ * OpenWeatherMap condition id and the time of day, moon, cloud and wind state.
+ */
+const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
+                                   bool windy, size_t size)
+{
+  const uint8_t i = getConditionsIconIndex(id, day, moon, cloudy, windy);
+#ifndef ICON_ATLAS
+  for (int s = 0; s < CONDITION_NUM_SIZES; ++s)
+  {
+    if (CONDITION_SIZES[s] == size)
+    {
+      return CONDITION_BITMAPS[i][s];
+    }
+  }
+#endif
+  return getBitmap(CONDITION_ICONS.first[i], size);
+} // end getConditionsBitmap
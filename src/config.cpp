@@ -98,6 +98,14 @@ const String OWM_ENDPOINT = "api.openweathermap.org";
 //   day (no more than)" to 1,000. This ensures you will never overrun the free
 //   calls.
 const String OWM_ONECALL_VERSION = "2.5";
+// Alerts are requested from the One Call API of this server separately (only
+// when DISPLAY_ALERTS is enabled). Any server that answers
+// /data/<OWM_ONECALL_VERSION>/onecall with a One Call style "alerts" array can
+// stand in, e.g. one that relays a national weather service. Empty by default,
+// which skips the request: OpenWeatherMap has retired One Call 2.5 and every
+// wake would pay for a failing HTTPS request. Set it to OWM_ENDPOINT to get
+// alerts from a One Call 3.0 subscription.
+const String OWM_ALERTS_ENDPOINT = "";
 
 // LOCATION
 // Set your latitude and longitude.
@@ -157,6 +165,14 @@ const int WAKE_TIME = 06; // Hour of first update after BED_TIME, 06:00.
 // SLEEP_DURATION = 1440, and you can set the time it should update each day by
 // setting both BED_TIME and WAKE_TIME to the hour you want it to update.
 
+// Adaptive refresh (ADAPTIVE_REFRESH in config.h).
+// SLEEP_DURATION becomes the nominal interval: calm weather stretches it up to
+// 1.5x, volatile weather shortens it down to MIN_SLEEP_DURATION, and the
+// battery budget or a low battery can stretch it up to MAX_SLEEP_DURATION.
+// Updates are aligned to multiples of MIN_SLEEP_DURATION past WAKE_TIME.
+const int MIN_SLEEP_DURATION = 15;  // minutes
+const int MAX_SLEEP_DURATION = 180; // minutes
+
 // HOURLY OUTLOOK GRAPH
 // Number of hours to display on the outlook graph. (range: [8-48])
 const int HOURLY_GRAPH_MAX = 24;
@@ -177,6 +193,14 @@ const unsigned long VERY_LOW_BATTERY_SLEEP_INTERVAL = 120; // (minutes)
 // Battery voltage calculations are based on a typical 3.7v LiPo.
 const uint32_t MAX_BATTERY_VOLTAGE = 4200; // (millivolts)
 const uint32_t MIN_BATTERY_VOLTAGE = 3000; // (millivolts)
+// The indoor sensors are sampled with the precise acquisition profile above
+// PRECISE_SENSOR_BATTERY_VOLTAGE and with the fast profile at or below
+// WARN_BATTERY_VOLTAGE. See sensor_measurement.h.
+const uint32_t PRECISE_SENSOR_BATTERY_VOLTAGE = 3850; // (millivolts) ~80%
+// With ADAPTIVE_REFRESH, updates are spaced so that a full battery of
+// BATTERY_CAPACITY lasts at least TARGET_BATTERY_LIFE days.
+const uint32_t BATTERY_CAPACITY = 2000; // (milliamp hours)
+const int TARGET_BATTERY_LIFE = 60;     // (days)
 
 #ifdef MQTT_OTA_UPGRADE
 // MQTT OTA UPGRADE CONFIGURATION
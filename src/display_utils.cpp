@@ -15,7 +15,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <Arduino.h>
 #include <driver/adc.h>
@@ -25,77 +27,96 @@
 
 #include "_locale.h"
 #include "_strftime.h"
+#include "alert_classifier.h"
 #include "api_response.h"
+#include "battery_monitor.h"
+#include "condition_icons.h"
 #include "config.h"
 #include "display_utils.h"
+#include "raster.h"
+#include "tlog.h"
 
 // icon header files
 #include "icons/icons.h"
 
+// The eFuse ADC characterization does not change, it is read once and kept in
+// RTC memory across deep sleep along with the filtered battery voltage.
+RTC_DATA_ATTR static esp_adc_cal_characteristics_t adcChars;
+RTC_DATA_ATTR static bool adcCharsValid = false;
+RTC_DATA_ATTR static battery_filter_t batteryFilter;
+
 /* Returns battery voltage in millivolts (mv).
+ * The ADC is sampled once per wake, later calls return the same reading. The
+ * reading is the trimmed mean of BATTERY_ADC_SAMPLES conversions, filtered
+ * across wakes.
  */
 uint32_t readBatteryVoltage()
 {
-  esp_adc_cal_characteristics_t adc_chars;
-  // __attribute__((unused)) disables compiler warnings about this variable
-  // being unused (Clang, GCC) which is the case when DEBUG_LEVEL == 0.
-  esp_adc_cal_value_t val_type __attribute__((unused));
-  adc_power_acquire();
-  uint16_t adc_val = analogRead(PIN_BAT_ADC);
-  adc_power_release();
-
-  // We will use the eFuse ADC calibration bits, to get accurate voltage
-  // readings. The DFRobot FireBeetle Esp32-E V1.0's ADC is 12 bit, and uses
-  // 11db attenuation, which gives it a measurable input voltage range of 150mV
-  // to 2450mV.
-  val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_11db,
-                                      ADC_WIDTH_BIT_12, 1100, &adc_chars);
-
-#if DEBUG_LEVEL >= 1
-  if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
+  static bool sampled = false;
+  static uint32_t batteryVoltage = 0;
+  if (sampled)
   {
-    Serial.println("[debug] ADC Cal eFuse Vref");
+    return batteryVoltage;
   }
-  else if (val_type == ESP_ADC_CAL_VAL_EFUSE_TP)
+
+  uint16_t adc_val[BATTERY_ADC_SAMPLES];
+  adc_power_acquire();
+  for (int i = 0; i < BATTERY_ADC_SAMPLES; ++i)
   {
-    Serial.println("[debug] ADC Cal Two Point");
+    adc_val[i] = analogRead(PIN_BAT_ADC);
   }
-  else
+  adc_power_release();
+
+  if (!adcCharsValid)
   {
-    Serial.println("[debug] ADC Cal Default");
-  }
+    // We will use the eFuse ADC calibration bits, to get accurate voltage
+    // readings. The DFRobot FireBeetle Esp32-E V1.0's ADC is 12 bit, and uses
+    // 11db attenuation, which gives it a measurable input voltage range of
+    // 150mV to 2450mV.
+    // __attribute__((unused)) disables compiler warnings about this variable
+    // being unused (Clang, GCC) which is the case when DEBUG_LEVEL == 0.
+    esp_adc_cal_value_t val_type __attribute__((unused));
+    val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_11db,
+                                        ADC_WIDTH_BIT_12, 1100, &adcChars);
+    adcCharsValid = true;
+
+#if DEBUG_LEVEL >= 1
+    if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
+    {
+      TLOG("[debug] ADC Cal eFuse Vref");
+    }
+    else if (val_type == ESP_ADC_CAL_VAL_EFUSE_TP)
+    {
+      TLOG("[debug] ADC Cal Two Point");
+    }
+    else
+    {
+      TLOG("[debug] ADC Cal Default");
+    }
 #endif
+  }
 
-  uint32_t batteryVoltage = esp_adc_cal_raw_to_voltage(adc_val, &adc_chars);
+  uint32_t measured = esp_adc_cal_raw_to_voltage(
+                        trimmedMean(adc_val, BATTERY_ADC_SAMPLES), &adcChars);
   // DFRobot FireBeetle Esp32-E V1.0 voltage divider (1M+1M), so readings are
   // multiplied by 2.
-  batteryVoltage *= 2;
+  measured *= 2;
+  batteryVoltage = updateBatteryFilter(batteryFilter, measured);
+  sampled = true;
+
+#if DEBUG_LEVEL >= 1
+  TLOG("[debug] Battery measured %umv, filtered %umv", measured,
+       batteryVoltage);
+#endif
   return batteryVoltage;
 } // end readBatteryVoltage
 
 /* Returns battery percentage, rounded to the nearest integer.
- * Takes a voltage in millivolts and uses a sigmoidal approximation to find an
- * approximation of the battery life percentage remaining.
- * 
- * This function contains LGPLv3 code from 
- * <https://github.com/rlogiacco/BatterySense>.
- * 
- * Symmetric sigmoidal approximation
- * <https://www.desmos.com/calculator/7m9lu26vpy>
- *
- * c - c / (1 + k*x/v)^3
+ * See batteryPercent().
  */
 uint32_t calcBatPercent(uint32_t v, uint32_t minv, uint32_t maxv)
 {
-  // slow
-  //uint32_t p = 110 - (110 / (1 + pow(1.468 * (v - minv)/(maxv - minv), 6)));
-
-  // steep
-  //uint32_t p = 102 - (102 / (1 + pow(1.621 * (v - minv)/(maxv - minv), 8.1)));
-
-  // normal
-  uint32_t p = 105 - (105 / (1 + pow(1.724 * (v - minv)/(maxv - minv), 5.5)));
-  return p >= 100 ? 100 : p;
+  return batteryPercent(v, minv, maxv);
 } // end calcBatPercent
 
 /* Returns 24x24 bitmap incidcating battery status.
@@ -195,40 +216,64 @@ void toTitleCase(String &text)
   return;
 } // end toTitleCase
 
-/* Takes a String and truncates at any of these characters ,.( and trims any
- * trailing whitespace.
- *
- * Ex:
- *   input   : "Severe Thunderstorm Warning, (Starting At 10 Pm)"
- *   becomes : "Severe Thunderstorm Warning"
+/* Returns the length text is truncated to by truncateExtraAlertInfo.
  */
-void truncateExtraAlertInfo(String &text)
+static unsigned int extraAlertInfoStart(const char *text, unsigned int len)
 {
-  if (text.isEmpty())
+  if (len == 0)
   {
-    return;
+    return 0;
   }
 
-  int i = 1;
-  int lastChar = i;
-  while (i < text.length()
-    && text.charAt(i) != ','
-    && text.charAt(i) != '.'
-    && text.charAt(i) != '(')
+  unsigned int i = 1;
+  unsigned int lastChar = i;
+  while (i < len
+    && text[i] != ','
+    && text[i] != '.'
+    && text[i] != '(')
   {
-    if (text.charAt(i) != ' ')
+    if (text[i] != ' ')
     {
       lastChar = i + 1;
     }
     ++i;
   }
+  return lastChar;
+} // end extraAlertInfoStart
 
-  text = text.substring(0, lastChar);
+/* Takes a String and truncates at any of these characters ,.( and trims any
+ * trailing whitespace.
+ *
+ * Ex:
+ *   input   : "Severe Thunderstorm Warning, (Starting At 10 Pm)"
+ *   becomes : "Severe Thunderstorm Warning"
+ */
+void truncateExtraAlertInfo(String &text)
+{
+  text = text.substring(0, extraAlertInfoStart(text.c_str(), text.length()));
   return;
 } // end truncateExtraAlertInfo
 
-/* Returns the urgency of an event based by checking if the event String
- * contains any indicator keywords.
+// Alert terminology matches carry one bit per category in the order of enum
+// alert_category (earlier categories take precedence) and the ALERT_URGENCY
+// keywords in the bits above. (see tools/alert_terms.py)
+static const int ALERT_URGENCY_SHIFT = alert_category::STRONG_WIND + 1;
+static const uint32_t ALERT_CATEGORY_MASK = (1UL << ALERT_URGENCY_SHIFT) - 1;
+
+/* Returns the category of the lowest bit set in the category bits of a match,
+ * or NOT_FOUND.
+ */
+static enum alert_category matchedCategory(uint32_t found)
+{
+  found &= ALERT_CATEGORY_MASK;
+  if (found == 0)
+  {
+    return alert_category::NOT_FOUND;
+  }
+  return static_cast<enum alert_category>(__builtin_ctz(found));
+} // end matchedCategory
+
+/* Returns the urgency of the highest bit set in the urgency bits of a match.
  *
  * Urgency keywords are defined in config.h because they are very regional.
  *   ex: United States - (Watch < Advisory < Warning)
@@ -238,21 +283,70 @@ void truncateExtraAlertInfo(String &text)
  * is returned.
  * In the United States example, Watch = 0, Advisory = 1, Warning = 2
  */
-int eventUrgency(const String &event)
+static int matchedUrgency(uint32_t found)
 {
-  int urgency_lvl = -1;
-  for (int i = 0; i < ALERT_URGENCY.size(); ++i)
+  found >>= ALERT_URGENCY_SHIFT;
+  if (found == 0)
   {
-    if (event.indexOf(ALERT_URGENCY[i]) >= 0)
-    {
-      urgency_lvl = i;
-    }
+    return -1;
+  }
+  return 31 - __builtin_clz(found);
+} // end matchedUrgency
+
+/* Returns a hash of an alert's tags that ignores ASCII case, or 0 if it has no
+ * tags. (FNV-1a)
+ */
+static uint32_t alertTagHash(const char *tags)
+{
+  if (*tags == '\0')
+  {
+    return 0;
   }
-  return urgency_lvl;
-} // end eventUrgency
+  uint32_t h = 2166136261u;
+  for (const char *c = tags; *c != '\0'; ++c)
+  {
+    h = (h ^ static_cast<uint8_t>(toLowerCase(*c))) * 16777619u;
+  }
+  return h != 0 ? h : 1;
+} // end alertTagHash
 
-/* This algorithm filters alerts from the API responses to be displayed by
- * marking the corresponding index in the ignore list.
+/* Computes the summary of an alert once, in a single pass over its event name:
+ * category, urgency, tag hash and the length of the event name without extra
+ * information. (see truncateExtraAlertInfo)
+ *
+ * The category is determined by the part of the event name that is kept, the
+ * urgency by the whole event name. Both ignore ASCII case. Alerts whose event
+ * name has no known terminology fall back to the terminology found in their
+ * description, if any.
+ */
+void summarizeAlert(owm_resp_alerts_t &alerts, int i)
+{
+  owm_alerts_t &alert = alerts.alert[i];
+  alert_summary_t &s = alert.summary;
+  if (s.valid)
+  {
+    return;
+  }
+  const char *event = alerts.text + alert.event;
+  const unsigned int len = strlen(event);
+  const unsigned int eventLen = extraAlertInfoStart(event, len);
+  const uint32_t found = matchAlertTerms(ALERT_MATCHER, event, len,
+                                         eventLen, ~ALERT_CATEGORY_MASK);
+  s.category  = matchedCategory(found);
+  if (s.category == alert_category::NOT_FOUND)
+  {
+    s.category = matchedCategory(alert.description_terms);
+  }
+  s.urgency   = matchedUrgency(found);
+  s.tag_hash  = alertTagHash(alerts.text + alert.tags);
+  s.event_len = eventLen < UINT16_MAX ? eventLen : UINT16_MAX;
+  s.valid     = true;
+  return;
+} // end summarizeAlert
+
+/* This algorithm selects the alerts from the API responses to be displayed and
+ * stores their indices into alerts.alert in selected, most recently issued
+ * first.
  *
  * Background:
  * The display layout is setup to show up to 2 alerts, but alerts can be
@@ -267,80 +361,108 @@ int eventUrgency(const String &event)
  * urgent keyword and the last index is the most urgent keyword. Expected as all
  * lowercase.
  *
+ * Only the first OWM_NUM_ALERTS alerts are considered, so the time taken is
+ * bounded, and nothing is allocated.
+ *
  *
  * Pseudo Code:
- * Convert all event text and tags to lowercase.
+ * Summarize each alert's category, urgency and tags. (see summarizeAlert)
  *
  * // Deduplicate alerts of the same type
  * Dedup alerts with the same first tag. (ie. tag 0) Keeping only the most
- *   urgent alerts of each tag and alerts who's urgency cannot be determined.
+ *   urgent alert of each tag, the first one if several are equally urgent,
+ *   and alerts who's urgency cannot be determined. A small hash table maps
+ *   each tag to its most urgent alert so far.
  * Note: urgency keywords are defined in config.h because they are very
  *       regional. ex: United States - (Watch < Advisory < Warning)
  *
  * // Save only the 2 most recent alerts
  * If (more than 2 weather alerts remain)
  *   Keep only the 2 most recently issued alerts (aka greatest "start" time)
- *   OpenWeatherMap provides this order, so we can just take index 0 and 1.
+ *   OpenWeatherMap provides this order, ties are broken by that order.
  *
- * Truncate Extraneous Info (anything that follows a comma, period, or open
- *   parentheses)
+ * The event name without extraneous info (anything that follows a comma,
+ * period, or open parentheses) is summary.event_len characters long.
+ *
+ * Returns the number of selected alerts (0 to 2).
  */
-void filterAlerts(std::vector<owm_alerts_t> &resp, int *ignore_list)
+int filterAlerts(owm_resp_alerts_t &alerts, int selected[2])
 {
-  // Convert all event text and tags to lowercase.
-  for (auto &alert : resp)
+  const owm_alerts_t *resp = alerts.alert;
+  const int n = std::min(alerts.count, OWM_NUM_ALERTS);
+  for (int i = 0; i < n; ++i)
   {
-    alert.event.toLowerCase();
-    alert.tags.toLowerCase();
-  }
-
-  // Deduplicate alerts with the same first tag. Keeping only the most urgent
-  // alerts of each tag and alerts who's urgency cannot be determined.
-  for (int i = 0; i < resp.size(); ++i)
+    summarizeAlert(alerts, i);
+  }
+
+  // Deduplicate alerts with the same first tag. Open addressing, the table is
+  // never more than half full.
+  const int TAG_SLOTS = 2 * OWM_NUM_ALERTS;
+  static_assert((TAG_SLOTS & (TAG_SLOTS - 1)) == 0,
+                "TAG_SLOTS must be a power of 2");
+  int8_t tagSlots[TAG_SLOTS];
+  memset(tagSlots, -1, sizeof(tagSlots));
+  bool keep[OWM_NUM_ALERTS];
+  for (int i = 0; i < n; ++i)
   {
-    if (ignore_list[i] == 1)
-    {
-      continue;
-    }
-    if (resp[i].tags.isEmpty())
+    const alert_summary_t &s = resp[i].summary;
+    keep[i] = true;
+    if (s.tag_hash == 0)
     {
       continue; // urgency can not be determined so it remains in the list
     }
 
-    for (int j = 0; j < resp.size(); ++j)
+    int slot = s.tag_hash & (TAG_SLOTS - 1);
+    while (tagSlots[slot] >= 0)
     {
-      if (i != j && resp[i].tags == resp[j].tags)
+      const owm_alerts_t &other = resp[tagSlots[slot]];
+      if (other.summary.tag_hash == s.tag_hash
+       && strcasecmp(alerts.text + other.tags,
+                     alerts.text + resp[i].tags) == 0)
       {
-        // comparing alerts of the same tag, removing the less urgent alert
-        if (eventUrgency(resp[i].event) >= eventUrgency(resp[j].event))
-        {
-          ignore_list[j] = 1;
-        }
+        break;
       }
+      slot = (slot + 1) & (TAG_SLOTS - 1);
     }
-  }
-
-  // Save only the 2 most recent alerts
-  int valid_cnt = 0;
-  for (int i = 0; i < resp.size(); ++i)
-  {
-    if (valid_cnt < 2 && !ignore_list[i])
+    const int best = tagSlots[slot];
+    if (best < 0)
     {
-      ++valid_cnt;
+      tagSlots[slot] = i;
+    }
+    else if (s.urgency > resp[best].summary.urgency)
+    { // comparing alerts of the same tag, removing the less urgent alert
+      keep[best] = false;
+      tagSlots[slot] = i;
     }
     else
     {
-      ignore_list[i] = 1;
+      keep[i] = false;
     }
   }
 
-  // Remove trailing/extraneous information
-  for (auto &alert : resp)
+  // Save only the 2 most recent alerts
+  int count = 0;
+  for (int i = 0; i < n; ++i)
   {
-    truncateExtraAlertInfo(alert.event);
+    if (!keep[i])
+    {
+      continue;
+    }
+    if (count < 2)
+    {
+      selected[count++] = i;
+    }
+    else if (resp[i].start > resp[selected[1]].start)
+    {
+      selected[1] = i;
+    }
+    if (count == 2 && resp[selected[1]].start > resp[selected[0]].start)
+    {
+      std::swap(selected[0], selected[1]);
+    }
   }
 
-  return;
+  return count;
 } // end filterAlerts
 
 /* Returns the descriptor text for the given UV index.
@@ -369,6 +491,14 @@ const char *getUVIdesc(unsigned int uvi)
   }
 } // end getUVIdesc
 
+/* Returns the Air Quality Index on the locale's scale, from the pollutant
+ * windows built when the response was deserialized.
+ */
+int getAQI(const owm_resp_air_pollution_t &p)
+{
+  return calc_aqi_windows(AQI_SCALE, &p.windows);
+} // end getAQI
+
 /* Returns the wifi signal strength descriptor text for the given RSSI.
  */
 const char *getWiFidesc(int rssi)
@@ -463,169 +593,13 @@ bool isWindy(float wind_speed, float wind_gust) {
       || wind_gust  >= 40.2 /*m/s*/);
 }
 
-/* Takes the current weather and today's daily weather forcast (from
- * OpenWeatherMap API response) and returns a pointer to the icon's 196x196
- * bitmap.
- *
- * Uses multiple factors to return more detailed icons than the simple icon
- * catagories that OpenWeatherMap provides.
- *
- * Last Updated: June 26, 2022
- *
- * References:
- *   https://openweathermap.org/weather-conditions
- */
-template <int BitmapSize>
-const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
-                                   bool windy)
-{
-  switch (id)
-  {
-  // Group 2xx: Thunderstorm
-  case 200: // Thunderstorm  thunderstorm with light rain     11d
-  case 201: // Thunderstorm  thunderstorm with rain           11d
-  case 202: // Thunderstorm  thunderstorm with heavy rain     11d
-  case 210: // Thunderstorm  light thunderstorm               11d
-  case 211: // Thunderstorm  thunderstorm                     11d
-  case 212: // Thunderstorm  heavy thunderstorm               11d
-  case 221: // Thunderstorm  ragged thunderstorm              11d
-    if (!cloudy && day)          {return getBitmap(wi_day_thunderstorm, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_thunderstorm, BitmapSize);}
-    return getBitmap(wi_thunderstorm, BitmapSize);
-  case 230: // Thunderstorm  thunderstorm with light drizzle  11d
-  case 231: // Thunderstorm  thunderstorm with drizzle        11d
-  case 232: // Thunderstorm  thunderstorm with heavy drizzle  11d
-    if (!cloudy && day)          {return getBitmap(wi_day_storm_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_storm_showers, BitmapSize);}
-    return getBitmap(wi_storm_showers, BitmapSize);
-  // Group 3xx: Drizzle
-  case 300: // Drizzle       light intensity drizzle          09d
-  case 301: // Drizzle       drizzle                          09d
-  case 302: // Drizzle       heavy intensity drizzle          09d
-  case 310: // Drizzle       light intensity drizzle rain     09d
-  case 311: // Drizzle       drizzle rain                     09d
-  case 312: // Drizzle       heavy intensity drizzle rain     09d
-  case 313: // Drizzle       shower rain and drizzle          09d
-  case 314: // Drizzle       heavy shower rain and drizzle    09d
-  case 321: // Drizzle       shower drizzle                   09d
-    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
-    return getBitmap(wi_showers, BitmapSize);
-  // Group 5xx: Rain
-  case 500: // Rain          light rain                       10d
-  case 501: // Rain          moderate rain                    10d
-  case 502: // Rain          heavy intensity rain             10d
-  case 503: // Rain          very heavy rain                  10d
-  case 504: // Rain          extreme rain                     10d
-    if (!cloudy && day && windy)          {return getBitmap(wi_day_rain_wind, BitmapSize);}
-    if (!cloudy && day)                   {return getBitmap(wi_day_rain, BitmapSize);}
-    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_rain_wind, BitmapSize);}
-    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_rain, BitmapSize);}
-    if (windy)                            {return getBitmap(wi_rain_wind, BitmapSize);}
-    return getBitmap(wi_rain, BitmapSize);
-  case 511: // Rain          freezing rain                    13d
-    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
-    return getBitmap(wi_rain_mix, BitmapSize);
-  case 520: // Rain          light intensity shower rain      09d
-  case 521: // Rain          shower rain                      09d
-  case 522: // Rain          heavy intensity shower rain      09d
-  case 531: // Rain          ragged shower rain               09d
-    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
-    return getBitmap(wi_showers, BitmapSize);
-  // Group 6xx: Snow
-  case 600: // Snow          light snow                       13d
-  case 601: // Snow          Snow                             13d
-  case 602: // Snow          Heavy snow                       13d
-    if (!cloudy && day && windy)          {return getBitmap(wi_day_snow_wind, BitmapSize);}
-    if (!cloudy && day)                   {return getBitmap(wi_day_snow, BitmapSize);}
-    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_snow_wind, BitmapSize);}
-    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_snow, BitmapSize);}
-    if (windy)                            {return getBitmap(wi_snow_wind, BitmapSize);}
-    return getBitmap(wi_snow, BitmapSize);
-  case 611: // Snow          Sleet                            13d
-  case 612: // Snow          Light shower sleet               13d
-  case 613: // Snow          Shower sleet                     13d
-    if (!cloudy && day)          {return getBitmap(wi_day_sleet, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_sleet, BitmapSize);}
-    return getBitmap(wi_sleet, BitmapSize);
-  case 615: // Snow          Light rain and snow              13d
-  case 616: // Snow          Rain and snow                    13d
-  case 620: // Snow          Light shower snow                13d
-  case 621: // Snow          Shower snow                      13d
-  case 622: // Snow          Heavy shower snow                13d
-    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
-    return getBitmap(wi_rain_mix, BitmapSize);
-  // Group 7xx: Atmosphere
-  case 701: // Mist          mist                             50d
-    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
-    return getBitmap(wi_fog, BitmapSize);
-  case 711: // Smoke         Smoke                            50d
-    return getBitmap(wi_smoke, BitmapSize);
-  case 721: // Haze          Haze                             50d
-    if (day && !cloudy) {return getBitmap(wi_day_haze, BitmapSize);}
-    return getBitmap(wi_dust, BitmapSize);
-  case 731: // Dust          sand/dust whirls                 50d
-    return getBitmap(wi_sandstorm, BitmapSize);
-  case 741: // Fog           fog                              50d
-    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
-    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
-    return getBitmap(wi_fog, BitmapSize);
-  case 751: // Sand          sand                             50d
-    return getBitmap(wi_sandstorm, BitmapSize);
-  case 761: // Dust          dust                             50d
-    return getBitmap(wi_dust, BitmapSize);
-  case 762: // Ash           volcanic ash                     50d
-    return getBitmap(wi_volcano, BitmapSize);
-  case 771: // Squall        squalls                          50d
-    return getBitmap(wi_cloudy_gusts, BitmapSize);
-  case 781: // Tornado       tornado                          50d
-    return getBitmap(wi_tornado, BitmapSize);
-  // Group 800: Clear
-  case 800: // Clear         clear sky                        01d 01n
-    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
-    if (!day && moon)  {return getBitmap(wi_night_clear, BitmapSize);}
-    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
-    return getBitmap(wi_day_sunny, BitmapSize);
-  // Group 80x: Clouds
-  case 801: // Clouds        few clouds: 11-25%               02d 02n
-    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
-    if (!day && moon)  {return getBitmap(wi_night_alt_partly_cloudy, BitmapSize);}
-    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
-    return getBitmap(wi_day_sunny_overcast, BitmapSize);
-  case 802: // Clouds        scattered clouds: 25-50%         03d 03n
-  case 803: // Clouds        broken clouds: 51-84%            04d 04n
-    if (windy && day)           {return getBitmap(wi_day_cloudy_gusts, BitmapSize);}
-    if (windy && !day && moon)  {return getBitmap(wi_night_alt_cloudy_gusts, BitmapSize);}
-    if (windy && !day && !moon) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
-    if (!day && moon)           {return getBitmap(wi_night_alt_cloudy, BitmapSize);}
-    if (!day && !moon)          {return getBitmap(wi_cloud, BitmapSize);}
-    return getBitmap(wi_day_cloudy, BitmapSize);
-  case 804: // Clouds        overcast clouds: 85-100%         04d 04n
-    if (windy) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
-    return getBitmap(wi_cloudy, BitmapSize);
-  default:
-    // maybe this is a new getBitmap in one of the existing groups
-    if (id >= 200 && id < 300) {return getBitmap(wi_thunderstorm, BitmapSize);}
-    if (id >= 300 && id < 400) {return getBitmap(wi_showers, BitmapSize);}
-    if (id >= 500 && id < 600) {return getBitmap(wi_rain, BitmapSize);}
-    if (id >= 600 && id < 700) {return getBitmap(wi_snow, BitmapSize);}
-    if (id >= 700 && id < 800) {return getBitmap(wi_fog, BitmapSize);}
-    if (id >= 800 && id < 900) {return getBitmap(wi_cloudy, BitmapSize);}
-    return getBitmap(wi_na, BitmapSize);
-  }
-} // end getConditionsBitmap
-
-/* Takes the daily weather forecast (from OpenWeatherMap API response) and
- * returns a pointer to the icon's 32x32 bitmap.
+/* Takes the hourly weather forecast (from OpenWeatherMap API response) and
+ * returns its icon.
  *
  * The daily weather forcast of today is needed for moonrise and moonset times.
  */
-const uint8_t *getHourlyForecastBitmap32(const owm_hourly_t &hourly,
-                                         const owm_daily_t  &today)
+icon_name_t getHourlyForecastIcon(const owm_hourly_t &hourly,
+                                  const owm_daily_t  &today)
 {
   const int id = hourly.weather.id;
   const bool day = isDay(hourly.weather.icon);
@@ -633,13 +607,13 @@ const uint8_t *getHourlyForecastBitmap32(const owm_hourly_t &hourly,
                                 today.moon_phase);
   const bool cloudy = isCloudy(hourly.clouds);
   const bool windy = isWindy(hourly.wind_speed, hourly.wind_gust);
-  return getConditionsBitmap<32>(id, day, moon, cloudy, windy);
+  return getConditionsIcon(id, day, moon, cloudy, windy);
 }
 
 /* Takes the daily weather forecast (from OpenWeatherMap API response) and
- * returns a pointer to the icon's 64x64 bitmap.
+ * returns its icon.
  */
-const uint8_t *getDailyForecastBitmap64(const owm_daily_t &daily)
+icon_name_t getDailyForecastIcon(const owm_daily_t &daily)
 {
   const int id = daily.weather.id;
   // always show daytime icon for daily forecast
@@ -647,17 +621,16 @@ const uint8_t *getDailyForecastBitmap64(const owm_daily_t &daily)
   const bool moon = false;
   const bool cloudy = isCloudy(daily.clouds);
   const bool windy = isWindy(daily.wind_speed, daily.wind_gust);
-  return getConditionsBitmap<64>(id, day, moon, cloudy, windy);
-} // end getForecastBitmap64
+  return getConditionsIcon(id, day, moon, cloudy, windy);
+} // end getDailyForecastIcon
 
 /* Takes the current weather and today's daily weather forcast (from
- * OpenWeatherMap API response) and returns a pointer to the icon's 196x196
- * bitmap.
+ * OpenWeatherMap API response) and returns the icon of the current conditions.
  * 
  * The daily weather forcast of today is needed for moonrise and moonset times.
  */
-const uint8_t *getCurrentConditionsBitmap196(const owm_current_t &current,
-                                             const owm_daily_t   &today)
+icon_name_t getCurrentConditionsIcon(const owm_current_t &current,
+                                     const owm_daily_t   &today)
 {
   const int id = current.weather.id;
   const bool day = isDay(current.weather.icon);
@@ -665,8 +638,8 @@ const uint8_t *getCurrentConditionsBitmap196(const owm_current_t &current,
                                 today.moon_phase);
   const bool cloudy = isCloudy(current.clouds);
   const bool windy = isWindy(current.wind_speed, current.wind_gust);
-  return getConditionsBitmap<196>(id, day, moon, cloudy, windy);
-} // end getCurrentConditionsBitmap196
+  return getConditionsIcon(id, day, moon, cloudy, windy);
+} // end getCurrentConditionsIcon
 
 /* Returns a 32x32 bitmap for a given alert.
  *
@@ -760,127 +733,20 @@ const uint8_t *getAlertBitmap48(const owm_alerts_t &alert)
   }
 } // end getAlertBitmap48
 
-/* Returns true of a String, s, contains any of the strings in the terminology
- * vector.
- *
- * Note: This function is case sensitive.
- */
-bool containsTerminology(const String s, const std::vector<String> &terminology)
-{
-  for (const String &term : terminology)
-  {
-    if (s.indexOf(term) >= 0)
-    {
-      return true;
-    }
-  }
-  return false;
-} // end containsTerminology
-
 /* Returns the category of an alert based on the terminology found in the event
  * name.
  *
  * Weather alert terminology is defined in the included locale header.
+ * The category is computed by summarizeAlert, NOT_FOUND is returned for alerts
+ * that have not been summarized.
  */
 enum alert_category getAlertCategory(const owm_alerts_t &alert)
 {
-  if (containsTerminology(alert.event, TERM_SMOG))
-  {
-    return alert_category::SMOG;
-  }
-  if (containsTerminology(alert.event, TERM_SMOKE))
-  {
-    return alert_category::SMOKE;
-  }
-  if (containsTerminology(alert.event, TERM_FOG))
-  {
-    return alert_category::FOG;
-  }
-  if (containsTerminology(alert.event, TERM_METEOR))
-  {
-    return alert_category::METEOR;
-  }
-  if (containsTerminology(alert.event, TERM_NUCLEAR))
+  if (!alert.summary.valid)
   {
-    return alert_category::NUCLEAR;
+    return alert_category::NOT_FOUND;
   }
-  if (containsTerminology(alert.event, TERM_BIOHAZARD))
-  {
-    return alert_category::BIOHAZARD;
-  }
-  if (containsTerminology(alert.event, TERM_EARTHQUAKE))
-  {
-    return alert_category::EARTHQUAKE;
-  }
-  if (containsTerminology(alert.event, TERM_FIRE))
-  {
-    return alert_category::FIRE;
-  }
-  if (containsTerminology(alert.event, TERM_HEAT))
-  {
-    return alert_category::HEAT;
-  }
-  if (containsTerminology(alert.event, TERM_WINTER))
-  {
-    return alert_category::WINTER;
-  }
-  if (containsTerminology(alert.event, TERM_TSUNAMI))
-  {
-    return alert_category::TSUNAMI;
-  }
-  if (containsTerminology(alert.event, TERM_LIGHTNING))
-  {
-    return alert_category::LIGHTNING;
-  }
-  if (containsTerminology(alert.event, TERM_SANDSTORM))
-  {
-    return alert_category::SANDSTORM;
-  }
-  if (containsTerminology(alert.event, TERM_FLOOD))
-  {
-    return alert_category::FLOOD;
-  }
-  if (containsTerminology(alert.event, TERM_VOLCANO))
-  {
-    return alert_category::VOLCANO;
-  }
-  if (containsTerminology(alert.event, TERM_AIR_QUALITY))
-  {
-    return alert_category::AIR_QUALITY;
-  }
-  if (containsTerminology(alert.event, TERM_TORNADO))
-  {
-    return alert_category::TORNADO;
-  }
-  if (containsTerminology(alert.event, TERM_SMALL_CRAFT_ADVISORY))
-  {
-    return alert_category::SMALL_CRAFT_ADVISORY;
-  }
-  if (containsTerminology(alert.event, TERM_GALE_WARNING))
-  {
-    return alert_category::GALE_WARNING;
-  }
-  if (containsTerminology(alert.event, TERM_STORM_WARNING))
-  {
-    return alert_category::STORM_WARNING;
-  }
-  if (containsTerminology(alert.event, TERM_HURRICANE_WARNING))
-  {
-    return alert_category::HURRICANE_WARNING;
-  }
-  if (containsTerminology(alert.event, TERM_HURRICANE))
-  {
-    return alert_category::HURRICANE;
-  }
-  if (containsTerminology(alert.event, TERM_DUST))
-  {
-    return alert_category::DUST;
-  }
-  if (containsTerminology(alert.event, TERM_STRONG_WIND))
-  {
-    return alert_category::STRONG_WIND;
-  }
-  return alert_category::NOT_FOUND;
+  return static_cast<enum alert_category>(alert.summary.category);
 } // end getAlertCategory
 
 #ifdef WIND_ICONS_CARDINAL
@@ -1322,10 +1188,20 @@ static const unsigned char *wind_direction_icon_arr[] = {
 /* Returns a 24x24 wind direction icon bitmap for angles 0 to 359 degrees
  * Parameter is meteorological wind direction, arrow points in the direction the
  * wind is going.
+ *
+ * With WIND_ICONS_ROTATED the bitmap is rendered into a static buffer, which is
+ * overwritten by the next call. (the frame hash covers the bitmap content, not
+ * its address, see frame_hash.h)
  */
 const uint8_t *getWindBitmap24(int windDeg)
 {
   windDeg %= 360; // enforce domain
+#ifdef WIND_ICONS_ROTATED
+  static uint8_t bitmap[24 * 24 / 8];
+  rotateBitmap1bpp(wind_direction_meteorological_0deg_48x48, bitmap, 24,
+                   windDeg);
+  return bitmap;
+#else
   // number of directions
   int n = sizeof(wind_direction_icon_arr)
           / sizeof(wind_direction_icon_arr[0]);
@@ -1333,6 +1209,7 @@ const uint8_t *getWindBitmap24(int windDeg)
                          / ( 360 / (float) n );
 
   return wind_direction_icon_arr[arr_offset];
+#endif
 } // end getWindBitmap24
 
 /* Returns a pointer to a string that expresses the Compass Point Notation (CPN)
@@ -5,27 +5,70 @@
 
 #include "dual_sensor_manager.h"
 #include "sensor_power_manager.h"
+#include "tlog.h"
+#include <WiFi.h>
+#include <esp_sleep.h>
+#include <new>
 
 // 全局实例
 DualSensorManager dualSensorManager;
 
-DualSensorManager::DualSensorManager() : i2c(nullptr), initialized(false) {
-#if defined(SENSOR_BMP280)
-  bmp280 = nullptr;
-#endif
-#if defined(SENSOR_AHT20)
-  aht20 = nullptr;
-#endif
+// 设备表，深度睡眠期间保留
+RTC_DATA_ATTR static SensorDeviceMap deviceMap;
+
+// I2C对象的静态存储。对象在initializeI2C()中用placement new构造，在
+// shutdown()中显式析构，不在堆上分配，避免在128KB JSON缓冲区分配之前
+// 产生堆碎片。传感器直接通过总线初始化，没有驱动对象。
+alignas(TwoWire) static uint8_t i2cStorage[sizeof(TwoWire)];
+
+// 各采集配置的实测耗时，深度睡眠期间累计
+struct ProfileTiming {
+  uint32_t count;
+  uint32_t elapsedMs; // 开始到完成，包括与WiFi等重叠的时间
+  uint32_t waitedMs;  // await()中等待的时间，即测量额外增加的唤醒时间
+};
+RTC_DATA_ATTR static ProfileTiming profileTimings[NUM_ACQUISITION_PROFILES];
+
+DualSensorManager::DualSensorManager()
+    : i2c(nullptr), measurementStart(0), initialized(false) {
+  setProfile(PROFILE_BALANCED);
 }
 
 DualSensorManager::~DualSensorManager() { shutdown(); }
 
+void DualSensorManager::setProfile(AcquisitionProfileId id) {
+  profileId = id < NUM_ACQUISITION_PROFILES ? id : PROFILE_BALANCED;
+  profile = getAcquisitionProfile(profileId);
+}
+
+void DualSensorManager::selectProfile(uint32_t batteryVoltage) {
+  // 未监测电池时电压为UINT32_MAX，使用默认配置
+  if (batteryVoltage == UINT32_MAX) {
+    setProfile(PROFILE_BALANCED);
+  } else if (batteryVoltage <= WARN_BATTERY_VOLTAGE) {
+    setProfile(PROFILE_FAST);
+  } else if (batteryVoltage >= PRECISE_SENSOR_BATTERY_VOLTAGE) {
+    setProfile(PROFILE_PRECISE);
+  } else {
+    setProfile(PROFILE_BALANCED);
+  }
+
+  TLOG("📐 采集配置: %s (预计%lu毫秒, %lu微库仑)", profile.name,
+       (unsigned long)profile.conversionMs,
+       (unsigned long)profile.chargeUc);
+}
+
+const AcquisitionProfile &DualSensorManager::getProfile() const {
+  return profile;
+}
+
 bool DualSensorManager::initialize() {
-  Serial.println("🌡️ 初始化双传感器管理系统...");
+  TLOG("🌡️ 初始化双传感器管理系统...");
+  logHeap("初始化前");
 
   // 确保传感器电源开启
   if (!sensorPowerManager.isPowerEnabled()) {
-    Serial.println("⚠️  传感器电源未开启，正在启用...");
+    TLOG("⚠️  传感器电源未开启，正在启用...");
     sensorPowerManager.enablePower();
     delay(100); // 等待电源稳定
   }
@@ -36,20 +79,17 @@ bool DualSensorManager::initialize() {
     return false;
   }
 
-  // 扫描I2C设备
-  scanI2CDevices();
-
-  // 初始化传感器对象
-#if defined(SENSOR_BMP280)
-  if (bmp280 == nullptr) {
-    bmp280 = new Adafruit_BMP280(i2c);
-  }
-#endif
-#if defined(SENSOR_AHT20)
-  if (aht20 == nullptr) {
-    aht20 = new Adafruit_AHTX0();
+  // 定时唤醒时直接使用设备表，不扫描总线
+  if (restoreFromDeviceMap()) {
+    initialized = true;
+    status.errorCount = 0;
+    logSuccess("双传感器系统初始化完成（设备表）");
+    logHeap("初始化后");
+    return true;
   }
-#endif
+
+  // 冷启动或设备表校验失败：扫描I2C设备
+  scanI2CDevices();
 
   // 初始化所有传感器
   bool success = initializeAllSensors();
@@ -57,109 +97,100 @@ bool DualSensorManager::initialize() {
   if (success) {
     initialized = true;
     status.errorCount = 0;
+    saveDeviceMap();
     logSuccess("双传感器系统初始化完成");
     printStatus();
   } else {
     logError("双传感器系统初始化失败");
   }
 
+  logHeap("初始化后");
   return success;
 }
 
 bool DualSensorManager::initializeI2C() {
-  Serial.println("🔌 初始化I2C总线...");
+  TLOG("🔌 初始化I2C总线...");
 
   if (i2c == nullptr) {
-    i2c = new TwoWire(0);
+    i2c = new (i2cStorage) TwoWire(0);
   }
 
   // 初始化I2C总线
-  bool success = i2c->begin(PIN_BME_SDA, PIN_BME_SCL, I2C_FREQUENCY);
+  bool success = i2c->begin(PIN_BME_SDA, PIN_BME_SCL, profile.i2cFrequency);
+  bus.attach(i2c);
 
   if (success) {
     status.i2cInitialized = true;
-    Serial.printf("✅ I2C总线初始化成功 (SDA=GPIO%d, SCL=GPIO%d, %dkHz)\n",
-                  PIN_BME_SDA, PIN_BME_SCL, I2C_FREQUENCY / 1000);
+    TLOG("✅ I2C总线初始化成功 (SDA=GPIO%d, SCL=GPIO%d, %dkHz)",
+         PIN_BME_SDA, PIN_BME_SCL,
+         (int)(profile.i2cFrequency / 1000));
   } else {
     status.i2cInitialized = false;
-    Serial.println("❌ I2C总线初始化失败");
+    TLOG("❌ I2C总线初始化失败");
   }
 
   return success;
 }
 
 void DualSensorManager::shutdown() {
-  Serial.println("🔌 关闭双传感器管理系统...");
-
-#if defined(SENSOR_BMP280)
-  if (bmp280 != nullptr) {
-    delete bmp280;
-    bmp280 = nullptr;
-  }
-#endif
-#if defined(SENSOR_AHT20)
-  if (aht20 != nullptr) {
-    delete aht20;
-    aht20 = nullptr;
-  }
-#endif
+  TLOG("🔌 关闭双传感器管理系统...");
 
+  // end()释放总线的缓冲区
   if (i2c != nullptr) {
-    delete i2c;
+    i2c->end();
+    i2c->~TwoWire();
     i2c = nullptr;
   }
+  bus.attach(nullptr);
+  measurement.reset();
 
   initialized = false;
   status = SensorStatus();
 
-  Serial.println("✅ 双传感器管理系统已关闭");
+  TLOG("✅ 双传感器管理系统已关闭");
 }
 
 void DualSensorManager::scanI2CDevices() {
-  Serial.println("🔍 扫描I2C总线设备...");
+  TLOG("🔍 扫描I2C总线设备...");
 
   if (!status.i2cInitialized) {
-    Serial.println("❌ I2C总线未初始化，无法扫描");
+    TLOG("❌ I2C总线未初始化，无法扫描");
     return;
   }
 
   int deviceCount = 0;
-  Serial.println();
-  Serial.println("地址  设备类型        状态");
-  Serial.println("----  ------------  --------");
+  TLOG("地址  设备类型        状态");
+  TLOG("----  ------------  --------");
 
   for (uint8_t address = 1; address < 127; address++) {
     if (isDevicePresent(address)) {
       deviceCount++;
-      Serial.printf("0x%02X  ", address);
 
       // 识别设备类型
+      const char *type = "未知设备        发现 ❓";
       if (address == BMP280_ADDR_1 || address == BMP280_ADDR_2) {
-        Serial.printf("BMP280 传感器   发现 ✅");
+        type = "BMP280 传感器   发现 ✅";
         status.bmp280Address = address;
       } else if (address == AHT20_ADDR) {
-        Serial.printf("AHT20 传感器    发现 ✅");
+        type = "AHT20 传感器    发现 ✅";
         status.aht20Address = address;
-      } else {
-        Serial.printf("未知设备        发现 ❓");
       }
-      Serial.println();
+      TLOG("0x%02X  %s", address, type);
     }
   }
 
-  Serial.println("----  ------------  --------");
-  Serial.printf("总计发现 %d 个I2C设备\n", deviceCount);
-  Serial.println();
+  TLOG("----  ------------  --------");
+  TLOG("总计发现 %d 个I2C设备", deviceCount);
 
   status.lastScan = getCurrentTime();
 
   if (deviceCount == 0) {
     logError("未发现任何I2C设备");
-    Serial.println("🔍 请检查：");
-    Serial.println("  - 硬件接线是否正确");
-    Serial.println("  - 传感器是否已连接");
-    Serial.println("  - 电源是否正常 (GPIO5 = HIGH)");
-    Serial.println("  - I2C上拉电阻是否存在");
+    TLOG("🔍 请检查：");
+    TLOG("  - 硬件接线是否正确");
+    TLOG("  - 传感器是否已连接");
+    TLOG("  - 电源是否正常 (GPIO5 = HIGH)");
+    TLOG("  - I2C上拉电阻是否存在");
   }
 }
 
@@ -177,185 +208,137 @@ void DualSensorManager::printI2CScanResults() { scanI2CDevices(); }
 
 bool DualSensorManager::initializeBMP280() {
 #if defined(SENSOR_BMP280)
-  Serial.print("🌪️  初始化BMP280传感器... ");
-
-  if (bmp280 == nullptr) {
-    Serial.println("失败 - 对象未创建");
-    return false;
-  }
-
   // 尝试两个可能的地址
   bool success = false;
-  if (bmp280->begin(BMP280_ADDR_1)) {
+  uint8_t chipId;
+  if (probeBmp280(bus, BMP280_ADDR_1, chipId)) {
     status.bmp280Address = BMP280_ADDR_1;
     success = true;
-    Serial.printf("成功 (地址: 0x%02X)\n", BMP280_ADDR_1);
-  } else if (bmp280->begin(BMP280_ADDR_2)) {
+    TLOG("🌪️  初始化BMP280传感器... 成功 (地址: 0x%02X)", BMP280_ADDR_1);
+  } else if (probeBmp280(bus, BMP280_ADDR_2, chipId)) {
     status.bmp280Address = BMP280_ADDR_2;
     success = true;
-    Serial.printf("成功 (地址: 0x%02X)\n", BMP280_ADDR_2);
+    TLOG("🌪️  初始化BMP280传感器... 成功 (地址: 0x%02X)", BMP280_ADDR_2);
   } else {
-    Serial.println("失败 ❌");
+    TLOG("🌪️  初始化BMP280传感器... 失败 ❌");
     status.bmp280Available = false;
     return false;
   }
 
   if (success) {
-    // 配置BMP280参数
-    success = configureBMP280();
+    // 配置BMP280参数，异步测量需要校准系数
+    Bmp280Calib calib;
+    success = configureBMP280() &&
+              readBmp280Calib(bus, status.bmp280Address, calib);
     if (success) {
+      measurement.configureBMP280(status.bmp280Address, calib,
+                                  profile.ctrlMeas, profile.bmpSamples);
+      deviceMap.calib = calib;
       status.bmp280Available = true;
-      Serial.println("✅ BMP280传感器配置完成");
+      TLOG("✅ BMP280传感器配置完成");
     } else {
       status.bmp280Available = false;
-      Serial.println("❌ BMP280传感器配置失败");
+      TLOG("❌ BMP280传感器配置失败");
     }
   }
 
   return success;
 #else
-  Serial.println("⚠️  BMP280支持未启用");
+  TLOG("⚠️  BMP280支持未启用");
   return false;
 #endif
 }
 
 bool DualSensorManager::initializeAHT20() {
 #if defined(SENSOR_AHT20)
-  Serial.print("💧 初始化AHT20传感器... ");
-
-  if (aht20 == nullptr) {
-    Serial.println("失败 - 对象未创建");
-    return false;
-  }
-
-  bool success = aht20->begin(i2c);
+  bool success = initAht20(bus, AHT20_ADDR, sleepMs);
 
   if (success) {
     status.aht20Available = true;
     status.aht20Address = AHT20_ADDR;
-    Serial.println("成功 ✅");
+    measurement.configureAHT20(AHT20_ADDR, profile.ahtSamples);
+    TLOG("💧 初始化AHT20传感器... 成功 ✅");
   } else {
     status.aht20Available = false;
-    Serial.println("失败 ❌");
+    TLOG("💧 初始化AHT20传感器... 失败 ❌");
   }
 
   return success;
 #else
-  Serial.println("⚠️  AHT20支持未启用");
+  TLOG("⚠️  AHT20支持未启用");
   return false;
 #endif
 }
 
 bool DualSensorManager::initializeAllSensors() {
-  Serial.println("🔧 初始化所有传感器...");
+  TLOG("🔧 初始化所有传感器...");
 
   bool bmp280Success = initializeBMP280();
   bool aht20Success = initializeAHT20();
 
   // 检查初始化结果
   if (bmp280Success && aht20Success) {
-    Serial.println("🎉 所有传感器初始化成功！");
+    TLOG("🎉 所有传感器初始化成功！");
     return true;
   } else if (bmp280Success || aht20Success) {
-    Serial.println("⚠️  部分传感器初始化成功");
-    Serial.printf("  BMP280: %s\n", bmp280Success ? "可用 ✅" : "不可用 ❌");
-    Serial.printf("  AHT20:  %s\n", aht20Success ? "可用 ✅" : "不可用 ❌");
+    TLOG("⚠️  部分传感器初始化成功");
+    TLOG("  BMP280: %s", bmp280Success ? "可用 ✅" : "不可用 ❌");
+    TLOG("  AHT20:  %s", aht20Success ? "可用 ✅" : "不可用 ❌");
     return true; // 至少一个传感器可用
   } else {
-    Serial.println("❌ 所有传感器初始化失败");
+    TLOG("❌ 所有传感器初始化失败");
     status.errorCount++;
     return false;
   }
 }
 
 SensorData DualSensorManager::readAllSensors() {
-  SensorData data;
-  data.timestamp = getCurrentTime();
-
-  if (!initialized) {
-    logError("传感器系统未初始化");
+  if (!startMeasurement()) {
+    SensorData data;
+    data.timestamp = getCurrentTime();
     return data;
   }
-
-  // 读取BMP280数据
-  if (status.bmp280Available) {
-    float bmpTemp, pressure, altitude;
-    if (readBMP280Data(bmpTemp, pressure, altitude)) {
-      data.pressure = pressure;
-      data.pressureValid = true;
-      data.altitude = altitude;
-      data.altitudeValid = true;
-
-      // 如果AHT20不可用，使用BMP280的温度
-      if (!status.aht20Available) {
-        data.temperature = bmpTemp;
-        data.temperatureValid = true;
-      }
-    }
-  }
-
-  // 读取AHT20数据
-  if (status.aht20Available) {
-    float ahtTemp, humidity;
-    if (readAHT20Data(ahtTemp, humidity)) {
-      data.temperature = ahtTemp;
-      data.temperatureValid = true;
-      data.humidity = humidity;
-      data.humidityValid = true;
-    }
-  }
-
-  return data;
+  return await();
 }
 
-bool DualSensorManager::readBMP280Data(float &temperature, float &pressure,
-                                       float &altitude) {
-#if defined(SENSOR_BMP280)
-  if (!status.bmp280Available || bmp280 == nullptr) {
+bool DualSensorManager::startMeasurement() {
+  if (!initialized) {
+    logError("传感器系统未初始化");
     return false;
   }
 
-  temperature = bmp280->readTemperature();
-  pressure = bmp280->readPressure();
-  altitude = bmp280->readAltitude(SEA_LEVEL_PRESSURE);
-
-  bool valid = validateSensorData(temperature) &&
-               validateSensorData(pressure) && validateSensorData(altitude);
-
-  if (!valid) {
-    status.errorCount++;
-    logError("BMP280数据读取失败或无效");
-  }
-
-  return valid;
-#else
-  return false;
-#endif
+  measurementStart = getCurrentTime();
+  return measurement.start(bus, measurementStart);
 }
 
-bool DualSensorManager::readAHT20Data(float &temperature, float &humidity) {
-#if defined(SENSOR_AHT20)
-  if (!status.aht20Available || aht20 == nullptr) {
-    return false;
+MeasurementState DualSensorManager::poll() {
+  MeasurementState previous = measurement.getState();
+  MeasurementState state = measurement.poll(bus, getCurrentTime());
+  if (previous == MEASUREMENT_PENDING && state == MEASUREMENT_DONE) {
+    countFailures();
   }
+  return state;
+}
 
-  sensors_event_t humidityEvent, tempEvent;
-  aht20->getEvent(&humidityEvent, &tempEvent);
-
-  temperature = tempEvent.temperature;
-  humidity = humidityEvent.relative_humidity;
-
-  bool valid = validateSensorData(temperature) && validateSensorData(humidity);
-
-  if (!valid) {
-    status.errorCount++;
-    logError("AHT20数据读取失败或无效");
+SensorData DualSensorManager::await(unsigned long timeoutMs) {
+  unsigned long start = getCurrentTime();
+  if (timeoutMs == 0) {
+    timeoutMs = MEASUREMENT_TIMEOUT_MS + profile.conversionMs;
+  }
+
+  MeasurementState previous = measurement.getState();
+  MeasurementState state = measurement.await(
+      bus, [this]() { return (uint32_t)getCurrentTime(); }, sleepMs,
+      timeoutMs);
+  if (state == MEASUREMENT_PENDING) {
+    logError("传感器测量超时");
+  } else if (state == MEASUREMENT_DONE) {
+    if (previous == MEASUREMENT_PENDING) {
+      countFailures();
+    }
+    recordTiming(getCurrentTime() - start);
   }
-
-  return valid;
-#else
-  return false;
-#endif
+  return toSensorData(measurement.getResult());
 }
 
 SensorStatus DualSensorManager::getStatus() const { return status; }
@@ -369,46 +352,41 @@ bool DualSensorManager::areBothAvailable() const {
 }
 
 void DualSensorManager::printStatus() const {
-  Serial.println("📊 双传感器系统状态：");
-  Serial.printf("  系统初始化: %s\n", initialized ? "完成 ✅" : "未完成 ❌");
-  Serial.printf("  I2C总线: %s\n",
-                status.i2cInitialized ? "已初始化 ✅" : "未初始化 ❌");
-  Serial.printf("  电源状态: %s\n",
-                sensorPowerManager.isPowerEnabled() ? "开启 ✅" : "关闭 ❌");
-  Serial.println();
-
-  Serial.println("📡 传感器状态：");
-  Serial.printf("  BMP280: %s",
-                status.bmp280Available ? "可用 ✅" : "不可用 ❌");
+  TLOG("📊 双传感器系统状态：");
+  TLOG("  系统初始化: %s", initialized ? "完成 ✅" : "未完成 ❌");
+  TLOG("  I2C总线: %s",
+       status.i2cInitialized ? "已初始化 ✅" : "未初始化 ❌");
+  TLOG("  电源状态: %s",
+       sensorPowerManager.isPowerEnabled() ? "开启 ✅" : "关闭 ❌");
+
+  TLOG("📡 传感器状态：");
   if (status.bmp280Available) {
-    Serial.printf(" (地址: 0x%02X)", status.bmp280Address);
+    TLOG("  BMP280: 可用 ✅ (地址: 0x%02X)", status.bmp280Address);
+  } else {
+    TLOG("  BMP280: 不可用 ❌");
   }
-  Serial.println();
-
-  Serial.printf("  AHT20:  %s",
-                status.aht20Available ? "可用 ✅" : "不可用 ❌");
   if (status.aht20Available) {
-    Serial.printf(" (地址: 0x%02X)", status.aht20Address);
+    TLOG("  AHT20:  可用 ✅ (地址: 0x%02X)", status.aht20Address);
+  } else {
+    TLOG("  AHT20:  不可用 ❌");
   }
-  Serial.println();
 
-  Serial.printf("  错误计数: %d\n", status.errorCount);
+  TLOG("  错误计数: %d", status.errorCount);
 
   if (status.lastScan > 0) {
     unsigned long timeSinceScan = getCurrentTime() - status.lastScan;
-    Serial.printf("  上次扫描: %lu毫秒前\n", timeSinceScan);
+    TLOG("  上次扫描: %lu毫秒前", timeSinceScan);
   }
-
-  Serial.println();
 }
 
 bool DualSensorManager::retryInitialization() {
-  Serial.println("🔄 重试传感器初始化...");
+  TLOG("🔄 重试传感器初始化...");
 
   // 重置状态
   status.bmp280Available = false;
   status.aht20Available = false;
   status.errorCount = 0;
+  measurement.reset();
 
   // 重新扫描和初始化
   scanI2CDevices();
@@ -420,8 +398,7 @@ void DualSensorManager::resetErrorCount() { status.errorCount = 0; }
 int DualSensorManager::getErrorCount() const { return status.errorCount; }
 
 void DualSensorManager::runDiagnostics() {
-  Serial.println("🔍 运行双传感器系统诊断...");
-  Serial.println();
+  TLOG("🔍 运行双传感器系统诊断...");
 
   // 打印系统状态
   printStatus();
@@ -430,98 +407,245 @@ void DualSensorManager::runDiagnostics() {
   testI2CCommunication();
 
   // 测试传感器数据读取
-  Serial.println("📖 测试传感器数据读取：");
+  TLOG("📖 测试传感器数据读取：");
   SensorData data = readAllSensors();
   printSensorData(data);
 
-  Serial.println("🔍 诊断完成");
-  Serial.println();
+  TLOG("🔍 诊断完成");
 }
 
 bool DualSensorManager::testI2CCommunication() {
-  Serial.println("🔌 测试I2C通信：");
+  TLOG("🔌 测试I2C通信：");
 
   if (!status.i2cInitialized) {
-    Serial.println("  ❌ I2C总线未初始化");
+    TLOG("  ❌ I2C总线未初始化");
     return false;
   }
 
   bool bmp280Comm = isDevicePresent(status.bmp280Address);
   bool aht20Comm = isDevicePresent(status.aht20Address);
 
-  Serial.printf("  BMP280通信: %s\n", bmp280Comm ? "正常 ✅" : "异常 ❌");
-  Serial.printf("  AHT20通信:  %s\n", aht20Comm ? "正常 ✅" : "异常 ❌");
+  TLOG("  BMP280通信: %s", bmp280Comm ? "正常 ✅" : "异常 ❌");
+  TLOG("  AHT20通信:  %s", aht20Comm ? "正常 ✅" : "异常 ❌");
 
   return bmp280Comm || aht20Comm;
 }
 
 void DualSensorManager::printSensorData(const SensorData &data) const {
-  Serial.println("📊 传感器数据：");
+  TLOG("📊 传感器数据：");
 
   if (data.temperatureValid) {
-    Serial.printf("  🌡️  温度: %.2f°C\n", data.temperature);
+    TLOG("  🌡️  温度: %.2f°C", data.temperature);
   } else {
-    Serial.println("  🌡️  温度: 无效数据 ❌");
+    TLOG("  🌡️  温度: 无效数据 ❌");
   }
 
   if (data.humidityValid) {
-    Serial.printf("  💧 湿度: %.2f%%\n", data.humidity);
+    TLOG("  💧 湿度: %.2f%%", data.humidity);
   } else {
-    Serial.println("  💧 湿度: 无效数据 ❌");
+    TLOG("  💧 湿度: 无效数据 ❌");
   }
 
   if (data.pressureValid) {
-    Serial.printf("  🌪️  气压: %.2f Pa (%.2f hPa)\n", data.pressure,
-                  data.pressure / 100.0);
+    TLOG("  🌪️  气压: %.2f Pa (%.2f hPa)", data.pressure,
+         data.pressure / 100.0);
   } else {
-    Serial.println("  🌪️  气压: 无效数据 ❌");
+    TLOG("  🌪️  气压: 无效数据 ❌");
   }
 
   if (data.altitudeValid) {
-    Serial.printf("  🏔️  海拔: %.2f m\n", data.altitude);
+    TLOG("  🏔️  海拔: %.2f m", data.altitude);
   } else {
-    Serial.println("  🏔️  海拔: 无效数据 ❌");
+    TLOG("  🏔️  海拔: 无效数据 ❌");
   }
 
-  Serial.printf("  ⏰ 时间戳: %lu\n", data.timestamp);
-  Serial.println();
+  TLOG("  ⏰ 时间戳: %lu", data.timestamp);
 }
 
 // 私有方法实现
 
 bool DualSensorManager::configureBMP280() {
-#if defined(SENSOR_BMP280)
-  if (bmp280 == nullptr) {
+  // 配置BMP280参数。保持睡眠模式，由异步测量写入强制模式触发每次转换。
+  // config只在睡眠模式下写入有效，所以先写ctrl_meas
+  const uint8_t ctrlMeas[2] = {
+      BMP280_REG_CTRL_MEAS,
+      (uint8_t)((profile.ctrlMeas & ~0x03) | BMP280_MODE_SLEEP)};
+  const uint8_t config[2] = {BMP280_REG_CONFIG, profile.config};
+  return bus.write(status.bmp280Address, ctrlMeas, sizeof(ctrlMeas)) &&
+         bus.write(status.bmp280Address, config, sizeof(config));
+}
+
+bool DualSensorManager::restoreFromDeviceMap() {
+  if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER) {
+    return false;
+  }
+
+  if (!verifySensorMap(bus, deviceMap)) {
+    deviceMap.magic = 0;
+    TLOG("⚠️  设备表无效或设备未应答，重新扫描");
     return false;
   }
 
-  // 配置BMP280参数
-  bmp280->setSampling(Adafruit_BMP280::MODE_NORMAL,     // 工作模式
-                      Adafruit_BMP280::SAMPLING_X2,     // 温度过采样
-                      Adafruit_BMP280::SAMPLING_X16,    // 气压过采样
-                      Adafruit_BMP280::FILTER_X16,      // 滤波
-                      Adafruit_BMP280::STANDBY_MS_500); // 待机时间
+  // 断电后BMP280的寄存器恢复默认值，重新写入配置
+  status.bmp280Address = deviceMap.bmp280Address;
+  if (!configureBMP280()) {
+    deviceMap.magic = 0;
+    return false;
+  }
 
+  measurement.configureBMP280(deviceMap.bmp280Address, deviceMap.calib,
+                              profile.ctrlMeas, profile.bmpSamples);
+  measurement.configureAHT20(deviceMap.aht20Address, profile.ahtSamples);
+  status.bmp280Available = true;
+  status.aht20Available = true;
+  status.aht20Address = deviceMap.aht20Address;
+
+  TLOG("✅ 使用设备表 (BMP280: 0x%02X, AHT20: 0x%02X)",
+       status.bmp280Address, status.aht20Address);
   return true;
-#else
-  return false;
-#endif
 }
 
-bool DualSensorManager::validateSensorData(float value) const {
-  return !isnan(value) && isfinite(value);
+void DualSensorManager::saveDeviceMap() {
+  // 只保存完整的设备表，缺少传感器时每次唤醒都完整初始化
+  const uint8_t reg = BMP280_REG_CHIP_ID;
+  uint8_t chipId;
+  if (!areBothAvailable() || !bus.write(status.bmp280Address, &reg, 1) ||
+      !bus.read(status.bmp280Address, &chipId, 1)) {
+    deviceMap.magic = 0;
+    return;
+  }
+
+  // 校准系数已在initializeBMP280()中保存
+  deviceMap.bmp280Address = status.bmp280Address;
+  deviceMap.bmp280ChipId = chipId;
+  deviceMap.aht20Address = status.aht20Address;
+  sealSensorMap(deviceMap);
+}
+
+// 测量刚完成时统计失败的传感器
+void DualSensorManager::countFailures() {
+  const MeasurementResult &result = measurement.getResult();
+  if (status.bmp280Available && !result.bmpValid) {
+    status.errorCount++;
+    logError("BMP280数据读取失败或无效");
+  }
+  if (status.aht20Available && !result.ahtValid) {
+    status.errorCount++;
+    logError("AHT20数据读取失败或无效");
+  }
+
+  // 有传感器失败时下次唤醒重新扫描
+  if ((status.bmp280Available && !result.bmpValid) ||
+      (status.aht20Available && !result.ahtValid)) {
+    deviceMap.magic = 0;
+  }
+}
+
+// 等待传感器转换时浅睡眠，而不是在delay()中以全速空转。两次I2C访问之间
+// 总线空闲，计时器唤醒后millis()照常继续。WiFi打开时浅睡眠会断开连接，
+// 这时和很短的等待一样用delay()。
+void DualSensorManager::sleepMs(uint32_t ms) {
+  if (ms < LIGHT_SLEEP_MIN_MS || WiFi.getMode() != WIFI_OFF) {
+    delay(ms);
+    return;
+  }
+  Serial.flush(); // 浅睡眠会打乱UART输出
+  esp_sleep_enable_timer_wakeup(ms * 1000ULL);
+  esp_light_sleep_start();
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+}
+
+void DualSensorManager::recordTiming(unsigned long waited) {
+  unsigned long elapsed = getCurrentTime() - measurementStart;
+  ProfileTiming &timing = profileTimings[profileId];
+  timing.count++;
+  timing.elapsedMs += elapsed;
+  timing.waitedMs += waited;
+
+  TLOG("⏱️  采集配置 %s: 预计%lu毫秒, 实际%lu毫秒, 等待%lu毫秒",
+       profile.name, (unsigned long)profile.conversionMs, elapsed,
+       waited);
+  for (int i = 0; i < NUM_ACQUISITION_PROFILES; i++) {
+    const ProfileTiming &t = profileTimings[i];
+    if (t.count > 0) {
+      TLOG("  %-8s %lu次, 平均实际%lu毫秒, 平均等待%lu毫秒",
+           getAcquisitionProfile((AcquisitionProfileId)i).name,
+           (unsigned long)t.count,
+           (unsigned long)(t.elapsedMs / t.count),
+           (unsigned long)(t.waitedMs / t.count));
+    }
+  }
+}
+
+SensorData DualSensorManager::toSensorData(
+    const MeasurementResult &result) const {
+  SensorData data;
+  data.timestamp = getCurrentTime();
+
+  if (result.bmpValid) {
+    data.pressure = result.pressure;
+    data.pressureValid = true;
+    data.altitude =
+        44330 * (1.0 - pow((result.pressure / 100) / SEA_LEVEL_PRESSURE,
+                           0.1903));
+    data.altitudeValid = true;
+
+    // 如果AHT20不可用，使用BMP280的温度
+    data.temperature = result.bmpTemperature;
+    data.temperatureValid = true;
+  }
+
+  if (result.ahtValid) {
+    data.temperature = result.ahtTemperature;
+    data.temperatureValid = true;
+    data.humidity = result.humidity;
+    data.humidityValid = true;
+  }
+
+  return data;
+}
+
+void DualSensorManager::logError(const char *message) {
+  TLOG("❌ 错误: %s", message);
 }
 
-void DualSensorManager::logError(const String &message) {
-  Serial.println("❌ 错误: " + message);
+void DualSensorManager::logSuccess(const char *message) {
+  TLOG("✅ %s", message);
 }
 
-void DualSensorManager::logSuccess(const String &message) {
-  Serial.println("✅ " + message);
+void DualSensorManager::logHeap(const char *stage) const {
+  // 最大可分配块小于空闲总量越多，碎片越严重
+  TLOG("🧮 堆(%s): 空闲%u字节, 最大可分配块%u字节", stage,
+       (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMaxAllocHeap());
 }
 
 unsigned long DualSensorManager::getCurrentTime() const { return millis(); }
 
+// 传感器总线实现
+
+bool TwoWireSensorBus::write(uint8_t address, const uint8_t *data,
+                             size_t len) {
+  if (wire == nullptr) {
+    return false;
+  }
+
+  wire->beginTransmission(address);
+  wire->write(data, len);
+  return wire->endTransmission() == 0;
+}
+
+bool TwoWireSensorBus::read(uint8_t address, uint8_t *data, size_t len) {
+  if (wire == nullptr ||
+      wire->requestFrom(address, (uint8_t)len) != (uint8_t)len) {
+    return false;
+  }
+
+  for (size_t i = 0; i < len; i++) {
+    data[i] = wire->read();
+  }
+  return true;
+}
+
 // 便捷函数实现
 
 bool initializeDualSensors() { return dualSensorManager.initialize(); }
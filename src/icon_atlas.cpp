@@ -0,0 +1,294 @@
+/* Compressed icon atlas for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef ICON_ATLAS
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <Arduino.h>
+
+#include "icon_atlas.h"
+#include "raster.h"
+#ifdef ASSET_PARTITION
+#include "assets.h"
+#else
+#include "icons/icons_atlas.h"
+#endif
+
+// Decoded bitmaps are kept in a small LRU cache, the same icon is usually
+// drawn several times per frame (once per page, hourly forecast icons).
+static const int    ICON_CACHE_ENTRIES = 8;
+static const size_t ICON_CACHE_BYTES   = 12 * 1024;
+
+typedef struct icon_cache_entry
+{
+  icon_name_t icon;
+  uint16_t    size;
+  uint32_t    lastUse;
+  uint8_t    *bitmap;
+  size_t      bytes;
+} icon_cache_entry_t;
+
+static icon_cache_entry_t iconCache[ICON_CACHE_ENTRIES] = {};
+static size_t iconCacheBytes = 0;
+static uint32_t iconCacheClock = 0;
+
+// slot of icons that are not in the atlas (ICON_ATLAS_NONE)
+static const uint8_t ATLAS_SLOT_NONE = 0xff;
+
+typedef struct atlas_view
+{
+  const uint16_t *sizes;
+  uint16_t        numSizes;
+  uint16_t        numIcons;
+  const uint8_t  *slot;
+  const uint32_t *offset;    // [slot][size index]
+  const uint8_t  *data;
+} atlas_view_t;
+
+/* Returns the atlas tables, either from the asset partition or from
+ * icons_atlas.h. Returns false if the atlas is not available.
+ */
+static bool getAtlas(atlas_view_t &atlas)
+{
+#ifdef ASSET_PARTITION
+  const asset_image_t *assets = getAssets();
+  uint32_t length = 0;
+  const uint8_t *blob = assets ? findAsset(*assets, "icon_atlas",
+                                           ASSET_ICON_ATLAS, &length)
+                               : nullptr;
+  if (blob == nullptr || length < sizeof(asset_icon_atlas_t))
+  {
+    return false;
+  }
+  const asset_icon_atlas_t *a = reinterpret_cast<const asset_icon_atlas_t *>(
+                                  blob);
+  atlas.sizes    = a->sizes;
+  atlas.numSizes = a->num_sizes;
+  atlas.numIcons = a->num_icons;
+  atlas.slot     = blob + a->slot_offset;
+  atlas.offset   = reinterpret_cast<const uint32_t *>(blob + a->offset_offset);
+  atlas.data     = blob + a->data_offset;
+#else
+  atlas.sizes    = ICON_ATLAS_SIZES;
+  atlas.numSizes = ICON_ATLAS_NUM_SIZES;
+  atlas.numIcons = sizeof(ICON_ATLAS_SLOT) / sizeof(ICON_ATLAS_SLOT[0]);
+  atlas.slot     = ICON_ATLAS_SLOT;
+  atlas.offset   = &ICON_ATLAS_OFFSET[0][0];
+  atlas.data     = ICON_ATLAS_DATA;
+#endif
+  return true;
+} // end getAtlas
+
+/* Returns a pointer to the first run of the icon in the atlas, or nullptr if
+ * the icon is not packed at this size.
+ */
+static const uint8_t *findAtlasRuns(icon_name_t icon, size_t size)
+{
+  atlas_view_t atlas;
+  if (!getAtlas(atlas) || icon < 0 || icon >= atlas.numIcons)
+  {
+    return nullptr;
+  }
+  const uint8_t slot = pgm_read_byte(&atlas.slot[icon]);
+  if (slot == ATLAS_SLOT_NONE)
+  {
+    return nullptr;
+  }
+  for (int s = 0; s < atlas.numSizes; ++s)
+  {
+    if (atlas.sizes[s] == size)
+    {
+      return atlas.data
+             + pgm_read_dword(&atlas.offset[slot * atlas.numSizes + s]);
+    }
+  }
+  return nullptr;
+} // end findAtlasRuns
+
+/* Reads one LEB128 encoded run length and advances p past it.
+ */
+static inline uint32_t readRun(const uint8_t *&p)
+{
+  uint32_t n = 0;
+  int shift = 0;
+  uint8_t b;
+  do
+  {
+    b = pgm_read_byte(p++);
+    n |= static_cast<uint32_t>(b & 0x7f) << shift;
+    shift += 7;
+  } while (b & 0x80);
+  return n;
+} // end readRun
+
+/* Walks the runs of an icon and calls inkSpan(x, y, w) for every horizontal
+ * span of ink pixels. Runs that wrap around the end of a row are split.
+ */
+template <typename InkSpan>
+static void decodeRuns(const uint8_t *runs, int16_t size, InkSpan inkSpan)
+{
+  const uint32_t total = static_cast<uint32_t>(size) * size;
+  uint32_t pos = 0;
+  bool ink = false;
+  while (pos < total)
+  {
+    uint32_t n = readRun(runs);
+    if (ink)
+    {
+      while (n > 0)
+      {
+        const int16_t y = pos / size;
+        const int16_t x = pos % size;
+        const int16_t w = std::min<uint32_t>(n, size - x);
+        inkSpan(x, y, w);
+        pos += w;
+        n -= w;
+      }
+    }
+    else
+    {
+      pos += n;
+    }
+    ink = !ink;
+  }
+  return;
+} // end decodeRuns
+
+/* Draws an icon from the atlas by streaming its runs straight to the display
+ * as horizontal lines, without decoding it into a bitmap first. Draws the same
+ * pixels as drawInvertedBitmap() with the bitmap returned by getBitmap().
+ *
+ * Returns false if the icon is not in the atlas.
+ */
+bool drawAtlasIcon(Adafruit_GFX &gfx, int16_t x, int16_t y, icon_name_t icon,
+                   size_t size, uint16_t color)
+{
+  const uint8_t *runs = findAtlasRuns(icon, size);
+  if (runs == nullptr)
+  {
+    return false;
+  }
+  gfx.startWrite();
+  decodeRuns(runs, size, [&](int16_t sx, int16_t sy, int16_t w) {
+    gfx.writeFastHLine(x + sx, y + sy, w, color);
+  });
+  gfx.endWrite();
+  return true;
+} // end drawAtlasIcon
+
+/* Returns the bitmap of an icon in the usual inverted 1bpp format, decoded
+ * from the atlas. The pointer stays valid until the next call to getBitmap.
+ *
+ * Icons missing from the atlas are returned blank. Returns nullptr only if the
+ * bitmap can not be allocated.
+ */
+const unsigned char *getBitmap(icon_name_t icon, size_t size)
+{
+  ++iconCacheClock;
+  for (icon_cache_entry_t &e : iconCache)
+  {
+    if (e.bitmap != nullptr && e.icon == icon && e.size == size)
+    {
+      e.lastUse = iconCacheClock;
+      return e.bitmap;
+    }
+  }
+
+  const uint8_t *runs = findAtlasRuns(icon, size);
+  if (runs == nullptr)
+  {
+    Serial.printf("Error: Icon %d (%ux%u) not in atlas.\n", icon,
+                  static_cast<unsigned>(size), static_cast<unsigned>(size));
+  }
+
+  // evict least recently used entries until the bitmap fits
+  const int16_t stride = (size + 7) / 8;
+  const size_t bytes = stride * size;
+  icon_cache_entry_t *slot = nullptr;
+  while (true)
+  {
+    icon_cache_entry_t *lru = nullptr;
+    slot = nullptr;
+    for (icon_cache_entry_t &e : iconCache)
+    {
+      if (e.bitmap == nullptr)
+      {
+        slot = &e;
+      }
+      else if (lru == nullptr || e.lastUse < lru->lastUse)
+      {
+        lru = &e;
+      }
+    }
+    if (slot != nullptr && iconCacheBytes + bytes <= ICON_CACHE_BYTES)
+    {
+      break;
+    }
+    if (lru == nullptr)
+    {
+      break; // cache is empty, icon is larger than the budget
+    }
+    free(lru->bitmap);
+    lru->bitmap = nullptr;
+    iconCacheBytes -= lru->bytes;
+  }
+
+  uint8_t *bitmap = static_cast<uint8_t *>(malloc(bytes));
+  if (bitmap == nullptr || slot == nullptr)
+  {
+    Serial.println("Error: Failed to allocate memory for icon.");
+    free(bitmap);
+    return nullptr;
+  }
+  memset(bitmap, 0xff, bytes);
+  if (size % 8 != 0)
+  {
+    // the padding bits at the end of each row are 0, like in icons_*.h
+    for (size_t y = 0; y < size; ++y)
+    {
+      bitmap[y * stride + stride - 1] = 0xff << (8 - size % 8);
+    }
+  }
+  if (runs != nullptr)
+  {
+    decodeRuns(runs, size, [&](int16_t sx, int16_t sy, int16_t w) {
+      fillPatternRect1bpp(bitmap, size, size, sx, sy, w, 1, PATTERN_SOLID,
+                          false);
+    });
+  }
+
+  *slot = {icon, static_cast<uint16_t>(size), iconCacheClock, bitmap, bytes};
+  iconCacheBytes += bytes;
+  return bitmap;
+} // end getBitmap
+
+/* Frees all decoded icons.
+ */
+void clearIconCache()
+{
+  for (icon_cache_entry_t &e : iconCache)
+  {
+    free(e.bitmap);
+    e.bitmap = nullptr;
+  }
+  iconCacheBytes = 0;
+  return;
+} // end clearIconCache
+
+#endif // ICON_ATLAS
@@ -21,6 +21,7 @@
 #include <vector>
 #include <Arduino.h>
 #include <aqi.h>
+#include "alert_classifier.h"
 
 // LC_TIME
 extern const char *LC_D_T_FMT;
@@ -99,6 +100,7 @@ extern const char *TXT_UNITS_PRECIP_INCHES;
 
 // MISCELLANEOUS MESSAGES
 // Title Case
+extern const char *TXT_ASSET_IMAGE_INVALID;
 extern const char *TXT_LOW_BATTERY;
 extern const char *TXT_NETWORK_NOT_AVAILABLE;
 extern const char *TXT_TIME_SYNCHRONIZATION_FAILED;
@@ -128,6 +130,8 @@ extern const char *TXT_CRIT_LOW_BATTERY_VOLTAGE;
 
 // ALERTS
 extern const std::vector<String> ALERT_URGENCY;
+// matcher over ALERT_URGENCY and the TERM_* vectors (see alert_classifier.h)
+extern const alert_matcher_t ALERT_MATCHER;
 // ALERT TERMINOLOGY
 extern const std::vector<String> TERM_SMOG;
 extern const std::vector<String> TERM_SMOKE;
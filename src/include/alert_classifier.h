@@ -0,0 +1,57 @@
+/* Alert terminology matcher declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ALERT_CLASSIFIER_H__
+#define __ALERT_CLASSIFIER_H__
+
+#include <cstddef>
+#include <cstdint>
+
+// An Aho-Corasick automaton over the alert terminology of the locale. Every
+// term carries a bit mask and a single pass over an event name returns the
+// union of the masks of all terms it contains, so the alert category (one bit
+// per TERM_* vector) and the urgency (one bit per ALERT_URGENCY keyword) are
+// found together instead of with one String::indexOf per term.
+//
+// The automaton of each locale is generated by tools/alert_terms.py into
+// constant tables (locales/alert_terms_<LOCALE>.inc), so it lives in flash and
+// nothing is built at runtime. locale.cpp defines it as ALERT_MATCHER.
+
+// the root node, also the initial state
+#define ALERT_MATCHER_ROOT 0
+
+typedef struct alert_matcher_node
+{
+  uint32_t mask;    // masks of the terms ending here, incl. via fail links
+  uint16_t child;   // first child, or ALERT_MATCHER_ROOT
+  uint16_t sibling; // next child of the parent, or ALERT_MATCHER_ROOT
+  uint16_t fail;    // node of the longest proper suffix that is in the trie
+  uint8_t  ch;      // byte on the edge from the parent
+} alert_matcher_node_t;
+
+typedef struct alert_matcher
+{
+  const alert_matcher_node_t *nodes;
+  const uint16_t             *root; // transitions of the root node, by byte
+} alert_matcher_t;
+
+uint32_t matchAlertTerms(const alert_matcher_t &m, const char *text,
+                         size_t len, size_t head, uint32_t tailMask);
+uint32_t feedAlertTerms(const alert_matcher_t &m, uint16_t &state,
+                        const char *text, size_t len);
+
+#endif
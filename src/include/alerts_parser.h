@@ -0,0 +1,119 @@
+/* Streaming alerts parser declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ALERTS_PARSER_H__
+#define __ALERTS_PARSER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "alert_classifier.h"
+
+// Alerts are read from the "alerts" array of a One Call response as it
+// streams in, a few hundred bytes at a time. Alert descriptions can be
+// several kB each, so only the fields drawAlerts needs are kept, in a
+// fixed-size text arena. Descriptions only pass through the alert terminology
+// matcher and are never stored.
+
+#define OWM_NUM_ALERTS          8 // OpenWeatherMaps does not specify a limit, but if you need more alerts you are probably doomed.
+#define OWM_ALERTS_TEXT_SIZE  512 // Bytes of alert text kept for all alerts
+#define OWM_ALERT_EVENT_LEN    96 // Longest event name kept, in bytes
+#define OWM_ALERT_TAG_LEN      32 // Longest tag kept, in bytes
+#define ALERTS_PARSER_MAX_DEPTH 16
+
+/*
+ * What the display needs to know about an alert, computed once from its event
+ * name and tags by summarizeAlert() (display_utils.cpp)
+ */
+typedef struct alert_summary
+{
+  bool     valid = false;   // The other fields have been computed
+  int8_t   category;        // enum alert_category
+  int8_t   urgency;         // Index of the ALERT_URGENCY keyword, -1 if unknown
+  uint32_t tag_hash;        // Hash of the tags ignoring case, 0 if no tags
+  uint16_t event_len;       // Length of the event name without extra info
+} alert_summary_t;
+
+/*
+ * National weather alerts data from major national weather warning systems
+ *
+ * Text is stored in owm_resp_alerts_t::text, strings that did not fit are
+ * truncated (at a UTF-8 character boundary) or empty. Alerts whose event name
+ * is empty or did not fit in full are dropped.
+ */
+typedef struct owm_alerts
+{
+  int64_t  start;           // Date and time of the start of the alert, Unix, UTC
+  uint16_t event;           // Alert event name, offset into text
+  uint16_t tags;            // First tag (type of severe weather), offset into text
+  uint32_t description_terms; // Alert terminology found in the description
+  alert_summary_t summary;  // Computed once by summarizeAlert()
+} owm_alerts_t;
+
+typedef struct owm_resp_alerts
+{
+  owm_alerts_t alert[OWM_NUM_ALERTS];
+  int      count;           // Alerts received, up to OWM_NUM_ALERTS
+  uint16_t text_used;
+  char     text[OWM_ALERTS_TEXT_SIZE]; // NUL-terminated strings, text[0] is ""
+} owm_resp_alerts_t;
+
+typedef enum alerts_parse_status
+{
+  ALERTS_PARSE_MORE,        // Waiting for more input
+  ALERTS_PARSE_DONE,        // The top-level JSON value is complete
+  ALERTS_PARSE_INVALID,     // Malformed JSON
+  ALERTS_PARSE_TOO_DEEP     // Nested deeper than ALERTS_PARSER_MAX_DEPTH
+} alerts_parse_status_t;
+
+typedef struct alerts_parser_frame
+{
+  uint8_t object   : 1;     // Object (or array)
+  uint8_t expect_key : 1;   // Object is waiting for a member name
+  uint8_t key      : 6;     // Member being read, see alerts_parser.cpp
+  uint8_t items;            // Array elements so far, saturating
+} alerts_parser_frame_t;
+
+typedef struct alerts_parser
+{
+  owm_resp_alerts_t     *alerts;
+  const alert_matcher_t *terms;   // For descriptions, may be nullptr
+  alerts_parse_status_t  status;
+  uint8_t  lex;             // Lexer state, see alerts_parser.cpp
+  uint8_t  sink;            // Destination of string contents
+  uint8_t  depth;
+  alerts_parser_frame_t frame[ALERTS_PARSER_MAX_DEPTH];
+  int      alert;           // Alert being read, -1 if none or dropped
+  uint16_t alert_text;      // text_used when the alert began
+  bool     event_stored;    // The alert has a complete, non-empty event name
+  char     buf[24];         // Member name or number being read
+  uint8_t  buf_len;
+  uint16_t *text_field;     // Offset of the string being stored
+  uint16_t text_end;        // Where it must end, excl. NUL
+  bool     text_truncated;
+  bool     text_arena_full; // text_end is the end of the arena
+  uint16_t term_state;
+  uint32_t unicode;         // \uXXXX escape being read
+  uint8_t  unicode_digits;
+  uint16_t high_surrogate;
+} alerts_parser_t;
+
+void initAlertsParser(alerts_parser_t &p, owm_resp_alerts_t &alerts,
+                      const alert_matcher_t *terms);
+alerts_parse_status_t feedAlertsParser(alerts_parser_t &p, const char *data,
+                                       size_t len);
+
+#endif
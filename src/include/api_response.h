@@ -24,11 +24,12 @@
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include <WiFi.h>
+#include <aqi.h>
+#include "alerts_parser.h"
 
 #define OWM_NUM_MINUTELY       1 // 61
 #define OWM_NUM_HOURLY        48 // 48
 #define OWM_NUM_DAILY          8 // 8
-#define OWM_NUM_ALERTS         8 // OpenWeatherMaps does not specify a limit, but if you need more alerts you are probably doomed.
 #define OWM_NUM_AIR_POLLUTION 24 // Depending on AQI scale, hourly concentrations will need to be averaged over a period of 1h to 24h
 
 typedef struct owm_weather
@@ -147,19 +148,6 @@ typedef struct owm_daily
   owm_weather_t         weather;
 } owm_daily_t;
 
-/*
- * National weather alerts data from major national weather warning systems
- */
-typedef struct owm_alerts
-{
-  String  sender_name;      // Name of the alert source.
-  String  event;            // Alert event name
-  int64_t start;            // Date and time of the start of the alert, Unix, UTC
-  int64_t end;              // Date and time of the end of the alert, Unix, UTC
-  String  description;      // Description of the alert
-  String  tags;             // Type of severe weather
-} owm_alerts_t;
-
 /*
  * Response from OpenWeatherMap's OneCall API
  *
@@ -176,7 +164,7 @@ typedef struct owm_resp_onecall
 
   owm_hourly_t    hourly[OWM_NUM_HOURLY];
   owm_daily_t     daily[OWM_NUM_DAILY];
-  std::vector<owm_alerts_t> alerts;
+  owm_resp_alerts_t alerts;
 } owm_resp_onecall_t;
 
 /*
@@ -209,12 +197,15 @@ typedef struct owm_resp_air_pollution
   int              main_aqi[OWM_NUM_AIR_POLLUTION];   // Air Quality Index. Possible values: 1, 2, 3, 4, 5. Where 1 = Good, 2 = Fair, 3 = Moderate, 4 = Poor, 5 = Very Poor.
   owm_components_t components;
   int64_t          dt[OWM_NUM_AIR_POLLUTION];         // Date and time, Unix, UTC;
+  aqi_windows_t    windows;                           // Window averages, for every AQI scale
 } owm_resp_air_pollution_t;
 
 DeserializationError deserializeOneCall(WiFiClient &json,
                                         owm_resp_onecall_t &r);
 DeserializationError deserializeAirQuality(WiFiClient &json,
                                            owm_resp_air_pollution_t &r);
+DeserializationError deserializeAlerts(WiFiClient &json,
+                                       owm_resp_alerts_t &r);
 
 
 #endif
@@ -0,0 +1,44 @@
+/* Fonts from the asset partition for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Drop-in replacement for the FONT_HEADER family headers when building with
+// -DASSET_PARTITION. The font family is chosen when the asset image is built
+// (tools/pack_assets.py --font-header).
+
+#ifndef __ASSET_FONTS_H__
+#define __ASSET_FONTS_H__
+
+#include "assets.h"
+
+#define FONT_10pt8b assetFont("FONT_10pt8b")
+#define FONT_11pt8b assetFont("FONT_11pt8b")
+#define FONT_12pt8b assetFont("FONT_12pt8b")
+#define FONT_14pt8b assetFont("FONT_14pt8b")
+#define FONT_16pt8b assetFont("FONT_16pt8b")
+#define FONT_18pt8b assetFont("FONT_18pt8b")
+#define FONT_20pt8b assetFont("FONT_20pt8b")
+#define FONT_22pt8b assetFont("FONT_22pt8b")
+#define FONT_24pt8b assetFont("FONT_24pt8b")
+#define FONT_26pt8b assetFont("FONT_26pt8b")
+#define FONT_48pt8b_temperature assetFont("FONT_48pt8b_temperature")
+#define FONT_4pt8b assetFont("FONT_4pt8b")
+#define FONT_5pt8b assetFont("FONT_5pt8b")
+#define FONT_6pt8b assetFont("FONT_6pt8b")
+#define FONT_7pt8b assetFont("FONT_7pt8b")
+#define FONT_8pt8b assetFont("FONT_8pt8b")
+#define FONT_9pt8b assetFont("FONT_9pt8b")
+#endif
@@ -0,0 +1,150 @@
+/* Asset image index declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ASSET_INDEX_H__
+#define __ASSET_INDEX_H__
+
+#include <cstddef>
+#include <cstdint>
+
+// Asset images are built by tools/pack_assets.py. All fields are little-endian
+// and every blob starts on a 4-byte boundary, so the structures below can be
+// read in place from memory-mapped flash.
+#define ASSET_IMAGE_MAGIC   0x41504557 // "WEPA"
+#define ASSET_IMAGE_VERSION 1
+#define ASSET_ATLAS_MAX_SIZES 4
+
+typedef enum asset_type
+{
+  ASSET_ICON_ATLAS   = 1,
+  ASSET_FONT         = 2,
+  ASSET_UNICODE_FONT = 3,
+} asset_type_t;
+
+typedef enum asset_status
+{
+  ASSET_OK,
+  ASSET_TOO_SMALL,
+  ASSET_BAD_MAGIC,
+  ASSET_BAD_VERSION,
+  ASSET_BAD_INDEX,
+  ASSET_BAD_CRC,
+} asset_status_t;
+
+typedef struct asset_header
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;         // number of index entries
+  uint32_t index_offset;  // offset of the index from the start of the image
+  uint32_t image_size;    // total size of the image, including this header
+  uint32_t crc32;         // CRC-32 of the bytes following this header
+  uint32_t reserved[3];
+} asset_header_t;
+
+// Index entries are sorted by name_hash.
+typedef struct asset_entry
+{
+  uint32_t name_hash;     // assetNameHash() of the asset name
+  uint16_t type;          // asset_type_t
+  uint16_t reserved;
+  uint32_t offset;        // offset of the blob from the start of the image
+  uint32_t length;
+} asset_entry_t;
+
+// ASSET_FONT blob. Glyphs are stored in the memory layout of GFXglyph.
+typedef struct asset_font
+{
+  uint16_t first;
+  uint16_t last;
+  uint8_t  y_advance;
+  uint8_t  reserved[3];
+  uint32_t glyph_offset;  // offsets are from the start of the blob
+  uint32_t bitmap_offset;
+} asset_font_t;
+
+// ASSET_ICON_ATLAS blob, the contents of icons_atlas.h.
+typedef struct asset_icon_atlas
+{
+  uint16_t num_sizes;
+  uint16_t num_icons;     // length of the slot table
+  uint16_t num_slots;     // rows of the offset table
+  uint16_t reserved;
+  uint16_t sizes[ASSET_ATLAS_MAX_SIZES];
+  uint32_t slot_offset;   // offsets are from the start of the blob
+  uint32_t offset_offset;
+  uint32_t data_offset;
+  uint32_t data_size;
+} asset_icon_atlas_t;
+
+// ASSET_UNICODE_FONT blob, a bitmap font for code points beyond ISO-8859-1
+// (see unicode_font.h). Code points are looked up by binary search in a table
+// of ranges, each mapping a run of consecutive code points to consecutive
+// glyphs.
+typedef struct asset_unicode_font
+{
+  uint16_t num_ranges;
+  uint16_t num_glyphs;
+  uint8_t  y_advance;
+  uint8_t  reserved[3];
+  uint32_t range_offset;  // offsets are from the start of the blob
+  uint32_t glyph_offset;
+  uint32_t data_offset;
+  uint32_t data_size;
+} asset_unicode_font_t;
+
+// Ranges are sorted by first code point and do not overlap.
+typedef struct asset_ufont_range
+{
+  uint32_t first;         // first code point
+  uint16_t count;         // number of code points
+  uint16_t glyph;         // index of the glyph of the first code point
+} asset_ufont_range_t;
+
+// Metrics as in GFXglyph. The bitmap holds width * height bits row by row
+// without padding, like Adafruit GFX fonts, either as is or run-length
+// encoded (UFONT_GLYPH_RLE, see unicode_font.cpp).
+typedef struct asset_ufont_glyph
+{
+  uint8_t  offset[3];     // 24-bit offset into the data, flags in the top bit
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  x_advance;
+  int8_t   x_offset;
+  int8_t   y_offset;
+} asset_ufont_glyph_t;
+
+#define UFONT_GLYPH_RLE         0x800000
+#define UFONT_GLYPH_OFFSET_MASK 0x7fffff
+
+typedef struct asset_image
+{
+  const uint8_t       *base;
+  size_t               size;
+  const asset_entry_t *index;
+  uint16_t             count;
+} asset_image_t;
+
+uint32_t assetNameHash(const char *name);
+uint32_t assetCrc32(const uint8_t *data, size_t len);
+asset_status_t parseAssetImage(const uint8_t *base, size_t size,
+                               asset_image_t &image, bool checkCrc = true);
+const uint8_t *findAsset(const asset_image_t &image, const char *name,
+                         asset_type_t type, uint32_t *length);
+const char *getAssetStatusStr(asset_status_t status);
+
+#endif
@@ -0,0 +1,38 @@
+/* Asset partition declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+#include <Adafruit_GFX.h>
+#include "asset_index.h"
+#include "unicode_font.h"
+
+#ifdef ASSET_PARTITION
+// see partitions_assets.csv
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_TYPE  0x40
+
+bool mountAssets();
+const asset_image_t *getAssets();
+const GFXfont &assetFont(const char *name);
+#ifdef UNICODE_FONT
+const unicode_font_t *getUnicodeFont(uint8_t yAdvance);
+#endif
+#endif
+
+#endif
@@ -0,0 +1,46 @@
+/* Battery monitor declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __BATTERY_MONITOR_H__
+#define __BATTERY_MONITOR_H__
+
+#include <cstdint>
+
+// ADC samples taken per reading. They are sorted and the mean of the middle
+// half is used, so single conversions disturbed by noise are dropped.
+#define BATTERY_ADC_SAMPLES 16
+
+// The voltage is filtered across wakes with an exponential moving average,
+// each new reading weighs 1 / 2^BATTERY_FILTER_SHIFT. A jump of more than
+// BATTERY_FILTER_STEP_MV (charger plugged in or removed) restarts the filter.
+#define BATTERY_FILTER_MAGIC    0x42415431 // "BAT1"
+#define BATTERY_FILTER_SHIFT    2
+#define BATTERY_FILTER_FRAC     4 // fractional bits of the estimate
+#define BATTERY_FILTER_STEP_MV  100
+
+typedef struct battery_filter
+{
+  uint32_t magic;
+  uint32_t estimate; // millivolts << BATTERY_FILTER_FRAC
+} battery_filter_t;
+
+uint32_t trimmedMean(uint16_t *samples, int n);
+uint32_t updateBatteryFilter(battery_filter_t &f, uint32_t millivolts);
+uint32_t batteryPermille(uint32_t v, uint32_t minv, uint32_t maxv);
+uint32_t batteryPercent(uint32_t v, uint32_t minv, uint32_t maxv);
+
+#endif
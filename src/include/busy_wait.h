@@ -0,0 +1,38 @@
+/* E-paper BUSY wait declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __BUSY_WAIT_H__
+#define __BUSY_WAIT_H__
+
+#include <cstdint>
+
+typedef struct busy_wait_stats
+{
+  uint32_t sleeps;       // number of light sleeps
+  uint32_t timer_wakes;  // light sleeps ended by the timeout safeguard
+  uint64_t sleep_us;     // time spent in light sleep
+} busy_wait_stats_t;
+
+void busyWaitLightSleep(const void *busyLevel);
+void setBusyWaitSleepAllowed(bool allowed);
+void resetBusyWaitStats();
+const busy_wait_stats_t &getBusyWaitStats();
+uint32_t getBusyWaitTotalSleepMs();
+float estimateBusyWaitSavings_mAs(const busy_wait_stats_t &stats);
+void printBusyWaitStats();
+
+#endif
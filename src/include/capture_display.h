@@ -0,0 +1,92 @@
+/* In-memory capture display declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CAPTURE_DISPLAY_H__
+#define __CAPTURE_DISPLAY_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+
+#include "raster.h"
+
+/* Drop-in replacement for the GxEPD2 display object that renders the whole
+ * frame into RAM instead of the panel. (enabled with RENDER_CAPTURE)
+ *
+ * Only the subset of the GxEPD2 paged drawing interface used by this project
+ * is implemented. The frame is rendered as a single page. When nextPage() is
+ * called the frame is written to the serial port as a black plane and, for
+ * 3-color and 7-color panels, an accent plane (any non-black, non-white color)
+ * together with the timing of each profiled render call. Use
+ * tools/render_capture.py to turn the serial log into PBM/PNG files and to
+ * compare them against golden images.
+ */
+class CaptureDisplay : public Adafruit_GFX, public PatternSpanSurface
+{
+public:
+  CaptureDisplay(int16_t w, int16_t h, bool hasColorPlane);
+  ~CaptureDisplay();
+
+  // GxEPD2 interface
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false);
+  void setFullWindow();
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void firstPage();
+  bool nextPage();
+  void hibernate();
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+
+  // Adafruit_GFX overrides
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+  // PatternSpanSurface
+  bool fillPatternSpan(int16_t x, int16_t y, int16_t w, uint8_t bits,
+                       uint16_t color) override;
+
+  void recordTiming(const char *label, uint32_t elapsed_us);
+  const uint8_t *blackPlane() const { return _black; }
+  const uint8_t *colorPlane() const { return _color; }
+
+private:
+  static const int MAX_TIMINGS = 12;
+  struct timing_t
+  {
+    const char *label;
+    uint32_t    elapsed_us;
+    uint16_t    calls;
+  };
+
+  uint8_t  *_black;
+  uint8_t  *_color;
+  bool      _hasColorPlane;
+  size_t    _planeSize;
+  uint16_t  _frame;
+  timing_t  _timings[MAX_TIMINGS];
+  int       _numTimings;
+
+  void writeTimings();
+  void writePlane(const char *name, const uint8_t *plane);
+};
+
+#endif
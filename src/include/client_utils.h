@@ -35,10 +35,12 @@ bool printLocalTime(tm *timeInfo);
 int getOWMcurrentWeather(WiFiClient &client, owm_current_t &current);
 int getOWMonecall(WiFiClient &client, owm_resp_onecall_t &r);
 int getOWMairpollution(WiFiClient &client, owm_resp_air_pollution_t &r);
+int getOWMalerts(WiFiClient &client, owm_resp_alerts_t &r);
 #else
 int getOWMcurrentWeather(WiFiClientSecure &client, owm_current_t &current);
 int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r);
 int getOWMairpollution(WiFiClientSecure &client, owm_resp_air_pollution_t &r);
+int getOWMalerts(WiFiClientSecure &client, owm_resp_alerts_t &r);
 #endif
 
 #endif
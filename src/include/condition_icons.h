@@ -0,0 +1,31 @@
+/* Weather condition icon lookup declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CONDITION_ICONS_H__
+#define __CONDITION_ICONS_H__
+
+#include <cstddef>
+#include <cstdint>
+
+#include "icons/icons.h"
+
+icon_name_t getConditionsIcon(int id, bool day, bool moon, bool cloudy,
+                              bool windy);
+const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
+                                   bool windy, size_t size);
+
+#endif
@@ -189,12 +189,17 @@
 //   Secondary Intercardinal   16  ±11.250°   1,152B  NNE
 //   Tertiary Intercardinal    32   ±5.625°   2,304B  NbE
 //   (360)                    360   ±0.500°  25,920B  1°
+//   (rotated)                360   ±0.500°     288B  1°
+// The rotated option stores a single 48x48 arrow and rotates it at runtime
+// (see rotateBitmap1bpp in raster.cpp), at the cost of slight differences
+// along the edges of the arrow compared to the pre-rendered icons.
 // Uncomment your preferred wind level direction precision.
 // #define WIND_ICONS_CARDINAL
 // #define WIND_ICONS_INTERCARDINAL
 #define WIND_ICONS_SECONDARY_INTERCARDINAL
 // #define WIND_ICONS_TERTIARY_INTERCARDINAL
 // #define WIND_ICONS_360
+// #define WIND_ICONS_ROTATED
 
 // FONTS
 // A handful of popular Open Source typefaces have been included with this
@@ -224,6 +229,20 @@
 //   FreeSans font, but this project supports the ability to modularly swap
 //   fonts. Using a font other than FreeSans may result in undesired spacing or
 //   other artifacts.
+//
+//   When built with -DASSET_PARTITION (see platformio.ini), fonts are read from
+//   the assets flash partition instead and FONT_HEADER only selects the font
+//   family that tools/pack_assets.py should be run with. Adding -DUNICODE_FONT
+//   draws UTF-8 text (e.g. alerts with OWM_LANG "zh_cn") with the Unicode
+//   fonts of the asset image for characters beyond ISO-8859-1, see
+//   pack_assets.py --unicode-font.
+//
+//   fonts/subset_fonts.py generates a subset of a family that only keeps the
+//   glyphs of the selected LOCALE and of the messages the firmware can draw,
+//   roughly halving the flash used by fonts (FreeSans: 83 kB -> 40 kB). Select
+//   it with e.g. "fonts/FreeSans_subset.h" and run the script again whenever
+//   LOCALE, CITY_STRING or a drawn message changes, characters missing from
+//   the subset are drawn as '?'.
 #define FONT_HEADER "fonts/FreeSans.h"
 
 // DAILY PRECIPITATION
@@ -248,6 +267,7 @@
 //   provides alerts in English only. Any combination of these factors may make
 //   it undesirable to display alerts in some regions.
 //   Disable alerts by changing the DISPLAY_ALERTS macro to 0.
+//   Alerts are only requested if OWM_ALERTS_ENDPOINT is set in config.cpp.
 #define DISPLAY_ALERTS 1
 
 // STATUS BAR EXTRAS
@@ -272,6 +292,63 @@
 //   level 2: print api responses to serial monitor
 #define DEBUG_LEVEL 1
 
+// TOKENIZED LOG
+//   If set to 1, messages logged with TLOG() are not formatted on the ESP32.
+//   Each message is stored as the address of its format string and its
+//   arguments in binary, in a ring buffer in RTC memory that survives deep
+//   sleep and crashes. The records not sent yet are sent over the serial port
+//   at the end of each wake, and the delays that gave a serial monitor time to
+//   attach and read are skipped. Decode the output with tools/tlog_decode.py
+//   and the firmware.elf of the build; the tool can also request the whole
+//   buffer. If set to 0, TLOG() prints text as before.
+//   TLOG_RING_SIZE must be a power of 2.
+#define TOKENIZED_LOG  0
+#define TLOG_RING_SIZE 2048 // bytes
+
+// BUSY WAIT LIGHT SLEEP
+//   If set to 1, the ESP32 enters light sleep while the panel is busy (e.g.
+//   during a refresh, which takes several seconds on 3-color panels) and is
+//   woken by the BUSY pin, instead of polling the pin at full CPU clock.
+//   BUSY_WAIT_SLEEP_TIMEOUT_MS limits each light sleep, in case the wake from
+//   the BUSY pin is missed.
+#define BUSY_WAIT_LIGHT_SLEEP      0
+#define BUSY_WAIT_SLEEP_TIMEOUT_MS 2000
+
+// PIPELINED RENDERING (3-color panel only)
+//   If set to 1, the frame is rendered into two alternating page buffers and
+//   each finished page is written to the panel by a task on the other core
+//   while the next page is being rendered. The panel busy waits of the transfer
+//   do not use BUSY_WAIT_LIGHT_SLEEP, only the final refresh does.
+//   (requires ~48kB more heap than the default paged rendering)
+#define PIPELINED_RENDERING 0
+
+// SKIP UNCHANGED REFRESH
+//   If set to 1, the frame is hashed before the panel is powered up and the
+//   hash is kept in RTC memory across deep sleep. When nothing but the last
+//   refresh time differs from the frame on the panel, the panel is not
+//   refreshed (the status bar then shows when the content last changed).
+#define SKIP_UNCHANGED_REFRESH 0
+
+// ADAPTIVE REFRESH
+//   If set to 1, the time until the next update is chosen every wake from the
+//   forecast (upcoming precipitation, rapid temperature changes and alerts
+//   shorten it), the time of day and the battery, within the energy budget set
+//   by BATTERY_CAPACITY and TARGET_BATTERY_LIFE in config.cpp. If set to 0,
+//   the display updates every SLEEP_DURATION minutes.
+//   Use tools/refresh_sim.cpp to compare the two on a year of weather.
+#define ADAPTIVE_REFRESH 0
+
+// RENDER CAPTURE
+//   If set to 1, the e-paper panel is replaced by an in-memory frame buffer of
+//   the same size and color planes as the selected panel. Instead of refreshing
+//   the panel, each rendered frame is written to the serial port along with the
+//   time spent in each render function. Use tools/render_capture.py to save the
+//   frames as PBM/PNG files and compare them against golden images. The native
+//   test test/test_render draws a fixed frame the same way on the host and
+//   compares it against test/test_render/golden.
+//   (requires ~48kB of heap per color plane)
+#define RENDER_CAPTURE 0
+
 // DEBUG MODE - Skip hardware checks for development
 //   When enabled, skips battery monitoring and sensor initialization
 //   *This allows testing without battery or BME280 sensor connected*
@@ -309,6 +386,7 @@ extern const unsigned HTTP_CLIENT_TCP_TIMEOUT;
 extern const String OWM_APIKEY;
 extern const String OWM_ENDPOINT;
 extern const String OWM_ONECALL_VERSION;
+extern const String OWM_ALERTS_ENDPOINT;
 extern const String LAT;
 extern const String LON;
 extern const String CITY_STRING;
@@ -323,6 +401,8 @@ extern const unsigned long NTP_TIMEOUT;
 extern const int SLEEP_DURATION;
 extern const int BED_TIME;
 extern const int WAKE_TIME;
+extern const int MIN_SLEEP_DURATION;
+extern const int MAX_SLEEP_DURATION;
 extern const int HOURLY_GRAPH_MAX;
 extern const uint32_t WARN_BATTERY_VOLTAGE;
 extern const uint32_t LOW_BATTERY_VOLTAGE;
@@ -332,6 +412,9 @@ extern const unsigned long LOW_BATTERY_SLEEP_INTERVAL;
 extern const unsigned long VERY_LOW_BATTERY_SLEEP_INTERVAL;
 extern const uint32_t MAX_BATTERY_VOLTAGE;
 extern const uint32_t MIN_BATTERY_VOLTAGE;
+extern const uint32_t PRECISE_SENSOR_BATTERY_VOLTAGE;
+extern const uint32_t BATTERY_CAPACITY;
+extern const int TARGET_BATTERY_LIFE;
 
 #ifdef MQTT_OTA_UPGRADE
 // MQTT OTA升级配置变量声明
@@ -412,7 +495,8 @@ extern const bool MQTT_OTA_ALLOW_DOWNGRADE;
 #if defined(WIND_INDICATOR_ARROW) &&                                           \
     !(defined(WIND_ICONS_CARDINAL) ^ defined(WIND_ICONS_INTERCARDINAL) ^       \
       defined(WIND_ICONS_SECONDARY_INTERCARDINAL) ^                            \
-      defined(WIND_ICONS_TERTIARY_INTERCARDINAL) ^ defined(WIND_ICONS_360))
+      defined(WIND_ICONS_TERTIARY_INTERCARDINAL) ^ defined(WIND_ICONS_360) ^   \
+      defined(WIND_ICONS_ROTATED))
 #error Invalid configuration. Exactly one wind direction icon precision level must be selected.
 #endif
 #if !(defined(FONT_HEADER))
@@ -433,5 +517,36 @@ extern const bool MQTT_OTA_ALLOW_DOWNGRADE;
 #if !(defined(DEBUG_LEVEL))
 #error Invalid configuration. DEBUG_LEVEL not defined.
 #endif
+#if !(defined(TOKENIZED_LOG))
+#error Invalid configuration. TOKENIZED_LOG not defined.
+#endif
+#if TOKENIZED_LOG && !(TLOG_RING_SIZE >= 256 \
+                       && (TLOG_RING_SIZE & (TLOG_RING_SIZE - 1)) == 0)
+#error Invalid configuration. TLOG_RING_SIZE must be a power of 2 >= 256.
+#endif
+#if !(defined(BUSY_WAIT_LIGHT_SLEEP))
+#error Invalid configuration. BUSY_WAIT_LIGHT_SLEEP not defined.
+#endif
+#if BUSY_WAIT_LIGHT_SLEEP && !(BUSY_WAIT_SLEEP_TIMEOUT_MS > 0)
+#error Invalid configuration. BUSY_WAIT_SLEEP_TIMEOUT_MS must be defined and > 0.
+#endif
+#if !(defined(PIPELINED_RENDERING))
+#error Invalid configuration. PIPELINED_RENDERING not defined.
+#endif
+#if !(defined(SKIP_UNCHANGED_REFRESH))
+#error Invalid configuration. SKIP_UNCHANGED_REFRESH not defined.
+#endif
+#if !(defined(ADAPTIVE_REFRESH))
+#error Invalid configuration. ADAPTIVE_REFRESH not defined.
+#endif
+#if !(defined(RENDER_CAPTURE))
+#error Invalid configuration. RENDER_CAPTURE not defined.
+#endif
+#if defined(ASSET_PARTITION) && !defined(ICON_ATLAS)
+#error Invalid configuration. ASSET_PARTITION requires ICON_ATLAS.
+#endif
+#if defined(UNICODE_FONT) && !defined(ASSET_PARTITION)
+#error Invalid configuration. UNICODE_FONT requires ASSET_PARTITION.
+#endif
 
 #endif
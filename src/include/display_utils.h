@@ -21,6 +21,7 @@
 #include <vector>
 #include <time.h>
 #include "api_response.h"
+#include "icons/icons.h"
 
 enum alert_category {
   NOT_FOUND = -1,
@@ -57,18 +58,19 @@ void getDateStr(String &s, tm *timeInfo);
 void getRefreshTimeStr(String &s, bool timeSuccess, tm *timeInfo);
 void toTitleCase(String &text);
 void truncateExtraAlertInfo(String &text);
-void filterAlerts(std::vector<owm_alerts_t> &resp, int *ignore_list);
+void summarizeAlert(owm_resp_alerts_t &alerts, int i);
+int filterAlerts(owm_resp_alerts_t &alerts, int selected[2]);
 const char *getUVIdesc(unsigned int uvi);
 float getAvgConc(const float pollutant[], int hours);
 int getAQI(const owm_resp_air_pollution_t &p);
 const char *getAQIdesc(int aqi);
 const char *getWiFidesc(int rssi);
 const uint8_t *getWiFiBitmap16(int rssi);
-const uint8_t *getHourlyForecastBitmap32(const owm_hourly_t &hourly,
-                                         const owm_daily_t  &today);
-const uint8_t *getDailyForecastBitmap64(const owm_daily_t &daily);
-const uint8_t *getCurrentConditionsBitmap196(const owm_current_t &current,
-                                             const owm_daily_t   &today);
+icon_name_t getHourlyForecastIcon(const owm_hourly_t &hourly,
+                                  const owm_daily_t  &today);
+icon_name_t getDailyForecastIcon(const owm_daily_t &daily);
+icon_name_t getCurrentConditionsIcon(const owm_current_t &current,
+                                     const owm_daily_t   &today);
 const uint8_t *getAlertBitmap32(const owm_alerts_t &alert);
 const uint8_t *getAlertBitmap48(const owm_alerts_t &alert);
 enum alert_category getAlertCategory(const owm_alerts_t &alert);
@@ -3,10 +3,12 @@
  * 负责管理BMP280+AHT20双传感器系统
  *
  * 功能：
- * - I2C设备扫描和发现
+ * - I2C设备扫描和发现（定时唤醒时使用RTC内存中的设备表）
  * - BMP280和AHT20传感器初始化
  * - 传感器状态管理和监控
  * - 统一的数据读取接口
+ * - 异步测量：转换期间不阻塞，失败按截止时间重试
+ * - 采集配置：按电池电量选择，统计每种配置的实际耗时
  * - 错误处理和重试机制
  */
 
@@ -14,16 +16,10 @@
 #define __DUAL_SENSOR_MANAGER_H__
 
 #include "config.h"
+#include "sensor_measurement.h"
 #include <Arduino.h>
 #include <Wire.h>
 
-#if defined(SENSOR_BMP280)
-#include <Adafruit_BMP280.h>
-#endif
-#if defined(SENSOR_AHT20)
-#include <Adafruit_AHTX0.h>
-#endif
-
 // 传感器数据结构
 struct SensorData {
   // 温度数据
@@ -68,11 +64,29 @@ struct SensorStatus {
         aht20Address(0x38), i2cInitialized(false), lastScan(0), errorCount(0) {}
 };
 
+// 基于TwoWire的传感器总线
+class TwoWireSensorBus : public SensorBus {
+public:
+  TwoWireSensorBus() : wire(nullptr) {}
+  void attach(TwoWire *wire) { this->wire = wire; }
+
+  bool write(uint8_t address, const uint8_t *data, size_t len) override;
+  bool read(uint8_t address, uint8_t *data, size_t len) override;
+
+private:
+  TwoWire *wire;
+};
+
 class DualSensorManager {
 public:
   DualSensorManager();
   ~DualSensorManager();
 
+  // 采集配置，需要在initialize()之前选择
+  void setProfile(AcquisitionProfileId id);
+  void selectProfile(uint32_t batteryVoltage);
+  const AcquisitionProfile &getProfile() const;
+
   // 初始化和配置
   bool initialize();
   bool initializeI2C();
@@ -90,8 +104,14 @@ public:
 
   // 数据读取
   SensorData readAllSensors();
-  bool readBMP280Data(float &temperature, float &pressure, float &altitude);
-  bool readAHT20Data(float &temperature, float &humidity);
+
+  // 异步测量：startMeasurement()同时触发两个传感器的转换后立即返回，
+  // 转换期间可以做其他工作，之后用poll()或await()取结果。await()在截止
+  // 时间之间浅睡眠
+  bool startMeasurement();
+  MeasurementState poll();
+  // timeoutMs为0时使用MEASUREMENT_TIMEOUT_MS加上配置的预计转换时间
+  SensorData await(unsigned long timeoutMs = 0);
 
   // 状态管理
   SensorStatus getStatus() const;
@@ -110,16 +130,17 @@ public:
   void printSensorData(const SensorData &data) const;
 
 private:
-  // I2C对象
+  // I2C对象，指向静态存储
   TwoWire *i2c;
 
-  // 传感器对象
-#if defined(SENSOR_BMP280)
-  Adafruit_BMP280 *bmp280;
-#endif
-#if defined(SENSOR_AHT20)
-  Adafruit_AHTX0 *aht20;
-#endif
+  // 异步测量
+  TwoWireSensorBus bus;
+  SensorMeasurement measurement;
+
+  // 采集配置
+  AcquisitionProfileId profileId;
+  AcquisitionProfile profile;
+  unsigned long measurementStart; // startMeasurement()的时间
 
   // 状态变量
   SensorStatus status;
@@ -129,15 +150,24 @@ private:
   static const uint8_t BMP280_ADDR_1 = 0x76;    // SDO->GND
   static const uint8_t BMP280_ADDR_2 = 0x77;    // SDO->VCC
   static const uint8_t AHT20_ADDR = 0x38;       // 固定地址
-  static const uint32_t I2C_FREQUENCY = 100000; // 100kHz
   static const int MAX_RETRY_COUNT = 3;
   static constexpr float SEA_LEVEL_PRESSURE = 1013.25; // hPa
+  // 覆盖单次转换的最坏情况：3次转换超时加2次重试间隔
+  static const unsigned long MEASUREMENT_TIMEOUT_MS = 2000;
+  // 更短的等待不值得进入浅睡眠
+  static const uint32_t LIGHT_SLEEP_MIN_MS = 2;
 
   // 内部辅助函数
   bool configureBMP280();
-  bool validateSensorData(float value) const;
-  void logError(const String &message);
-  void logSuccess(const String &message);
+  bool restoreFromDeviceMap();
+  void saveDeviceMap();
+  void countFailures();
+  static void sleepMs(uint32_t ms);
+  void recordTiming(unsigned long waited);
+  SensorData toSensorData(const MeasurementResult &result) const;
+  void logError(const char *message);
+  void logSuccess(const char *message);
+  void logHeap(const char *stage) const;
   unsigned long getCurrentTime() const;
 };
 
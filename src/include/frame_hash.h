@@ -0,0 +1,245 @@
+/* Frame hashing display wrapper for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __FRAME_HASH_H__
+#define __FRAME_HASH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <Adafruit_GFX.h>
+
+#include "raster.h"
+
+/* Adds a hashing mode to a display class.
+ *
+ * Between beginHash() and endHash() nothing is drawn. Instead every drawing
+ * primitive (pixel, line, rect, bitmap) is folded into a 32-bit hash
+ * together with its arguments, so drawing the same frame twice yields the same
+ * hash without ever touching the page buffer or the panel. Primitives are
+ * hashed at the highest level available (one record per Unicode glyph, one
+ * word per 32 bitmap pixels), which keeps a hash pass cheaper than a render
+ * pass. Adafruit_GFX::drawChar() is not virtual, GFX font glyphs are hashed
+ * through the drawPixel()/fillRect() calls it makes.
+ *
+ * Outside of hashing mode all calls are forwarded to the wrapped display.
+ */
+template <typename Base>
+class FrameHashDisplay : public Base
+{
+public:
+  using Base::Base;
+
+  void beginHash()
+  {
+    _hashing = true;
+    _hash = HASH_SEED;
+  }
+
+  uint32_t endHash()
+  {
+    _hashing = false;
+    // final avalanche (MurmurHash3 fmix32)
+    uint32_t h = _hash;
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+  }
+
+  bool isHashing() const { return _hashing; }
+
+  // Adafruit_GFX keeps the current font protected
+  const GFXfont *getFont() const { return this->gfxFont; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::drawPixel(x, y, color);
+      return;
+    }
+    mix(OP_PIXEL | color);
+    mix(pack(x, y));
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::drawFastHLine(x, y, w, color);
+      return;
+    }
+    mix(OP_HLINE | color);
+    mix(pack(x, y));
+    mix(w);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::drawFastVLine(x, y, h, color);
+      return;
+    }
+    mix(OP_VLINE | color);
+    mix(pack(x, y));
+    mix(h);
+  }
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::drawLine(x0, y0, x1, y1, color);
+      return;
+    }
+    mix(OP_LINE | color);
+    mix(pack(x0, y0));
+    mix(pack(x1, y1));
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::fillRect(x, y, w, h, color);
+      return;
+    }
+    mix(OP_RECT | color);
+    mix(pack(x, y));
+    mix(pack(w, h));
+  }
+
+  void fillScreen(uint16_t color) override
+  {
+    if (!_hashing)
+    {
+      Base::fillScreen(color);
+      return;
+    }
+    mix(OP_SCREEN | color);
+  }
+
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color)
+  {
+    if (!_hashing)
+    {
+      Base::drawInvertedBitmap(x, y, bitmap, w, h, color);
+      return;
+    }
+    // Hashed by content: rotated wind arrows and atlas icons are decoded into
+    // RAM buffers that are reused, so an address does not identify a bitmap.
+    mix(OP_BITMAP | color);
+    mix(pack(x, y));
+    mix(pack(w, h));
+    const size_t n = static_cast<size_t>((w + 7) / 8) * h;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      mix(static_cast<uint32_t>(pgm_read_byte(&bitmap[i]))
+          | (static_cast<uint32_t>(pgm_read_byte(&bitmap[i + 1])) << 8)
+          | (static_cast<uint32_t>(pgm_read_byte(&bitmap[i + 2])) << 16)
+          | (static_cast<uint32_t>(pgm_read_byte(&bitmap[i + 3])) << 24));
+    }
+    uint32_t tail = 0;
+    for (; i < n; ++i)
+    {
+      tail = (tail << 8) | pgm_read_byte(&bitmap[i]);
+    }
+    mix(tail);
+  }
+
+  // Pattern rows of fillPatternRect (see raster.h), only reached through
+  // patternSpans() when the wrapped display is a PatternSpanSurface.
+  bool fillPatternSpan(int16_t x, int16_t y, int16_t w, uint8_t bits,
+                       uint16_t color)
+  {
+    if (_hashing)
+    {
+      mix(OP_SPAN | color);
+      mix(pack(x, y));
+      mix(pack(w, bits));
+      return true;
+    }
+    if constexpr (std::is_base_of<PatternSpanSurface, Base>::value)
+    {
+      return Base::fillPatternSpan(x, y, w, bits, color);
+    }
+    return false;
+  }
+
+  // Unicode glyphs are decoded into a RAM cache (see unicode_font.h), so they
+  // are hashed by font and code point instead. Does nothing outside of
+  // hashing mode, the caller draws the decoded bitmap.
+  void hashGlyph(int16_t x, int16_t y, const void *font, uint32_t codepoint,
+                 uint16_t color)
+  {
+    if (!_hashing)
+    {
+      return;
+    }
+    mix(OP_GLYPH | color);
+    mix(pack(x, y));
+    mix(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(font)));
+    mix(codepoint);
+  }
+
+private:
+  static const uint32_t HASH_SEED = 0x9747b28c;
+  static const uint32_t OP_PIXEL  = 1UL << 16;
+  static const uint32_t OP_HLINE  = 2UL << 16;
+  static const uint32_t OP_VLINE  = 3UL << 16;
+  static const uint32_t OP_LINE   = 4UL << 16;
+  static const uint32_t OP_RECT   = 5UL << 16;
+  static const uint32_t OP_SCREEN = 6UL << 16;
+  static const uint32_t OP_BITMAP = 8UL << 16;
+  static const uint32_t OP_GLYPH  = 9UL << 16;
+  static const uint32_t OP_SPAN   = 10UL << 16;
+
+  bool     _hashing = false;
+  uint32_t _hash    = HASH_SEED;
+
+  static uint32_t pack(int16_t a, int16_t b)
+  {
+    return (static_cast<uint32_t>(static_cast<uint16_t>(a)) << 16)
+           | static_cast<uint16_t>(b);
+  }
+
+  static uint32_t rotl(uint32_t v, int r)
+  {
+    return (v << r) | (v >> (32 - r));
+  }
+
+  // MurmurHash3 (x86_32) block mix
+  void mix(uint32_t k)
+  {
+    k *= 0xcc9e2d51;
+    k = rotl(k, 15);
+    k *= 0x1b873593;
+    _hash ^= k;
+    _hash = rotl(_hash, 13);
+    _hash = _hash * 5 + 0xe6546b64;
+  }
+};
+
+#endif
@@ -0,0 +1,32 @@
+/* Compressed icon atlas declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ICON_ATLAS_H__
+#define __ICON_ATLAS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_GFX.h>
+#include "icons/icons.h"
+
+#ifdef ICON_ATLAS
+bool drawAtlasIcon(Adafruit_GFX &gfx, int16_t x, int16_t y, icon_name_t icon,
+                   size_t size, uint16_t color);
+void clearIconCache();
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/* Indoor sensor history declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __INDOOR_HISTORY_H__
+#define __INDOOR_HISTORY_H__
+
+#include <cstdint>
+#include <ctime>
+
+// A ring of indoor samples, one per time slot of the grid wakes are aligned to
+// (MIN_SLEEP_DURATION with ADAPTIVE_REFRESH, else SLEEP_DURATION). Slots
+// without a wake (longer intervals, bed time, failed wakes) are stored as
+// missing samples, so the position of a sample gives its time. The ring is
+// small enough to live in RTC memory: 256 samples are 2.6 days at 15 minutes
+// or 5 days at 30 minutes in about 1 KB.
+#define INDOOR_HISTORY_MAGIC    0x494E4831 // "INH1"
+#define INDOOR_HISTORY_CAPACITY 256
+
+// Every sample is one 32-bit word of fixed-point deltas from the previous
+// sample, the most negative value of a field marks a missing reading.
+//   bits 31-21  temperature, 0.1 °C
+//   bits 20-12  relative humidity, 0.5 %
+//   bits 11-0   pressure, 0.1 hPa
+#define INDOOR_TEMP_BITS     11
+#define INDOOR_HUMIDITY_BITS 9
+#define INDOOR_PRESSURE_BITS 12
+#define INDOOR_TEMP_SCALE     10 // steps per °C
+#define INDOOR_HUMIDITY_SCALE 2  // steps per %
+#define INDOOR_PRESSURE_SCALE 10 // steps per hPa
+
+// A pressure change of less than this over 3 hours is steady.
+#define INDOOR_PRESSURE_STEADY_HPA 1.0f
+
+typedef struct indoor_history
+{
+  uint32_t magic;
+  uint32_t newest_slot; // time slot of the newest sample
+  uint16_t period_min;  // minutes per time slot
+  uint16_t head;        // index the next sample is written to
+  uint16_t count;       // number of samples stored
+  // Decoded values, in steps, after the oldest sample (base) and after the
+  // newest sample (last). A missing reading leaves the value unchanged.
+  int16_t  base[3];
+  int16_t  last[3];
+  uint32_t samples[INDOOR_HISTORY_CAPACITY];
+} indoor_history_t;
+
+typedef enum indoor_tendency
+{
+  INDOOR_TENDENCY_UNKNOWN,
+  INDOOR_TENDENCY_FALLING,
+  INDOOR_TENDENCY_STEADY,
+  INDOOR_TENDENCY_RISING,
+} indoor_tendency_t;
+
+// The history decoded into a fixed number of columns for drawing, each column
+// holds the newest sample that falls into it or NAN. Columns are a fixed
+// number of slots wide and only completed columns are decoded, so the trend
+// changes once per column rather than on every wake.
+typedef struct indoor_trend
+{
+  float *temp;      // °C
+  float *humidity;  // %
+  int    columns;
+  float  temp_min, temp_max;
+  float  humidity_min, humidity_max;
+  float  pressure_change; // hPa over the last 3 hours, NAN if unknown
+  indoor_tendency_t tendency;
+} indoor_trend_t;
+
+void initIndoorHistory(indoor_history_t &h, uint16_t periodMin);
+void appendIndoorSample(indoor_history_t &h, uint16_t periodMin, time_t now,
+                        float temp, float humidity, float pressure);
+void getIndoorTrend(const indoor_history_t &h, indoor_trend_t &trend);
+
+#endif
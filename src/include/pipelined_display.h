@@ -0,0 +1,382 @@
+/* Pipelined paged display for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PIPELINED_DISPLAY_H__
+#define __PIPELINED_DISPLAY_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "busy_wait.h"
+#include "raster.h"
+
+/* Drop-in replacement for GxEPD2_3C that overlaps rendering with the SPI
+ * transfer. (enabled with PIPELINED_RENDERING)
+ *
+ * GxEPD2_3C renders a page into its buffer and then blocks in nextPage() while
+ * the page is written to the controller, so rendering and transfer never
+ * overlap. This class keeps two page buffers instead. nextPage() hands the
+ * finished page to a transfer task running on the other core and immediately
+ * returns, so the next page is rendered while the previous one is being
+ * written. The refresh is started once the last page has been written.
+ *
+ * Pages use the GxEPD2_3C buffer format (a black and a color plane, a cleared
+ * bit is an inked pixel), so the driver's writeImage() is used unchanged. The
+ * buffers are allocated from the heap by init(). Every page re-runs the whole
+ * render code, so more, smaller pages do not pay off; half the panel height is
+ * a good choice. Only full window refreshes are supported.
+ *
+ * Light sleep in the busy waits of the transfer task would stop the core that
+ * is rendering, so it is not allowed until the last page has been written.
+ * The destructor lets the transfer task finish the queued pages and stop
+ * before the queue, semaphores and buffers are deleted.
+ */
+template <typename Driver, uint16_t page_height>
+class PipelinedDisplay3C : public Adafruit_GFX, public PatternSpanSurface
+{
+public:
+  Driver epd2;
+
+  PipelinedDisplay3C(Driver epd2_instance)
+    : Adafruit_GFX(Driver::WIDTH, Driver::HEIGHT), epd2(epd2_instance)
+  {}
+
+  PipelinedDisplay3C(const PipelinedDisplay3C &) = delete;
+  PipelinedDisplay3C &operator=(const PipelinedDisplay3C &) = delete;
+
+  ~PipelinedDisplay3C()
+  {
+    if (_task != nullptr)
+    {
+      const uint16_t stop = STOP_PAGE;
+      xQueueSend(_pending, &stop, portMAX_DELAY);
+      xSemaphoreTake(_stopped, portMAX_DELAY);
+    }
+    if (_pending != nullptr)
+    {
+      vQueueDelete(_pending);
+      vSemaphoreDelete(_stopped);
+      for (int b = 0; b < NUM_BUFFERS; ++b)
+      {
+        vSemaphoreDelete(_free[b]);
+      }
+    }
+    free(_buffer[0]);
+    free(_buffer[1]);
+  }
+
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false)
+  {
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+    if (_buffer[0] == nullptr)
+    {
+      _buffer[0] = static_cast<uint8_t *>(malloc(2 * PLANE_SIZE));
+      _buffer[1] = static_cast<uint8_t *>(malloc(2 * PLANE_SIZE));
+    }
+    if (_pending == nullptr)
+    {
+      _pending = xQueueCreate(NUM_BUFFERS, sizeof(uint16_t));
+      _stopped = xSemaphoreCreateBinary();
+      for (int b = 0; b < NUM_BUFFERS; ++b)
+      {
+        _free[b] = xSemaphoreCreateBinary();
+        xSemaphoreGive(_free[b]);
+      }
+      // Arduino runs setup() on core 1, WiFi is off by the time we render so
+      // core 0 is otherwise idle.
+      xTaskCreatePinnedToCore(transferTask, "epd_transfer", 4096, this,
+                              uxTaskPriorityGet(nullptr), &_task, 0);
+    }
+    if (_buffer[0] == nullptr || _buffer[1] == nullptr || _task == nullptr)
+    {
+      Serial.println("Error: Failed to allocate page buffers.");
+    }
+    return;
+  }
+
+  void setFullWindow()
+  {
+    return;
+  }
+
+  /* The 3-color panels do not support fast partial refresh, the whole frame is
+   * always written.
+   */
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+  {
+    return;
+  }
+
+  void firstPage()
+  {
+    setBusyWaitSleepAllowed(false);
+    _page = 0;
+    beginPage();
+    return;
+  }
+
+  /* Queues the current page for transfer and begins the next one, once its
+   * buffer has been written to the controller. After the last page the panel
+   * is refreshed and false is returned.
+   */
+  bool nextPage()
+  {
+    if (_buffer[0] == nullptr || _buffer[1] == nullptr || _task == nullptr)
+    {
+      setBusyWaitSleepAllowed(true);
+      return false;
+    }
+    xQueueSend(_pending, &_page, portMAX_DELAY);
+    ++_page;
+    if (_page < NUM_PAGES)
+    {
+      beginPage();
+      return true;
+    }
+
+    // The transfer task works in order, so once the buffer of the last page is
+    // released every page has been written.
+    const int last = (_page - 1) % NUM_BUFFERS;
+    xSemaphoreTake(_free[last], portMAX_DELAY);
+    xSemaphoreGive(_free[last]);
+    setBusyWaitSleepAllowed(true);
+    epd2.refresh(false);
+    _page = 0;
+    return false;
+  }
+
+  void hibernate()
+  {
+    epd2.hibernate();
+    return;
+  }
+
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color)
+  {
+    const int16_t byteWidth = (w + 7) / 8;
+    // skip the rows outside of the current page
+    const int16_t j0 = getRotation() == 0 ? std::max(0, _pageY - y) : 0;
+    const int16_t j1 = getRotation() == 0
+                       ? std::min<int16_t>(h, _pageY + page_height - y) : h;
+    for (int16_t j = j0; j < j1; ++j)
+    {
+      for (int16_t i = 0; i < w; ++i)
+      {
+        uint8_t b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+        if (!(b & (0x80 >> (i & 7))))
+        {
+          drawPixel(x + i, y + j, color);
+        }
+      }
+    }
+    return;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override
+  {
+    if (x < 0 || y < 0 || x >= width() || y >= height()
+     || _black == nullptr)
+    {
+      return;
+    }
+    switch (getRotation())
+    {
+    case 1:
+      std::swap(x, y);
+      x = WIDTH - 1 - x;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      std::swap(x, y);
+      y = HEIGHT - 1 - y;
+      break;
+    }
+    y -= _pageY;
+    if (y < 0 || y >= page_height)
+    {
+      return;
+    }
+
+    const size_t i = y * (WIDTH / 8) + x / 8;
+    const uint8_t bit = 0x80 >> (x & 7);
+    if (color == GxEPD_WHITE)
+    {
+      _black[i] |= bit;
+      _color[i] |= bit;
+    }
+    else if (color == GxEPD_BLACK)
+    {
+      _black[i] &= ~bit;
+      _color[i] |= bit;
+    }
+    else
+    {
+      _black[i] |= bit;
+      _color[i] &= ~bit;
+    }
+    return;
+  }
+
+  /* Solid fills are written a byte at a time when the display is not rotated.
+   */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override
+  {
+    if (_black == nullptr)
+    {
+      return;
+    }
+    if (getRotation() != 0)
+    {
+      Adafruit_GFX::fillRect(x, y, w, h, color);
+      return;
+    }
+    // clip to the page, then translate into the page buffer
+    const int16_t y0 = std::max<int16_t>(y, _pageY);
+    const int16_t y1 = std::min<int16_t>(y + h, _pageY + page_height);
+    if (y0 >= y1)
+    {
+      return;
+    }
+    fillPatternRect1bpp(_black, WIDTH, page_height, x, y0 - _pageY, w, y1 - y0,
+                        PATTERN_SOLID, color != GxEPD_BLACK);
+    fillPatternRect1bpp(_color, WIDTH, page_height, x, y0 - _pageY, w, y1 - y0,
+                        PATTERN_SOLID,
+                        color == GxEPD_BLACK || color == GxEPD_WHITE);
+    return;
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    fillRect(x, y, w, 1, color);
+    return;
+  }
+
+  /* Pattern rows are written a byte at a time when the display is not
+   * rotated.
+   */
+  bool fillPatternSpan(int16_t x, int16_t y, int16_t w, uint8_t bits,
+                       uint16_t color) override
+  {
+    if (getRotation() != 0)
+    {
+      return false;
+    }
+    y -= _pageY;
+    if (_black == nullptr || y < 0 || y >= page_height)
+    {
+      return true;
+    }
+    const int16_t xStart = std::max<int16_t>(x, 0);
+    const int16_t xEnd = std::min<int16_t>(x + w, WIDTH);
+    const size_t row = y * (WIDTH / 8);
+    fillPatternSpan1bpp(_black + row, xStart, xEnd, bits,
+                        color != GxEPD_BLACK);
+    fillPatternSpan1bpp(_color + row, xStart, xEnd, bits,
+                        color == GxEPD_BLACK || color == GxEPD_WHITE);
+    return true;
+  }
+
+  void fillScreen(uint16_t color) override
+  {
+    if (_black == nullptr)
+    {
+      return;
+    }
+    memset(_black, color != GxEPD_BLACK ? 0xff : 0x00, PLANE_SIZE);
+    memset(_color, (color == GxEPD_BLACK || color == GxEPD_WHITE) ? 0xff : 0x00,
+           PLANE_SIZE);
+    return;
+  }
+
+private:
+  static const int      NUM_BUFFERS = 2;
+  static const uint16_t NUM_PAGES = (Driver::HEIGHT + page_height - 1)
+                                    / page_height;
+  static const size_t   PLANE_SIZE = (Driver::WIDTH / 8) * page_height;
+  static const uint16_t STOP_PAGE = UINT16_MAX; // queued by the destructor
+
+  uint8_t          *_buffer[NUM_BUFFERS] = {nullptr, nullptr};
+  uint8_t          *_black = nullptr; // planes of the page being rendered
+  uint8_t          *_color = nullptr;
+  uint16_t          _page = 0;
+  int16_t           _pageY = 0;
+  QueueHandle_t     _pending = nullptr;
+  SemaphoreHandle_t _free[NUM_BUFFERS] = {nullptr, nullptr};
+  SemaphoreHandle_t _stopped = nullptr; // given when the transfer task ends
+  TaskHandle_t      _task = nullptr;
+
+  /* Waits until the buffer of the current page has been written (by the page
+   * NUM_BUFFERS before it), then clears it to white.
+   */
+  void beginPage()
+  {
+    const int b = _page % NUM_BUFFERS;
+    if (_buffer[b] == nullptr)
+    {
+      return;
+    }
+    xSemaphoreTake(_free[b], portMAX_DELAY);
+    _black = _buffer[b];
+    _color = _buffer[b] + PLANE_SIZE;
+    _pageY = _page * page_height;
+    fillScreen(GxEPD_WHITE);
+    return;
+  }
+
+  /* Writes queued pages to the controller and releases their buffers until
+   * STOP_PAGE is received. The object may be deleted as soon as _stopped is
+   * given, so it is not accessed after that.
+   */
+  static void transferTask(void *arg)
+  {
+    PipelinedDisplay3C *self = static_cast<PipelinedDisplay3C *>(arg);
+    uint16_t page;
+    while (true)
+    {
+      xQueueReceive(self->_pending, &page, portMAX_DELAY);
+      if (page == STOP_PAGE)
+      {
+        break;
+      }
+      const int b = page % NUM_BUFFERS;
+      const int16_t y = page * page_height;
+      const int16_t h = std::min<int16_t>(page_height, Driver::HEIGHT - y);
+      self->epd2.writeImage(self->_buffer[b], self->_buffer[b] + PLANE_SIZE,
+                            0, y, Driver::WIDTH, h, false, false, false);
+      xSemaphoreGive(self->_free[b]);
+    }
+    xSemaphoreGive(self->_stopped);
+    vTaskDelete(nullptr);
+  }
+};
+
+#endif
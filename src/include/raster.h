@@ -0,0 +1,84 @@
+/* Raster primitive declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __RASTER_H__
+#define __RASTER_H__
+
+#include <cstdint>
+#include <type_traits>
+#include <Adafruit_GFX.h>
+
+/* 8x8 ordered fill patterns.
+ *
+ * One byte per row, the most significant bit is the leftmost pixel. Patterns
+ * are anchored to absolute display coordinates (row y uses pattern[y & 7], the
+ * pixel at x uses bit (7 - (x & 7))), so adjacent fills tile seamlessly.
+ */
+extern const uint8_t PATTERN_SOLID[8];
+extern const uint8_t PATTERN_HATCH_EVEN_ROWS[8]; // even columns of even rows
+extern const uint8_t PATTERN_HATCH_ODD_ROWS[8];  // even columns of odd rows
+
+/* Implemented by drawing surfaces that keep their frame in 1 bit per pixel
+ * planes we can write to (not the GxEPD2 classes, their buffers are private),
+ * so fillPatternRect can write whole bytes instead of single pixels.
+ */
+class PatternSpanSurface
+{
+public:
+  /* Draws the pixels of row y in [x, x + w) whose bit in the pattern row bits
+   * (bit 7 - (col & 7)) is set, and leaves the others untouched. Returns false
+   * if the span can not be written directly (e.g. the surface is rotated), the
+   * caller then draws the pixels one by one.
+   */
+  virtual bool fillPatternSpan(int16_t x, int16_t y, int16_t w, uint8_t bits,
+                               uint16_t color) = 0;
+
+protected:
+  ~PatternSpanSurface() {}
+};
+
+/* Returns the span interface of a drawing surface, or nullptr if it has none.
+ */
+template <typename Gfx>
+inline PatternSpanSurface *patternSpans(Gfx &gfx)
+{
+  if constexpr (std::is_base_of<PatternSpanSurface, Gfx>::value)
+  {
+    return &gfx;
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+
+void drawThickLine(Adafruit_GFX &gfx, int16_t x0, int16_t y0,
+                   int16_t x1, int16_t y1, uint8_t width, uint16_t color);
+void drawDottedHLine(Adafruit_GFX &gfx, int16_t x0, int16_t x1, int16_t y,
+                     uint8_t stride, uint16_t color);
+void fillPatternRect(Adafruit_GFX &gfx, int16_t x, int16_t y,
+                     int16_t w, int16_t h, const uint8_t pattern[8],
+                     uint16_t color, PatternSpanSurface *spans = nullptr);
+void fillPatternSpan1bpp(uint8_t *row, int16_t x, int16_t xEnd, uint8_t bits,
+                         bool set);
+void fillPatternRect1bpp(uint8_t *buf, int16_t bufWidth, int16_t bufHeight,
+                         int16_t x, int16_t y, int16_t w, int16_t h,
+                         const uint8_t pattern[8], bool set);
+void rotateBitmap1bpp(const uint8_t *src, uint8_t *dst, int16_t dstSize,
+                      int deg);
+
+#endif
@@ -0,0 +1,96 @@
+/* Refresh scheduler declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __REFRESH_SCHEDULER_H__
+#define __REFRESH_SCHEDULER_H__
+
+#include <cstdint>
+#include <ctime>
+
+// The scheduler picks the time until the next wake. The weather asks for an
+// interval between the minimum (volatile weather, active alerts) and 1.5x the
+// nominal interval (calm weather). The energy budget sets a floor on it: the
+// charge per day of the wakes and of deep sleep must not exceed the battery
+// capacity divided by the target battery life. The charge of a wake is
+// estimated from the measured awake time and corrected by the drain of the
+// battery observed over whole days.
+#define REFRESH_SCHEDULER_MAGIC 0x52534331 // "RSC1"
+
+// Charge model
+#define SCHED_AWAKE_MA 90 // average current while awake (WiFi, panel refresh)
+#define SCHED_SLEEP_UA 15 // deep sleep, sensors powered off
+
+// Battery drain is compared to the model over windows of at least a day, as
+// the charge of a few wakes is well below the resolution of the ADC.
+#define SCHED_TREND_WINDOW_S (24 * 3600)
+// Correction of the model, 1.0 = 256, limited to [0.5, 4]
+#define SCHED_CALIBRATION_ONE 256
+#define SCHED_CALIBRATION_MIN (SCHED_CALIBRATION_ONE / 2)
+#define SCHED_CALIBRATION_MAX (SCHED_CALIBRATION_ONE * 4)
+// Below this charge intervals are stretched, up to 4x near empty.
+#define SCHED_LOW_BATTERY_PERMILLE 300
+// Hours after wake time in which the interval does not exceed the nominal one,
+// the display is read most in the morning.
+#define SCHED_MORNING_HOURS 2
+
+// Kept in RTC memory across deep sleep.
+typedef struct scheduler_state
+{
+  uint32_t magic;
+  uint32_t ref_time;      // start of the trend window, unix
+  uint32_t ref_charge_uah; // modelled charge used since ref_time
+  uint16_t ref_permille;  // battery charge at ref_time
+  uint16_t calibration;   // observed / modelled drain
+  uint16_t awake_ms;      // moving average of the awake time per wake
+  bool     charging;      // the battery rose over the last window
+} scheduler_state_t;
+
+typedef struct schedule_config
+{
+  int      min_interval;     // minutes
+  int      nominal_interval; // minutes
+  int      max_interval;     // minutes
+  int      bed_time;         // hour, equal to wake_time to disable
+  int      wake_time;        // hour
+  uint32_t capacity_mah;
+  int      target_days;
+  bool     adaptive;         // false: always wake at the nominal interval
+} schedule_config_t;
+
+typedef struct schedule_input
+{
+  time_t   now;
+  tm       local;            // local time of now
+  uint32_t awake_ms;         // time awake this wake
+  bool     battery_known;
+  uint32_t battery_permille;
+  float    volatility;       // 0 (calm) to 1, see forecastVolatility()
+} schedule_input_t;
+
+typedef struct schedule
+{
+  int      interval;         // minutes, before alignment
+  int      budget_interval;  // minutes, the floor set by the energy budget
+  uint32_t sleep_s;          // seconds until the next wake
+} schedule_t;
+
+float forecastVolatility(const float *pop, const float *temp, int n,
+                         float step, int alerts);
+void scheduleNextWake(scheduler_state_t &s, const schedule_config_t &cfg,
+                      const schedule_input_t &in, schedule_t &out);
+
+#endif
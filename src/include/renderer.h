@@ -23,35 +23,79 @@
 #include <time.h>
 #include "api_response.h"
 #include "config.h"
+#include "frame_hash.h"
+#include "indoor_history.h"
+
+#if RENDER_CAPTURE
+  #include "capture_display.h"
+#endif
 
 #ifdef DISP_BW_V2
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
+#if !RENDER_CAPTURE
   #include <GxEPD2_BW.h>
-  extern GxEPD2_BW<GxEPD2_750_T7,
-                   GxEPD2_750_T7::HEIGHT> display;
+  extern FrameHashDisplay<
+    GxEPD2_BW<GxEPD2_750_T7,
+              GxEPD2_750_T7::HEIGHT>> display;
+#endif
 #endif
 #ifdef DISP_3C_B
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
+#if !RENDER_CAPTURE && PIPELINED_RENDERING
   #include <GxEPD2_3C.h>
-  extern GxEPD2_3C<GxEPD2_750c_Z08,
-                   GxEPD2_750c_Z08::HEIGHT / 2> display;
+  #include "pipelined_display.h"
+  extern FrameHashDisplay<
+    PipelinedDisplay3C<GxEPD2_750c_Z08,
+                       GxEPD2_750c_Z08::HEIGHT / 2>> display;
+#elif !RENDER_CAPTURE
+  #include <GxEPD2_3C.h>
+  extern FrameHashDisplay<
+    GxEPD2_3C<GxEPD2_750c_Z08,
+              GxEPD2_750c_Z08::HEIGHT / 2>> display;
+#endif
 #endif
 #ifdef DISP_7C_F
   #define DISP_WIDTH  800
   #define DISP_HEIGHT 480
+#if !RENDER_CAPTURE
   #include <GxEPD2_7C.h>
-  extern GxEPD2_7C<GxEPD2_730c_GDEY073D46, 
-                   GxEPD2_730c_GDEY073D46::HEIGHT / 4> display;
+  extern FrameHashDisplay<
+    GxEPD2_7C<GxEPD2_730c_GDEY073D46,
+              GxEPD2_730c_GDEY073D46::HEIGHT / 4>> display;
+#endif
 #endif
 #ifdef DISP_BW_V1
   #define DISP_WIDTH  640
   #define DISP_HEIGHT 384
+#if !RENDER_CAPTURE
   #include <GxEPD2_BW.h>
-  extern GxEPD2_BW<GxEPD2_750,
-                   GxEPD2_750::HEIGHT> display;
+  extern FrameHashDisplay<
+    GxEPD2_BW<GxEPD2_750,
+              GxEPD2_750::HEIGHT>> display;
 #endif
+#endif
+
+#if RENDER_CAPTURE
+  extern FrameHashDisplay<CaptureDisplay> display;
+  // Times a render call and records it with the capture display.
+  #define RENDER_PROFILE(call)                                                 \
+    do                                                                         \
+    {                                                                          \
+      uint32_t render_t0 = micros();                                           \
+      call;                                                                    \
+      display.recordTiming(#call, micros() - render_t0);                       \
+    } while (0)
+#else
+  #define RENDER_PROFILE(call) call
+#endif
+
+typedef enum refresh_mode
+{
+  REFRESH_NONE, // panel already shows the frame
+  REFRESH_FULL
+} refresh_mode_t;
 
 typedef enum alignment
 {
@@ -70,12 +114,17 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
                        uint16_t color=GxEPD_BLACK);
 void initDisplay();
 void powerOffDisplay();
+void beginFrameHash();
+uint32_t endFrameHash();
+refresh_mode_t getRefreshMode(uint32_t frameHash);
+void setPanelFrameHash(uint32_t frameHash);
 void drawCurrentConditions(const owm_current_t &current,
                            const owm_daily_t &today,
                            const owm_resp_air_pollution_t &owm_air_pollution,
                            float inTemp, float inHumidity);
+void drawIndoorTrend(const indoor_history_t &history);
 void drawForecast(const owm_daily_t *daily, tm timeInfo);
-void drawAlerts(std::vector<owm_alerts_t> &alerts,
+void drawAlerts(owm_resp_alerts_t &alerts,
                 const String &city, const String &date);
 void drawLocationDate(const String &city, const String &date);
 void drawOutlookGraph(const owm_hourly_t *hourly, const owm_daily_t *daily,
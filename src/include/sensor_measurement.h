@@ -0,0 +1,272 @@
+/**
+ * 传感器异步测量模块
+ * BMP280+AHT20的非阻塞测量状态机
+ *
+ * 功能：
+ * - 同时触发AHT20转换和BMP280强制模式转换
+ * - poll()只在转换完成后读取结果，从不等待
+ * - 失败的测量按截止时间重试，而不是delay()
+ * - 通过SensorBus接口访问I2C，可以在主机上用模拟设备测试
+ * - 传感器设备表：保存在RTC内存中，唤醒时跳过I2C扫描
+ * - 采集配置：在精度和唤醒时间之间取舍
+ *
+ * 本模块不依赖Arduino，时间由调用者以毫秒传入。
+ */
+
+#ifndef __SENSOR_MEASUREMENT_H__
+#define __SENSOR_MEASUREMENT_H__
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// I2C总线接口
+class SensorBus {
+public:
+  virtual ~SensorBus() {}
+
+  // 向设备写入数据，设备应答返回true
+  virtual bool write(uint8_t address, const uint8_t *data, size_t len) = 0;
+  // 从设备读取len字节，读满返回true
+  virtual bool read(uint8_t address, uint8_t *data, size_t len) = 0;
+};
+
+// BMP280校准系数（寄存器0x88-0x9F，小端）
+struct Bmp280Calib {
+  uint16_t t1;
+  int16_t t2, t3;
+  uint16_t p1;
+  int16_t p2, p3, p4, p5, p6, p7, p8, p9;
+};
+
+// BMP280寄存器和ctrl_meas字段
+#define BMP280_REG_CALIB 0x88
+#define BMP280_REG_CHIP_ID 0xD0
+#define BMP280_CHIP_ID 0x58
+#define BMP280_REG_STATUS 0xF3
+#define BMP280_REG_CTRL_MEAS 0xF4
+#define BMP280_REG_CONFIG 0xF5
+#define BMP280_REG_DATA 0xF7
+#define BMP280_STATUS_MEASURING 0x08
+#define BMP280_MODE_SLEEP 0x00
+#define BMP280_MODE_FORCED 0x01
+// osrs: 0跳过，1-5对应x1, x2, x4, x8, x16
+#define BMP280_CTRL_MEAS(osrsT, osrsP, mode)                                   \
+  ((uint8_t)(((osrsT) << 5) | ((osrsP) << 2) | (mode)))
+// tsb: 待机时间，filter: 0关闭，1-4对应x2, x4, x8, x16
+#define BMP280_CONFIG(tsb, filter) ((uint8_t)(((tsb) << 5) | ((filter) << 2)))
+
+// AHT20命令和状态位
+#define AHT20_CMD_TRIGGER 0xAC
+#define AHT20_CMD_CALIBRATE 0xBE
+#define AHT20_CMD_SOFT_RESET 0xBA
+#define AHT20_STATUS_BUSY 0x80
+#define AHT20_STATUS_CALIBRATED 0x08
+
+// 校准系数、补偿和转换（与Adafruit驱动的整数算法一致）
+bool readBmp280Calib(SensorBus &bus, uint8_t address, Bmp280Calib &calib);
+uint32_t bmp280ConversionTime(uint8_t ctrlMeas);
+void compensateBmp280(const Bmp280Calib &calib, int32_t adcT, int32_t adcP,
+                      float &temperature, float &pressure);
+void convertAht20(const uint8_t raw[6], float &temperature, float &humidity);
+
+// 传感器初始化，代替Adafruit驱动的begin()：只通过SensorBus访问寄存器，
+// 不在堆上分配驱动对象和Adafruit_I2CDevice
+bool probeBmp280(SensorBus &bus, uint8_t address, uint8_t &chipId);
+// 软复位后等待校准完成，sleep(ms)用于等待。与Adafruit_AHTX0::begin()的
+// 步骤相同
+template <typename Sleep>
+bool initAht20(SensorBus &bus, uint8_t address, Sleep sleep);
+
+// 传感器设备表
+// 冷启动时扫描I2C总线得到，保存在RTC内存中。定时唤醒时只需确认设备仍然
+// 应答，不再扫描总线和重复读取校准系数。
+#define SENSOR_MAP_MAGIC 0x53454E31 // "SEN1"，结构变化时修改
+
+struct SensorDeviceMap {
+  uint32_t magic;
+  uint8_t bmp280Address; // 0表示不存在
+  uint8_t bmp280ChipId;
+  uint8_t aht20Address; // 0表示不存在
+  uint8_t reserved;
+  Bmp280Calib calib;
+  uint32_t crc; // 以上各字段的CRC-32
+};
+
+void sealSensorMap(SensorDeviceMap &map);
+bool isSensorMapValid(const SensorDeviceMap &map);
+bool verifySensorMap(SensorBus &bus, const SensorDeviceMap &map);
+
+// 采集配置
+// BMP280在传感器内用IIR滤波，取连续几次转换的最后一次；AHT20没有滤波，
+// 多次采样取平均。写入config时滤波器复位，所以只转换一次时IIR不起作用。
+enum AcquisitionProfileId {
+  PROFILE_FAST,     // 单次低过采样，电池电量低时使用
+  PROFILE_BALANCED, // 默认
+  PROFILE_PRECISE,  // 多次采样，电池电量充足时使用
+  NUM_ACQUISITION_PROFILES
+};
+
+struct AcquisitionProfile {
+  const char *name;
+  uint8_t ctrlMeas;      // BMP280 ctrl_meas（强制模式）
+  uint8_t config;        // BMP280 config（IIR滤波）
+  uint8_t bmpSamples;    // BMP280连续转换次数
+  uint8_t ahtSamples;    // AHT20采样次数
+  uint32_t i2cFrequency; // Hz
+  uint32_t conversionMs; // 预计转换时间（含I2C传输）
+  uint32_t chargeUc;     // 预计电荷（微库仑），假设CPU等待整个转换
+};
+
+AcquisitionProfile getAcquisitionProfile(AcquisitionProfileId id);
+
+// 测量状态
+enum MeasurementState {
+  MEASUREMENT_IDLE,    // 未开始
+  MEASUREMENT_PENDING, // 转换中或等待重试
+  MEASUREMENT_DONE     // 所有传感器都已完成（成功或重试用尽）
+};
+
+// 测量结果
+struct MeasurementResult {
+  float ahtTemperature; // 摄氏度
+  float humidity;       // 相对湿度百分比
+  bool ahtValid;
+
+  float bmpTemperature; // 摄氏度
+  float pressure;       // 帕斯卡
+  bool bmpValid;
+
+  MeasurementResult()
+      : ahtTemperature(NAN), humidity(NAN), ahtValid(false),
+        bmpTemperature(NAN), pressure(NAN), bmpValid(false) {}
+};
+
+class SensorMeasurement {
+public:
+  SensorMeasurement();
+
+  // 配置参与测量的传感器，未配置的传感器不测量
+  // samples: 连续转换次数，BMP280取最后一次，AHT20取平均
+  void configureBMP280(uint8_t address, const Bmp280Calib &calib,
+                       uint8_t ctrlMeas, uint8_t samples = 1);
+  void configureAHT20(uint8_t address, uint8_t samples = 1);
+  void reset();
+
+  // 触发所有已配置传感器的转换，没有已配置的传感器返回false
+  bool start(SensorBus &bus, uint32_t now);
+  // 处理所有已到截止时间的传感器，不等待
+  MeasurementState poll(SensorBus &bus, uint32_t now);
+  // 下一次需要poll()的时间
+  uint32_t nextDeadline() const;
+  // 等待测量完成，每次poll()之后调用sleep(ms)直到下一个截止时间，不忙等。
+  // now()返回毫秒时间。超过timeoutMs仍未完成时返回MEASUREMENT_PENDING
+  template <typename Now, typename Sleep>
+  MeasurementState await(SensorBus &bus, Now now, Sleep sleep,
+                         uint32_t timeoutMs);
+
+  MeasurementState getState() const;
+  const MeasurementResult &getResult() const;
+  uint8_t getAttempts(bool bmp280) const;
+
+  // 时间常量（毫秒）
+  static const uint32_t AHT20_CONVERSION_MS = 80;
+  // AHT20两次采样的开始间隔，限制自热
+  static const uint32_t AHT20_SAMPLE_INTERVAL_MS = 250;
+  static const uint32_t BUSY_RECHECK_MS = 10;        // 仍在转换时的再次检查间隔
+  static const uint32_t CONVERSION_TIMEOUT_MS = 200; // 超过则本次测量失败
+  static const uint32_t RETRY_INTERVAL_MS = 500;
+  static const uint8_t MAX_ATTEMPTS = 3;
+
+private:
+  // 单个传感器的测量通道
+  struct Channel {
+    bool enabled;   // 参与测量
+    bool finished;  // 成功或重试用尽
+    bool triggered; // 已触发转换，否则在等待重试
+    uint8_t address;
+    uint8_t samples;   // 需要的转换次数
+    uint8_t collected; // 已完成的转换次数
+    uint8_t attempts;  // 本次转换已触发的次数
+    uint32_t started;  // 本次转换的触发时间
+    uint32_t deadline; // 下一次处理的时间
+  };
+
+  // 读取结果：完成、仍在转换、失败
+  enum Collect { COLLECT_READY, COLLECT_BUSY, COLLECT_FAILED };
+
+  Channel bmp;
+  Channel aht;
+  Bmp280Calib calib;
+  uint8_t ctrlMeas;
+  MeasurementState state;
+  MeasurementResult result;
+  float ahtTemperatureSum; // AHT20各次采样之和
+  float humiditySum;
+
+  void trigger(SensorBus &bus, Channel &ch, bool isBmp, uint32_t now);
+  void advance(SensorBus &bus, Channel &ch, bool isBmp, uint32_t now);
+  void complete(Channel &ch, bool isBmp, uint32_t now);
+  void fail(Channel &ch, uint32_t now);
+  Collect collectBMP280(SensorBus &bus);
+  Collect collectAHT20(SensorBus &bus);
+};
+
+template <typename Now, typename Sleep>
+MeasurementState SensorMeasurement::await(SensorBus &bus, Now now, Sleep sleep,
+                                          uint32_t timeoutMs) {
+  const uint32_t start = now();
+  while (poll(bus, now()) == MEASUREMENT_PENDING) {
+    const uint32_t t = now();
+    const uint32_t elapsed = t - start;
+    if (elapsed >= timeoutMs) {
+      return MEASUREMENT_PENDING;
+    }
+
+    // 在下一个截止时间之前没有要做的事
+    int32_t wait = (int32_t)(nextDeadline() - t);
+    if (wait > (int32_t)(timeoutMs - elapsed)) {
+      wait = (int32_t)(timeoutMs - elapsed);
+    }
+    if (wait > 0) {
+      sleep((uint32_t)wait);
+    }
+  }
+  return state;
+}
+
+template <typename Sleep>
+bool initAht20(SensorBus &bus, uint8_t address, Sleep sleep) {
+  // 各步骤的等待时间和忙状态的最大检查次数
+  static const uint32_t RESET_MS = 20;
+  static const uint32_t BUSY_MS = 10;
+  static const int MAX_BUSY_CHECKS = 10;
+
+  auto waitIdle = [&](uint8_t &status) {
+    for (int i = 0; i < MAX_BUSY_CHECKS; i++) {
+      if (!bus.read(address, &status, 1)) {
+        return false;
+      }
+      if (!(status & AHT20_STATUS_BUSY)) {
+        return true;
+      }
+      sleep(BUSY_MS);
+    }
+    return false;
+  };
+
+  const uint8_t reset = AHT20_CMD_SOFT_RESET;
+  if (!bus.write(address, &reset, 1)) {
+    return false;
+  }
+  sleep(RESET_MS);
+
+  uint8_t status;
+  const uint8_t calibrate[3] = {AHT20_CMD_CALIBRATE, 0x08, 0x00};
+  if (!waitIdle(status) || !bus.write(address, calibrate, sizeof(calibrate))) {
+    return false;
+  }
+  return waitIdle(status) && (status & AHT20_STATUS_CALIBRATED);
+}
+
+#endif // __SENSOR_MEASUREMENT_H__
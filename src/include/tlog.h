@@ -0,0 +1,149 @@
+/* Tokenized log declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TLOG_H__
+#define __TLOG_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "config.h"
+
+// A record in the ring buffer is a length byte followed by
+//   uint32  id    address of the format string in flash, or a TLOG_ID_*
+//   uint32  time  milliseconds since boot
+// and the arguments in order, little endian:
+//   integers up to 32 bits  4 bytes
+//   64-bit integers         8 bytes
+//   float, double           4 bytes, as float
+//   strings                 TLOG_STRING_REF and a 4 byte address if the string
+//                           is in flash, else a length byte and the characters
+//   other pointers          4 bytes
+// The format strings are never read on the ESP32, tools/tlog_decode.py looks
+// them up in the firmware.elf. A message always ends with a newline.
+#define TLOG_MAGIC        0x544C4731 // "TLG1"
+#define TLOG_MAX_RECORD   255        // bytes after the length byte
+#define TLOG_MAX_STRING   48         // characters copied from a RAM string
+#define TLOG_STRING_REF   0xFF
+
+// Ids below the flash address range, written by tlog.cpp itself.
+// TLOG_ID_WAKE:       wake count, reset reason, records lost, ELF SHA-256
+// TLOG_ID_DUMP_BEGIN: not stored, sent before the records of a dump
+// TLOG_ID_DUMP_END:   not stored, sent after them
+#define TLOG_ID_WAKE       1
+#define TLOG_ID_DUMP_BEGIN 2
+#define TLOG_ID_DUMP_END   3
+
+// On the serial port a record is sent as TLOG_FRAME_START, the length byte,
+// the record and the low byte of the sum of the length byte and the record.
+// TLOG_FRAME_START is never part of UTF-8 text, so frames can be told apart
+// from the messages that are still printed as text.
+#define TLOG_FRAME_START  0xFE
+// Sent by the host to request all records in the ring buffer.
+#define TLOG_DUMP_REQUEST 'D'
+
+typedef struct tlog_record
+{
+  uint8_t len;
+  bool    full; // an argument did not fit, the rest are dropped
+  uint8_t data[TLOG_MAX_RECORD];
+} tlog_record_t;
+
+void tlogBegin();
+void tlogFlush();
+void tlogStart(tlog_record_t &r, uint32_t id);
+void tlogPut(tlog_record_t &r, const void *p, size_t n);
+void tlogPutString(tlog_record_t &r, const char *s);
+void tlogCommit(const tlog_record_t &r);
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value
+                               || std::is_enum<T>::value>::type
+tlogPutArg(tlog_record_t &r, T v)
+{
+  if (sizeof(T) > 4)
+  {
+    const uint64_t x = static_cast<uint64_t>(v);
+    tlogPut(r, &x, sizeof(x));
+  }
+  else
+  {
+    const uint32_t x = static_cast<uint32_t>(v);
+    tlogPut(r, &x, sizeof(x));
+  }
+  return;
+}
+
+inline void tlogPutArg(tlog_record_t &r, double v)
+{
+  const float x = static_cast<float>(v);
+  tlogPut(r, &x, sizeof(x));
+  return;
+}
+
+inline void tlogPutArg(tlog_record_t &r, const char *s)
+{
+  tlogPutString(r, s);
+  return;
+}
+
+inline void tlogPutArg(tlog_record_t &r, const void *p)
+{
+  const uint32_t x = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(p));
+  tlogPut(r, &x, sizeof(x));
+  return;
+}
+
+/* Stores a message in the ring buffer. fmt must be a string literal.
+ */
+template <typename... Args>
+void tlogWrite(const char *fmt, const Args &...args)
+{
+  tlog_record_t r;
+  tlogStart(r, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(fmt)));
+  (tlogPutArg(r, args), ...);
+  tlogCommit(r);
+  return;
+}
+
+// Never called, lets the compiler check the arguments against the format.
+inline void tlogCheckFormat(const char *fmt, ...)
+  __attribute__((format(printf, 1, 2)));
+inline void tlogCheckFormat(const char *fmt, ...)
+{
+  (void)fmt;
+  return;
+}
+
+// Logs a message, printf-style. fmt must be a string literal, the newline is
+// added.
+#if TOKENIZED_LOG
+#define TLOG(fmt, ...)                                                        \
+  do                                                                          \
+  {                                                                           \
+    if (false)                                                                \
+    {                                                                         \
+      tlogCheckFormat(fmt, ##__VA_ARGS__);                                    \
+    }                                                                         \
+    tlogWrite(fmt, ##__VA_ARGS__);                                            \
+  } while (0)
+#else
+#define TLOG(fmt, ...) Serial.printf(fmt "\n", ##__VA_ARGS__)
+#endif
+
+#endif
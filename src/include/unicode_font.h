@@ -0,0 +1,57 @@
+/* Unicode bitmap font declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __UNICODE_FONT_H__
+#define __UNICODE_FONT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include "asset_index.h"
+
+// Unicode fonts complement the 8-bit Adafruit GFX fonts with glyphs beyond
+// ISO-8859-1 (CJK, Cyrillic, ...). They are stored in the asset partition as
+// ASSET_UNICODE_FONT blobs built by tools/pack_assets.py --unicode-font and
+// read in place from flash. Glyph metrics and decoded bitmaps are cached in
+// RAM, text is usually measured and then drawn once for every page.
+
+// largest decoded glyph, rows padded to whole bytes (e.g. 32x32 pixels)
+#define UFONT_MAX_GLYPH_BYTES 128
+// returned by nextUtf8Char for malformed input
+#define UTF8_INVALID          0xffffffff
+
+typedef struct unicode_font
+{
+  const asset_unicode_font_t *header;
+  const asset_ufont_range_t  *ranges;
+  const asset_ufont_glyph_t  *glyphs;
+  const uint8_t              *data;
+} unicode_font_t;
+
+bool parseUnicodeFont(const uint8_t *blob, uint32_t length,
+                      unicode_font_t &font);
+const asset_ufont_glyph_t *findUnicodeGlyph(const unicode_font_t &font,
+                                            uint32_t codepoint);
+const asset_ufont_glyph_t *getUnicodeGlyph(const unicode_font_t &font,
+                                           uint32_t codepoint);
+const uint8_t *getUnicodeGlyphBitmap(const unicode_font_t &font,
+                                     uint32_t codepoint,
+                                     const asset_ufont_glyph_t **glyph);
+void clearUnicodeGlyphCache();
+uint32_t nextUtf8Char(const char *&p, const char *end);
+bool isUtf8Text(const char *s, size_t len);
+
+#endif
@@ -0,0 +1,283 @@
+/* Indoor sensor history for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like alert_classifier.cpp this file has no Arduino or ESP-IDF dependencies,
+// so the ring can be checked on the host.
+
+#include <algorithm>
+#include <cmath>
+
+#include "indoor_history.h"
+
+// field order of indoor_history_t::base and last
+enum { FIELD_TEMP, FIELD_HUMIDITY, FIELD_PRESSURE, NUM_FIELDS };
+
+static const int FIELD_BITS[NUM_FIELDS] =
+{
+  INDOOR_TEMP_BITS, INDOOR_HUMIDITY_BITS, INDOOR_PRESSURE_BITS
+};
+// position of the lowest bit of each field
+static const int FIELD_SHIFT[NUM_FIELDS] =
+{
+  INDOOR_HUMIDITY_BITS + INDOOR_PRESSURE_BITS, INDOOR_PRESSURE_BITS, 0
+};
+static const float FIELD_SCALE[NUM_FIELDS] =
+{
+  INDOOR_TEMP_SCALE, INDOOR_HUMIDITY_SCALE, INDOOR_PRESSURE_SCALE
+};
+// The values the deltas of an empty ring start from, 20 °C, 50 %, 1013.2 hPa.
+// Any reading is within one delta of them.
+static const int16_t FIELD_START[NUM_FIELDS] = {200, 100, 10132};
+
+/* Returns the delta of field f of a sample, or the missing marker.
+ */
+static inline int32_t getField(uint32_t sample, int f)
+{
+  return (int32_t) (sample << (32 - FIELD_SHIFT[f] - FIELD_BITS[f]))
+         >> (32 - FIELD_BITS[f]);
+} // end getField
+
+static inline int32_t missingMarker(int f)
+{
+  return -(1 << (FIELD_BITS[f] - 1));
+} // end missingMarker
+
+/* Clears the history.
+ */
+void initIndoorHistory(indoor_history_t &h, uint16_t periodMin)
+{
+  h.magic = INDOOR_HISTORY_MAGIC;
+  h.newest_slot = 0;
+  h.period_min = periodMin;
+  h.head = 0;
+  h.count = 0;
+  for (int f = 0; f < NUM_FIELDS; ++f)
+  {
+    h.base[f] = FIELD_START[f];
+    h.last[f] = FIELD_START[f];
+  }
+  return;
+} // end initIndoorHistory
+
+/* Writes one sample at the head of the ring, dropping the oldest if full.
+ * Values are in steps, NAN readings are passed as missing.
+ */
+static void pushSample(indoor_history_t &h, const float value[NUM_FIELDS])
+{
+  if (h.count == INDOOR_HISTORY_CAPACITY)
+  {
+    // The sample after the oldest becomes the oldest, base follows it.
+    uint32_t next = h.samples[(h.head + 1) % INDOOR_HISTORY_CAPACITY];
+    for (int f = 0; f < NUM_FIELDS; ++f)
+    {
+      int32_t delta = getField(next, f);
+      if (delta != missingMarker(f))
+      {
+        h.base[f] += delta;
+      }
+    }
+    --h.count;
+  }
+
+  uint32_t sample = 0;
+  for (int f = 0; f < NUM_FIELDS; ++f)
+  {
+    int32_t delta = missingMarker(f);
+    if (!std::isnan(value[f]))
+    {
+      // Deltas past the field are clamped, later samples catch up since they
+      // are taken from the decoded value.
+      const int32_t limit = (1 << (FIELD_BITS[f] - 1)) - 1;
+      delta = std::lround(value[f]) - h.last[f];
+      delta = delta < -limit ? -limit : (delta > limit ? limit : delta);
+      h.last[f] += delta;
+    }
+    sample |= ((uint32_t) delta & ((1u << FIELD_BITS[f]) - 1))
+              << FIELD_SHIFT[f];
+  }
+  h.samples[h.head] = sample;
+  h.head = (h.head + 1) % INDOOR_HISTORY_CAPACITY;
+  ++h.count;
+
+  if (h.count == 1)
+  {
+    for (int f = 0; f < NUM_FIELDS; ++f)
+    {
+      h.base[f] = h.last[f];
+    }
+  }
+  return;
+} // end pushSample
+
+/* Appends the readings of this wake, temperature in °C, relative humidity in %
+ * and pressure in Pa (NAN if unavailable). Slots since the previous sample are
+ * filled with missing samples, a second sample in the same slot is ignored.
+ * The history is cleared if it is not valid, was kept with another period, or
+ * the clock went backwards.
+ */
+void appendIndoorSample(indoor_history_t &h, uint16_t periodMin, time_t now,
+                        float temp, float humidity, float pressure)
+{
+  if (h.magic != INDOOR_HISTORY_MAGIC || h.period_min != periodMin
+   || h.head >= INDOOR_HISTORY_CAPACITY || h.count > INDOOR_HISTORY_CAPACITY)
+  {
+    initIndoorHistory(h, periodMin);
+  }
+
+  // wakes are aligned to the period, round to absorb RTC drift either way
+  const uint32_t period = periodMin * 60;
+  const uint32_t slot = (static_cast<uint32_t>(now) + period / 2) / period;
+  if (h.count > 0)
+  {
+    if (slot == h.newest_slot)
+    {
+      return;
+    }
+    if (slot < h.newest_slot
+     || slot - h.newest_slot > INDOOR_HISTORY_CAPACITY)
+    {
+      initIndoorHistory(h, periodMin);
+    }
+  }
+
+  if (h.count > 0)
+  {
+    const float missing[NUM_FIELDS] = {NAN, NAN, NAN};
+    for (uint32_t s = h.newest_slot + 1; s < slot; ++s)
+    {
+      pushSample(h, missing);
+    }
+  }
+  const float value[NUM_FIELDS] =
+  {
+    temp * INDOOR_TEMP_SCALE,
+    humidity * INDOOR_HUMIDITY_SCALE,
+    pressure / 100 * INDOOR_PRESSURE_SCALE
+  };
+  pushSample(h, value);
+  h.newest_slot = slot;
+  return;
+} // end appendIndoorSample
+
+/* Decodes the history into trend.columns columns in a single pass from the
+ * oldest sample to the newest. Columns are anchored to absolute slots and span
+ * the capacity of the ring, so the time scale does not change as the history
+ * fills up and a column does not change once it is complete. The column the
+ * newest sample falls into is still filling and is left out.
+ */
+void getIndoorTrend(const indoor_history_t &h, indoor_trend_t &trend)
+{
+  for (int c = 0; c < trend.columns; ++c)
+  {
+    trend.temp[c] = NAN;
+    trend.humidity[c] = NAN;
+  }
+  trend.pressure_change = NAN;
+  trend.tendency = INDOOR_TENDENCY_UNKNOWN;
+
+  // slots per column, the newest complete column is drawn last
+  const uint32_t spc = std::max(1, INDOOR_HISTORY_CAPACITY / trend.columns);
+  const int64_t firstColumn = static_cast<int64_t>((h.newest_slot + 1) / spc)
+                              - trend.columns;
+
+  // The pressure 3 hours before the newest sample, taken from the newest
+  // sample at least that old. Wakes further apart than the slots leave gaps,
+  // so up to 4.5 hours are accepted and the change is scaled to 3 hours.
+  const uint32_t back = 3 * 60 / h.period_min;
+  float pressureThen = NAN;
+  uint32_t slotThen = 0;
+
+  const uint32_t oldestSlot = h.newest_slot - (h.count - 1);
+  int idx = (h.head + INDOOR_HISTORY_CAPACITY - h.count)
+            % INDOOR_HISTORY_CAPACITY;
+  int32_t value[NUM_FIELDS] = {h.base[0], h.base[1], h.base[2]};
+  float decoded[NUM_FIELDS] = {};
+  for (int i = 0; i < h.count; ++i)
+  {
+    const uint32_t sample = h.samples[idx];
+    const uint32_t slot = oldestSlot + i;
+    idx = (idx + 1) % INDOOR_HISTORY_CAPACITY;
+    for (int f = 0; f < NUM_FIELDS; ++f)
+    {
+      const int32_t delta = getField(sample, f);
+      if (delta == missingMarker(f))
+      {
+        decoded[f] = NAN;
+        continue;
+      }
+      // base already holds the value of the oldest sample
+      if (i > 0)
+      {
+        value[f] += delta;
+      }
+      decoded[f] = value[f] / FIELD_SCALE[f];
+    }
+
+    const int64_t c = slot / spc - firstColumn;
+    if (c >= 0 && c < trend.columns)
+    {
+      if (!std::isnan(decoded[FIELD_TEMP]))
+      {
+        trend.temp[c] = decoded[FIELD_TEMP];
+      }
+      if (!std::isnan(decoded[FIELD_HUMIDITY]))
+      {
+        trend.humidity[c] = decoded[FIELD_HUMIDITY];
+      }
+    }
+    if (h.newest_slot - slot >= back && !std::isnan(decoded[FIELD_PRESSURE]))
+    {
+      pressureThen = decoded[FIELD_PRESSURE];
+      slotThen = slot;
+    }
+  }
+  if (back > 0 && h.count > 0 && !std::isnan(pressureThen)
+   && (h.newest_slot - slotThen) * 2 <= back * 3)
+  {
+    // NAN unless the newest sample has a pressure reading
+    trend.pressure_change = (decoded[FIELD_PRESSURE] - pressureThen) * back
+                            / (h.newest_slot - slotThen);
+  }
+
+  trend.temp_min = trend.humidity_min = NAN;
+  trend.temp_max = trend.humidity_max = NAN;
+  for (int c = 0; c < trend.columns; ++c)
+  {
+    // fmin and fmax ignore NAN
+    trend.temp_min = std::fmin(trend.temp_min, trend.temp[c]);
+    trend.temp_max = std::fmax(trend.temp_max, trend.temp[c]);
+    trend.humidity_min = std::fmin(trend.humidity_min, trend.humidity[c]);
+    trend.humidity_max = std::fmax(trend.humidity_max, trend.humidity[c]);
+  }
+
+  if (!std::isnan(trend.pressure_change))
+  {
+    if (trend.pressure_change >= INDOOR_PRESSURE_STEADY_HPA)
+    {
+      trend.tendency = INDOOR_TENDENCY_RISING;
+    }
+    else if (trend.pressure_change <= -INDOOR_PRESSURE_STEADY_HPA)
+    {
+      trend.tendency = INDOOR_TENDENCY_FALLING;
+    }
+    else
+    {
+      trend.tendency = INDOOR_TENDENCY_STEADY;
+    }
+  }
+  return;
+} // end getIndoorTrend
@@ -20,5 +20,11 @@
 #define STR(s) #s
 #define X_LOCALE_INC(code) STR(locales/locale_ ## code.inc)
 #define LOCALE_INC(code) X_LOCALE_INC(code)
+#define X_ALERT_TERMS_INC(code) STR(locales/alert_terms_ ## code.inc)
+#define ALERT_TERMS_INC(code) X_ALERT_TERMS_INC(code)
 
 #include LOCALE_INC(LOCALE)
+
+// generated from the terminology above by tools/alert_terms.py
+#include ALERT_TERMS_INC(LOCALE)
+const alert_matcher_t ALERT_MATCHER = {ALERT_TERM_NODES, ALERT_TERM_ROOT};
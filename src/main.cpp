@@ -61,13 +61,20 @@
 #include "icons/icons_196x196.h"
 
 // Optional features
+#ifdef ASSET_PARTITION
+#include "assets.h"
+#endif
 #ifdef MQTT_OTA_UPGRADE
 #include "mqtt_ota_manager.h"
 #endif
 
 // Sensor management modules
 #include "dual_sensor_manager.h"
+#include "battery_monitor.h"
+#include "indoor_history.h"
+#include "refresh_scheduler.h"
 #include "sensor_power_manager.h"
+#include "tlog.h"
 
 // Global variables - too large to allocate locally on stack
 static owm_resp_onecall_t owm_onecall;
@@ -75,56 +82,54 @@ static owm_resp_air_pollution_t owm_air_pollution;
 
 Preferences prefs;
 
+// Indoor readings of the last days, kept in RTC memory across deep sleep.
+RTC_DATA_ATTR static indoor_history_t indoorHistory;
+// Battery trend and awake time of the refresh scheduler.
+RTC_DATA_ATTR static scheduler_state_t refreshScheduler;
+// How quickly the forecast changes, set once it is received.
+static float refreshVolatility = 0.0f;
+
 /* Put esp32 into ultra low-power deep sleep (<11μA).
- * Aligns wake time to the minute. Sleep times defined in config.cpp.
+ * Aligns wake time to the minute. Sleep times defined in config.cpp, see
+ * refresh_scheduler.h.
  */
 void beginDeepSleep(unsigned long startTime, tm *timeInfo) {
   if (!getLocalTime(timeInfo)) {
-    Serial.println(TXT_REFERENCING_OLDER_TIME_NOTICE);
-  }
-
-  // To simplify sleep time calculations, the current time stored by timeInfo
-  // will be converted to time relative to the WAKE_TIME. This way if a
-  // SLEEP_DURATION is not a multiple of 60 minutes it can be more trivially,
-  // aligned and it can easily be deterimined whether we must sleep for
-  // additional time due to bedtime.
-  // i.e. when curHour == 0, then timeInfo->tm_hour == WAKE_TIME
-  int bedtimeHour = INT_MAX;
-  if (BED_TIME != WAKE_TIME) {
-    bedtimeHour = (BED_TIME - WAKE_TIME + 24) % 24;
+    TLOG("%s", TXT_REFERENCING_OLDER_TIME_NOTICE);
   }
 
-  // time is relative to wake time
-  int curHour = (timeInfo->tm_hour - WAKE_TIME + 24) % 24;
-  const int curMinute = curHour * 60 + timeInfo->tm_min;
-  const int curSecond =
-      curHour * 3600 + timeInfo->tm_min * 60 + timeInfo->tm_sec;
-  const int desiredSleepSeconds = SLEEP_DURATION * 60;
-  const int offsetMinutes = curMinute % SLEEP_DURATION;
-  const int offsetSeconds = curSecond % desiredSleepSeconds;
-
-  // align wake time to nearest multiple of SLEEP_DURATION
-  int sleepMinutes = SLEEP_DURATION - offsetMinutes;
-  if (desiredSleepSeconds - offsetSeconds < 120 ||
-      offsetSeconds / (float)desiredSleepSeconds >
-          0.95f) { // if we have a sleep time less than 2 minutes OR less 5%
-    // SLEEP_DURATION,
-    // skip to next alignment
-    sleepMinutes += SLEEP_DURATION;
-  }
-
-  // estimated wake time, if this falls in a sleep period then sleepDuration
-  // must be adjusted
-  const int predictedWakeHour = ((curMinute + sleepMinutes) / 60) % 24;
+  // The scheduler aligns the wake time and skips the bed time, with
+  // ADAPTIVE_REFRESH it also picks the interval.
+  schedule_config_t cfg = {};
+  cfg.min_interval = std::min(MIN_SLEEP_DURATION, SLEEP_DURATION);
+  cfg.nominal_interval = SLEEP_DURATION;
+  cfg.max_interval = std::max(MAX_SLEEP_DURATION, SLEEP_DURATION);
+  cfg.bed_time = BED_TIME;
+  cfg.wake_time = WAKE_TIME;
+  cfg.capacity_mah = BATTERY_CAPACITY;
+  cfg.target_days = TARGET_BATTERY_LIFE;
+  cfg.adaptive = ADAPTIVE_REFRESH;
+
+  schedule_input_t in = {};
+  in.now = time(nullptr);
+  in.local = *timeInfo;
+  in.awake_ms = millis() - startTime;
+  in.volatility = refreshVolatility;
+#if BATTERY_MONITORING && !DEBUG_MODE_SKIP_HARDWARE
+  // readBatteryVoltage() returns the reading taken earlier in this wake
+  in.battery_known = true;
+  in.battery_permille = batteryPermille(readBatteryVoltage(),
+                                        MIN_BATTERY_VOLTAGE,
+                                        MAX_BATTERY_VOLTAGE);
+#endif
 
-  uint64_t sleepDuration;
-  if (predictedWakeHour < bedtimeHour) {
-    sleepDuration = sleepMinutes * 60 - timeInfo->tm_sec;
-  } else {
-    const int hoursUntilWake = 24 - curHour;
-    sleepDuration = hoursUntilWake * 3600ULL -
-                    (timeInfo->tm_min * 60ULL + timeInfo->tm_sec);
-  }
+  schedule_t next;
+  scheduleNextWake(refreshScheduler, cfg, in, next);
+  uint64_t sleepDuration = next.sleep_s;
+#if ADAPTIVE_REFRESH
+  TLOG("Refresh interval %d min (budget %d min, volatility %.2f)",
+       next.interval, next.budget_interval, refreshVolatility);
+#endif
 
   // add extra delay to compensate for esp32's with fast RTCs.
   sleepDuration += 3ULL;
@@ -138,7 +143,7 @@ void beginDeepSleep(unsigned long startTime, tm *timeInfo) {
   ESP.getFreeHeap();
 
   // Display memory usage before entering deep sleep
-  Serial.println("Preparing for deep sleep...");
+  TLOG("Preparing for deep sleep...");
 #if DEBUG_LEVEL >= 1
   printHeapUsage();
 #endif
@@ -147,11 +152,10 @@ void beginDeepSleep(unsigned long startTime, tm *timeInfo) {
   sensorPowerManager.prepareForDeepSleep();
 
   esp_sleep_enable_timer_wakeup(sleepDuration * 1000000ULL);
-  Serial.print(TXT_AWAKE_FOR);
-  Serial.println(" " + String((millis() - startTime) / 1000.0, 3) + "s");
-  Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-  Serial.println(" " + String(sleepDuration) + "s");
+  TLOG("%s %.3fs", TXT_AWAKE_FOR, (millis() - startTime) / 1000.0);
+  TLOG("%s %llus", TXT_ENTERING_DEEP_SLEEP_FOR, sleepDuration);
 
+#if !TOKENIZED_LOG
   // Add delay to allow time to view serial output
   Serial.println("Waiting 10 seconds for serial output...");
   for (int i = 10; i > 0; i--) {
@@ -161,7 +165,9 @@ void beginDeepSleep(unsigned long startTime, tm *timeInfo) {
     delay(1000);
   }
   Serial.println("Entering deep sleep mode now");
+#endif
 
+  tlogFlush();
   esp_deep_sleep_start();
 }
 
@@ -170,18 +176,17 @@ void beginDeepSleep(unsigned long startTime, tm *timeInfo) {
 void setup() {
   unsigned long startTime = millis();
   Serial.begin(115200);
+  tlogBegin();
 
+#if !TOKENIZED_LOG
   // Wait for serial connection
   delay(2000);
+#endif
 
   // Initialize sensor power management system
   sensorPowerManager.wakeupFromDeepSleep();
 
-  Serial.println();
-  Serial.println("===========================================");
-  Serial.println("ESP32 Weather Display - BMP280+AHT20 Dual Sensor");
-  Serial.println("===========================================");
-  Serial.println();
+  TLOG("ESP32 Weather Display - BMP280+AHT20 Dual Sensor");
 
   // Initialize LED1 - turn on to indicate startup
   pinMode(PIN_LED1, OUTPUT);
@@ -193,13 +198,27 @@ void setup() {
 
   disableBuiltinLED();
 
+#ifdef ASSET_PARTITION
+  // fonts and icons are drawn from the asset partition
+  if (!mountAssets()) {
+    // the error icon is built in, the text needs the missing asset fonts
+    TLOG("%s", TXT_ASSET_IMAGE_INVALID);
+    initDisplay();
+    do {
+      drawError(error_icon_196x196, TXT_ASSET_IMAGE_INVALID);
+    } while (display.nextPage());
+    powerOffDisplay();
+    tm timeInfo = {};
+    beginDeepSleep(startTime, &timeInfo);
+  }
+#endif
+
   // Open namespace for read/write to non-volatile storage
   prefs.begin(NVS_NAMESPACE, false);
 
 #if BATTERY_MONITORING && !DEBUG_MODE_SKIP_HARDWARE
   uint32_t batteryVoltage = readBatteryVoltage();
-  Serial.print(TXT_BATTERY_VOLTAGE);
-  Serial.println(": " + String(batteryVoltage) + "mv");
+  TLOG("%s: %umv", TXT_BATTERY_VOLTAGE, batteryVoltage);
 
   // When the battery is low, the display should be updated to reflect that, but
   // only the first time we detect low voltage. The next time the display will
@@ -222,21 +241,22 @@ void setup() {
     if (batteryVoltage <= CRIT_LOW_BATTERY_VOLTAGE) { // critically low battery
       // don't set esp_sleep_enable_timer_wakeup();
       // We won't wake up again until someone manually presses the RST button.
-      Serial.println(TXT_CRIT_LOW_BATTERY_VOLTAGE);
-      Serial.println(TXT_HIBERNATING_INDEFINITELY_NOTICE);
+      TLOG("%s", TXT_CRIT_LOW_BATTERY_VOLTAGE);
+      TLOG("%s", TXT_HIBERNATING_INDEFINITELY_NOTICE);
     } else if (batteryVoltage <= VERY_LOW_BATTERY_VOLTAGE) { // very low battery
       esp_sleep_enable_timer_wakeup(VERY_LOW_BATTERY_SLEEP_INTERVAL * 60ULL *
                                     1000000ULL);
-      Serial.println(TXT_VERY_LOW_BATTERY_VOLTAGE);
-      Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-      Serial.println(" " + String(VERY_LOW_BATTERY_SLEEP_INTERVAL) + "min");
+      TLOG("%s", TXT_VERY_LOW_BATTERY_VOLTAGE);
+      TLOG("%s %lumin", TXT_ENTERING_DEEP_SLEEP_FOR,
+           VERY_LOW_BATTERY_SLEEP_INTERVAL);
     } else { // low battery
       esp_sleep_enable_timer_wakeup(LOW_BATTERY_SLEEP_INTERVAL * 60ULL *
                                     1000000ULL);
-      Serial.println(TXT_LOW_BATTERY_VOLTAGE);
-      Serial.print(TXT_ENTERING_DEEP_SLEEP_FOR);
-      Serial.println(" " + String(LOW_BATTERY_SLEEP_INTERVAL) + "min");
+      TLOG("%s", TXT_LOW_BATTERY_VOLTAGE);
+      TLOG("%s %lumin", TXT_ENTERING_DEEP_SLEEP_FOR,
+           LOW_BATTERY_SLEEP_INTERVAL);
     }
+    tlogFlush();
     esp_deep_sleep_start();
   }
   // battery is no longer low, reset variable in non-volatile storage
@@ -246,7 +266,7 @@ void setup() {
 #elif DEBUG_MODE_SKIP_HARDWARE
   // DEBUG MODE: Skip battery monitoring
   uint32_t batteryVoltage = 4200;
-  Serial.println("DEBUG MODE: Skipping battery monitoring - simulating 4200mv");
+  TLOG("DEBUG MODE: Skipping battery monitoring - simulating 4200mv");
 #else
   uint32_t batteryVoltage = UINT32_MAX;
 #endif
@@ -254,6 +274,19 @@ void setup() {
   // All data should have been loaded from NVS. Close filesystem.
   prefs.end();
 
+#if !DEBUG_MODE_SKIP_HARDWARE
+  // START INDOOR SENSOR MEASUREMENT
+  // Sensors need to be reinitialized after deep sleep wakeup since power was
+  // cut. The conversions run while WiFi connects and the APIs are queried, the
+  // results are collected after. The acquisition profile trades accuracy for
+  // awake time depending on the battery.
+  dualSensorManager.selectProfile(batteryVoltage);
+  bool sensorInitSuccess = dualSensorManager.initialize();
+  if (sensorInitSuccess) {
+    dualSensorManager.startMeasurement();
+  }
+#endif
+
   String statusStr = {};
   String tmpStr = {};
   tm timeInfo = {};
@@ -265,12 +298,12 @@ void setup() {
     killWiFi();
     initDisplay();
     if (wifiStatus == WL_NO_SSID_AVAIL) {
-      Serial.println(TXT_NETWORK_NOT_AVAILABLE);
+      TLOG("%s", TXT_NETWORK_NOT_AVAILABLE);
       do {
         drawError(wifi_x_196x196, TXT_NETWORK_NOT_AVAILABLE);
       } while (display.nextPage());
     } else {
-      Serial.println(TXT_WIFI_CONNECTION_FAILED);
+      TLOG("%s", TXT_WIFI_CONNECTION_FAILED);
       do {
         drawError(wifi_x_196x196, TXT_WIFI_CONNECTION_FAILED);
       } while (display.nextPage());
@@ -283,7 +316,7 @@ void setup() {
   configTzTime(TIMEZONE, NTP_SERVER_1, NTP_SERVER_2);
   bool timeConfigured = waitForSNTPSync(&timeInfo);
   if (!timeConfigured) {
-    Serial.println(TXT_TIME_SYNCHRONIZATION_FAILED);
+    TLOG("%s", TXT_TIME_SYNCHRONIZATION_FAILED);
     killWiFi();
     initDisplay();
     do {
@@ -295,7 +328,7 @@ void setup() {
 
 #ifdef MQTT_OTA_UPGRADE
   // MQTT OTA UPGRADE CHECK
-  Serial.println("Checking for MQTT OTA upgrades...");
+  TLOG("Checking for MQTT OTA upgrades...");
 
   // 配置MQTT OTA
   mqttOTAConfig.mqttServer = MQTT_OTA_SERVER;
@@ -323,16 +356,21 @@ void setup() {
     if (upgradeTriggered) {
       // 如果升级被触发，设备会在升级完成后重启
       // 这里的代码不会被执行到
-      Serial.println("OTA upgrade triggered, device will restart...");
+      TLOG("OTA upgrade triggered, device will restart...");
     } else {
-      Serial.println("No OTA upgrade available, continuing normal operation");
+      TLOG("No OTA upgrade available, continuing normal operation");
     }
   } else {
-    Serial.println(
-        "Failed to initialize MQTT OTA manager, continuing normal operation");
+    TLOG("Failed to initialize MQTT OTA manager, continuing normal operation");
   }
 #endif
 
+#if !DEBUG_MODE_SKIP_HARDWARE
+  // Multi-sample acquisition profiles trigger their next conversion here,
+  // between the network steps, rather than while waiting at the end.
+  dualSensorManager.poll();
+#endif
+
   // MAKE API REQUESTS
 #ifdef USE_HTTP
   WiFiClient client;
@@ -345,23 +383,23 @@ void setup() {
 #endif
 
   // First try the current weather API (2.5/weather) - your preferred API
-  Serial.println("Trying Current Weather API (2.5/weather) first...");
+  TLOG("Trying Current Weather API (2.5/weather) first...");
   int currentWeatherStatus = getOWMcurrentWeather(client, owm_onecall.current);
 
   // Then try Forecast API for forecast data
-  Serial.println("Trying Forecast API (2.5/forecast)...");
+  TLOG("Trying Forecast API (2.5/forecast)...");
   int rxStatus = getOWMonecall(client, owm_onecall);
 
   // If current weather API failed but One Call succeeded, use One Call data
   if (currentWeatherStatus != HTTP_CODE_OK && rxStatus == HTTP_CODE_OK) {
-    Serial.println("Current Weather API failed, but One Call API succeeded. "
-                   "Using One Call data.");
+    TLOG("Current Weather API failed, but One Call API succeeded. "
+         "Using One Call data.");
   }
   // If current weather API succeeded but One Call failed, we still have current
   // weather
   else if (currentWeatherStatus == HTTP_CODE_OK && rxStatus != HTTP_CODE_OK) {
-    Serial.println("Current Weather API succeeded, but One Call API failed. "
-                   "Limited forecast data available.");
+    TLOG("Current Weather API succeeded, but One Call API failed. "
+         "Limited forecast data available.");
     // Clear forecast arrays to prevent displaying stale data
     for (int i = 0; i < OWM_NUM_HOURLY; i++) {
       owm_onecall.hourly[i] = {};
@@ -383,9 +421,38 @@ void setup() {
     powerOffDisplay();
     beginDeepSleep(startTime, &timeInfo);
   } else {
-    Serial.println("Both APIs succeeded! Using current weather data from "
-                   "2.5/weather API.");
+    TLOG("Both APIs succeeded! Using current weather data from "
+         "2.5/weather API.");
   }
+#if DISPLAY_ALERTS
+  // Alerts are optional, without them the display is drawn as usual. Must
+  // come after getOWMonecall, which resets owm_onecall.
+  getOWMalerts(client, owm_onecall.alerts);
+#endif
+
+  // FORECAST VOLATILITY
+  // The forecast of the next 6 hours and the alerts decide how soon the
+  // display is updated again.
+  {
+    float pop[OWM_NUM_HOURLY];
+    float temp[OWM_NUM_HOURLY];
+    const int64_t horizon = time(nullptr) + 6 * 3600;
+    int n = 0;
+    while (n < OWM_NUM_HOURLY && owm_onecall.hourly[n].dt != 0
+           && owm_onecall.hourly[n].dt <= horizon) {
+      pop[n] = owm_onecall.hourly[n].pop;
+      temp[n] = owm_onecall.hourly[n].temp;
+      ++n;
+    }
+    const float step = n > 1 ? (owm_onecall.hourly[1].dt
+                                - owm_onecall.hourly[0].dt) / 3600.0f
+                             : 0.0f;
+    refreshVolatility = forecastVolatility(pop, temp, n, step,
+                                           owm_onecall.alerts.count);
+  }
+#if !DEBUG_MODE_SKIP_HARDWARE
+  dualSensorManager.poll();
+#endif
   rxStatus = getOWMairpollution(client, owm_air_pollution);
 
   if (rxStatus != HTTP_CODE_OK) {
@@ -408,86 +475,65 @@ void setup() {
 
 #if DEBUG_MODE_SKIP_HARDWARE
   // DEBUG MODE: Skip sensor initialization
-  Serial.println("DEBUG MODE: Skipping sensors - simulating sensor data");
+  TLOG("DEBUG MODE: Skipping sensors - simulating sensor data");
   inTemp = 22.5;
   inHumidity = 45.0;
   inPressure = 101325.0;
 #else
-  // Use dual sensor management system
-  // Note: Sensors need to be reinitialized after deep sleep wakeup since power
-  // was cut
-  bool sensorInitSuccess = dualSensorManager.initialize();
+  // Collect the measurement started before WiFi, failed reads have been
+  // retried by the sensor state machine.
   bool dataReadSuccess = false;
 
   if (sensorInitSuccess) {
-    // Try to read sensor data with up to 3 retries
-    int retryCount = 0;
-    const int maxRetries = 3;
-
-    while (retryCount < maxRetries && !dataReadSuccess) {
-      if (retryCount > 0) {
-        Serial.printf("Retrying sensor data read (attempt %d)...\n",
-                      retryCount + 1);
-        delay(500); // Wait 500ms before retry
+    SensorData sensorData = dualSensorManager.await();
+
+    // Check if at least one valid data point exists
+    dataReadSuccess = sensorData.temperatureValid ||
+                      sensorData.humidityValid || sensorData.pressureValid;
+
+    if (dataReadSuccess) {
+      // Map to original variables
+      if (sensorData.temperatureValid) {
+        inTemp = sensorData.temperature;
+        TLOG("Temperature: %.2f°C", inTemp);
+      } else {
+        TLOG("Temperature data invalid, will display as '--'");
       }
 
-      SensorData sensorData = dualSensorManager.readAllSensors();
-
-      // Check if at least one valid data point exists
-      bool hasValidData = sensorData.temperatureValid ||
-                          sensorData.humidityValid || sensorData.pressureValid;
-
-      if (hasValidData) {
-        dataReadSuccess = true;
-
-        // Map to original variables
-        if (sensorData.temperatureValid) {
-          inTemp = sensorData.temperature;
-          Serial.printf("Temperature: %.2f°C\n", inTemp);
-        } else {
-          Serial.println("Temperature data invalid, will display as '--'");
-        }
-
-        if (sensorData.humidityValid) {
-          inHumidity = sensorData.humidity;
-          Serial.printf("Humidity: %.2f%%\n", inHumidity);
-        } else {
-          Serial.println("Humidity data invalid, will display as '--'");
-        }
-
-        if (sensorData.pressureValid) {
-          inPressure = sensorData.pressure;
-          Serial.printf("Pressure: %.2f hPa\n", inPressure / 100.0);
-        } else {
-          Serial.println("Pressure data invalid");
-        }
-
-        Serial.println("Dual sensor data read completed");
-
-        // Clear any previous error status
-        if (!statusStr.isEmpty() && statusStr.indexOf("传感器") >= 0) {
-          statusStr = "";
-        }
+      if (sensorData.humidityValid) {
+        inHumidity = sensorData.humidity;
+        TLOG("Humidity: %.2f%%", inHumidity);
       } else {
-        retryCount++;
-        Serial.printf("Data read attempt %d failed, all sensor data invalid\n",
-                      retryCount);
+        TLOG("Humidity data invalid, will display as '--'");
+      }
+
+      if (sensorData.pressureValid) {
+        inPressure = sensorData.pressure;
+        TLOG("Pressure: %.2f hPa", inPressure / 100.0);
+      } else {
+        TLOG("Pressure data invalid");
+      }
+
+      TLOG("Dual sensor data read completed");
+
+      // Clear any previous error status
+      if (!statusStr.isEmpty() && statusStr.indexOf("传感器") >= 0) {
+        statusStr = "";
       }
     }
 
     if (!dataReadSuccess) {
       statusStr = "Sensor data read failed";
-      Serial.println("Unable to read valid sensor data after multiple retries");
+      TLOG("Unable to read valid sensor data after multiple retries");
     }
   } else {
     statusStr = "Sensor initialization failed";
-    Serial.println("Dual sensor system initialization failed");
+    TLOG("Dual sensor system initialization failed");
   }
 
   // If dual sensor system completely fails, log the failure
   if (!sensorInitSuccess || !dataReadSuccess) {
-    Serial.println(
-        "Dual sensor system failed, sensor data will show as invalid");
+    TLOG("Dual sensor system failed, sensor data will show as invalid");
   }
 
   // Final data validation and status report
@@ -495,36 +541,77 @@ void setup() {
   bool hasHumidityData = !std::isnan(inHumidity);
   bool hasPressureData = !std::isnan(inPressure);
 
-  Serial.println("Final sensor data status:");
-  Serial.printf("  Temperature: %s\n", hasTempData ? "Valid" : "Invalid");
-  Serial.printf("  Humidity: %s\n", hasHumidityData ? "Valid" : "Invalid");
-  Serial.printf("  Pressure: %s\n", hasPressureData ? "Valid" : "Invalid");
+  TLOG("Final sensor data status: temperature %s, humidity %s, pressure %s",
+       hasTempData ? "valid" : "invalid", hasHumidityData ? "valid" : "invalid",
+       hasPressureData ? "valid" : "invalid");
 
   if (!hasTempData && !hasHumidityData && !hasPressureData) {
-    Serial.println("Warning: All sensor data invalid, display will show '--' "
-                   "placeholders");
+    TLOG("Warning: All sensor data invalid, display will show '--' "
+         "placeholders");
   }
 #endif
 
+  // RECORD INDOOR HISTORY
+  // one slot per step of the grid beginDeepSleep() aligns wakes to
+  const int historyPeriod = ADAPTIVE_REFRESH
+                            ? std::min(MIN_SLEEP_DURATION, SLEEP_DURATION)
+                            : SLEEP_DURATION;
+  appendIndoorSample(indoorHistory, historyPeriod, time(nullptr), inTemp,
+                     inHumidity, inPressure);
+
   String refreshTimeStr;
   getRefreshTimeStr(refreshTimeStr, timeConfigured, &timeInfo);
   String dateStr;
   getDateStr(dateStr, &timeInfo);
 
-  // RENDER FULL REFRESH
-  initDisplay();
-  do {
-    drawCurrentConditions(owm_onecall.current, owm_onecall.daily[0],
-                          owm_air_pollution, inTemp, inHumidity);
-    drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily, timeInfo);
-    drawForecast(owm_onecall.daily, timeInfo);
-    drawLocationDate(CITY_STRING, dateStr);
+  // HASH FRAME
+  // Everything but the last refresh time is hashed, so that a frame whose
+  // content did not change can skip the (multi-second) panel refresh.
+#if SKIP_UNCHANGED_REFRESH
+  unsigned long hashStart = micros();
+  beginFrameHash();
+  drawCurrentConditions(owm_onecall.current, owm_onecall.daily[0],
+                        owm_air_pollution, inTemp, inHumidity);
+  drawIndoorTrend(indoorHistory);
+  drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily, timeInfo);
+  drawForecast(owm_onecall.daily, timeInfo);
+  drawLocationDate(CITY_STRING, dateStr);
+#if DISPLAY_ALERTS
+  drawAlerts(owm_onecall.alerts, CITY_STRING, dateStr);
+#endif
+  drawStatusBar(statusStr, "", wifiRSSI, batteryVoltage);
+  uint32_t frameHash = endFrameHash();
+  refresh_mode_t refreshMode = getRefreshMode(frameHash);
+  TLOG("Frame hash %08x (%lu us), %s", frameHash, micros() - hashStart,
+       refreshMode == REFRESH_NONE ? "unchanged, skipping refresh"
+                                   : "changed, full refresh");
+#else
+  refresh_mode_t refreshMode = REFRESH_FULL;
+#endif
+
+  if (refreshMode != REFRESH_NONE) {
+    initDisplay();
+    do {
+      RENDER_PROFILE(drawCurrentConditions(owm_onecall.current,
+                                           owm_onecall.daily[0],
+                                           owm_air_pollution, inTemp,
+                                           inHumidity));
+      RENDER_PROFILE(drawIndoorTrend(indoorHistory));
+      RENDER_PROFILE(
+          drawOutlookGraph(owm_onecall.hourly, owm_onecall.daily, timeInfo));
+      RENDER_PROFILE(drawForecast(owm_onecall.daily, timeInfo));
+      RENDER_PROFILE(drawLocationDate(CITY_STRING, dateStr));
 #if DISPLAY_ALERTS
-    drawAlerts(owm_onecall.alerts, CITY_STRING, dateStr);
+      RENDER_PROFILE(drawAlerts(owm_onecall.alerts, CITY_STRING, dateStr));
 #endif
-    drawStatusBar(statusStr, refreshTimeStr, wifiRSSI, batteryVoltage);
-  } while (display.nextPage());
-  powerOffDisplay();
+      RENDER_PROFILE(
+          drawStatusBar(statusStr, refreshTimeStr, wifiRSSI, batteryVoltage));
+    } while (display.nextPage());
+    powerOffDisplay();
+#if SKIP_UNCHANGED_REFRESH
+    setPanelFrameHash(frameHash);
+#endif
+  }
 
   // Turn off LED
   digitalWrite(PIN_LED1, HIGH);
@@ -0,0 +1,316 @@
+/* Raster primitives for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "raster.h"
+
+const uint8_t PATTERN_SOLID[8] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+const uint8_t PATTERN_HATCH_EVEN_ROWS[8] = {
+  0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00};
+const uint8_t PATTERN_HATCH_ODD_ROWS[8] = {
+  0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa};
+
+// Masks selecting the pixels of a byte at or right of bit position (x & 7),
+// and at or left of bit position (x & 7).
+static const uint8_t LEFT_EDGE_MASK[8] = {
+  0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01};
+static const uint8_t RIGHT_EDGE_MASK[8] = {
+  0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff};
+
+/* Draws a line with a pen that extends width - 1 pixels downwards and
+ * width - 1 pixels to the left of the ideal line.
+ *
+ * The line is stepped with the same Bresenham walk as Adafruit_GFX::writeLine,
+ * so the result is pixel-identical to drawing the line once plus (width - 1)
+ * copies shifted by +y and (width - 1) copies shifted by -x, but the walk is
+ * only performed once.
+ */
+void drawThickLine(Adafruit_GFX &gfx, int16_t x0, int16_t y0,
+                   int16_t x1, int16_t y1, uint8_t width, uint16_t color)
+{
+  if (width == 0)
+  {
+    return;
+  }
+
+  const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+  if (steep)
+  {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+
+  const int16_t dx = x1 - x0;
+  const int16_t dy = std::abs(y1 - y0);
+  const int16_t ystep = y0 < y1 ? 1 : -1;
+  int16_t err = dx / 2;
+
+  for (; x0 <= x1; ++x0)
+  {
+    const int16_t px = steep ? y0 : x0;
+    const int16_t py = steep ? x0 : y0;
+    for (int16_t k = 0; k < width; ++k)
+    {
+      gfx.drawPixel(px, py + k, color);
+    }
+    for (int16_t k = 1; k < width; ++k)
+    {
+      gfx.drawPixel(px - k, py, color);
+    }
+
+    err -= dy;
+    if (err < 0)
+    {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+  return;
+} // end drawThickLine
+
+/* Draws a horizontal dotted line from x0 to x1 (inclusive), placing a single
+ * pixel every stride pixels starting at x0.
+ */
+void drawDottedHLine(Adafruit_GFX &gfx, int16_t x0, int16_t x1, int16_t y,
+                     uint8_t stride, uint16_t color)
+{
+  if (stride == 0 || y < 0 || y >= gfx.height())
+  {
+    return;
+  }
+  // skip the dots left of the screen without changing their phase
+  if (x0 < 0)
+  {
+    x0 += ((-x0 + stride - 1) / stride) * stride;
+  }
+  x1 = std::min<int16_t>(x1, gfx.width() - 1);
+
+  for (int16_t x = x0; x <= x1; x += stride)
+  {
+    gfx.drawPixel(x, y, color);
+  }
+  return;
+} // end drawDottedHLine
+
+/* Fills a rectangle with an 8x8 ordered pattern. Pixels whose pattern bit is
+ * clear are left untouched.
+ *
+ * If the surface provides spans (see PatternSpanSurface) each row is written
+ * a byte at a time. Otherwise rows with an empty pattern byte are skipped
+ * entirely and rows with a full pattern byte are drawn as a single horizontal
+ * line, so sparse hatching costs only as much as the pixels it actually sets.
+ */
+void fillPatternRect(Adafruit_GFX &gfx, int16_t x, int16_t y,
+                     int16_t w, int16_t h, const uint8_t pattern[8],
+                     uint16_t color, PatternSpanSurface *spans)
+{
+  // clip to the drawing surface
+  int16_t xEnd = std::min<int16_t>(x + w, gfx.width());
+  int16_t yEnd = std::min<int16_t>(y + h, gfx.height());
+  x = std::max<int16_t>(x, 0);
+  y = std::max<int16_t>(y, 0);
+  if (x >= xEnd || y >= yEnd)
+  {
+    return;
+  }
+
+  for (int16_t row = y; row < yEnd; ++row)
+  {
+    const uint8_t bits = pattern[row & 7];
+    if (bits == 0x00)
+    {
+      continue;
+    }
+    if (spans != nullptr
+     && spans->fillPatternSpan(x, row, xEnd - x, bits, color))
+    {
+      continue;
+    }
+    if (bits == 0xff)
+    {
+      gfx.drawFastHLine(x, row, xEnd - x, color);
+      continue;
+    }
+    for (int16_t col = x; col < xEnd; ++col)
+    {
+      if (bits & (0x80 >> (col & 7)))
+      {
+        gfx.drawPixel(col, row, color);
+      }
+    }
+  }
+  return;
+} // end fillPatternRect
+
+/* Sets (or clears if set is false) the pixels in [x, xEnd) of a row of a
+ * 1 bit per pixel buffer whose bit in the pattern row bits is set, a byte at a
+ * time. The most significant bit of a byte is the leftmost pixel, the edge
+ * bytes are masked with the precomputed edge masks. x and xEnd must already be
+ * clipped to the row.
+ */
+void fillPatternSpan1bpp(uint8_t *row, int16_t x, int16_t xEnd, uint8_t bits,
+                         bool set)
+{
+  if (x >= xEnd || bits == 0x00)
+  {
+    return;
+  }
+  const int firstByte = x / 8;
+  const int lastByte = (xEnd - 1) / 8;
+  const uint8_t leftMask = bits & LEFT_EDGE_MASK[x & 7];
+  const uint8_t rightMask = bits & RIGHT_EDGE_MASK[(xEnd - 1) & 7];
+  uint8_t *p = row + firstByte;
+
+  if (firstByte == lastByte)
+  {
+    const uint8_t mask = leftMask & rightMask;
+    *p = set ? (*p | mask) : (*p & ~mask);
+    return;
+  }
+  *p = set ? (*p | leftMask) : (*p & ~leftMask);
+  ++p;
+  if (bits == 0xff)
+  {
+    memset(p, set ? 0xff : 0x00, lastByte - firstByte - 1);
+    p += lastByte - firstByte - 1;
+  }
+  else
+  {
+    for (int b = firstByte + 1; b < lastByte; ++b, ++p)
+    {
+      *p = set ? (*p | bits) : (*p & ~bits);
+    }
+  }
+  *p = set ? (*p | rightMask) : (*p & ~rightMask);
+  return;
+} // end fillPatternSpan1bpp
+
+/* Fills a rectangle of a 1 bit per pixel buffer with an 8x8 ordered pattern.
+ *
+ * The buffer is row-major with rows padded to whole bytes and the most
+ * significant bit being the leftmost pixel (the layout used by GFXcanvas1 and
+ * the GxEPD2 page buffers). Each row is written with fillPatternSpan1bpp. If
+ * set is true pattern pixels are set to 1, otherwise they are cleared to 0.
+ */
+void fillPatternRect1bpp(uint8_t *buf, int16_t bufWidth, int16_t bufHeight,
+                         int16_t x, int16_t y, int16_t w, int16_t h,
+                         const uint8_t pattern[8], bool set)
+{
+  int16_t xEnd = std::min<int16_t>(x + w, bufWidth);
+  int16_t yEnd = std::min<int16_t>(y + h, bufHeight);
+  x = std::max<int16_t>(x, 0);
+  y = std::max<int16_t>(y, 0);
+  if (x >= xEnd || y >= yEnd)
+  {
+    return;
+  }
+
+  const int stride = (bufWidth + 7) / 8;
+  for (int16_t row = y; row < yEnd; ++row)
+  {
+    fillPatternSpan1bpp(buf + row * stride, x, xEnd, pattern[row & 7], set);
+  }
+  return;
+} // end fillPatternRect1bpp
+
+// sin(0..90 degrees), Q14
+static const int16_t SIN_Q14[91] = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384};
+
+/* Returns sin(deg) in Q14 for any integer number of degrees.
+ */
+static int32_t sinDegQ14(int deg)
+{
+  deg %= 360;
+  if (deg < 0)
+  {
+    deg += 360;
+  }
+  if (deg <= 90)  {return  SIN_Q14[deg];}
+  if (deg <= 180) {return  SIN_Q14[180 - deg];}
+  if (deg <= 270) {return -SIN_Q14[deg - 180];}
+  return -SIN_Q14[360 - deg];
+} // end sinDegQ14
+
+/* Renders a square inverted 1 bit per pixel bitmap (0 is ink, the format used
+ * by drawInvertedBitmap) rotated clockwise by deg degrees about its center.
+ *
+ * The source is a master glyph drawn at twice the output size. Each output
+ * pixel is sampled at 2x2 points, which land on distinct source pixels, and is
+ * inked if at least 2 of the 4 samples are ink. Only integer arithmetic is
+ * used: the sample offsets from the center are kept in half source pixels and
+ * rotated with Q14 sine/cosine.
+ */
+void rotateBitmap1bpp(const uint8_t *src, uint8_t *dst, int16_t dstSize,
+                      int deg)
+{
+  const int16_t srcSize = 2 * dstSize;
+  const int srcStride = (srcSize + 7) / 8;
+  const int dstStride = (dstSize + 7) / 8;
+  const int32_t s = sinDegQ14(deg);
+  const int32_t c = sinDegQ14(deg + 90);
+
+  memset(dst, 0xff, dstStride * dstSize);
+  for (int16_t y = 0; y < dstSize; ++y)
+  {
+    for (int16_t x = 0; x < dstSize; ++x)
+    {
+      int ink = 0;
+      for (int sub = 0; sub < 4; ++sub)
+      {
+        // center of the sample, in half source pixels from the middle
+        const int32_t u = 4 * x + 2 * (sub & 1) + 1 - srcSize;
+        const int32_t v = 4 * y + 2 * (sub >> 1) + 1 - srcSize;
+        // inverse rotation, back to source pixels (>> 15 = Q14 and halves)
+        const int32_t sx = ((c * u + s * v) >> 15) + srcSize / 2;
+        const int32_t sy = ((c * v - s * u) >> 15) + srcSize / 2;
+        if (sx < 0 || sx >= srcSize || sy < 0 || sy >= srcSize)
+        {
+          continue;
+        }
+        const uint8_t bits = pgm_read_byte(&src[sy * srcStride + sx / 8]);
+        if (!(bits & (0x80 >> (sx & 7))))
+        {
+          ++ink;
+        }
+      }
+      if (ink >= 2)
+      {
+        dst[y * dstStride + x / 8] &= ~(0x80 >> (x & 7));
+      }
+    }
+  }
+  return;
+} // end rotateBitmap1bpp
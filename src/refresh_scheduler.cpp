@@ -0,0 +1,239 @@
+/* Refresh scheduler for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like indoor_history.cpp this file has no Arduino or ESP-IDF dependencies,
+// tools/refresh_sim.cpp replays recorded weather through it on the host.
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "refresh_scheduler.h"
+
+// A window of the battery trend ends once the model expects at least this much
+// drain, so that the ADC noise (about 1 %) is small against it.
+static const uint32_t TREND_MIN_PERMILLE = 30;
+// A rise of the battery by more than this over a window means it is charging.
+static const int32_t CHARGING_PERMILLE = 10;
+
+/* Returns how quickly the weather changes over the next hours, 0 (calm) to 1.
+ * pop is the probability of precipitation (0-1) and temp the temperature
+ * (kelvin or celsius) of n forecast entries, spaced step hours apart. Active
+ * alerts count as volatile.
+ */
+float forecastVolatility(const float *pop, const float *temp, int n,
+                         float step, int alerts)
+{
+  if (alerts > 0)
+  {
+    return 1.0f;
+  }
+  if (n <= 1 || step <= 0)
+  {
+    return 0.0f;
+  }
+
+  float popChange = 0.0f;
+  float tempRate = 0.0f;
+  for (int i = 1; i < n; ++i)
+  {
+    popChange = std::max(popChange, std::fabs(pop[i] - pop[i - 1]));
+    tempRate = std::max(tempRate, std::fabs(temp[i] - temp[i - 1]) / step);
+  }
+  // Precipitation starting or stopping makes the display wrong the soonest.
+  // The daily cycle changes the temperature by up to about 1.5 K/h, a front
+  // can exceed 4 K/h.
+  const float popScore = popChange * 2.0f;
+  const float tempScore = tempRate / 4.0f;
+  return std::min(1.0f, std::max(popScore, tempScore));
+} // end forecastVolatility
+
+/* Resets the trend window to start now.
+ */
+static void startTrendWindow(scheduler_state_t &s, const schedule_input_t &in)
+{
+  s.ref_time = static_cast<uint32_t>(in.now);
+  s.ref_charge_uah = 0;
+  s.ref_permille = in.battery_known ? in.battery_permille : 0;
+  return;
+} // end startTrendWindow
+
+/* Compares the drain of the battery since the start of the trend window with
+ * the charge the model expected and corrects the model.
+ */
+static void updateTrend(scheduler_state_t &s, const schedule_config_t &cfg,
+                        const schedule_input_t &in)
+{
+  const uint32_t now = static_cast<uint32_t>(in.now);
+  if (!in.battery_known || now < s.ref_time)
+  {
+    startTrendWindow(s, in);
+    return;
+  }
+
+  const uint32_t modelled = s.ref_charge_uah / cfg.capacity_mah;
+  const int32_t observed = static_cast<int32_t>(s.ref_permille)
+                           - static_cast<int32_t>(in.battery_permille);
+  if (observed < -CHARGING_PERMILLE)
+  {
+    s.charging = true;
+    startTrendWindow(s, in);
+    return;
+  }
+  if (now - s.ref_time < SCHED_TREND_WINDOW_S || modelled < TREND_MIN_PERMILLE)
+  {
+    return;
+  }
+
+  if (observed <= 0)
+  {
+    // The battery held its charge while the model expected a drain, so it is
+    // on external power (USB) and says nothing about the model.
+    startTrendWindow(s, in);
+    return;
+  }
+
+  s.charging = false;
+  // ref_charge_uah is the uncorrected model, so the ratio is the correction
+  int32_t measured = observed * SCHED_CALIBRATION_ONE
+                     / static_cast<int32_t>(modelled);
+  measured = std::min<int32_t>(std::max<int32_t>(measured,
+                                                 SCHED_CALIBRATION_MIN),
+                               SCHED_CALIBRATION_MAX);
+  // average with the previous windows against the noise of the ADC
+  s.calibration = static_cast<uint16_t>((s.calibration + measured + 1) / 2);
+  startTrendWindow(s, in);
+  return;
+} // end updateTrend
+
+/* Returns the shortest interval in minutes that keeps the wakes within the
+ * energy budget.
+ */
+static int budgetInterval(const scheduler_state_t &s,
+                          const schedule_config_t &cfg, int awakeHours)
+{
+  // µAh per day
+  const float budget = cfg.capacity_mah * 1000.0f / cfg.target_days;
+  const float sleep = SCHED_SLEEP_UA * 24.0f;
+  const float wake = s.awake_ms * static_cast<float>(SCHED_AWAKE_MA) / 3600.0f
+                     * s.calibration / SCHED_CALIBRATION_ONE;
+  if (budget <= sleep || wake <= 0)
+  {
+    return budget <= sleep ? cfg.max_interval : cfg.min_interval;
+  }
+  const float wakesPerDay = (budget - sleep) / wake;
+  return static_cast<int>(std::ceil(awakeHours * 60 / wakesPerDay));
+} // end budgetInterval
+
+/* Picks the interval until the next wake and returns the time to sleep, the
+ * wake is aligned to a multiple of the interval grid (counted from wake_time)
+ * and skips the bed time. The state is updated with the charge of this wake.
+ */
+void scheduleNextWake(scheduler_state_t &s, const schedule_config_t &cfg,
+                      const schedule_input_t &in, schedule_t &out)
+{
+  if (s.magic != REFRESH_SCHEDULER_MAGIC)
+  {
+    s.magic = REFRESH_SCHEDULER_MAGIC;
+    s.calibration = SCHED_CALIBRATION_ONE;
+    s.awake_ms = static_cast<uint16_t>(std::min<uint32_t>(in.awake_ms,
+                                                          UINT16_MAX));
+    s.charging = false;
+    startTrendWindow(s, in);
+  }
+  s.awake_ms = static_cast<uint16_t>(
+    (3u * s.awake_ms + std::min<uint32_t>(in.awake_ms, UINT16_MAX)) / 4);
+  s.ref_charge_uah += in.awake_ms * SCHED_AWAKE_MA / 3600;
+  updateTrend(s, cfg, in);
+
+  // To simplify sleep time calculations, the current time will be converted
+  // to time relative to the wake_time. This way if an interval is not a
+  // multiple of 60 minutes it can be more trivially aligned and it can easily
+  // be determined whether we must sleep for additional time due to bedtime.
+  // i.e. when curHour == 0, then local.tm_hour == wake_time
+  int bedtimeHour = INT_MAX;
+  int awakeHours = 24;
+  if (cfg.bed_time != cfg.wake_time)
+  {
+    bedtimeHour = (cfg.bed_time - cfg.wake_time + 24) % 24;
+    awakeHours = bedtimeHour;
+  }
+  const int curHour = (in.local.tm_hour - cfg.wake_time + 24) % 24;
+  const int curSecond = curHour * 3600 + in.local.tm_min * 60
+                        + in.local.tm_sec;
+
+  int interval = cfg.nominal_interval;
+  int grid = cfg.nominal_interval;
+  out.budget_interval = 0;
+  if (cfg.adaptive)
+  {
+    grid = std::max(1, cfg.min_interval);
+
+    // the weather: 1.5x nominal when calm down to the minimum
+    float v = std::min(1.0f, std::max(0.0f, in.volatility));
+    interval = static_cast<int>(std::lround(cfg.nominal_interval
+                                            * (1.5f - v)));
+    if (curHour < SCHED_MORNING_HOURS)
+    {
+      interval = std::min(interval, cfg.nominal_interval);
+    }
+
+    // the battery: never faster than the budget, slower when low
+    if (!s.charging)
+    {
+      int budget = budgetInterval(s, cfg, awakeHours);
+      if (in.battery_known
+       && in.battery_permille < SCHED_LOW_BATTERY_PERMILLE)
+      {
+        budget = budget * SCHED_LOW_BATTERY_PERMILLE
+                 / std::max<uint32_t>(in.battery_permille,
+                                      SCHED_LOW_BATTERY_PERMILLE / 4);
+      }
+      out.budget_interval = budget;
+      interval = std::max(interval, budget);
+    }
+    interval = std::min(std::max(interval, cfg.min_interval),
+                        cfg.max_interval);
+    interval = std::max(grid, (interval + grid / 2) / grid * grid);
+  }
+  out.interval = interval;
+
+  // Wake at the first grid point that is less than one grid step before the
+  // interval from now. Skip a grid point closer than 2 minutes or 5% of the
+  // grid step, which is where a wake from a fast RTC ends up.
+  const int gridSeconds = grid * 60;
+  const int margin = std::max(120, gridSeconds / 20);
+  const int earliest = curSecond + (interval - grid) * 60 + margin;
+  const int wakeSecond = (earliest + gridSeconds - 1) / gridSeconds
+                         * gridSeconds;
+
+  // estimated wake time, if this falls in a sleep period then the sleep must
+  // be extended to the wake_time
+  const int predictedWakeHour = (wakeSecond / 3600) % 24;
+  if (predictedWakeHour < bedtimeHour)
+  {
+    out.sleep_s = wakeSecond - curSecond;
+  }
+  else
+  {
+    out.sleep_s = 24 * 3600 - curSecond;
+  }
+
+  s.ref_charge_uah += static_cast<uint32_t>(
+    static_cast<uint64_t>(out.sleep_s) * SCHED_SLEEP_UA / 3600);
+  return;
+} // end scheduleNextWake
@@ -19,12 +19,22 @@
 #include "_strftime.h"
 #include "renderer.h"
 #include "api_response.h"
+#include "busy_wait.h"
 #include "config.h"
 #include "conversions.h"
 #include "display_utils.h"
+#include "raster.h"
+#include "tlog.h"
+#ifdef ICON_ATLAS
+#include "icon_atlas.h"
+#endif
 
 // fonts
+#ifdef ASSET_PARTITION
+#include "asset_fonts.h"
+#else
 #include FONT_HEADER
+#endif
 
 // icon header files
 #include "icons/icons_16x16.h"
@@ -37,50 +47,314 @@
 #include "icons/icons_160x160.h"
 #include "icons/icons_196x196.h"
 
+#if RENDER_CAPTURE
+#if defined(DISP_3C_B) || defined(DISP_7C_F)
+  FrameHashDisplay<CaptureDisplay> display(DISP_WIDTH, DISP_HEIGHT, true);
+#else
+  FrameHashDisplay<CaptureDisplay> display(DISP_WIDTH, DISP_HEIGHT, false);
+#endif
+#else
 #ifdef DISP_BW_V2
-  GxEPD2_BW<GxEPD2_750_T7,
-            GxEPD2_750_T7::HEIGHT> display(
+  FrameHashDisplay<
+    GxEPD2_BW<GxEPD2_750_T7,
+              GxEPD2_750_T7::HEIGHT>> display(
     GxEPD2_750_T7(PIN_EPD_CS,
                   PIN_EPD_DC,
                   PIN_EPD_RST,
                   PIN_EPD_BUSY));
 #endif
-#ifdef DISP_3C_B
-  GxEPD2_3C<GxEPD2_750c_Z08,
-            GxEPD2_750c_Z08::HEIGHT / 2> display(
+#if defined(DISP_3C_B) && PIPELINED_RENDERING
+  FrameHashDisplay<
+    PipelinedDisplay3C<GxEPD2_750c_Z08,
+                       GxEPD2_750c_Z08::HEIGHT / 2>> display(
+    GxEPD2_750c_Z08(PIN_EPD_CS,
+                    PIN_EPD_DC,
+                    PIN_EPD_RST,
+                    PIN_EPD_BUSY));
+#elif defined(DISP_3C_B)
+  FrameHashDisplay<
+    GxEPD2_3C<GxEPD2_750c_Z08,
+              GxEPD2_750c_Z08::HEIGHT / 2>> display(
     GxEPD2_750c_Z08(PIN_EPD_CS,
                     PIN_EPD_DC,
                     PIN_EPD_RST,
                     PIN_EPD_BUSY));
 #endif
 #ifdef DISP_7C_F
-  GxEPD2_7C<GxEPD2_730c_GDEY073D46,
-            GxEPD2_730c_GDEY073D46::HEIGHT / 4> display(
+  FrameHashDisplay<
+    GxEPD2_7C<GxEPD2_730c_GDEY073D46,
+              GxEPD2_730c_GDEY073D46::HEIGHT / 4>> display(
     GxEPD2_730c_GDEY073D46(PIN_EPD_CS,
                            PIN_EPD_DC,
                            PIN_EPD_RST,
                            PIN_EPD_BUSY));
 #endif
 #ifdef DISP_BW_V1
-  GxEPD2_BW<GxEPD2_750,
-            GxEPD2_750::HEIGHT> display(
+  FrameHashDisplay<
+    GxEPD2_BW<GxEPD2_750,
+              GxEPD2_750::HEIGHT>> display(
     GxEPD2_750(PIN_EPD_CS,
                PIN_EPD_DC,
                PIN_EPD_RST,
                PIN_EPD_BUSY));
 #endif
+#endif // end RENDER_CAPTURE
+
+#if BUSY_WAIT_LIGHT_SLEEP && !RENDER_CAPTURE
+// level of the BUSY pin while the panel is busy, all of the supported panels
+// (and their GxEPD2 drivers) hold it low
+static const int EPD_BUSY_LEVEL = LOW;
+#endif
 
 #ifndef ACCENT_COLOR
   #define ACCENT_COLOR GxEPD_BLACK
 #endif
 
+#ifdef FONT_SUBSET
+/* Returns the remap table of the current font, or nullptr if it is a font of
+ * the full family.
+ *
+ * Subset fonts (see fonts/subset_fonts.py) only store the glyphs that are
+ * used, under compact codes given by their remap table.
+ */
+static const uint8_t *currentRemap()
+{
+  static const GFXfont *font = nullptr;
+  static const uint8_t *remap = nullptr;
+  const GFXfont *current = display.getFont();
+  if (current != font)
+  {
+    font = current;
+    remap = nullptr;
+    for (const font_subset_t &subset : FONT_SUBSETS)
+    {
+      if (subset.font == current)
+      {
+        remap = subset.remap;
+        break;
+      }
+    }
+  }
+  return remap;
+} // end currentRemap
+
+/* Returns the glyph code of an ISO-8859-1 character in the current font.
+ * Characters that a subset font leaves out are replaced by '?', which every
+ * subset keeps.
+ */
+static uint8_t fontChar(uint8_t c, const uint8_t *remap)
+{
+  if (remap == nullptr || c < 0x20)
+  {
+    return c;
+  }
+  const uint8_t code = pgm_read_byte(&remap[c - 0x20]);
+  return code != 0 ? code : pgm_read_byte(&remap['?' - 0x20]);
+} // end fontChar
+
+/* Returns text translated to the glyph codes of the current font (see
+ * fontChar). Text drawn with a font of the full family is returned unchanged.
+ */
+static String fontText(const String &text)
+{
+  const uint8_t *remap = currentRemap();
+  if (remap == nullptr)
+  {
+    return text;
+  }
+
+  String out;
+  out.reserve(text.length());
+  for (unsigned int i = 0; i < text.length(); ++i)
+  {
+    out += static_cast<char>(fontChar(static_cast<uint8_t>(text[i]), remap));
+  }
+  return out;
+} // end fontText
+#else
+static inline const uint8_t *currentRemap()
+{
+  return nullptr;
+}
+
+static inline uint8_t fontChar(uint8_t c, const uint8_t *remap)
+{
+  return c;
+}
+
+static inline const String &fontText(const String &text)
+{
+  return text;
+}
+#endif
+
+#ifdef UNICODE_FONT
+/* Returns the Unicode font drawn alongside the current GFX font.
+ */
+static const unicode_font_t *currentUnicodeFont()
+{
+  static const GFXfont *font = nullptr;
+  static const unicode_font_t *ufont = nullptr;
+  const GFXfont *current = display.getFont();
+  if (current != font)
+  {
+    font = current;
+    ufont = current ? getUnicodeFont(current->yAdvance) : nullptr;
+  }
+  return ufont;
+} // end currentUnicodeFont
+
+/* Walks UTF-8 text from the cursor position (x, y) the way
+ * Adafruit_GFX::write() walks 8-bit text. Code points up to U+00FF are taken
+ * from the current GFX font, all others from the Unicode font.
+ * glyphFn(ufont, codepoint, x, y, glyph) is called for every glyph, ufont is
+ * nullptr for glyphs of the GFX font, which are passed by glyph code (see
+ * fontChar). Characters that neither font has are drawn as the '?' of the
+ * GFX font.
+ *
+ * Returns the cursor position after the text in x and y.
+ */
+template <typename GlyphFn>
+static void walkUnicodeText(const String &text, int16_t &x, int16_t &y,
+                            GlyphFn glyphFn)
+{
+  const GFXfont *font = display.getFont();
+  const unicode_font_t *ufont = currentUnicodeFont();
+  const uint8_t *remap = currentRemap();
+  if (font == nullptr)
+  {
+    return;
+  }
+  const char *p = text.c_str();
+  const char *end = p + text.length();
+  while (p < end)
+  {
+    const uint32_t cp = nextUtf8Char(p, end);
+    if (cp == '\n')
+    {
+      x = 0;
+      y += font->yAdvance;
+      continue;
+    }
+    GFXglyph g;
+    const asset_ufont_glyph_t *ug =
+      (cp > 0xff && ufont) ? getUnicodeGlyph(*ufont, cp) : nullptr;
+    if (ug != nullptr)
+    {
+      g.width    = ug->width;
+      g.height   = ug->height;
+      g.xAdvance = ug->x_advance;
+      g.xOffset  = ug->x_offset;
+      g.yOffset  = ug->y_offset;
+      glyphFn(ufont, cp, x, y, g);
+    }
+    else
+    {
+      const uint8_t c = fontChar(cp <= 0xff ? cp : '?', remap);
+      if (c < font->first || c > font->last)
+      {
+        continue;
+      }
+      memcpy_P(&g, &font->glyph[c - font->first], sizeof(g));
+      glyphFn(nullptr, c, x, y, g);
+    }
+    x += g.xAdvance;
+  }
+  return;
+} // end walkUnicodeText
+
+/* Adafruit_GFX::getTextBounds() for UTF-8 text.
+ */
+static void getUnicodeTextBounds(const String &text, int16_t x, int16_t y,
+                                 int16_t *x1, int16_t *y1,
+                                 uint16_t *w, uint16_t *h)
+{
+  int16_t minx = INT16_MAX, miny = INT16_MAX;
+  int16_t maxx = INT16_MIN, maxy = INT16_MIN;
+  int16_t cx = x;
+  int16_t cy = y;
+  walkUnicodeText(text, cx, cy,
+    [&](const unicode_font_t *, uint32_t, int16_t gx, int16_t gy,
+        const GFXglyph &g) {
+      minx = std::min<int16_t>(minx, gx + g.xOffset);
+      miny = std::min<int16_t>(miny, gy + g.yOffset);
+      maxx = std::max<int16_t>(maxx, gx + g.xOffset + g.width - 1);
+      maxy = std::max<int16_t>(maxy, gy + g.yOffset + g.height - 1);
+    });
+  if (maxx < minx)
+  {
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    return;
+  }
+  *x1 = minx;
+  *y1 = miny;
+  *w = maxx - minx + 1;
+  *h = maxy - miny + 1;
+  return;
+} // end getUnicodeTextBounds
+
+/* Draws UTF-8 text at the cursor and moves the cursor past it.
+ */
+static void drawUnicodeText(const String &text, uint16_t color)
+{
+  int16_t x = display.getCursorX();
+  int16_t y = display.getCursorY();
+  walkUnicodeText(text, x, y,
+    [&](const unicode_font_t *ufont, uint32_t cp, int16_t gx, int16_t gy,
+        const GFXglyph &g) {
+      if (g.width == 0 || g.height == 0)
+      {
+        return;
+      }
+      if (ufont == nullptr)
+      {
+        display.drawChar(gx, gy, static_cast<unsigned char>(cp), color, color,
+                         1, 1);
+      }
+      else if (display.isHashing())
+      {
+        display.hashGlyph(gx, gy, ufont, cp, color);
+      }
+      else
+      {
+        const uint8_t *bitmap = getUnicodeGlyphBitmap(*ufont, cp, nullptr);
+        if (bitmap != nullptr)
+        {
+          display.drawBitmap(gx + g.xOffset, gy + g.yOffset, bitmap,
+                             g.width, g.height, color);
+        }
+      }
+    });
+  display.setCursor(x, y);
+  return;
+} // end drawUnicodeText
+#endif // UNICODE_FONT
+
+/* Measures text in the current font like Adafruit_GFX::getTextBounds().
+ */
+static void getTextBounds(const String &text, int16_t x, int16_t y,
+                          int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+#ifdef UNICODE_FONT
+  if (isUtf8Text(text.c_str(), text.length()))
+  {
+    getUnicodeTextBounds(text, x, y, x1, y1, w, h);
+    return;
+  }
+#endif
+  display.getTextBounds(fontText(text), x, y, x1, y1, w, h);
+  return;
+} // end getTextBounds
+
 /* Returns the string width in pixels
  */
 uint16_t getStringWidth(const String &text)
 {
   int16_t x1, y1;
   uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
   return w;
 }
 
@@ -90,7 +364,7 @@ uint16_t getStringHeight(const String &text)
 {
   int16_t x1, y1;
   uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
   return h;
 }
 
@@ -102,7 +376,7 @@ void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
   int16_t x1, y1;
   uint16_t w, h;
   display.setTextColor(color);
-  display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
+  getTextBounds(text, x, y, &x1, &y1, &w, &h);
   if (alignment == RIGHT)
   {
     x = x - w;
@@ -112,13 +386,110 @@ void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
     x = x - w / 2;
   }
   display.setCursor(x, y);
-  display.print(text);
+#ifdef UNICODE_FONT
+  if (isUtf8Text(text.c_str(), text.length()))
+  {
+    drawUnicodeText(text, color);
+    return;
+  }
+#endif
+  display.print(fontText(text));
   return;
 } // end drawString
 
+/* Returns true if a line may be broken before the code point cp.
+ *
+ * Chinese, Japanese and Korean text is written without spaces, so a line may
+ * break before any character from the CJK Radicals block (U+2E80) up, except
+ * before punctuation that closes a phrase or a quote.
+ */
+static bool isCjkBreak(uint32_t cp)
+{
+  switch (cp)
+  {
+  case 0x3001: // 、
+  case 0x3002: // 。
+  case 0x300D: // 」
+  case 0x300F: // 』
+  case 0x3011: // 】
+  case 0xFF01: // ！
+  case 0xFF09: // ）
+  case 0xFF0C: // ，
+  case 0xFF0E: // ．
+  case 0xFF1A: // ：
+  case 0xFF1B: // ；
+  case 0xFF1F: // ？
+    return false;
+  default:
+    return cp >= 0x2E80;
+  }
+} // end isCjkBreak
+
+/* Finds the last place in the first 'before' bytes of text where a line can
+ * be broken. The line is then text[0, lineEnd) and the next line starts at
+ * nextStart. Returns false if there is no such place.
+ *
+ * Lines break at spaces (which are dropped), after dashes (if dashes is true)
+ * and before CJK characters. text is walked one UTF-8 character at a time, so
+ * a multibyte character is never split.
+ */
+static bool findLineBreak(const String &text, int before, bool dashes,
+                          int &lineEnd, int &nextStart)
+{
+  const char *s = text.c_str();
+  bool found = false;
+  int i = 0;
+  while (i < before)
+  {
+    const uint8_t c = s[i];
+    int len = 1;
+    uint32_t cp = c;
+    if ((c & 0xF0) == 0xE0 || (c & 0xF8) == 0xF0)
+    { // 3 or 4 byte sequence, the only ones that reach U+2E80
+      len = (c & 0xF0) == 0xE0 ? 3 : 4;
+      cp = c & (len == 3 ? 0x0F : 0x07);
+      for (int k = 1; k < len; ++k)
+      {
+        if ((static_cast<uint8_t>(s[i + k]) & 0xC0) != 0x80)
+        { // malformed, only reached through the NUL terminator
+          len = k;
+          cp = 0xFFFD;
+          break;
+        }
+        cp = (cp << 6) | (s[i + k] & 0x3F);
+      }
+    }
+    else if ((c & 0xE0) == 0xC0)
+    {
+      len = 2;
+    }
+
+    if (c == ' ')
+    {
+      lineEnd = i;
+      nextStart = i + 1;
+      found = true;
+    }
+    else if (c == '-' && dashes && i + 1 < before)
+    {
+      lineEnd = i + 1;
+      nextStart = i + 1;
+      found = true;
+    }
+    else if (i > 0 && s[i - 1] != ' ' && isCjkBreak(cp))
+    {
+      lineEnd = i;
+      nextStart = i;
+      found = true;
+    }
+    i += len;
+  }
+  return found;
+} // end findLineBreak
+
 /* Draws a string that will flow into the next line when max_width is reached.
  * If a string exceeds max_lines an ellipsis (...) will terminate the last word.
- * Lines will break at spaces(' ') and dashes('-').
+ * Lines will break at spaces(' '), dashes('-') and before CJK characters.
  *
  * Note: max_width should be big enough to accommodate the largest word that
  *       will be displayed. If an unbroken string of characters longer than
@@ -138,81 +509,43 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
     int16_t  x1, y1;
     uint16_t w, h;
 
-    display.getTextBounds(textRemaining, 0, 0, &x1, &y1, &w, &h);
+    getTextBounds(textRemaining, 0, 0, &x1, &y1, &w, &h);
 
-    int endIndex = textRemaining.length();
     // check if remaining text is to wide, if it is then print what we can
     String subStr = textRemaining;
-    int splitAt = 0;
-    int keepLastChar = 0;
-    while (w > max_width && splitAt != -1)
+    int lineEnd = textRemaining.length();
+    int nextStart = lineEnd;
+    const bool lastLine = current_line == max_lines - 1;
+    // find the last place in the string that we can break it, until the line
+    // fits. The last line does not break after dashes, so we can add ellipsis.
+    // If there is none then there is an unbroken set of characters that is
+    // longer than max_width.
+    while (w > max_width
+           && findLineBreak(textRemaining, lineEnd, !lastLine,
+                            lineEnd, nextStart))
     {
-      if (keepLastChar)
+      subStr = textRemaining.substring(0, lineEnd);
+      if (!lastLine)
       {
-        // if we kept the last character during the last iteration of this while
-        // loop, remove it now so we don't get stuck in an infinite loop.
-        subStr.remove(subStr.length() - 1);
-      }
-
-      // find the last place in the string that we can break it.
-      if (current_line < max_lines - 1)
-      {
-        splitAt = std::max(subStr.lastIndexOf(" "),
-                           subStr.lastIndexOf("-"));
+        getTextBounds(subStr, 0, 0, &x1, &y1, &w, &h);
       }
       else
       {
-        // this is the last line, only break at spaces so we can add ellipsis
-        splitAt = subStr.lastIndexOf(" ");
-      }
-
-      // if splitAt == -1 then there is an unbroken set of characters that is
-      // longer than max_width. Otherwise if splitAt != -1 then we can continue
-      // the loop until the string is <= max_width
-      if (splitAt != -1)
-      {
-        endIndex = splitAt;
-        subStr = subStr.substring(0, endIndex + 1);
-
-        char lastChar = subStr.charAt(endIndex);
-        if (lastChar == ' ')
+        // this is the last line, we need to make sure there is space for
+        // ellipsis
+        getTextBounds(subStr + "...", 0, 0, &x1, &y1, &w, &h);
+        if (w <= max_width)
         {
-          // remove this char now so it is not counted towards line width
-          keepLastChar = 0;
-          subStr.remove(endIndex);
-          --endIndex;
+          // ellipsis fit, add them to subStr
+          subStr = subStr + "...";
         }
-        else if (lastChar == '-')
-        {
-          // this char will be printed on this line and removed next iteration
-          keepLastChar = 1;
-        }
-
-        if (current_line < max_lines - 1)
-        {
-          // this is not the last line
-          display.getTextBounds(subStr, 0, 0, &x1, &y1, &w, &h);
-        }
-        else
-        {
-          // this is the last line, we need to make sure there is space for
-          // ellipsis
-          display.getTextBounds(subStr + "...", 0, 0, &x1, &y1, &w, &h);
-          if (w <= max_width)
-          {
-            // ellipsis fit, add them to subStr
-            subStr = subStr + "...";
-          }
-        }
-
-      } // end if (splitAt != -1)
+      }
     } // end inner while
 
     drawString(x, y + (current_line * line_spacing), subStr, alignment, color);
 
     // update textRemaining to no longer include what was printed
-    // +1 for exclusive bounds, +1 to get passed space/dash
-    textRemaining = textRemaining.substring(endIndex + 2 - keepLastChar);
+    textRemaining = textRemaining.substring(nextStart);
 
     ++current_line;
   } // end outer while
@@ -220,10 +553,28 @@ void drawMultiLnString(int16_t x, int16_t y, const String &text,
   return;
 } // end drawMultiLnString
 
+// Hash of the frame currently shown on the panel (0 if unknown), kept in RTC
+// memory so that it survives deep sleep.
+RTC_DATA_ATTR static uint32_t panelFrameHash = 0;
+
+/* Resets the text and rotation settings that the render functions expect.
+ */
+static void setDisplayDefaults()
+{
+  display.setRotation(0);
+  display.setTextSize(1);
+  display.setTextColor(GxEPD_BLACK);
+  display.setTextWrap(false);
+  return;
+} // end setDisplayDefaults
+
 /* Initialize e-paper display
  */
 void initDisplay()
 {
+  // whatever is drawn next replaces the frame on the panel
+  panelFrameHash = 0;
+
   pinMode(PIN_EPD_PWR, OUTPUT);
   digitalWrite(PIN_EPD_PWR, HIGH);
 #ifdef DRIVER_WAVESHARE
@@ -239,10 +590,10 @@ void initDisplay()
             PIN_EPD_MOSI,
             PIN_EPD_CS);
 
-  display.setRotation(0);
-  display.setTextSize(1);
-  display.setTextColor(GxEPD_BLACK);
-  display.setTextWrap(false);
+#if BUSY_WAIT_LIGHT_SLEEP && !RENDER_CAPTURE
+  display.epd2.setBusyCallback(busyWaitLightSleep, &EPD_BUSY_LEVEL);
+#endif
+  setDisplayDefaults();
   // display.fillScreen(GxEPD_WHITE);
   display.setFullWindow();
   display.firstPage(); // use paged drawing mode, sets fillScreen(GxEPD_WHITE)
@@ -256,8 +607,92 @@ void powerOffDisplay()
   display.hibernate(); // turns powerOff() and sets controller to deep sleep for
                        // minimum power use
   digitalWrite(PIN_EPD_PWR, LOW);
+#if BUSY_WAIT_LIGHT_SLEEP && !RENDER_CAPTURE
+  printBusyWaitStats();
+  resetBusyWaitStats();
+#endif
   return;
-} // end initDisplay
+} // end powerOffDisplay
+
+/* Begins hashing the frame. Until endFrameHash() is called nothing is drawn,
+ * the render functions only contribute to the frame hash. The panel does not
+ * need to be powered.
+ */
+void beginFrameHash()
+{
+  setDisplayDefaults();
+  display.beginHash();
+  return;
+} // end beginFrameHash
+
+/* Ends hashing the frame and returns the hash of everything drawn since
+ * beginFrameHash().
+ */
+uint32_t endFrameHash()
+{
+  return display.endHash();
+} // end endFrameHash
+
+/* Decides whether the panel needs to be refreshed to show a frame.
+ *
+ * frameHash should cover everything on the frame except for the last refresh
+ * time in the status bar. If it matches the frame on the panel, only the time
+ * differs and the refresh is skipped, the panel keeps showing when its content
+ * last changed.
+ *
+ * The panel is never partially refreshed: its power is cut after every
+ * refresh, so the controller no longer holds the previous frame that a partial
+ * refresh is computed against.
+ */
+refresh_mode_t getRefreshMode(uint32_t frameHash)
+{
+#if SKIP_UNCHANGED_REFRESH && !RENDER_CAPTURE
+  if (panelFrameHash != 0 && frameHash == panelFrameHash)
+  {
+    return REFRESH_NONE;
+  }
+#endif
+  return REFRESH_FULL;
+} // end getRefreshMode
+
+/* Records the hash of the frame that was just written to the panel.
+ */
+void setPanelFrameHash(uint32_t frameHash)
+{
+  panelFrameHash = frameHash;
+  return;
+} // end setPanelFrameHash
+
+// The grid below the current temperature, two columns of rows with a 48x48
+// icon, a label and a value. drawIndoorTrend() draws into the indoor row.
+static const int16_t CONDITIONS_Y          = 204;
+static const int16_t CONDITIONS_ICON_SIZE  = 48;
+static const int16_t CONDITIONS_ROW_PITCH  = CONDITIONS_ICON_SIZE + 8;
+static const int16_t CONDITIONS_COL_WIDTH  = 170;
+static const int     CONDITIONS_INDOOR_ROW = 4;
+
+/* Returns the baseline of the value in a row of the current conditions grid.
+ */
+static inline int16_t conditionsValueY(int row)
+{
+  return CONDITIONS_Y + 17 / 2 + CONDITIONS_ROW_PITCH * row
+         + CONDITIONS_ICON_SIZE / 2;
+} // end conditionsValueY
+
+/* Draws a size x size weather condition icon. Atlas icons are decoded
+ * straight into the page buffer, without going through the bitmap cache.
+ */
+static void drawConditionsIcon(int16_t x, int16_t y, icon_name_t icon,
+                               size_t size)
+{
+#ifdef ICON_ATLAS
+  drawAtlasIcon(display, x, y, icon, size, GxEPD_BLACK);
+#else
+  display.drawInvertedBitmap(x, y, getBitmap(icon, size), size, size,
+                             GxEPD_BLACK);
+#endif
+  return;
+} // end drawConditionsIcon
 
 /* This function is responsible for drawing the current conditions and
  * associated icons.
@@ -269,9 +704,7 @@ void drawCurrentConditions(const owm_current_t &current,
 {
   String dataStr, unitStr;
   // current weather icon
-  display.drawInvertedBitmap(0, 0,
-                             getCurrentConditionsBitmap196(current, today),
-                             196, 196, GxEPD_BLACK);
+  drawConditionsIcon(0, 0, getCurrentConditionsIcon(current, today), 196);
 
   // current temp
 #ifdef UNITS_TEMP_KELVIN
@@ -335,8 +768,10 @@ void drawCurrentConditions(const owm_current_t &current,
 #ifndef DISP_BW_V1
   display.drawInvertedBitmap(0, 204 + (48 + 8) * 3,
                              air_filter_48x48, 48, 48, GxEPD_BLACK);
-  display.drawInvertedBitmap(0, 204 + (48 + 8) * 4,
-                             house_thermometer_48x48, 48, 48, GxEPD_BLACK);
+  display.drawInvertedBitmap(0, CONDITIONS_Y + CONDITIONS_ROW_PITCH
+                                               * CONDITIONS_INDOOR_ROW,
+                             house_thermometer_48x48, CONDITIONS_ICON_SIZE,
+                             CONDITIONS_ICON_SIZE, GxEPD_BLACK);
 #endif
   display.drawInvertedBitmap(170, 204 + (48 + 8) * 0,
                              wi_sunset_48x48, 48, 48, GxEPD_BLACK);
@@ -347,8 +782,11 @@ void drawCurrentConditions(const owm_current_t &current,
 #ifndef DISP_BW_V1
   display.drawInvertedBitmap(170, 204 + (48 + 8) * 3,
                              visibility_icon_48x48, 48, 48, GxEPD_BLACK);
-  display.drawInvertedBitmap(170, 204 + (48 + 8) * 4,
-                             house_humidity_48x48, 48, 48, GxEPD_BLACK);
+  display.drawInvertedBitmap(CONDITIONS_COL_WIDTH,
+                             CONDITIONS_Y + CONDITIONS_ROW_PITCH
+                                            * CONDITIONS_INDOOR_ROW,
+                             house_humidity_48x48, CONDITIONS_ICON_SIZE,
+                             CONDITIONS_ICON_SIZE, GxEPD_BLACK);
 #endif
 
   // current weather data labels
@@ -367,14 +805,18 @@ void drawCurrentConditions(const owm_current_t &current,
     air_quality_index_label = TXT_AIR_POLLUTION;
   }
   drawString(48, 204 + 10 + (48 + 8) * 3, air_quality_index_label, LEFT);
-  drawString(48, 204 + 10 + (48 + 8) * 4, TXT_INDOOR_TEMPERATURE, LEFT);
+  drawString(CONDITIONS_ICON_SIZE,
+             CONDITIONS_Y + 10 + CONDITIONS_ROW_PITCH * CONDITIONS_INDOOR_ROW,
+             TXT_INDOOR_TEMPERATURE, LEFT);
 #endif
   drawString(170 + 48, 204 + 10 + (48 + 8) * 0, TXT_SUNSET, LEFT);
   drawString(170 + 48, 204 + 10 + (48 + 8) * 1, TXT_HUMIDITY, LEFT);
   drawString(170 + 48, 204 + 10 + (48 + 8) * 2, TXT_PRESSURE, LEFT);
 #ifndef DISP_BW_V1
   drawString(170 + 48, 204 + 10 + (48 + 8) * 3, TXT_VISIBILITY, LEFT);
-  drawString(170 + 48, 204 + 10 + (48 + 8) * 4, TXT_INDOOR_HUMIDITY, LEFT);
+  drawString(CONDITIONS_COL_WIDTH + CONDITIONS_ICON_SIZE,
+             CONDITIONS_Y + 10 + CONDITIONS_ROW_PITCH * CONDITIONS_INDOOR_ROW,
+             TXT_INDOOR_HUMIDITY, LEFT);
 #endif
 
   // sunrise
@@ -483,10 +925,7 @@ void drawCurrentConditions(const owm_current_t &current,
 #ifndef DISP_BW_V1
   // air quality index
   display.setFont(&FONT_12pt8b);
-  const owm_components_t &c = owm_air_pollution.components;
-  // OpenWeatherMap does not provide pb (lead) conentrations, so we pass NULL.
-  int aqi = calc_aqi(AQI_SCALE, c.co, c.nh3, c.no, c.no2, c.o3, NULL, c.so2,
-                                c.pm10, c.pm2_5);
+  int aqi = getAQI(owm_air_pollution);
   int aqi_max = aqi_scale_max(AQI_SCALE);
   if (aqi > aqi_max)
   {
@@ -544,7 +983,8 @@ void drawCurrentConditions(const owm_current_t &current,
 #if defined(UNITS_TEMP_CELSIUS) || defined(UNITS_TEMP_FAHRENHEIT)
   dataStr += "\260";
 #endif
-  drawString(48, 204 + 17 / 2 + (48 + 8) * 4 + 48 / 2, dataStr, LEFT);
+  drawString(CONDITIONS_ICON_SIZE, conditionsValueY(CONDITIONS_INDOOR_ROW),
+             dataStr, LEFT);
 #endif // defined(DISP_BW_V2) || defined(DISP_3C_B) || defined(DISP_7C_F)
 
   // sunset
@@ -657,14 +1097,109 @@ void drawCurrentConditions(const owm_current_t &current,
   {
     dataStr = "--";
   }
-  drawString(170 + 48, 204 + 17 / 2 + (48 + 8) * 4 + 48 / 2, dataStr, LEFT);
+  drawString(CONDITIONS_COL_WIDTH + CONDITIONS_ICON_SIZE,
+             conditionsValueY(CONDITIONS_INDOOR_ROW), dataStr, LEFT);
   display.setFont(&FONT_8pt8b);
-  drawString(display.getCursorX(), 204 + 17 / 2 + (48 + 8) * 4 + 48 / 2,
+  drawString(display.getCursorX(), conditionsValueY(CONDITIONS_INDOOR_ROW),
              "%", LEFT);
 #endif // defined(DISP_BW_V2) || defined(DISP_3C_B) || defined(DISP_7C_F)
   return;
 } // end drawCurrentConditions
 
+/* Draws columns of values as a line in the w x h box at x, y, NAN columns
+ * break the line. The scale spans at least minSpan, so that sensor noise is
+ * not drawn as a trend.
+ */
+static void drawSparkline(int16_t x, int16_t y, int16_t w, int16_t h,
+                          const float *values, float vMin, float vMax,
+                          float minSpan)
+{
+  if (std::isnan(vMin))
+  {
+    return;
+  }
+  if (vMax - vMin < minSpan)
+  {
+    float mid = (vMin + vMax) / 2;
+    vMin = mid - minSpan / 2;
+    vMax = mid + minSpan / 2;
+  }
+
+  int16_t prevX = -1;
+  int16_t prevY = 0;
+  for (int16_t c = 0; c < w; ++c)
+  {
+    if (std::isnan(values[c]))
+    {
+      prevX = -1;
+      continue;
+    }
+    int16_t py = y + h - 1 - static_cast<int16_t>(std::round(
+                             (values[c] - vMin) / (vMax - vMin) * (h - 1)));
+    if (prevX >= 0)
+    {
+      display.drawLine(prevX, prevY, x + c, py, GxEPD_BLACK);
+    }
+    else
+    {
+      display.drawPixel(x + c, py, GxEPD_BLACK);
+    }
+    prevX = x + c;
+    prevY = py;
+  }
+  return;
+} // end drawSparkline
+
+/* This function is responsible for drawing the indoor trend, sparklines of the
+ * indoor temperature and humidity history next to the indoor readings, and an
+ * arrow for the indoor pressure tendency over the last 3 hours.
+ */
+void drawIndoorTrend(const indoor_history_t &history)
+{
+#if defined(DISP_BW_V2) || defined(DISP_3C_B) || defined(DISP_7C_F)
+  const int16_t w = 40;
+  const int16_t h = 20;
+  float temp[w];
+  float humidity[w];
+  indoor_trend_t trend = {};
+  trend.temp = temp;
+  trend.humidity = humidity;
+  trend.columns = w;
+  getIndoorTrend(history, trend);
+
+  // Right aligned in both columns of the indoor row, centered on the values.
+  // The pressure arrow (radius 6) goes at the end of the second column.
+  const int16_t gap = 4;
+  const int16_t y = conditionsValueY(CONDITIONS_INDOOR_ROW) - h / 2;
+  const int16_t ax = 2 * CONDITIONS_COL_WIDTH - 2 - 6;
+  const int16_t ay = y + h / 2;
+  drawSparkline(CONDITIONS_COL_WIDTH - 2 - gap - w, y, w, h, temp,
+                trend.temp_min, trend.temp_max, 2.0f);
+  drawSparkline(ax - 6 - gap - w, y, w, h, humidity, trend.humidity_min,
+                trend.humidity_max, 10.0f);
+
+  // pressure tendency
+  switch (trend.tendency)
+  {
+  case INDOOR_TENDENCY_RISING:
+    display.fillTriangle(ax - 6, ay + 5, ax + 6, ay + 5, ax, ay - 6,
+                         GxEPD_BLACK);
+    break;
+  case INDOOR_TENDENCY_FALLING:
+    display.fillTriangle(ax - 6, ay - 5, ax + 6, ay - 5, ax, ay + 6,
+                         GxEPD_BLACK);
+    break;
+  case INDOOR_TENDENCY_STEADY:
+    display.fillTriangle(ax - 5, ay - 6, ax - 5, ay + 6, ax + 6, ay,
+                         GxEPD_BLACK);
+    break;
+  default:
+    break;
+  }
+#endif // defined(DISP_BW_V2) || defined(DISP_3C_B) || defined(DISP_7C_F)
+  return;
+} // end drawIndoorTrend
+
 /* This function is responsible for drawing the five day forecast.
  */
 void drawForecast(const owm_daily_t *daily, tm timeInfo)
@@ -680,9 +1215,8 @@ void drawForecast(const owm_daily_t *daily, tm timeInfo)
     int x = 318 + (i * 64);
 #endif
     // icons
-    display.drawInvertedBitmap(x, 98 + 69 / 2 - 32 - 6,
-                               getDailyForecastBitmap64(daily[i]),
-                               64, 64, GxEPD_BLACK);
+    drawConditionsIcon(x, 98 + 69 / 2 - 32 - 6,
+                       getDailyForecastIcon(daily[i]), 64);
     // day of week label
     display.setFont(&FONT_11pt8b);
     char dayBuffer[8] = {};
@@ -763,30 +1297,28 @@ void drawForecast(const owm_daily_t *daily, tm timeInfo)
   /* This function is responsible for drawing the current alerts if any.
    * Up to 2 alerts can be drawn.
    */
-  void drawAlerts(std::vector<owm_alerts_t> & alerts,
+  void drawAlerts(owm_resp_alerts_t & alerts,
                   const String &city, const String &date)
   {
 #if DEBUG_LEVEL >= 1
-  Serial.println("[debug] alerts.size()    : " + String(alerts.size()));
+  TLOG("[debug] alerts.count     : %d", alerts.count);
 #endif
-  if (alerts.size() == 0)
+  if (alerts.count == 0)
   { // no alerts to draw
     return;
   }
 
-  int *ignore_list = (int *) calloc(alerts.size(), sizeof(*ignore_list));
-  int *alert_indices = (int *) calloc(alerts.size(), sizeof(*alert_indices));
-  if (!ignore_list || !alert_indices)
-  {
-    Serial.println("Error: Failed to allocate memory while handling alerts.");
-    free(ignore_list);
-    free(alert_indices);
-    return;
-  }
-
-  // Converts all event text and tags to lowercase, removes extra information,
-  // and filters out redundant alerts of lesser urgency.
-  filterAlerts(alerts, ignore_list);
+  // Summarizes each alert once (category, urgency, event name without extra
+  // information) and selects the most urgent and recent ones.
+  int alert_indices[2];
+  int num_valid_alerts = filterAlerts(alerts, alert_indices);
+#if DEBUG_LEVEL >= 1
+  // at most 2 alerts, -1 for none
+  TLOG("[debug] alert_indices    : [ %d %d ]",
+       num_valid_alerts > 0 ? alert_indices[0] : -1,
+       num_valid_alerts > 1 ? alert_indices[1] : -1);
+  TLOG("[debug] num_valid_alerts : %d", num_valid_alerts);
+#endif
 
   // limit alert text width so that is does not run into the location or date
   // strings
@@ -796,53 +1328,34 @@ void drawForecast(const owm_daily_t *daily, tm timeInfo)
   int date_w = getStringWidth(date);
   int max_w = DISP_WIDTH - 2 - std::max(city_w, date_w) - (196 + 4) - 8;
 
-  // find indices of valid alerts
-  int num_valid_alerts = 0;
-#if DEBUG_LEVEL >= 1
-  Serial.print("[debug] ignore_list      : [ ");
-#endif
-  for (int i = 0; i < alerts.size(); ++i)
-  {
-#if DEBUG_LEVEL >= 1
-    Serial.print(String(ignore_list[i]) + " ");
-#endif
-    if (!ignore_list[i])
-    {
-      alert_indices[num_valid_alerts] = i;
-      ++num_valid_alerts;
-    }
-  }
-#if DEBUG_LEVEL >= 1
-  Serial.println("]\n[debug] num_valid_alerts : " + String(num_valid_alerts));
-#endif
-
   if (num_valid_alerts == 1)
   { // 1 alert
     // adjust max width to for 48x48 icons
     max_w -= 48;
 
-    owm_alerts_t &cur_alert = alerts[alert_indices[0]];
+    const owm_alerts_t &cur_alert = alerts.alert[alert_indices[0]];
     display.drawInvertedBitmap(196, 8, getAlertBitmap48(cur_alert), 48, 48,
                                ACCENT_COLOR);
-    // must be called after getAlertBitmap
-    toTitleCase(cur_alert.event);
+    String event = String(alerts.text + cur_alert.event)
+                     .substring(0, cur_alert.summary.event_len);
+    toTitleCase(event);
 
     display.setFont(&FONT_14pt8b);
-    if (getStringWidth(cur_alert.event) <= max_w)
+    if (getStringWidth(event) <= max_w)
     { // Fits on a single line, draw along bottom
-      drawString(196 + 48 + 4, 24 + 8 - 12 + 20 + 1, cur_alert.event, LEFT);
+      drawString(196 + 48 + 4, 24 + 8 - 12 + 20 + 1, event, LEFT);
     }
     else
     { // use smaller font
       display.setFont(&FONT_12pt8b);
-      if (getStringWidth(cur_alert.event) <= max_w)
+      if (getStringWidth(event) <= max_w)
       { // Fits on a single line with smaller font, draw along bottom
-        drawString(196 + 48 + 4, 24 + 8 - 12 + 17 + 1, cur_alert.event, LEFT);
+        drawString(196 + 48 + 4, 24 + 8 - 12 + 17 + 1, event, LEFT);
       }
       else
       { // Does not fit on a single line, draw higher to allow room for 2nd line
         drawMultiLnString(196 + 48 + 4, 24 + 8 - 12 + 17 - 11,
-                          cur_alert.event, LEFT, max_w, 2, 23);
+                          event, LEFT, max_w, 2, 23);
       }
     }
   } // end 1 alert
@@ -854,21 +1367,19 @@ void drawForecast(const owm_daily_t *daily, tm timeInfo)
     display.setFont(&FONT_12pt8b);
     for (int i = 0; i < 2; ++i)
     {
-      owm_alerts_t &cur_alert = alerts[alert_indices[i]];
+      const owm_alerts_t &cur_alert = alerts.alert[alert_indices[i]];
 
       display.drawInvertedBitmap(196, (i * 32), getAlertBitmap32(cur_alert),
                                  32, 32, ACCENT_COLOR);
-      // must be called after getAlertBitmap
-      toTitleCase(cur_alert.event);
+      String event = String(alerts.text + cur_alert.event)
+                       .substring(0, cur_alert.summary.event_len);
+      toTitleCase(event);
 
       drawMultiLnString(196 + 32 + 3, 5 + 17 + (i * 32),
-                        cur_alert.event, LEFT, max_w, 1, 0);
+                        event, LEFT, max_w, 1, 0);
     } // end for-loop
   } // end 2 alerts
 
-  free(ignore_list);
-  free(alert_indices);
-
   return;
 } // end drawAlerts
 
@@ -1110,10 +1621,8 @@ void drawOutlookGraph(const owm_hourly_t *hourly, const owm_daily_t *daily,
     // draw dotted line
     if (i < yMajorTicks)
     {
-      for (int x = xPos0; x <= xPos1 + 1; x += 3)
-      {
-        display.drawPixel(x, yTick + (yTick % 2), GxEPD_BLACK);
-      }
+      drawDottedHLine(display, xPos0, xPos1 + 1, yTick + (yTick % 2), 3,
+                      GxEPD_BLACK);
     }
   }
 
@@ -1154,9 +1663,7 @@ void drawOutlookGraph(const owm_hourly_t *hourly, const owm_daily_t *daily,
       y0_t = y_t[i - 1];
       y1_t = y_t[i    ];
       // graph temperature
-      display.drawLine(x0_t    , y0_t    , x1_t    , y1_t    , ACCENT_COLOR);
-      display.drawLine(x0_t    , y0_t + 1, x1_t    , y1_t + 1, ACCENT_COLOR);
-      display.drawLine(x0_t - 1, y0_t    , x1_t - 1, y1_t    , ACCENT_COLOR);
+      drawThickLine(display, x0_t, y0_t, x1_t, y1_t, 2, ACCENT_COLOR);
 
       // draw hourly bitmap
 #if DISPLAY_HOURLY_ICONS
@@ -1189,10 +1696,9 @@ void drawOutlookGraph(const owm_hourly_t *hourly, const owm_daily_t *daily,
         {
           y_b = std::min(y_t[idx], y_b);
         }
-        const uint8_t *bitmap = getHourlyForecastBitmap32(hourly[i],
-                                                          daily[day_idx]);
-        display.drawInvertedBitmap(xTick - 16, y_b - 32,
-                                   bitmap, 32, 32, GxEPD_BLACK);
+        drawConditionsIcon(xTick - 16, y_b - 32,
+                           getHourlyForecastIcon(hourly[i], daily[day_idx]),
+                           32);
       }
 #endif
     }
@@ -1216,13 +1722,12 @@ void drawOutlookGraph(const owm_hourly_t *hourly, const owm_daily_t *daily,
     y1_t = yPos1;
 
     // graph Precipitation
-    for (int y = y1_t - 1; y > y0_t; y -= 2)
-    {
-      for (int x = x0_t + (x0_t % 2); x < x1_t; x += 2)
-      {
-        display.drawPixel(x, y, GxEPD_BLACK);
-      }
-    }
+    // hatched every second pixel, every second row starting just above the
+    // x axis
+    fillPatternRect(display, x0_t, y0_t + 1, x1_t - x0_t, y1_t - 1 - y0_t,
+                    ((yPos1 - 1) % 2) ? PATTERN_HATCH_ODD_ROWS
+                                      : PATTERN_HATCH_EVEN_ROWS,
+                    GxEPD_BLACK, patternSpans(display));
 
     if ((i % hourInterval) == 0)
     {
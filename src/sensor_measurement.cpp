@@ -0,0 +1,405 @@
+/**
+ * 传感器异步测量模块实现
+ * BMP280+AHT20的非阻塞测量状态机
+ */
+
+#include "sensor_measurement.h"
+#include "asset_index.h"
+
+// 截止时间比较，允许millis()回绕
+static bool reached(uint32_t now, uint32_t deadline) {
+  return (int32_t)(now - deadline) >= 0;
+}
+
+bool readBmp280Calib(SensorBus &bus, uint8_t address, Bmp280Calib &calib) {
+  const uint8_t reg = BMP280_REG_CALIB;
+  uint8_t raw[24];
+  if (!bus.write(address, &reg, 1) || !bus.read(address, raw, sizeof(raw))) {
+    return false;
+  }
+
+  uint16_t v[12];
+  for (int i = 0; i < 12; i++) {
+    v[i] = raw[2 * i] | (raw[2 * i + 1] << 8);
+  }
+  calib.t1 = v[0];
+  calib.t2 = (int16_t)v[1];
+  calib.t3 = (int16_t)v[2];
+  calib.p1 = v[3];
+  calib.p2 = (int16_t)v[4];
+  calib.p3 = (int16_t)v[5];
+  calib.p4 = (int16_t)v[6];
+  calib.p5 = (int16_t)v[7];
+  calib.p6 = (int16_t)v[8];
+  calib.p7 = (int16_t)v[9];
+  calib.p8 = (int16_t)v[10];
+  calib.p9 = (int16_t)v[11];
+
+  // 未焊接或总线故障时读到的全0/全1不是有效的校准系数
+  return calib.t1 != 0 && calib.t1 != 0xFFFF && calib.p1 != 0 &&
+         calib.p1 != 0xFFFF;
+}
+
+uint32_t bmp280ConversionTime(uint8_t ctrlMeas) {
+  // 数据手册最大测量时间：1.25 + 2.3*osrs_t + (2.3*osrs_p + 0.575) ms
+  static const uint8_t OVERSAMPLING[8] = {0, 1, 2, 4, 8, 16, 16, 16};
+  uint32_t osrsT = OVERSAMPLING[(ctrlMeas >> 5) & 0x07];
+  uint32_t osrsP = OVERSAMPLING[(ctrlMeas >> 2) & 0x07];
+  uint32_t us = 1250 + 2300 * osrsT;
+  if (osrsP > 0) {
+    us += 2300 * osrsP + 575;
+  }
+  return (us + 999) / 1000;
+}
+
+void compensateBmp280(const Bmp280Calib &calib, int32_t adcT, int32_t adcP,
+                      float &temperature, float &pressure) {
+  int32_t var1, var2;
+  var1 = ((((adcT >> 3) - ((int32_t)calib.t1 << 1))) * ((int32_t)calib.t2)) >>
+         11;
+  var2 = (((((adcT >> 4) - ((int32_t)calib.t1)) *
+            ((adcT >> 4) - ((int32_t)calib.t1))) >>
+           12) *
+          ((int32_t)calib.t3)) >>
+         14;
+  int32_t tFine = var1 + var2;
+  temperature = (float)((tFine * 5 + 128) >> 8) / 100;
+
+  // 左移负数是未定义行为，用乘法代替数据手册中的左移
+  int64_t p1, p2, p;
+  p1 = ((int64_t)tFine) - 128000;
+  p2 = p1 * p1 * (int64_t)calib.p6;
+  p2 = p2 + ((p1 * (int64_t)calib.p5) * 131072);
+  p2 = p2 + (((int64_t)calib.p4) * 34359738368);
+  p1 = ((p1 * p1 * (int64_t)calib.p3) >> 8) + ((p1 * (int64_t)calib.p2) * 4096);
+  p1 = (((((int64_t)1) << 47) + p1)) * ((int64_t)calib.p1) >> 33;
+  if (p1 == 0) {
+    pressure = NAN; // 避免除以0
+    return;
+  }
+  p = 1048576 - adcP;
+  p = (((p * 2147483648) - p2) * 3125) / p1;
+  p1 = (((int64_t)calib.p9) * (p >> 13) * (p >> 13)) >> 25;
+  p2 = (((int64_t)calib.p8) * p) >> 19;
+  p = ((p + p1 + p2) >> 8) + (((int64_t)calib.p7) * 16);
+  pressure = (float)p / 256;
+}
+
+void convertAht20(const uint8_t raw[6], float &temperature, float &humidity) {
+  // raw[0]为状态，随后是20位湿度和20位温度
+  uint32_t h = ((uint32_t)raw[1] << 12) | ((uint32_t)raw[2] << 4) |
+               (raw[3] >> 4);
+  uint32_t t = (((uint32_t)raw[3] & 0x0F) << 16) | ((uint32_t)raw[4] << 8) |
+               raw[5];
+  humidity = ((float)h * 100) / 0x100000;
+  temperature = ((float)t * 200 / 0x100000) - 50;
+}
+
+bool probeBmp280(SensorBus &bus, uint8_t address, uint8_t &chipId) {
+  const uint8_t reg = BMP280_REG_CHIP_ID;
+  return bus.write(address, &reg, 1) && bus.read(address, &chipId, 1) &&
+         chipId == BMP280_CHIP_ID;
+}
+
+void sealSensorMap(SensorDeviceMap &map) {
+  map.magic = SENSOR_MAP_MAGIC;
+  map.reserved = 0;
+  map.crc = assetCrc32(reinterpret_cast<const uint8_t *>(&map),
+                       offsetof(SensorDeviceMap, crc));
+}
+
+bool isSensorMapValid(const SensorDeviceMap &map) {
+  return map.magic == SENSOR_MAP_MAGIC &&
+         map.crc == assetCrc32(reinterpret_cast<const uint8_t *>(&map),
+                               offsetof(SensorDeviceMap, crc));
+}
+
+bool verifySensorMap(SensorBus &bus, const SensorDeviceMap &map) {
+  if (!isSensorMapValid(map)) {
+    return false;
+  }
+
+  // 每个设备一次短读：BMP280的芯片ID，AHT20的状态字节
+  if (map.bmp280Address != 0) {
+    const uint8_t reg = BMP280_REG_CHIP_ID;
+    uint8_t chipId;
+    if (!bus.write(map.bmp280Address, &reg, 1) ||
+        !bus.read(map.bmp280Address, &chipId, 1) ||
+        chipId != map.bmp280ChipId) {
+      return false;
+    }
+  }
+  if (map.aht20Address != 0) {
+    // 未校准的AHT20需要完整初始化
+    uint8_t status;
+    if (!bus.read(map.aht20Address, &status, 1) ||
+        !(status & AHT20_STATUS_CALIBRATED)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 各配置的基本参数，转换时间和电荷由getAcquisitionProfile()计算
+static const AcquisitionProfile PROFILES[NUM_ACQUISITION_PROFILES] = {
+    // 温度x1，气压x1，不滤波，400kHz
+    {"fast", BMP280_CTRL_MEAS(1, 1, BMP280_MODE_FORCED), BMP280_CONFIG(0, 0), 1,
+     1, 400000, 0, 0},
+    // 温度x2，气压x16，单次转换滤波不起作用
+    {"balanced", BMP280_CTRL_MEAS(2, 5, BMP280_MODE_FORCED),
+     BMP280_CONFIG(0, 0), 1, 1, 100000, 0, 0},
+    // 温度x2，气压x16，滤波x4连续转换4次；AHT20平均4次
+    {"precise", BMP280_CTRL_MEAS(2, 5, BMP280_MODE_FORCED),
+     BMP280_CONFIG(0, 2), 4, 4, 100000, 0, 0},
+};
+
+// 电荷估算用的电流（毫安），mA*ms即微库仑
+static const float ESP32_ACTIVE_MA = 30.0f; // 240MHz，无线关闭
+static const float BMP280_MEASURING_MA = 0.72f;
+static const float AHT20_MEASURING_MA = 0.98f;
+
+// 每次转换的I2C传输字节数（含地址字节）：BMP280触发、状态、数据，
+// AHT20触发、数据
+static const uint32_t BMP280_TRANSFER_BYTES = 3 + 2 + 2 + 2 + 7;
+static const uint32_t AHT20_TRANSFER_BYTES = 4 + 7;
+
+AcquisitionProfile getAcquisitionProfile(AcquisitionProfileId id) {
+  AcquisitionProfile profile = PROFILES[id < NUM_ACQUISITION_PROFILES
+                                            ? id
+                                            : PROFILE_BALANCED];
+
+  // 两个传感器同时转换，取较慢的一个；每字节9个时钟
+  uint32_t bmpMs = profile.bmpSamples * bmp280ConversionTime(profile.ctrlMeas);
+  uint32_t ahtMs =
+      (profile.ahtSamples - 1) * SensorMeasurement::AHT20_SAMPLE_INTERVAL_MS +
+      SensorMeasurement::AHT20_CONVERSION_MS;
+  uint32_t bytes = profile.bmpSamples * BMP280_TRANSFER_BYTES +
+                   profile.ahtSamples * AHT20_TRANSFER_BYTES;
+  uint32_t transferMs = (bytes * 9 * 1000 + profile.i2cFrequency - 1) /
+                        profile.i2cFrequency;
+  profile.conversionMs = (bmpMs > ahtMs ? bmpMs : ahtMs) + transferMs;
+
+  float charge =
+      ESP32_ACTIVE_MA * profile.conversionMs + BMP280_MEASURING_MA * bmpMs +
+      AHT20_MEASURING_MA * profile.ahtSamples *
+          SensorMeasurement::AHT20_CONVERSION_MS;
+  profile.chargeUc = (uint32_t)(charge + 0.5f);
+  return profile;
+}
+
+SensorMeasurement::SensorMeasurement()
+    : calib(), ctrlMeas(0), state(MEASUREMENT_IDLE) {
+  reset();
+}
+
+void SensorMeasurement::configureBMP280(uint8_t address,
+                                        const Bmp280Calib &calib,
+                                        uint8_t ctrlMeas, uint8_t samples) {
+  bmp = Channel();
+  bmp.enabled = true;
+  bmp.address = address;
+  bmp.samples = samples > 0 ? samples : 1;
+  this->calib = calib;
+  this->ctrlMeas = ctrlMeas;
+}
+
+void SensorMeasurement::configureAHT20(uint8_t address, uint8_t samples) {
+  aht = Channel();
+  aht.enabled = true;
+  aht.address = address;
+  aht.samples = samples > 0 ? samples : 1;
+}
+
+void SensorMeasurement::reset() {
+  bmp = Channel();
+  aht = Channel();
+  state = MEASUREMENT_IDLE;
+  result = MeasurementResult();
+  ahtTemperatureSum = 0;
+  humiditySum = 0;
+}
+
+bool SensorMeasurement::start(SensorBus &bus, uint32_t now) {
+  if (!bmp.enabled && !aht.enabled) {
+    state = MEASUREMENT_IDLE;
+    return false;
+  }
+
+  result = MeasurementResult();
+  ahtTemperatureSum = 0;
+  humiditySum = 0;
+  state = MEASUREMENT_PENDING;
+
+  // 两个传感器同时转换，总时间取决于较慢的AHT20
+  Channel *channels[2] = {&bmp, &aht};
+  for (int i = 0; i < 2; i++) {
+    Channel &ch = *channels[i];
+    ch.finished = !ch.enabled;
+    ch.triggered = false;
+    ch.collected = 0;
+    ch.attempts = 0;
+    if (ch.enabled) {
+      trigger(bus, ch, &ch == &bmp, now);
+    }
+  }
+  return true;
+}
+
+MeasurementState SensorMeasurement::poll(SensorBus &bus, uint32_t now) {
+  if (state != MEASUREMENT_PENDING) {
+    return state;
+  }
+
+  advance(bus, bmp, true, now);
+  advance(bus, aht, false, now);
+
+  if (bmp.finished && aht.finished) {
+    state = MEASUREMENT_DONE;
+  }
+  return state;
+}
+
+uint32_t SensorMeasurement::nextDeadline() const {
+  if (!bmp.finished && !aht.finished) {
+    return reached(aht.deadline, bmp.deadline) ? bmp.deadline : aht.deadline;
+  }
+  return bmp.finished ? aht.deadline : bmp.deadline;
+}
+
+MeasurementState SensorMeasurement::getState() const { return state; }
+
+const MeasurementResult &SensorMeasurement::getResult() const {
+  return result;
+}
+
+uint8_t SensorMeasurement::getAttempts(bool bmp280) const {
+  return bmp280 ? bmp.attempts : aht.attempts;
+}
+
+// 私有方法实现
+
+void SensorMeasurement::trigger(SensorBus &bus, Channel &ch, bool isBmp,
+                                uint32_t now) {
+  ch.attempts++;
+  ch.started = now;
+
+  bool success;
+  if (isBmp) {
+    // 写入强制模式开始一次转换，完成后传感器自动回到睡眠模式
+    const uint8_t cmd[2] = {BMP280_REG_CTRL_MEAS, ctrlMeas};
+    success = bus.write(ch.address, cmd, sizeof(cmd));
+    ch.deadline = now + bmp280ConversionTime(ctrlMeas);
+  } else {
+    const uint8_t cmd[3] = {AHT20_CMD_TRIGGER, 0x33, 0x00};
+    success = bus.write(ch.address, cmd, sizeof(cmd));
+    ch.deadline = now + AHT20_CONVERSION_MS;
+  }
+
+  if (success) {
+    ch.triggered = true;
+  } else {
+    fail(ch, now);
+  }
+}
+
+void SensorMeasurement::advance(SensorBus &bus, Channel &ch, bool isBmp,
+                                uint32_t now) {
+  if (ch.finished || !reached(now, ch.deadline)) {
+    return;
+  }
+
+  // 重试的时间到了
+  if (!ch.triggered) {
+    trigger(bus, ch, isBmp, now);
+    return;
+  }
+
+  Collect collected = isBmp ? collectBMP280(bus) : collectAHT20(bus);
+  if (collected == COLLECT_READY) {
+    complete(ch, isBmp, now);
+  } else if (collected == COLLECT_BUSY &&
+             now - ch.started < CONVERSION_TIMEOUT_MS) {
+    ch.deadline = now + BUSY_RECHECK_MS;
+  } else {
+    fail(ch, now);
+  }
+}
+
+void SensorMeasurement::complete(Channel &ch, bool isBmp, uint32_t now) {
+  ch.collected++;
+  ch.triggered = false;
+  if (ch.collected < ch.samples) {
+    ch.attempts = 0;
+    // BMP280立即开始下一次转换，AHT20等到采样间隔
+    ch.deadline = isBmp ? now : ch.started + AHT20_SAMPLE_INTERVAL_MS;
+    return;
+  }
+  ch.finished = true;
+}
+
+void SensorMeasurement::fail(Channel &ch, uint32_t now) {
+  ch.triggered = false;
+  if (ch.attempts >= MAX_ATTEMPTS) {
+    // 重试用尽，已完成的采样仍然有效
+    ch.finished = true;
+  } else {
+    ch.deadline = now + RETRY_INTERVAL_MS;
+  }
+}
+
+SensorMeasurement::Collect SensorMeasurement::collectBMP280(SensorBus &bus) {
+  const uint8_t statusReg = BMP280_REG_STATUS;
+  uint8_t status;
+  if (!bus.write(bmp.address, &statusReg, 1) ||
+      !bus.read(bmp.address, &status, 1)) {
+    return COLLECT_FAILED;
+  }
+  if (status & BMP280_STATUS_MEASURING) {
+    return COLLECT_BUSY;
+  }
+
+  // 气压和温度各20位：msb, lsb, xlsb[7:4]
+  const uint8_t dataReg = BMP280_REG_DATA;
+  uint8_t raw[6];
+  if (!bus.write(bmp.address, &dataReg, 1) ||
+      !bus.read(bmp.address, raw, sizeof(raw))) {
+    return COLLECT_FAILED;
+  }
+  int32_t adcP = ((int32_t)raw[0] << 12) | (raw[1] << 4) | (raw[2] >> 4);
+  int32_t adcT = ((int32_t)raw[3] << 12) | (raw[4] << 4) | (raw[5] >> 4);
+
+  // 0x80000是复位值，说明没有完成转换
+  if (adcP == 0x80000 || adcT == 0x80000) {
+    return COLLECT_FAILED;
+  }
+
+  float temperature, pressure;
+  compensateBmp280(calib, adcT, adcP, temperature, pressure);
+  if (!std::isfinite(temperature) || !std::isfinite(pressure)) {
+    return COLLECT_FAILED;
+  }
+  result.bmpTemperature = temperature;
+  result.pressure = pressure;
+  result.bmpValid = true;
+  return COLLECT_READY;
+}
+
+SensorMeasurement::Collect SensorMeasurement::collectAHT20(SensorBus &bus) {
+  uint8_t raw[6];
+  if (!bus.read(aht.address, raw, sizeof(raw))) {
+    return COLLECT_FAILED;
+  }
+  if (raw[0] & AHT20_STATUS_BUSY) {
+    return COLLECT_BUSY;
+  }
+
+  // 结果为目前所有采样的平均
+  float temperature, humidity;
+  convertAht20(raw, temperature, humidity);
+  ahtTemperatureSum += temperature;
+  humiditySum += humidity;
+  result.ahtTemperature = ahtTemperatureSum / (aht.collected + 1);
+  result.humidity = humiditySum / (aht.collected + 1);
+  result.ahtValid = true;
+  return COLLECT_READY;
+}
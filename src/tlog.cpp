@@ -0,0 +1,285 @@
+/* Tokenized log for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_ota_ops.h>
+#include <esp_system.h>
+#include <soc/soc_memory_layout.h>
+
+#include "config.h"
+#include "tlog.h"
+
+#if TOKENIZED_LOG
+
+typedef struct tlog_ring
+{
+  uint32_t magic;
+  uint32_t head;    // bytes written, the ring index is head % TLOG_RING_SIZE
+  uint32_t tail;    // start of the oldest record
+  uint32_t sent;    // start of the oldest record not sent yet
+  uint32_t wakes;
+  uint32_t lost;    // records overwritten before they were sent
+  uint8_t  data[TLOG_RING_SIZE];
+} tlog_ring_t;
+
+// Not initialized at boot, so the records of a wake that ended in a crash or
+// watchdog reset are sent after it.
+RTC_NOINIT_ATTR static tlog_ring_t ring;
+static portMUX_TYPE ringLock = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint32_t RING_MASK = TLOG_RING_SIZE - 1;
+static const uint8_t MIN_RECORD = 8; // id and time
+
+/* Returns true if the ring holds a valid sequence of records. After power-on
+ * RTC memory holds random data.
+ */
+static bool ringValid()
+{
+  if (ring.magic != TLOG_MAGIC
+   || ring.head - ring.tail > TLOG_RING_SIZE
+   || ring.sent - ring.tail > ring.head - ring.tail)
+  {
+    return false;
+  }
+  bool sentFound = false;
+  uint32_t pos = ring.tail;
+  while (pos != ring.head)
+  {
+    const uint32_t len = ring.data[pos & RING_MASK];
+    if (len < MIN_RECORD || ring.head - pos < len + 1)
+    {
+      return false;
+    }
+    sentFound |= pos == ring.sent;
+    pos += len + 1;
+  }
+  return sentFound || ring.sent == ring.head;
+} // end ringValid
+
+/* Begins a record with the given id and the time since boot.
+ */
+void tlogStart(tlog_record_t &r, uint32_t id)
+{
+  r.len = 0;
+  r.full = false;
+  const uint32_t now = millis();
+  tlogPut(r, &id, sizeof(id));
+  tlogPut(r, &now, sizeof(now));
+  return;
+} // end tlogStart
+
+/* Appends n bytes to the record. Once an argument does not fit, it and all
+ * further ones are dropped, the decoder shows the message as truncated.
+ */
+void tlogPut(tlog_record_t &r, const void *p, size_t n)
+{
+  if (r.full || r.len + n > TLOG_MAX_RECORD)
+  {
+    r.full = true;
+    return;
+  }
+  memcpy(r.data + r.len, p, n);
+  r.len += n;
+  return;
+} // end tlogPut
+
+/* Appends a string argument. Strings in flash (literals, locale strings) are
+ * stored as their address, others are copied up to TLOG_MAX_STRING characters.
+ */
+void tlogPutString(tlog_record_t &r, const char *s)
+{
+  if (s == nullptr)
+  {
+    s = "(null)";
+  }
+  if (esp_ptr_in_drom(s))
+  {
+    uint8_t ref[5] = {TLOG_STRING_REF};
+    const uint32_t addr = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(s));
+    memcpy(ref + 1, &addr, sizeof(addr));
+    tlogPut(r, ref, sizeof(ref));
+    return;
+  }
+  // shorten the string rather than drop it
+  size_t n = strnlen(s, TLOG_MAX_STRING);
+  if (!r.full && r.len + 1 + n > TLOG_MAX_RECORD && r.len < TLOG_MAX_RECORD)
+  {
+    n = TLOG_MAX_RECORD - r.len - 1;
+  }
+  const uint8_t len = static_cast<uint8_t>(n);
+  tlogPut(r, &len, sizeof(len));
+  tlogPut(r, s, n);
+  return;
+} // end tlogPutString
+
+/* Stores the record in the ring, overwriting the oldest records if needed.
+ */
+void tlogCommit(const tlog_record_t &r)
+{
+  const uint32_t need = r.len + 1;
+  portENTER_CRITICAL(&ringLock);
+  if (ring.magic != TLOG_MAGIC)
+  {
+    // logged before tlogBegin()
+    memset(&ring, 0, offsetof(tlog_ring_t, data));
+    ring.magic = TLOG_MAGIC;
+  }
+  while (ring.head + need - ring.tail > TLOG_RING_SIZE)
+  {
+    const uint32_t len = ring.data[ring.tail & RING_MASK] + 1;
+    if (ring.sent == ring.tail)
+    {
+      ring.sent += len;
+      ++ring.lost;
+    }
+    ring.tail += len;
+  }
+  ring.data[ring.head & RING_MASK] = r.len;
+  for (uint32_t i = 0; i < r.len; ++i)
+  {
+    ring.data[(ring.head + 1 + i) & RING_MASK] = r.data[i];
+  }
+  ring.head += need;
+  portEXIT_CRITICAL(&ringLock);
+  return;
+} // end tlogCommit
+
+/* Checks the ring buffer after a reset and logs the wake. Call once, early in
+ * setup().
+ */
+void tlogBegin()
+{
+  if (!ringValid())
+  {
+    memset(&ring, 0, offsetof(tlog_ring_t, data));
+    ring.magic = TLOG_MAGIC;
+  }
+  ++ring.wakes;
+
+  // lets the decoder check that it has the ELF of this build
+  uint32_t elfHash = 0;
+  memcpy(&elfHash, esp_ota_get_app_description()->app_elf_sha256,
+         sizeof(elfHash));
+  const uint32_t lost = ring.lost;
+  ring.lost = 0;
+
+  tlog_record_t r;
+  tlogStart(r, TLOG_ID_WAKE);
+  tlogPutArg(r, ring.wakes);
+  tlogPutArg(r, static_cast<uint32_t>(esp_reset_reason()));
+  tlogPutArg(r, lost);
+  tlogPutArg(r, elfHash);
+  tlogCommit(r);
+  return;
+} // end tlogBegin
+
+/* Sends a record as a frame.
+ */
+static void sendFrame(const uint8_t *data, uint8_t len)
+{
+  uint8_t frame[TLOG_MAX_RECORD + 3];
+  frame[0] = TLOG_FRAME_START;
+  frame[1] = len;
+  uint8_t sum = len;
+  for (uint32_t i = 0; i < len; ++i)
+  {
+    frame[2 + i] = data[i];
+    sum += data[i];
+  }
+  frame[2 + len] = sum;
+  Serial.write(frame, len + 3);
+  return;
+} // end sendFrame
+
+/* Sends the record in the ring at pos, returns its length in the ring.
+ */
+static uint32_t sendRecord(uint32_t pos)
+{
+  tlog_record_t r;
+  r.len = ring.data[pos & RING_MASK];
+  for (uint32_t i = 0; i < r.len; ++i)
+  {
+    r.data[i] = ring.data[(pos + 1 + i) & RING_MASK];
+  }
+  sendFrame(r.data, r.len);
+  return r.len + 1;
+} // end sendRecord
+
+/* Sends a record that is not stored in the ring.
+ */
+static void sendMarker(uint32_t id)
+{
+  tlog_record_t r;
+  tlogStart(r, id);
+  tlogPutArg(r, ring.wakes);
+  sendFrame(r.data, r.len);
+  return;
+} // end sendMarker
+
+/* Sends records over the serial port and waits until they are out, call
+ * before deep sleep. If the host requested a dump, all records in the ring
+ * are sent, else those not sent yet.
+ */
+void tlogFlush()
+{
+  bool dump = false;
+  while (Serial.available() > 0)
+  {
+    dump |= Serial.read() == TLOG_DUMP_REQUEST;
+  }
+
+  portENTER_CRITICAL(&ringLock);
+  const uint32_t head = ring.head;
+  portEXIT_CRITICAL(&ringLock);
+  if (dump)
+  {
+    sendMarker(TLOG_ID_DUMP_BEGIN);
+    for (uint32_t pos = ring.tail; pos != head; )
+    {
+      pos += sendRecord(pos);
+    }
+    sendMarker(TLOG_ID_DUMP_END);
+    ring.sent = head;
+  }
+  else
+  {
+    while (ring.sent != head)
+    {
+      ring.sent += sendRecord(ring.sent);
+    }
+  }
+  Serial.flush();
+  return;
+} // end tlogFlush
+
+#else
+
+void tlogBegin()
+{
+  return;
+} // end tlogBegin
+
+void tlogFlush()
+{
+  Serial.flush();
+  return;
+} // end tlogFlush
+
+#endif
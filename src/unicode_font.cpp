@@ -0,0 +1,394 @@
+/* Unicode bitmap fonts for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Like asset_index.cpp this file has no Arduino or ESP-IDF dependencies, so
+// lookups and decoding can be checked and timed on the host.
+
+#ifdef UNICODE_FONT
+
+#include <cstring>
+
+#include "unicode_font.h"
+
+// Glyph metrics are looked up for measuring and again for drawing, so recent
+// lookups are kept in a direct-mapped cache (misses included).
+static const int METRICS_CACHE_BITS    = 6;
+static const int METRICS_CACHE_ENTRIES = 1 << METRICS_CACHE_BITS;
+// Decoded bitmaps are kept in an LRU cache that holds the distinct characters
+// of a typical alert (6.7 kB), the display is drawn in pages and every page
+// draws all of the text again.
+static const int GLYPH_CACHE_ENTRIES   = 48;
+
+typedef struct metrics_cache_entry
+{
+  const unicode_font_t      *font;
+  uint32_t                   codepoint;
+  const asset_ufont_glyph_t *glyph;
+} metrics_cache_entry_t;
+
+typedef struct glyph_cache_entry
+{
+  const unicode_font_t *font;
+  uint32_t              codepoint;
+  uint32_t              lastUse;
+  uint8_t               bitmap[UFONT_MAX_GLYPH_BYTES];
+} glyph_cache_entry_t;
+
+static metrics_cache_entry_t metricsCache[METRICS_CACHE_ENTRIES] = {};
+static glyph_cache_entry_t glyphCache[GLYPH_CACHE_ENTRIES] = {};
+static uint32_t glyphCacheClock = 0;
+
+/* Sets up a view of an ASSET_UNICODE_FONT blob and checks that its tables lie
+ * within the blob.
+ *
+ * Returns false if the blob is corrupt.
+ */
+bool parseUnicodeFont(const uint8_t *blob, uint32_t length,
+                      unicode_font_t &font)
+{
+  if (length < sizeof(asset_unicode_font_t))
+  {
+    return false;
+  }
+  const asset_unicode_font_t *h =
+    reinterpret_cast<const asset_unicode_font_t *>(blob);
+  if (h->range_offset % 4 != 0
+   || h->range_offset > length
+   || h->num_ranges > (length - h->range_offset)
+                      / sizeof(asset_ufont_range_t)
+   || h->glyph_offset > length
+   || h->num_glyphs > (length - h->glyph_offset)
+                      / sizeof(asset_ufont_glyph_t)
+   || h->data_offset > length
+   || h->data_size > length - h->data_offset)
+  {
+    return false;
+  }
+
+  const asset_ufont_range_t *ranges =
+    reinterpret_cast<const asset_ufont_range_t *>(blob + h->range_offset);
+  for (uint16_t i = 0; i < h->num_ranges; ++i)
+  {
+    if (ranges[i].glyph + ranges[i].count > h->num_glyphs
+     || (i > 0 && ranges[i].first
+                  < ranges[i - 1].first + ranges[i - 1].count))
+    {
+      return false;
+    }
+  }
+
+  font.header = h;
+  font.ranges = ranges;
+  font.glyphs =
+    reinterpret_cast<const asset_ufont_glyph_t *>(blob + h->glyph_offset);
+  font.data   = blob + h->data_offset;
+  return true;
+} // end parseUnicodeFont
+
+/* Finds the glyph of a code point by binary search over the ranges.
+ *
+ * Returns nullptr if the font has no such glyph.
+ */
+const asset_ufont_glyph_t *findUnicodeGlyph(const unicode_font_t &font,
+                                            uint32_t codepoint)
+{
+  int lo = 0;
+  int hi = static_cast<int>(font.header->num_ranges) - 1;
+  while (lo <= hi)
+  {
+    const int mid = (lo + hi) / 2;
+    const asset_ufont_range_t &r = font.ranges[mid];
+    if (codepoint < r.first)
+    {
+      hi = mid - 1;
+    }
+    else if (codepoint - r.first >= r.count)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      return &font.glyphs[r.glyph + (codepoint - r.first)];
+    }
+  }
+  return nullptr;
+} // end findUnicodeGlyph
+
+/* Returns the glyph of a code point like findUnicodeGlyph, through the
+ * metrics cache.
+ */
+const asset_ufont_glyph_t *getUnicodeGlyph(const unicode_font_t &font,
+                                           uint32_t codepoint)
+{
+  // Fibonacci hashing, neighbouring code points land in different slots
+  metrics_cache_entry_t &e =
+    metricsCache[(codepoint * 2654435761u) >> (32 - METRICS_CACHE_BITS)];
+  if (e.font != &font || e.codepoint != codepoint)
+  {
+    e.font      = &font;
+    e.codepoint = codepoint;
+    e.glyph     = findUnicodeGlyph(font, codepoint);
+  }
+  return e.glyph;
+} // end getUnicodeGlyph
+
+/* Returns the next nibble of a run-length encoded bitmap, or -1 past the end
+ * of the font data.
+ */
+static inline int readNibble(const uint8_t *src, uint32_t avail,
+                             uint32_t &nibble)
+{
+  const uint32_t i = nibble++;
+  if ((i >> 1) >= avail)
+  {
+    return -1;
+  }
+  return (i & 1) ? (src[i >> 1] & 0x0f) : (src[i >> 1] >> 4);
+} // end readNibble
+
+/* Decodes the bitmap of a glyph into dst, one row per (width + 7) / 8 bytes as
+ * expected by Adafruit_GFX::drawBitmap.
+ *
+ * Run-length encoded bitmaps are a sequence of runs alternating between paper
+ * and ink, starting with paper. Each run is stored in 4-bit nibbles (high
+ * nibble first) that are summed up as long as they are 15, so a run of 15 is
+ * stored as 15, 0.
+ *
+ * Returns false if the glyph is too large or its data is corrupt.
+ */
+static bool decodeGlyph(const unicode_font_t &font,
+                        const asset_ufont_glyph_t &g, uint8_t *dst)
+{
+  const uint32_t word = g.offset[0] | (g.offset[1] << 8)
+                        | (static_cast<uint32_t>(g.offset[2]) << 16);
+  const uint32_t offset = word & UFONT_GLYPH_OFFSET_MASK;
+  const uint32_t rowBytes = (g.width + 7) / 8;
+  const uint32_t total = static_cast<uint32_t>(g.width) * g.height;
+  if (rowBytes * g.height > UFONT_MAX_GLYPH_BYTES
+   || offset > font.header->data_size)
+  {
+    return false;
+  }
+  const uint8_t *src = font.data + offset;
+  const uint32_t avail = font.header->data_size - offset;
+  memset(dst, 0, rowBytes * g.height);
+
+  if (!(word & UFONT_GLYPH_RLE))
+  {
+    if ((total + 7) / 8 > avail)
+    {
+      return false;
+    }
+    uint32_t i = 0;
+    for (uint8_t y = 0; y < g.height; ++y)
+    {
+      uint8_t *row = dst + y * rowBytes;
+      for (uint8_t x = 0; x < g.width; ++x, ++i)
+      {
+        if (src[i >> 3] & (0x80 >> (i & 7)))
+        {
+          row[x >> 3] |= 0x80 >> (x & 7);
+        }
+      }
+    }
+    return true;
+  }
+
+  uint32_t nibble = 0;
+  uint32_t pos = 0;
+  uint8_t x = 0;
+  uint8_t y = 0;
+  bool ink = false;
+  while (pos < total)
+  {
+    uint32_t run = 0;
+    int n;
+    do
+    {
+      n = readNibble(src, avail, nibble);
+      if (n < 0)
+      {
+        return false;
+      }
+      run += n;
+    } while (n == 15);
+    if (run > total - pos)
+    {
+      return false;
+    }
+    pos += run;
+    while (run > 0)
+    {
+      const uint32_t span = run < static_cast<uint32_t>(g.width - x)
+                            ? run : g.width - x;
+      if (ink)
+      {
+        uint8_t *row = dst + y * rowBytes;
+        for (uint32_t i = x; i < x + span; ++i)
+        {
+          row[i >> 3] |= 0x80 >> (i & 7);
+        }
+      }
+      x += span;
+      run -= span;
+      if (x == g.width)
+      {
+        x = 0;
+        ++y;
+      }
+    }
+    ink = !ink;
+  }
+  return true;
+} // end decodeGlyph
+
+/* Returns the decoded bitmap of a code point (see decodeGlyph) and sets glyph
+ * to its metrics. The pointer stays valid until GLYPH_CACHE_ENTRIES other
+ * glyphs have been decoded.
+ *
+ * Returns nullptr if the font has no such glyph or it can not be decoded.
+ */
+const uint8_t *getUnicodeGlyphBitmap(const unicode_font_t &font,
+                                     uint32_t codepoint,
+                                     const asset_ufont_glyph_t **glyph)
+{
+  const asset_ufont_glyph_t *g = getUnicodeGlyph(font, codepoint);
+  if (glyph != nullptr)
+  {
+    *glyph = g;
+  }
+  if (g == nullptr)
+  {
+    return nullptr;
+  }
+
+  glyph_cache_entry_t *victim = &glyphCache[0];
+  for (glyph_cache_entry_t &e : glyphCache)
+  {
+    if (e.font == &font && e.codepoint == codepoint)
+    {
+      e.lastUse = ++glyphCacheClock;
+      return e.bitmap;
+    }
+    if (e.lastUse < victim->lastUse)
+    {
+      victim = &e;
+    }
+  }
+
+  if (!decodeGlyph(font, *g, victim->bitmap))
+  {
+    victim->font = nullptr;
+    victim->lastUse = 0;
+    return nullptr;
+  }
+  victim->font      = &font;
+  victim->codepoint = codepoint;
+  victim->lastUse   = ++glyphCacheClock;
+  return victim->bitmap;
+} // end getUnicodeGlyphBitmap
+
+/* Forgets all cached glyphs, e.g. after the asset partition was remapped.
+ */
+void clearUnicodeGlyphCache()
+{
+  memset(metricsCache, 0, sizeof(metricsCache));
+  memset(glyphCache, 0, sizeof(glyphCache));
+  glyphCacheClock = 0;
+  return;
+} // end clearUnicodeGlyphCache
+
+/* Decodes the UTF-8 character at p and advances p past it. Overlong
+ * encodings, surrogates and truncated sequences are rejected.
+ *
+ * Returns the code point, or UTF8_INVALID (p advanced by one byte).
+ */
+uint32_t nextUtf8Char(const char *&p, const char *end)
+{
+  const uint8_t c = static_cast<uint8_t>(*p++);
+  if (c < 0x80)
+  {
+    return c;
+  }
+  int len;
+  uint32_t cp;
+  uint32_t min;
+  if ((c & 0xe0) == 0xc0)
+  {
+    len = 1;
+    cp = c & 0x1f;
+    min = 0x80;
+  }
+  else if ((c & 0xf0) == 0xe0)
+  {
+    len = 2;
+    cp = c & 0x0f;
+    min = 0x800;
+  }
+  else if ((c & 0xf8) == 0xf0)
+  {
+    len = 3;
+    cp = c & 0x07;
+    min = 0x10000;
+  }
+  else
+  {
+    return UTF8_INVALID;
+  }
+  if (end - p < len)
+  {
+    return UTF8_INVALID;
+  }
+  for (int i = 0; i < len; ++i)
+  {
+    const uint8_t cc = static_cast<uint8_t>(p[i]);
+    if ((cc & 0xc0) != 0x80)
+    {
+      return UTF8_INVALID;
+    }
+    cp = (cp << 6) | (cc & 0x3f);
+  }
+  if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+  {
+    return UTF8_INVALID;
+  }
+  p += len;
+  return cp;
+} // end nextUtf8Char
+
+/* Returns true if s is valid UTF-8 that contains at least one non-ASCII
+ * character. Other text is drawn byte by byte as ISO-8859-1, which is how the
+ * locale files encode their strings.
+ */
+bool isUtf8Text(const char *s, size_t len)
+{
+  const char *p = s;
+  const char *end = s + len;
+  bool multibyte = false;
+  while (p < end)
+  {
+    const uint32_t cp = nextUtf8Char(p, end);
+    if (cp == UTF8_INVALID)
+    {
+      return false;
+    }
+    multibyte |= cp >= 0x80;
+  }
+  return multibyte;
+} // end isUtf8Text
+
+#endif // UNICODE_FONT
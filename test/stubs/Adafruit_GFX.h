@@ -0,0 +1,457 @@
+/* Host stand-in for Adafruit_GFX used by the unit tests.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_ADAFRUIT_GFX_H__
+#define __TEST_STUB_ADAFRUIT_GFX_H__
+
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+#include <Arduino.h>
+
+typedef struct
+{
+  uint16_t bitmapOffset;
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+} GFXglyph;
+
+typedef struct
+{
+  uint8_t  *bitmap;
+  GFXglyph *glyph;
+  uint16_t  first;
+  uint16_t  last;
+  uint8_t   yAdvance;
+} GFXfont;
+
+/* The virtual drawing interface of Adafruit_GFX 1.11, with the same default
+ * implementations (lines are the same Bresenham walk), so the pixels drawn on
+ * the host match the firmware. Text is only rendered in GFX fonts, the
+ * built-in 5x7 font only advances the cursor.
+ */
+class Adafruit_GFX
+{
+public:
+  Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h)
+  {}
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color)
+  {
+    drawPixel(x, y, color);
+  }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color)
+  {
+    fillRect(x, y, w, h, color);
+  }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+  {
+    drawFastVLine(x, y, h, color);
+  }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+  {
+    drawFastHLine(x, y, w, color);
+  }
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         uint16_t color)
+  {
+    const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    if (steep)
+    {
+      std::swap(x0, y0);
+      std::swap(x1, y1);
+    }
+    if (x0 > x1)
+    {
+      std::swap(x0, x1);
+      std::swap(y0, y1);
+    }
+    const int16_t dx = x1 - x0;
+    const int16_t dy = std::abs(y1 - y0);
+    int16_t err = dx / 2;
+    const int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++)
+    {
+      if (steep)
+      {
+        writePixel(y0, x0, color);
+      }
+      else
+      {
+        writePixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0)
+      {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+  virtual void endWrite() {}
+
+  virtual void setRotation(uint8_t r)
+  {
+    rotation = r & 3;
+    _width = (rotation & 1) ? HEIGHT : WIDTH;
+    _height = (rotation & 1) ? WIDTH : HEIGHT;
+  }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+  {
+    startWrite();
+    writeLine(x, y, x, y + h - 1, color);
+    endWrite();
+  }
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+  {
+    startWrite();
+    writeLine(x, y, x + w - 1, y, color);
+    endWrite();
+  }
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color)
+  {
+    startWrite();
+    for (int16_t i = x; i < x + w; i++)
+    {
+      writeFastVLine(i, y, h, color);
+    }
+    endWrite();
+  }
+  virtual void fillScreen(uint16_t color)
+  {
+    fillRect(0, 0, _width, _height, color);
+  }
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                        uint16_t color)
+  {
+    if (x0 == x1)
+    {
+      if (y0 > y1)
+      {
+        std::swap(y0, y1);
+      }
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    }
+    else if (y0 == y1)
+    {
+      if (x0 > x1)
+      {
+        std::swap(x0, x1);
+      }
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    }
+    else
+    {
+      startWrite();
+      writeLine(x0, y0, x1, y1, color);
+      endWrite();
+    }
+  }
+  // Not virtual, as in Adafruit_GFX 1.11.9. Only GFX fonts are rendered, the
+  // glyphs are drawn with writePixel/writeFillRect like the library does.
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y)
+  {
+    if (gfxFont == nullptr || c < gfxFont->first || c > gfxFont->last)
+    {
+      return;
+    }
+    const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+    uint16_t bo = g.bitmapOffset;
+    const int16_t xo16 = (size_x > 1 || size_y > 1) ? g.xOffset : 0;
+    const int16_t yo16 = (size_x > 1 || size_y > 1) ? g.yOffset : 0;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    startWrite();
+    for (uint8_t yy = 0; yy < g.height; yy++)
+    {
+      for (uint8_t xx = 0; xx < g.width; xx++)
+      {
+        if (!(bit++ & 7))
+        {
+          bits = gfxFont->bitmap[bo++];
+        }
+        if (bits & 0x80)
+        {
+          if (size_x == 1 && size_y == 1)
+          {
+            writePixel(x + g.xOffset + xx, y + g.yOffset + yy, color);
+          }
+          else
+          {
+            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
+                          size_x, size_y, color);
+          }
+        }
+        bits <<= 1;
+      }
+    }
+    endWrite();
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color)
+  {
+    const int16_t byteWidth = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++)
+    {
+      for (int16_t i = 0; i < w; i++)
+      {
+        if (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7)))
+        {
+          writePixel(x + i, y + j, color);
+        }
+      }
+    }
+  }
+
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color)
+  {
+    // sort by y (y2 >= y1 >= y0)
+    if (y0 > y1)
+    {
+      std::swap(y0, y1);
+      std::swap(x0, x1);
+    }
+    if (y1 > y2)
+    {
+      std::swap(y2, y1);
+      std::swap(x2, x1);
+    }
+    if (y0 > y1)
+    {
+      std::swap(y0, y1);
+      std::swap(x0, x1);
+    }
+    startWrite();
+    int16_t a, b, y, last;
+    if (y0 == y2)
+    {
+      a = b = x0;
+      if (x1 < a) a = x1; else if (x1 > b) b = x1;
+      if (x2 < a) a = x2; else if (x2 > b) b = x2;
+      writeFastHLine(a, y0, b - a + 1, color);
+      endWrite();
+      return;
+    }
+    const int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0,
+                  dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+    last = (y1 == y2) ? y1 : y1 - 1;
+    for (y = y0; y <= last; y++)
+    {
+      a = x0 + sa / dy01;
+      b = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if (a > b)
+      {
+        std::swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+    sa = static_cast<int32_t>(dx12) * (y - y1);
+    sb = static_cast<int32_t>(dx02) * (y - y0);
+    for (; y <= y2; y++)
+    {
+      a = x1 + sa / dy12;
+      b = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if (a > b)
+      {
+        std::swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+    endWrite();
+  }
+
+  // Text, as Adafruit_GFX and Print implement it for GFX fonts.
+  void setFont(const GFXfont *f = nullptr)
+  {
+    if (f != nullptr && gfxFont == nullptr)
+    {
+      cursor_y += 6;
+    }
+    else if (f == nullptr && gfxFont != nullptr)
+    {
+      cursor_y -= 6;
+    }
+    gfxFont = const_cast<GFXfont *>(f);
+  }
+  void setCursor(int16_t x, int16_t y)
+  {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg)
+  {
+    textcolor = c;
+    textbgcolor = bg;
+  }
+  void setTextSize(uint8_t s) { setTextSize(s, s); }
+  void setTextSize(uint8_t sx, uint8_t sy)
+  {
+    textsize_x = sx > 0 ? sx : 1;
+    textsize_y = sy > 0 ? sy : 1;
+  }
+  void setTextWrap(bool w) { wrap = w; }
+
+  virtual size_t write(uint8_t c)
+  {
+    if (gfxFont == nullptr)
+    {
+      cursor_x += 6 * textsize_x; // the built-in font is not drawn
+      return 1;
+    }
+    if (c == '\n')
+    {
+      cursor_x = 0;
+      cursor_y += textsize_y * gfxFont->yAdvance;
+    }
+    else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last)
+    {
+      const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+      if (g.width > 0 && g.height > 0)
+      {
+        if (wrap && cursor_x + textsize_x * (g.xOffset + g.width) > _width)
+        {
+          cursor_x = 0;
+          cursor_y += textsize_y * gfxFont->yAdvance;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+                 textsize_y);
+      }
+      cursor_x += g.xAdvance * textsize_x;
+    }
+    return 1;
+  }
+  size_t print(const char *str)
+  {
+    size_t n = 0;
+    while (*str)
+    {
+      n += write(static_cast<uint8_t>(*str++));
+    }
+    return n;
+  }
+  size_t print(const String &str) { return print(str.c_str()); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(int v) { return print(String(v)); }
+
+  void getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1,
+                     int16_t *y1, uint16_t *w, uint16_t *h)
+  {
+    int16_t minx = 0x7fff, miny = 0x7fff, maxx = -1, maxy = -1;
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    uint8_t c;
+    while ((c = *str++))
+    {
+      charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    }
+    if (maxx >= minx)
+    {
+      *x1 = minx;
+      *w = maxx - minx + 1;
+    }
+    if (maxy >= miny)
+    {
+      *y1 = miny;
+      *h = maxy - miny + 1;
+    }
+  }
+  void getTextBounds(const String &str, int16_t x, int16_t y, int16_t *x1,
+                     int16_t *y1, uint16_t *w, uint16_t *h)
+  {
+    getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+  }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return rotation; }
+
+protected:
+  void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
+                  int16_t *miny, int16_t *maxx, int16_t *maxy)
+  {
+    if (gfxFont == nullptr)
+    {
+      *x += 6 * textsize_x;
+      return;
+    }
+    if (c == '\n')
+    {
+      *x = 0;
+      *y += textsize_y * gfxFont->yAdvance;
+      return;
+    }
+    if (c == '\r' || c < gfxFont->first || c > gfxFont->last)
+    {
+      return;
+    }
+    const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+    if (wrap && *x + (g.xOffset + g.width) * textsize_x > _width)
+    {
+      *x = 0;
+      *y += textsize_y * gfxFont->yAdvance;
+    }
+    const int16_t x1 = *x + g.xOffset * textsize_x;
+    const int16_t y1 = *y + g.yOffset * textsize_y;
+    const int16_t x2 = x1 + g.width * textsize_x - 1;
+    const int16_t y2 = y1 + g.height * textsize_y - 1;
+    if (x1 < *minx) *minx = x1;
+    if (y1 < *miny) *miny = y1;
+    if (x2 > *maxx) *maxx = x2;
+    if (y2 > *maxy) *maxy = y2;
+    *x += g.xAdvance * textsize_x;
+  }
+
+  int16_t  WIDTH;
+  int16_t  HEIGHT;
+  int16_t  _width;
+  int16_t  _height;
+  uint8_t  rotation = 0;
+  GFXfont *gfxFont = nullptr;
+  int16_t  cursor_x = 0;
+  int16_t  cursor_y = 0;
+  uint16_t textcolor = 0xffff;
+  uint16_t textbgcolor = 0xffff;
+  uint8_t  textsize_x = 1;
+  uint8_t  textsize_y = 1;
+  bool     wrap = true;
+};
+
+#endif
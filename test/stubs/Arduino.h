@@ -0,0 +1,365 @@
+/* Host stand-in for the parts of the Arduino core used by the unit tests.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_ARDUINO_H__
+#define __TEST_STUB_ARDUINO_H__
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <driver/gpio.h>
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define LOW  0x0
+#define HIGH 0x1
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_ptr(addr)   (*reinterpret_cast<void *const *>(addr))
+
+using std::max;
+using std::min;
+
+inline unsigned long micros()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+    std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count());
+}
+
+inline unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+inline void delay(unsigned long ms)
+{
+  (void)ms;
+}
+
+#define INPUT  0x01
+#define OUTPUT 0x03
+
+#define LED_BUILTIN 2
+
+inline int toUpperCase(int c) { return std::toupper(c); }
+inline int toLowerCase(int c) { return std::tolower(c); }
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t val) {}
+uint16_t analogRead(uint8_t pin);
+
+/* dtostrf() of the ESP32 Arduino core, which String(float) uses. The integer
+ * part is padded with spaces to width and the value is rounded half up.
+ */
+inline char *dtostrf(double number, signed int width, unsigned int prec,
+                     char *s)
+{
+  if (std::isnan(number))
+  {
+    strcpy(s, "nan");
+    return s;
+  }
+  if (std::isinf(number))
+  {
+    strcpy(s, "inf");
+    return s;
+  }
+  char *out = s;
+  int fillme = width;
+  if (prec > 0)
+  {
+    fillme -= prec + 1;
+  }
+  bool negative = false;
+  if (number < 0.0)
+  {
+    negative = true;
+    fillme--;
+    number = -number;
+  }
+  double rounding = 2.0;
+  for (unsigned int i = 0; i < prec; ++i)
+  {
+    rounding *= 10.0;
+  }
+  number += 1.0 / rounding;
+  double tenpow = 1.0;
+  int digitcount = 1;
+  while (number >= 10.0 * tenpow)
+  {
+    tenpow *= 10.0;
+    digitcount++;
+  }
+  number /= tenpow;
+  fillme -= digitcount;
+  while (fillme-- > 0)
+  {
+    *out++ = ' ';
+  }
+  if (negative)
+  {
+    *out++ = '-';
+  }
+  digitcount += prec;
+  while (digitcount-- > 0)
+  {
+    int digit = static_cast<int>(number);
+    if (digit > 9)
+    {
+      digit = 9;
+    }
+    *out++ = static_cast<char>('0' | digit);
+    if (digitcount == static_cast<int>(prec) && prec > 0)
+    {
+      *out++ = '.';
+    }
+    number -= digit;
+    number *= 10.0;
+  }
+  *out = 0;
+  return s;
+}
+
+/* The parts of Arduino's String used by the code under test, with the same
+ * semantics (indices are bytes, out of range arguments are clamped).
+ */
+class String
+{
+public:
+  String(const char *s = "") : _s(s ? s : "") {}
+  String(const std::string &s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v, unsigned char base = 10) : _s(toBase(v, base)) {}
+  explicit String(unsigned v, unsigned char base = 10)
+    : _s(toBase(v, base)) {}
+  explicit String(long v, unsigned char base = 10) : _s(toBase(v, base)) {}
+  explicit String(unsigned long v, unsigned char base = 10)
+    : _s(toBase(v, base)) {}
+  explicit String(float v, unsigned int decimals = 2)
+    : String(static_cast<double>(v), decimals) {}
+  explicit String(double v, unsigned int decimals = 2)
+  {
+    char buf[64];
+    _s = dtostrf(v, decimals + 2, decimals, buf);
+  }
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  char charAt(unsigned i) const { return i < _s.length() ? _s[i] : 0; }
+  char operator[](unsigned i) const { return charAt(i); }
+  void setCharAt(unsigned i, char c) { if (i < _s.length()) _s[i] = c; }
+
+  int indexOf(char c, unsigned from = 0) const
+  {
+    return find(_s.find(c, from));
+  }
+  int indexOf(const String &t, unsigned from = 0) const
+  {
+    return find(_s.find(t._s, from));
+  }
+  int lastIndexOf(char c) const { return find(_s.rfind(c)); }
+  int lastIndexOf(const String &t) const { return find(_s.rfind(t._s)); }
+
+  String substring(unsigned begin) const
+  {
+    return substring(begin, _s.length());
+  }
+  String substring(unsigned begin, unsigned end) const
+  {
+    if (begin > end)
+    {
+      std::swap(begin, end);
+    }
+    end = std::min<unsigned>(end, _s.length());
+    if (begin >= end)
+    {
+      return String();
+    }
+    return String(_s.substr(begin, end - begin));
+  }
+  void remove(unsigned index)
+  {
+    remove(index, static_cast<unsigned>(-1));
+  }
+  void remove(unsigned index, unsigned count)
+  {
+    if (index < _s.length())
+    {
+      _s.erase(index, count);
+    }
+  }
+  void replace(const String &from, const String &to)
+  {
+    if (from._s.empty())
+    {
+      return;
+    }
+    size_t pos = 0;
+    while ((pos = _s.find(from._s, pos)) != std::string::npos)
+    {
+      _s.replace(pos, from._s.length(), to._s);
+      pos += to._s.length();
+    }
+  }
+  void trim()
+  {
+    const size_t b = _s.find_first_not_of(" \t\r\n\f\v");
+    const size_t e = _s.find_last_not_of(" \t\r\n\f\v");
+    _s = b == std::string::npos ? std::string() : _s.substr(b, e - b + 1);
+  }
+  void toUpperCase()
+  {
+    for (char &c : _s)
+    {
+      c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+  }
+  void toLowerCase()
+  {
+    for (char &c : _s)
+    {
+      c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+  }
+  bool startsWith(const String &t) const { return _s.rfind(t._s, 0) == 0; }
+  bool endsWith(const String &t) const
+  {
+    return _s.length() >= t._s.length()
+           && _s.compare(_s.length() - t._s.length(), t._s.length(), t._s)
+              == 0;
+  }
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return static_cast<float>(atof(_s.c_str())); }
+
+  String &operator+=(const String &o) { _s += o._s; return *this; }
+  String &operator+=(const char *o) { _s += o; return *this; }
+  String &operator+=(char c) { _s += c; return *this; }
+  String &operator+=(int v) { return *this += String(v); }
+  String operator+(const String &o) const { return String(_s + o._s); }
+  String operator+(const char *o) const { return String(_s + o); }
+  String operator+(char c) const { return String(_s + c); }
+  String operator+(int v) const { return *this + String(v); }
+  String operator+(unsigned v) const { return *this + String(v); }
+  String operator+(long v) const { return *this + String(v); }
+  String operator+(unsigned long v) const { return *this + String(v); }
+  String operator+(float v) const { return *this + String(v); }
+  String operator+(double v) const { return *this + String(v); }
+  friend String operator+(const char *a, const String &b)
+  {
+    return String(std::string(a) + b._s);
+  }
+  bool operator==(const String &o) const { return _s == o._s; }
+  bool operator!=(const String &o) const { return _s != o._s; }
+  bool operator<(const String &o) const { return _s < o._s; }
+  bool equals(const String &o) const { return _s == o._s; }
+
+private:
+  std::string _s;
+
+  static int find(size_t pos)
+  {
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+
+  template <typename T>
+  static std::string toBase(T v, unsigned char base)
+  {
+    if (base == 10)
+    {
+      return std::to_string(v);
+    }
+    char buf[72];
+    char *p = buf + sizeof(buf) - 1;
+    *p = 0;
+    bool negative = v < 0;
+    unsigned long long u = negative ? 0ULL - static_cast<unsigned long long>(v)
+                                    : static_cast<unsigned long long>(v);
+    do
+    {
+      const int d = u % base;
+      *--p = static_cast<char>(d < 10 ? '0' + d : 'a' + d - 10);
+      u /= base;
+    } while (u != 0);
+    if (negative)
+    {
+      *--p = '-';
+    }
+    return p;
+  }
+};
+
+/* Serial port that keeps everything written to it in output, and returns the
+ * bytes queued in input from read().
+ */
+class HostSerial
+{
+public:
+  std::string output;
+  std::string input;
+
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(const uint8_t *p, size_t n)
+  {
+    output.append(reinterpret_cast<const char *>(p), n);
+    return n;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t print(const char *s) { output += s; return strlen(s); }
+  size_t print(const String &s) { return print(s.c_str()); }
+  size_t println(const char *s = "") { print(s); output += "\r\n"; return 0; }
+  size_t println(const String &s) { return println(s.c_str()); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    output += buf;
+    return n;
+  }
+  int available() { return static_cast<int>(input.size()); }
+  int read()
+  {
+    if (input.empty())
+    {
+      return -1;
+    }
+    const int c = static_cast<uint8_t>(input[0]);
+    input.erase(0, 1);
+    return c;
+  }
+  void flush() {}
+};
+
+inline HostSerial Serial;
+
+#endif
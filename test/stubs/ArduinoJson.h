@@ -0,0 +1,42 @@
+/* Host stand-in for the ArduinoJson types in the headers used by the tests.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_ARDUINOJSON_H__
+#define __TEST_STUB_ARDUINOJSON_H__
+
+class DeserializationError
+{
+public:
+  enum Code
+  {
+    Ok,
+    EmptyInput,
+    IncompleteInput,
+    InvalidInput,
+    NoMemory,
+    TooDeep
+  };
+
+  DeserializationError(Code c = Ok) : _code(c) {}
+  explicit operator bool() const { return _code != Ok; }
+  Code code() const { return _code; }
+
+private:
+  Code _code;
+};
+
+#endif
@@ -0,0 +1,33 @@
+/* Host stand-in for the GxEPD2 color constants used by the unit tests.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_GXEPD2_H__
+#define __TEST_STUB_GXEPD2_H__
+
+#include <SPI.h>
+
+#define GxEPD_BLACK     0x0000
+#define GxEPD_DARKGREY  0x7BEF
+#define GxEPD_LIGHTGREY 0xC618
+#define GxEPD_WHITE     0xFFFF
+#define GxEPD_RED       0xF800
+#define GxEPD_YELLOW    0xFFE0
+#define GxEPD_GREEN     0x07E0
+#define GxEPD_BLUE      0x001F
+#define GxEPD_ORANGE    0xFC00
+
+#endif
@@ -0,0 +1,48 @@
+/* Host stand-in for the ESP-IDF ADC driver, defined by the tests.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_DRIVER_ADC_H__
+#define __TEST_STUB_DRIVER_ADC_H__
+
+typedef enum
+{
+  ADC_UNIT_1 = 1,
+  ADC_UNIT_2 = 2
+} adc_unit_t;
+
+typedef enum
+{
+  ADC_ATTEN_DB_0   = 0,
+  ADC_ATTEN_DB_2_5 = 1,
+  ADC_ATTEN_DB_6   = 2,
+  ADC_ATTEN_DB_11  = 3
+} adc_atten_t;
+
+#define ADC_ATTEN_11db ADC_ATTEN_DB_11
+
+typedef enum
+{
+  ADC_WIDTH_BIT_9  = 0,
+  ADC_WIDTH_BIT_10 = 1,
+  ADC_WIDTH_BIT_11 = 2,
+  ADC_WIDTH_BIT_12 = 3
+} adc_bits_width_t;
+
+void adc_power_acquire(void);
+void adc_power_release(void);
+
+#endif
@@ -0,0 +1,82 @@
+/* Host stand-in for the FreeRTOS queues, semaphores and tasks (std::thread).
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_FREERTOS_H__
+#define __TEST_STUB_FREERTOS_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+
+#define pdFALSE       0
+#define pdTRUE        1
+#define pdPASS        pdTRUE
+#define pdFAIL        pdFALSE
+#define portMAX_DELAY 0xffffffffUL
+
+/* A bounded FIFO of fixed size items, also used for binary semaphores (one
+ * item of size 0). Only blocking forever (portMAX_DELAY) and not blocking at
+ * all (0 ticks) are supported.
+ */
+struct HostQueue
+{
+  std::mutex                        lock;
+  std::condition_variable           changed;
+  std::deque<std::vector<uint8_t>>  items;
+  UBaseType_t                       length;
+  UBaseType_t                       itemSize;
+
+  BaseType_t send(const void *item, TickType_t ticks)
+  {
+    std::unique_lock<std::mutex> l(lock);
+    if (ticks != portMAX_DELAY && items.size() >= length)
+    {
+      return pdFALSE;
+    }
+    changed.wait(l, [this] { return items.size() < length; });
+    const uint8_t *p = static_cast<const uint8_t *>(item);
+    items.emplace_back(p, p + itemSize);
+    changed.notify_all();
+    return pdTRUE;
+  }
+
+  BaseType_t receive(void *item, TickType_t ticks)
+  {
+    std::unique_lock<std::mutex> l(lock);
+    if (ticks != portMAX_DELAY && items.empty())
+    {
+      return pdFALSE;
+    }
+    changed.wait(l, [this] { return !items.empty(); });
+    if (item != nullptr)
+    {
+      memcpy(item, items.front().data(), itemSize);
+    }
+    items.pop_front();
+    changed.notify_all();
+    return pdTRUE;
+  }
+};
+
+#endif
@@ -0,0 +1,49 @@
+/* Host stand-in for the FreeRTOS queues, semaphores and tasks (std::thread).
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_FREERTOS_QUEUE_H__
+#define __TEST_STUB_FREERTOS_QUEUE_H__
+
+#include "FreeRTOS.h"
+
+typedef HostQueue *QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+  QueueHandle_t q = new HostQueue;
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void *item,
+                             TickType_t ticks)
+{
+  return q->send(item, ticks);
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+  return q->receive(item, ticks);
+}
+
+inline void vQueueDelete(QueueHandle_t q)
+{
+  delete q;
+}
+
+#endif
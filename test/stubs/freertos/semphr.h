@@ -0,0 +1,45 @@
+/* Host stand-in for the FreeRTOS queues, semaphores and tasks (std::thread).
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_FREERTOS_SEMPHR_H__
+#define __TEST_STUB_FREERTOS_SEMPHR_H__
+
+#include "queue.h"
+
+typedef HostQueue *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return xQueueCreate(1, 0);
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s)
+{
+  return s->send(nullptr, 0);
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks)
+{
+  return s->receive(nullptr, ticks);
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t s)
+{
+  delete s;
+}
+
+#endif
@@ -0,0 +1,59 @@
+/* Host stand-in for the FreeRTOS queues, semaphores and tasks (std::thread).
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TEST_STUB_FREERTOS_TASK_H__
+#define __TEST_STUB_FREERTOS_TASK_H__
+
+#include <thread>
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+typedef std::thread *TaskHandle_t;
+
+/* Runs the task on a detached thread, the core is ignored. Tasks that never
+ * return end with the test process.
+ */
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task,
+                                          const char *name,
+                                          uint32_t stackDepth, void *arg,
+                                          UBaseType_t priority,
+                                          TaskHandle_t *handle, BaseType_t core)
+{
+  std::thread *t = new std::thread(task, arg);
+  t->detach();
+  if (handle != nullptr)
+  {
+    *handle = t;
+  }
+  return pdPASS;
+}
+
+inline UBaseType_t uxTaskPriorityGet(TaskHandle_t task)
+{
+  return 1;
+}
+
+/* Only a task deleting itself is supported, its thread ends when the task
+ * function returns right after.
+ */
+inline void vTaskDelete(TaskHandle_t task)
+{
+  return;
+}
+
+#endif
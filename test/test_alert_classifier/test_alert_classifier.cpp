@@ -0,0 +1,289 @@
+/* Unit tests for the alert terminology matcher.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+
+#include "_locale.h"
+#include "alert_classifier.h"
+// the terminology and the tables generated from it by tools/alert_terms.py
+#include "locales/locale_en_US.inc"
+#include "locales/alert_terms_en_US.inc"
+
+const alert_matcher_t ALERT_MATCHER = {ALERT_TERM_NODES, ALERT_TERM_ROOT};
+
+// as in display_utils.cpp
+static const int ALERT_URGENCY_SHIFT = 24;
+static const uint32_t ALERT_CATEGORY_MASK = (1UL << ALERT_URGENCY_SHIFT) - 1;
+
+// in the order of enum alert_category
+static const std::vector<String> *const ALERT_TERMS[] = {
+  &TERM_SMOG, &TERM_SMOKE, &TERM_FOG, &TERM_METEOR, &TERM_NUCLEAR,
+  &TERM_BIOHAZARD, &TERM_EARTHQUAKE, &TERM_FIRE, &TERM_HEAT, &TERM_WINTER,
+  &TERM_TSUNAMI, &TERM_LIGHTNING, &TERM_SANDSTORM, &TERM_FLOOD, &TERM_VOLCANO,
+  &TERM_AIR_QUALITY, &TERM_TORNADO, &TERM_SMALL_CRAFT_ADVISORY,
+  &TERM_GALE_WARNING, &TERM_STORM_WARNING, &TERM_HURRICANE_WARNING,
+  &TERM_HURRICANE, &TERM_DUST, &TERM_STRONG_WIND
+};
+static const int NUM_CATEGORIES = sizeof(ALERT_TERMS) / sizeof(ALERT_TERMS[0]);
+
+typedef struct classification
+{
+  int category;  // NUM_CATEGORIES if none
+  int urgency;   // -1 if none
+} classification_t;
+
+static std::string lower(std::string s)
+{
+  for (char &c : s)
+  {
+    if (c >= 'A' && c <= 'Z')
+    {
+      c += 'a' - 'A';
+    }
+  }
+  return s;
+}
+
+/* The classification the firmware did before the matcher: the event name is
+ * lowercased, the category is the first whose terms are found in the part
+ * that is kept (head) and the urgency the last keyword found anywhere.
+ */
+static classification_t scanAlert(const std::string &event, size_t head)
+{
+  const std::string text = lower(event);
+  const std::string kept = text.substr(0, head);
+  classification_t c = {NUM_CATEGORIES, -1};
+  for (int i = 0; i < NUM_CATEGORIES && c.category == NUM_CATEGORIES; ++i)
+  {
+    for (const String &term : *ALERT_TERMS[i])
+    {
+      if (kept.find(term.c_str()) != std::string::npos)
+      {
+        c.category = i;
+        break;
+      }
+    }
+  }
+  for (size_t i = 0; i < ALERT_URGENCY.size(); ++i)
+  {
+    if (text.find(ALERT_URGENCY[i].c_str()) != std::string::npos)
+    {
+      c.urgency = i;
+    }
+  }
+  return c;
+}
+
+static classification_t matchAlert(const std::string &event, size_t head)
+{
+  const uint32_t found = matchAlertTerms(ALERT_MATCHER, event.c_str(),
+                                         event.size(), head,
+                                         ~ALERT_CATEGORY_MASK);
+  const uint32_t category = found & ALERT_CATEGORY_MASK;
+  const uint32_t urgency = found >> ALERT_URGENCY_SHIFT;
+  return {category ? __builtin_ctz(category) : NUM_CATEGORIES,
+          urgency ? 31 - __builtin_clz(urgency) : -1};
+}
+
+/* Random event names made of terms, urgency keywords, their fragments and
+ * filler words, in random case, sometimes followed by extra information.
+ */
+static std::vector<std::pair<std::string, size_t>> randomEvents(int n)
+{
+  std::vector<std::string> words = {"severe", "special", "marine", "coastal",
+                                    "areal", "excessive", "dense", "x", "",
+                                    "-", "for", "until"};
+  for (const std::vector<String> *terms : ALERT_TERMS)
+  {
+    for (const String &t : *terms)
+    {
+      const std::string s = t.c_str();
+      words.push_back(s);
+      words.push_back(s.substr(0, s.size() / 2));
+      words.push_back(s.substr(s.size() / 2));
+    }
+  }
+  for (const String &u : ALERT_URGENCY)
+  {
+    words.push_back(u.c_str());
+  }
+
+  std::mt19937 rng(2024);
+  std::vector<std::pair<std::string, size_t>> events;
+  for (int i = 0; i < n; ++i)
+  {
+    std::string event;
+    const int count = 1 + rng() % 4;
+    for (int w = 0; w < count; ++w)
+    {
+      event += words[rng() % words.size()];
+      event += rng() % 4 ? " " : "";
+    }
+    size_t head = event.size();
+    if (rng() % 3 == 0)
+    {
+      event += ", (" + words[rng() % words.size()] + " "
+               + words[rng() % words.size()] + ")";
+    }
+    for (char &c : event)
+    {
+      if (rng() % 5 == 0 && c >= 'a' && c <= 'z')
+      {
+        c -= 'a' - 'A';
+      }
+    }
+    events.push_back({event, head});
+  }
+  return events;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_known_events()
+{
+  struct
+  {
+    const char *event;
+    size_t      head;
+    int         category;
+    int         urgency;
+  } cases[] = {
+    {"Severe Thunderstorm Warning", 27, 11, 4},
+    {"Dense Fog Advisory", 18, 2, 3},
+    {"Winter Storm Watch", 18, 9, 2},
+    {"Wind Advisory, (gale expected)", 13, 17, 3},
+    {"Special Weather Statement", 25, NUM_CATEGORIES, 1},
+    {"Tornado Emergency", 17, 16, 5},
+    {"", 0, NUM_CATEGORIES, -1},
+  };
+  for (const auto &t : cases)
+  {
+    const classification_t c = matchAlert(t.event, t.head);
+    TEST_ASSERT_EQUAL_MESSAGE(t.category, c.category, t.event);
+    TEST_ASSERT_EQUAL_MESSAGE(t.urgency, c.urgency, t.event);
+  }
+}
+
+/* The generated tables classify like the substring scan over the locale's
+ * TERM_* vectors, so they are not out of date either.
+ */
+void test_matches_substring_scan()
+{
+  int mismatches = 0;
+  for (const auto &e : randomEvents(20000))
+  {
+    const classification_t a = scanAlert(e.first, e.second);
+    const classification_t b = matchAlert(e.first, e.second);
+    if (a.category != b.category || a.urgency != b.urgency)
+    {
+      if (mismatches++ == 0)
+      {
+        TEST_MESSAGE(e.first.c_str());
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+/* Terms that span the pieces of a streamed description are found.
+ */
+void test_feed_in_pieces()
+{
+  for (const auto &e : randomEvents(2000))
+  {
+    const std::string &text = e.first;
+    const uint32_t whole = matchAlertTerms(ALERT_MATCHER, text.c_str(),
+                                           text.size(), text.size(),
+                                           UINT32_MAX);
+    uint16_t state = ALERT_MATCHER_ROOT;
+    uint32_t fed = 0;
+    for (size_t i = 0; i < text.size(); i += 3)
+    {
+      fed |= feedAlertTerms(ALERT_MATCHER, state, text.c_str() + i,
+                            std::min<size_t>(3, text.size() - i));
+    }
+    TEST_ASSERT_EQUAL_HEX32(whole, fed);
+  }
+}
+
+/* Time per alert of the matcher and of the substring scan it replaced. The
+ * firmware scanned the categories twice (32 and 48 px icons) and the urgency
+ * keywords once per alert.
+ */
+void test_speed_against_substring_scan()
+{
+  const std::vector<std::pair<std::string, size_t>> events =
+    randomEvents(5000);
+  const int ROUNDS = 20;
+  int sum = 0;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < ROUNDS; ++r)
+  {
+    for (const auto &e : events)
+    {
+      const classification_t a = scanAlert(e.first, e.second);
+      const classification_t b = scanAlert(e.first, e.second);
+      sum += a.category + b.urgency;
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < ROUNDS; ++r)
+  {
+    for (const auto &e : events)
+    {
+      const classification_t c = matchAlert(e.first, e.second);
+      sum += c.category + c.urgency;
+    }
+  }
+  auto t2 = std::chrono::steady_clock::now();
+
+  const double n = static_cast<double>(ROUNDS) * events.size();
+  const double scan =
+    std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+  const double match =
+    std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+  char msg[96];
+  snprintf(msg, sizeof(msg),
+           "substring scan %.0f ns/alert, matcher %.0f ns/alert (%d)", scan,
+           match, sum & 1);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(match < scan);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_known_events);
+  RUN_TEST(test_matches_substring_scan);
+  RUN_TEST(test_feed_in_pieces);
+  RUN_TEST(test_speed_against_substring_scan);
+  return UNITY_END();
+}
@@ -0,0 +1,243 @@
+/* Unit tests for the streaming alerts parser.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unity.h>
+
+#include "alert_classifier.h"
+#include "alerts_parser.h"
+// alert_matcher_node_t tables generated by tools/alert_terms.py
+#include "locales/alert_terms_en_US.inc"
+
+static const alert_matcher_t MATCHER = {ALERT_TERM_NODES, ALERT_TERM_ROOT};
+// bits of enum alert_category
+static const uint32_t FOG   = 1UL << 2;
+static const uint32_t FLOOD = 1UL << 13;
+
+static owm_resp_alerts_t alerts;
+
+static alerts_parse_status_t parse(const std::string &json, size_t piece = 256)
+{
+  alerts_parser_t p;
+  initAlertsParser(p, alerts, &MATCHER);
+  alerts_parse_status_t status = ALERTS_PARSE_MORE;
+  for (size_t i = 0; i < json.size() && status == ALERTS_PARSE_MORE;
+       i += piece)
+  {
+    status = feedAlertsParser(p, json.data() + i,
+                              std::min(piece, json.size() - i));
+  }
+  return status;
+}
+
+static std::string alertJson(const std::string &event, int64_t start,
+                             const std::string &tag = "Flood",
+                             const std::string &description = "")
+{
+  return "{\"sender_name\":\"NWS\",\"event\":\"" + event + "\",\"start\":"
+         + std::to_string(start) + ",\"end\":1700009999,\"description\":\""
+         + description + "\",\"tags\":[\"" + tag + "\",\"Other\"]}";
+}
+
+static std::string response(const std::vector<std::string> &items)
+{
+  std::string json = "{\"lat\":33.44,\"lon\":-94.04,\"timezone\":\"X\","
+                     "\"current\":{\"alerts\":[{\"event\":\"decoy\"}]},"
+                     "\"alerts\":[";
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    json += (i ? "," : "") + items[i];
+  }
+  return json + "]}";
+}
+
+static const char *event(int i)
+{
+  return alerts.text + alerts.alert[i].event;
+}
+
+static const char *tags(int i)
+{
+  return alerts.text + alerts.alert[i].tags;
+}
+
+void setUp()
+{
+  alerts = owm_resp_alerts_t{};
+  memset(alerts.text, 0xa5, sizeof(alerts.text));
+}
+
+void tearDown()
+{
+}
+
+void test_reads_alert_fields()
+{
+  const std::string json = response({
+    alertJson("Flood Warning", 1700000000, "Flood",
+              "Rivers rise, \\\"high tides\\\" expected."),
+    alertJson("Dense Fog Advisory", -5, "Fog", "Visibility below 1 mile.")});
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(json));
+  TEST_ASSERT_EQUAL(2, alerts.count);
+  TEST_ASSERT_EQUAL_STRING("Flood Warning", event(0));
+  TEST_ASSERT_EQUAL_STRING("Flood", tags(0));
+  TEST_ASSERT_TRUE(alerts.alert[0].start == 1700000000);
+  TEST_ASSERT_EQUAL_HEX32(FLOOD, alerts.alert[0].description_terms & FLOOD);
+  TEST_ASSERT_EQUAL_STRING("Dense Fog Advisory", event(1));
+  TEST_ASSERT_EQUAL_STRING("Fog", tags(1));
+  TEST_ASSERT_TRUE(alerts.alert[1].start == -5);
+  TEST_ASSERT_EQUAL_HEX32(0, alerts.alert[1].description_terms & FOG);
+  TEST_ASSERT_FALSE(alerts.alert[0].summary.valid);
+}
+
+/* Pieces may end anywhere, also inside of escapes and terms.
+ */
+void test_pieces_of_any_size()
+{
+  const std::string json = response({
+    alertJson("Caf\\u00e9 \\ud83c\\udf0a Flood\\nWatch", 1, "Flo\\u00f6d",
+              "storm surge, high seas"),
+    alertJson("Heat Advisory", 2)});
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(json));
+  std::vector<std::string> expected;
+  for (int i = 0; i < alerts.count; ++i)
+  {
+    expected.push_back(std::string(event(i)) + "|" + tags(i) + "|"
+                       + std::to_string(alerts.alert[i].description_terms));
+  }
+  TEST_ASSERT_EQUAL_STRING("Caf\xc3\xa9 \xf0\x9f\x8c\x8a Flood\nWatch",
+                           event(0));
+  TEST_ASSERT_EQUAL_STRING("Flo\xc3\xb6" "d", tags(0));
+
+  for (size_t piece = 1; piece < 40; ++piece)
+  {
+    TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(json, piece));
+    TEST_ASSERT_EQUAL(static_cast<int>(expected.size()), alerts.count);
+    for (int i = 0; i < alerts.count; ++i)
+    {
+      TEST_ASSERT_EQUAL_STRING(expected[i].c_str(),
+                               (std::string(event(i)) + "|" + tags(i) + "|"
+                                + std::to_string(
+                                    alerts.alert[i].description_terms))
+                                 .c_str());
+    }
+  }
+}
+
+void test_unpaired_surrogates_are_replaced()
+{
+  const std::string json = response({
+    alertJson("a\\ud83cb\\udf0ac\\ud83c", 1)});
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(json));
+  TEST_ASSERT_EQUAL_STRING("a\xef\xbf\xbd" "b\xef\xbf\xbd" "c\xef\xbf\xbd",
+                           event(0));
+}
+
+void test_long_event_names_are_cut_at_a_character()
+{
+  std::string name(OWM_ALERT_EVENT_LEN - 1, 'x');
+  name += "\\u00e9";   // 2 bytes, the second one past the limit
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(response({alertJson(name, 1)})));
+  TEST_ASSERT_EQUAL(1, alerts.count);
+  TEST_ASSERT_EQUAL(OWM_ALERT_EVENT_LEN - 1, strlen(event(0)));
+}
+
+/* Alerts whose event name does not fit in the arena are dropped instead of
+ * being kept with an empty or partial event name, and give their text back.
+ */
+void test_arena_overflow_drops_alerts()
+{
+  std::vector<std::string> items;
+  std::vector<std::string> names;
+  for (int i = 0; i < OWM_NUM_ALERTS; ++i)
+  {
+    names.push_back(std::string(80, 'a' + i) + " Warning");
+    items.push_back(alertJson(names.back(), 100 + i, "Tag"));
+  }
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(response(items)));
+  // 1 + (89 + 4) bytes per alert fit 5 times in 512 bytes
+  TEST_ASSERT_EQUAL(5, alerts.count);
+  for (int i = 0; i < alerts.count; ++i)
+  {
+    TEST_ASSERT_EQUAL_STRING(names[i].c_str(), event(i));
+    TEST_ASSERT_EQUAL_STRING("Tag", tags(i));
+    TEST_ASSERT_TRUE(alerts.alert[i].start == 100 + i);
+  }
+  TEST_ASSERT_TRUE(alerts.text_used <= OWM_ALERTS_TEXT_SIZE);
+  TEST_ASSERT_EQUAL(1 + 5 * 93, alerts.text_used);
+
+  // dropped alerts give their slot back, a short alert after them still fits
+  items.push_back(alertJson("Fog", 7, "F"));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(response(items)));
+  TEST_ASSERT_EQUAL(6, alerts.count);
+  TEST_ASSERT_EQUAL_STRING("Fog", event(5));
+  TEST_ASSERT_EQUAL_STRING("F", tags(5));
+  TEST_ASSERT_TRUE(alerts.alert[5].start == 7);
+}
+
+void test_alerts_without_event_are_dropped()
+{
+  const std::string json = response({
+    "{\"start\":1,\"tags\":[\"Fog\"]}",
+    alertJson("", 2),
+    alertJson("Wind Advisory", 3)});
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(json));
+  TEST_ASSERT_EQUAL(1, alerts.count);
+  TEST_ASSERT_EQUAL_STRING("Wind Advisory", event(0));
+  TEST_ASSERT_TRUE(alerts.alert[0].start == 3);
+}
+
+void test_at_most_owm_num_alerts()
+{
+  std::vector<std::string> items;
+  for (int i = 0; i < OWM_NUM_ALERTS + 4; ++i)
+  {
+    items.push_back(alertJson("E" + std::to_string(i), i, ""));
+  }
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse(response(items)));
+  TEST_ASSERT_EQUAL(OWM_NUM_ALERTS, alerts.count);
+  TEST_ASSERT_EQUAL_STRING("E7", event(OWM_NUM_ALERTS - 1));
+}
+
+void test_invalid_input()
+{
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_INVALID,
+                    parse("{\"alerts\":[{\"event\":\"a\\q\"}]}"));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_INVALID, parse("{\"alerts\":[}"));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_INVALID, parse("{\"a\":\"\\u12g4\"}"));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_TOO_DEEP,
+                    parse("{\"a\":" + std::string(20, '[')));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_MORE, parse("{\"alerts\":[{\"event\":\"a"));
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE, parse("{}"));
+  TEST_ASSERT_EQUAL(0, alerts.count);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_reads_alert_fields);
+  RUN_TEST(test_pieces_of_any_size);
+  RUN_TEST(test_unpaired_surrogates_are_replaced);
+  RUN_TEST(test_long_event_names_are_cut_at_a_character);
+  RUN_TEST(test_arena_overflow_drops_alerts);
+  RUN_TEST(test_alerts_without_event_are_dropped);
+  RUN_TEST(test_at_most_owm_num_alerts);
+  RUN_TEST(test_invalid_input);
+  return UNITY_END();
+}
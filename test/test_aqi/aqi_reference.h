@@ -0,0 +1,399 @@
+/* Reference AQI values of the scale functions, for test_aqi.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Written by test_aqi with UPDATE_REFERENCE=1, from the if/else cascades
+// of the scale functions. Do not edit.
+
+#ifndef __AQI_REFERENCE_H__
+#define __AQI_REFERENCE_H__
+
+#include <stdint.h>
+#include "aqi.h"
+
+#define AQI_NUM_SWEEPS      7
+#define AQI_REFERENCE_CASES 320
+
+// by aqi_scale_t, argument and sweepValues()
+static const uint32_t AQI_SWEEP_HASH[NUM_AQI_SCALES][10][AQI_NUM_SWEEPS] =
+{
+  { // australia
+    {0x17314798, 0x253414C5, 0x1EA9FCA5, 0xCD5D362E,
+     0xBB3A9665, 0x9E6135C2, 0xB3D51B1B},
+    {0x06DA44ED, 0xAFE687A1, 0xFDB79EBD, 0xB400B566,
+     0x489992A5, 0x11175EE4, 0x242AC16D},
+    {0x5DE5CAA4, 0x9C52B897, 0x0CB45046, 0x0CFC3BF3,
+     0x7F11BAA7, 0x30D402BD, 0xD9D75C41},
+    {0x01FD016E, 0x1564BA80, 0x4423FB85, 0x7CD2E9E1,
+     0xDF79E515, 0x4513BEB6, 0xAF9CAF67},
+    {0xAAA05405, 0xB19DE5C4, 0xBDB64390, 0xDF1FC278,
+     0xC925B709, 0x24A97017, 0x82D71187},
+    {0xF4385506, 0xC23FEA60, 0xBB05EE68, 0x0526AE15,
+     0xEA2D2045, 0xAC661022, 0xB75CBAE9},
+    {0xC03B32EA, 0x5A383605, 0xF9223795, 0xCA7F07D0,
+     0x5D929545, 0x9658789E, 0x679F49BC},
+  },
+  { // canada
+    {0xC80624D7, 0xBB910345, 0xB60EC956, 0x913789A3,
+     0xE6671F93, 0x481853E3, 0x6CA59D7E},
+    {0x7AC0B60D, 0xBB910345, 0x509EEC25, 0x06EC01B7,
+     0xDDC8537F, 0x1D662C18, 0xA99605E2},
+    {0xAC3D6495, 0xBB910345, 0xA5E90DF7, 0xC837932D,
+     0x906328DF, 0x8DEF94BF, 0x490A86D4},
+  },
+  { // china
+    {0x602D324D, 0x253414C5, 0x8171E1F4, 0xF7BAB2CF,
+     0xDF87BF4F, 0x0C84F17F, 0xF05CBD1A},
+    {0xD0C61F60, 0x253414C5, 0x2AFA4BC7, 0x34D15FEC,
+     0x4C926B60, 0x15993891, 0x745A6937},
+    {0x7A651B26, 0x7544B2B0, 0xC12DC377, 0xB7478FE4,
+     0x8CF1284B, 0x13D15F43, 0xC0BA44DC},
+    {0xF2F71D6D, 0x373510F8, 0x50A32DCD, 0x2D04D8DE,
+     0x72433C0C, 0x94C6A8C3, 0xCA072ED3},
+    {0x90DC6187, 0x5682AE36, 0xE41AECBD, 0x7B250C7B,
+     0xA4B15E51, 0x784B7539, 0x369E5199},
+    {0x85268E31, 0x7544B2B0, 0xC12DC377, 0x1AE9E320,
+     0xD88D75C0, 0x53FF5051, 0x456161E0},
+    {0x4260D227, 0x81E10A67, 0xB47CFFD3, 0x7C694BBE,
+     0xE2FC15FB, 0xF91C5C6B, 0xF70A50F4},
+    {0xDCF90AB7, 0xF7BAB2CF, 0x1B50C8CB, 0xE0312E27,
+     0xFCF03583, 0xA1A53CC3, 0xADF4FCA3},
+    {0x26519D3D, 0xF7BAB2CF, 0x1B50C8CB, 0xF6D45CF7,
+     0x8630B8AC, 0x86B57098, 0x2A825DC6},
+    {0xB9FC317F, 0xBDE19E58, 0x8A116940, 0x1E2019C7,
+     0xC66C8427, 0x18E5B63E, 0x5601923D},
+  },
+  { // european_union
+    {0x20D7A7A1, 0x7544B2B0, 0x5F427514, 0xB41A5E04,
+     0x6F4713D9, 0xDFB6E079, 0x6B25A032},
+    {0x78BB4ED5, 0x7CB99505, 0x45560DC4, 0xE8650016,
+     0xF766F16F, 0xB1A5DAFD, 0x5938F6FE},
+    {0xBF171F7A, 0xF7BAB2CF, 0x8E783CA5, 0x5BA84B3B,
+     0xD844E4CF, 0x66D60C66, 0xEEC0629A},
+    {0x5CD30CBD, 0x6A37BF03, 0x6CB2C189, 0xBE85A13D,
+     0x1CBCA70F, 0x84D3E46A, 0x30652CD5},
+  },
+  { // hong_kong
+    {0xDFAC84F6, 0xBB910345, 0xA2A129D5, 0xAEBD1358,
+     0x780D3F7E, 0x794C18D2, 0xE76AEA2A},
+    {0xE347595F, 0xBB910345, 0x9FBF3F97, 0xE902F941,
+     0x5F363854, 0xECB47C03, 0x735E5BB8},
+    {0xBE4275CF, 0xBB910345, 0xBB910345, 0xD857A3C3,
+     0x8C5EF1A7, 0x53868955, 0xEE80ECE8},
+    {0x3B5D502D, 0xBB910345, 0x96CDD4F6, 0x2C0E6222,
+     0x94664DCD, 0x5C1DA2D4, 0x1B159028},
+    {0x0B1205EE, 0xBB910345, 0x0BBFF755, 0x2A02BEDF,
+     0x28924EAA, 0xF7F7A3F5, 0xFC7B1CE3},
+  },
+  { // india
+    {0x12456C67, 0x253414C5, 0x7544B2B0, 0xC12DC377,
+     0x0398B86F, 0xEED9F902, 0x9E1CF4CF},
+    {0x37E3AE77, 0x2AFA4BC7, 0x34D15FEC, 0x50D9E564,
+     0xCE2847FF, 0x1B007B04, 0xD0BB6B3E},
+    {0x99F86DF0, 0x373510F8, 0x46832E0D, 0xB8F9F438,
+     0x3080ADF4, 0x80A365D0, 0x4AEE242E},
+    {0x5A02BD67, 0xF7BAB2CF, 0xFE98F961, 0xA9BF6DEC,
+     0xA0C9B2AB, 0x26AE7CA5, 0x63EF09BB},
+    {0xC83D491C, 0xF2F090C1, 0xAEE9A6A3, 0x6F4E77A6,
+     0x1A8D59CA, 0x6B2A8E27, 0x6B2A8E27},
+    {0x38E2D87E, 0x373510F8, 0xE946D8A0, 0x109158E1,
+     0x047AED88, 0x7940810B, 0x07B176D8},
+    {0x0158880E, 0xF7BAB2CF, 0xFE98F961, 0x5E87FD80,
+     0x136B0305, 0x47B62A70, 0x95379ECF},
+    {0x83F8D90E, 0x6A37BF03, 0xD659B8DD, 0x1B1391E2,
+     0x16268370, 0x484C5F75, 0x8E6DF25A},
+  },
+  { // singapore
+    {0x2318412D, 0x253414C5, 0x8171E1F4, 0xF7BAB2CF,
+     0xFE98F961, 0xD7B06DC3, 0xB2E80C82},
+    {0x733CBB7F, 0x253414C5, 0x253414C5, 0x253414C5,
+     0x5DBA3473, 0xFBFFA889, 0xA5EB2704},
+    {0xA7EAAF95, 0x253414C5, 0x253414C5, 0x253414C5,
+     0x253414C5, 0x253414C5, 0x253414C5},
+    {0xD466409E, 0x3F048C70, 0x90C99F7F, 0x7ACA812F,
+     0xFED29518, 0x45A2900A, 0x28614571},
+    {0xF054ADE4, 0xBACB4183, 0x7A316B2D, 0x5EEF70B9,
+     0xD6D70CC4, 0x66B2AA75, 0x7035AB9C},
+    {0x6385837D, 0xF7BAB2CF, 0xC0E626B6, 0xEA35DE07,
+     0x6410EFD5, 0x2F7CC131, 0xB076EE2A},
+    {0xF5D2CAC0, 0x6F55809C, 0xFFAE9C5D, 0xD4530AD9,
+     0x09B75D2A, 0x7A5C8C12, 0x70317C87},
+  },
+  { // south_korea
+    {0x95227554, 0x253414C5, 0x13DB5755, 0x52AF8157,
+     0x4F5E17AB, 0x686DC2FD, 0x6FF18348},
+    {0xE7F63674, 0xC597E574, 0x900C6915, 0xE174F4B9,
+     0xE1257E69, 0xD7CFF663, 0xADCDD959},
+    {0x537B1C90, 0xEC726D8D, 0xE1AE17B0, 0x5BBB5AEA,
+     0xEB708E2E, 0xE348ED0E, 0x6FA47D60},
+    {0x411C5063, 0x627AAE96, 0x5BD6DF21, 0x8E99E83F,
+     0x9D3B866C, 0x17942639, 0xEE150CFA},
+    {0x6C08BFD8, 0x6A37BF03, 0x3B8F3E7F, 0x5C8DC74D,
+     0x9AAA04D2, 0x1F962DE4, 0xF2C72812},
+    {0x8F36998B, 0x901D475F, 0x21372E0D, 0x9707A143,
+     0xD4097C7E, 0x9DFCB713, 0x14C677ED},
+  },
+  { // united_kingdom
+    {0x5AFD53A6, 0xBB910345, 0x446EC326, 0xECACE125,
+     0xD41CD253, 0x366ECBCD, 0x854CCB9D},
+    {0x75059877, 0xBB910345, 0x917C0307, 0xB7051225,
+     0x5F921D13, 0xFCA7FD2C, 0x90F22C15},
+    {0x89F2225F, 0xBB910345, 0xA44F2646, 0x158F2AF5,
+     0x8B9DE0ED, 0xAE9F91D0, 0x347ED090},
+    {0x155D8221, 0xBB910345, 0x6B4CF6CD, 0xB591F0D5,
+     0xC0E29370, 0xB094671A, 0x5C6A4EBD},
+    {0xC192FEF9, 0xBB910345, 0x1CCE810E, 0xF92830F5,
+     0xC51B6758, 0x6260C977, 0x4DDD833E},
+  },
+  { // united_states
+    {0x26C7EC78, 0x253414C5, 0x253414C5, 0xD413DC50,
+     0x830D789D, 0x9228B416, 0xBC6E7ED7},
+    {0x5654E61B, 0x927D5AF3, 0x73924875, 0x8A9E96B2,
+     0xC00C565B, 0x595416F9, 0x5216536D},
+    {0xD2403737, 0x253414C5, 0x253414C5, 0xB4BB682F,
+     0xB725BB2B, 0x963FA83B, 0xD9F81480},
+    {0x4F5DBA80, 0x2EC60330, 0x0FF0AFA6, 0xAB034828,
+     0xC25F53C4, 0xC66B7C5B, 0x7DA497CC},
+    {0x2D0CE5F4, 0xB19DE5C4, 0xC04FFB08, 0x40C6E087,
+     0x8C0A5BAA, 0xA62487E8, 0xEEE0080E},
+    {0xA7EAAF95, 0x253414C5, 0x253414C5, 0x253414C5,
+     0x253414C5, 0x253414C5, 0x253414C5},
+    {0xF1B4CDF5, 0x1B37B24D, 0x13E6CCBC, 0xAA365AC3,
+     0xCC6EE2D1, 0xA4282B9D, 0x2330F8F2},
+    {0xBF90BA13, 0x07D4AA0D, 0xB481DCD9, 0x92B5D01C,
+     0x389C8176, 0xD1DFBC0F, 0x889C9876},
+  },
+};
+
+// by aqi_scale_t, for the cases of referenceArgs()
+static const int32_t AQI_REFERENCE[NUM_AQI_SCALES][AQI_REFERENCE_CASES] =
+{
+  { // australia
+    605, 624, 232646, 2190, 34575, 183600, 38, 102406, 287230, 32956, 3522,
+    222246, 980, 156000, 383843, 30903, 70, 1021, 48, 10300, 27200, 50448, 1667,
+    0, 4496, 24813, 1, 1268, 4879, 170586, 29, 5762, 506, 4516, 15600, 1954,
+    15864, 1273, 29, 33218, 244, 836, 5732, 184683, 412, 199929, 543, 84200,
+    3128000, 561, 221, 14, 2, 156350, 90208, 1537, 1607, 109, 410554, 194835,
+    236, 2480, 3200, 0, 31445, 4, 34518, 16, 10958, 2892000, 965, 278575,
+    320905, 9, 3334, 22615, 320400, 36, 123, 0, 513, 1, 2260, 30155, 15801,
+    1697, 20681, 437, 4974, 16784, 23320, 839, 1, 45447, 3, 1683, 392, 175,
+    4993, 4207, 5, 1, 23405, 194800, 190000, 5, 308, 9, 35306, 472, 698, 17686,
+    0, 269274, 6005, 3287, 4, 9, 151, 3375, 48, 293395, 39995, 515, 1708000, 35,
+    3942, 1909, 37846, 44, 36710, 856, 3904, 600, 107521, 44, 148, 6899, 1761,
+    1504, 8622, 1934, 3348, 33, 5416, 566, 173, 4966, 85, 1864, 43360, 62, 7200,
+    8851, 0, 285, 49358, 4813, 341, 3013, 3244000, 343, 1698, 185025, 20307,
+    2680, 1344, 17910, 1964, 4, 28740, 688, 4519, 9680, 2600, 168334, 36892, 4,
+    60, 23, 11, 1666, 136647, 4, 333, 39899, 8623, 1544000, 780000, 245, 190,
+    474, 0, 16099, 1380, 40, 71, 353423, 23, 76, 458, 287146, 153, 6, 236,
+    401895, 24195, 12034, 942, 37, 0, 23916, 38661, 29275, 174, 104400, 1380000,
+    35648, 58, 2595, 73, 42, 0, 32068, 36, 352094, 223105, 4202, 27, 62, 30,
+    6954, 159, 37286, 19267, 6903, 35487, 996000, 503, 2172, 1825, 580048, 25,
+    16048, 3604, 310, 370, 1262, 5579, 26, 0, 4, 2551, 199741, 33262, 101891, 0,
+    762000, 3500000, 270, 182, 395622, 2114, 3294, 756000, 170, 63, 4057, 11,
+    31836, 3, 14680, 705, 18167, 0, 45794, 56989, 2183, 1991, 78, 891, 362723,
+    1482, 4183, 53, 974, 3385, 57, 190, 11340, 67, 707, 268000, 162800, 436,
+    16963, 2, 1757, 0, 758000, 3600001, 1242, 0, 63, 11, 13, 101337, 14, 99782,
+    3883, 36, 6, 439, 18, 2683, 7710, 49, 219, 59915, 39,
+  },
+  { // canada
+    467, 33, 4, 109, 1, 1, 1, 1, 1, 3, 1, 1, 614, 57, 3, 2, 10, 40635237, 1, 1,
+    3, 62, 82, 1, 1, 1, 1, 10, 591, 1, 34, 1605589605, 4635, 57, 1, 28, 1, 1, 3,
+    1, 32, 1, 2, 1, 14, 51176, 1, 1, 8012, 10, 1, 1, 10, 19, 1, 1, 1, 1,
+    5300863, 480, 1, 1, 1068, 1, 1, 1, 1, 1, 1, 1, 1, 1, 497, 6, 1, 51,
+    879604017, 60, 1, 2, 2713, 2789, 1, 1, 2, 1, 34748, 1697, 767167394, 2216,
+    40, 554, 1, 13, 1, 1, 1, 4, 17, 1, 206385603, 2, 34, 26, 32, 42, 1, 605, 3,
+    1, 21, 1, 1, 1, 861, 1, 1, 34, 1, 1, 14, 1, 1, 1, 718, 2, 1, 1, 1, 41, 1, 1,
+    4578, 1, 440, 1, 2, 1420, 1, 122, 58, 1, 1, 27, 329, 1, 1, 35, 4, 1, 1, 1,
+    1, 1, 70, 3, 55, 10526, 5019, 1, 1, 1, 1, 394, 1, 1, 1, 3, 1, 1, 3, 1, 1, 1,
+    1, 135119, 6855, 1, 1, 1, 1, 310, 42, 13, 1, 1, 2, 24706, 4799, 4, 4, 1, 53,
+    11, 3, 33, 216, 1, 747, 1, 1, 1, 2, 3853, 53, 1, 575, 1, 23, 1, 3, 1, 2285,
+    3721, 1, 183, 1, 430, 1, 5486, 1169, 1, 2915, 1, 216, 1, 2, 1, 507, 1, 1, 1,
+    1, 4920, 1, 18, 189, 92, 87, 37, 2848, 25, 1, 1, 1, 1, 1, 1, 7455, 1, 353,
+    1, 3, 2, 1, 2476, 1, 19, 1, 1, 1, 1, 1, 1, 24, 112, 1, 10, 1, 1, 1, 1, 1, 1,
+    1, 1350, 1, 1, 1, 7974, 1340, 1, 1, 14415, 1, 28, 1, 27, 6150, 1, 40, 14, 1,
+    1, 10676311, 585, 1, 19, 1, 1, 7, 1, 20, 2153, 1, 1, 1, 1, 57, 1, 2451, 1,
+    1, 29, 862, 1, 3, 25, 2, 1,
+  },
+  { // china
+    48, 245, 501, 501, 409, 501, 0, 220, 501, 501, 1, 4, 501, 501, 501, 501, 0,
+    207, 501, 501, 501, 48, 308, 501, 501, 4, 176, 501, 501, 295, 0, 163, 24, 1,
+    501, 501, 81, 0, 49, 501, 501, 2, 501, 501, 1, 0, 424, 345, 501, 501, 501,
+    102, 501, 501, 501, 501, 171, 51, 295, 501, 22, 501, 501, 501, 501, 6, 133,
+    501, 501, 501, 501, 14, 501, 501, 501, 0, 1, 501, 501, 0, 289, 15, 501, 501,
+    189, 501, 1, 501, 501, 501, 501, 137, 501, 501, 501, 148, 501, 501, 501,
+    501, 501, 501, 264, 353, 67, 88, 154, 106, 501, 501, 0, 501, 46, 158, 501,
+    259, 41, 501, 378, 9, 501, 30, 207, 501, 337, 501, 53, 202, 501, 501, 501,
+    250, 501, 501, 501, 14, 0, 501, 39, 12, 190, 501, 10, 501, 294, 45, 453,
+    501, 501, 501, 20, 501, 501, 501, 501, 0, 97, 501, 501, 1, 501, 501, 172,
+    501, 501, 285, 155, 501, 501, 501, 501, 501, 160, 369, 501, 0, 501, 118,
+    501, 501, 110, 118, 39, 501, 6, 501, 16, 211, 501, 501, 238, 0, 0, 501, 501,
+    490, 2, 501, 0, 501, 0, 0, 18, 501, 501, 57, 382, 283, 501, 71, 251, 501,
+    171, 399, 290, 61, 501, 501, 501, 501, 187, 0, 501, 260, 501, 501, 0, 501,
+    501, 501, 501, 121, 1, 224, 501, 259, 180, 501, 21, 501, 501, 501, 501, 43,
+    501, 501, 501, 501, 501, 501, 501, 4, 501, 1, 501, 201, 6, 4, 501, 212, 1,
+    75, 501, 75, 501, 46, 30, 16, 501, 501, 176, 159, 120, 0, 0, 115, 501, 51,
+    35, 501, 501, 115, 501, 501, 501, 34, 501, 501, 59, 501, 63, 501, 38, 32,
+    501, 501, 4, 32, 501, 501, 1, 501, 501, 501, 501, 19, 114, 501, 501, 501,
+    501, 122, 5, 501, 501, 6, 501, 183, 501, 501,
+  },
+  { // european_union
+    101, 101, 92, 101, 101, 101, 101, 101, 44, 101, 101, 95, 101, 101, 69, 101,
+    5, 101, 101, 101, 29, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 1,
+    101, 101, 101, 101, 70, 85, 101, 82, 41, 101, 101, 101, 101, 101, 0, 101,
+    101, 101, 101, 55, 101, 101, 4, 101, 101, 20, 101, 101, 101, 62, 9, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 33, 101, 101, 101, 17, 101, 9,
+    101, 101, 101, 2, 101, 101, 61, 101, 101, 101, 101, 101, 101, 3, 0, 101,
+    101, 101, 101, 101, 101, 101, 97, 3, 101, 101, 101, 101, 62, 0, 101, 75,
+    101, 4, 101, 101, 101, 42, 101, 101, 5, 101, 101, 56, 101, 0, 101, 16, 101,
+    3, 101, 101, 101, 101, 2, 101, 101, 101, 101, 101, 42, 101, 101, 101, 101,
+    30, 65, 101, 101, 101, 101, 59, 3, 101, 69, 68, 2, 101, 101, 101, 45, 7,
+    101, 101, 101, 101, 101, 101, 3, 44, 4, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 19, 101, 101, 101, 101, 101, 22, 0, 101, 101, 95, 101,
+    101, 5, 101, 101, 101, 93, 101, 101, 101, 101, 86, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 19, 101, 55, 101, 101, 101, 68, 101, 101, 101, 91, 101,
+    101, 101, 101, 101, 28, 101, 101, 101, 101, 101, 101, 4, 101, 29, 101, 8,
+    101, 101, 101, 3, 101, 101, 101, 2, 2, 101, 101, 0, 101, 101, 101, 2, 101,
+    89, 101, 101, 101, 101, 12, 101, 101, 36, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 11, 101, 101, 101, 101, 19, 32, 25, 35, 101,
+    101, 101, 33, 3, 64, 101, 2, 101, 101, 101, 10, 1, 101, 40,
+  },
+  { // hong_kong
+    11, 11, 8, 11, 11, 11, 3, 11, 11, 1, 1, 11, 11, 11, 11, 11, 11, 1, 1, 11, 1,
+    11, 1, 11, 11, 11, 11, 1, 1, 6, 1, 11, 2, 8, 11, 11, 1, 11, 1, 11, 11, 11,
+    11, 11, 11, 11, 5, 11, 11, 1, 11, 11, 11, 11, 2, 1, 11, 1, 11, 1, 11, 3, 11,
+    1, 11, 1, 1, 11, 1, 11, 11, 1, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 8, 1,
+    11, 11, 1, 11, 11, 1, 11, 11, 8, 11, 11, 1, 11, 2, 1, 11, 2, 11, 11, 11, 11,
+    1, 3, 8, 1, 11, 1, 11, 1, 1, 11, 1, 11, 1, 2, 8, 4, 11, 1, 1, 11, 11, 11, 2,
+    1, 11, 11, 11, 11, 11, 11, 11, 4, 4, 2, 1, 1, 11, 1, 11, 11, 11, 1, 1, 11,
+    11, 2, 1, 11, 11, 11, 11, 3, 1, 11, 11, 11, 11, 11, 11, 1, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 1, 1, 11, 2, 11, 11, 11, 1, 11, 7, 11, 2, 11, 1,
+    11, 11, 11, 11, 11, 1, 11, 11, 1, 1, 3, 6, 11, 11, 11, 11, 11, 1, 11, 1, 1,
+    11, 1, 1, 11, 1, 11, 1, 11, 1, 1, 11, 4, 11, 11, 1, 11, 2, 1, 11, 11, 3, 1,
+    1, 11, 11, 11, 6, 11, 11, 2, 11, 11, 1, 1, 11, 3, 1, 11, 1, 11, 11, 11, 1,
+    11, 1, 11, 11, 11, 11, 3, 11, 11, 11, 11, 11, 11, 4, 1, 8, 11, 1, 11, 11, 1,
+    11, 11, 1, 11, 1, 11, 11, 11, 11, 1, 11, 11, 11, 11, 1, 11, 5, 4, 1, 11, 1,
+    3, 1, 11, 9, 11, 11, 11, 8, 11, 11, 1, 1, 11, 11, 11, 11, 11, 11, 11, 11, 3,
+    11, 11, 1,
+  },
+  { // india
+    15, 109, 401, 401, 401, 401, 29, 401, 401, 142, 401, 401, 401, 401, 401,
+    401, 1, 401, 401, 15, 401, 401, 401, 401, 52, 6, 201, 401, 401, 401, 401,
+    151, 401, 317, 401, 115, 401, 401, 401, 401, 401, 401, 401, 401, 401, 310,
+    401, 401, 114, 401, 401, 34, 401, 401, 401, 401, 401, 50, 1, 354, 401, 401,
+    401, 5, 401, 401, 401, 353, 401, 401, 401, 5, 401, 166, 47, 9, 401, 401,
+    401, 5, 306, 220, 401, 10, 401, 401, 70, 401, 20, 401, 9, 401, 401, 33, 401,
+    401, 29, 401, 401, 10, 401, 401, 401, 401, 401, 401, 401, 371, 401, 401,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 0, 0, 401, 401, 401,
+    399, 1, 401, 401, 401, 4, 401, 401, 401, 401, 315, 401, 401, 401, 401, 401,
+    401, 401, 401, 368, 401, 401, 401, 401, 401, 401, 102, 1, 401, 401, 401,
+    401, 401, 242, 401, 401, 62, 401, 401, 401, 83, 401, 36, 401, 401, 86, 401,
+    401, 401, 401, 133, 401, 401, 401, 401, 297, 16, 401, 401, 401, 351, 401,
+    401, 401, 198, 401, 401, 401, 401, 401, 401, 401, 10, 401, 201, 401, 57,
+    401, 401, 401, 401, 178, 401, 401, 24, 5, 401, 401, 401, 40, 401, 401, 401,
+    401, 297, 84, 401, 401, 401, 0, 401, 401, 300, 401, 401, 401, 195, 401, 83,
+    401, 401, 401, 2, 401, 102, 82, 401, 401, 401, 401, 401, 401, 37, 19, 401,
+    401, 401, 121, 386, 10, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+    401, 401, 401, 263, 401, 12, 401, 0, 401, 401, 401, 401, 401, 401, 0, 0,
+    401, 401, 401, 281, 401, 401, 1, 162, 401, 6, 401, 47, 9, 401, 401, 12, 401,
+    401, 401, 80, 4, 401, 401, 401, 401, 401, 401, 401, 218, 401, 401, 401, 401,
+    401, 401, 401, 401, 10,
+  },
+  { // singapore
+    501, 501, 501, 38, 74, 8, 501, 6, 501, 3, 501, 37, 96, 267, 8, 501, 2, 0,
+    501, 17, 54, 20, 501, 0, 1, 4, 501, 1, 146, 501, 501, 10, 16, 501, 69, 501,
+    0, 501, 2, 501, 287, 33, 0, 501, 0, 501, 202, 501, 501, 186, 501, 1, 245, 0,
+    1, 501, 70, 0, 501, 501, 270, 501, 501, 8, 501, 303, 0, 501, 177, 501, 4,
+    56, 247, 501, 0, 8, 106, 501, 501, 0, 501, 501, 501, 454, 501, 4, 501, 34,
+    6, 56, 501, 501, 501, 501, 163, 3, 501, 33, 501, 501, 501, 4, 501, 501, 501,
+    1, 501, 0, 8, 499, 501, 501, 501, 0, 0, 273, 125, 501, 501, 270, 501, 385,
+    0, 4, 501, 180, 501, 0, 263, 258, 43, 501, 482, 2, 100, 0, 0, 0, 501, 501,
+    142, 501, 0, 501, 69, 501, 501, 501, 501, 0, 2, 153, 501, 501, 501, 42, 0,
+    501, 22, 490, 501, 501, 252, 35, 501, 9, 501, 501, 501, 501, 11, 258, 187,
+    501, 501, 1, 501, 501, 0, 501, 501, 501, 1, 501, 0, 28, 3, 501, 501, 501,
+    501, 1, 2, 0, 501, 4, 2, 0, 68, 501, 501, 501, 501, 0, 365, 501, 260, 501,
+    501, 501, 0, 68, 0, 0, 35, 501, 442, 413, 229, 4, 260, 501, 401, 501, 501,
+    0, 501, 501, 501, 4, 501, 501, 501, 275, 2, 501, 501, 76, 501, 501, 0, 0,
+    501, 501, 175, 275, 467, 501, 0, 153, 9, 0, 58, 501, 0, 0, 2, 9, 501, 0,
+    501, 410, 0, 110, 501, 229, 501, 501, 501, 501, 501, 195, 501, 0, 282, 40,
+    501, 228, 68, 501, 9, 501, 501, 10, 501, 309, 501, 1, 4, 63, 219, 37, 501,
+    280, 213, 7, 1, 501, 51, 501, 501, 501, 501, 78, 12, 229, 501, 501, 501,
+    501, 0, 501, 0, 501, 501, 501, 501, 0, 2, 233,
+  },
+  { // south_korea
+    9, 501, 501, 146, 501, 501, 336, 501, 501, 332, 103, 2, 501, 501, 501, 56,
+    501, 501, 306, 1, 1, 128, 9, 501, 0, 501, 501, 501, 100, 501, 10, 501, 501,
+    501, 4, 501, 98, 501, 17, 501, 295, 167, 98, 260, 501, 25, 501, 501, 59, 50,
+    501, 29, 151, 270, 463, 68, 43, 501, 501, 501, 297, 407, 501, 501, 501, 501,
+    0, 501, 110, 501, 425, 501, 77, 12, 501, 501, 501, 501, 1, 269, 501, 501,
+    501, 27, 0, 24, 51, 501, 16, 501, 501, 501, 1, 501, 137, 501, 501, 501, 501,
+    13, 501, 206, 21, 501, 501, 501, 501, 229, 1, 38, 260, 501, 213, 501, 0, 94,
+    501, 2, 501, 1, 15, 501, 501, 501, 501, 501, 501, 284, 501, 75, 370, 27,
+    196, 501, 501, 304, 501, 501, 390, 137, 51, 47, 0, 501, 501, 9, 448, 501,
+    501, 501, 224, 437, 501, 501, 16, 501, 430, 501, 501, 2, 501, 501, 1, 481,
+    0, 501, 501, 0, 501, 4, 501, 501, 501, 307, 501, 279, 501, 501, 501, 501,
+    501, 501, 501, 501, 501, 501, 501, 333, 8, 501, 57, 501, 501, 501, 501, 70,
+    80, 501, 58, 501, 501, 501, 501, 501, 0, 501, 501, 1, 131, 501, 0, 501, 69,
+    462, 501, 501, 501, 501, 501, 501, 501, 501, 1, 0, 412, 501, 501, 501, 56,
+    501, 501, 501, 501, 501, 2, 253, 1, 256, 4, 501, 13, 252, 47, 501, 470, 11,
+    128, 1, 3, 501, 501, 501, 501, 501, 501, 22, 501, 404, 2, 0, 370, 113, 31,
+    501, 146, 501, 501, 501, 501, 501, 374, 501, 61, 286, 12, 501, 501, 501,
+    501, 2, 306, 501, 501, 501, 133, 501, 501, 3, 501, 501, 501, 70, 501, 501,
+    1, 0, 501, 501, 501, 501, 501, 501, 501, 501, 501, 88, 501, 501, 0, 32, 82,
+    501, 60, 279, 38, 182, 501, 501, 0, 163,
+  },
+  { // united_kingdom
+    10, 6, 10, 10, 10, 1, 6, 10, 10, 1, 10, 10, 1, 6, 10, 1, 1, 1, 10, 1, 10, 8,
+    10, 1, 5, 10, 10, 10, 10, 1, 1, 10, 1, 10, 10, 1, 1, 1, 10, 10, 10, 10, 10,
+    10, 1, 1, 10, 1, 10, 10, 10, 10, 10, 10, 10, 10, 1, 10, 1, 10, 10, 10, 10,
+    10, 10, 10, 10, 1, 10, 10, 10, 2, 10, 10, 6, 6, 10, 10, 1, 10, 10, 10, 1,
+    10, 10, 10, 10, 2, 10, 10, 1, 10, 2, 3, 8, 10, 10, 10, 1, 10, 10, 1, 10, 10,
+    4, 10, 10, 10, 3, 10, 10, 10, 10, 10, 10, 10, 3, 10, 1, 10, 10, 10, 8, 3,
+    10, 10, 9, 10, 10, 10, 10, 10, 1, 6, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1,
+    2, 10, 1, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 1, 1, 1, 1, 2, 10,
+    10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 1, 1, 2, 10, 1, 5, 1, 10, 10, 10, 10,
+    1, 3, 1, 10, 10, 10, 10, 10, 8, 10, 10, 1, 10, 1, 1, 10, 10, 5, 3, 10, 7, 4,
+    10, 2, 1, 7, 3, 10, 1, 10, 1, 1, 1, 10, 2, 10, 4, 10, 10, 10, 1, 10, 1, 10,
+    10, 2, 10, 10, 10, 10, 10, 10, 10, 1, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10,
+    10, 10, 1, 10, 10, 10, 1, 10, 10, 10, 10, 10, 10, 10, 1, 10, 1, 1, 1, 10, 1,
+    1, 10, 10, 1, 1, 10, 10, 10, 1, 10, 1, 10, 10, 10, 2, 10, 8, 10, 10, 10, 10,
+    1, 1, 10, 10, 1, 1, 1, 6, 10, 10, 1, 10, 10, 10, 10, 8, 3, 10, 10, 2, 10,
+    10, 10, 10, 9, 1, 7, 1,
+  },
+  { // united_states
+    3, 501, 301, 34, 70, 97, 501, 501, 439, 44, 0, 501, 0, 58, 501, 301, 0, 501,
+    0, 0, 0, 103, 501, 164, 117, 501, 501, 501, 17, 0, 301, 2, 501, 501, 301,
+    43, 117, 501, 501, 501, 0, 16, 259, 142, 0, 125, 501, 501, 501, 468, 301,
+    501, 301, 0, 501, 32, 37, 1, 8, 38, 301, 0, 86, 501, 501, 301, 301, 0, 501,
+    501, 501, 501, 501, 501, 301, 0, 142, 501, 10, 501, 301, 315, 326, 0, 6,
+    501, 501, 501, 98, 48, 501, 301, 14, 0, 0, 301, 501, 141, 279, 501, 111, 7,
+    199, 501, 5, 501, 301, 301, 0, 0, 501, 173, 0, 33, 301, 0, 9, 501, 501, 501,
+    501, 43, 80, 0, 2, 0, 501, 161, 119, 501, 10, 21, 501, 0, 301, 501, 0, 2,
+    501, 501, 2, 501, 501, 21, 111, 501, 501, 0, 0, 0, 501, 501, 501, 158, 166,
+    301, 501, 501, 173, 501, 0, 0, 0, 8, 24, 86, 501, 501, 3, 475, 0, 251, 102,
+    0, 63, 167, 501, 140, 301, 30, 24, 0, 501, 501, 4, 157, 501, 0, 301, 0, 60,
+    7, 64, 501, 501, 501, 501, 153, 19, 501, 0, 501, 301, 0, 416, 40, 501, 501,
+    51, 7, 301, 301, 0, 3, 55, 501, 293, 52, 124, 0, 25, 77, 276, 91, 381, 21,
+    301, 226, 501, 2, 306, 501, 301, 501, 301, 501, 14, 0, 501, 501, 0, 501, 84,
+    501, 6, 0, 501, 501, 0, 3, 42, 0, 0, 146, 501, 501, 7, 501, 301, 222, 35,
+    37, 501, 501, 501, 36, 249, 0, 0, 26, 36, 419, 52, 5, 301, 501, 501, 269,
+    501, 501, 501, 11, 301, 0, 501, 0, 301, 501, 501, 41, 160, 204, 104, 0, 41,
+    501, 501, 501, 24, 101, 124, 0, 301, 501, 0, 445, 301, 501, 501, 0, 501,
+    501, 0, 31, 404, 301, 1, 0, 501, 33,
+  },
+};
+
+#endif
@@ -0,0 +1,590 @@
+/* Unit tests for the AQI scales and pollutant windows.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+
+#include "aqi.h"
+#include "aqi_reference.h"
+// the AQI descriptor texts aqi.c links against
+#include "locales/locale_en_US.inc"
+
+// defined in aqi.c, but not declared in aqi.h
+extern "C" float avg_conc(const float pollutant[24], int hours);
+
+static const int NUM_SETS = 2000;
+// hours of each aqi_window_t
+static const int WINDOW_HOURS[NUM_AQI_WINDOWS] = {1, 3, 4, 8, 24};
+
+/* Hourly concentrations like OWM's, in μg/m^3 with 2 decimals.
+ */
+typedef struct
+{
+  float c[NUM_AQI_POLLUTANTS][24];
+} hourly_t;
+
+static std::mt19937 rng;
+
+static hourly_t randomHourly()
+{
+  // rough upper ends of OWM's concentrations, per aqi_pollutant_t
+  static const float MAX_CONC[NUM_AQI_POLLUTANTS] =
+  {
+    15000, 200, 100, 400, 400, 3, 800, 600, 400
+  };
+  hourly_t h;
+  for (int p = 0; p < NUM_AQI_POLLUTANTS; ++p)
+  {
+    // a few sets with small values, where rounding matters most
+    const float max = rng() % 8 ? MAX_CONC[p] : 2;
+    for (int i = 0; i < 24; ++i)
+    {
+      h.c[p][i] = std::round(std::uniform_real_distribution<float>(0, max)(rng)
+                             * 100) / 100;
+    }
+  }
+  return h;
+}
+
+static void initWindows(aqi_windows_t &w, const hourly_t &h, bool pb)
+{
+  init_aqi_windows(&w, h.c[AQI_CO], h.c[AQI_NH3], h.c[AQI_NO], h.c[AQI_NO2],
+                   h.c[AQI_O3], pb ? h.c[AQI_PB] : NULL, h.c[AQI_SO2],
+                   h.c[AQI_PM10], h.c[AQI_PM2_5]);
+}
+
+static uint32_t bits(float f)
+{
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+/* A scale function of aqi.h, with its arguments passed as an array.
+ */
+typedef struct
+{
+  const char *name;
+  int         numArgs;
+  int       (*fn)(const float a[]);
+} scale_fn_t;
+
+// same order as aqi_scale_t enums
+static const scale_fn_t SCALE_FNS[NUM_AQI_SCALES] =
+{
+  {"australia", 7,
+   [](const float a[]) { return australia_aqi(a[0], a[1], a[2], a[3], a[4],
+                                              a[5], a[6]); }},
+  {"canada", 3,
+   [](const float a[]) { return canada_aqhi(a[0], a[1], a[2]); }},
+  {"china", 10,
+   [](const float a[]) { return china_aqi(a[0], a[1], a[2], a[3], a[4], a[5],
+                                          a[6], a[7], a[8], a[9]); }},
+  {"european_union", 4,
+   [](const float a[]) { return european_union_caqi(a[0], a[1], a[2],
+                                                    a[3]); }},
+  {"hong_kong", 5,
+   [](const float a[]) { return hong_kong_aqhi(a[0], a[1], a[2], a[3],
+                                               a[4]); }},
+  {"india", 8,
+   [](const float a[]) { return india_aqi(a[0], a[1], a[2], a[3], a[4], a[5],
+                                          a[6], a[7]); }},
+  {"singapore", 7,
+   [](const float a[]) { return singapore_psi(a[0], a[1], a[2], a[3], a[4],
+                                              a[5], a[6]); }},
+  {"south_korea", 6,
+   [](const float a[]) { return south_korea_cai(a[0], a[1], a[2], a[3], a[4],
+                                                a[5]); }},
+  {"united_kingdom", 5,
+   [](const float a[]) { return united_kingdom_daqi(a[0], a[1], a[2], a[3],
+                                                    a[4]); }},
+  {"united_states", 8,
+   [](const float a[]) { return united_states_aqi(a[0], a[1], a[2], a[3],
+                                                  a[4], a[5], a[6], a[7]); }},
+};
+
+static uint32_t nextRandom(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+/* A concentration like OWM's, with 2 decimals, up to 10^(-1 to 5).
+ */
+static float owmConc(uint32_t &x)
+{
+  static const uint32_t RANGE[] = {10, 100, 1000, 10000, 100000, 1000000,
+                                   10000000};
+  const uint32_t range = RANGE[nextRandom(x) % 7];
+  return static_cast<float>((nextRandom(x) % range) / 100.0);
+}
+
+/* A concentration with up to 3 significant digits, where most breakpoints are.
+ */
+static float roundConc(uint32_t &x)
+{
+  static const double STEP[] = {0.01, 0.1, 1, 10, 100, 1000};
+  const double step = STEP[nextRandom(x) % 6];
+  return static_cast<float>((1 + nextRandom(x) % 999) * step);
+}
+
+/* Fills the arguments of reference case 'i' of a scale. One argument is a
+ * round concentration, the float right below or above one, or an OWM-like
+ * concentration. The others are 0 or OWM-like, so the bands of several
+ * pollutants interact. Only integer and correctly rounded arithmetic is used,
+ * so the cases are the same on every host.
+ */
+static void referenceArgs(int scale, int i, float a[])
+{
+  const int numArgs = SCALE_FNS[scale].numArgs;
+  uint32_t x = 0x9E3779B9u ^ (scale * AQI_REFERENCE_CASES + i);
+  for (int arg = 0; arg < numArgs; ++arg)
+  {
+    a[arg] = nextRandom(x) % 4 == 0 ? owmConc(x) : 0.f;
+  }
+  float &focus = a[i % numArgs];
+  switch (i / numArgs % 4)
+  {
+  case 0:  focus = roundConc(x); break;
+  case 1:  focus = std::nextafter(roundConc(x), 0.f); break;
+  case 2:  focus = std::nextafter(roundConc(x), INFINITY); break;
+  default: focus = owmConc(x); break;
+  }
+}
+
+// head of aqi_reference.h
+static const char REFERENCE_HEADER[] =
+  "/* Reference AQI values of the scale functions, for test_aqi.\n"
+  " * Copyright (C) 2022-2025  Luke Marzen\n"
+  " *\n"
+  " * This program is free software: you can redistribute it and/or modify\n"
+  " * it under the terms of the GNU General Public License as published by\n"
+  " * the Free Software Foundation, either version 3 of the License, or\n"
+  " * (at your option) any later version.\n"
+  " *\n"
+  " * This program is distributed in the hope that it will be useful,\n"
+  " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+  " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+  " * GNU General Public License for more details.\n"
+  " *\n"
+  " * You should have received a copy of the GNU General Public License\n"
+  " * along with this program.  If not, see <https://www.gnu.org/licenses/>.\n"
+  " */\n"
+  "\n"
+  "// Written by test_aqi with UPDATE_REFERENCE=1, from the if/else cascades\n"
+  "// of the scale functions. Do not edit.\n"
+  "\n"
+  "#ifndef __AQI_REFERENCE_H__\n"
+  "#define __AQI_REFERENCE_H__\n"
+  "\n"
+  "#include <stdint.h>\n"
+  "#include \"aqi.h\"\n"
+  "\n"
+  "#define AQI_NUM_SWEEPS      7\n"
+  "#define AQI_REFERENCE_CASES 320\n"
+  "\n";
+
+/* Concentrations of sweep 'n' of an argument. Sweep 0 spreads floats evenly
+ * over the exponents from 2^-20 to 2^18, and INF. Sweeps 1 to 6 are every
+ * value with up to 4 significant digits in steps of 10^(n - 4), where the
+ * breakpoints are, and the floats right next to those.
+ */
+static std::vector<float> sweepValues(int n)
+{
+  std::vector<float> v;
+  if (n == 0)
+  {
+    uint32_t lo, hi;
+    const float flo = std::ldexp(1.f, -20);
+    const float fhi = std::ldexp(1.f, 18);
+    memcpy(&lo, &flo, sizeof(lo));
+    memcpy(&hi, &fhi, sizeof(hi));
+    for (uint32_t u = lo; u <= hi; u += 4099)
+    {
+      float f;
+      memcpy(&f, &u, sizeof(f));
+      v.push_back(f);
+    }
+    v.push_back(INFINITY);
+    return v;
+  }
+  const int e = n - 4;
+  const double step = std::pow(10.0, e < 0 ? -e : e);
+  for (int d = 0; d < 10000; ++d)
+  {
+    const float f = static_cast<float>(e < 0 ? d / step : d * step);
+    v.push_back(f);
+    v.push_back(std::nextafter(f, 0.f));
+    v.push_back(std::nextafter(f, INFINITY));
+  }
+  return v;
+}
+
+/* FNV-1a hash of a scale's results over sweep 'n' of argument 'arg', with the
+ * other arguments 0.
+ */
+static uint32_t sweepHash(int scale, int arg, int n)
+{
+  uint32_t hash = 2166136261u;
+  float a[10] = {};
+  for (float v : sweepValues(n))
+  {
+    a[arg] = v;
+    const int32_t result = SCALE_FNS[scale].fn(a);
+    for (int byte = 0; byte < 4; ++byte)
+    {
+      hash = (hash ^ ((result >> (8 * byte)) & 0xFF)) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+/* Writes the sweep hashes and the results of the reference cases as
+ * aqi_reference.h, next to this file.
+ */
+static void writeReference()
+{
+  std::string path = __FILE__;
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "aqi_reference.h";
+  FILE *f = fopen(path.c_str(), "w");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path.c_str());
+  fputs(REFERENCE_HEADER, f);
+  fprintf(f, "// by aqi_scale_t, argument and sweepValues()\n"
+             "static const uint32_t AQI_SWEEP_HASH[NUM_AQI_SCALES][10]"
+             "[AQI_NUM_SWEEPS] =\n{\n");
+  for (int s = 0; s < NUM_AQI_SCALES; ++s)
+  {
+    fprintf(f, "  { // %s\n", SCALE_FNS[s].name);
+    for (int arg = 0; arg < SCALE_FNS[s].numArgs; ++arg)
+    {
+      for (int n = 0; n < AQI_NUM_SWEEPS; ++n)
+      {
+        fprintf(f, "%s0x%08X%s", n == 0 ? "    {" : n == 4 ? "\n     " : " ",
+                sweepHash(s, arg, n), n + 1 < AQI_NUM_SWEEPS ? "," : "},\n");
+      }
+    }
+    fprintf(f, "  },\n");
+  }
+  fprintf(f, "};\n\n// by aqi_scale_t, for the cases of referenceArgs()\n");
+  fprintf(f, "static const int32_t AQI_REFERENCE[NUM_AQI_SCALES]"
+             "[AQI_REFERENCE_CASES] =\n{\n");
+  for (int s = 0; s < NUM_AQI_SCALES; ++s)
+  {
+    fprintf(f, "  { // %s", SCALE_FNS[s].name);
+    int col = 80;
+    for (int i = 0; i < AQI_REFERENCE_CASES; ++i)
+    {
+      float a[10];
+      referenceArgs(s, i, a);
+      char value[16];
+      const int len = snprintf(value, sizeof(value), "%d,", SCALE_FNS[s].fn(a));
+      if (col + 1 + len > 80)
+      {
+        fprintf(f, "\n   ");
+        col = 3;
+      }
+      fprintf(f, " %s", value);
+      col += 1 + len;
+    }
+    fprintf(f, "\n  },\n");
+  }
+  fprintf(f, "};\n\n#endif\n");
+  fclose(f);
+}
+
+void setUp()
+{
+  rng.seed(40);
+}
+
+void tearDown()
+{
+}
+
+/* Every window, also the ones ending before the most recent hour, averages to
+ * the same float as avg_conc over the same hours.
+ */
+void test_window_averages_match_avg_conc()
+{
+  long mismatches = 0;
+  for (int set = 0; set < NUM_SETS; ++set)
+  {
+    const hourly_t h = randomHourly();
+    aqi_windows_t w;
+    initWindows(w, h, true);
+    for (int p = 0; p < NUM_AQI_POLLUTANTS; ++p)
+    {
+      for (int end = 0; end < 24; ++end)
+      {
+        // the hours up to 'end', moved to the end of the array for avg_conc
+        float shifted[24] = {};
+        memcpy(shifted + 23 - end, h.c[p], (end + 1) * sizeof(float));
+        for (int i = 0; i < NUM_AQI_WINDOWS; ++i)
+        {
+          const int hours = WINDOW_HOURS[i];
+          const float expected = avg_conc(shifted,
+                                          hours < end + 1 ? hours : end + 1);
+          const float actual = window_avg_conc(
+            &w, static_cast<aqi_pollutant_t>(p), end,
+            static_cast<aqi_window_t>(i));
+          mismatches += bits(expected) != bits(actual);
+        }
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+void test_calc_aqi_windows_matches_calc_aqi()
+{
+  for (int set = 0; set < NUM_SETS; ++set)
+  {
+    const hourly_t h = randomHourly();
+    const bool pb = set % 2;
+    aqi_windows_t w;
+    initWindows(w, h, pb);
+    for (int s = 0; s < NUM_AQI_SCALES; ++s)
+    {
+      const aqi_scale_t scale = static_cast<aqi_scale_t>(s);
+      const int expected = calc_aqi(scale, h.c[AQI_CO], h.c[AQI_NH3],
+                                    h.c[AQI_NO], h.c[AQI_NO2], h.c[AQI_O3],
+                                    pb ? h.c[AQI_PB] : NULL, h.c[AQI_SO2],
+                                    h.c[AQI_PM10], h.c[AQI_PM2_5]);
+      TEST_ASSERT_EQUAL(expected, calc_aqi_windows(scale, &w));
+
+      int series[24];
+      calc_aqi_series(scale, &w, series);
+      TEST_ASSERT_EQUAL(expected, series[23]);
+    }
+  }
+}
+
+/* calc_aqi_all gives every scale the same as calc_aqi_windows, and saturates
+ * values past the range of a short.
+ */
+void test_calc_aqi_all_matches_calc_aqi_windows()
+{
+  for (int set = 0; set < NUM_SETS; ++set)
+  {
+    hourly_t h = randomHourly();
+    if (set == 0)
+    {
+      // Australia's CO index way past SHRT_MAX
+      std::fill(h.c[AQI_CO], h.c[AQI_CO] + 24, 1e9f);
+    }
+    aqi_windows_t w;
+    initWindows(w, h, set % 2);
+    aqi_all_t all;
+    calc_aqi_all(&w, &all);
+    for (int s = 0; s < NUM_AQI_SCALES; ++s)
+    {
+      const aqi_scale_t scale = static_cast<aqi_scale_t>(s);
+      const int expected = std::min(calc_aqi_windows(scale, &w),
+                                    static_cast<int>(SHRT_MAX));
+      TEST_ASSERT_EQUAL_MESSAGE(expected, all.val[s], SCALE_FNS[s].name);
+    }
+    if (set == 0)
+    {
+      TEST_ASSERT_EQUAL(SHRT_MAX, all.val[AUSTRALIA_AQI]);
+    }
+  }
+}
+
+void test_missing_pollutants_average_to_zero()
+{
+  const hourly_t h = randomHourly();
+  aqi_windows_t w;
+  initWindows(w, h, false);
+  for (int end = 0; end < 24; ++end)
+  {
+    TEST_ASSERT_EQUAL_FLOAT(0.f, window_avg_conc(&w, AQI_PB, end, AQI_24H));
+  }
+  TEST_ASSERT_EQUAL_FLOAT(0.f, avg_conc(NULL, 24));
+}
+
+/* Each argument of each scale on its own, the others 0, swept over the values
+ * where breakpoints are. Run with UPDATE_REFERENCE=1 to rewrite
+ * aqi_reference.h after an intended change of a scale.
+ */
+void test_scale_sweeps_match_reference()
+{
+  const char *update = getenv("UPDATE_REFERENCE");
+  if (update != nullptr && update[0] == '1')
+  {
+    writeReference();
+    return;
+  }
+
+  for (int s = 0; s < NUM_AQI_SCALES; ++s)
+  {
+    for (int arg = 0; arg < SCALE_FNS[s].numArgs; ++arg)
+    {
+      for (int n = 0; n < AQI_NUM_SWEEPS; ++n)
+      {
+        char msg[96];
+        snprintf(msg, sizeof(msg), "%s argument %d, sweep %d",
+                 SCALE_FNS[s].name, arg, n);
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(AQI_SWEEP_HASH[s][arg][n],
+                                        sweepHash(s, arg, n), msg);
+      }
+    }
+  }
+}
+
+/* All arguments at once, so the bands of several pollutants interact.
+ */
+void test_scale_cases_match_reference()
+{
+  for (int s = 0; s < NUM_AQI_SCALES; ++s)
+  {
+    for (int i = 0; i < AQI_REFERENCE_CASES; ++i)
+    {
+      float a[10];
+      referenceArgs(s, i, a);
+      if (SCALE_FNS[s].fn(a) != AQI_REFERENCE[s][i])
+      {
+        char msg[160];
+        int n = snprintf(msg, sizeof(msg), "%s case %d (", SCALE_FNS[s].name,
+                         i);
+        for (int arg = 0; arg < SCALE_FNS[s].numArgs; ++arg)
+        {
+          n += snprintf(msg + n, sizeof(msg) - n, "%s%.9g", arg ? " " : "",
+                        a[arg]);
+        }
+        snprintf(msg + n, sizeof(msg) - n, ")");
+        TEST_ASSERT_EQUAL_MESSAGE(AQI_REFERENCE[s][i], SCALE_FNS[s].fn(a), msg);
+      }
+    }
+  }
+}
+
+/* Reports the time of all 10 scale functions for one set of averages.
+ */
+void test_scale_timing()
+{
+  std::vector<float> args(AQI_REFERENCE_CASES * NUM_AQI_SCALES * 10);
+  for (int s = 0; s < NUM_AQI_SCALES; ++s)
+  {
+    for (int i = 0; i < AQI_REFERENCE_CASES; ++i)
+    {
+      referenceArgs(s, i, &args[(s * AQI_REFERENCE_CASES + i) * 10]);
+    }
+  }
+  const int rounds = 200;
+  long sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (int i = 0; i < AQI_REFERENCE_CASES; ++i)
+    {
+      for (int s = 0; s < NUM_AQI_SCALES; ++s)
+      {
+        sum += SCALE_FNS[s].fn(&args[(s * AQI_REFERENCE_CASES + i) * 10]);
+      }
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  TEST_ASSERT_TRUE(sum > 0);
+  char msg[64];
+  snprintf(msg, sizeof(msg), "all 10 scales: %.0f ns",
+           std::chrono::duration<double, std::nano>(t1 - t0).count()
+           / (rounds * AQI_REFERENCE_CASES));
+  TEST_MESSAGE(msg);
+}
+
+/* Reports the time of the US scale alone, of all scales through
+ * calc_aqi_windows, and of all scales through calc_aqi_all.
+ */
+void test_calc_aqi_all_timing()
+{
+  const int numWindows = 256;
+  std::vector<aqi_windows_t> windows(numWindows);
+  for (aqi_windows_t &w : windows)
+  {
+    initWindows(w, randomHourly(), true);
+  }
+  const int rounds = 20;
+  long sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (const aqi_windows_t &w : windows)
+    {
+      sum += calc_aqi_windows(UNITED_STATES_AQI, &w);
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (const aqi_windows_t &w : windows)
+    {
+      for (int s = 0; s < NUM_AQI_SCALES; ++s)
+      {
+        sum += calc_aqi_windows(static_cast<aqi_scale_t>(s), &w);
+      }
+    }
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (const aqi_windows_t &w : windows)
+    {
+      aqi_all_t all;
+      calc_aqi_all(&w, &all);
+      sum += all.val[r % NUM_AQI_SCALES];
+    }
+  }
+  auto t3 = std::chrono::steady_clock::now();
+  TEST_ASSERT_TRUE(sum > 0);
+
+  const double n = rounds * numWindows;
+  auto ns = [n](std::chrono::steady_clock::duration d)
+  {
+    return std::chrono::duration<double, std::nano>(d).count() / n;
+  };
+  char msg[128];
+  snprintf(msg, sizeof(msg), "united_states %.0f ns, "
+           "10 x calc_aqi_windows %.0f ns, calc_aqi_all %.0f ns",
+           ns(t1 - t0), ns(t2 - t1), ns(t3 - t2));
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_window_averages_match_avg_conc);
+  RUN_TEST(test_calc_aqi_windows_matches_calc_aqi);
+  RUN_TEST(test_calc_aqi_all_matches_calc_aqi_windows);
+  RUN_TEST(test_missing_pollutants_average_to_zero);
+  RUN_TEST(test_scale_sweeps_match_reference);
+  RUN_TEST(test_scale_cases_match_reference);
+  RUN_TEST(test_scale_timing);
+  RUN_TEST(test_calc_aqi_all_timing);
+  return UNITY_END();
+}
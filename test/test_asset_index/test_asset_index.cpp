@@ -0,0 +1,243 @@
+/* Unit tests for the asset image index.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unity.h>
+
+#include "asset_index.h"
+
+typedef struct test_asset
+{
+  const char  *name;
+  asset_type_t type;
+  std::string  blob;
+} test_asset_t;
+
+static const std::vector<test_asset_t> ASSETS = {
+  {"icon_atlas", ASSET_ICON_ATLAS, std::string(37, '\x5a')},
+  {"FreeSans_12pt8b", ASSET_FONT, "glyphs and bitmaps"},
+  {"FreeSans_26pt8b", ASSET_FONT, std::string(1000, '\x01')},
+  {"unicode_16", ASSET_UNICODE_FONT, "ranges"},
+  {"empty", ASSET_FONT, ""},
+};
+
+static void align4(std::vector<uint8_t> &buf)
+{
+  buf.resize((buf.size() + 3) & ~3);
+}
+
+/* Builds an image the way build_image() in tools/pack_assets.py does.
+ */
+static std::vector<uint8_t> buildImage(const std::vector<test_asset_t> &assets)
+{
+  std::vector<uint8_t> image(sizeof(asset_header_t));
+  std::vector<asset_entry_t> entries;
+  for (const test_asset_t &a : assets)
+  {
+    align4(image);
+    entries.push_back({assetNameHash(a.name), static_cast<uint16_t>(a.type), 0,
+                       static_cast<uint32_t>(image.size()),
+                       static_cast<uint32_t>(a.blob.size())});
+    image.insert(image.end(), a.blob.begin(), a.blob.end());
+  }
+  align4(image);
+  const uint32_t indexOffset = image.size();
+  std::sort(entries.begin(), entries.end(),
+            [](const asset_entry_t &a, const asset_entry_t &b)
+            { return a.name_hash < b.name_hash; });
+  for (const asset_entry_t &e : entries)
+  {
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(&e);
+    image.insert(image.end(), p, p + sizeof(e));
+  }
+  asset_header_t header = {};
+  header.magic = ASSET_IMAGE_MAGIC;
+  header.version = ASSET_IMAGE_VERSION;
+  header.count = entries.size();
+  header.index_offset = indexOffset;
+  header.image_size = image.size();
+  header.crc32 = assetCrc32(image.data() + sizeof(header),
+                            image.size() - sizeof(header));
+  memcpy(image.data(), &header, sizeof(header));
+  return image;
+}
+
+static asset_header_t &headerOf(std::vector<uint8_t> &image)
+{
+  return *reinterpret_cast<asset_header_t *>(image.data());
+}
+
+static asset_status_t parse(const std::vector<uint8_t> &image,
+                            bool checkCrc = true)
+{
+  asset_image_t parsed;
+  return parseAssetImage(image.data(), image.size(), parsed, checkCrc);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_hash_and_crc_reference_values()
+{
+  // FNV-1a and zlib.crc32 reference values, as used by pack_assets.py
+  TEST_ASSERT_EQUAL_HEX32(0x811c9dc5, assetNameHash(""));
+  TEST_ASSERT_EQUAL_HEX32(0xe40c292c, assetNameHash("a"));
+  TEST_ASSERT_EQUAL_HEX32(0xbf9cf968, assetNameHash("foobar"));
+  TEST_ASSERT_EQUAL_HEX32(0xcbf43926,
+                          assetCrc32(reinterpret_cast<const uint8_t *>(
+                                       "123456789"), 9));
+}
+
+void test_every_asset_is_found()
+{
+  const std::vector<uint8_t> image = buildImage(ASSETS);
+  asset_image_t parsed;
+  TEST_ASSERT_EQUAL(ASSET_OK, parseAssetImage(image.data(), image.size(),
+                                              parsed));
+  TEST_ASSERT_EQUAL(ASSETS.size(), parsed.count);
+  for (const test_asset_t &a : ASSETS)
+  {
+    uint32_t length = 0xffffffff;
+    const uint8_t *blob = findAsset(parsed, a.name, a.type, &length);
+    TEST_ASSERT_NOT_NULL(blob);
+    TEST_ASSERT_EQUAL(0, (blob - image.data()) % 4);
+    TEST_ASSERT_EQUAL(a.blob.size(), length);
+    TEST_ASSERT_EQUAL_MEMORY(a.blob.data(), blob, length);
+  }
+}
+
+void test_missing_name_or_wrong_type_is_not_found()
+{
+  const std::vector<uint8_t> image = buildImage(ASSETS);
+  asset_image_t parsed;
+  parseAssetImage(image.data(), image.size(), parsed);
+  TEST_ASSERT_NULL(findAsset(parsed, "FreeSans_14pt8b", ASSET_FONT, nullptr));
+  TEST_ASSERT_NULL(findAsset(parsed, "icon_atlas", ASSET_FONT, nullptr));
+
+  asset_image_t empty;
+  const std::vector<uint8_t> none = buildImage({});
+  TEST_ASSERT_EQUAL(ASSET_OK, parseAssetImage(none.data(), none.size(),
+                                              empty));
+  TEST_ASSERT_NULL(findAsset(empty, "icon_atlas", ASSET_ICON_ATLAS, nullptr));
+}
+
+/* The image may be followed by the rest of the partition (erased flash).
+ */
+void test_image_in_larger_partition()
+{
+  std::vector<uint8_t> image = buildImage(ASSETS);
+  const size_t imageSize = image.size();
+  image.resize(imageSize + 4096, 0xff);
+  asset_image_t parsed;
+  TEST_ASSERT_EQUAL(ASSET_OK, parseAssetImage(image.data(), image.size(),
+                                              parsed));
+  TEST_ASSERT_EQUAL(imageSize, parsed.size);
+}
+
+void test_damaged_images_are_rejected()
+{
+  const std::vector<uint8_t> good = buildImage(ASSETS);
+  std::vector<uint8_t> image;
+
+  image.assign(good.begin(), good.begin() + 16);
+  TEST_ASSERT_EQUAL(ASSET_TOO_SMALL, parse(image));
+  image.assign(good.begin(), good.end() - 1);
+  TEST_ASSERT_EQUAL(ASSET_TOO_SMALL, parse(image));
+  TEST_ASSERT_EQUAL(ASSET_BAD_MAGIC, parse(std::vector<uint8_t>(64, 0xff)));
+
+  image = good;
+  headerOf(image).version = ASSET_IMAGE_VERSION + 1;
+  TEST_ASSERT_EQUAL(ASSET_BAD_VERSION, parse(image));
+
+  image = good;
+  image[sizeof(asset_header_t) + 3] ^= 0x10;
+  TEST_ASSERT_EQUAL(ASSET_BAD_CRC, parse(image));
+  TEST_ASSERT_EQUAL(ASSET_OK, parse(image, false));
+
+  image = good;
+  headerOf(image).index_offset += 2;
+  TEST_ASSERT_EQUAL(ASSET_BAD_INDEX, parse(image, false));
+  image = good;
+  headerOf(image).count += 1;
+  TEST_ASSERT_EQUAL(ASSET_BAD_INDEX, parse(image, false));
+
+  // entries out of order, misaligned and past the end of the image
+  asset_entry_t *index;
+  image = good;
+  index = reinterpret_cast<asset_entry_t *>(
+            image.data() + headerOf(image).index_offset);
+  std::swap(index[0], index[1]);
+  TEST_ASSERT_EQUAL(ASSET_BAD_INDEX, parse(image, false));
+  image = good;
+  index = reinterpret_cast<asset_entry_t *>(
+            image.data() + headerOf(image).index_offset);
+  index[2].offset += 1;
+  TEST_ASSERT_EQUAL(ASSET_BAD_INDEX, parse(image, false));
+  image = good;
+  index = reinterpret_cast<asset_entry_t *>(
+            image.data() + headerOf(image).index_offset);
+  index[2].length = headerOf(image).image_size;
+  TEST_ASSERT_EQUAL(ASSET_BAD_INDEX, parse(image, false));
+}
+
+/* Images are read from a file on the host, like pack_assets.py --list does.
+ */
+void test_image_read_from_file()
+{
+  const std::vector<uint8_t> image = buildImage(ASSETS);
+  const char *path = "test_asset_index.bin";
+  FILE *f = fopen(path, "wb");
+  TEST_ASSERT_NOT_NULL(f);
+  fwrite(image.data(), 1, image.size(), f);
+  fclose(f);
+
+  f = fopen(path, "rb");
+  TEST_ASSERT_NOT_NULL(f);
+  std::vector<uint8_t> read(image.size() + 64);
+  read.resize(fread(read.data(), 1, read.size(), f));
+  fclose(f);
+  remove(path);
+
+  asset_image_t parsed;
+  TEST_ASSERT_EQUAL(ASSET_OK, parseAssetImage(read.data(), read.size(),
+                                              parsed));
+  uint32_t length;
+  TEST_ASSERT_NOT_NULL(findAsset(parsed, "unicode_16", ASSET_UNICODE_FONT,
+                                 &length));
+  TEST_ASSERT_EQUAL(6, length);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_hash_and_crc_reference_values);
+  RUN_TEST(test_every_asset_is_found);
+  RUN_TEST(test_missing_name_or_wrong_type_is_not_found);
+  RUN_TEST(test_image_in_larger_partition);
+  RUN_TEST(test_damaged_images_are_rejected);
+  RUN_TEST(test_image_read_from_file);
+  return UNITY_END();
+}
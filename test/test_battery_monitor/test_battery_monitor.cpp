@@ -0,0 +1,147 @@
+/* Unit tests for the battery voltage filter and charge table.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <unity.h>
+
+#include "battery_monitor.h"
+
+// as in config.cpp
+static const uint32_t MIN_MV = 3000;
+static const uint32_t MAX_MV = 4200;
+
+/* The curve the table was sampled from, in percent.
+ */
+static float sigmoidPercent(uint32_t v)
+{
+  const float x = (float)(v - MIN_MV) / (MAX_MV - MIN_MV);
+  return std::fmin(100.0f, 105 - 105 / (1 + std::pow(1.724f * x, 5.5f)));
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* The charge never drops as the voltage rises, and follows the curve.
+ */
+void test_permille_is_monotonic_and_follows_the_curve()
+{
+  uint32_t prev = 0;
+  for (uint32_t v = 2800; v <= 4400; ++v)
+  {
+    const uint32_t p = batteryPermille(v, MIN_MV, MAX_MV);
+    TEST_ASSERT_TRUE(p >= prev);
+    TEST_ASSERT_TRUE(p <= 1000);
+    if (v > MIN_MV && v < MAX_MV)
+    {
+      TEST_ASSERT_FLOAT_WITHIN(1.0f, sigmoidPercent(v), p / 10.0f);
+    }
+    prev = p;
+  }
+  TEST_ASSERT_EQUAL(0, batteryPermille(MIN_MV, MIN_MV, MAX_MV));
+  TEST_ASSERT_EQUAL(1000, batteryPermille(MAX_MV, MIN_MV, MAX_MV));
+  TEST_ASSERT_EQUAL(0, batteryPermille(3500, MAX_MV, MIN_MV));
+  // the thresholds in config.cpp
+  TEST_ASSERT_EQUAL(20, batteryPercent(3535, MIN_MV, MAX_MV));
+  TEST_ASSERT_EQUAL(10, batteryPercent(3462, MIN_MV, MAX_MV));
+}
+
+void test_trimmed_mean_drops_outliers()
+{
+  uint16_t samples[BATTERY_ADC_SAMPLES];
+  for (int i = 0; i < BATTERY_ADC_SAMPLES; ++i)
+  {
+    samples[i] = 2000 + (i % 3);
+  }
+  samples[2] = 0;
+  samples[7] = 4095;
+  samples[11] = 3000;
+  TEST_ASSERT_UINT32_WITHIN(1, 2001, trimmedMean(samples,
+                                                 BATTERY_ADC_SAMPLES));
+
+  uint16_t few[2] = {10, 20};
+  TEST_ASSERT_EQUAL(15, trimmedMean(few, 2));
+  TEST_ASSERT_EQUAL(0, trimmedMean(few, 0));
+}
+
+/* The estimate is kept in the filter across wakes. An invalid filter (cold
+ * boot, RTC memory lost) starts at the reading.
+ */
+void test_filter_starts_at_first_reading_and_is_kept()
+{
+  battery_filter_t f = {};
+  TEST_ASSERT_EQUAL(3900, updateBatteryFilter(f, 3900));
+  TEST_ASSERT_EQUAL_HEX32(BATTERY_FILTER_MAGIC, f.magic);
+
+  // the next wake moves a quarter of the way to the reading
+  const battery_filter_t kept = f;
+  TEST_ASSERT_EQUAL(3890, updateBatteryFilter(f, 3860));
+  f = kept;
+  f.magic = 0;
+  TEST_ASSERT_EQUAL(3860, updateBatteryFilter(f, 3860));
+}
+
+/* Noise is smoothed, the estimate follows a slow discharge and a step (charger
+ * plugged in) is taken over at once.
+ */
+void test_filter_smooths_noise_and_restarts_on_steps()
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> noise(-20, 20);
+  battery_filter_t f = {};
+  double rawSq = 0;
+  double filteredSq = 0;
+  int n = 0;
+  for (int wake = 0; wake < 2000; ++wake)
+  {
+    const uint32_t truth = 4000 - wake / 10; // 1 mV per 10 wakes
+    const uint32_t reading = truth + noise(rng);
+    const int32_t filtered = updateBatteryFilter(f, reading);
+    if (wake >= 20)
+    {
+      rawSq += std::pow((double)reading - truth, 2);
+      filteredSq += std::pow((double)filtered - truth, 2);
+      ++n;
+    }
+  }
+  const double rawRms = std::sqrt(rawSq / n);
+  const double filteredRms = std::sqrt(filteredSq / n);
+  TEST_ASSERT_TRUE(filteredRms < rawRms / 2);
+
+  const uint32_t before = updateBatteryFilter(f, 3800);
+  TEST_ASSERT_TRUE(before < 3820);
+  TEST_ASSERT_EQUAL(4150, updateBatteryFilter(f, 4150));
+  // a step just within the limit is filtered
+  TEST_ASSERT_EQUAL(4150 - BATTERY_FILTER_STEP_MV / 4,
+                    updateBatteryFilter(f, 4150 - BATTERY_FILTER_STEP_MV));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_permille_is_monotonic_and_follows_the_curve);
+  RUN_TEST(test_trimmed_mean_drops_outliers);
+  RUN_TEST(test_filter_starts_at_first_reading_and_is_kept);
+  RUN_TEST(test_filter_smooths_noise_and_restarts_on_steps);
+  return UNITY_END();
+}
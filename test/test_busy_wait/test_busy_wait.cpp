@@ -0,0 +1,244 @@
+/* Unit tests for the e-paper BUSY wait.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <unity.h>
+
+#include "busy_wait.h"
+#include "config.h"
+// the ESP-IDF calls it makes are stubbed by each test, so it is compiled here
+// instead of being listed in build_src_filter
+#include "busy_wait.cpp"
+
+const uint8_t PIN_EPD_BUSY = 25;
+
+/* A simulated BUSY pin and the sleep API around it. The panel releases the pin
+ * at releaseUs (simulated time), a level wake ends a light sleep once the pin
+ * is at the armed level.
+ */
+static struct
+{
+  int64_t            nowUs;
+  int64_t            releaseUs;
+  int                busyLevel;
+  int                wakeLevel; // -1 if not armed
+  bool               gpioWake;
+  bool               timerWake;
+  uint64_t           timerUs;
+  esp_sleep_source_t cause;
+  int                samples;    // pin reads
+  int                releaseAt;  // release once this many reads were made
+} sim;
+
+static int pinLevel()
+{
+  return sim.nowUs >= sim.releaseUs ? !sim.busyLevel : sim.busyLevel;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+  TEST_ASSERT_EQUAL(PIN_EPD_BUSY, gpio_num);
+  if (++sim.samples == sim.releaseAt)
+  {
+    sim.releaseUs = sim.nowUs; // released right after this read
+    return sim.busyLevel;
+  }
+  return pinLevel();
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+  TEST_ASSERT_TRUE(intr_type == GPIO_INTR_LOW_LEVEL
+                   || intr_type == GPIO_INTR_HIGH_LEVEL);
+  sim.wakeLevel = intr_type == GPIO_INTR_HIGH_LEVEL;
+  return 0;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num)
+{
+  sim.wakeLevel = -1;
+  return 0;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup()
+{
+  sim.gpioWake = true;
+  return 0;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us)
+{
+  sim.timerWake = true;
+  sim.timerUs = time_in_us;
+  return 0;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source)
+{
+  if (source == ESP_SLEEP_WAKEUP_GPIO)
+  {
+    sim.gpioWake = false;
+  }
+  if (source == ESP_SLEEP_WAKEUP_TIMER)
+  {
+    sim.timerWake = false;
+  }
+  return 0;
+}
+
+esp_err_t esp_light_sleep_start()
+{
+  TEST_ASSERT_TRUE(sim.timerWake);
+  const int64_t timeoutUs = sim.nowUs + sim.timerUs;
+  // the wake level is the released level, reached at releaseUs
+  const bool wakes = sim.gpioWake && sim.wakeLevel == !sim.busyLevel;
+  if (wakes && sim.releaseUs < timeoutUs)
+  {
+    sim.nowUs = std::max(sim.nowUs, sim.releaseUs);
+    sim.cause = ESP_SLEEP_WAKEUP_GPIO;
+  }
+  else
+  {
+    sim.nowUs = timeoutUs;
+    sim.cause = ESP_SLEEP_WAKEUP_TIMER;
+  }
+  return 0;
+}
+
+esp_sleep_source_t esp_sleep_get_wakeup_cause()
+{
+  return sim.cause;
+}
+
+int64_t esp_timer_get_time()
+{
+  return sim.nowUs;
+}
+
+/* GxEPD2_EPD::_waitWhileBusy with a busy callback, returns the simulated time
+ * at which the wait ended. A callback call that does not sleep is counted as
+ * 1ms of polling.
+ */
+static int64_t waitWhileBusy(int busyLevel, int64_t timeoutUs)
+{
+  const int64_t start = sim.nowUs;
+  while (gpio_get_level(PIN_EPD_BUSY) == busyLevel)
+  {
+    const uint32_t sleeps = getBusyWaitStats().sleeps;
+    busyWaitLightSleep(&busyLevel);
+    if (getBusyWaitStats().sleeps == sleeps)
+    {
+      sim.nowUs += 1000;
+    }
+    if (sim.nowUs - start > timeoutUs)
+    {
+      break;
+    }
+  }
+  return sim.nowUs;
+}
+
+static void beginRefresh(int busyLevel, int64_t releaseUs)
+{
+  sim = {};
+  sim.busyLevel = busyLevel;
+  sim.releaseUs = releaseUs;
+  sim.wakeLevel = -1;
+  resetBusyWaitStats();
+}
+
+void setUp()
+{
+  setBusyWaitSleepAllowed(true);
+}
+
+void tearDown()
+{
+}
+
+void test_wakes_on_release_for_both_polarities()
+{
+  for (int level = 0; level <= 1; ++level)
+  {
+    beginRefresh(level, 15500000);
+    TEST_ASSERT_EQUAL(15500000, waitWhileBusy(level, 30000000));
+    const busy_wait_stats_t &s = getBusyWaitStats();
+    // 2s timer wakes until the release, then one GPIO wake
+    TEST_ASSERT_EQUAL(8, s.sleeps);
+    TEST_ASSERT_EQUAL(7, s.timer_wakes);
+    TEST_ASSERT_EQUAL(15500000, s.sleep_us);
+    TEST_ASSERT_EQUAL(-1, sim.wakeLevel);
+    TEST_ASSERT_FALSE(sim.gpioWake);
+    TEST_ASSERT_FALSE(sim.timerWake);
+  }
+}
+
+/* The panel is released after GxEPD2 read the pin but before the callback
+ * samples it. The callback must not sleep (a wake armed on the sampled level
+ * would only end at the timeout), the wait costs a single 1ms poll.
+ */
+void test_release_before_callback_does_not_sleep()
+{
+  beginRefresh(LOW, INT64_MAX);
+  sim.releaseAt = 1;
+  TEST_ASSERT_EQUAL(1000, waitWhileBusy(LOW, 30000000));
+  TEST_ASSERT_EQUAL(0, getBusyWaitStats().sleeps);
+  TEST_ASSERT_EQUAL(-1, sim.wakeLevel);
+}
+
+/* Released after the callback checked the pin, the armed level wake ends the
+ * sleep right away.
+ */
+void test_release_after_check_wakes_at_once()
+{
+  beginRefresh(HIGH, INT64_MAX);
+  sim.releaseAt = 2;
+  TEST_ASSERT_EQUAL(0, waitWhileBusy(HIGH, 30000000));
+  TEST_ASSERT_EQUAL(1, getBusyWaitStats().sleeps);
+  TEST_ASSERT_EQUAL(0, getBusyWaitStats().timer_wakes);
+}
+
+void test_stuck_busy_ends_at_the_gxepd2_timeout()
+{
+  beginRefresh(LOW, INT64_MAX);
+  TEST_ASSERT_EQUAL(22000000, waitWhileBusy(LOW, 20000000));
+  TEST_ASSERT_EQUAL(11, getBusyWaitStats().timer_wakes);
+}
+
+void test_polls_while_sleep_not_allowed()
+{
+  beginRefresh(LOW, 50000);
+  setBusyWaitSleepAllowed(false);
+  TEST_ASSERT_EQUAL(50000, waitWhileBusy(LOW, 20000000));
+  TEST_ASSERT_EQUAL(0, getBusyWaitStats().sleeps);
+  TEST_ASSERT_FALSE(sim.gpioWake);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_wakes_on_release_for_both_polarities);
+  RUN_TEST(test_release_before_callback_does_not_sleep);
+  RUN_TEST(test_release_after_check_wakes_at_once);
+  RUN_TEST(test_stuck_busy_ends_at_the_gxepd2_timeout);
+  RUN_TEST(test_polls_while_sleep_not_allowed);
+  return UNITY_END();
+}
@@ -0,0 +1,178 @@
+/* Unit tests for the in-memory capture display.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <vector>
+#include <unity.h>
+
+#include "capture_display.h"
+#include "raster.h"
+
+/* Decodes the base64 lines of a plane from the serial output, the way
+ * tools/render_capture.py does. Returns an empty vector if the plane is not
+ * in the output.
+ */
+static std::vector<uint8_t> decodePlane(const std::string &out,
+                                        const std::string &name)
+{
+  static const std::string b64 =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::vector<uint8_t> plane;
+  size_t pos = out.find("[capture] plane " + name + " P4");
+  if (pos == std::string::npos)
+  {
+    return plane;
+  }
+  pos = out.find('\n', pos) + 1;
+  const size_t end = out.find("[capture] end plane " + name, pos);
+  uint32_t acc = 0;
+  int bits = 0;
+  for (size_t i = pos; i < end; ++i)
+  {
+    const size_t v = b64.find(out[i]);
+    if (v == std::string::npos)
+    {
+      continue; // line breaks and padding
+    }
+    acc = (acc << 6) | v;
+    bits += 6;
+    if (bits >= 8)
+    {
+      bits -= 8;
+      plane.push_back((acc >> bits) & 0xff);
+    }
+  }
+  return plane;
+}
+
+static bool pixel(const std::vector<uint8_t> &plane, int w, int x, int y)
+{
+  return plane[y * ((w + 7) / 8) + x / 8] & (0x80 >> (x & 7));
+}
+
+void setUp()
+{
+  Serial.output.clear();
+}
+
+void tearDown()
+{
+}
+
+void test_three_color_planes_round_trip()
+{
+  const int W = 21;
+  const int H = 5;
+  CaptureDisplay d(W, H, true);
+  d.init();
+  d.firstPage();
+  d.drawPixel(0, 0, GxEPD_BLACK);
+  d.drawPixel(20, 4, GxEPD_RED);
+  d.fillRect(3, 1, 10, 3, GxEPD_BLACK);
+  d.drawPixel(5, 2, GxEPD_WHITE);
+  fillPatternRect(d, 14, 0, 7, 5, PATTERN_HATCH_EVEN_ROWS, GxEPD_RED,
+                  patternSpans(d));
+  d.drawFastHLine(-4, 4, 8, GxEPD_BLACK);
+  TEST_ASSERT_FALSE(d.nextPage());
+
+  TEST_ASSERT_TRUE(Serial.output.find("[capture] frame 0 21x5 planes=2")
+                   != std::string::npos);
+  const std::vector<uint8_t> black = decodePlane(Serial.output, "black");
+  const std::vector<uint8_t> accent = decodePlane(Serial.output, "accent");
+  TEST_ASSERT_EQUAL(3 * H, black.size());
+  TEST_ASSERT_EQUAL(3 * H, accent.size());
+  for (int y = 0; y < H; ++y)
+  {
+    for (int x = 0; x < W; ++x)
+    {
+      bool k = (x == 0 && y == 0) || (x >= 3 && x < 13 && y >= 1 && y < 4)
+               || (y == 4 && x < 4);
+      if (x == 5 && y == 2)
+      {
+        k = false;
+      }
+      const bool a = (x == 20 && y == 4)
+                     || (x >= 14 && y % 2 == 0 && x % 2 == 0);
+      TEST_ASSERT_EQUAL(k, pixel(black, W, x, y));
+      TEST_ASSERT_EQUAL(a, pixel(accent, W, x, y));
+    }
+  }
+}
+
+/* Without an accent plane (black and white panels) colors are drawn black.
+ */
+void test_black_white_panel_draws_accent_black()
+{
+  CaptureDisplay d(16, 2, false);
+  d.init();
+  d.firstPage();
+  d.drawPixel(1, 0, GxEPD_RED);
+  d.fillRect(8, 1, 8, 1, GxEPD_RED);
+  d.nextPage();
+  const std::vector<uint8_t> black = decodePlane(Serial.output, "black");
+  TEST_ASSERT_EQUAL(4, black.size());
+  TEST_ASSERT_EQUAL_HEX8(0x40, black[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, black[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, black[2]);
+  TEST_ASSERT_EQUAL_HEX8(0xff, black[3]);
+  TEST_ASSERT_TRUE(decodePlane(Serial.output, "accent").empty());
+}
+
+/* Without frame planes (init() not called, or the allocation failed) drawing
+ * does nothing and the frame is reported as dropped.
+ */
+void test_missing_planes_drop_the_frame()
+{
+  CaptureDisplay d(800, 480, true);
+  d.firstPage();
+  d.drawPixel(1, 1, GxEPD_BLACK);
+  d.fillRect(0, 0, 800, 480, GxEPD_RED);
+  d.setRotation(1);
+  d.fillRect(0, 0, 10, 10, GxEPD_BLACK);
+  fillPatternRect(d, 0, 0, 50, 50, PATTERN_SOLID, GxEPD_BLACK,
+                  patternSpans(d));
+  TEST_ASSERT_FALSE(d.nextPage());
+  TEST_ASSERT_TRUE(Serial.output.find("[capture] frame 0 dropped")
+                   != std::string::npos);
+  TEST_ASSERT_TRUE(Serial.output.find("[capture] plane") == std::string::npos);
+}
+
+void test_timings_are_summed_per_call_site()
+{
+  CaptureDisplay d(8, 1, false);
+  d.init();
+  d.firstPage();
+  static const char *label = "drawCurrentConditions(current, daily[0])";
+  d.recordTiming(label, 10);
+  d.recordTiming(label, 25);
+  d.nextPage();
+  TEST_ASSERT_TRUE(
+    Serial.output.find("[capture] timing drawCurrentConditions 35 us 2 calls")
+    != std::string::npos);
+  TEST_ASSERT_TRUE(Serial.output.find("[capture] timing total 35 us")
+                   != std::string::npos);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_three_color_planes_round_trip);
+  RUN_TEST(test_black_white_panel_draws_accent_black);
+  RUN_TEST(test_missing_planes_drop_the_frame);
+  RUN_TEST(test_timings_are_summed_per_call_site);
+  return UNITY_END();
+}
@@ -0,0 +1,248 @@
+/* Unit tests for the weather condition icon lookup.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <unity.h>
+#include <Arduino.h>
+
+// The tables are checked in the default build (icons compiled in). The
+// getBitmap() of icons.h is renamed, the atlas one of icon_atlas.cpp is linked
+// into the test too.
+#undef ICON_ATLAS
+#define getBitmap getOriginalBitmap
+// icons.h takes a while to compile, so only this test includes it
+#include "condition_icons.cpp"
+
+/* The lookup as it was before the tables, a switch per bitmap size.
+ */
+template <int BitmapSize>
+const uint8_t *getConditionsBitmap(int id, bool day, bool moon, bool cloudy,
+                                   bool windy)
+{
+  switch (id)
+  {
+  // Group 2xx: Thunderstorm
+  case 200: // Thunderstorm  thunderstorm with light rain     11d
+  case 201: // Thunderstorm  thunderstorm with rain           11d
+  case 202: // Thunderstorm  thunderstorm with heavy rain     11d
+  case 210: // Thunderstorm  light thunderstorm               11d
+  case 211: // Thunderstorm  thunderstorm                     11d
+  case 212: // Thunderstorm  heavy thunderstorm               11d
+  case 221: // Thunderstorm  ragged thunderstorm              11d
+    if (!cloudy && day)          {return getBitmap(wi_day_thunderstorm, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_thunderstorm, BitmapSize);}
+    return getBitmap(wi_thunderstorm, BitmapSize);
+  case 230: // Thunderstorm  thunderstorm with light drizzle  11d
+  case 231: // Thunderstorm  thunderstorm with drizzle        11d
+  case 232: // Thunderstorm  thunderstorm with heavy drizzle  11d
+    if (!cloudy && day)          {return getBitmap(wi_day_storm_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_storm_showers, BitmapSize);}
+    return getBitmap(wi_storm_showers, BitmapSize);
+  // Group 3xx: Drizzle
+  case 300: // Drizzle       light intensity drizzle          09d
+  case 301: // Drizzle       drizzle                          09d
+  case 302: // Drizzle       heavy intensity drizzle          09d
+  case 310: // Drizzle       light intensity drizzle rain     09d
+  case 311: // Drizzle       drizzle rain                     09d
+  case 312: // Drizzle       heavy intensity drizzle rain     09d
+  case 313: // Drizzle       shower rain and drizzle          09d
+  case 314: // Drizzle       heavy shower rain and drizzle    09d
+  case 321: // Drizzle       shower drizzle                   09d
+    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
+    return getBitmap(wi_showers, BitmapSize);
+  // Group 5xx: Rain
+  case 500: // Rain          light rain                       10d
+  case 501: // Rain          moderate rain                    10d
+  case 502: // Rain          heavy intensity rain             10d
+  case 503: // Rain          very heavy rain                  10d
+  case 504: // Rain          extreme rain                     10d
+    if (!cloudy && day && windy)          {return getBitmap(wi_day_rain_wind, BitmapSize);}
+    if (!cloudy && day)                   {return getBitmap(wi_day_rain, BitmapSize);}
+    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_rain_wind, BitmapSize);}
+    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_rain, BitmapSize);}
+    if (windy)                            {return getBitmap(wi_rain_wind, BitmapSize);}
+    return getBitmap(wi_rain, BitmapSize);
+  case 511: // Rain          freezing rain                    13d
+    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
+    return getBitmap(wi_rain_mix, BitmapSize);
+  case 520: // Rain          light intensity shower rain      09d
+  case 521: // Rain          shower rain                      09d
+  case 522: // Rain          heavy intensity shower rain      09d
+  case 531: // Rain          ragged shower rain               09d
+    if (!cloudy && day)          {return getBitmap(wi_day_showers, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_showers, BitmapSize);}
+    return getBitmap(wi_showers, BitmapSize);
+  // Group 6xx: Snow
+  case 600: // Snow          light snow                       13d
+  case 601: // Snow          Snow                             13d
+  case 602: // Snow          Heavy snow                       13d
+    if (!cloudy && day && windy)          {return getBitmap(wi_day_snow_wind, BitmapSize);}
+    if (!cloudy && day)                   {return getBitmap(wi_day_snow, BitmapSize);}
+    if (!cloudy && !day && moon && windy) {return getBitmap(wi_night_alt_snow_wind, BitmapSize);}
+    if (!cloudy && !day && moon)          {return getBitmap(wi_night_alt_snow, BitmapSize);}
+    if (windy)                            {return getBitmap(wi_snow_wind, BitmapSize);}
+    return getBitmap(wi_snow, BitmapSize);
+  case 611: // Snow          Sleet                            13d
+  case 612: // Snow          Light shower sleet               13d
+  case 613: // Snow          Shower sleet                     13d
+    if (!cloudy && day)          {return getBitmap(wi_day_sleet, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_sleet, BitmapSize);}
+    return getBitmap(wi_sleet, BitmapSize);
+  case 615: // Snow          Light rain and snow              13d
+  case 616: // Snow          Rain and snow                    13d
+  case 620: // Snow          Light shower snow                13d
+  case 621: // Snow          Shower snow                      13d
+  case 622: // Snow          Heavy shower snow                13d
+    if (!cloudy && day)          {return getBitmap(wi_day_rain_mix, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_alt_rain_mix, BitmapSize);}
+    return getBitmap(wi_rain_mix, BitmapSize);
+  // Group 7xx: Atmosphere
+  case 701: // Mist          mist                             50d
+    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
+    return getBitmap(wi_fog, BitmapSize);
+  case 711: // Smoke         Smoke                            50d
+    return getBitmap(wi_smoke, BitmapSize);
+  case 721: // Haze          Haze                             50d
+    if (day && !cloudy) {return getBitmap(wi_day_haze, BitmapSize);}
+    return getBitmap(wi_dust, BitmapSize);
+  case 731: // Dust          sand/dust whirls                 50d
+    return getBitmap(wi_sandstorm, BitmapSize);
+  case 741: // Fog           fog                              50d
+    if (!cloudy && day)          {return getBitmap(wi_day_fog, BitmapSize);}
+    if (!cloudy && !day && moon) {return getBitmap(wi_night_fog, BitmapSize);}
+    return getBitmap(wi_fog, BitmapSize);
+  case 751: // Sand          sand                             50d
+    return getBitmap(wi_sandstorm, BitmapSize);
+  case 761: // Dust          dust                             50d
+    return getBitmap(wi_dust, BitmapSize);
+  case 762: // Ash           volcanic ash                     50d
+    return getBitmap(wi_volcano, BitmapSize);
+  case 771: // Squall        squalls                          50d
+    return getBitmap(wi_cloudy_gusts, BitmapSize);
+  case 781: // Tornado       tornado                          50d
+    return getBitmap(wi_tornado, BitmapSize);
+  // Group 800: Clear
+  case 800: // Clear         clear sky                        01d 01n
+    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
+    if (!day && moon)  {return getBitmap(wi_night_clear, BitmapSize);}
+    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
+    return getBitmap(wi_day_sunny, BitmapSize);
+  // Group 80x: Clouds
+  case 801: // Clouds        few clouds: 11-25%               02d 02n
+    if (windy)         {return getBitmap(wi_strong_wind, BitmapSize);}
+    if (!day && moon)  {return getBitmap(wi_night_alt_partly_cloudy, BitmapSize);}
+    if (!day && !moon) {return getBitmap(wi_stars, BitmapSize);}
+    return getBitmap(wi_day_sunny_overcast, BitmapSize);
+  case 802: // Clouds        scattered clouds: 25-50%         03d 03n
+  case 803: // Clouds        broken clouds: 51-84%            04d 04n
+    if (windy && day)           {return getBitmap(wi_day_cloudy_gusts, BitmapSize);}
+    if (windy && !day && moon)  {return getBitmap(wi_night_alt_cloudy_gusts, BitmapSize);}
+    if (windy && !day && !moon) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
+    if (!day && moon)           {return getBitmap(wi_night_alt_cloudy, BitmapSize);}
+    if (!day && !moon)          {return getBitmap(wi_cloud, BitmapSize);}
+    return getBitmap(wi_day_cloudy, BitmapSize);
+  case 804: // Clouds        overcast clouds: 85-100%         04d 04n
+    if (windy) {return getBitmap(wi_cloudy_gusts, BitmapSize);}
+    return getBitmap(wi_cloudy, BitmapSize);
+  default:
+    // maybe this is a new getBitmap in one of the existing groups
+    if (id >= 200 && id < 300) {return getBitmap(wi_thunderstorm, BitmapSize);}
+    if (id >= 300 && id < 400) {return getBitmap(wi_showers, BitmapSize);}
+    if (id >= 500 && id < 600) {return getBitmap(wi_rain, BitmapSize);}
+    if (id >= 600 && id < 700) {return getBitmap(wi_snow, BitmapSize);}
+    if (id >= 700 && id < 800) {return getBitmap(wi_fog, BitmapSize);}
+    if (id >= 800 && id < 900) {return getBitmap(wi_cloudy, BitmapSize);}
+    return getBitmap(wi_na, BitmapSize);
+  }
+} // end getConditionsBitmap
+#undef getBitmap
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+template <int BitmapSize>
+static void checkEveryIdAndState()
+{
+  int checked = 0;
+  for (int id = -100; id <= 1200; ++id)
+  {
+    for (int state = 0; state < 16; ++state)
+    {
+      const bool day = state & 1;
+      const bool moon = state & 2;
+      const bool cloudy = state & 4;
+      const bool windy = state & 8;
+      const uint8_t *expected = getConditionsBitmap<BitmapSize>(id, day, moon,
+                                                                cloudy, windy);
+      const uint8_t *actual = getConditionsBitmap(id, day, moon, cloudy,
+                                                  windy, BitmapSize);
+      if (expected != actual)
+      {
+        char msg[80];
+        snprintf(msg, sizeof(msg), "id %d, state %d, size %d", id, state,
+                 BitmapSize);
+        TEST_FAIL_MESSAGE(msg);
+      }
+      ++checked;
+    }
+  }
+  TEST_ASSERT_EQUAL(1301 * 16, checked);
+}
+
+void test_conditions_bitmap_32()
+{
+  checkEveryIdAndState<32>();
+}
+
+void test_conditions_bitmap_64()
+{
+  checkEveryIdAndState<64>();
+}
+
+void test_conditions_bitmap_196()
+{
+  checkEveryIdAndState<196>();
+}
+
+/* Sizes without a column in the table still go through getBitmap().
+ */
+void test_other_sizes()
+{
+  TEST_ASSERT_EQUAL_PTR(wi_day_sunny_48x48,
+                        getConditionsBitmap(800, true, false, false, false,
+                                            48));
+  TEST_ASSERT_EQUAL_PTR(wi_na_16x16,
+                        getConditionsBitmap(42, true, false, false, false, 16));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_conditions_bitmap_32);
+  RUN_TEST(test_conditions_bitmap_64);
+  RUN_TEST(test_conditions_bitmap_196);
+  RUN_TEST(test_other_sizes);
+  return UNITY_END();
+}
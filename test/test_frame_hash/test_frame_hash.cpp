@@ -0,0 +1,219 @@
+/* Unit tests for the frame hashing display wrapper.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#include "fonts/FreeSans/FreeSans_9pt8b.h"
+#include "capture_display.h"
+#include "frame_hash.h"
+#include "raster.h"
+
+static const int W = 64;
+static const int H = 48;
+static FrameHashDisplay<CaptureDisplay> display(W, H, true);
+
+// a 12x3 bitmap, 6 bytes, so the hash has to fold a partial word
+static uint8_t icon[6] = {0x0f, 0xf0, 0xaa, 0x50, 0xff, 0x30};
+
+/* Variations of the same frame, each changing one detail.
+ */
+enum variant_t
+{
+  BASE,
+  PIXEL_MOVED,
+  LINE_COLOR,
+  ICON_BIT,
+  ICON_MOVED,
+  GLYPH,
+  SPAN_PATTERN,
+  NUM_VARIANTS
+};
+
+static uint32_t hashFrame(variant_t v, const uint8_t *bitmap)
+{
+  display.beginHash();
+  display.setFont(&FreeSans_9pt8b);
+  display.fillScreen(GxEPD_WHITE);
+  display.drawPixel(v == PIXEL_MOVED ? 4 : 3, 7, GxEPD_BLACK);
+  display.drawLine(0, 0, 40, 20, v == LINE_COLOR ? GxEPD_RED : GxEPD_BLACK);
+  display.fillRect(10, 10, 5, 5, GxEPD_RED);
+  display.drawInvertedBitmap(v == ICON_MOVED ? 21 : 20, 30, bitmap, 12, 3,
+                             GxEPD_BLACK);
+  display.drawChar(30, 5, v == GLYPH ? 'b' : 'a', GxEPD_BLACK, GxEPD_WHITE,
+                   1, 1);
+  fillPatternRect(display, 40, 40, 20, 6,
+                  v == SPAN_PATTERN ? PATTERN_HATCH_ODD_ROWS
+                                    : PATTERN_HATCH_EVEN_ROWS,
+                  GxEPD_BLACK, patternSpans(display));
+  return display.endHash();
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_same_frame_same_hash()
+{
+  TEST_ASSERT_EQUAL_HEX32(hashFrame(BASE, icon), hashFrame(BASE, icon));
+}
+
+/* The same bitmap decoded into another buffer (e.g. a different atlas cache
+ * slot on the next wake) must not change the hash.
+ */
+void test_bitmap_hashed_by_content_not_address()
+{
+  std::vector<uint8_t> copy(icon, icon + sizeof(icon));
+  TEST_ASSERT_EQUAL_HEX32(hashFrame(BASE, icon),
+                          hashFrame(BASE, copy.data()));
+}
+
+/* A buffer that is rewritten in place (the rotated wind arrow) must change
+ * the hash when its content changes.
+ */
+void test_reused_buffer_with_new_content_changes_hash()
+{
+  uint8_t buf[sizeof(icon)];
+  memcpy(buf, icon, sizeof(icon));
+  const uint32_t before = hashFrame(BASE, buf);
+  buf[sizeof(buf) - 1] ^= 0x01; // last byte, in the partial word
+  TEST_ASSERT_NOT_EQUAL(before, hashFrame(BASE, buf));
+  buf[sizeof(buf) - 1] ^= 0x01;
+  buf[0] ^= 0x80;
+  TEST_ASSERT_NOT_EQUAL(before, hashFrame(BASE, buf));
+}
+
+void test_every_change_changes_hash()
+{
+  uint32_t hashes[NUM_VARIANTS];
+  uint8_t flipped[sizeof(icon)];
+  memcpy(flipped, icon, sizeof(icon));
+  flipped[2] ^= 0x04;
+  for (int v = 0; v < NUM_VARIANTS; ++v)
+  {
+    hashes[v] = hashFrame(static_cast<variant_t>(v),
+                          v == ICON_BIT ? flipped : icon);
+  }
+  for (int a = 0; a < NUM_VARIANTS; ++a)
+  {
+    for (int b = a + 1; b < NUM_VARIANTS; ++b)
+    {
+      TEST_ASSERT_NOT_EQUAL(hashes[a], hashes[b]);
+    }
+  }
+}
+
+void test_hashing_draws_nothing()
+{
+  display.init();
+  display.firstPage();
+  std::vector<uint8_t> before(display.blackPlane(),
+                              display.blackPlane() + (W / 8) * H);
+  hashFrame(BASE, icon);
+  TEST_ASSERT_EQUAL_MEMORY(before.data(), display.blackPlane(), before.size());
+
+  // and drawing still works after hashing
+  display.drawPixel(0, 0, GxEPD_BLACK);
+  TEST_ASSERT_EQUAL_HEX8(0x80, display.blackPlane()[0]);
+}
+
+/* A synthetic 800x480 frame of about the weather screen's size: 600 glyphs,
+ * 31 icons, rects and pixels.
+ */
+static void drawBenchFrame(FrameHashDisplay<CaptureDisplay> &d,
+                           const uint8_t *bitmap)
+{
+  d.setFont(&FreeSans_9pt8b);
+  d.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 600; ++i)
+  {
+    d.drawChar(10 + (i % 60) * 13, 20 + (i / 60) * 22,
+               'A' + (i % 58), GxEPD_BLACK, GxEPD_BLACK, 1, 1);
+  }
+  for (int i = 0; i < 31; ++i)
+  {
+    d.drawInvertedBitmap(5 + (i % 16) * 49, 250 + (i / 16) * 50, bitmap, 48,
+                         48, GxEPD_BLACK);
+  }
+  for (int i = 0; i < 24; ++i)
+  {
+    d.fillRect(40 + i * 30, 400, 25, 70, GxEPD_RED);
+    d.drawPixel(40 + i * 30, 395, GxEPD_BLACK);
+  }
+  return;
+}
+
+/* The hash pass has to stay much cheaper than the render pass it saves.
+ */
+void test_hash_pass_vs_render_pass()
+{
+  const int n = 20;
+  static FrameHashDisplay<CaptureDisplay> bench(800, 480, true);
+  std::vector<uint8_t> bitmap(6 * 48);
+  for (size_t i = 0; i < bitmap.size(); ++i)
+  {
+    bitmap[i] = static_cast<uint8_t>(i * 37);
+  }
+  bench.init();
+  bench.firstPage();
+
+  auto t0 = std::chrono::steady_clock::now();
+  uint32_t hash = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    bench.beginHash();
+    drawBenchFrame(bench, bitmap.data());
+    hash = bench.endHash();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i)
+  {
+    drawBenchFrame(bench, bitmap.data());
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  const double hashUs =
+    std::chrono::duration<double, std::micro>(t1 - t0).count() / n;
+  const double renderUs =
+    std::chrono::duration<double, std::micro>(t2 - t1).count() / n;
+
+  char msg[96];
+  snprintf(msg, sizeof(msg), "hash pass %.1f us, render pass %.1f us (%08x)",
+           hashUs, renderUs, static_cast<unsigned>(hash));
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_THAN(static_cast<int>(renderUs), static_cast<int>(hashUs));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_same_frame_same_hash);
+  RUN_TEST(test_bitmap_hashed_by_content_not_address);
+  RUN_TEST(test_reused_buffer_with_new_content_changes_hash);
+  RUN_TEST(test_every_change_changes_hash);
+  RUN_TEST(test_hashing_draws_nothing);
+  RUN_TEST(test_hash_pass_vs_render_pass);
+  return UNITY_END();
+}
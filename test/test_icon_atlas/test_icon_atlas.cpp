@@ -0,0 +1,168 @@
+/* Unit tests for the compressed icon atlas.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+
+// The original bitmaps, through the getBitmap() that icons.h defines without
+// the atlas.
+#undef ICON_ATLAS
+#define getBitmap getOriginalBitmap
+#include "icons/icons.h"
+#undef getBitmap
+#define ICON_ATLAS
+
+#include "capture_display.h"
+#include "frame_hash.h"
+#include "icon_atlas.h"
+#include "icons/icons_atlas.h"
+
+const unsigned char *getBitmap(icon_name_t icon, size_t size);
+
+static const int NUM_ICONS = sizeof(ICON_ATLAS_SLOT) / sizeof(ICON_ATLAS_SLOT[0]);
+
+static size_t bitmapBytes(size_t size)
+{
+  return ((size + 7) / 8) * size;
+}
+
+void setUp()
+{
+  clearIconCache();
+}
+
+void tearDown()
+{
+}
+
+/* Every packed icon decodes to exactly the original bitmap, icons that are
+ * not packed are not in the atlas.
+ */
+void test_atlas_round_trip()
+{
+  int packed = 0;
+  for (int i = 0; i < NUM_ICONS; ++i)
+  {
+    const icon_name_t icon = static_cast<icon_name_t>(i);
+    for (uint16_t size : ICON_ATLAS_SIZES)
+    {
+      const unsigned char *original = getOriginalBitmap(icon, size);
+      if (ICON_ATLAS_SLOT[i] == ICON_ATLAS_NONE)
+      {
+        continue;
+      }
+      TEST_ASSERT_NOT_NULL(original);
+      const unsigned char *decoded = getBitmap(icon, size);
+      TEST_ASSERT_NOT_NULL(decoded);
+      TEST_ASSERT_EQUAL_MEMORY(original, decoded, bitmapBytes(size));
+      ++packed;
+    }
+  }
+  // 150 bitmaps according to icons_atlas.h
+  TEST_ASSERT_EQUAL(150, packed);
+}
+
+/* Streaming the runs draws the same pixels as the decoded bitmap.
+ */
+void test_draw_atlas_icon_matches_bitmap()
+{
+  CaptureDisplay streamed(200, 200, false);
+  CaptureDisplay bitmap(200, 200, false);
+  streamed.init();
+  bitmap.init();
+  for (int i = 0; i < NUM_ICONS; ++i)
+  {
+    if (ICON_ATLAS_SLOT[i] == ICON_ATLAS_NONE)
+    {
+      continue;
+    }
+    const icon_name_t icon = static_cast<icon_name_t>(i);
+    for (uint16_t size : ICON_ATLAS_SIZES)
+    {
+      streamed.firstPage();
+      bitmap.firstPage();
+      TEST_ASSERT_TRUE(drawAtlasIcon(streamed, 2, 1, icon, size,
+                                     GxEPD_BLACK));
+      bitmap.drawInvertedBitmap(2, 1, getOriginalBitmap(icon, size), size,
+                                size, GxEPD_BLACK);
+      TEST_ASSERT_EQUAL_MEMORY(bitmap.blackPlane(), streamed.blackPlane(),
+                               bitmapBytes(200));
+    }
+  }
+}
+
+/* Cycling through more icons than the cache holds evicts and re-decodes them
+ * into other heap buffers. The decoded content, and so the frame hash, must
+ * not depend on the buffer.
+ */
+void test_evicted_icons_decode_and_hash_the_same()
+{
+  std::vector<icon_name_t> icons;
+  for (int i = 0; i < NUM_ICONS && icons.size() < 20; ++i)
+  {
+    if (ICON_ATLAS_SLOT[i] != ICON_ATLAS_NONE)
+    {
+      icons.push_back(static_cast<icon_name_t>(i));
+    }
+  }
+  FrameHashDisplay<CaptureDisplay> display(200, 200, false);
+  auto hashIcon = [&](icon_name_t icon)
+  {
+    display.beginHash();
+    display.drawInvertedBitmap(0, 0, getBitmap(icon, 64), 64, 64,
+                               GxEPD_BLACK);
+    return display.endHash();
+  };
+
+  const uint32_t first = hashIcon(icons[0]);
+  for (int round = 0; round < 3; ++round)
+  {
+    for (icon_name_t icon : icons)
+    {
+      TEST_ASSERT_EQUAL_MEMORY(getOriginalBitmap(icon, 64),
+                               getBitmap(icon, 64), bitmapBytes(64));
+      // the 196px icons take most of the cache budget
+      getBitmap(icon, 196);
+    }
+    TEST_ASSERT_EQUAL_HEX32(first, hashIcon(icons[0]));
+  }
+  TEST_ASSERT_NOT_EQUAL(first, hashIcon(icons[1]));
+}
+
+void test_missing_icon_is_blank()
+{
+  const unsigned char *blank = getBitmap(house, 32); // not in the atlas
+  TEST_ASSERT_NOT_NULL(blank);
+  for (size_t i = 0; i < bitmapBytes(32); ++i)
+  {
+    TEST_ASSERT_EQUAL_HEX8(0xff, blank[i]);
+  }
+  CaptureDisplay d(8, 8, false);
+  TEST_ASSERT_FALSE(drawAtlasIcon(d, 0, 0, house, 32, GxEPD_BLACK));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_atlas_round_trip);
+  RUN_TEST(test_draw_atlas_icon_matches_bitmap);
+  RUN_TEST(test_evicted_icons_decode_and_hash_the_same);
+  RUN_TEST(test_missing_icon_is_blank);
+  return UNITY_END();
+}
@@ -0,0 +1,162 @@
+/* Unit tests for the indoor history ring.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <unity.h>
+
+#include "indoor_history.h"
+
+static const uint16_t PERIOD = 15;        // minutes
+static const time_t   T0 = 1700000100;    // on the 15 minute grid
+static const int      COLUMNS = 40;
+static const int      SPC = INDOOR_HISTORY_CAPACITY / COLUMNS; // 6
+
+static indoor_history_t history;
+static float temp[COLUMNS];
+static float humidity[COLUMNS];
+
+static indoor_trend_t trend()
+{
+  indoor_trend_t t = {};
+  t.temp = temp;
+  t.humidity = humidity;
+  t.columns = COLUMNS;
+  getIndoorTrend(history, t);
+  return t;
+}
+
+/* Appends a sample at slot n after T0, the temperature is n / 10 °C.
+ */
+static void append(int n, float pressure = 100000)
+{
+  appendIndoorSample(history, PERIOD, T0 + n * PERIOD * 60,
+                     20 + n / 10.0f, 50, pressure);
+}
+
+void setUp()
+{
+  history = {};
+}
+
+void tearDown()
+{
+}
+
+/* A wake every 4 slots (an hour with a 15 minute grid) stores one sample per
+ * wake and three missing samples in between.
+ */
+void test_slots_follow_the_wake_grid()
+{
+  for (int n = 0; n <= 40; n += 4)
+  {
+    append(n);
+  }
+  TEST_ASSERT_EQUAL(41, history.count);
+  // RTC drift of a few minutes either way keeps the slot
+  appendIndoorSample(history, PERIOD, T0 + 40 * PERIOD * 60 + 200, 99, 50,
+                     100000);
+  TEST_ASSERT_EQUAL(41, history.count);
+  appendIndoorSample(history, PERIOD, T0 + 44 * PERIOD * 60 - 200, 24.4f, 50,
+                     100000);
+  TEST_ASSERT_EQUAL(45, history.count);
+
+  int known = 0;
+  const indoor_trend_t t = trend();
+  for (int c = 0; c < COLUMNS; ++c)
+  {
+    known += !std::isnan(temp[c]);
+  }
+  TEST_ASSERT_TRUE(known > 0);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 20.0f, t.temp_min);
+}
+
+/* Wakes within a column do not change the decoded trend, it changes once the
+ * column is complete.
+ */
+void test_trend_is_stable_within_a_column()
+{
+  // start on a column boundary
+  const uint32_t first = (T0 / (PERIOD * 60));
+  const int start = SPC - first % SPC;
+  for (int n = start; n < start + 100; ++n)
+  {
+    append(n);
+  }
+  // slot 99 is in the column of slots 96 to 101, which is still filling
+  float before[COLUMNS];
+  trend();
+  for (int c = 0; c < COLUMNS; ++c)
+  {
+    before[c] = temp[c];
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 20 + (start + 95) / 10.0f,
+                           before[COLUMNS - 1]);
+  append(start + 100);
+  trend();
+  TEST_ASSERT_EQUAL_MEMORY(before, temp, sizeof(before));
+
+  append(start + 101); // completes the column
+  trend();
+  TEST_ASSERT_EQUAL_FLOAT(before[COLUMNS - 1], temp[COLUMNS - 2]);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 20 + (start + 101) / 10.0f,
+                           temp[COLUMNS - 1]);
+}
+
+/* The pressure change is taken 3 hours back, or from the nearest older sample
+ * and scaled to 3 hours when the wakes are further apart.
+ */
+void test_pressure_tendency()
+{
+  append(0, 100000);
+  append(12, 100150); // 3 hours later, +1.5 hPa
+  indoor_trend_t t = trend();
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.5f, t.pressure_change);
+  TEST_ASSERT_EQUAL(INDOOR_TENDENCY_RISING, t.tendency);
+
+  // wakes every 5 slots: the sample 15 slots back is used and scaled
+  history = {};
+  for (int n = 0; n <= 15; n += 5)
+  {
+    append(n, 100000 - n * 10); // -0.1 hPa per slot
+  }
+  t = trend();
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, -1.2f, t.pressure_change);
+  TEST_ASSERT_EQUAL(INDOOR_TENDENCY_FALLING, t.tendency);
+
+  // nothing within 4.5 hours
+  history = {};
+  append(0, 100000);
+  append(19, 100300);
+  t = trend();
+  TEST_ASSERT_TRUE(std::isnan(t.pressure_change));
+  TEST_ASSERT_EQUAL(INDOOR_TENDENCY_UNKNOWN, t.tendency);
+
+  // the newest pressure is missing
+  history = {};
+  append(0, 100000);
+  append(12, NAN);
+  TEST_ASSERT_EQUAL(INDOOR_TENDENCY_UNKNOWN, trend().tendency);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_slots_follow_the_wake_grid);
+  RUN_TEST(test_trend_is_stable_within_a_column);
+  RUN_TEST(test_pressure_tendency);
+  return UNITY_END();
+}
@@ -0,0 +1,212 @@
+/* Unit tests for the pipelined paged display.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <unity.h>
+
+#include "busy_wait.h"
+#include "config.h"
+// the ESP-IDF calls it makes are stubbed by each test, so it is compiled here
+// instead of being listed in build_src_filter
+#include "busy_wait.cpp"
+#include "pipelined_display.h"
+#include "raster.h"
+
+static const int W = 800;
+static const int H = 480;
+static const int PLANE = (W / 8) * H;
+
+/* State of the fake panel, shared by the copies of the driver.
+ */
+static struct
+{
+  std::vector<uint8_t> black = std::vector<uint8_t>(PLANE);
+  std::vector<uint8_t> color = std::vector<uint8_t>(PLANE);
+  std::atomic<int>     writes{0};
+  int                  refreshes = 0;
+  int                  transferUs = 0;
+} panel;
+
+const uint8_t PIN_EPD_BUSY = 25;
+static const int BUSY_LEVEL = LOW;
+static std::atomic<int> lightSleeps{0};
+
+// The ESP-IDF calls of busy_wait.cpp. The pin always reads busy, so every
+// busyWaitLightSleep() call that is allowed to sleep does.
+int gpio_get_level(gpio_num_t) { return BUSY_LEVEL; }
+esp_err_t gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) { return 0; }
+esp_err_t gpio_wakeup_disable(gpio_num_t) { return 0; }
+esp_err_t esp_sleep_enable_gpio_wakeup() { return 0; }
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return 0; }
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t) { return 0; }
+esp_err_t esp_light_sleep_start() { ++lightSleeps; return 0; }
+esp_sleep_source_t esp_sleep_get_wakeup_cause()
+{
+  return ESP_SLEEP_WAKEUP_GPIO;
+}
+int64_t esp_timer_get_time() { return 0; }
+
+/* Records the written pages, a transfer takes transferUs like the SPI write
+ * and the BUSY wait of a page would. Each write and the refresh end with a
+ * call of the busy callback, like GxEPD2's waits.
+ */
+struct FakeDriver
+{
+  static const int16_t WIDTH = W;
+  static const int16_t HEIGHT = H;
+
+  void init(uint32_t, bool, uint16_t, bool) {}
+
+  void writeImage(const uint8_t *black, const uint8_t *color, int16_t x,
+                  int16_t y, int16_t w, int16_t h, bool, bool, bool)
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(panel.transferUs));
+    const size_t offset = y * (W / 8);
+    const size_t n = h * (w / 8);
+    memcpy(panel.black.data() + offset, black, n);
+    memcpy(panel.color.data() + offset, color, n);
+    ++panel.writes;
+    busyWaitLightSleep(&BUSY_LEVEL);
+  }
+
+  void refresh(bool)
+  {
+    ++panel.refreshes;
+    busyWaitLightSleep(&BUSY_LEVEL);
+  }
+
+  void hibernate() {}
+};
+
+static PipelinedDisplay3C<FakeDriver, H / 2> display{FakeDriver()};
+
+/* Draws a test frame, each page re-runs this like the render code does.
+ * renderUs models the time spent rendering a page.
+ */
+static void drawFrame(int renderUs)
+{
+  display.fillRect(10, 10, 100, 300, GxEPD_BLACK);
+  display.fillRect(200, 230, 50, 20, GxEPD_RED); // crosses the page boundary
+  display.drawPixel(799, 479, GxEPD_BLACK);
+  fillPatternRect(display, 400, 100, 64, 300, PATTERN_HATCH_EVEN_ROWS,
+                  GxEPD_RED, patternSpans(display));
+  std::this_thread::sleep_for(std::chrono::microseconds(renderUs));
+}
+
+/* Returns the time in ms to render and write a frame.
+ */
+static double renderFrame(int renderUs)
+{
+  const auto t0 = std::chrono::steady_clock::now();
+  display.firstPage();
+  do
+  {
+    drawFrame(renderUs);
+  } while (display.nextPage());
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+// GxEPD2_3C buffer format, a cleared bit is an inked pixel
+static bool inked(const std::vector<uint8_t> &plane, int x, int y)
+{
+  return !(plane[y * (W / 8) + x / 8] & (0x80 >> (x & 7)));
+}
+
+void setUp()
+{
+  panel.writes = 0;
+  panel.refreshes = 0;
+  panel.transferUs = 0;
+  lightSleeps = 0;
+}
+
+void tearDown()
+{
+}
+
+void test_pages_assemble_the_frame()
+{
+  renderFrame(0);
+  TEST_ASSERT_EQUAL(2, panel.writes.load());
+  TEST_ASSERT_EQUAL(1, panel.refreshes);
+  for (int y = 0; y < H; ++y)
+  {
+    for (int x = 0; x < W; ++x)
+    {
+      const bool k = (x >= 10 && x < 110 && y >= 10 && y < 310)
+                     || (x == 799 && y == 479);
+      const bool r = (x >= 200 && x < 250 && y >= 230 && y < 250)
+                     || (x >= 400 && x < 464 && y >= 100 && y < 400
+                         && y % 2 == 0 && x % 2 == 0);
+      TEST_ASSERT_EQUAL(k, inked(panel.black, x, y));
+      TEST_ASSERT_EQUAL(r, inked(panel.color, x, y));
+    }
+  }
+}
+
+/* The transfer task must never light sleep while the other core renders,
+ * only the final refresh may.
+ */
+void test_no_light_sleep_during_transfer()
+{
+  panel.transferUs = 2000;
+  renderFrame(1000);
+  TEST_ASSERT_EQUAL(2, panel.writes.load());
+  TEST_ASSERT_EQUAL(1, panel.refreshes);
+  TEST_ASSERT_EQUAL(1, lightSleeps.load()); // the refresh
+
+  // paged drawing without the pipeline may sleep in every wait
+  busyWaitLightSleep(&BUSY_LEVEL);
+  TEST_ASSERT_EQUAL(2, lightSleeps.load());
+}
+
+/* Models the 7.5" 3-color panel: rendering a page takes about as long as
+ * writing it. Sequential paging (GxEPD2_3C) costs the sum of both per page,
+ * pipelined paging overlaps the first transfer with the second render.
+ */
+void test_pipelined_speedup()
+{
+  const int renderUs = 40000;
+  panel.transferUs = 40000;
+  const double pipelinedMs = renderFrame(renderUs);
+  const double sequentialMs = 2 * (renderUs + panel.transferUs) / 1000.0;
+  char msg[96];
+  snprintf(msg, sizeof(msg), "sequential %.0f ms (modelled), pipelined %.0f ms",
+           sequentialMs, pipelinedMs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_THAN(static_cast<int>(sequentialMs),
+                        static_cast<int>(pipelinedMs));
+}
+
+int main()
+{
+  display.init();
+  UNITY_BEGIN();
+  RUN_TEST(test_pages_assemble_the_frame);
+  RUN_TEST(test_no_light_sleep_during_transfer);
+  RUN_TEST(test_pipelined_speedup);
+  return UNITY_END();
+}
@@ -0,0 +1,414 @@
+/* Unit tests for the raster primitives.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+
+#include "capture_display.h"
+#include "frame_hash.h"
+#include "raster.h"
+#include "icons/icons_24x24.h"
+#include "icons/icons_48x48.h"
+
+// the pre-rendered wind arrows of WIND_ICONS_360, by degree
+#define W(deg) wind_direction_meteorological_##deg##deg_24x24
+static const uint8_t *const WIND_ARROWS_24[360] = {
+  W(0), W(1), W(2), W(3), W(4), W(5), W(6), W(7),
+  W(8), W(9), W(10), W(11), W(12), W(13), W(14), W(15),
+  W(16), W(17), W(18), W(19), W(20), W(21), W(22), W(23),
+  W(24), W(25), W(26), W(27), W(28), W(29), W(30), W(31),
+  W(32), W(33), W(34), W(35), W(36), W(37), W(38), W(39),
+  W(40), W(41), W(42), W(43), W(44), W(45), W(46), W(47),
+  W(48), W(49), W(50), W(51), W(52), W(53), W(54), W(55),
+  W(56), W(57), W(58), W(59), W(60), W(61), W(62), W(63),
+  W(64), W(65), W(66), W(67), W(68), W(69), W(70), W(71),
+  W(72), W(73), W(74), W(75), W(76), W(77), W(78), W(79),
+  W(80), W(81), W(82), W(83), W(84), W(85), W(86), W(87),
+  W(88), W(89), W(90), W(91), W(92), W(93), W(94), W(95),
+  W(96), W(97), W(98), W(99), W(100), W(101), W(102), W(103),
+  W(104), W(105), W(106), W(107), W(108), W(109), W(110), W(111),
+  W(112), W(113), W(114), W(115), W(116), W(117), W(118), W(119),
+  W(120), W(121), W(122), W(123), W(124), W(125), W(126), W(127),
+  W(128), W(129), W(130), W(131), W(132), W(133), W(134), W(135),
+  W(136), W(137), W(138), W(139), W(140), W(141), W(142), W(143),
+  W(144), W(145), W(146), W(147), W(148), W(149), W(150), W(151),
+  W(152), W(153), W(154), W(155), W(156), W(157), W(158), W(159),
+  W(160), W(161), W(162), W(163), W(164), W(165), W(166), W(167),
+  W(168), W(169), W(170), W(171), W(172), W(173), W(174), W(175),
+  W(176), W(177), W(178), W(179), W(180), W(181), W(182), W(183),
+  W(184), W(185), W(186), W(187), W(188), W(189), W(190), W(191),
+  W(192), W(193), W(194), W(195), W(196), W(197), W(198), W(199),
+  W(200), W(201), W(202), W(203), W(204), W(205), W(206), W(207),
+  W(208), W(209), W(210), W(211), W(212), W(213), W(214), W(215),
+  W(216), W(217), W(218), W(219), W(220), W(221), W(222), W(223),
+  W(224), W(225), W(226), W(227), W(228), W(229), W(230), W(231),
+  W(232), W(233), W(234), W(235), W(236), W(237), W(238), W(239),
+  W(240), W(241), W(242), W(243), W(244), W(245), W(246), W(247),
+  W(248), W(249), W(250), W(251), W(252), W(253), W(254), W(255),
+  W(256), W(257), W(258), W(259), W(260), W(261), W(262), W(263),
+  W(264), W(265), W(266), W(267), W(268), W(269), W(270), W(271),
+  W(272), W(273), W(274), W(275), W(276), W(277), W(278), W(279),
+  W(280), W(281), W(282), W(283), W(284), W(285), W(286), W(287),
+  W(288), W(289), W(290), W(291), W(292), W(293), W(294), W(295),
+  W(296), W(297), W(298), W(299), W(300), W(301), W(302), W(303),
+  W(304), W(305), W(306), W(307), W(308), W(309), W(310), W(311),
+  W(312), W(313), W(314), W(315), W(316), W(317), W(318), W(319),
+  W(320), W(321), W(322), W(323), W(324), W(325), W(326), W(327),
+  W(328), W(329), W(330), W(331), W(332), W(333), W(334), W(335),
+  W(336), W(337), W(338), W(339), W(340), W(341), W(342), W(343),
+  W(344), W(345), W(346), W(347), W(348), W(349), W(350), W(351),
+  W(352), W(353), W(354), W(355), W(356), W(357), W(358), W(359)
+};
+#undef W
+
+static const uint16_t INK = 0;
+static const uint16_t PAPER = 1;
+
+/* A 1 bit per pixel frame (set bit = ink) that optionally accepts pattern
+ * spans, like the capture display. Without spans every fill goes through
+ * drawPixel, which is the reference.
+ */
+class Canvas : public Adafruit_GFX, public PatternSpanSurface
+{
+public:
+  std::vector<uint8_t> buf;
+  bool useSpans;
+  unsigned long pixels = 0;
+
+  Canvas(int16_t w, int16_t h, bool spans)
+    : Adafruit_GFX(w, h), buf(((w + 7) / 8) * h), useSpans(spans)
+  {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override
+  {
+    ++pixels;
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+    {
+      return;
+    }
+    if (getRotation() == 1)
+    {
+      std::swap(x, y);
+      x = WIDTH - 1 - x;
+    }
+    uint8_t &b = buf[y * ((WIDTH + 7) / 8) + x / 8];
+    const uint8_t bit = 0x80 >> (x & 7);
+    b = color == INK ? (b | bit) : (b & ~bit);
+  }
+
+  bool fillPatternSpan(int16_t x, int16_t y, int16_t w, uint8_t bits,
+                       uint16_t color) override
+  {
+    if (!useSpans || getRotation() != 0)
+    {
+      return false;
+    }
+    fillPatternSpan1bpp(&buf[y * ((WIDTH + 7) / 8)], std::max<int16_t>(x, 0),
+                        std::min<int16_t>(x + w, WIDTH), bits, color == INK);
+    return true;
+  }
+
+  PatternSpanSurface *spans() { return patternSpans(*this); }
+};
+
+static std::mt19937 rng(26);
+
+static int randInt(int lo, int hi)
+{
+  return std::uniform_int_distribution<int>(lo, hi)(rng);
+}
+
+static void fillRandom(Canvas &a, Canvas &b)
+{
+  for (size_t i = 0; i < a.buf.size(); ++i)
+  {
+    a.buf[i] = b.buf[i] = static_cast<uint8_t>(randInt(0, 255));
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* Random rectangles (partly off the surface, any alignment) and patterns,
+ * setting and clearing pixels on random content.
+ */
+void test_pattern_spans_match_pixels()
+{
+  const uint8_t *patterns[] = {PATTERN_SOLID, PATTERN_HATCH_EVEN_ROWS,
+                               PATTERN_HATCH_ODD_ROWS};
+  Canvas fast(203, 61, true);
+  Canvas ref(203, 61, false);
+  for (int n = 0; n < 5000; ++n)
+  {
+    fillRandom(fast, ref);
+    uint8_t randomPattern[8];
+    for (uint8_t &p : randomPattern)
+    {
+      p = static_cast<uint8_t>(randInt(0, 255));
+    }
+    const uint8_t *pattern = n % 4 == 3 ? randomPattern : patterns[n % 4];
+    const int16_t x = randInt(-20, 210);
+    const int16_t y = randInt(-10, 65);
+    const int16_t w = randInt(0, 120);
+    const int16_t h = randInt(0, 40);
+    const uint16_t color = randInt(0, 1) ? INK : PAPER;
+    fillPatternRect(fast, x, y, w, h, pattern, color, fast.spans());
+    fillPatternRect(ref, x, y, w, h, pattern, color);
+    TEST_ASSERT_EQUAL_MEMORY(ref.buf.data(), fast.buf.data(), ref.buf.size());
+  }
+}
+
+void test_pattern_spans_fall_back_when_rotated()
+{
+  Canvas fast(64, 48, true);
+  Canvas ref(64, 48, false);
+  fast.setRotation(1);
+  ref.setRotation(1);
+  fillPatternRect(fast, 3, 5, 30, 50, PATTERN_HATCH_ODD_ROWS, INK,
+                  fast.spans());
+  fillPatternRect(ref, 3, 5, 30, 50, PATTERN_HATCH_ODD_ROWS, INK);
+  TEST_ASSERT_EQUAL_MEMORY(ref.buf.data(), fast.buf.data(), ref.buf.size());
+  TEST_ASSERT_GREATER_THAN(0, fast.pixels);
+}
+
+void test_fill_pattern_rect_1bpp_matches_pixels()
+{
+  Canvas fast(77, 40, true);
+  Canvas ref(77, 40, false);
+  for (int n = 0; n < 2000; ++n)
+  {
+    fillRandom(fast, ref);
+    const int16_t x = randInt(-10, 80);
+    const int16_t y = randInt(-5, 42);
+    const int16_t w = randInt(0, 90);
+    const int16_t h = randInt(0, 20);
+    const bool set = randInt(0, 1);
+    fillPatternRect1bpp(fast.buf.data(), 77, 40, x, y, w, h,
+                        PATTERN_HATCH_EVEN_ROWS, set);
+    fillPatternRect(ref, x, y, w, h, PATTERN_HATCH_EVEN_ROWS,
+                    set ? INK : PAPER);
+    TEST_ASSERT_EQUAL_MEMORY(ref.buf.data(), fast.buf.data(), ref.buf.size());
+  }
+}
+
+/* drawThickLine replaced a line plus shifted copies, it must draw the same
+ * pixels.
+ */
+void test_thick_line_matches_shifted_lines()
+{
+  Canvas thick(120, 90, false);
+  Canvas ref(120, 90, false);
+  for (int n = 0; n < 2000; ++n)
+  {
+    std::fill(thick.buf.begin(), thick.buf.end(), 0);
+    std::fill(ref.buf.begin(), ref.buf.end(), 0);
+    const int16_t x0 = randInt(-10, 130);
+    const int16_t y0 = randInt(-10, 100);
+    const int16_t x1 = randInt(-10, 130);
+    const int16_t y1 = randInt(-10, 100);
+    const uint8_t width = randInt(1, 4);
+    drawThickLine(thick, x0, y0, x1, y1, width, INK);
+    for (int k = 0; k < width; ++k)
+    {
+      ref.drawLine(x0, y0 + k, x1, y1 + k, INK);
+      ref.drawLine(x0 - k, y0, x1 - k, y1, INK);
+    }
+    TEST_ASSERT_EQUAL_MEMORY(ref.buf.data(), thick.buf.data(),
+                             ref.buf.size());
+  }
+}
+
+void test_dotted_line_keeps_phase_when_clipped()
+{
+  Canvas c(40, 4, false);
+  drawDottedHLine(c, -7, 100, 1, 3, INK);
+  for (int16_t x = 0; x < 40; ++x)
+  {
+    const bool set = c.buf[1 * 5 + x / 8] & (0x80 >> (x & 7));
+    TEST_ASSERT_EQUAL((x + 7) % 3 == 0, set);
+  }
+}
+
+/* The precipitation bars of the outlook graph: 24 hatched bars covering
+ * 600x100 pixels, drawn pixel by pixel and with spans.
+ */
+void test_pattern_span_speedup()
+{
+  Canvas fast(800, 480, true);
+  Canvas ref(800, 480, false);
+  const int reps = 200;
+  auto bars = [](Canvas &c)
+  {
+    for (int i = 0; i < 24; ++i)
+    {
+      fillPatternRect(c, 100 + i * 25, 300, 25, 100, PATTERN_HATCH_EVEN_ROWS,
+                      INK, c.spans());
+    }
+  };
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; ++r)
+  {
+    bars(ref);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; ++r)
+  {
+    bars(fast);
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL_MEMORY(ref.buf.data(), fast.buf.data(), ref.buf.size());
+
+  const double pixelUs =
+    std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+  const double spanUs =
+    std::chrono::duration<double, std::micro>(t2 - t1).count() / reps;
+  char msg[96];
+  snprintf(msg, sizeof(msg), "drawPixel %.1f us, spans %.1f us (%.1fx)",
+           pixelUs, spanUs, pixelUs / spanUs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_EQUAL(0, fast.pixels);
+}
+
+static bool inked24(const uint8_t *bitmap, int x, int y)
+{
+  if (x < 0 || y < 0 || x >= 24 || y >= 24)
+  {
+    return false;
+  }
+  return !(bitmap[y * 3 + x / 8] & (0x80 >> (x & 7)));
+}
+
+/* Visual diff of the rotated master arrow against the 360 pre-rendered
+ * arrows. Differences are allowed on the edges of the arrow only: every
+ * differing pixel must have a pixel of the same color within 1px in the
+ * reference.
+ */
+void test_rotated_wind_arrows_match_prerendered()
+{
+  uint8_t rotated[24 * 24 / 8];
+  int totalDiff = 0;
+  int maxDiff = 0;
+  for (int deg = 0; deg < 360; ++deg)
+  {
+    rotateBitmap1bpp(wind_direction_meteorological_0deg_48x48, rotated, 24,
+                     deg);
+    const uint8_t *ref = WIND_ARROWS_24[deg];
+    int diff = 0;
+    for (int y = 0; y < 24; ++y)
+    {
+      for (int x = 0; x < 24; ++x)
+      {
+        const bool ink = inked24(rotated, x, y);
+        if (ink == inked24(ref, x, y))
+        {
+          continue;
+        }
+        ++diff;
+        bool nearby = false;
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+          for (int dx = -1; dx <= 1; ++dx)
+          {
+            const bool inside = x + dx >= 0 && x + dx < 24
+                                && y + dy >= 0 && y + dy < 24;
+            nearby |= inside && inked24(ref, x + dx, y + dy) == ink;
+          }
+        }
+        TEST_ASSERT_TRUE_MESSAGE(nearby, "difference inside the arrow");
+      }
+    }
+    totalDiff += diff;
+    maxDiff = std::max(maxDiff, diff);
+  }
+  char msg[80];
+  snprintf(msg, sizeof(msg), "%.1f of 576 pixels differ on average, %d max",
+           totalDiff / 360.0, maxDiff);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_OR_EQUAL(15, maxDiff);
+  TEST_ASSERT_LESS_OR_EQUAL(8 * 360, totalDiff);
+}
+
+/* getWindBitmap24 renders every direction into the same static buffer. The
+ * frame hash covers the bitmap content, so a new direction changes it.
+ */
+void test_rotated_wind_arrow_changes_frame_hash()
+{
+  static uint8_t bitmap[24 * 24 / 8];
+  FrameHashDisplay<CaptureDisplay> display(64, 64, false);
+  std::vector<std::vector<uint8_t>> contents;
+  std::vector<uint32_t> hashes;
+  for (int deg = 0; deg < 360; ++deg)
+  {
+    rotateBitmap1bpp(wind_direction_meteorological_0deg_48x48, bitmap, 24,
+                     deg);
+    display.beginHash();
+    display.drawInvertedBitmap(20, 20, bitmap, 24, 24, GxEPD_BLACK);
+    hashes.push_back(display.endHash());
+    contents.emplace_back(bitmap, bitmap + sizeof(bitmap));
+  }
+  for (int a = 0; a < 360; ++a)
+  {
+    for (int b = a + 1; b < 360; ++b)
+    {
+      TEST_ASSERT_EQUAL(contents[a] == contents[b], hashes[a] == hashes[b]);
+    }
+  }
+  TEST_ASSERT_NOT_EQUAL(hashes[0], hashes[90]);
+}
+
+void test_rotate_wind_arrow_speed()
+{
+  uint8_t rotated[24 * 24 / 8];
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int deg = 0; deg < 3600; ++deg)
+  {
+    rotateBitmap1bpp(wind_direction_meteorological_0deg_48x48, rotated, 24,
+                     deg % 360);
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  char msg[64];
+  snprintf(msg, sizeof(msg), "%.1f us per rotation",
+           std::chrono::duration<double, std::micro>(t1 - t0).count() / 3600);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_pattern_spans_match_pixels);
+  RUN_TEST(test_pattern_spans_fall_back_when_rotated);
+  RUN_TEST(test_fill_pattern_rect_1bpp_matches_pixels);
+  RUN_TEST(test_thick_line_matches_shifted_lines);
+  RUN_TEST(test_dotted_line_keeps_phase_when_clipped);
+  RUN_TEST(test_pattern_span_speedup);
+  RUN_TEST(test_rotated_wind_arrows_match_prerendered);
+  RUN_TEST(test_rotated_wind_arrow_changes_frame_hash);
+  RUN_TEST(test_rotate_wind_arrow_speed);
+  return UNITY_END();
+}
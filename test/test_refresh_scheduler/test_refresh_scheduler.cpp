@@ -0,0 +1,108 @@
+/* Unit tests for the calibration of the refresh scheduler.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <unity.h>
+
+#include "refresh_scheduler.h"
+
+static const time_t T0 = 1700000000;
+
+static schedule_config_t config()
+{
+  schedule_config_t cfg = {};
+  cfg.min_interval = 15;
+  cfg.nominal_interval = 30;
+  cfg.max_interval = 120;
+  cfg.bed_time = 0;
+  cfg.wake_time = 0; // never in bed
+  cfg.capacity_mah = 500;
+  cfg.target_days = 30;
+  cfg.adaptive = true;
+  return cfg;
+}
+
+/* Runs wakes of 20 s every 30 minutes for two days while the battery follows
+ * permille(hour). Returns the state after the last wake.
+ */
+template <typename Permille>
+static scheduler_state_t run(Permille permille)
+{
+  const schedule_config_t cfg = config();
+  scheduler_state_t s = {};
+  schedule_t out;
+  for (int wake = 0; wake <= 2 * 48; ++wake)
+  {
+    schedule_input_t in = {};
+    in.now = T0 + wake * 1800;
+    in.local.tm_hour = (wake / 2) % 24;
+    in.local.tm_min = (wake % 2) * 30;
+    in.awake_ms = 20000;
+    in.battery_known = true;
+    in.battery_permille = permille(wake / 2.0f);
+    scheduleNextWake(s, cfg, in, out);
+  }
+  return s;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* On USB power the battery does not drain, which must not pull the model
+ * towards zero drain.
+ */
+void test_no_drain_keeps_calibration()
+{
+  const scheduler_state_t s = run([](float) { return 1000u; });
+  TEST_ASSERT_EQUAL(SCHED_CALIBRATION_ONE, s.calibration);
+  TEST_ASSERT_FALSE(s.charging);
+}
+
+/* A battery draining twice as fast as modelled raises the calibration.
+ */
+void test_drain_corrects_calibration()
+{
+  // 96 wakes of 20 s at 90 mA per day is 48 mAh, about 96 permille of 500 mAh
+  const scheduler_state_t s = run([](float hour) {
+    return static_cast<uint32_t>(900 - hour * 2 * 96 / 24);
+  });
+  TEST_ASSERT_TRUE(s.calibration > SCHED_CALIBRATION_ONE * 3 / 2);
+  TEST_ASSERT_FALSE(s.charging);
+}
+
+void test_rising_battery_is_charging()
+{
+  const scheduler_state_t s = run([](float hour) {
+    return static_cast<uint32_t>(500 + hour * 10);
+  });
+  TEST_ASSERT_EQUAL(SCHED_CALIBRATION_ONE, s.calibration);
+  TEST_ASSERT_TRUE(s.charging);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_no_drain_keeps_calibration);
+  RUN_TEST(test_drain_corrects_calibration);
+  RUN_TEST(test_rising_battery_is_charging);
+  return UNITY_END();
+}
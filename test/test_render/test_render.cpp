@@ -0,0 +1,478 @@
+/* Golden-image tests of the render functions.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+#include <unity.h>
+#include <aqi.h>
+
+// The renderer is built in capture mode, so the frame is drawn into the
+// CaptureDisplay planes instead of the panel.
+#include "config.h"
+#undef RENDER_CAPTURE
+#define RENDER_CAPTURE 1
+
+#include "renderer.cpp"
+#include "display_utils.cpp"
+#include "conversions.cpp"
+#include "_strftime.cpp"
+#include "locale.cpp"
+#include "condition_icons.cpp"
+
+// The golden frame is written by the test when run with UPDATE_GOLDEN=1, with
+// the same names as tools/render_capture.py so either one can be used to
+// compare a frame against it.
+static const char *GOLDEN_PLANES[] = {"black", "accent"};
+static const int BENCH_FRAMES = 10;
+
+// config.cpp needs secrets.h, the values the render functions use are the
+// ones of config.cpp.
+const uint8_t PIN_BAT_ADC = 32;
+const uint8_t PIN_EPD_CS = 15;
+const uint8_t PIN_EPD_SCK = 13;
+const uint8_t PIN_EPD_MISO = 12;
+const uint8_t PIN_EPD_MOSI = 14;
+const uint8_t PIN_EPD_PWR = 26;
+const char *TIME_FORMAT = "%H:%M";
+const char *HOUR_FORMAT = "%H";
+const char *DATE_FORMAT = "%a, %B %e";
+const char *REFRESH_TIME_FORMAT = "%x %H:%M";
+const int HOURLY_GRAPH_MAX = 24;
+const uint32_t WARN_BATTERY_VOLTAGE = 3535;
+const uint32_t MAX_BATTERY_VOLTAGE = 4200;
+const uint32_t MIN_BATTERY_VOLTAGE = 3000;
+
+uint16_t analogRead(uint8_t pin)
+{
+  return 0;
+}
+
+void adc_power_acquire(void)
+{
+}
+
+void adc_power_release(void)
+{
+}
+
+esp_adc_cal_value_t esp_adc_cal_characterize(
+  adc_unit_t adc_num, adc_atten_t atten, adc_bits_width_t bit_width,
+  uint32_t default_vref, esp_adc_cal_characteristics_t *chars)
+{
+  return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+uint32_t esp_adc_cal_raw_to_voltage(
+  uint32_t adc_reading, const esp_adc_cal_characteristics_t *chars)
+{
+  return 0;
+}
+
+esp_err_t gpio_hold_en(gpio_num_t gpio_num)
+{
+  return 0;
+}
+
+void gpio_deep_sleep_hold_en(void)
+{
+}
+
+// 2024-06-15 09:00 UTC, the frame is drawn in UTC
+static const int64_t NOW = 1718442000;
+static const int64_t DAY = 86400;
+
+static owm_resp_onecall_t onecall;
+static owm_resp_air_pollution_t air;
+static indoor_history_t indoor;
+static tm timeInfo;
+
+// OpenWeatherMap responses are requested in standard units.
+static float kelvin(float celsius)
+{
+  return celsius + 273.15f;
+}
+
+static void setWeather(owm_weather_t &w, int id, bool day)
+{
+  w.id = id;
+  w.main = "";
+  w.description = "";
+  w.icon = day ? "d" : "n";
+}
+
+/* Replaces the alerts with the items of an alerts array.
+ */
+static void loadAlerts(const std::string &items)
+{
+  const std::string json = "{\"alerts\":[" + items + "]}";
+  onecall.alerts = owm_resp_alerts_t{};
+  alerts_parser_t parser;
+  initAlertsParser(parser, onecall.alerts, &ALERT_MATCHER);
+  TEST_ASSERT_EQUAL(ALERTS_PARSE_DONE,
+                    feedAlertsParser(parser, json.data(), json.size()));
+  return;
+}
+
+/* Fills the responses with a fixed day of weather, air pollution, indoor
+ * history and two alerts.
+ */
+static void loadFixture()
+{
+  static const int HOURLY_IDS[] = {800, 801, 802, 803, 500, 501,
+                                   211, 804, 600, 741, 300, 521};
+  static const int DAILY_IDS[] = {802, 500, 800, 211, 601, 804, 741, 501};
+
+  owm_current_t &c = onecall.current;
+  c.dt = NOW;
+  c.sunrise = NOW - 4 * 3600;
+  c.sunset = NOW + 11 * 3600;
+  c.temp = kelvin(23.4f);
+  c.feels_like = kelvin(24.1f);
+  c.pressure = 1013;
+  c.humidity = 61;
+  c.dew_point = kelvin(15.5f);
+  c.clouds = 40;
+  c.uvi = 6.2f;
+  c.visibility = 10000;
+  c.wind_speed = 3.4f;
+  c.wind_gust = 6.1f;
+  c.wind_deg = 225;
+  c.rain_1h = 0.f;
+  c.snow_1h = 0.f;
+  setWeather(c.weather, 802, true);
+
+  for (int i = 0; i < OWM_NUM_HOURLY; ++i)
+  {
+    owm_hourly_t &h = onecall.hourly[i];
+    const int hour = (9 + i) % 24;
+    h = owm_hourly_t{};
+    h.dt = NOW + i * 3600;
+    h.temp = kelvin(16.f + 0.75f * (hour < 15 ? hour : 30 - hour));
+    h.feels_like = h.temp;
+    h.pressure = 1013;
+    h.humidity = 60;
+    h.pop = (i * 37 % 100) / 100.f;
+    h.rain_1h = (i % 6 == 4) ? 0.25f * (i % 5) : 0.f;
+    h.snow_1h = (i % 11 == 8) ? 0.5f : 0.f;
+    setWeather(h.weather, HOURLY_IDS[i % 12], hour >= 5 && hour < 20);
+  }
+
+  for (int i = 0; i < OWM_NUM_DAILY; ++i)
+  {
+    owm_daily_t &d = onecall.daily[i];
+    d = owm_daily_t{};
+    d.dt = NOW + i * DAY + 3 * 3600;
+    d.sunrise = NOW + i * DAY - 4 * 3600;
+    d.sunset = NOW + i * DAY + 11 * 3600;
+    d.moon_phase = 0.125f * i;
+    d.temp.min = kelvin(12.f + i);
+    d.temp.max = kelvin(24.f + (i * 3 % 5));
+    d.temp.day = kelvin(22.f);
+    d.pop = (i * 29 % 100) / 100.f;
+    d.rain = (i % 3 == 1) ? 2.5f * i : 0.f;
+    d.wind_speed = 2.f + i;
+    d.wind_gust = 4.f + i;
+    d.humidity = 55;
+    d.uvi = 5.f;
+    setWeather(d.weather, DAILY_IDS[i], true);
+  }
+
+  air = owm_resp_air_pollution_t{};
+  for (int i = 0; i < OWM_NUM_AIR_POLLUTION; ++i)
+  {
+    owm_components_t &p = air.components;
+    p.co[i] = 220.f + 5.f * i;
+    p.no[i] = 0.5f;
+    p.no2[i] = 12.f + i % 7;
+    p.o3[i] = 60.f + 2.f * i;
+    p.so2[i] = 3.f;
+    p.pm2_5[i] = 8.f + 0.5f * i;
+    p.pm10[i] = 15.f + i % 5;
+    p.nh3[i] = 1.f;
+    air.dt[i] = NOW - (OWM_NUM_AIR_POLLUTION - 1 - i) * 3600;
+  }
+  const owm_components_t &p = air.components;
+  init_aqi_windows(&air.windows, p.co, p.nh3, p.no, p.no2, p.o3, NULL, p.so2,
+                   p.pm10, p.pm2_5);
+
+  initIndoorHistory(indoor, 30);
+  for (int i = 0; i < 96; ++i)
+  {
+    const time_t t = NOW - (95 - i) * 1800;
+    appendIndoorSample(indoor, 30, t, 20.f + 0.05f * (i % 40),
+                       45.f + 0.5f * (i % 20), 1010.f + 0.1f * i);
+  }
+
+  loadAlerts(
+    "{\"sender_name\":\"NWS\",\"event\":\"Heat Advisory\","
+    "\"start\":1718438400,\"end\":1718481600,"
+    "\"description\":\"Heat index values up to 105 expected.\","
+    "\"tags\":[\"Extreme temperature value\"]},"
+    "{\"sender_name\":\"NWS\",\"event\":\"Flood Watch\","
+    "\"start\":1718452800,\"end\":1718517600,"
+    "\"description\":\"Excessive rainfall may cause flooding.\","
+    "\"tags\":[\"Flood\"]}");
+
+  const time_t now = NOW;
+  gmtime_r(&now, &timeInfo);
+  return;
+}
+
+/* Draws a complete frame the way main.cpp does.
+ */
+static void renderFrame()
+{
+  const String date = "Sat, June 15";
+  initDisplay();
+  do
+  {
+    RENDER_PROFILE(drawCurrentConditions(onecall.current, onecall.daily[0],
+                                         air, 22.5f, 45.f));
+    RENDER_PROFILE(drawIndoorTrend(indoor));
+    RENDER_PROFILE(drawOutlookGraph(onecall.hourly, onecall.daily, timeInfo));
+    RENDER_PROFILE(drawForecast(onecall.daily, timeInfo));
+    RENDER_PROFILE(drawLocationDate("Shanghai", date));
+    RENDER_PROFILE(drawAlerts(onecall.alerts, "Shanghai", date));
+    RENDER_PROFILE(drawStatusBar("", "06/15/24 09:00", -55, 3900));
+  } while (display.nextPage());
+  powerOffDisplay();
+  return;
+}
+
+static std::string goldenPath(const char *plane)
+{
+  std::string dir = __FILE__;
+  dir = dir.substr(0, dir.find_last_of("/\\") + 1);
+  return dir + "golden/frame0_" + plane + ".pbm";
+}
+
+static bool readPbm(const std::string &path, std::vector<uint8_t> &data)
+{
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == nullptr)
+  {
+    return false;
+  }
+  int w = 0;
+  int h = 0;
+  const bool ok = fscanf(f, "P4 %d %d", &w, &h) == 2 && fgetc(f) != EOF
+                  && w == DISP_WIDTH && h == DISP_HEIGHT;
+  data.resize((DISP_WIDTH + 7) / 8 * DISP_HEIGHT);
+  const bool full = ok && fread(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+  return full;
+}
+
+static void writePbm(const std::string &path, const uint8_t *data)
+{
+  FILE *f = fopen(path.c_str(), "wb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path.c_str());
+  fprintf(f, "P4\n%d %d\n", DISP_WIDTH, DISP_HEIGHT);
+  fwrite(data, 1, (DISP_WIDTH + 7) / 8 * DISP_HEIGHT, f);
+  fclose(f);
+  return;
+}
+
+/* Compares a plane with its golden image, reporting the number of differing
+ * pixels and their bounding box.
+ */
+static void checkPlane(const char *name, const uint8_t *plane)
+{
+  const std::string path = goldenPath(name);
+  const char *update = getenv("UPDATE_GOLDEN");
+  if (update != nullptr && update[0] == '1')
+  {
+    writePbm(path, plane);
+    return;
+  }
+
+  std::vector<uint8_t> golden;
+  TEST_ASSERT_TRUE_MESSAGE(readPbm(path, golden),
+                           ("cannot read " + path).c_str());
+  const int stride = (DISP_WIDTH + 7) / 8;
+  int diff = 0;
+  int x0 = DISP_WIDTH, y0 = DISP_HEIGHT, x1 = -1, y1 = -1;
+  for (int y = 0; y < DISP_HEIGHT; ++y)
+  {
+    for (int x = 0; x < DISP_WIDTH; ++x)
+    {
+      const int i = y * stride + x / 8;
+      const uint8_t bit = 0x80 >> (x & 7);
+      if ((plane[i] ^ golden[i]) & bit)
+      {
+        ++diff;
+        x0 = std::min(x0, x);
+        y0 = std::min(y0, y);
+        x1 = std::max(x1, x);
+        y1 = std::max(y1, y);
+      }
+    }
+  }
+  char msg[128];
+  snprintf(msg, sizeof(msg),
+           "%s plane differs from the golden image in %d pixels, "
+           "x %d-%d y %d-%d", name, diff, x0, x1, y0, y1);
+  TEST_ASSERT_EQUAL_MESSAGE(0, diff, msg);
+  return;
+}
+
+void setUp()
+{
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  Serial.output.clear();
+  loadFixture();
+}
+
+void tearDown()
+{
+}
+
+void test_frame_matches_golden()
+{
+  renderFrame();
+  TEST_ASSERT_TRUE(Serial.output.find("[capture] frame") != std::string::npos);
+  TEST_ASSERT_NOT_NULL(display.blackPlane());
+  checkPlane(GOLDEN_PLANES[0], display.blackPlane());
+  TEST_ASSERT_NOT_NULL(display.colorPlane());
+  checkPlane(GOLDEN_PLANES[1], display.colorPlane());
+}
+
+/* Reports the average time of each render function over a number of frames,
+ * from the timings the capture display writes with each frame.
+ */
+void test_render_timing()
+{
+  std::map<std::string, uint64_t> total_us;
+  std::vector<std::string> order;
+  for (int frame = 0; frame < BENCH_FRAMES; ++frame)
+  {
+    Serial.output.clear();
+    renderFrame();
+    const std::string &out = Serial.output;
+    const std::string prefix = "[capture] timing ";
+    for (size_t pos = out.find(prefix); pos != std::string::npos;
+         pos = out.find(prefix, pos + 1))
+    {
+      char label[64];
+      unsigned us = 0;
+      if (sscanf(out.c_str() + pos + prefix.size(), "%63s %u us", label, &us)
+          != 2)
+      {
+        continue;
+      }
+      if (total_us.find(label) == total_us.end())
+      {
+        order.push_back(label);
+      }
+      total_us[label] += us;
+    }
+  }
+
+  TEST_ASSERT_EQUAL(8, order.size()); // the 7 functions and the total
+  for (const std::string &label : order)
+  {
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%-22s %8.1f us", label.c_str(),
+             total_us[label] / static_cast<double>(BENCH_FRAMES));
+    TEST_MESSAGE(msg);
+  }
+}
+
+void test_line_breaks_before_cjk_characters()
+{
+  // 暴 雨 ， 大 风, 3 bytes each
+  const String text = "\u66b4\u96e8\uff0c\u5927\u98ce";
+  int lineEnd = -1;
+  int nextStart = -1;
+  TEST_ASSERT_TRUE(findLineBreak(text, text.length(), true, lineEnd,
+                                 nextStart));
+  TEST_ASSERT_EQUAL(12, lineEnd);
+  TEST_ASSERT_EQUAL(12, nextStart);
+  TEST_ASSERT_TRUE(findLineBreak(text, 12, true, lineEnd, nextStart));
+  TEST_ASSERT_EQUAL(9, lineEnd);
+  // never before the comma, nor before the first character
+  TEST_ASSERT_TRUE(findLineBreak(text, 9, true, lineEnd, nextStart));
+  TEST_ASSERT_EQUAL(3, lineEnd);
+  TEST_ASSERT_FALSE(findLineBreak(text, 3, true, lineEnd, nextStart));
+
+  // spaces are dropped, dashes are kept, a space before a CJK character is
+  // the break rather than the character
+  const String mixed = "Red-alert \u66b4\u96e8";
+  TEST_ASSERT_TRUE(findLineBreak(mixed, mixed.length(), true, lineEnd,
+                                 nextStart));
+  TEST_ASSERT_EQUAL(13, lineEnd);
+  TEST_ASSERT_TRUE(findLineBreak(mixed, 13, true, lineEnd, nextStart));
+  TEST_ASSERT_EQUAL(9, lineEnd);
+  TEST_ASSERT_EQUAL(10, nextStart);
+  TEST_ASSERT_TRUE(findLineBreak(mixed, 9, true, lineEnd, nextStart));
+  TEST_ASSERT_EQUAL(4, lineEnd);
+  TEST_ASSERT_EQUAL(4, nextStart);
+  TEST_ASSERT_FALSE(findLineBreak(mixed, 9, false, lineEnd, nextStart));
+}
+
+/* Reports the time of the alert screen for a zh_CN alert, whose event name
+ * only breaks between CJK characters, next to a Latin one.
+ */
+void test_cjk_alert_timing()
+{
+  static const struct
+  {
+    const char *label;
+    const char *event;
+  } ALERTS[] = {
+    {"en_US", "Hurricane Force Wind Warning For Coastal Waters"},
+    // 上海中心气象台发布暴雨橙色预警信号和雷电黄色预警信号
+    {"zh_CN", "\u4e0a\u6d77\u4e2d\u5fc3\u6c14\u8c61\u53f0\u53d1\u5e03"
+              "\u66b4\u96e8\u6a59\u8272\u9884\u8b66\u4fe1\u53f7\u548c"
+              "\u96f7\u7535\u9ec4\u8272\u9884\u8b66\u4fe1\u53f7"},
+  };
+  for (const auto &a : ALERTS)
+  {
+    loadAlerts(std::string("{\"event\":\"") + a.event
+               + "\",\"start\":1718438400,\"tags\":[\"Rain\"]}");
+    TEST_ASSERT_EQUAL(1, onecall.alerts.count);
+    initDisplay();
+    uint32_t elapsed_us = 0;
+    for (int frame = 0; frame < BENCH_FRAMES; ++frame)
+    {
+      display.firstPage();
+      const uint32_t t0 = micros();
+      drawAlerts(onecall.alerts, "Shanghai", "Sat, June 15");
+      elapsed_us += micros() - t0;
+    }
+    display.nextPage();
+    char msg[96];
+    snprintf(msg, sizeof(msg), "drawAlerts %s %8.1f us", a.label,
+             elapsed_us / static_cast<double>(BENCH_FRAMES));
+    TEST_MESSAGE(msg);
+  }
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_frame_matches_golden);
+  RUN_TEST(test_render_timing);
+  RUN_TEST(test_line_breaks_before_cjk_characters);
+  RUN_TEST(test_cjk_alert_timing);
+  return UNITY_END();
+}
@@ -0,0 +1,466 @@
+/* Unit tests for the asynchronous BMP280 and AHT20 measurement.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unity.h>
+
+#include "sensor_measurement.h"
+
+static const uint8_t BMP_ADDR = 0x76;
+static const uint8_t AHT_ADDR = 0x38;
+// temperature x2, pressure x16, forced mode: 44 ms
+static const uint8_t CTRL_MEAS = BMP280_CTRL_MEAS(2, 5, BMP280_MODE_FORCED);
+
+// the compensation example of the BMP280 datasheet (section 8.2)
+static const Bmp280Calib CALIB = {27504, 26435, -1000, 36477, -10685, 3024,
+                                  2855,  140,   -7,    15500, -14600, 6000};
+static const int32_t ADC_T = 519888;
+static const int32_t ADC_P = 415148;
+
+/* An I2C bus with a simulated BMP280 and AHT20. Conversions take a set time
+ * after they are triggered, and either device can be made to NACK or to stay
+ * busy. A soft reset clears the calibration of the AHT20 until it is
+ * calibrated again.
+ */
+class FakeBus : public SensorBus
+{
+public:
+  uint32_t now = 0;
+  uint32_t transactions = 0;
+
+  uint32_t bmpConversionMs = 44;
+  uint32_t ahtConversionMs = 80;
+  int      bmpNacks = 0;        // transactions to NACK, -1 for all
+  int      ahtNacks = 0;
+  bool     bmpStuck = false;    // never finishes converting
+  bool     ahtStuck = false;
+  bool     ahtCalibrates = true; // the calibration command takes effect
+  int      bmpTriggers = 0;
+  int      ahtTriggers = 0;
+
+  bool write(uint8_t address, const uint8_t *data, size_t len) override
+  {
+    ++transactions;
+    if (nack(address))
+    {
+      return false;
+    }
+    if (address == BMP_ADDR)
+    {
+      bmpReg = data[0];
+      if (len == 2 && data[0] == BMP280_REG_CTRL_MEAS
+          && (data[1] & 0x03) == BMP280_MODE_FORCED)
+      {
+        ++bmpTriggers;
+        bmpReady = now + bmpConversionMs;
+        bmpConverted = false;
+      }
+      return true;
+    }
+    if (len == 3 && data[0] == AHT20_CMD_TRIGGER)
+    {
+      ++ahtTriggers;
+      ahtReady = now + ahtConversionMs;
+    }
+    if (len == 1 && data[0] == AHT20_CMD_SOFT_RESET)
+    {
+      ahtCalibrated = false;
+      ahtReady = now + 20;
+    }
+    if (len == 3 && data[0] == AHT20_CMD_CALIBRATE)
+    {
+      ahtCalibrated = ahtCalibrates;
+      ahtReady = now + 10;
+    }
+    return true;
+  }
+
+  bool read(uint8_t address, uint8_t *data, size_t len) override
+  {
+    ++transactions;
+    if (nack(address))
+    {
+      return false;
+    }
+    if (address == BMP_ADDR)
+    {
+      const bool measuring = bmpStuck || (int32_t)(now - bmpReady) < 0;
+      if (bmpReg == BMP280_REG_STATUS)
+      {
+        data[0] = measuring ? BMP280_STATUS_MEASURING : 0;
+        return true;
+      }
+      if (bmpReg == BMP280_REG_CHIP_ID)
+      {
+        data[0] = BMP280_CHIP_ID;
+        return true;
+      }
+      bmpConverted = bmpConverted || !measuring;
+      // pressure and temperature, 0x80000 until the first conversion
+      const int32_t p = bmpConverted ? ADC_P : 0x80000;
+      const int32_t t = bmpConverted ? ADC_T : 0x80000;
+      const uint8_t raw[6] = {(uint8_t)(p >> 12), (uint8_t)(p >> 4),
+                              (uint8_t)(p << 4),  (uint8_t)(t >> 12),
+                              (uint8_t)(t >> 4),  (uint8_t)(t << 4)};
+      memcpy(data, raw, len < 6 ? len : 6);
+      return true;
+    }
+    // 50 %RH, 25 °C
+    const bool busy = ahtStuck || (int32_t)(now - ahtReady) < 0;
+    const uint8_t raw[6] = {(uint8_t)((ahtCalibrated
+                                       ? AHT20_STATUS_CALIBRATED : 0)
+                                      | (busy ? AHT20_STATUS_BUSY : 0)),
+                            0x80, 0x00, 0x06, 0x00, 0x00};
+    memcpy(data, raw, len < 6 ? len : 6);
+    return true;
+  }
+
+private:
+  uint8_t  bmpReg = 0;
+  uint32_t bmpReady = 0;
+  bool     bmpConverted = false;
+  uint32_t ahtReady = 0;
+  bool     ahtCalibrated = true;
+
+  bool nack(uint8_t address)
+  {
+    int &n = address == BMP_ADDR ? bmpNacks : ahtNacks;
+    if (n == 0)
+    {
+      return false;
+    }
+    if (n > 0)
+    {
+      --n;
+    }
+    return true;
+  }
+};
+
+static FakeBus bus;
+static SensorMeasurement m;
+
+static void configure(uint8_t bmpSamples = 1, uint8_t ahtSamples = 1)
+{
+  m.reset();
+  m.configureBMP280(BMP_ADDR, CALIB, CTRL_MEAS, bmpSamples);
+  m.configureAHT20(AHT_ADDR, ahtSamples);
+}
+
+/* Polls at every deadline until the measurement is done, like await() does.
+ * Returns the number of polls.
+ */
+static int pollToDone(uint32_t limitMs = 5000)
+{
+  int polls = 0;
+  const uint32_t start = bus.now;
+  while (m.poll(bus, bus.now) == MEASUREMENT_PENDING
+         && bus.now - start < limitMs)
+  {
+    bus.now = m.nextDeadline();
+    ++polls;
+  }
+  return polls;
+}
+
+void setUp()
+{
+  bus = FakeBus();
+  bus.now = 1000;
+}
+
+void tearDown()
+{
+}
+
+void test_conversion_time_from_oversampling()
+{
+  TEST_ASSERT_EQUAL(44, bmp280ConversionTime(CTRL_MEAS));
+  TEST_ASSERT_EQUAL(7, bmp280ConversionTime(
+                         BMP280_CTRL_MEAS(1, 1, BMP280_MODE_FORCED)));
+}
+
+void test_nothing_configured_does_not_start()
+{
+  m.reset();
+  TEST_ASSERT_FALSE(m.start(bus, bus.now));
+  TEST_ASSERT_EQUAL(MEASUREMENT_IDLE, m.getState());
+  TEST_ASSERT_EQUAL(0, bus.transactions);
+}
+
+/* The bus is only touched when a deadline has passed, and both sensors
+ * convert at the same time.
+ */
+void test_nominal_measurement()
+{
+  configure();
+  TEST_ASSERT_TRUE(m.start(bus, bus.now));
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.getState());
+  TEST_ASSERT_EQUAL(2, bus.transactions); // both triggers
+  TEST_ASSERT_EQUAL(1044, m.nextDeadline());
+
+  // nothing is due before the BMP280 deadline
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, 1043));
+  TEST_ASSERT_EQUAL(2, bus.transactions);
+
+  bus.now = 1044;
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, bus.now));
+  TEST_ASSERT_TRUE(m.getResult().bmpValid);
+  TEST_ASSERT_FALSE(m.getResult().ahtValid);
+  TEST_ASSERT_EQUAL(1080, m.nextDeadline());
+
+  bus.now = 1080;
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.poll(bus, bus.now));
+  TEST_ASSERT_EQUAL(7, bus.transactions);
+
+  const MeasurementResult &r = m.getResult();
+  TEST_ASSERT_FLOAT_WITHIN(0.005f, 25.08f, r.bmpTemperature);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 100653.27f, r.pressure);
+  TEST_ASSERT_TRUE(r.ahtValid);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 25.0f, r.ahtTemperature);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, r.humidity);
+  TEST_ASSERT_EQUAL(1, m.getAttempts(true));
+  TEST_ASSERT_EQUAL(1, m.getAttempts(false));
+
+  // done stays done
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.poll(bus, bus.now + 1000));
+  TEST_ASSERT_EQUAL(7, bus.transactions);
+}
+
+void test_busy_sensor_is_rechecked()
+{
+  configure();
+  bus.ahtConversionMs = 95;
+  m.start(bus, bus.now);
+  bus.now = 1080;
+  m.poll(bus, 1044);
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, bus.now));
+  TEST_ASSERT_EQUAL(1080 + SensorMeasurement::BUSY_RECHECK_MS,
+                    m.nextDeadline());
+  bus.now = 1090;
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, bus.now));
+  bus.now = 1100;
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.poll(bus, bus.now));
+  TEST_ASSERT_TRUE(m.getResult().ahtValid);
+  TEST_ASSERT_EQUAL(1, bus.ahtTriggers);
+}
+
+/* A NACK is retried after RETRY_INTERVAL_MS without holding up the other
+ * sensor.
+ */
+void test_nack_is_retried()
+{
+  configure();
+  bus.bmpNacks = 1; // the trigger
+  m.start(bus, bus.now);
+  TEST_ASSERT_EQUAL(0, bus.bmpTriggers);
+  TEST_ASSERT_EQUAL(1080, m.nextDeadline());
+
+  bus.now = 1080;
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, bus.now));
+  TEST_ASSERT_TRUE(m.getResult().ahtValid);
+  TEST_ASSERT_EQUAL(1000 + SensorMeasurement::RETRY_INTERVAL_MS,
+                    m.nextDeadline());
+
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_TRUE(m.getResult().bmpValid);
+  TEST_ASSERT_EQUAL(2, m.getAttempts(true));
+  TEST_ASSERT_EQUAL(1544, bus.now);
+}
+
+void test_missing_sensor_gives_up_after_max_attempts()
+{
+  configure();
+  bus.bmpNacks = -1;
+  m.start(bus, bus.now);
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_FALSE(m.getResult().bmpValid);
+  TEST_ASSERT_TRUE(std::isnan(m.getResult().pressure));
+  TEST_ASSERT_TRUE(m.getResult().ahtValid);
+  TEST_ASSERT_EQUAL(SensorMeasurement::MAX_ATTEMPTS, m.getAttempts(true));
+  // the last attempt fails 2 retry intervals after the first
+  TEST_ASSERT_EQUAL(1000 + 2 * SensorMeasurement::RETRY_INTERVAL_MS, bus.now);
+}
+
+/* A sensor that never finishes converting times out after
+ * CONVERSION_TIMEOUT_MS and is triggered again.
+ */
+void test_stuck_sensor_times_out()
+{
+  configure();
+  bus.ahtStuck = true;
+  m.start(bus, bus.now);
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_FALSE(m.getResult().ahtValid);
+  TEST_ASSERT_TRUE(m.getResult().bmpValid);
+  TEST_ASSERT_EQUAL(SensorMeasurement::MAX_ATTEMPTS, bus.ahtTriggers);
+  TEST_ASSERT_EQUAL(SensorMeasurement::MAX_ATTEMPTS, m.getAttempts(false));
+  // each attempt waits out the timeout, then the retry interval
+  const uint32_t attempt = SensorMeasurement::CONVERSION_TIMEOUT_MS
+                           + SensorMeasurement::RETRY_INTERVAL_MS;
+  TEST_ASSERT_UINT32_WITHIN(SensorMeasurement::BUSY_RECHECK_MS,
+                            1000 + 2 * attempt
+                              + SensorMeasurement::CONVERSION_TIMEOUT_MS,
+                            bus.now);
+}
+
+void test_samples_are_averaged()
+{
+  configure(2, 3);
+  m.start(bus, bus.now);
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_EQUAL(2, bus.bmpTriggers);
+  TEST_ASSERT_EQUAL(3, bus.ahtTriggers);
+  TEST_ASSERT_EQUAL(1000 + 2 * SensorMeasurement::AHT20_SAMPLE_INTERVAL_MS
+                      + SensorMeasurement::AHT20_CONVERSION_MS,
+                    bus.now);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, m.getResult().humidity);
+}
+
+void test_deadlines_across_millis_wrap()
+{
+  bus.now = 0xffffffe0;
+  configure();
+  m.start(bus, bus.now);
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, m.poll(bus, bus.now + 1));
+  TEST_ASSERT_EQUAL(2, bus.transactions);
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_EQUAL(0xffffffe0 + 80, bus.now);
+  TEST_ASSERT_TRUE(m.getResult().bmpValid && m.getResult().ahtValid);
+}
+
+/* await() sleeps until each deadline instead of spinning, and never past its
+ * timeout.
+ */
+void test_await_sleeps_between_deadlines()
+{
+  configure();
+  m.start(bus, bus.now);
+  int sleeps = 0;
+  const MeasurementState state = m.await(
+    bus, []() { return bus.now; },
+    [&](uint32_t ms) {
+      ++sleeps;
+      bus.now += ms;
+    },
+    1000);
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, state);
+  TEST_ASSERT_EQUAL(2, sleeps);
+  TEST_ASSERT_EQUAL(1080, bus.now);
+  TEST_ASSERT_EQUAL(7, bus.transactions);
+}
+
+void test_await_times_out()
+{
+  configure();
+  bus.ahtStuck = true;
+  bus.bmpNacks = -1;
+  m.start(bus, bus.now);
+  const MeasurementState state = m.await(
+    bus, []() { return bus.now; }, [](uint32_t ms) { bus.now += ms; }, 300);
+  TEST_ASSERT_EQUAL(MEASUREMENT_PENDING, state);
+  TEST_ASSERT_EQUAL(1300, bus.now);
+
+  // the measurement carries on where await() left it
+  pollToDone();
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE, m.getState());
+  TEST_ASSERT_FALSE(m.getResult().ahtValid);
+  TEST_ASSERT_FALSE(m.getResult().bmpValid);
+}
+
+/* A measurement that was collected while other work went on (poll() between
+ * the API requests) returns right away.
+ */
+void test_await_after_done_does_not_sleep()
+{
+  configure();
+  m.start(bus, bus.now);
+  bus.now += 3000;
+  m.poll(bus, bus.now);
+  int sleeps = 0;
+  TEST_ASSERT_EQUAL(MEASUREMENT_DONE,
+                    m.await(bus, []() { return bus.now; },
+                            [&](uint32_t) { ++sleeps; }, 1000));
+  TEST_ASSERT_EQUAL(0, sleeps);
+}
+
+/* The BMP280 is recognized by its chip ID, other devices are not.
+ */
+void test_bmp280_probe_checks_chip_id()
+{
+  uint8_t chipId = 0;
+  TEST_ASSERT_TRUE(probeBmp280(bus, BMP_ADDR, chipId));
+  TEST_ASSERT_EQUAL_HEX8(BMP280_CHIP_ID, chipId);
+  // the AHT20 answers with its status byte
+  TEST_ASSERT_FALSE(probeBmp280(bus, AHT_ADDR, chipId));
+  bus.bmpNacks = -1;
+  TEST_ASSERT_FALSE(probeBmp280(bus, BMP_ADDR, chipId));
+}
+
+/* The AHT20 is reset and calibrated, waiting while it is busy.
+ */
+void test_aht20_init_calibrates()
+{
+  uint32_t slept = 0;
+  auto sleep = [&](uint32_t ms) {
+    slept += ms;
+    bus.now += ms;
+  };
+  TEST_ASSERT_TRUE(initAht20(bus, AHT_ADDR, sleep));
+  TEST_ASSERT_EQUAL(30, slept);
+
+  bus.ahtCalibrates = false;
+  TEST_ASSERT_FALSE(initAht20(bus, AHT_ADDR, sleep));
+
+  // a device that stays busy is given up on
+  bus = FakeBus();
+  bus.ahtStuck = true;
+  slept = 0;
+  TEST_ASSERT_FALSE(initAht20(bus, AHT_ADDR, sleep));
+  TEST_ASSERT_TRUE(slept <= 20 + 10 * 10);
+
+  bus = FakeBus();
+  bus.ahtNacks = -1;
+  TEST_ASSERT_FALSE(initAht20(bus, AHT_ADDR, sleep));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_conversion_time_from_oversampling);
+  RUN_TEST(test_nothing_configured_does_not_start);
+  RUN_TEST(test_nominal_measurement);
+  RUN_TEST(test_busy_sensor_is_rechecked);
+  RUN_TEST(test_nack_is_retried);
+  RUN_TEST(test_missing_sensor_gives_up_after_max_attempts);
+  RUN_TEST(test_stuck_sensor_times_out);
+  RUN_TEST(test_samples_are_averaged);
+  RUN_TEST(test_deadlines_across_millis_wrap);
+  RUN_TEST(test_await_sleeps_between_deadlines);
+  RUN_TEST(test_await_times_out);
+  RUN_TEST(test_await_after_done_does_not_sleep);
+  RUN_TEST(test_bmp280_probe_checks_chip_id);
+  RUN_TEST(test_aht20_init_calibrates);
+  return UNITY_END();
+}
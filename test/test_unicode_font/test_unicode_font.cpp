@@ -0,0 +1,358 @@
+/* Unit tests for the Unicode bitmap fonts.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <unity.h>
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#include "fonts/FreeSans/FreeSans_9pt8b.h"
+#include "fonts/FreeSans/FreeSans_14pt8b.h"
+#include "unicode_font.h"
+// UNICODE_FONT firmware also needs the asset partition (see config.h), so the
+// module is compiled here instead of being listed in build_src_filter
+#define UNICODE_FONT
+#include "unicode_font.cpp"
+
+// the printable ASCII glyphs of a GFX font are stored under BASE + c
+static const uint32_t BASE = 0x4e00;
+
+enum encoding_t
+{
+  RAW,
+  RLE,
+  SMALLEST   // as tools/pack_assets.py does
+};
+
+static std::vector<uint8_t> glyphBits(const GFXfont &font, uint8_t c)
+{
+  const GFXglyph &g = font.glyph[c - font.first];
+  std::vector<uint8_t> bits(g.width * g.height);
+  for (size_t i = 0; i < bits.size(); ++i)
+  {
+    bits[i] = (font.bitmap[g.bitmapOffset + i / 8] >> (7 - i % 8)) & 1;
+  }
+  return bits;
+}
+
+/* Run-length encodes a glyph like rle_nibbles() in tools/pack_assets.py.
+ */
+static std::vector<uint8_t> rleNibbles(const std::vector<uint8_t> &bits)
+{
+  std::vector<uint32_t> runs;
+  uint8_t ink = 0;
+  uint32_t n = 0;
+  for (uint8_t b : bits)
+  {
+    if (b == ink)
+    {
+      ++n;
+    }
+    else
+    {
+      runs.push_back(n);
+      ink = b;
+      n = 1;
+    }
+  }
+  runs.push_back(n);
+  std::vector<uint8_t> nibbles;
+  for (uint32_t r : runs)
+  {
+    for (; r >= 15; r -= 15)
+    {
+      nibbles.push_back(15);
+    }
+    nibbles.push_back(r);
+  }
+  if (nibbles.size() % 2)
+  {
+    nibbles.push_back(0);
+  }
+  std::vector<uint8_t> out;
+  for (size_t i = 0; i < nibbles.size(); i += 2)
+  {
+    out.push_back((nibbles[i] << 4) | nibbles[i + 1]);
+  }
+  return out;
+}
+
+/* Builds an ASSET_UNICODE_FONT blob from the printable ASCII glyphs of a GFX
+ * font the way unicode_font_blob() in tools/pack_assets.py does. Code point
+ * BASE + 'x' is left out, so the font has two ranges.
+ */
+static std::vector<uint8_t> buildFont(const GFXfont &font, encoding_t enc)
+{
+  std::vector<asset_ufont_range_t> ranges;
+  std::vector<asset_ufont_glyph_t> glyphs;
+  std::vector<uint8_t> data;
+  for (uint8_t c = '!'; c <= '~'; ++c)
+  {
+    if (c == 'x')
+    {
+      continue;
+    }
+    const uint32_t cp = BASE + c;
+    if (!ranges.empty() && ranges.back().first + ranges.back().count == cp)
+    {
+      ++ranges.back().count;
+    }
+    else
+    {
+      ranges.push_back({cp, 1, static_cast<uint16_t>(glyphs.size())});
+    }
+    const GFXglyph &g = font.glyph[c - font.first];
+    const std::vector<uint8_t> bits = glyphBits(font, c);
+    std::vector<uint8_t> raw((bits.size() + 7) / 8);
+    for (size_t i = 0; i < bits.size(); ++i)
+    {
+      raw[i / 8] |= bits[i] << (7 - i % 8);
+    }
+    const std::vector<uint8_t> rle = rleNibbles(bits);
+    uint32_t offset = data.size();
+    if (enc == RLE || (enc == SMALLEST && rle.size() < raw.size()))
+    {
+      data.insert(data.end(), rle.begin(), rle.end());
+      offset |= UFONT_GLYPH_RLE;
+    }
+    else
+    {
+      data.insert(data.end(), raw.begin(), raw.end());
+    }
+    glyphs.push_back({{static_cast<uint8_t>(offset),
+                       static_cast<uint8_t>(offset >> 8),
+                       static_cast<uint8_t>(offset >> 16)},
+                      g.width, g.height, g.xAdvance,
+                      static_cast<int8_t>(g.xOffset),
+                      static_cast<int8_t>(g.yOffset)});
+  }
+
+  asset_unicode_font_t h = {};
+  h.num_ranges   = ranges.size();
+  h.num_glyphs   = glyphs.size();
+  h.y_advance    = font.yAdvance;
+  h.range_offset = sizeof(h);
+  h.glyph_offset = h.range_offset + ranges.size() * sizeof(ranges[0]);
+  h.data_offset  = h.glyph_offset + glyphs.size() * sizeof(glyphs[0]);
+  h.data_size    = data.size();
+  std::vector<uint8_t> blob(h.data_offset + data.size());
+  memcpy(blob.data(), &h, sizeof(h));
+  memcpy(&blob[h.range_offset], ranges.data(),
+         ranges.size() * sizeof(ranges[0]));
+  memcpy(&blob[h.glyph_offset], glyphs.data(),
+         glyphs.size() * sizeof(glyphs[0]));
+  memcpy(&blob[h.data_offset], data.data(), data.size());
+  return blob;
+}
+
+/* Decodes every glyph of a font built from a GFX font and compares it pixel
+ * by pixel with the GFX font.
+ */
+static void checkRoundTrip(const GFXfont &font, encoding_t enc)
+{
+  const std::vector<uint8_t> blob = buildFont(font, enc);
+  unicode_font_t ufont;
+  TEST_ASSERT_TRUE(parseUnicodeFont(blob.data(), blob.size(), ufont));
+  // the caches are keyed by font address, ufont is reused on the stack
+  clearUnicodeGlyphCache();
+  for (uint8_t c = '!'; c <= '~'; ++c)
+  {
+    const asset_ufont_glyph_t *g = nullptr;
+    const uint8_t *bitmap = getUnicodeGlyphBitmap(ufont, BASE + c, &g);
+    if (c == 'x')
+    {
+      TEST_ASSERT_NULL(bitmap);
+      TEST_ASSERT_NULL(g);
+      continue;
+    }
+    TEST_ASSERT_NOT_NULL(bitmap);
+    const GFXglyph &ref = font.glyph[c - font.first];
+    TEST_ASSERT_EQUAL(ref.width, g->width);
+    TEST_ASSERT_EQUAL(ref.height, g->height);
+    TEST_ASSERT_EQUAL(ref.xAdvance, g->x_advance);
+    TEST_ASSERT_EQUAL(ref.xOffset, g->x_offset);
+    TEST_ASSERT_EQUAL(ref.yOffset, g->y_offset);
+    const std::vector<uint8_t> bits = glyphBits(font, c);
+    const int rowBytes = (g->width + 7) / 8;
+    for (int y = 0; y < g->height; ++y)
+    {
+      for (int x = 0; x < rowBytes * 8; ++x)
+      {
+        const uint8_t expected = x < g->width ? bits[y * g->width + x] : 0;
+        const uint8_t actual = (bitmap[y * rowBytes + x / 8] >> (7 - x % 8))
+                               & 1;
+        if (expected != actual)
+        {
+          char msg[64];
+          snprintf(msg, sizeof(msg), "'%c' pixel (%d, %d)", c, x, y);
+          TEST_FAIL_MESSAGE(msg);
+        }
+      }
+    }
+  }
+}
+
+void setUp()
+{
+  clearUnicodeGlyphCache();
+}
+
+void tearDown()
+{
+}
+
+void test_raw_glyphs_round_trip()
+{
+  checkRoundTrip(FreeSans_9pt8b, RAW);
+  checkRoundTrip(FreeSans_14pt8b, RAW);
+}
+
+void test_rle_glyphs_round_trip()
+{
+  checkRoundTrip(FreeSans_9pt8b, RLE);
+  checkRoundTrip(FreeSans_14pt8b, RLE);
+}
+
+void test_packed_glyphs_round_trip()
+{
+  checkRoundTrip(FreeSans_9pt8b, SMALLEST);
+  checkRoundTrip(FreeSans_14pt8b, SMALLEST);
+}
+
+/* Code points the font does not have are reported, so the renderer can draw
+ * its fallback glyph instead.
+ */
+void test_missing_code_points()
+{
+  const std::vector<uint8_t> blob = buildFont(FreeSans_9pt8b, SMALLEST);
+  unicode_font_t ufont;
+  TEST_ASSERT_TRUE(parseUnicodeFont(blob.data(), blob.size(), ufont));
+  TEST_ASSERT_EQUAL(2, ufont.header->num_ranges);
+  const uint32_t missing[] = {0, BASE, BASE + ' ', BASE + 'x', BASE + 0x7f,
+                              0x10ffff, UTF8_INVALID};
+  for (uint32_t cp : missing)
+  {
+    TEST_ASSERT_NULL(findUnicodeGlyph(ufont, cp));
+    TEST_ASSERT_NULL(getUnicodeGlyph(ufont, cp));
+    TEST_ASSERT_NULL(getUnicodeGlyphBitmap(ufont, cp, nullptr));
+  }
+  TEST_ASSERT_NOT_NULL(findUnicodeGlyph(ufont, BASE + 'w'));
+  TEST_ASSERT_NOT_NULL(findUnicodeGlyph(ufont, BASE + 'y'));
+}
+
+/* Truncated data and tables outside of the blob are rejected instead of read
+ * past the end.
+ */
+void test_corrupt_fonts_are_rejected()
+{
+  std::vector<uint8_t> blob = buildFont(FreeSans_9pt8b, RLE);
+  unicode_font_t ufont;
+  TEST_ASSERT_FALSE(parseUnicodeFont(blob.data(), sizeof(asset_unicode_font_t)
+                                                  - 1, ufont));
+  TEST_ASSERT_FALSE(parseUnicodeFont(blob.data(), blob.size() - 1, ufont));
+
+  // the last glyph's runs cut short
+  asset_unicode_font_t *h = reinterpret_cast<asset_unicode_font_t *>(
+                              blob.data());
+  h->data_size -= 1;
+  TEST_ASSERT_TRUE(parseUnicodeFont(blob.data(), blob.size(), ufont));
+  TEST_ASSERT_NULL(getUnicodeGlyphBitmap(ufont, BASE + '~', nullptr));
+  TEST_ASSERT_NOT_NULL(getUnicodeGlyphBitmap(ufont, BASE + '!', nullptr));
+}
+
+void test_utf8_decoding()
+{
+  const char text[] = "a\xc3\xa9\xe4\xb8\x80\xf0\x9f\x98\x80";
+  const char *p = text;
+  const char *end = text + strlen(text);
+  TEST_ASSERT_EQUAL_HEX32('a', nextUtf8Char(p, end));
+  TEST_ASSERT_EQUAL_HEX32(0xe9, nextUtf8Char(p, end));
+  TEST_ASSERT_EQUAL_HEX32(0x4e00, nextUtf8Char(p, end));
+  TEST_ASSERT_EQUAL_HEX32(0x1f600, nextUtf8Char(p, end));
+  TEST_ASSERT_TRUE(p == end);
+
+  const char *bad[] = {"\xc0\xaf", "\xed\xa0\x80", "\xe4\xb8", "\x80"};
+  for (const char *s : bad)
+  {
+    p = s;
+    TEST_ASSERT_EQUAL_HEX32(UTF8_INVALID, nextUtf8Char(p, s + strlen(s)));
+    TEST_ASSERT_TRUE(p == s + 1);
+    TEST_ASSERT_FALSE(isUtf8Text(s, strlen(s)));
+  }
+  TEST_ASSERT_FALSE(isUtf8Text("ascii", 5));
+  TEST_ASSERT_TRUE(isUtf8Text(text, strlen(text)));
+}
+
+/* Time to look up and decode every glyph, uncached and through the caches.
+ */
+void test_decode_speed()
+{
+  const std::vector<uint8_t> blob = buildFont(FreeSans_14pt8b, SMALLEST);
+  unicode_font_t ufont;
+  TEST_ASSERT_TRUE(parseUnicodeFont(blob.data(), blob.size(), ufont));
+  const int ROUNDS = 200;
+  const int GLYPHS = '~' - '!' + 1;
+  uint32_t sum = 0;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < ROUNDS; ++r)
+  {
+    clearUnicodeGlyphCache();
+    for (uint8_t c = '!'; c <= '~'; ++c)
+    {
+      const uint8_t *b = getUnicodeGlyphBitmap(ufont, BASE + c, nullptr);
+      sum += b ? b[0] : 0;
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int r = 0; r < ROUNDS; ++r)
+  {
+    for (uint8_t c = '!'; c < '!' + 40; ++c)
+    {
+      const uint8_t *b = getUnicodeGlyphBitmap(ufont, BASE + c, nullptr);
+      sum += b ? b[0] : 0;
+    }
+  }
+  auto t2 = std::chrono::steady_clock::now();
+
+  const double uncached =
+    std::chrono::duration<double, std::nano>(t1 - t0).count()
+    / (ROUNDS * GLYPHS);
+  const double cached =
+    std::chrono::duration<double, std::nano>(t2 - t1).count() / (ROUNDS * 40);
+  char msg[96];
+  snprintf(msg, sizeof(msg),
+           "decode %.0f ns/glyph, cached %.0f ns/glyph (%u)", uncached,
+           cached, sum & 1);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_raw_glyphs_round_trip);
+  RUN_TEST(test_rle_glyphs_round_trip);
+  RUN_TEST(test_packed_glyphs_round_trip);
+  RUN_TEST(test_missing_code_points);
+  RUN_TEST(test_corrupt_fonts_are_rejected);
+  RUN_TEST(test_utf8_decoding);
+  RUN_TEST(test_decode_speed);
+  return UNITY_END();
+}
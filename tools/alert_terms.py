@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# Alert terminology matcher generator for esp32-weather-epd.
+# Copyright (C) 2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Builds the Aho-Corasick automaton over the alert terminology of each locale
+# (ALERT_URGENCY and the TERM_* vectors of locale_<LOCALE>.inc) and writes it
+# as constant tables to alert_terms_<LOCALE>.inc next to the locale, where
+# locale.cpp picks it up as ALERT_MATCHER. See src/include/alert_classifier.h
+# for the layout and src/alert_classifier.cpp for the matcher.
+#
+# Every term gets the bit of its category (the order of enum alert_category,
+# see CATEGORIES) and every urgency keyword the bit of its index above the
+# categories. The tables have to be generated again when the terminology of a
+# locale changes:
+#
+#   python3 tools/alert_terms.py
+#
+# Usage:
+#   python3 alert_terms.py [--locale LOCALE ...] [--check]
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, '..')
+LOCALES = os.path.join(ROOT, 'src', 'include', 'locales')
+sys.path.insert(0, os.path.join(ROOT, 'fonts'))
+from subset_fonts import c_string_bytes, strip_comments  # noqa: E402
+
+# in the order of enum alert_category, earlier categories take precedence
+CATEGORIES = (
+    'TERM_SMOG', 'TERM_SMOKE', 'TERM_FOG', 'TERM_METEOR', 'TERM_NUCLEAR',
+    'TERM_BIOHAZARD', 'TERM_EARTHQUAKE', 'TERM_FIRE', 'TERM_HEAT',
+    'TERM_WINTER', 'TERM_TSUNAMI', 'TERM_LIGHTNING', 'TERM_SANDSTORM',
+    'TERM_FLOOD', 'TERM_VOLCANO', 'TERM_AIR_QUALITY', 'TERM_TORNADO',
+    'TERM_SMALL_CRAFT_ADVISORY', 'TERM_GALE_WARNING', 'TERM_STORM_WARNING',
+    'TERM_HURRICANE_WARNING', 'TERM_HURRICANE', 'TERM_DUST',
+    'TERM_STRONG_WIND',
+)
+URGENCY_SHIFT = len(CATEGORIES)
+MAX_URGENCY = 32 - URGENCY_SHIFT
+ROOT_NODE = 0
+
+
+def read_terms(path):
+    """Returns {name: [term bytes, ...]} of the string vectors of a locale."""
+    with open(path, 'r', encoding='utf-8') as f:
+        text = strip_comments(f.read())
+    vectors = {}
+    for name, body in re.findall(
+            r'const\s+std::vector<String>\s+(\w+)\s*=\s*\{(.*?)\}\s*;', text,
+            flags=re.S):
+        vectors[name] = [c_string_bytes(s) for s in
+                         re.findall(r'"((?:\\.|[^"\\\n])*)"', body)]
+    for name in CATEGORIES + ('ALERT_URGENCY',):
+        if name not in vectors:
+            raise SystemExit(f'{path}: {name} not found')
+    if len(vectors['ALERT_URGENCY']) > MAX_URGENCY:
+        raise SystemExit(f'{path}: at most {MAX_URGENCY} ALERT_URGENCY '
+                         'keywords are supported')
+    return vectors
+
+
+class Node:
+    def __init__(self, ch=0):
+        self.mask = 0
+        self.child = ROOT_NODE
+        self.sibling = ROOT_NODE
+        self.fail = ROOT_NODE
+        self.ch = ch
+
+
+def find_child(nodes, root, n, c):
+    if n == ROOT_NODE:
+        return root[c]
+    i = nodes[n].child
+    while i != ROOT_NODE:
+        if nodes[i].ch == c:
+            return i
+        i = nodes[i].sibling
+    return ROOT_NODE
+
+
+def build_matcher(vectors):
+    """Returns (nodes, root) of the automaton. Children are kept in sibling
+    lists, the root has a table of 256 transitions.
+    """
+    nodes = [Node()]
+    root = [ROOT_NODE] * 256
+    terms = [(t, 1 << i) for i, name in enumerate(CATEGORIES)
+             for t in vectors[name]]
+    terms += [(t, 1 << (URGENCY_SHIFT + i))
+              for i, t in enumerate(vectors['ALERT_URGENCY'])]
+    for term, mask in terms:
+        n = ROOT_NODE
+        for c in term:
+            nxt = find_child(nodes, root, n, c)
+            if nxt == ROOT_NODE:
+                nxt = len(nodes)
+                node = Node(c)
+                if n == ROOT_NODE:
+                    root[c] = nxt
+                else:
+                    node.sibling = nodes[n].child
+                    nodes[n].child = nxt
+                nodes.append(node)
+            n = nxt
+        nodes[n].mask |= mask
+    if len(nodes) > 0xffff:
+        raise SystemExit('too many alert terms')
+
+    # fail links in breadth-first order, the masks of the fail chain are
+    # folded into every node
+    root_mask = nodes[ROOT_NODE].mask
+    queue = []
+    for c in range(256):
+        n = root[c]
+        if n != ROOT_NODE:
+            nodes[n].fail = ROOT_NODE
+            nodes[n].mask |= root_mask
+            queue.append(n)
+    q = 0
+    while q < len(queue):
+        n = queue[q]
+        q += 1
+        i = nodes[n].child
+        while i != ROOT_NODE:
+            c = nodes[i].ch
+            f = nodes[n].fail
+            nxt = find_child(nodes, root, f, c)
+            while nxt == ROOT_NODE and f != ROOT_NODE:
+                f = nodes[f].fail
+                nxt = find_child(nodes, root, f, c)
+            nodes[i].fail = nxt
+            nodes[i].mask |= nodes[nxt].mask | root_mask
+            queue.append(i)
+            i = nodes[i].sibling
+    return nodes, root
+
+
+def matcher_source(locale, vectors, nodes, root):
+    terms = sum(len(vectors[name]) for name in CATEGORIES)
+    lines = [
+        f'// Alert terminology matcher of locale_{locale}.inc generated by',
+        '// tools/alert_terms.py, do not edit.',
+        f'// {terms} terms, {len(vectors["ALERT_URGENCY"])} urgency keywords, '
+        f'{len(nodes)} nodes ({len(nodes) * 12 + 512} bytes)',
+        '',
+        'static const alert_matcher_node_t ALERT_TERM_NODES[] = {',
+        '  //     mask, child, sibling, fail,   ch',
+    ]
+    for i, n in enumerate(nodes):
+        end = ',' if i + 1 < len(nodes) else ''
+        lines.append(f'  {{0x{n.mask:08X}, {n.child:5d}, {n.sibling:7d}, '
+                     f'{n.fail:4d}, 0x{n.ch:02X}}}{end}')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const uint16_t ALERT_TERM_ROOT[256] = {')
+    for i in range(0, 256, 12):
+        row = ', '.join(f'{v:3d}' for v in root[i:i + 12])
+        lines.append(f'  {row}{"," if i + 12 < 256 else ""}')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--locale', nargs='+', default=None,
+                        help='locale codes, all locales by default')
+    parser.add_argument('--check', action='store_true',
+                        help='only report tables that are out of date')
+    args = parser.parse_args()
+
+    if args.locale is None:
+        args.locale = sorted(
+            re.match(r'locale_(\w+)\.inc', os.path.basename(p)).group(1)
+            for p in glob.glob(os.path.join(LOCALES, 'locale_*.inc')))
+    stale = []
+    for locale in args.locale:
+        vectors = read_terms(os.path.join(LOCALES, f'locale_{locale}.inc'))
+        nodes, root = build_matcher(vectors)
+        source = matcher_source(locale, vectors, nodes, root)
+        path = os.path.join(LOCALES, f'alert_terms_{locale}.inc')
+        current = None
+        if os.path.exists(path):
+            with open(path, 'r') as f:
+                current = f.read()
+        print(f'{locale}: {len(nodes)} nodes'
+              + ('' if current == source else ' (changed)'))
+        if current == source:
+            continue
+        stale.append(locale)
+        if not args.check:
+            with open(path, 'w') as f:
+                f.write(source)
+    if args.check and stale:
+        raise SystemExit('out of date: ' + ', '.join(stale))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,414 @@
+#!/usr/bin/env python3
+# Asset image packer for esp32-weather-epd.
+# Copyright (C) 2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Builds the image for the "assets" flash partition used by firmware built
+# with -DASSET_PARTITION: the icon atlas (see icons/pack_icon_atlas.py) and
+# every font of one font family. The layout is described in
+# src/include/asset_index.h.
+#
+# The image only has to be flashed again when the icons or fonts change, the
+# application can then be updated over the air on its own:
+#
+#   python3 tools/pack_assets.py --font-header fonts/FreeSans.h -o assets.bin
+#   esptool.py --chip esp32 write_flash 0x390000 assets.bin
+#
+# The offset is that of the assets partition in partitions_assets.csv.
+#
+# With --unicode-font the image also gets Unicode fonts (see
+# src/include/unicode_font.h) for firmware built with -DUNICODE_FONT. Their
+# glyphs are rasterized with fonts/fontconvert (build it with make first) from
+# a font file that covers the wanted scripts, e.g. for simplified Chinese:
+#
+#   python3 tools/pack_assets.py --unicode-font NotoSansSC-Regular.otf
+#
+# By default the Unicode fonts hold the 3755 characters of GB2312 level 1, CJK
+# punctuation, fullwidth forms and the characters beyond ISO-8859-1 used in the
+# source. A 16 pixel font (8pt) takes about 140 kB.
+#
+# Usage:
+#   python3 pack_assets.py [--font-header HEADER] [-o FILE]
+#                          [--unicode-font FILE [--unicode-sizes PT ...]
+#                           [--unicode-ranges RANGE ...] [--unicode-text FILE]]
+#   python3 pack_assets.py --list FILE
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, '..')
+ASSETS_LIB = os.path.join(ROOT, 'lib', 'esp32-weather-epd-assets')
+sys.path.insert(0, os.path.join(ROOT, 'icons'))
+import pack_icon_atlas  # noqa: E402
+
+ASSET_IMAGE_MAGIC = 0x41504557  # "WEPA"
+ASSET_IMAGE_VERSION = 1
+ASSET_ATLAS_MAX_SIZES = 4
+ASSET_ICON_ATLAS = 1
+ASSET_FONT = 2
+ASSET_UNICODE_FONT = 3
+TYPE_NAMES = {ASSET_ICON_ATLAS: 'icon atlas', ASSET_FONT: 'font',
+              ASSET_UNICODE_FONT: 'unicode'}
+
+HEADER = struct.Struct('<IHHIII12x')
+ENTRY = struct.Struct('<IHHII')
+FONT = struct.Struct('<HHB3xII')
+ATLAS = struct.Struct('<HHHH4HIIII')
+GLYPH = struct.Struct('<HBBBbbx')  # GFXglyph, padded to 8 bytes
+UNICODE_FONT = struct.Struct('<HHB3xIIII')
+UFONT_RANGE = struct.Struct('<IHH')
+UFONT_GLYPH = struct.Struct('<3sBBBbb')
+UFONT_GLYPH_RLE = 0x800000
+UFONT_MAX_GLYPH_BYTES = 128  # as in unicode_font.h
+UFONT_CHUNK = 256  # code points per fontconvert run, keeps offsets in 16 bits
+FONTCONVERT = os.path.join(ROOT, 'fonts', 'fontconvert', 'fontconvert')
+
+
+def name_hash(name):
+    """32-bit FNV-1a, as assetNameHash() in asset_index.cpp."""
+    h = 2166136261
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def align4(buf):
+    buf += b'\0' * (-len(buf) % 4)
+
+
+def parse_font(path):
+    """Reads the bitmaps, glyphs and metrics of an Adafruit GFX font header."""
+    with open(path, 'r', errors='replace') as f:
+        return parse_font_text(f.read(), path)
+
+
+def parse_font_text(text, path):
+    bitmaps = text[text.index('Bitmaps[]'):]
+    bitmaps = bitmaps[bitmaps.index('{') + 1:bitmaps.index('};')]
+    bitmap = bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]{2}', bitmaps))
+    glyphs = text[text.index('Glyphs[]'):]
+    glyphs = glyphs[glyphs.index('{') + 1:glyphs.index('};')]
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(
+        r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),'
+        r'\s*(-?\d+)\s*\}', glyphs)]
+    m = re.search(r'GFXglyph\s*\*\)\s*\w+,\s*(0x[0-9a-fA-F]+|\d+),\s*'
+                  r'(0x[0-9a-fA-F]+|\d+),\s*(\d+)\s*\}', text)
+    first, last, y_advance = (int(v, 0) for v in m.groups())
+    if len(glyphs) != last - first + 1:
+        raise SystemExit(f'{path}: expected {last - first + 1} glyphs, '
+                         f'found {len(glyphs)}')
+    return first, last, y_advance, glyphs, bitmap
+
+
+def font_blob(first, last, y_advance, glyphs, bitmap):
+    glyph_offset = FONT.size
+    bitmap_offset = glyph_offset + len(glyphs) * GLYPH.size
+    blob = bytearray(FONT.pack(first, last, y_advance, glyph_offset,
+                               bitmap_offset))
+    for g in glyphs:
+        blob += GLYPH.pack(*g)
+    blob += bitmap
+    return bytes(blob)
+
+
+def read_font_family(header):
+    """Returns {FONT_xx name: font header path} for a font family header."""
+    path = os.path.join(ASSETS_LIB, header)
+    with open(path, 'r') as f:
+        text = f.read()
+    if '#define FONT_SUBSET' in text:
+        raise SystemExit(f'{header}: subset fonts need the renderer remap, '
+                         'pack the full family instead')
+    includes = {os.path.splitext(os.path.basename(i))[0]: i
+                for i in re.findall(r'#include "([^"]+)"', text)}
+    fonts = {}
+    for macro, font in re.findall(r'#define (FONT_\w+) (\w+)', text):
+        fonts[macro] = os.path.join(os.path.dirname(path), includes[font])
+    return fonts
+
+
+def gb2312_level1():
+    """The 3755 most common Chinese characters."""
+    chars = set()
+    for hi in range(0xb0, 0xd8):
+        for lo in range(0xa1, 0xff):
+            try:
+                chars.add(ord(bytes([hi, lo]).decode('gb2312')))
+            except UnicodeDecodeError:
+                pass
+    return chars
+
+
+def source_chars():
+    """Characters beyond ISO-8859-1 in the string literals of the source."""
+    chars = set()
+    for dirpath, _, filenames in os.walk(os.path.join(ROOT, 'src')):
+        for name in filenames:
+            if not name.endswith(('.cpp', '.h', '.inc')):
+                continue
+            with open(os.path.join(dirpath, name), 'r', encoding='utf-8',
+                      errors='replace') as f:
+                text = re.sub(r'//[^\n]*|/\*.*?\*/|("(?:\\.|[^"\\\n])*")',
+                              lambda m: m.group(1) or ' ', f.read(),
+                              flags=re.S)
+            for literal in re.findall(r'"((?:\\.|[^"\\\n])*)"', text):
+                chars.update(ord(c) for c in literal if ord(c) > 0xff)
+    chars.discard(0xfffd)
+    return chars
+
+
+def unicode_charset(ranges, text_files):
+    chars = source_chars()
+    for r in ranges:
+        if r == 'gb2312':
+            chars |= gb2312_level1()
+        else:
+            first, last = (int(v, 16) for v in r.split('-'))
+            chars.update(range(first, last + 1))
+    for path in text_files:
+        with open(path, 'r', encoding='utf-8') as f:
+            chars.update(ord(c) for c in f.read())
+    return sorted(c for c in chars if c > 0xff)
+
+
+def fontconvert(font_file, size, first, last):
+    if not os.path.exists(FONTCONVERT):
+        raise SystemExit(f'{FONTCONVERT} not found, run make in '
+                         'fonts/fontconvert')
+    out = subprocess.run([FONTCONVERT, font_file, str(size), str(first),
+                          str(last)], check=True, capture_output=True)
+    return parse_font_text(out.stdout.decode('latin-1'), font_file)
+
+
+def glyph_bits(glyph, bitmap):
+    offset, w, h = glyph[:3]
+    data = bitmap[offset:offset + (w * h + 7) // 8]
+    return [(data[i >> 3] >> (7 - (i & 7))) & 1 for i in range(w * h)]
+
+
+def rle_nibbles(bits):
+    """Run-length encodes a glyph as in decodeGlyph() in unicode_font.cpp."""
+    runs = []
+    ink = 0
+    n = 0
+    for b in bits:
+        if b == ink:
+            n += 1
+        else:
+            runs.append(n)
+            ink = b
+            n = 1
+    runs.append(n)
+    nibbles = []
+    for n in runs:
+        while n >= 15:
+            nibbles.append(15)
+            n -= 15
+        nibbles.append(n)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1]
+                 for i in range(0, len(nibbles), 2))
+
+
+def unicode_font_blob(font_file, size, charset):
+    """Rasterizes the code points in charset into an ASSET_UNICODE_FONT blob.
+    Code points the font file has no glyph for are left out.
+    """
+    # fontconvert falls back to .notdef for missing glyphs, U+FFFF is never
+    # assigned so it shows what that looks like
+    _, _, _, nd_glyphs, nd_bitmap = fontconvert(font_file, size, 0xffff,
+                                                0xffff)
+    notdef = (nd_glyphs[0][1:], glyph_bits(nd_glyphs[0], nd_bitmap))
+
+    glyphs = {}
+    y_advance = 0
+    i = 0
+    while i < len(charset):
+        j = i
+        while (j + 1 < len(charset)
+               and charset[j + 1] - charset[i] < UFONT_CHUNK):
+            j += 1
+        first, last = charset[i], charset[j]
+        _, _, y_advance, chunk, bitmap = fontconvert(font_file, size, first,
+                                                     last)
+        for cp in charset[i:j + 1]:
+            g = chunk[cp - first]
+            bits = glyph_bits(g, bitmap)
+            if (g[1:], bits) != notdef:
+                glyphs[cp] = (g[1:], bits)
+        i = j + 1
+
+    ranges = []
+    records = bytearray()
+    data = bytearray()
+    for n, cp in enumerate(sorted(glyphs)):
+        if ranges and ranges[-1][0] + ranges[-1][1] == cp:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([cp, 1, n])
+        (w, h, x_advance, x_offset, y_offset), bits = glyphs[cp]
+        if (w + 7) // 8 * h > UFONT_MAX_GLYPH_BYTES:
+            raise SystemExit(f'U+{cp:04X} is {w}x{h} pixels, at most '
+                             f'{UFONT_MAX_GLYPH_BYTES} bytes per glyph')
+        raw = bytes(int(''.join(map(str, bits[k:k + 8])).ljust(8, '0'), 2)
+                    for k in range(0, len(bits), 8))
+        rle = rle_nibbles(bits)
+        offset = len(data)
+        if len(rle) < len(raw):
+            data += rle
+            offset |= UFONT_GLYPH_RLE
+        else:
+            data += raw
+        records += UFONT_GLYPH.pack(offset.to_bytes(3, 'little'), w, h,
+                                    x_advance, x_offset, y_offset)
+    if len(glyphs) > 0xffff or len(data) > UFONT_GLYPH_RLE:
+        raise SystemExit(f'{font_file}: too many glyphs')
+
+    range_offset = UNICODE_FONT.size
+    glyph_offset = range_offset + len(ranges) * UFONT_RANGE.size
+    data_offset = glyph_offset + len(records)
+    blob = bytearray(UNICODE_FONT.pack(len(ranges), len(glyphs), y_advance,
+                                       range_offset, glyph_offset,
+                                       data_offset, len(data)))
+    for r in ranges:
+        blob += UFONT_RANGE.pack(*r)
+    blob += records
+    blob += data
+    return bytes(blob)
+
+
+def atlas_blob(atlas):
+    sizes = atlas['sizes']
+    if len(sizes) > ASSET_ATLAS_MAX_SIZES:
+        raise SystemExit(f'at most {ASSET_ATLAS_MAX_SIZES} icon sizes')
+    slots = bytes(0xff if s is None else s for s in atlas['slots'])
+    slot_offset = ATLAS.size
+    offset_offset = slot_offset + len(slots) + (-len(slots) % 4)
+    data_offset = offset_offset + 4 * len(sizes) * len(atlas['offsets'])
+    blob = bytearray(ATLAS.pack(
+        len(sizes), len(slots), len(atlas['offsets']), 0,
+        *(sizes + [0] * (ASSET_ATLAS_MAX_SIZES - len(sizes))),
+        slot_offset, offset_offset, data_offset, len(atlas['data'])))
+    blob += slots
+    align4(blob)
+    for _, row in atlas['offsets']:
+        blob += struct.pack(f'<{len(row)}I', *row)
+    blob += atlas['data']
+    return bytes(blob)
+
+
+def build_image(assets):
+    """assets is a list of (name, type, blob)."""
+    hashes = {}
+    for name, _, _ in assets:
+        h = name_hash(name)
+        if h in hashes:
+            raise SystemExit(f'hash collision: {name}, {hashes[h]}')
+        hashes[h] = name
+    image = bytearray(HEADER.size)
+    entries = []
+    for name, kind, blob in assets:
+        align4(image)
+        entries.append((name_hash(name), kind, 0, len(image), len(blob)))
+        image += blob
+    align4(image)
+    index_offset = len(image)
+    for e in sorted(entries):
+        image += ENTRY.pack(*e)
+    crc = zlib.crc32(bytes(image[HEADER.size:]))
+    image[:HEADER.size] = HEADER.pack(ASSET_IMAGE_MAGIC, ASSET_IMAGE_VERSION,
+                                      len(entries), index_offset, len(image),
+                                      crc)
+    return bytes(image)
+
+
+def list_image(path, names):
+    with open(path, 'rb') as f:
+        image = f.read()
+    magic, version, count, index_offset, size, crc = HEADER.unpack_from(image)
+    if magic != ASSET_IMAGE_MAGIC or version != ASSET_IMAGE_VERSION:
+        raise SystemExit(f'{path}: not a version {ASSET_IMAGE_VERSION} '
+                         'asset image')
+    ok = zlib.crc32(image[HEADER.size:size]) == crc
+    print(f'{path}: {count} entries, {size} bytes, '
+          f'crc {crc:08x} {"ok" if ok else "MISMATCH"}')
+    known = {name_hash(n): n for n in names}
+    for i in range(count):
+        h, kind, _, offset, length = ENTRY.unpack_from(
+            image, index_offset + i * ENTRY.size)
+        print(f'  {h:08x} {TYPE_NAMES.get(kind, kind):10s} {offset:7d} '
+              f'{length:7d}  {known.get(h, "")}')
+    if not ok:
+        raise SystemExit(1)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--font-header', default='fonts/FreeSans.h',
+                        help='font family header, as FONT_HEADER in config.h')
+    parser.add_argument('--sizes', type=int, nargs='+', default=[32, 64, 196],
+                        help='icon sizes getBitmap() is called with')
+    parser.add_argument('-o', '--out', default='assets.bin')
+    parser.add_argument('--list', metavar='FILE',
+                        help='check and list the index of an asset image')
+    parser.add_argument('--unicode-font', metavar='FILE',
+                        help='font file to build Unicode fonts from')
+    parser.add_argument('--unicode-sizes', type=int, nargs='+', default=[8],
+                        help='Unicode font sizes in points')
+    parser.add_argument('--unicode-ranges', nargs='+',
+                        default=['gb2312', '3000-303F', 'FF01-FF5E'],
+                        help='"gb2312" (level 1) or hexadecimal code point '
+                             'ranges like 0400-04FF')
+    parser.add_argument('--unicode-text', metavar='FILE', nargs='+',
+                        default=[],
+                        help='UTF-8 text files whose characters to include')
+    args = parser.parse_args()
+
+    fonts = read_font_family(args.font_header)
+    if args.list:
+        list_image(args.list, list(fonts) + ['icon_atlas']
+                   + [f'UFONT_{s}pt' for s in args.unicode_sizes])
+        return
+
+    atlas = pack_icon_atlas.build_atlas(
+        os.path.join(ASSETS_LIB, 'icons'), os.path.join(ROOT, 'src'),
+        args.sizes)
+    assets = [('icon_atlas', ASSET_ICON_ATLAS, atlas_blob(atlas))]
+    for macro, path in sorted(fonts.items()):
+        assets.append((macro, ASSET_FONT, font_blob(*parse_font(path))))
+    if args.unicode_font:
+        charset = unicode_charset(args.unicode_ranges, args.unicode_text)
+        for size in args.unicode_sizes:
+            assets.append((f'UFONT_{size}pt', ASSET_UNICODE_FONT,
+                           unicode_font_blob(args.unicode_font, size,
+                                             charset)))
+
+    image = build_image(assets)
+    with open(args.out, 'wb') as f:
+        f.write(image)
+    print(f'{args.out}: {len(assets)} assets, {len(image)} bytes')
+    for name, kind, blob in assets:
+        print(f'  {TYPE_NAMES[kind]:10s} {len(blob):7d}  {name}')
+
+
+if __name__ == '__main__':
+    main()
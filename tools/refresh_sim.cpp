@@ -0,0 +1,436 @@
+/* Refresh scheduler simulator for esp32-weather-epd.
+ * Copyright (C) 2022-2025  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Replays a year of hourly weather through the refresh scheduler of the
+// firmware (src/refresh_scheduler.cpp), once with fixed intervals and once
+// adaptive, and compares the charge spent against how stale the display is.
+//
+// The weather is read from a CSV file with one line per hour,
+//   unix_time,temperature,pop,alerts
+// (temperature in celsius, pop 0-1, number of active alerts), e.g. exported
+// from a weather archive. Lines starting with # are skipped. Without a file a
+// synthetic year is generated.
+//
+// The battery is simulated from its charge, read through the same voltage
+// table and filter as the firmware with ADC noise added. The recorded weather
+// stands in for the forecast.
+//
+// Build and run (from the repository root):
+//   g++ -std=gnu++17 -O2 -Isrc/include tools/refresh_sim.cpp
+//       src/refresh_scheduler.cpp src/battery_monitor.cpp -o refresh_sim
+//   ./refresh_sim [--weather year.csv] [--capacity 2000] [--target-days 60]
+//                 [--nominal 30] [--min 15] [--max 180] [--bed 0] [--wake 6]
+//                 [--awake-s 15] [--current 90] [--tz 0] [--seed 1]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "battery_monitor.h"
+#include "refresh_scheduler.h"
+
+// battery curve of the firmware's defaults in config.cpp
+static const uint32_t MIN_BATTERY_VOLTAGE = 3000;
+static const uint32_t MAX_BATTERY_VOLTAGE = 4200;
+// charge left at which the battery is recharged
+static const float RECHARGE_PERMILLE = 50.0f;
+// hours of forecast the firmware looks at
+static const int FORECAST_HOURS = 6;
+
+typedef struct hour_record
+{
+  int64_t time;
+  float   temp;
+  float   pop;
+  int     alerts;
+} hour_record_t;
+
+typedef struct sim_options
+{
+  const char *weather;
+  schedule_config_t cfg;
+  float    awake_s;    // mean time awake per wake
+  float    current_ma; // true average current while awake
+  int      tz_hours;   // local time offset from UTC
+  unsigned seed;
+} sim_options_t;
+
+typedef struct sim_result
+{
+  double   days;
+  long     wakes;
+  double   charge_mah;
+  int      recharges;
+  double   mean_age_min;   // mean age of the displayed data, awake hours
+  double   latency_min;    // mean awake time from a weather change to an
+                           // update
+  double   latency_p95_min;
+  int      events;
+} sim_result_t;
+
+/* Reads the weather file, returns false if it cannot be read.
+ */
+static bool readWeather(const char *path, std::vector<hour_record_t> &w)
+{
+  FILE *f = fopen(path, "r");
+  if (f == nullptr)
+  {
+    return false;
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), f) != nullptr)
+  {
+    hour_record_t r;
+    long long t;
+    if (line[0] == '#'
+     || sscanf(line, "%lld,%f,%f,%d", &t, &r.temp, &r.pop, &r.alerts) != 4)
+    {
+      continue;
+    }
+    r.time = t;
+    w.push_back(r);
+  }
+  fclose(f);
+  return !w.empty();
+} // end readWeather
+
+/* Generates a year of weather: seasonal and daily temperature cycles, fronts
+ * that move the temperature by several degrees within hours, rain spells and
+ * the occasional alert.
+ */
+static void syntheticWeather(unsigned seed, std::vector<hour_record_t> &w)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> u(0.0f, 1.0f);
+  std::normal_distribution<float> noise(0.0f, 0.3f);
+  const int64_t start = 1704067200; // 2024-01-01 00:00 UTC
+  float front = 0.0f;
+  float frontTarget = 0.0f;
+  int rainLeft = 0;
+  int alertLeft = 0;
+  float pop = 0.0f;
+  for (int h = 0; h < 365 * 24; ++h)
+  {
+    const float day = h / 24.0f;
+    if (u(rng) < 1.0f / 72) // a front every 3 days on average
+    {
+      frontTarget = (u(rng) - 0.5f) * 16.0f;
+    }
+    front += (frontTarget - front) * 0.25f;
+    const float temp = 10.0f - 10.0f * std::cos(2 * M_PI * day / 365)
+                       - 5.0f * std::cos(2 * M_PI * (h % 24 - 3) / 24)
+                       + front + noise(rng);
+
+    if (rainLeft == 0 && u(rng) < 1.0f / 60)
+    {
+      rainLeft = 2 + static_cast<int>(u(rng) * 10);
+    }
+    const float popTarget = rainLeft > 0 ? 0.9f : 0.05f;
+    pop += (popTarget - pop) * 0.6f;
+    rainLeft = std::max(0, rainLeft - 1);
+
+    if (alertLeft == 0 && u(rng) < 1.0f / 500)
+    {
+      alertLeft = 6 + static_cast<int>(u(rng) * 18);
+    }
+    const int alerts = alertLeft > 0 ? 1 : 0;
+    alertLeft = std::max(0, alertLeft - 1);
+
+    w.push_back({start + h * 3600LL, temp, pop, alerts});
+  }
+  return;
+} // end syntheticWeather
+
+/* Returns the filtered battery voltage the firmware would read at the given
+ * charge.
+ */
+static uint32_t readVoltage(double permille, battery_filter_t &filter,
+                            std::mt19937 &rng)
+{
+  // invert the table, it is monotonic
+  uint32_t lo = MIN_BATTERY_VOLTAGE;
+  uint32_t hi = MAX_BATTERY_VOLTAGE;
+  while (lo < hi)
+  {
+    const uint32_t mid = (lo + hi) / 2;
+    if (batteryPermille(mid, MIN_BATTERY_VOLTAGE, MAX_BATTERY_VOLTAGE)
+        < permille)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  std::normal_distribution<float> adc(0.0f, 8.0f);
+  const int32_t mv = static_cast<int32_t>(lo + std::lround(adc(rng)));
+  return updateBatteryFilter(filter, static_cast<uint32_t>(std::max(0, mv)));
+} // end readVoltage
+
+/* Returns the hour record at or before t.
+ */
+static size_t hourAt(const std::vector<hour_record_t> &w, int64_t t)
+{
+  const int64_t i = (t - w[0].time) / 3600;
+  return static_cast<size_t>(std::min<int64_t>(std::max<int64_t>(i, 0),
+                                               w.size() - 1));
+} // end hourAt
+
+/* Returns true if the weather changed enough during hour i that a display
+ * showing the previous hour is wrong.
+ */
+static bool isEvent(const std::vector<hour_record_t> &w, size_t i)
+{
+  if (i == 0)
+  {
+    return false;
+  }
+  const hour_record_t &a = w[i - 1];
+  const hour_record_t &b = w[i];
+  return std::fabs(b.temp - a.temp) >= 2.0f
+      || (a.pop < 0.5f) != (b.pop < 0.5f)
+      || (b.alerts > 0 && a.alerts == 0);
+} // end isEvent
+
+/* Replays the weather with the given configuration.
+ */
+static void simulate(const std::vector<hour_record_t> &w,
+                     const sim_options_t &opt, const schedule_config_t &cfg,
+                     sim_result_t &res)
+{
+  std::mt19937 rng(opt.seed);
+  std::normal_distribution<float> jitter(1.0f, 0.2f);
+  scheduler_state_t state = {};
+  battery_filter_t filter = {};
+  const double capacityUah = cfg.capacity_mah * 1000.0;
+  double charge = capacityUah;
+
+  res = {};
+  std::vector<int64_t> wakes;
+  const int64_t end = w.back().time + 3600;
+  int64_t t = w[0].time;
+  while (t < end)
+  {
+    wakes.push_back(t);
+    const float awakeS = std::max(1.0f, opt.awake_s * jitter(rng));
+    const double used = awakeS * 1000.0 * opt.current_ma / 3600.0;
+    charge -= used;
+    res.charge_mah += used / 1000.0;
+
+    schedule_input_t in = {};
+    in.now = static_cast<time_t>(t);
+    const time_t local = static_cast<time_t>(t + opt.tz_hours * 3600LL);
+    gmtime_r(&local, &in.local);
+    in.awake_ms = static_cast<uint32_t>(awakeS * 1000);
+    in.battery_known = true;
+    in.battery_permille = batteryPermille(
+      readVoltage(charge / capacityUah * 1000, filter, rng),
+      MIN_BATTERY_VOLTAGE, MAX_BATTERY_VOLTAGE);
+
+    const size_t i = hourAt(w, t);
+    float pop[FORECAST_HOURS];
+    float temp[FORECAST_HOURS];
+    int n = 0;
+    for (; n < FORECAST_HOURS && i + n < w.size(); ++n)
+    {
+      pop[n] = w[i + n].pop;
+      temp[n] = w[i + n].temp;
+    }
+    in.volatility = forecastVolatility(pop, temp, n, 1.0f, w[i].alerts);
+
+    schedule_t next;
+    scheduleNextWake(state, cfg, in, next);
+    const double sleepUsed = next.sleep_s * SCHED_SLEEP_UA / 3600.0;
+    charge -= sleepUsed;
+    res.charge_mah += sleepUsed / 1000.0;
+    if (charge / capacityUah * 1000 < RECHARGE_PERMILLE)
+    {
+      ++res.recharges;
+      charge = capacityUah;
+    }
+    t += next.sleep_s + static_cast<int>(awakeS);
+  }
+  res.days = (end - w[0].time) / 86400.0;
+  res.wakes = static_cast<long>(wakes.size());
+
+  // mean age of the display over the awake hours, sampled every minute
+  double ageSum = 0;
+  long ageSamples = 0;
+  size_t k = 0;
+  const int awakeHours = cfg.bed_time == cfg.wake_time
+                         ? 24 : (cfg.bed_time - cfg.wake_time + 24) % 24;
+  for (int64_t m = w[0].time; m < end; m += 60)
+  {
+    while (k + 1 < wakes.size() && wakes[k + 1] <= m)
+    {
+      ++k;
+    }
+    const int localHour = static_cast<int>(
+      ((m + opt.tz_hours * 3600LL) / 3600) % 24);
+    if ((localHour - cfg.wake_time + 24) % 24 < awakeHours)
+    {
+      ageSum += (m - wakes[k]) / 60.0;
+      ++ageSamples;
+    }
+  }
+  res.mean_age_min = ageSamples > 0 ? ageSum / ageSamples : 0;
+
+  // delay from each weather change in the awake hours to the next update, the
+  // change happens at a random time within the hour before the record
+  std::mt19937 eventRng(opt.seed);
+  std::uniform_int_distribution<int> within(0, 3599);
+  std::vector<double> latency;
+  for (size_t i = 1; i < w.size(); ++i)
+  {
+    const int64_t at = w[i - 1].time + within(eventRng);
+    // seconds since wake_time
+    const int64_t awakeFor = ((at + opt.tz_hours * 3600LL) % 86400
+                              - cfg.wake_time * 3600LL + 86400) % 86400;
+    if (!isEvent(w, i) || awakeFor >= awakeHours * 3600LL)
+    {
+      continue;
+    }
+    auto next = std::lower_bound(wakes.begin(), wakes.end(), at);
+    if (next != wakes.end())
+    {
+      // the night between does not count
+      int64_t delay = *next - at;
+      if (awakeFor + delay > awakeHours * 3600LL)
+      {
+        delay -= (24 - awakeHours) * 3600LL;
+      }
+      latency.push_back(std::max<int64_t>(delay, 0) / 60.0);
+    }
+  }
+  res.events = static_cast<int>(latency.size());
+  if (!latency.empty())
+  {
+    double sum = 0;
+    for (double l : latency)
+    {
+      sum += l;
+    }
+    res.latency_min = sum / latency.size();
+    std::sort(latency.begin(), latency.end());
+    res.latency_p95_min = latency[latency.size() * 95 / 100];
+  }
+  return;
+} // end simulate
+
+static void printResult(const char *name, const sim_options_t &opt,
+                        const sim_result_t &r)
+{
+  const double perDay = r.charge_mah / r.days;
+  printf("%-9s %9.1f %9.2f %9.0f %9d %9.1f %9.1f %9.1f\n", name,
+         r.wakes / r.days, perDay, opt.cfg.capacity_mah * 0.95 / perDay,
+         r.recharges, r.mean_age_min, r.latency_min, r.latency_p95_min);
+  return;
+} // end printResult
+
+int main(int argc, char **argv)
+{
+  sim_options_t opt = {};
+  opt.cfg.min_interval = 15;
+  opt.cfg.nominal_interval = 30;
+  opt.cfg.max_interval = 180;
+  opt.cfg.bed_time = 0;
+  opt.cfg.wake_time = 6;
+  opt.cfg.capacity_mah = 2000;
+  opt.cfg.target_days = 60;
+  opt.awake_s = 15.0f;
+  opt.current_ma = SCHED_AWAKE_MA;
+  opt.seed = 1;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const char *arg = argv[i];
+    const char *val = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (val == nullptr)
+    {
+      fprintf(stderr, "missing value for %s\n", arg);
+      return 2;
+    }
+    ++i;
+    if (!strcmp(arg, "--weather"))
+      opt.weather = val;
+    else if (!strcmp(arg, "--capacity"))
+      opt.cfg.capacity_mah = atoi(val);
+    else if (!strcmp(arg, "--target-days"))
+      opt.cfg.target_days = atoi(val);
+    else if (!strcmp(arg, "--nominal"))
+      opt.cfg.nominal_interval = atoi(val);
+    else if (!strcmp(arg, "--min"))
+      opt.cfg.min_interval = atoi(val);
+    else if (!strcmp(arg, "--max"))
+      opt.cfg.max_interval = atoi(val);
+    else if (!strcmp(arg, "--bed"))
+      opt.cfg.bed_time = atoi(val);
+    else if (!strcmp(arg, "--wake"))
+      opt.cfg.wake_time = atoi(val);
+    else if (!strcmp(arg, "--awake-s"))
+      opt.awake_s = atof(val);
+    else if (!strcmp(arg, "--current"))
+      opt.current_ma = atof(val);
+    else if (!strcmp(arg, "--tz"))
+      opt.tz_hours = atoi(val);
+    else if (!strcmp(arg, "--seed"))
+      opt.seed = atoi(val);
+    else
+    {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+
+  std::vector<hour_record_t> weather;
+  if (opt.weather != nullptr)
+  {
+    if (!readWeather(opt.weather, weather))
+    {
+      fprintf(stderr, "cannot read weather from %s\n", opt.weather);
+      return 1;
+    }
+  }
+  else
+  {
+    syntheticWeather(opt.seed, weather);
+  }
+
+  printf("%zu hours of weather, %u mAh, target %d days, awake %.0f s at "
+         "%.0f mA\n\n", weather.size(), opt.cfg.capacity_mah,
+         opt.cfg.target_days, opt.awake_s, opt.current_ma);
+  printf("%-9s %9s %9s %9s %9s %9s %9s %9s\n", "policy", "wakes/d",
+         "mAh/d", "life d", "recharge", "age min", "lat min", "lat p95");
+
+  schedule_config_t fixed = opt.cfg;
+  fixed.adaptive = false;
+  schedule_config_t adaptive = opt.cfg;
+  adaptive.adaptive = true;
+  sim_result_t r;
+  simulate(weather, opt, fixed, r);
+  printResult("fixed", opt, r);
+  simulate(weather, opt, adaptive, r);
+  printResult("adaptive", opt, r);
+  printf("\n%d weather changes in the awake hours (>= 2 K in an hour, rain "
+         "starting or stopping, new alerts)\n", r.events);
+  return 0;
+} // end main
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+# Render capture helper for esp32-weather-epd.
+# Copyright (C) 2022-2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Extracts frames written by a firmware built with RENDER_CAPTURE 1 from a
+# serial log (or directly from the serial port), saves them as PBM and PNG
+# files, prints the render timing breakdown and optionally compares the frames
+# against a directory of golden images.
+#
+# Usage:
+#   render_capture.py --log serial.log --out frames/
+#   render_capture.py --port /dev/ttyUSB0 --out frames/ --golden golden/
+#   render_capture.py --log serial.log --out golden/ --update-golden
+
+import argparse
+import base64
+import os
+import re
+import shutil
+import sys
+
+FRAME_RE = re.compile(r'\[capture\] frame (\d+) (\d+)x(\d+) planes=(\d+)')
+TIMING_RE = re.compile(r'\[capture\] timing (\S+) (\d+) us(?: (\d+) calls)?')
+PLANE_RE = re.compile(r'\[capture\] plane (\S+) P4 (\d+) (\d+)')
+END_PLANE_RE = re.compile(r'\[capture\] end plane (\S+)')
+END_FRAME_RE = re.compile(r'\[capture\] end frame (\d+)')
+
+ACCENT_RGB = (255, 0, 0)
+
+
+def read_lines(args):
+    if args.log:
+        with open(args.log, 'r', errors='replace') as f:
+            for line in f:
+                yield line.rstrip('\r\n')
+        return
+    import serial  # pyserial
+    with serial.Serial(args.port, args.baud, timeout=args.timeout) as ser:
+        frames_seen = 0
+        while True:
+            raw = ser.readline()
+            if not raw:
+                return  # timed out
+            line = raw.decode('utf-8', errors='replace').rstrip('\r\n')
+            yield line
+            if END_FRAME_RE.search(line):
+                frames_seen += 1
+                if frames_seen >= args.frames:
+                    return
+
+
+def parse_frames(lines):
+    """Yields dicts with keys: index, width, height, timings, planes."""
+    frame = None
+    plane = None
+    for line in lines:
+        m = FRAME_RE.search(line)
+        if m:
+            frame = {'index': int(m.group(1)),
+                     'width': int(m.group(2)),
+                     'height': int(m.group(3)),
+                     'timings': [],
+                     'planes': {}}
+            continue
+        if frame is None:
+            continue
+        m = TIMING_RE.search(line)
+        if m:
+            calls = int(m.group(3)) if m.group(3) else None
+            frame['timings'].append((m.group(1), int(m.group(2)), calls))
+            continue
+        m = PLANE_RE.search(line)
+        if m:
+            plane = (m.group(1), [])
+            continue
+        m = END_PLANE_RE.search(line)
+        if m and plane is not None:
+            frame['planes'][plane[0]] = base64.b64decode(''.join(plane[1]))
+            plane = None
+            continue
+        if END_FRAME_RE.search(line):
+            yield frame
+            frame = None
+            continue
+        if plane is not None:
+            plane[1].append(line.strip())
+
+
+def write_pbm(path, width, height, data):
+    with open(path, 'wb') as f:
+        f.write(b'P4\n%d %d\n' % (width, height))
+        f.write(data)
+
+
+def read_pbm(path):
+    with open(path, 'rb') as f:
+        magic = f.readline().strip()
+        if magic != b'P4':
+            raise ValueError('%s is not a raw PBM (P4) file' % path)
+        line = f.readline()
+        while line.startswith(b'#'):
+            line = f.readline()
+        width, height = (int(v) for v in line.split())
+        return width, height, f.read()
+
+
+def write_png(path, frame):
+    try:
+        from PIL import Image
+    except ImportError:
+        return False
+    w, h = frame['width'], frame['height']
+    img = Image.new('RGB', (w, h), (255, 255, 255))
+    px = img.load()
+    stride = (w + 7) // 8
+    black = frame['planes'].get('black')
+    accent = frame['planes'].get('accent')
+    for y in range(h):
+        for x in range(w):
+            i = y * stride + x // 8
+            bit = 0x80 >> (x & 7)
+            if accent is not None and accent[i] & bit:
+                px[x, y] = ACCENT_RGB
+            elif black is not None and black[i] & bit:
+                px[x, y] = (0, 0, 0)
+    img.save(path)
+    return True
+
+
+def count_diff(a, b):
+    return sum(bin(x ^ y).count('1') for x, y in zip(a, b)) \
+        + 8 * abs(len(a) - len(b))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    src = parser.add_mutually_exclusive_group(required=True)
+    src.add_argument('--log', help='serial log file to read frames from')
+    src.add_argument('--port', help='serial port to read frames from')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--timeout', type=float, default=120,
+                        help='serial read timeout in seconds')
+    parser.add_argument('--frames', type=int, default=1,
+                        help='number of frames to read from the serial port')
+    parser.add_argument('--out', required=True,
+                        help='directory to write PBM/PNG files to')
+    parser.add_argument('--golden',
+                        help='directory of golden PBM files to compare with')
+    parser.add_argument('--update-golden', action='store_true',
+                        help='copy the captured frames into --golden')
+    parser.add_argument('--tolerance', type=int, default=0,
+                        help='number of differing pixels allowed per plane')
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    failures = 0
+    frames = 0
+    for frame in parse_frames(read_lines(args)):
+        frames += 1
+        name = 'frame%d' % frame['index']
+        print('%s (%dx%d)' % (name, frame['width'], frame['height']))
+        for label, us, calls in frame['timings']:
+            suffix = '' if calls is None else '  (%d calls)' % calls
+            print('  %-24s %10.3f ms%s' % (label, us / 1000.0, suffix))
+
+        for plane, data in frame['planes'].items():
+            path = os.path.join(args.out, '%s_%s.pbm' % (name, plane))
+            write_pbm(path, frame['width'], frame['height'], data)
+            if args.golden is None:
+                continue
+            golden = os.path.join(args.golden, '%s_%s.pbm' % (name, plane))
+            if args.update_golden:
+                os.makedirs(args.golden, exist_ok=True)
+                shutil.copyfile(path, golden)
+                print('  %-6s golden updated' % plane)
+                continue
+            if not os.path.exists(golden):
+                print('  %-6s no golden image (%s)' % (plane, golden))
+                failures += 1
+                continue
+            gw, gh, gdata = read_pbm(golden)
+            if (gw, gh) != (frame['width'], frame['height']):
+                print('  %-6s size mismatch, golden is %dx%d' % (plane, gw, gh))
+                failures += 1
+                continue
+            diff = count_diff(data, gdata)
+            status = 'ok' if diff <= args.tolerance else 'MISMATCH'
+            print('  %-6s %d pixels differ  %s' % (plane, diff, status))
+            if diff > args.tolerance:
+                failures += 1
+
+        if write_png(os.path.join(args.out, name + '.png'), frame) is False:
+            print('  (install Pillow to also write PNG files)')
+
+    if frames == 0:
+        print('no frames found')
+        return 2
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
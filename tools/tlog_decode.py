@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+# Tokenized log decoder for esp32-weather-epd.
+# Copyright (C) 2022-2025  Luke Marzen
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Decodes the output of a firmware built with TOKENIZED_LOG 1 (see
+# src/include/tlog.h). Records carry the flash address of their format string
+# and binary arguments; the format strings are read from the firmware.elf of
+# the same build. Text printed by the firmware or the boot ROM between the
+# records is passed through.
+#
+# With --dump the tool asks the ESP32 for every record in its ring buffer. The
+# request is answered at the end of the next wake, the port is opened without
+# toggling DTR/RTS so the board is not reset (a reset would clear the buffer).
+#
+# Usage:
+#   tlog_decode.py --elf .pio/build/<env>/firmware.elf --port /dev/ttyUSB0
+#   tlog_decode.py --elf .pio/build/<env>/firmware.elf --port /dev/ttyUSB0 \
+#                  --dump
+#   tlog_decode.py --elf .pio/build/<env>/firmware.elf --log capture.bin
+
+import argparse
+import hashlib
+import re
+import struct
+import sys
+import time
+
+FRAME_START = 0xFE
+STRING_REF = 0xFF
+DUMP_REQUEST = b'D'
+
+ID_WAKE = 1
+ID_DUMP_BEGIN = 2
+ID_DUMP_END = 3
+
+# esp_reset_reason_t
+RESET_REASONS = ['unknown', 'power-on', 'external', 'software', 'panic',
+                 'interrupt watchdog', 'task watchdog', 'watchdog',
+                 'deep sleep', 'brownout', 'SDIO']
+
+FORMAT_RE = re.compile(r'%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?'
+                       r'(?:\.(?P<prec>\*|\d+))?'
+                       r'(?P<length>hh|h|ll|l|j|z|t|L)?'
+                       r'(?P<conv>[diouxXcsfFeEgGaAp%])')
+
+
+class Elf:
+    """The loadable sections of an ELF file, to read strings by address."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        self.sha256 = hashlib.sha256(self.data).digest()
+        if self.data[:4] != b'\x7fELF':
+            raise ValueError(f'{path} is not an ELF file')
+        is64 = self.data[4] == 2
+        endian = '<' if self.data[5] == 1 else '>'
+        if is64:
+            shoff, = struct.unpack_from(endian + 'Q', self.data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', self.data,
+                                                  0x3A)
+            section = endian + 'IIQQQQ'
+        else:
+            shoff, = struct.unpack_from(endian + 'I', self.data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', self.data,
+                                                  0x2E)
+            section = endian + 'IIIIII'
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                section, self.data, shoff + i * shentsize)
+            # SHF_ALLOC, not SHT_NOBITS
+            if flags & 0x2 and sh_type != 8 and addr != 0:
+                self.sections.append((addr, size, offset))
+
+    def string(self, addr):
+        for start, size, offset in self.sections:
+            if start <= addr < start + size:
+                pos = offset + addr - start
+                end = self.data.find(b'\0', pos, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[pos:end].decode('utf-8', errors='replace')
+        return None
+
+
+class Args:
+    """Reads the binary arguments of a record in order."""
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.pos + size > len(self.data):
+            raise EOFError
+        value, = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return value
+
+    def string(self, elf):
+        tag = self.take('<B')
+        if tag == STRING_REF:
+            addr = self.take('<I')
+            s = elf.string(addr)
+            return s if s is not None else f'<string 0x{addr:08x}?>'
+        if self.pos + tag > len(self.data):
+            raise EOFError
+        s = self.data[self.pos:self.pos + tag]
+        self.pos += tag
+        return s.decode('utf-8', errors='replace')
+
+
+def format_message(fmt, args, elf):
+    """printf for the arguments of a record, see tlog.h for the encoding."""
+    out = []
+    last = 0
+    for m in FORMAT_RE.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        conv = m.group('conv')
+        if conv == '%':
+            out.append('%')
+            continue
+        try:
+            width = m.group('width') or ''
+            if width == '*':
+                width = str(args.take('<i'))
+            prec = m.group('prec')
+            if prec == '*':
+                prec = str(args.take('<i'))
+            spec = '%' + m.group('flags') + width
+            if prec is not None:
+                spec += '.' + prec
+            wide = m.group('length') in ('ll', 'j')
+            if conv in 'di':
+                out.append((spec + 'd') % args.take('<q' if wide else '<i'))
+            elif conv in 'ouxX':
+                value = args.take('<Q' if wide else '<I')
+                out.append((spec + conv.replace('u', 'd')) % value)
+            elif conv == 'c':
+                out.append((spec + 'c') % chr(args.take('<I') & 0xFF))
+            elif conv == 's':
+                out.append((spec + 's') % args.string(elf))
+            elif conv == 'p':
+                out.append('0x%08x' % args.take('<I'))
+            elif conv in 'aA':
+                out.append(float.hex(args.take('<f')))
+            else:
+                out.append((spec + conv.replace('F', 'f'))
+                           % args.take('<f'))
+        except EOFError:
+            out.append('<truncated>')
+            return ''.join(out)
+    out.append(fmt[last:])
+    return ''.join(out)
+
+
+class Decoder:
+    def __init__(self, elf):
+        self.elf = elf
+        self.buf = bytearray()
+        self.text = bytearray()
+        self.dump_done = False
+
+    def record(self, data):
+        rid, ms = struct.unpack_from('<II', data)
+        args = Args(data[8:])
+        if rid == ID_WAKE:
+            wake = args.take('<I')
+            reason = args.take('<I')
+            lost = args.take('<I')
+            elf_hash = args.take('<4s')
+            reason = (RESET_REASONS[reason] if reason < len(RESET_REASONS)
+                      else str(reason))
+            line = f'--- wake {wake}, reset: {reason}'
+            if lost:
+                line += f', {lost} records lost'
+            print(line + ' ---')
+            if elf_hash not in (b'\0\0\0\0', self.elf.sha256[:4]):
+                print('warning: the firmware was not built from this ELF, '
+                      'messages may be wrong', file=sys.stderr)
+            return
+        if rid in (ID_DUMP_BEGIN, ID_DUMP_END):
+            what = 'begin' if rid == ID_DUMP_BEGIN else 'end'
+            print(f'--- dump {what} (wake {args.take("<I")}) ---')
+            self.dump_done |= rid == ID_DUMP_END
+            return
+        fmt = self.elf.string(rid)
+        if fmt is None:
+            msg = f'<unknown message 0x{rid:08x}>'
+        else:
+            msg = format_message(fmt, args, self.elf)
+        print(f'[{ms / 1000:8.3f}] {msg.rstrip()}')
+
+    def feed(self, chunk):
+        self.buf += chunk
+        while self.buf:
+            if self.buf[0] != FRAME_START:
+                byte = self.buf.pop(0)
+                if byte == ord('\n'):
+                    print(self.text.decode('utf-8', errors='replace')
+                          .rstrip('\r'))
+                    self.text.clear()
+                else:
+                    self.text.append(byte)
+                continue
+            if len(self.buf) < 2 or len(self.buf) < self.buf[1] + 3:
+                return  # wait for the rest of the frame
+            n = self.buf[1]
+            frame = self.buf[1:n + 2]
+            if n < 8 or sum(frame) & 0xFF != self.buf[n + 2]:
+                self.buf.pop(0)  # noise, e.g. while the baud rate changes
+                continue
+            del self.buf[:n + 3]
+            self.record(bytes(frame[1:]))
+
+    def finish(self):
+        if self.text:
+            print(self.text.decode('utf-8', errors='replace').rstrip('\r'))
+            self.text.clear()
+
+
+def read_port(args, decoder):
+    import serial  # pyserial
+    ser = serial.Serial()
+    ser.port = args.port
+    ser.baudrate = args.baud
+    ser.timeout = 0.2
+    ser.dtr = False
+    ser.rts = False
+    ser.open()
+    try:
+        deadline = time.monotonic() + args.timeout if args.timeout else None
+        while not (args.dump and decoder.dump_done):
+            if deadline is not None and time.monotonic() > deadline:
+                break
+            if args.dump:
+                ser.write(DUMP_REQUEST)
+            decoder.feed(ser.read(4096))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        ser.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--elf', required=True,
+                        help='firmware.elf of the build on the ESP32')
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--log', help='raw serial capture to decode')
+    source.add_argument('--port', help='serial port to read from')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--dump', action='store_true',
+                        help='request the whole ring buffer and exit')
+    parser.add_argument('--timeout', type=float, default=0,
+                        help='seconds to read from the port, 0 = until '
+                             'interrupted')
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf(args.elf))
+    if args.log:
+        with open(args.log, 'rb') as f:
+            decoder.feed(f.read())
+    else:
+        read_port(args, decoder)
+    decoder.finish()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())